@@ -22,12 +22,26 @@ SILK_SOURCES += $(SILK_SOURCES_FIXED)
 CELT_SOURCES += $(CELT_SOURCES_ARM)
 SILK_SOURCES += $(SILK_SOURCES_ARM)
 
+# NEON内联函数优化，两个ARM ABI都保证有NEON，不需要运行时检测
+OPUS_ARM_CFLAGS :=
+ifneq ($(filter $(TARGET_ARCH_ABI),armeabi-v7a arm64-v8a),)
+CELT_SOURCES += $(CELT_SOURCES_ARM_NEON_INTR)
+SILK_SOURCES += $(SILK_SOURCES_ARM_NEON_INTR) $(SILK_SOURCES_FIXED_ARM_NEON_INTR)
+OPUS_ARM_CFLAGS := -DOPUS_ARM_MAY_HAVE_NEON_INTR -DOPUS_ARM_PRESUME_NEON_INTR
+ifeq ($(TARGET_ARCH_ABI),arm64-v8a)
+OPUS_ARM_CFLAGS += -DOPUS_ARM_PRESUME_AARCH64_NEON_INTR
+else
+LOCAL_ARM_NEON := true
+endif
+endif
+
 LOCAL_SRC_FILES := \
     $(CELT_SOURCES) $(SILK_SOURCES) $(OPUS_SOURCES) $(OPUS_SOURCES_FLOAT)
 
 LOCAL_LDLIBS := -lm -llog
 
 LOCAL_C_INCLUDES := \
+    $(LOCAL_PATH)/opus-1.3.1 \
     $(LOCAL_PATH)/opus-1.3.1/include \
     $(LOCAL_PATH)/opus-1.3.1/silk \
     $(LOCAL_PATH)/opus-1.3.1/silk/fixed \
@@ -35,6 +49,7 @@ LOCAL_C_INCLUDES := \
 
 LOCAL_CFLAGS := -DNULL=0 -DSOCKLEN_T=socklen_t -DLOCALE_NOT_USED -D_LARGEFILE_SOURCE=1 -D_FILE_OFFSET_BITS=64
 LOCAL_CFLAGS += -Drestrict='' -D__EMX__ -DOPUS_BUILD -DFIXED_POINT -DUSE_ALLOCA -DHAVE_LRINT -DHAVE_LRINTF -O3 -fno-math-errno
+LOCAL_CFLAGS += $(OPUS_ARM_CFLAGS)
 
 LOCAL_CPPFLAGS := -DBSD=1 
 LOCAL_CPPFLAGS += -ffast-math -O3 -funroll-loops
@@ -45,10 +60,55 @@ include $(BUILD_SHARED_LIBRARY)
 include $(CLEAR_VARS)
 
 LOCAL_MODULE := opus_jni
-LOCAL_SRC_FILES := opus_jni.cpp
+LOCAL_SRC_FILES := \
+    opus_jni.cpp \
+    audio/audio_thread.cpp \
+    audio/capture_session.cpp \
+    audio/offline_opus_encoder.cpp \
+    audio/ogg_opus_writer.cpp \
+    audio/opus_frame_assembler.cpp \
+    audio/opus_stream_decoder.cpp \
+    audio/trace_ring.cpp \
+    matcher/work_stealing_pool.cpp
 LOCAL_SHARED_LIBRARIES := opus
 LOCAL_LDLIBS := -llog
 LOCAL_C_INCLUDES := \
+    $(LOCAL_PATH) \
     $(LOCAL_PATH)/opus-1.3.1/include
+LOCAL_CPPFLAGS := -O3
+
+include $(BUILD_SHARED_LIBRARY)
+
+# Skill matcher library
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := skill_matcher
+LOCAL_SRC_FILES := \
+    matcher_jni.cpp \
+    matcher/batch_scorer.cpp \
+    matcher/grammar.cpp \
+    matcher/result_cache.cpp \
+    matcher/match_input.cpp \
+    matcher/score_bound.cpp \
+    matcher/sentence_matcher.cpp \
+    matcher/tokenizer.cpp \
+    matcher/unicode_tables.cpp \
+    matcher/work_stealing_pool.cpp
+LOCAL_LDLIBS := -llog
+LOCAL_CPPFLAGS := -O3 -ffp-contract=off
+
+include $(BUILD_SHARED_LIBRARY)
+
+# Zip extractor library
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := zip_extractor
+LOCAL_SRC_FILES := \
+    zip_jni.cpp \
+    archive/zip_extractor.cpp \
+    matcher/work_stealing_pool.cpp
+LOCAL_C_INCLUDES := $(LOCAL_PATH)
+LOCAL_LDLIBS := -llog -lz
+LOCAL_CPPFLAGS := -O3
 
 include $(BUILD_SHARED_LIBRARY)
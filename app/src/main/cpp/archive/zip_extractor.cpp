@@ -0,0 +1,710 @@
+#include "zip_extractor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "matcher/work_stealing_pool.h"
+
+namespace archive {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+constexpr uint32_t CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+constexpr uint32_t END_SIGNATURE = 0x06054b50;
+constexpr uint32_t ZIP64_END_SIGNATURE = 0x06064b50;
+constexpr uint32_t ZIP64_LOCATOR_SIGNATURE = 0x07064b50;
+constexpr size_t LOCAL_HEADER_SIZE = 30;
+constexpr size_t CENTRAL_HEADER_SIZE = 46;
+constexpr size_t END_SIZE = 22;
+constexpr size_t ZIP64_END_SIZE = 56;
+constexpr size_t ZIP64_LOCATOR_SIZE = 20;
+constexpr size_t MAX_COMMENT = 0xffff;
+constexpr uint16_t ZIP64_EXTRA_ID = 0x0001;
+constexpr uint16_t FLAG_ENCRYPTED = 0x0001;
+constexpr uint16_t METHOD_STORED = 0;
+constexpr uint16_t METHOD_DEFLATE = 8;
+// deflate的输入按这个大小读取，输出缓冲区由options.bufferSize决定
+constexpr size_t INPUT_CHUNK = 256 * 1024;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+uint16_t read16(const uint8_t *p) {
+    return (uint16_t) (p[0] | p[1] << 8);
+}
+
+uint32_t read32(const uint8_t *p) {
+    return (uint32_t) read16(p) | (uint32_t) read16(p + 2) << 16;
+}
+
+uint64_t read64(const uint8_t *p) {
+    return (uint64_t) read32(p) | (uint64_t) read32(p + 4) << 32;
+}
+
+bool preadFully(int fd, void *buffer, size_t size, uint64_t offset) {
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+    while (size > 0) {
+        ssize_t n = pread(fd, out, size, (off_t) offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            if (n == 0) {
+                errno = EIO; // 文件比中央目录说的短
+            }
+            return false;
+        }
+        out += n;
+        size -= (size_t) n;
+        offset += (uint64_t) n;
+    }
+    return true;
+}
+
+bool pwriteFully(int fd, const void *buffer, size_t size, uint64_t offset) {
+    const uint8_t *in = static_cast<const uint8_t *>(buffer);
+    while (size > 0) {
+        ssize_t n = pwrite(fd, in, size, (off_t) offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        in += n;
+        size -= (size_t) n;
+        offset += (uint64_t) n;
+    }
+    return true;
+}
+
+// bionic在API 34才有copy_file_range的封装，直接用系统调用（Linux 4.5+）
+ssize_t copyFileRange(int in, uint64_t *inOffset, int out, uint64_t *outOffset, size_t size) {
+#ifdef __NR_copy_file_range
+    loff_t inPos = (loff_t) *inOffset, outPos = (loff_t) *outOffset;
+    ssize_t n = syscall(__NR_copy_file_range, in, &inPos, out, &outPos, size, 0u);
+    if (n > 0) {
+        *inOffset = (uint64_t) inPos;
+        *outOffset = (uint64_t) outPos;
+    }
+    return n;
+#else
+    (void) in; (void) inOffset; (void) out; (void) outOffset; (void) size;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+class FileDescriptor {
+public:
+    explicit FileDescriptor(int fd = -1) : fd_(fd) {}
+    ~FileDescriptor() {
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+    FileDescriptor(const FileDescriptor &) = delete;
+    FileDescriptor &operator=(const FileDescriptor &) = delete;
+
+    int get() const { return fd_; }
+
+    // 写入的文件要检查close的结果，有些文件系统在close时才报告写入错误
+    bool close_() {
+        int fd = fd_;
+        fd_ = -1;
+        return fd < 0 || close(fd) == 0;
+    }
+
+private:
+    int fd_;
+};
+
+// zip64扩展字段按 原始大小、压缩后大小、本地头偏移 的顺序，只包含中央目录里为0xFFFFFFFF的项
+bool applyZip64Extra(const uint8_t *extra, size_t length, ZipEntry &entry,
+                     bool sizeMissing, bool compressedMissing, bool offsetMissing) {
+    while (length >= 4) {
+        uint16_t id = read16(extra);
+        uint16_t size = read16(extra + 2);
+        if (4u + size > length) {
+            return false;
+        }
+        if (id == ZIP64_EXTRA_ID) {
+            const uint8_t *p = extra + 4;
+            size_t needed = 8 * (sizeMissing + compressedMissing + offsetMissing);
+            if (size < needed) {
+                return false;
+            }
+            if (sizeMissing) {
+                entry.size = read64(p);
+                p += 8;
+            }
+            if (compressedMissing) {
+                entry.compressedSize = read64(p);
+                p += 8;
+            }
+            if (offsetMissing) {
+                entry.localHeaderOffset = read64(p);
+            }
+            return true;
+        }
+        extra += 4 + size;
+        length -= 4 + size;
+    }
+    return !(sizeMissing || compressedMissing || offsetMissing);
+}
+
+/**
+ * 条目在destination下的相对路径，空字符串表示跳过（被去掉的第一段本身）
+ */
+int relativePath(const std::string &name, bool stripFirstComponent, std::string &path) {
+    if (name.find('\0') != std::string::npos || name.find('\\') != std::string::npos) {
+        return ZIP_UNSAFE_PATH;
+    }
+    size_t start = 0;
+    if (stripFirstComponent) {
+        size_t slash = name.find('/');
+        start = slash == std::string::npos ? 0 : slash + 1;
+    }
+    path = name.substr(start);
+    if (!path.empty() && path[0] == '/') {
+        return ZIP_UNSAFE_PATH;
+    }
+    // 不允许 ".." 路径段；目标目录是刚清空的，不需要像Kotlin那样解析符号链接
+    size_t begin = 0;
+    while (begin <= path.size()) {
+        size_t end = path.find('/', begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        if (path.compare(begin, end - begin, "..") == 0 && end - begin == 2) {
+            return ZIP_UNSAFE_PATH;
+        }
+        begin = end + 1;
+    }
+    while (!path.empty() && path.back() == '/') {
+        path.pop_back();
+    }
+    return ZIP_OK;
+}
+
+bool makeDirectories(const std::string &path, std::set<std::string> &created) {
+    if (path.empty() || created.count(path) != 0) {
+        return true;
+    }
+    size_t slash = path.rfind('/');
+    if (slash != std::string::npos && slash > 0
+            && !makeDirectories(path.substr(0, slash), created)) {
+        return false;
+    }
+    if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST) {
+        return false;
+    }
+    created.insert(path);
+    return true;
+}
+
+struct Job {
+    const ZipEntry *entry;
+    std::string path;
+    uint64_t dataOffset = 0;
+};
+
+struct SharedState {
+    std::atomic<uint64_t> doneBytes{0};
+    std::atomic<size_t> doneFiles{0};
+    std::atomic<size_t> kernelCopies{0};
+    std::atomic<bool> stop{false};
+    // 内核不支持时第一次失败后就不再尝试
+    std::atomic<bool> copyFileRangeWorks{true};
+
+    std::mutex errorMutex;
+    int error = ZIP_OK;
+    int systemError = 0;
+    std::string failedEntry;
+
+    void fail(int result, const Job &job) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (error == ZIP_OK) {
+            error = result;
+            systemError = result == ZIP_IO_ERROR ? errno : 0;
+            failedEntry = job.entry->name;
+        }
+        stop.store(true);
+    }
+};
+
+int extractStored(int zipFd, int outFd, const Job &job, bool useCopyFileRange,
+                  std::vector<uint8_t> &buffer, SharedState &shared) {
+    const ZipEntry &entry = *job.entry;
+    uint64_t done = 0;
+    uint32_t crc = (uint32_t) crc32(0L, Z_NULL, 0);
+    bool kernelCopy = useCopyFileRange && shared.copyFileRangeWorks.load();
+
+    while (kernelCopy && done < entry.size) {
+        if (shared.stop.load(std::memory_order_relaxed)) {
+            return ZIP_CANCELLED;
+        }
+        uint64_t in = job.dataOffset + done, out = done;
+        size_t chunk = (size_t) std::min<uint64_t>(entry.size - done, buffer.size());
+        ssize_t n = copyFileRange(zipFd, &in, outFd, &out, chunk);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            if (n == 0) {
+                errno = EIO; // 源文件比中央目录说的短
+                return ZIP_IO_ERROR;
+            }
+            if (done != 0) {
+                return ZIP_IO_ERROR;
+            }
+            // ENOSYS、EXDEV（旧内核跨文件系统）、EINVAL等：退回到用户态复制
+            shared.copyFileRangeWorks.store(false);
+            kernelCopy = false;
+            break;
+        }
+        done += (uint64_t) n;
+        shared.doneBytes.fetch_add((uint64_t) n, std::memory_order_relaxed);
+    }
+
+    if (kernelCopy) {
+        // 数据没有经过用户态，CRC从源文件读一遍来算（刚下载的压缩包通常还在页缓存里）
+        for (uint64_t offset = 0; offset < entry.size;) {
+            size_t chunk = (size_t) std::min<uint64_t>(entry.size - offset, buffer.size());
+            if (!preadFully(zipFd, buffer.data(), chunk, job.dataOffset + offset)) {
+                return ZIP_IO_ERROR;
+            }
+            crc = (uint32_t) crc32(crc, buffer.data(), (uInt) chunk);
+            offset += chunk;
+        }
+        shared.kernelCopies.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        for (; done < entry.size;) {
+            if (shared.stop.load(std::memory_order_relaxed)) {
+                return ZIP_CANCELLED;
+            }
+            size_t chunk = (size_t) std::min<uint64_t>(entry.size - done, buffer.size());
+            if (!preadFully(zipFd, buffer.data(), chunk, job.dataOffset + done)
+                    || !pwriteFully(outFd, buffer.data(), chunk, done)) {
+                return ZIP_IO_ERROR;
+            }
+            crc = (uint32_t) crc32(crc, buffer.data(), (uInt) chunk);
+            done += chunk;
+            shared.doneBytes.fetch_add(chunk, std::memory_order_relaxed);
+        }
+    }
+    return crc == entry.crc32 ? ZIP_OK : ZIP_CRC_MISMATCH;
+}
+
+int extractDeflated(int zipFd, int outFd, const Job &job, std::vector<uint8_t> &input,
+                    std::vector<uint8_t> &output, SharedState &shared) {
+    const ZipEntry &entry = *job.entry;
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    // 负的windowBits表示没有zlib头的原始deflate流
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        return ZIP_IO_ERROR;
+    }
+    std::unique_ptr<z_stream, int (*)(z_stream *)> guard(&stream, inflateEnd);
+
+    uint64_t readOffset = 0, written = 0;
+    uint32_t crc = (uint32_t) crc32(0L, Z_NULL, 0);
+    int ret = Z_OK;
+    while (ret != Z_STREAM_END) {
+        if (shared.stop.load(std::memory_order_relaxed)) {
+            return ZIP_CANCELLED;
+        }
+        stream.next_out = output.data();
+        stream.avail_out = (uInt) output.size();
+        // 填满整个输出缓冲区（或流结束）之后才写一次
+        while (stream.avail_out != 0 && ret != Z_STREAM_END) {
+            if (stream.avail_in == 0 && readOffset < entry.compressedSize) {
+                size_t chunk = (size_t) std::min<uint64_t>(entry.compressedSize - readOffset,
+                                                           input.size());
+                if (!preadFully(zipFd, input.data(), chunk, job.dataOffset + readOffset)) {
+                    return ZIP_IO_ERROR;
+                }
+                readOffset += chunk;
+                stream.next_in = input.data();
+                stream.avail_in = (uInt) chunk;
+            }
+            ret = inflate(&stream, Z_NO_FLUSH);
+            // Z_BUF_ERROR：输入已经读完，流却没有结束
+            if (ret != Z_OK && ret != Z_STREAM_END) {
+                return ret == Z_MEM_ERROR ? ZIP_IO_ERROR : ZIP_BAD_ARCHIVE;
+            }
+        }
+        size_t produced = output.size() - stream.avail_out;
+        if (written + produced > entry.size) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        if (produced > 0) {
+            if (!pwriteFully(outFd, output.data(), produced, written)) {
+                return ZIP_IO_ERROR;
+            }
+            crc = (uint32_t) crc32(crc, output.data(), (uInt) produced);
+            written += produced;
+            shared.doneBytes.fetch_add(produced, std::memory_order_relaxed);
+        }
+    }
+    if (written != entry.size) {
+        return ZIP_BAD_ARCHIVE;
+    }
+    return crc == entry.crc32 ? ZIP_OK : ZIP_CRC_MISMATCH;
+}
+
+int extractJob(int zipFd, const Job &job, const ZipExtractOptions &options,
+               std::vector<uint8_t> &input, std::vector<uint8_t> &output, SharedState &shared) {
+    const ZipEntry &entry = *job.entry;
+    FileDescriptor out(open(job.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+    if (out.get() < 0) {
+        return ZIP_IO_ERROR;
+    }
+    if (entry.size > 0) {
+        // 预先分配空间，减少并发写入时的碎片和元数据更新。文件系统不支持就算了；
+        // 不用posix_fallocate，glibc在不支持时会逐块写零来模拟
+        int ret = fallocate(out.get(), 0, 0, (off_t) entry.size);
+        (void) ret;
+    }
+    int result = entry.method == METHOD_STORED
+            ? extractStored(zipFd, out.get(), job, options.copyFileRange, output, shared)
+            : extractDeflated(zipFd, out.get(), job, input, output, shared);
+    if (result == ZIP_OK && !out.close_()) {
+        return ZIP_IO_ERROR;
+    }
+    return result;
+}
+
+} // namespace
+
+int readZipDirectory(int fd, std::vector<ZipEntry> &entries) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return ZIP_IO_ERROR;
+    }
+    uint64_t fileSize = (uint64_t) st.st_size;
+    if (fileSize < END_SIZE) {
+        return ZIP_BAD_ARCHIVE;
+    }
+
+    // 目录结束记录在文件末尾，后面最多跟着64KB的注释
+    size_t tailSize = (size_t) std::min<uint64_t>(fileSize, END_SIZE + MAX_COMMENT);
+    std::vector<uint8_t> tail(tailSize);
+    if (!preadFully(fd, tail.data(), tailSize, fileSize - tailSize)) {
+        return ZIP_IO_ERROR;
+    }
+    size_t endPos = std::string::npos;
+    for (size_t i = tailSize - END_SIZE + 1; i-- > 0;) {
+        if (read32(&tail[i]) == END_SIGNATURE
+                && i + END_SIZE + read16(&tail[i + 20]) <= tailSize) {
+            endPos = i;
+            break;
+        }
+    }
+    if (endPos == std::string::npos) {
+        return ZIP_BAD_ARCHIVE;
+    }
+    const uint8_t *end = &tail[endPos];
+    uint64_t endOffset = fileSize - tailSize + endPos;
+    uint16_t disk = read16(end + 4), directoryDisk = read16(end + 6);
+    uint64_t count = read16(end + 10);
+    uint64_t directorySize = read32(end + 12);
+    uint64_t directoryOffset = read32(end + 16);
+
+    if (count == 0xffff || directorySize == 0xffffffff || directoryOffset == 0xffffffff) {
+        uint8_t locator[ZIP64_LOCATOR_SIZE], end64[ZIP64_END_SIZE];
+        if (endOffset < ZIP64_LOCATOR_SIZE
+                || !preadFully(fd, locator, sizeof(locator), endOffset - ZIP64_LOCATOR_SIZE)) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        if (read32(locator) != ZIP64_LOCATOR_SIGNATURE) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        uint64_t end64Offset = read64(locator + 8);
+        if (end64Offset + ZIP64_END_SIZE > fileSize
+                || !preadFully(fd, end64, sizeof(end64), end64Offset)
+                || read32(end64) != ZIP64_END_SIGNATURE) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        disk = (uint16_t) std::min<uint32_t>(read32(end64 + 16), 0xffff);
+        directoryDisk = (uint16_t) std::min<uint32_t>(read32(end64 + 20), 0xffff);
+        count = read64(end64 + 32);
+        directorySize = read64(end64 + 40);
+        directoryOffset = read64(end64 + 48);
+    }
+    if (disk != 0 || directoryDisk != 0) {
+        return ZIP_UNSUPPORTED;
+    }
+    if (directoryOffset + directorySize > fileSize
+            || count > directorySize / CENTRAL_HEADER_SIZE) {
+        return ZIP_BAD_ARCHIVE;
+    }
+
+    std::vector<uint8_t> directory((size_t) directorySize);
+    if (!preadFully(fd, directory.data(), directory.size(), directoryOffset)) {
+        return ZIP_IO_ERROR;
+    }
+    entries.clear();
+    entries.reserve((size_t) count);
+    size_t pos = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        if (pos + CENTRAL_HEADER_SIZE > directory.size()) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        const uint8_t *header = &directory[pos];
+        if (read32(header) != CENTRAL_HEADER_SIGNATURE) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        size_t nameLength = read16(header + 28);
+        size_t extraLength = read16(header + 30);
+        size_t commentLength = read16(header + 32);
+        if (pos + CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength
+                > directory.size()) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        ZipEntry entry;
+        entry.flags = read16(header + 8);
+        entry.method = read16(header + 10);
+        entry.crc32 = read32(header + 16);
+        entry.compressedSize = read32(header + 20);
+        entry.size = read32(header + 24);
+        entry.localHeaderOffset = read32(header + 42);
+        entry.name.assign(reinterpret_cast<const char *>(header + CENTRAL_HEADER_SIZE),
+                          nameLength);
+        if (!applyZip64Extra(header + CENTRAL_HEADER_SIZE + nameLength, extraLength, entry,
+                             entry.size == 0xffffffff, entry.compressedSize == 0xffffffff,
+                             entry.localHeaderOffset == 0xffffffff)) {
+            return ZIP_BAD_ARCHIVE;
+        }
+        if (read16(header + 34) != 0 && read16(header + 34) != 0xffff) {
+            return ZIP_UNSUPPORTED; // 条目在另一个分卷上
+        }
+        entries.push_back(std::move(entry));
+        pos += CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+    }
+    return ZIP_OK;
+}
+
+int extractZip(const std::string &zipPath, const std::string &destination,
+               const ZipExtractOptions &options, const ZipProgressCallback &progress,
+               ZipExtractStats *stats) {
+    ZipExtractStats localStats;
+    Clock::time_point start = Clock::now();
+    FileDescriptor zip(open(zipPath.c_str(), O_RDONLY | O_CLOEXEC));
+    if (zip.get() < 0) {
+        if (stats) {
+            stats->systemError = errno;
+        }
+        return ZIP_IO_ERROR;
+    }
+    std::vector<ZipEntry> entries;
+    int result = readZipDirectory(zip.get(), entries);
+    if (result != ZIP_OK) {
+        if (stats) {
+            stats->systemError = result == ZIP_IO_ERROR ? errno : 0;
+        }
+        return result;
+    }
+
+    // 串行检查所有路径、读本地头并创建目录，出错时还没有写任何文件
+    std::string root = destination;
+    while (root.size() > 1 && root.back() == '/') {
+        root.pop_back();
+    }
+    std::set<std::string> created;
+    if (!makeDirectories(root, created)) {
+        localStats.systemError = errno;
+        localStats.failedEntry = root;
+        if (stats) {
+            *stats = localStats;
+        }
+        return ZIP_IO_ERROR;
+    }
+    std::vector<Job> jobs;
+    uint64_t fileSize = (uint64_t) lseek(zip.get(), 0, SEEK_END);
+    for (const ZipEntry &entry : entries) {
+        std::string relative;
+        result = relativePath(entry.name, options.stripFirstComponent, relative);
+        if (result == ZIP_OK && relative.empty()) {
+            continue;
+        }
+        std::string path = root + "/" + relative;
+        if (result == ZIP_OK && entry.isDirectory()) {
+            ++localStats.directories;
+            if (!makeDirectories(path, created)) {
+                result = ZIP_IO_ERROR;
+            }
+        } else if (result == ZIP_OK) {
+            if ((entry.flags & FLAG_ENCRYPTED) != 0
+                    || (entry.method != METHOD_STORED && entry.method != METHOD_DEFLATE)) {
+                result = ZIP_UNSUPPORTED;
+            } else if (entry.method == METHOD_STORED && entry.size != entry.compressedSize) {
+                result = ZIP_BAD_ARCHIVE;
+            } else {
+                // 本地头的扩展字段长度可以与中央目录不同，要从本地头读
+                uint8_t local[LOCAL_HEADER_SIZE];
+                Job job;
+                job.entry = &entry;
+                job.path = path;
+                if (!preadFully(zip.get(), local, sizeof(local), entry.localHeaderOffset)) {
+                    result = ZIP_IO_ERROR;
+                } else if (read32(local) != LOCAL_HEADER_SIGNATURE) {
+                    result = ZIP_BAD_ARCHIVE;
+                } else {
+                    job.dataOffset = entry.localHeaderOffset + LOCAL_HEADER_SIZE
+                            + read16(local + 26) + read16(local + 28);
+                    if (job.dataOffset + entry.compressedSize > fileSize) {
+                        result = ZIP_BAD_ARCHIVE;
+                    }
+                }
+                size_t slash = path.rfind('/');
+                if (result == ZIP_OK && !makeDirectories(path.substr(0, slash), created)) {
+                    result = ZIP_IO_ERROR;
+                }
+                if (result == ZIP_OK) {
+                    jobs.push_back(std::move(job));
+                    localStats.bytes += entry.size;
+                    localStats.storedFiles += entry.method == METHOD_STORED;
+                }
+            }
+        }
+        if (result != ZIP_OK) {
+            localStats.systemError = result == ZIP_IO_ERROR ? errno : 0;
+            localStats.failedEntry = entry.name;
+            if (stats) {
+                *stats = localStats;
+            }
+            return result;
+        }
+    }
+    localStats.files = jobs.size();
+    localStats.directorySeconds = secondsSince(start);
+
+    start = Clock::now();
+    size_t threads = options.threads != 0
+            ? options.threads : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, jobs.size()));
+    localStats.threads = threads;
+
+    // 大文件先开始：一个条目只能由一个线程解压，最后才开始的大文件会拖长总时间。
+    // 线程池的队列顺序不是全局的，所以每个任务从共享的计数器取下一个条目
+    std::vector<size_t> order(jobs.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return jobs[a].entry->compressedSize > jobs[b].entry->compressedSize;
+    });
+
+    SharedState shared;
+    std::atomic<size_t> next{0};
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+    bool finished = false;
+    size_t bufferSize = std::max<size_t>(options.bufferSize, 4096);
+
+    // 解压在另一个线程上进行，调用线程只负责定时回调进度，JNI的回调因此总在同一个线程上
+    std::thread runner([&] {
+        {
+            matcher::WorkStealingPool pool(threads - 1);
+            std::vector<std::vector<uint8_t>> inputs(pool.workerCount());
+            std::vector<std::vector<uint8_t>> outputs(pool.workerCount());
+            pool.parallelFor(jobs.size(), [&](size_t, size_t worker) {
+                const Job &job = jobs[order[next.fetch_add(1)]];
+                if (shared.stop.load()) {
+                    return;
+                }
+                std::vector<uint8_t> &input = inputs[worker];
+                std::vector<uint8_t> &output = outputs[worker];
+                if (output.empty()) {
+                    input.resize(INPUT_CHUNK);
+                    output.resize(bufferSize);
+                }
+                int ret = extractJob(zip.get(), job, options, input, output, shared);
+                if (ret == ZIP_CANCELLED) {
+                    return;
+                }
+                if (ret != ZIP_OK) {
+                    shared.fail(ret, job);
+                    return;
+                }
+                shared.doneFiles.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        std::lock_guard<std::mutex> lock(doneMutex);
+        finished = true;
+        doneCondition.notify_all();
+    });
+
+    bool cancelled = false;
+    {
+        std::unique_lock<std::mutex> lock(doneMutex);
+        while (!finished) {
+            doneCondition.wait_for(
+                    lock, std::chrono::milliseconds(std::max(1, options.progressIntervalMs)));
+            if (finished || !progress || cancelled) {
+                continue;
+            }
+            lock.unlock();
+            ZipProgress current = {shared.doneFiles.load(), jobs.size(),
+                                   shared.doneBytes.load(), localStats.bytes};
+            if (!progress(current)) {
+                cancelled = true;
+                shared.stop.store(true);
+            }
+            lock.lock();
+        }
+    }
+    runner.join();
+
+    localStats.extractSeconds = secondsSince(start);
+    localStats.kernelCopies = shared.kernelCopies.load();
+    localStats.systemError = shared.systemError;
+    localStats.failedEntry = shared.failedEntry;
+    if (stats) {
+        *stats = localStats;
+    }
+    if (shared.error != ZIP_OK) {
+        return shared.error;
+    }
+    if (cancelled) {
+        return ZIP_CANCELLED;
+    }
+    if (progress) {
+        progress({jobs.size(), jobs.size(), localStats.bytes, localStats.bytes});
+    }
+    return ZIP_OK;
+}
+
+const char *zipResultString(int result) {
+    switch (result) {
+        case ZIP_OK: return "success";
+        case ZIP_IO_ERROR: return "I/O error";
+        case ZIP_BAD_ARCHIVE: return "corrupted zip archive";
+        case ZIP_UNSUPPORTED: return "unsupported zip feature";
+        case ZIP_CRC_MISMATCH: return "CRC mismatch";
+        case ZIP_UNSAFE_PATH: return "entry is outside of the target directory";
+        case ZIP_CANCELLED: return "cancelled";
+        default: return "unknown error";
+    }
+}
+
+} // namespace archive
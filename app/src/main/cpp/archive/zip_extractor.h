@@ -0,0 +1,97 @@
+#ifndef DICIO_ARCHIVE_ZIP_EXTRACTOR_H
+#define DICIO_ARCHIVE_ZIP_EXTRACTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace archive {
+
+enum ZipResult {
+    ZIP_OK = 0,
+    ZIP_IO_ERROR = -1,
+    ZIP_BAD_ARCHIVE = -2,
+    // 加密、分卷或stored/deflate以外的压缩方法，调用方可以退回到java.util.zip
+    ZIP_UNSUPPORTED = -3,
+    ZIP_CRC_MISMATCH = -4,
+    // 条目的路径会落到目标目录之外（Zip Slip）
+    ZIP_UNSAFE_PATH = -5,
+    ZIP_CANCELLED = -6,
+};
+
+struct ZipEntry {
+    std::string name;
+    uint64_t localHeaderOffset;
+    uint64_t compressedSize;
+    uint64_t size;
+    uint32_t crc32;
+    uint16_t method; // 0 = stored, 8 = deflate
+    uint16_t flags;
+
+    bool isDirectory() const { return !name.empty() && name.back() == '/'; }
+};
+
+struct ZipExtractOptions {
+    // 0表示每个核心一个线程
+    size_t threads = 0;
+    // 与ZipUtils.kt的getDestinationFile一致：模型都在一个子目录里，去掉路径的第一段
+    bool stripFirstComponent = true;
+    // 每个线程的解压输出缓冲区，pwrite的粒度
+    size_t bufferSize = 1 << 20;
+    int progressIntervalMs = 100;
+    // stored条目用copy_file_range在内核中复制，关掉后与deflate条目一样经过用户态（基准测试对比用）
+    bool copyFileRange = true;
+};
+
+struct ZipProgress {
+    size_t doneFiles;
+    size_t totalFiles;
+    uint64_t doneBytes; // 解压后的字节
+    uint64_t totalBytes;
+};
+
+/**
+ * 只在调用extractZip的线程上调用，返回false取消解压
+ */
+using ZipProgressCallback = std::function<bool(const ZipProgress &progress)>;
+
+struct ZipExtractStats {
+    size_t files = 0;
+    size_t directories = 0;
+    size_t storedFiles = 0;
+    size_t kernelCopies = 0; // 用copy_file_range复制的stored条目
+    uint64_t bytes = 0;
+    size_t threads = 0;
+    double directorySeconds = 0;
+    double extractSeconds = 0;
+    int systemError = 0;     // ZIP_IO_ERROR时的errno
+    std::string failedEntry; // 出错的条目
+};
+
+/**
+ * 读取中央目录（支持zip64）。分卷的压缩包返回ZIP_UNSUPPORTED。
+ */
+int readZipDirectory(int fd, std::vector<ZipEntry> &entries);
+
+/**
+ * 把zipPath解压到destination目录。
+ *
+ * 先串行读中央目录、检查路径并创建所有目录，然后按压缩后的大小从大到小在线程池中并行解压
+ * 各个条目：deflate条目用zlib解压到每线程的大缓冲区，再用pwrite写入预先分配好空间的文件；
+ * stored条目用copy_file_range直接在内核中复制（不支持时退回到pread/pwrite）。所有条目
+ * 都校验CRC32。一个条目内部是顺序解压的（deflate流不能从中间开始），所以最大的文件决定了
+ * 总时间的下限。
+ *
+ * 出错或取消时已经写出的文件会留在destination中，由调用方清理。
+ */
+int extractZip(const std::string &zipPath, const std::string &destination,
+               const ZipExtractOptions &options, const ZipProgressCallback &progress,
+               ZipExtractStats *stats = nullptr);
+
+const char *zipResultString(int result);
+
+} // namespace archive
+
+#endif // DICIO_ARCHIVE_ZIP_EXTRACTOR_H
@@ -0,0 +1,253 @@
+#include "audio_thread.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <dirent.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef __ANDROID__
+#include <dlfcn.h>
+#endif
+
+namespace audio {
+
+namespace {
+
+#ifdef __ANDROID__
+
+// APerformanceHint从API 33开始才有，minSdk更低，所以从libandroid.so动态查找
+struct HintApi {
+    void *(*getManager)();
+    void *(*createSession)(void *manager, const int32_t *tids, size_t size,
+                           int64_t initialTargetWorkDurationNanos);
+    int (*reportActualWorkDuration)(void *session, int64_t actualDurationNanos);
+    void (*closeSession)(void *session);
+};
+
+const HintApi *hintApi() {
+    static const HintApi *api = [] () -> const HintApi * {
+        void *lib = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+        if (lib == nullptr) {
+            return nullptr;
+        }
+        static HintApi loaded;
+        loaded.getManager = reinterpret_cast<void *(*)()>(
+                dlsym(lib, "APerformanceHint_getManager"));
+        loaded.createSession = reinterpret_cast<void *(*)(void *, const int32_t *, size_t,
+                                                          int64_t)>(
+                dlsym(lib, "APerformanceHint_createSession"));
+        loaded.reportActualWorkDuration = reinterpret_cast<int (*)(void *, int64_t)>(
+                dlsym(lib, "APerformanceHint_reportActualWorkDuration"));
+        loaded.closeSession = reinterpret_cast<void (*)(void *)>(
+                dlsym(lib, "APerformanceHint_closeSession"));
+        if (loaded.getManager == nullptr || loaded.createSession == nullptr
+            || loaded.reportActualWorkDuration == nullptr || loaded.closeSession == nullptr) {
+            return nullptr;
+        }
+        return &loaded;
+    }();
+    return api;
+}
+
+#endif
+
+} // namespace
+
+AudioThreadConfig audioThreadConfig(AudioThreadRole role, int64_t targetWorkNanos) {
+    AudioThreadConfig config;
+    config.targetWorkNanos = targetWorkNanos;
+    switch (role) {
+        case AUDIO_THREAD_CAPTURE:
+            // 每次只是复制一块PCM，实时调度也占不了多少CPU
+            config.fifoPriority = 2;
+            config.nice = -19; // Android的THREAD_PRIORITY_URGENT_AUDIO
+            break;
+        case AUDIO_THREAD_WAKE:
+            // 每帧一次推理，用SCHED_FIFO在负载高时会饿死同一个核上的其他线程
+            config.nice = -16; // THREAD_PRIORITY_AUDIO
+            config.bigCores = true;
+            break;
+        case AUDIO_THREAD_ENCODE:
+            config.fifoPriority = 1;
+            config.nice = -16;
+            config.bigCores = true;
+            break;
+        case AUDIO_THREAD_PLAYBACK:
+            config.fifoPriority = 2;
+            config.nice = -19;
+            break;
+    }
+    return config;
+}
+
+#ifdef __linux__
+
+CpuTopology readCpuTopology(const std::string &root) {
+    CpuTopology topology;
+    DIR *dir = opendir(root.c_str());
+    if (dir == nullptr) {
+        return topology;
+    }
+    std::vector<std::pair<int, long>> capacities;
+    while (struct dirent *entry = readdir(dir)) {
+        const char *name = entry->d_name;
+        if (strncmp(name, "cpu", 3) != 0 || name[3] < '0' || name[3] > '9') {
+            continue;
+        }
+        char *end;
+        long cpu = strtol(name + 3, &end, 10);
+        if (*end != '\0' || cpu >= CPU_SETSIZE) {
+            continue;
+        }
+        std::string path = root + "/" + name + "/cpu_capacity";
+        FILE *file = fopen(path.c_str(), "r");
+        if (file == nullptr) {
+            continue;
+        }
+        long capacity;
+        if (fscanf(file, "%ld", &capacity) == 1 && capacity > 0) {
+            capacities.emplace_back((int) cpu, capacity);
+        }
+        fclose(file);
+    }
+    closedir(dir);
+
+    topology.cpuCount = (int) capacities.size();
+    if (capacities.empty()) {
+        return topology;
+    }
+    long minCapacity = LONG_MAX, maxCapacity = 0;
+    for (const auto &cpu : capacities) {
+        minCapacity = std::min(minCapacity, cpu.second);
+        maxCapacity = std::max(maxCapacity, cpu.second);
+    }
+    if (minCapacity == maxCapacity) {
+        return topology; // 所有核都一样，不用限制
+    }
+    // 中点以上：1+3+4的三簇结构里超大核和大核都算
+    for (const auto &cpu : capacities) {
+        if (cpu.second * 2 > minCapacity + maxCapacity) {
+            topology.bigCores.push_back(cpu.first);
+        }
+    }
+    std::sort(topology.bigCores.begin(), topology.bigCores.end());
+    return topology;
+}
+
+AudioThreadScope::AudioThreadScope(const AudioThreadConfig &config, const CpuTopology &topology)
+        : tid_((int) syscall(SYS_gettid)), targetWorkNanos_(config.targetWorkNanos) {
+    oldPolicy_ = sched_getscheduler(tid_);
+    struct sched_param param = {};
+    sched_getparam(tid_, &param);
+    oldFifoPriority_ = param.sched_priority;
+    errno = 0;
+    oldNice_ = getpriority(PRIO_PROCESS, (id_t) tid_);
+    if (errno != 0) {
+        oldNice_ = 0;
+    }
+
+    // 普通应用通常没有CAP_SYS_NICE，SCHED_FIFO会失败（EPERM），Android允许应用把nice降到-19
+    if (config.fifoPriority > 0 && oldPolicy_ == SCHED_OTHER) {
+        param.sched_priority = config.fifoPriority;
+        if (sched_setscheduler(tid_, SCHED_FIFO, &param) == 0) {
+            priority_ = AUDIO_PRIORITY_FIFO;
+        }
+    }
+    if (priority_ == AUDIO_PRIORITY_UNCHANGED && config.nice < 0 && config.nice < oldNice_
+        && setpriority(PRIO_PROCESS, (id_t) tid_, config.nice) == 0) {
+        priority_ = AUDIO_PRIORITY_NICE;
+    }
+
+    if (config.bigCores && !topology.bigCores.empty()) {
+        cpu_set_t old;
+        CPU_ZERO(&old);
+        if (sched_getaffinity(tid_, sizeof(old), &old) == 0) {
+            // 只在原来允许的核里选（cpuset可能已经把后台应用限制在小核上）
+            cpu_set_t big;
+            CPU_ZERO(&big);
+            for (int cpu : topology.bigCores) {
+                if (CPU_ISSET(cpu, &old)) {
+                    CPU_SET(cpu, &big);
+                }
+            }
+            if (CPU_COUNT(&big) > 0 && !CPU_EQUAL(&big, &old)
+                && sched_setaffinity(tid_, sizeof(big), &big) == 0) {
+                oldMask_.assign(reinterpret_cast<uint8_t *>(&old),
+                                reinterpret_cast<uint8_t *>(&old) + sizeof(old));
+                pinned_ = true;
+            }
+        }
+    }
+
+#ifdef __ANDROID__
+    const HintApi *api = hintApi();
+    if (targetWorkNanos_ > 0 && api != nullptr) {
+        void *manager = api->getManager();
+        int32_t tid = tid_;
+        if (manager != nullptr) {
+            hintSession_ = api->createSession(manager, &tid, 1, targetWorkNanos_);
+        }
+    }
+#endif
+}
+
+AudioThreadScope::~AudioThreadScope() {
+#ifdef __ANDROID__
+    if (hintSession_ != nullptr) {
+        hintApi()->closeSession(hintSession_);
+    }
+#endif
+    if (pinned_) {
+        sched_setaffinity(tid_, oldMask_.size(), reinterpret_cast<cpu_set_t *>(oldMask_.data()));
+    }
+    if (priority_ == AUDIO_PRIORITY_FIFO) {
+        struct sched_param param = {};
+        param.sched_priority = oldFifoPriority_;
+        sched_setscheduler(tid_, oldPolicy_, &param);
+    } else if (priority_ == AUDIO_PRIORITY_NICE) {
+        setpriority(PRIO_PROCESS, (id_t) tid_, oldNice_);
+    }
+}
+
+#else
+
+CpuTopology readCpuTopology(const std::string &) {
+    return CpuTopology();
+}
+
+AudioThreadScope::AudioThreadScope(const AudioThreadConfig &config, const CpuTopology &)
+        : tid_(0), targetWorkNanos_(config.targetWorkNanos) {
+}
+
+AudioThreadScope::~AudioThreadScope() = default;
+
+#endif
+
+const CpuTopology &cpuTopology() {
+    static const CpuTopology topology = readCpuTopology();
+    return topology;
+}
+
+void AudioThreadScope::reportWork(int64_t nanos) {
+    ++reports_;
+    if (targetWorkNanos_ > 0 && nanos > targetWorkNanos_) {
+        ++overruns_;
+    }
+#ifdef __ANDROID__
+    if (hintSession_ != nullptr && nanos > 0) {
+        hintApi()->reportActualWorkDuration(hintSession_, nanos);
+    }
+#endif
+}
+
+} // namespace audio
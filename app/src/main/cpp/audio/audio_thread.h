@@ -0,0 +1,100 @@
+#ifndef DICIO_AUDIO_AUDIO_THREAD_H
+#define DICIO_AUDIO_AUDIO_THREAD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace audio {
+
+enum AudioThreadRole {
+    // WakeService的录音线程：AudioRecord.read之后写入录音会话，计算量很小
+    AUDIO_THREAD_CAPTURE = 0,
+    // 唤醒词检测：每帧一次神经网络推理
+    AUDIO_THREAD_WAKE = 1,
+    // 语音识别上行：Opus编码并发送
+    AUDIO_THREAD_ENCODE = 2,
+    // 云端TTS播放：从播放环取出PCM写入AudioTrack
+    AUDIO_THREAD_PLAYBACK = 3,
+};
+
+enum AudioThreadPriority {
+    AUDIO_PRIORITY_UNCHANGED = 0, // 没有权限，保持原来的调度
+    AUDIO_PRIORITY_NICE = 1, // 降低了nice值（CFS调度）
+    AUDIO_PRIORITY_FIFO = 2, // SCHED_FIFO实时调度
+};
+
+struct AudioThreadConfig {
+    int fifoPriority = 0; // >0时先尝试SCHED_FIFO，失败再退回nice
+    int nice = 0; // <0时降低nice值
+    bool bigCores = false; // 只在大核上运行
+    int64_t targetWorkNanos = 0; // >0时创建APerformanceHint会话，通常是一帧的时长
+};
+
+/**
+ * 各个角色的默认设置：计算量大的检测和编码放到大核上，实时调度只给每次只做很少工作的线程，
+ * 以免长时间占住CPU。
+ */
+AudioThreadConfig audioThreadConfig(AudioThreadRole role, int64_t targetWorkNanos);
+
+struct CpuTopology {
+    int cpuCount = 0; // 有cpu_capacity的CPU数
+    std::vector<int> bigCores; // 容量在最大和最小之间的中点以上的CPU，全部相同时为空
+};
+
+/**
+ * 从root下的cpuN/cpu_capacity读取各个CPU的相对性能（内核的arch_topology，ARM的大小核上
+ * 才有）。读不到时cpuCount为0，调用方不改亲和性。
+ */
+CpuTopology readCpuTopology(const std::string &root = "/sys/devices/system/cpu");
+
+/**
+ * 本进程的CPU拓扑，第一次调用时读取
+ */
+const CpuTopology &cpuTopology();
+
+/**
+ * 把调用线程设置为音频线程：SCHED_FIFO或者更低的nice值、大核亲和性、APerformanceHint会话。
+ * 每一项都是尽力而为，没有权限或者系统不支持时跳过（主机上通常只有亲和性生效）。
+ * 析构时恢复原来的调度策略、nice值和亲和性，所以也可以用在线程池的线程上，只要在这期间
+ * 不把线程交给别的任务；析构可以在别的线程上进行。
+ */
+class AudioThreadScope {
+public:
+    explicit AudioThreadScope(const AudioThreadConfig &config,
+                              const CpuTopology &topology = cpuTopology());
+    ~AudioThreadScope();
+
+    AudioThreadScope(const AudioThreadScope &) = delete;
+    AudioThreadScope &operator=(const AudioThreadScope &) = delete;
+
+    /**
+     * 报告一帧实际的工作时长（不包括等待数据的时间），有APerformanceHint会话时交给系统
+     * 调整频率，同时统计超过目标时长的次数
+     */
+    void reportWork(int64_t nanos);
+
+    AudioThreadPriority priority() const { return priority_; }
+    bool pinned() const { return pinned_; }
+    bool hinted() const { return hintSession_ != nullptr; }
+    size_t overruns() const { return overruns_; }
+    size_t reports() const { return reports_; }
+
+private:
+    int tid_;
+    int64_t targetWorkNanos_;
+    AudioThreadPriority priority_ = AUDIO_PRIORITY_UNCHANGED;
+    int oldPolicy_ = 0;
+    int oldFifoPriority_ = 0;
+    int oldNice_ = 0;
+    bool pinned_ = false;
+    std::vector<uint8_t> oldMask_; // cpu_set_t
+    void *hintSession_ = nullptr; // APerformanceHintSession
+    size_t overruns_ = 0;
+    size_t reports_ = 0;
+};
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_AUDIO_THREAD_H
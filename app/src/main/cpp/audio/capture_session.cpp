@@ -0,0 +1,218 @@
+#include "capture_session.h"
+#include "trace_ring.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace audio {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+} // namespace
+
+#ifdef __linux__
+
+CaptureSignal::CaptureSignal() : fd_(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) {
+}
+
+CaptureSignal::~CaptureSignal() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool CaptureSignal::valid() const {
+    return fd_ >= 0;
+}
+
+void CaptureSignal::notify() {
+    uint64_t one = 1;
+    // 计数器溢出之前对方早就醒了，写失败（EAGAIN）可以忽略
+    ssize_t ignored = ::write(fd_, &one, sizeof(one));
+    (void) ignored;
+}
+
+bool CaptureSignal::wait(int timeoutMs) {
+    struct pollfd fd = {fd_, POLLIN, 0};
+    int result;
+    do {
+        result = poll(&fd, 1, std::max(timeoutMs, 0));
+    } while (result < 0 && errno == EINTR);
+    if (result <= 0) {
+        return false;
+    }
+    uint64_t count;
+    return ::read(fd_, &count, sizeof(count)) == sizeof(count);
+}
+
+#else
+
+CaptureSignal::CaptureSignal() = default;
+
+CaptureSignal::~CaptureSignal() = default;
+
+bool CaptureSignal::valid() const {
+    return true;
+}
+
+void CaptureSignal::notify() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++count_;
+    cv_.notify_one();
+}
+
+bool CaptureSignal::wait(int timeoutMs) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!cv_.wait_for(lock, std::chrono::milliseconds(std::max(timeoutMs, 0)),
+                      [&] { return count_ > 0; })) {
+        return false;
+    }
+    count_ = 0;
+    return true;
+}
+
+#endif
+
+CaptureSession::CaptureSession(int32_t sampleRate, int ringMs, CaptureConsumer owner)
+        : owner_(owner) {
+    ring_.resize(std::max<size_t>(1, (size_t) sampleRate * (size_t) std::max(ringMs, 0) / 1000));
+}
+
+bool CaptureSession::valid() const {
+    for (const CaptureSignal &signal : signals_) {
+        if (!signal.valid()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CaptureSession::write(const int16_t *pcm, size_t samples) {
+    CaptureConsumer notify;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (finished_ || cancelled_) {
+            return;
+        }
+        uint64_t capacity = ring_.size();
+        stats_.samplesIn += samples;
+        // 比整个环还长的块只有最后capacity个样本留得下来
+        size_t skip = samples > capacity ? samples - (size_t) capacity : 0;
+        size_t count = samples - skip;
+        size_t writeIndex = (size_t) ((writePos_ + skip) % capacity);
+        size_t first = std::min(count, (size_t) capacity - writeIndex);
+        memcpy(&ring_[writeIndex], pcm + skip, first * sizeof(int16_t));
+        memcpy(&ring_[0], pcm + skip + first, (count - first) * sizeof(int16_t));
+        writePos_ += samples;
+        if (writePos_ - readPos_ > capacity) {
+            uint64_t dropped = writePos_ - readPos_ - capacity;
+            stats_.dropped += dropped;
+            readPos_ = writePos_ - capacity;
+            trace(TRACE_CAPTURE_OVERRUN, (int32_t) dropped, owner_);
+        }
+        if (!waiting_[owner_]) {
+            return;
+        }
+        notify = owner_;
+    }
+    signals_[notify].notify();
+}
+
+int64_t CaptureSession::handoff(CaptureConsumer to) {
+    int64_t position;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        position = (int64_t) readPos_;
+        if (owner_ != to) {
+            owner_ = to;
+            ++stats_.handoffs;
+            trace(TRACE_CAPTURE_HANDOFF, to, (int32_t) position);
+        }
+    }
+    signals_[to].notify();
+    return position;
+}
+
+CaptureConsumer CaptureSession::owner() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return owner_;
+}
+
+void CaptureSession::finish() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+    }
+    for (CaptureSignal &signal : signals_) {
+        signal.notify();
+    }
+}
+
+void CaptureSession::cancel() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+    }
+    for (CaptureSignal &signal : signals_) {
+        signal.notify();
+    }
+}
+
+int CaptureSession::read(CaptureConsumer consumer, int16_t *out, size_t maxSamples,
+                         int timeoutMs, int64_t *position) {
+    Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 0));
+    bool signalled = false;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            waiting_[consumer] = false;
+            if (cancelled_ || (finished_ && readPos_ == writePos_)) {
+                return -1;
+            }
+            if (owner_ == consumer && readPos_ < writePos_ && maxSamples > 0) {
+                size_t capacity = ring_.size();
+                size_t count = (size_t) std::min<uint64_t>(maxSamples, writePos_ - readPos_);
+                size_t readIndex = (size_t) (readPos_ % capacity);
+                size_t first = std::min(count, capacity - readIndex);
+                memcpy(out, &ring_[readIndex], first * sizeof(int16_t));
+                memcpy(out + first, &ring_[0], (count - first) * sizeof(int16_t));
+                if (position != nullptr) {
+                    *position = (int64_t) readPos_;
+                }
+                readPos_ += count;
+                stats_.samplesOut[consumer] += count;
+                if (signalled) {
+                    ++stats_.wakeups;
+                }
+                return (int) count;
+            }
+            // 先登记再等待：登记之后的write和handoff一定会发信号，不会错过
+            waiting_[consumer] = true;
+        }
+        int remainingMs = (int) std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - Clock::now()).count();
+        if (remainingMs <= 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            waiting_[consumer] = false;
+            return 0;
+        }
+        signalled = signals_[consumer].wait(remainingMs) || signalled;
+    }
+}
+
+CaptureSessionStats CaptureSession::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace audio
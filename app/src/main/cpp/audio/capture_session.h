@@ -0,0 +1,144 @@
+#ifndef DICIO_AUDIO_CAPTURE_SESSION_H
+#define DICIO_AUDIO_CAPTURE_SESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#ifndef __linux__
+#include <condition_variable>
+#endif
+
+namespace audio {
+
+enum CaptureConsumer {
+    // 唤醒词检测（WakeService的检测循环）
+    CAPTURE_WAKE = 0,
+    // 唤醒之后的语音识别（WebSocketInputDevice的上行音频）
+    CAPTURE_ASR = 1,
+    CAPTURE_CONSUMERS = 2,
+};
+
+struct CaptureSessionStats {
+    uint64_t samplesIn = 0; // write写入的样本总数
+    uint64_t samplesOut[CAPTURE_CONSUMERS] = {}; // 每个消费者读走的样本数
+    uint64_t dropped = 0; // 还没有被读走就被新样本覆盖的样本数
+    size_t handoffs = 0;
+    size_t wakeups = 0; // read因为等待而阻塞、又被信号唤醒的次数
+};
+
+/**
+ * 一个消费者的唤醒信号。Linux（包括Android）上是eventfd，等待时阻塞在poll上，不占用锁；
+ * 其他平台用条件变量模拟，只用于主机端的测试。信号是计数的，先notify后wait不会丢失。
+ */
+class CaptureSignal {
+public:
+    CaptureSignal();
+    ~CaptureSignal();
+
+    CaptureSignal(const CaptureSignal &) = delete;
+    CaptureSignal &operator=(const CaptureSignal &) = delete;
+
+    bool valid() const;
+    void notify();
+
+    /**
+     * 最多等待timeoutMs毫秒
+     * @return 收到了信号（同时清零计数）返回true，超时返回false
+     */
+    bool wait(int timeoutMs);
+
+private:
+#ifdef __linux__
+    int fd_ = -1;
+#else
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t count_ = 0;
+#endif
+};
+
+/**
+ * 一路持续录音，按样本精确地在唤醒词检测和语音识别之间切换。
+ *
+ * 录音线程持有唯一的AudioRecord，从头到尾不停，把每次读到的PCM交给write；write从不阻塞，
+ * 环满时覆盖最旧的样本。环中的每个样本都属于某一个消费者：所有消费者共用一个读位置，
+ * 只有当前的所有者能从读位置往后读，handoff把所有权交给另一个消费者，读位置不变。
+ * 检测线程在送入检测器的那一帧之后调用handoff(CAPTURE_ASR)，语音识别就从紧接着的样本
+ * 开始，连接服务器期间说的话留在环里；识别结束后handoff(CAPTURE_WAKE)把剩下的样本交回
+ * 检测线程。每个样本恰好被读一次，切换时既不丢也不重复。
+ *
+ * 不是所有者的read阻塞在自己的CaptureSignal上，直到handoff或者有新样本，不需要轮询。
+ * write只能在一个线程上调用；read的同一个消费者只能在一个线程上调用；其他方法可以在
+ * 任何线程上调用。
+ */
+class CaptureSession {
+public:
+    /**
+     * @param sampleRate 采样率（单声道）
+     * @param ringMs 环的长度，要能放下语音识别建立连接期间的录音
+     * @param owner 一开始的所有者
+     */
+    CaptureSession(int32_t sampleRate, int ringMs, CaptureConsumer owner = CAPTURE_WAKE);
+
+    CaptureSession(const CaptureSession &) = delete;
+    CaptureSession &operator=(const CaptureSession &) = delete;
+
+    /**
+     * @return 唤醒信号都创建成功时返回true
+     */
+    bool valid() const;
+
+    /**
+     * 写入录音线程读到的samples个样本，环满时覆盖最旧的（计入stats的dropped）
+     */
+    void write(const int16_t *pcm, size_t samples);
+
+    /**
+     * 把读位置之后的样本（包括以后写入的）交给to，唤醒阻塞中的to
+     * @return 切换点，即to读到的第一个样本的位置（从开始录音算起的样本数）
+     */
+    int64_t handoff(CaptureConsumer to);
+
+    CaptureConsumer owner() const;
+
+    /**
+     * 录音结束：所有者读完环中的样本后，所有read返回-1
+     */
+    void finish();
+
+    /**
+     * 停止：唤醒所有阻塞中的read，之后read直接返回-1
+     */
+    void cancel();
+
+    /**
+     * 以consumer的身份读出最多maxSamples个样本。consumer不是所有者或者环为空时，最多等待
+     * timeoutMs毫秒。
+     * @param position 不为空时写入第一个样本的位置
+     * @return 读出的样本数，超时返回0，finish之后样本都已读完（或cancel）返回-1
+     */
+    int read(CaptureConsumer consumer, int16_t *out, size_t maxSamples, int timeoutMs,
+             int64_t *position = nullptr);
+
+    CaptureSessionStats stats() const;
+
+private:
+    CaptureSignal signals_[CAPTURE_CONSUMERS];
+
+    // 以下由mutex_保护
+    mutable std::mutex mutex_;
+    std::vector<int16_t> ring_;
+    uint64_t writePos_ = 0; // 写入的样本总数，环中的位置是writePos_ % ring_.size()
+    uint64_t readPos_ = 0; // 所有消费者共用的读位置
+    CaptureConsumer owner_;
+    bool waiting_[CAPTURE_CONSUMERS] = {}; // 消费者正阻塞在自己的信号上
+    bool finished_ = false;
+    bool cancelled_ = false;
+    CaptureSessionStats stats_;
+};
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_CAPTURE_SESSION_H
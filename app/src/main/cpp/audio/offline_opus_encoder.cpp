@@ -0,0 +1,361 @@
+#include "offline_opus_encoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <opus.h>
+#include <opus_silk.h>
+
+#include "matcher/work_stealing_pool.h"
+#include "ogg_opus_writer.h"
+
+namespace audio {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 低于这个活动度（Q8）的帧算作静音，与SILK的DTX阈值（0.05）相同
+constexpr int SILENCE_ACTIVITY_Q8 = 13;
+constexpr int MAX_PACKET_SIZE = 4000;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool validOptions(const OfflineEncodeOptions &options) {
+    int32_t fs = options.sampleRate;
+    return (fs == 8000 || fs == 12000 || fs == 16000 || fs == 24000 || fs == 48000)
+           && (options.channels == 1 || options.channels == 2)
+           && (options.frameMs == 10 || options.frameMs == 20 || options.frameMs == 40
+               || options.frameMs == 60)
+           && options.minSegmentMs > 0 && options.minSilenceMs > 0 && options.preRollMs >= 0;
+}
+
+OpusEncoder *createEncoder(const OfflineEncodeOptions &options, int *error) {
+    OpusEncoder *encoder = opus_encoder_create(options.sampleRate, options.channels,
+                                               OPUS_APPLICATION_VOIP, error);
+    if (encoder != nullptr) {
+        opus_encoder_ctl(encoder, OPUS_SET_BITRATE(options.bitrate));
+        opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(options.complexity));
+        opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+        opus_encoder_ctl(encoder, OPUS_SET_LSB_DEPTH(16));
+    }
+    return encoder;
+}
+
+/**
+ * 编码器的延迟，单位为输入采样。输入末尾要补这么多零才能把最后的采样编码出来
+ */
+int encoderLookahead(const OfflineEncodeOptions &options, int *lookahead) {
+    int error;
+    OpusEncoder *encoder = createEncoder(options, &error);
+    if (encoder == nullptr) {
+        return error;
+    }
+    opus_int32 value = 0;
+    error = opus_encoder_ctl(encoder, OPUS_GET_LOOKAHEAD(&value));
+    opus_encoder_destroy(encoder);
+    *lookahead = value;
+    return error;
+}
+
+/**
+ * 从第frame个Opus帧开始复制一帧，超出输入的部分补零
+ */
+void copyFrame(const int16_t *pcm, size_t frames, size_t frame, size_t frameSize, int channels,
+               int16_t *out) {
+    size_t begin = frame * frameSize;
+    size_t available = begin < frames ? std::min(frameSize, frames - begin) : 0;
+    std::copy(pcm + begin * channels, pcm + (begin + available) * channels, out);
+    std::fill(out + available * channels, out + frameSize * channels, (int16_t) 0);
+}
+
+/**
+ * 逐个Opus帧运行SILK的VAD，立体声先混成单声道。
+ * 一个Opus帧的活动度取其中各个VAD帧（10或20ms）的最大值
+ */
+class FrameVad {
+public:
+    FrameVad(const int16_t *pcm, size_t frames, const OfflineEncodeOptions &options)
+            : pcm_(pcm), frames_(frames), channels_(options.channels),
+              frameSize_((size_t) (options.sampleRate / 1000 * options.frameMs)),
+              vadFrameSize_((size_t) (options.sampleRate / 1000
+                                      * (options.frameMs == 10 ? 10 : 20))),
+              input_(frameSize_ * channels_), mono_(frameSize_) {
+        vad_ = opus_silk_vad_create(options.sampleRate, &error_);
+    }
+
+    ~FrameVad() {
+        opus_silk_vad_destroy(vad_);
+    }
+
+    FrameVad(const FrameVad &) = delete;
+    FrameVad &operator=(const FrameVad &) = delete;
+
+    int error() const { return error_; }
+
+    /**
+     * 处理第frame()帧，返回活动度（Q8）或错误码
+     */
+    int next() {
+        copyFrame(pcm_, frames_, frame_++, frameSize_, channels_, input_.data());
+        for (size_t i = 0; i < frameSize_; ++i) {
+            mono_[i] = channels_ == 1
+                    ? input_[i] : (int16_t) ((input_[2 * i] + input_[2 * i + 1]) >> 1);
+        }
+        int maxActivity = 0;
+        for (size_t offset = 0; offset < frameSize_; offset += vadFrameSize_) {
+            int sa = opus_silk_vad_process(vad_, &mono_[offset], (int) vadFrameSize_);
+            if (sa < 0) {
+                return sa;
+            }
+            maxActivity = std::max(maxActivity, sa);
+        }
+        return maxActivity;
+    }
+
+    size_t frame() const { return frame_; }
+
+    /**
+     * 复制当前的状态，OpusSilkVad可以直接按字节复制
+     */
+    std::vector<uint8_t> saveState() const {
+        const uint8_t *state = reinterpret_cast<const uint8_t *>(vad_);
+        return std::vector<uint8_t>(state, state + opus_silk_vad_get_size());
+    }
+
+private:
+    const int16_t *pcm_;
+    const size_t frames_;
+    const int channels_;
+    const size_t frameSize_;
+    const size_t vadFrameSize_;
+    std::vector<int16_t> input_;
+    std::vector<int16_t> mono_;
+    OpusSilkVad *vad_;
+    int error_ = OPUS_OK;
+    size_t frame_ = 0;
+};
+
+struct SegmentPackets {
+    std::vector<uint8_t> data;
+    std::vector<uint16_t> sizes;
+    size_t preRollFrames = 0;
+    int error = OPUS_OK;
+};
+
+size_t preRollFrames(const OfflineEncodeOptions &options, const OfflineSegment &segment) {
+    return std::min(segment.firstFrame, (size_t) (options.preRollMs / options.frameMs));
+}
+
+/**
+ * @param vadState 预热起点处VAD的状态，第一段没有
+ */
+void encodeSegment(const int16_t *pcm, size_t frames, const OfflineEncodeOptions &options,
+                   const OfflineSegment &segment, const std::vector<uint8_t> &vadState,
+                   SegmentPackets &result) {
+    int error;
+    OpusEncoder *encoder = createEncoder(options, &error);
+    if (encoder == nullptr) {
+        result.error = error;
+        return;
+    }
+    if (!vadState.empty()) {
+        opus_encoder_ctl(encoder, OPUS_SET_VAD_STATE(
+                reinterpret_cast<const OpusSilkVad *>(vadState.data())));
+    }
+    size_t frameSize = (size_t) (options.sampleRate / 1000 * options.frameMs);
+    size_t preRoll = preRollFrames(options, segment);
+    std::vector<int16_t> input(frameSize * options.channels);
+    uint8_t packet[MAX_PACKET_SIZE];
+    result.sizes.reserve(segment.frameCount);
+
+    for (size_t frame = segment.firstFrame - preRoll;
+         frame < segment.firstFrame + segment.frameCount; ++frame) {
+        copyFrame(pcm, frames, frame, frameSize, options.channels, input.data());
+        int size = opus_encode(encoder, input.data(), (int) frameSize, packet, MAX_PACKET_SIZE);
+        if (size < 0) {
+            result.error = size;
+            break;
+        }
+        if (frame >= segment.firstFrame) {
+            result.data.insert(result.data.end(), packet, packet + size);
+            result.sizes.push_back((uint16_t) size);
+        }
+    }
+    result.preRollFrames = preRoll;
+    opus_encoder_destroy(encoder);
+}
+
+} // namespace
+
+int findOfflineSegments(const int16_t *pcm, size_t frames, const OfflineEncodeOptions &options,
+                        std::vector<OfflineSegment> &segments) {
+    segments.clear();
+    if (!validOptions(options)) {
+        return OPUS_BAD_ARG;
+    }
+    int lookahead;
+    int error = encoderLookahead(options, &lookahead);
+    if (error != OPUS_OK) {
+        return error;
+    }
+    size_t frameSize = (size_t) (options.sampleRate / 1000 * options.frameMs);
+    size_t totalFrames = (frames + lookahead + frameSize - 1) / frameSize;
+
+    FrameVad vad(pcm, frames, options);
+    if (vad.error() != OPUS_OK) {
+        return vad.error();
+    }
+    std::vector<uint8_t> activity(totalFrames);
+    for (size_t frame = 0; frame < totalFrames; ++frame) {
+        int sa = vad.next();
+        if (sa < 0) {
+            return sa;
+        }
+        activity[frame] = (uint8_t) sa;
+    }
+
+    // 足够长的静音的中点，这样预热的帧也落在静音中
+    std::vector<size_t> candidates;
+    size_t minSilence = std::max(1, options.minSilenceMs / options.frameMs);
+    for (size_t frame = 0; frame < totalFrames;) {
+        if (activity[frame] >= SILENCE_ACTIVITY_Q8) {
+            ++frame;
+            continue;
+        }
+        size_t end = frame;
+        while (end < totalFrames && activity[end] < SILENCE_ACTIVITY_Q8) {
+            ++end;
+        }
+        if (end - frame >= minSilence) {
+            candidates.push_back((frame + end) / 2);
+        }
+        frame = end;
+    }
+
+    size_t minSegment = std::max(1, options.minSegmentMs / options.frameMs);
+    size_t maxSegment = std::max(minSegment, (size_t) (options.maxSegmentMs / options.frameMs));
+    size_t start = 0;
+    size_t next = 0;
+    while (totalFrames - start >= 2 * minSegment || totalFrames - start > maxSegment) {
+        while (next < candidates.size() && candidates[next] < start + minSegment) {
+            ++next;
+        }
+        size_t cut;
+        bool forced = false;
+        if (next < candidates.size() && candidates[next] <= start + maxSegment
+            && totalFrames - candidates[next] >= minSegment) {
+            cut = candidates[next];
+        } else if (totalFrames - start > maxSegment) {
+            cut = start + minSegment;
+            for (size_t frame = cut + 1; frame <= start + maxSegment; ++frame) {
+                if (activity[frame] < activity[cut]) {
+                    cut = frame;
+                }
+            }
+            forced = true;
+        } else {
+            break;
+        }
+        segments.push_back({start, cut - start, forced});
+        start = cut;
+    }
+    segments.push_back({start, totalFrames - start, false});
+    return OPUS_OK;
+}
+
+int encodeOggOpus(const int16_t *pcm, size_t frames, const OfflineEncodeOptions &options,
+                  std::vector<uint8_t> &out, OfflineEncodeStats *stats) {
+    OfflineEncodeStats localStats;
+    Clock::time_point start = Clock::now();
+
+    std::vector<OfflineSegment> segments;
+    int error = findOfflineSegments(pcm, frames, options, segments);
+    if (error != OPUS_OK) {
+        return error;
+    }
+    int lookahead;
+    error = encoderLookahead(options, &lookahead);
+    if (error != OPUS_OK) {
+        return error;
+    }
+    localStats.segments = segments.size();
+    for (const OfflineSegment &segment : segments) {
+        localStats.forcedSplits += segment.forced ? 1 : 0;
+    }
+
+    // 编码器自己的VAD要用大约20秒学习背景噪声，它的状态又影响比特分配，所以从中途开始的
+    // 编码器只靠预热是不够的：再顺序运行一遍VAD，把每段预热起点处的状态交给这一段的编码器
+    std::vector<std::vector<uint8_t>> vadStates(segments.size());
+    {
+        FrameVad vad(pcm, frames, options);
+        if (vad.error() != OPUS_OK) {
+            return vad.error();
+        }
+        for (size_t s = 1; s < segments.size(); ++s) {
+            size_t target = segments[s].firstFrame - preRollFrames(options, segments[s]);
+            while (vad.frame() < target) {
+                int sa = vad.next();
+                if (sa < 0) {
+                    return sa;
+                }
+            }
+            vadStates[s] = vad.saveState();
+        }
+    }
+    localStats.vadSeconds = secondsSince(start);
+
+    start = Clock::now();
+    size_t threads = options.threads != 0
+            ? options.threads : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::min(threads, segments.size());
+    std::vector<SegmentPackets> packets(segments.size());
+    {
+        matcher::WorkStealingPool pool(threads - 1);
+        pool.parallelFor(segments.size(), [&](size_t index, size_t) {
+            encodeSegment(pcm, frames, options, segments[index], vadStates[index],
+                          packets[index]);
+        });
+    }
+    for (const SegmentPackets &segment : packets) {
+        if (segment.error != OPUS_OK) {
+            return segment.error;
+        }
+        localStats.packets += segment.sizes.size();
+        localStats.preRollFrames += segment.preRollFrames;
+    }
+    localStats.encodeSeconds = secondsSince(start);
+
+    start = Clock::now();
+    int64_t scale = 48000 / options.sampleRate;
+    int64_t preSkip = lookahead * scale;
+    int64_t frameDuration = (int64_t) options.sampleRate / 1000 * options.frameMs * scale;
+    int64_t endGranule = preSkip + (int64_t) frames * scale;
+    OggOpusWriter writer(out, options.serial);
+    writer.writeHeaders(options.channels, (uint16_t) preSkip, (uint32_t) options.sampleRate,
+                        opus_get_version_string());
+    // granule位置计算所有解码出的采样，包括要丢弃的pre-skip
+    int64_t granule = 0;
+    for (size_t s = 0; s < packets.size(); ++s) {
+        const SegmentPackets &segment = packets[s];
+        size_t offset = 0;
+        for (size_t i = 0; i < segment.sizes.size(); ++i) {
+            bool last = s + 1 == packets.size() && i + 1 == segment.sizes.size();
+            granule += frameDuration;
+            writer.writePacket(&segment.data[offset], segment.sizes[i],
+                               last ? std::min(granule, endGranule) : granule, last);
+            offset += segment.sizes[i];
+        }
+    }
+    localStats.muxSeconds = secondsSince(start);
+
+    if (stats != nullptr) {
+        *stats = localStats;
+    }
+    return OPUS_OK;
+}
+
+} // namespace audio
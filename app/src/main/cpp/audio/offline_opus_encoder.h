@@ -0,0 +1,74 @@
+#ifndef DICIO_AUDIO_OFFLINE_OPUS_ENCODER_H
+#define DICIO_AUDIO_OFFLINE_OPUS_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audio {
+
+struct OfflineEncodeOptions {
+    int32_t sampleRate = 16000;
+    int channels = 1;
+    int32_t bitrate = 24000;
+    int complexity = 8;
+    int frameMs = 20; // 10、20、40或60
+    // 段越短并行度越高，但每段都要多编码一次预热音频
+    int minSegmentMs = 3000;
+    // 一直没有静音时在活动度最低的帧强制切开，避免一个长段拖住整个并行阶段
+    int maxSegmentMs = 20000;
+    // 至少这么长的连续静音才能作为切分点，在静音的中点切开
+    int minSilenceMs = 200;
+    // 每段先编码并丢弃起点之前这么长的音频，让编码器的预测状态、增益和VAD接近顺序编码时的状态
+    int preRollMs = 200;
+    // 0表示每个核心一个线程
+    size_t threads = 0;
+    uint32_t serial = 0x44696369; // "Dici"
+};
+
+struct OfflineSegment {
+    size_t firstFrame; // 以Opus帧为单位
+    size_t frameCount;
+    bool forced; // 没有找到足够长的静音，在活动度最低处切开
+};
+
+struct OfflineEncodeStats {
+    size_t segments = 0;
+    size_t forcedSplits = 0;
+    size_t packets = 0;
+    size_t preRollFrames = 0; // 为预热额外编码的帧数
+    double vadSeconds = 0;
+    double encodeSeconds = 0;
+    double muxSeconds = 0;
+};
+
+/**
+ * 用SILK的VAD找出静音，把 [0, frameCount) 帧切成互不重叠的段。
+ * 立体声先混成单声道再检测。
+ * @param frames 输入的采样帧数（每帧channels个采样）
+ * @return OPUS_OK或opus错误码
+ */
+int findOfflineSegments(const int16_t *pcm, size_t frames, const OfflineEncodeOptions &options,
+                        std::vector<OfflineSegment> &segments);
+
+/**
+ * 把一整段录音编码成Ogg Opus文件。
+ *
+ * 输入在静音处切成多段，每段在线程池中用独立的OpusEncoder编码，最后按顺序拼接成
+ * 一个Ogg流。数据包的时间轴与用一个编码器顺序编码完全相同（每段的编码器从预热的
+ * 起点开始，延迟补偿也一样），所以granule位置和pre-skip照常计算，解码器看到的就是
+ * 一个普通的流。段的划分只取决于输入，与线程数无关，输出的字节也与线程数无关。
+ *
+ * 每段的编码器接过顺序运行的VAD在预热起点处的状态（OPUS_SET_VAD_STATE），所以比特分配
+ * 与顺序编码一致。段的边界处解码器的状态来自上一段的最后一帧，与新编码器预热得到的状态
+ * 不完全一致，效果类似丢包后的恢复；边界都在静音中，又有预热，实际上听不出来。
+ *
+ * @param out Ogg Opus文件内容会追加到这里
+ * @return OPUS_OK或opus错误码
+ */
+int encodeOggOpus(const int16_t *pcm, size_t frames, const OfflineEncodeOptions &options,
+                  std::vector<uint8_t> &out, OfflineEncodeStats *stats = nullptr);
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_OFFLINE_OPUS_ENCODER_H
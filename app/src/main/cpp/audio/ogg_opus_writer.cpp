@@ -0,0 +1,126 @@
+#include "ogg_opus_writer.h"
+
+#include <cstring>
+
+namespace audio {
+
+namespace {
+
+constexpr size_t MAX_LACING_VALUES = 255;
+
+constexpr uint8_t FLAG_BEGIN_OF_STREAM = 0x02;
+constexpr uint8_t FLAG_END_OF_STREAM = 0x04;
+
+struct CrcTable {
+    uint32_t values[256];
+
+    CrcTable() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t r = i << 24;
+            for (int j = 0; j < 8; ++j) {
+                r = (r & 0x80000000u) ? (r << 1) ^ 0x04c11db7u : r << 1;
+            }
+            values[i] = r;
+        }
+    }
+};
+
+void putLe16(std::vector<uint8_t> &out, uint32_t value) {
+    out.push_back((uint8_t) value);
+    out.push_back((uint8_t) (value >> 8));
+}
+
+void putLe32(std::vector<uint8_t> &out, uint32_t value) {
+    putLe16(out, value & 0xffff);
+    putLe16(out, value >> 16);
+}
+
+void putLe64(std::vector<uint8_t> &out, uint64_t value) {
+    putLe32(out, (uint32_t) value);
+    putLe32(out, (uint32_t) (value >> 32));
+}
+
+} // namespace
+
+uint32_t oggCrc32(const uint8_t *data, size_t size, uint32_t crc) {
+    static const CrcTable table;
+    for (size_t i = 0; i < size; ++i) {
+        crc = (crc << 8) ^ table.values[((crc >> 24) ^ data[i]) & 0xff];
+    }
+    return crc;
+}
+
+OggOpusWriter::OggOpusWriter(std::vector<uint8_t> &out, uint32_t serial)
+        : out_(out), serial_(serial) {
+}
+
+void OggOpusWriter::writeHeaders(int channels, uint16_t preSkip, uint32_t inputSampleRate,
+                                 const char *vendor) {
+    std::vector<uint8_t> head;
+    head.insert(head.end(), {'O', 'p', 'u', 's', 'H', 'e', 'a', 'd'});
+    head.push_back(1); // 版本
+    head.push_back((uint8_t) channels);
+    putLe16(head, preSkip);
+    putLe32(head, inputSampleRate);
+    putLe16(head, 0); // 输出增益
+    head.push_back(0); // 映射族0
+    writePacket(head.data(), head.size(), 0, false);
+    flushPage(0, false);
+
+    std::vector<uint8_t> tags;
+    tags.insert(tags.end(), {'O', 'p', 'u', 's', 'T', 'a', 'g', 's'});
+    size_t vendorLength = strlen(vendor);
+    putLe32(tags, (uint32_t) vendorLength);
+    tags.insert(tags.end(), vendor, vendor + vendorLength);
+    putLe32(tags, 0); // 没有用户注释
+    writePacket(tags.data(), tags.size(), 0, false);
+    flushPage(0, false);
+}
+
+void OggOpusWriter::writePacket(const uint8_t *data, size_t size, int64_t granulePos,
+                                bool endOfStream) {
+    // Opus数据包最多1275字节，一定能放进一页，所以包从不跨页
+    size_t lacingValues = size / 255 + 1;
+    if (lacing_.size() + lacingValues > MAX_LACING_VALUES) {
+        flushPage(lastGranule_, false);
+    }
+    for (size_t i = 0; i + 1 < lacingValues; ++i) {
+        lacing_.push_back(255);
+    }
+    lacing_.push_back((uint8_t) (size % 255));
+    body_.insert(body_.end(), data, data + size);
+    lastGranule_ = granulePos;
+
+    if (endOfStream || granulePos - pageStartGranule_ >= MAX_PAGE_DURATION) {
+        flushPage(granulePos, endOfStream);
+    }
+}
+
+void OggOpusWriter::flushPage(int64_t granulePos, bool endOfStream) {
+    if (lacing_.empty()) {
+        return;
+    }
+    size_t start = out_.size();
+    out_.insert(out_.end(), {'O', 'g', 'g', 'S', 0});
+    out_.push_back((uint8_t) ((firstPage_ ? FLAG_BEGIN_OF_STREAM : 0)
+                              | (endOfStream ? FLAG_END_OF_STREAM : 0)));
+    putLe64(out_, (uint64_t) granulePos);
+    putLe32(out_, serial_);
+    putLe32(out_, pageSequence_++);
+    putLe32(out_, 0); // CRC，最后填入
+    out_.push_back((uint8_t) lacing_.size());
+    out_.insert(out_.end(), lacing_.begin(), lacing_.end());
+    out_.insert(out_.end(), body_.begin(), body_.end());
+
+    uint32_t crc = oggCrc32(&out_[start], out_.size() - start);
+    for (int i = 0; i < 4; ++i) {
+        out_[start + 22 + i] = (uint8_t) (crc >> (8 * i));
+    }
+
+    firstPage_ = false;
+    lacing_.clear();
+    body_.clear();
+    pageStartGranule_ = granulePos;
+}
+
+} // namespace audio
@@ -0,0 +1,61 @@
+#ifndef DICIO_AUDIO_OGG_OPUS_WRITER_H
+#define DICIO_AUDIO_OGG_OPUS_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audio {
+
+/**
+ * 把Opus数据包封装成Ogg Opus流（RFC 7845），追加到一个内存缓冲区中。
+ * 只支持单个逻辑流、映射族0（单声道或立体声）。
+ *
+ * 先调用writeHeaders写入OpusHead和OpusTags页，然后按顺序写入数据包，最后一个包的
+ * endOfStream为true。granulePos是这个包解码结束时的48kHz采样位置（包含preSkip），
+ * 最后一个包的granulePos可以小于累计值，用来裁掉末尾的填充。
+ */
+class OggOpusWriter {
+public:
+    OggOpusWriter(std::vector<uint8_t> &out, uint32_t serial);
+
+    OggOpusWriter(const OggOpusWriter &) = delete;
+    OggOpusWriter &operator=(const OggOpusWriter &) = delete;
+
+    /**
+     * @param preSkip 解码器需要丢弃的开头采样数，48kHz
+     * @param inputSampleRate 原始采样率，只用于提示播放器
+     */
+    void writeHeaders(int channels, uint16_t preSkip, uint32_t inputSampleRate,
+                      const char *vendor);
+
+    void writePacket(const uint8_t *data, size_t size, int64_t granulePos, bool endOfStream);
+
+    /**
+     * 当前页累计超过这么多48kHz采样就结束这一页，与libopusenc默认的最大页延迟一致
+     */
+    static constexpr int64_t MAX_PAGE_DURATION = 48000;
+
+private:
+    void flushPage(int64_t granulePos, bool endOfStream);
+
+    std::vector<uint8_t> &out_;
+    const uint32_t serial_;
+    uint32_t pageSequence_ = 0;
+    bool firstPage_ = true;
+
+    // 当前页的分段表和数据
+    std::vector<uint8_t> lacing_;
+    std::vector<uint8_t> body_;
+    int64_t pageStartGranule_ = 0;
+    int64_t lastGranule_ = 0;
+};
+
+/**
+ * Ogg使用的CRC32（多项式0x04c11db7，不反转，初值0）
+ */
+uint32_t oggCrc32(const uint8_t *data, size_t size, uint32_t crc = 0);
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_OGG_OPUS_WRITER_H
@@ -0,0 +1,70 @@
+#include "opus_frame_assembler.h"
+
+#include <algorithm>
+
+#include <opus.h>
+
+namespace audio {
+
+OpusFrameAssembler::OpusFrameAssembler(OpusEncoder *encoder, int channels, int frameSize)
+        : encoder_(encoder), frameSize_(frameSize),
+          frameSamples_((size_t) frameSize * (size_t) channels) {
+    // 最坏情况：输出空间一直不够时缓存一帧多一点，再加上一次AudioRecord读取
+    pending_.reserve(frameSamples_ * 4);
+}
+
+int OpusFrameAssembler::push(const int16_t *pcm, size_t samples, uint8_t *out,
+                             size_t outCapacity, int32_t *packetSizes, size_t maxPackets,
+                             size_t maxPacketBytes) {
+    size_t used = 0;
+    size_t packets = 0;
+    int error = OPUS_OK;
+    // 输出缓冲区比一个包的上限还小时，按缓冲区大小编码（CBR的包通常小得多）
+    maxPacketBytes = std::min(maxPacketBytes, outCapacity);
+    auto hasRoom = [&] {
+        return error == OPUS_OK && packets < maxPackets && maxPacketBytes > 0
+               && outCapacity - used >= maxPacketBytes;
+    };
+    auto encode = [&](const int16_t *frame) {
+        int bytes = opus_encode(encoder_, frame, frameSize_, out + used,
+                                (opus_int32) maxPacketBytes);
+        if (bytes < 0) {
+            error = bytes;
+            return;
+        }
+        packetSizes[packets++] = bytes;
+        used += (size_t) bytes;
+    };
+
+    // 先用输入把上次余下的样本补成整帧
+    if (!pending_.empty() && pending_.size() < frameSamples_) {
+        size_t take = std::min(samples, frameSamples_ - pending_.size());
+        pending_.insert(pending_.end(), pcm, pcm + take);
+        pcm += take;
+        samples -= take;
+    }
+    size_t offset = 0;
+    while (pending_.size() - offset >= frameSamples_ && hasRoom()) {
+        encode(&pending_[offset]);
+        offset += frameSamples_;
+    }
+    pending_.erase(pending_.begin(), pending_.begin() + offset);
+
+    // 内部没有缓存时，输入中的整帧直接编码，不复制
+    if (pending_.empty()) {
+        while (samples >= frameSamples_ && hasRoom()) {
+            encode(pcm);
+            pcm += frameSamples_;
+            samples -= frameSamples_;
+        }
+    }
+    // 余下的输入（不足一帧，或者输出空间不够时的整帧）留到下次
+    pending_.insert(pending_.end(), pcm, pcm + samples);
+    return packets == 0 && error != OPUS_OK ? error : (int) packets;
+}
+
+void OpusFrameAssembler::reset() {
+    pending_.clear();
+}
+
+} // namespace audio
@@ -0,0 +1,60 @@
+#ifndef DICIO_AUDIO_OPUS_FRAME_ASSEMBLER_H
+#define DICIO_AUDIO_OPUS_FRAME_ASSEMBLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct OpusEncoder;
+
+namespace audio {
+
+/**
+ * 把任意长度的PCM块（AudioRecord.read每次返回的长度不固定）拼成Opus要求的整帧并编码。
+ *
+ * push可以产生零个、一个或多个数据包，不够一帧的余下样本留在内部，下次push时接上。
+ * 内部缓冲区为空时，输入中的整帧直接从调用方的内存编码，只有不足一帧的尾部被复制。
+ * 编码器不归这个类所有，调用方负责它的生命周期。
+ */
+class OpusFrameAssembler {
+public:
+    /**
+     * @param frameSize 每帧每声道的样本数，必须是encoder的采样率下合法的Opus帧长
+     */
+    OpusFrameAssembler(OpusEncoder *encoder, int channels, int frameSize);
+
+    /**
+     * 送入samples个样本（立体声为交错存储，samples是总样本数）。
+     *
+     * 数据包依次写入out，各自的长度写入packetSizes。输出空间不够时，剩下的整帧留在内部，
+     * 下次push（可以是空输入）时再输出；输入总是被全部接收。
+     *
+     * @param maxPacketBytes 每个包最多的字节数，输出中至少要剩这么多空间才会编码下一帧
+     * @return 写出的包数。编码出错时丢弃那一帧并停止编码，已经写出的包照常返回，
+     *         一个包都没有写出时返回opus错误码
+     */
+    int push(const int16_t *pcm, size_t samples, uint8_t *out, size_t outCapacity,
+             int32_t *packetSizes, size_t maxPackets, size_t maxPacketBytes = 4000);
+
+    /**
+     * 丢弃内部缓存的样本（新的一次录音开始时调用）
+     */
+    void reset();
+
+    /**
+     * 内部缓存、还没有编码的样本数（总样本数，不是每声道）
+     */
+    size_t pendingSamples() const { return pending_.size(); }
+
+    size_t frameSamples() const { return frameSamples_; }
+
+private:
+    OpusEncoder *encoder_;
+    int frameSize_;
+    size_t frameSamples_; // frameSize * channels
+    std::vector<int16_t> pending_;
+};
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_OPUS_FRAME_ASSEMBLER_H
@@ -0,0 +1,298 @@
+#include "opus_stream_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <opus.h>
+
+#include "ogg_opus_writer.h"
+
+namespace audio {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t OGG_HEADER_SIZE = 27;
+constexpr uint8_t FLAG_CONTINUED = 0x01;
+constexpr uint8_t FLAG_END_OF_STREAM = 0x04;
+
+// 一个Opus包最长120毫秒
+constexpr int MAX_PACKET_MS = 120;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+uint32_t getLe32(const uint8_t *p) {
+    return p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+uint64_t getLe64(const uint8_t *p) {
+    return getLe32(p) | (uint64_t) getLe32(p + 4) << 32;
+}
+
+} // namespace
+
+OpusStreamDecoder::OpusStreamDecoder(int32_t sampleRate, int channels, int ringMs,
+                                     OpusStreamFormat format)
+        : sampleRate_(sampleRate), channels_(channels), format_(format) {
+    size_t frames = std::max<size_t>(1, (size_t) sampleRate * (size_t) std::max(ringMs, 0) / 1000);
+    ring_.resize(frames * (size_t) channels);
+}
+
+OpusStreamDecoder::~OpusStreamDecoder() {
+    if (decoder_ != nullptr) {
+        opus_decoder_destroy(decoder_);
+    }
+}
+
+int OpusStreamDecoder::init() {
+    int error;
+    decoder_ = opus_decoder_create(sampleRate_, channels_, &error);
+    if (error != OPUS_OK) {
+        decoder_ = nullptr;
+        return error;
+    }
+    scratch_.resize((size_t) sampleRate_ * MAX_PACKET_MS / 1000 * (size_t) channels_);
+    start_ = Clock::now();
+    return OPUS_OK;
+}
+
+int OpusStreamDecoder::feed(const uint8_t *data, size_t size) {
+    if (decoder_ == nullptr) {
+        return OPUS_INVALID_STATE;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cancelled_) {
+            return OPUS_OK;
+        }
+        if (stats_.firstByteSeconds < 0 && size > 0) {
+            stats_.firstByteSeconds = secondsSince(start_);
+        }
+        stats_.bytesIn += size;
+    }
+    if (error_ != OPUS_OK) {
+        return error_;
+    }
+
+    input_.insert(input_.end(), data, data + size);
+    error_ = parse();
+    // 丢掉已经解析的字节，不完整的页或包留到下一次
+    input_.erase(input_.begin(), input_.begin() + inputPos_);
+    inputPos_ = 0;
+    return error_;
+}
+
+int OpusStreamDecoder::parse() {
+    if (format_ == OPUS_STREAM_AUTO) {
+        if (input_.size() < 4) {
+            return OPUS_OK;
+        }
+        format_ = memcmp(input_.data(), "OggS", 4) == 0 ? OPUS_STREAM_OGG
+                                                         : OPUS_STREAM_LENGTH_PREFIXED;
+    }
+    for (;;) {
+        int result = format_ == OPUS_STREAM_OGG ? parseOggPage() : parseLengthPrefixed();
+        // 1表示数据不够一页（一个包），<0为错误
+        if (result != OPUS_OK) {
+            return result < 0 ? result : OPUS_OK;
+        }
+    }
+}
+
+int OpusStreamDecoder::parseLengthPrefixed() {
+    const uint8_t *p = input_.data() + inputPos_;
+    size_t available = input_.size() - inputPos_;
+    if (available < 2) {
+        return 1;
+    }
+    size_t length = (size_t) p[0] << 8 | p[1];
+    if (available < 2 + length) {
+        return 1;
+    }
+    inputPos_ += 2 + length;
+    // 长度为0的包没有内容，跳过
+    return length == 0 ? OPUS_OK : decodePacket(p + 2, length);
+}
+
+int OpusStreamDecoder::parseOggPage() {
+    const uint8_t *p = input_.data() + inputPos_;
+    size_t available = input_.size() - inputPos_;
+    if (available < OGG_HEADER_SIZE) {
+        return 1;
+    }
+    if (memcmp(p, "OggS", 4) != 0 || p[4] != 0) {
+        return OPUS_INVALID_PACKET;
+    }
+    size_t segments = p[26];
+    if (available < OGG_HEADER_SIZE + segments) {
+        return 1;
+    }
+    size_t bodySize = 0;
+    for (size_t i = 0; i < segments; ++i) {
+        bodySize += p[OGG_HEADER_SIZE + i];
+    }
+    size_t pageSize = OGG_HEADER_SIZE + segments + bodySize;
+    if (available < pageSize) {
+        return 1;
+    }
+    // CRC按校验字段为0计算
+    static const uint8_t zeros[4] = {};
+    uint32_t crc = oggCrc32(p, 22);
+    crc = oggCrc32(zeros, 4, crc);
+    crc = oggCrc32(p + 26, pageSize - 26, crc);
+    if (crc != getLe32(p + 22)) {
+        return OPUS_INVALID_PACKET;
+    }
+    inputPos_ += pageSize;
+
+    uint32_t serial = getLe32(p + 14);
+    if (!haveSerial_) {
+        haveSerial_ = true;
+        serial_ = serial;
+    } else if (serial != serial_) {
+        return OPUS_OK; // 其他逻辑流
+    }
+    uint8_t flags = p[5];
+    if (!(flags & FLAG_CONTINUED)) {
+        packet_.clear(); // 上一页结尾的包没有续上
+    }
+    int64_t granule = (int64_t) getLe64(p + 6);
+    if ((flags & FLAG_END_OF_STREAM) && granule >= 0) {
+        // 最后一页的granule可以小于实际解码的长度，用来裁掉末尾的填充
+        endLimit_ = (uint64_t) granule * (uint64_t) sampleRate_ / 48000;
+    }
+
+    const uint8_t *body = p + OGG_HEADER_SIZE + segments;
+    for (size_t i = 0; i < segments; ++i) {
+        uint8_t lacing = p[OGG_HEADER_SIZE + i];
+        packet_.insert(packet_.end(), body, body + lacing);
+        body += lacing;
+        if (lacing < 255) {
+            int result = handleOggPacket(packet_.data(), packet_.size());
+            packet_.clear();
+            if (result != OPUS_OK) {
+                return result;
+            }
+        }
+    }
+    return OPUS_OK;
+}
+
+int OpusStreamDecoder::handleOggPacket(const uint8_t *data, size_t size) {
+    size_t index = oggPackets_++;
+    if (index == 0) {
+        if (size < 19 || memcmp(data, "OpusHead", 8) != 0 || (data[8] >> 4) != 0) {
+            return OPUS_INVALID_PACKET;
+        }
+        // 映射族不为0时可能有两个以上的声道，需要多流解码器
+        if (data[18] != 0 && data[9] > 2) {
+            return OPUS_UNIMPLEMENTED;
+        }
+        uint32_t preSkip = data[10] | (uint32_t) data[11] << 8;
+        preSkip_ = (uint64_t) preSkip * (uint64_t) sampleRate_ / 48000;
+        return OPUS_OK;
+    }
+    if (index == 1) {
+        return OPUS_OK; // OpusTags
+    }
+    return size == 0 ? OPUS_OK : decodePacket(data, size);
+}
+
+int OpusStreamDecoder::decodePacket(const uint8_t *data, size_t size) {
+    int frames = opus_decode(decoder_, data, (opus_int32) size, scratch_.data(),
+                             (int) (scratch_.size() / (size_t) channels_), 0);
+    if (frames < 0) {
+        return frames;
+    }
+    uint64_t begin = decodedTotal_;
+    uint64_t end = begin + (uint64_t) frames;
+    decodedTotal_ = end;
+    uint64_t from = std::max(begin, preSkip_);
+    uint64_t to = std::min(end, endLimit_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.packets;
+    }
+    if (to > from) {
+        writeRing(scratch_.data() + (size_t) (from - begin) * (size_t) channels_,
+                  (size_t) (to - from) * (size_t) channels_);
+    }
+    return OPUS_OK;
+}
+
+void OpusStreamDecoder::writeRing(const int16_t *pcm, size_t samples) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    size_t capacity = ring_.size();
+    while (samples > 0 && !cancelled_) {
+        if (ringCount_ == capacity) {
+            ++stats_.producerWaits;
+            spaceAvailable_.wait(lock, [&] { return ringCount_ < capacity || cancelled_; });
+            continue;
+        }
+        size_t count = std::min(capacity - ringCount_, samples);
+        size_t writePos = (ringRead_ + ringCount_) % capacity;
+        size_t first = std::min(count, capacity - writePos);
+        memcpy(&ring_[writePos], pcm, first * sizeof(int16_t));
+        memcpy(&ring_[0], pcm + first, (count - first) * sizeof(int16_t));
+        ringCount_ += count;
+        if (stats_.firstSampleSeconds < 0) {
+            stats_.firstSampleSeconds = secondsSince(start_);
+        }
+        stats_.samplesOut += count / (size_t) channels_;
+        pcm += count;
+        samples -= count;
+        samplesAvailable_.notify_one();
+    }
+}
+
+void OpusStreamDecoder::finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.truncated = inputPos_ < input_.size() || !packet_.empty();
+    finished_ = true;
+    samplesAvailable_.notify_all();
+}
+
+void OpusStreamDecoder::cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    spaceAvailable_.notify_all();
+    samplesAvailable_.notify_all();
+}
+
+int OpusStreamDecoder::read(int16_t *out, size_t maxSamples, int timeoutMs) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    samplesAvailable_.wait_for(lock, std::chrono::milliseconds(std::max(timeoutMs, 0)), [&] {
+        return ringCount_ > 0 || finished_ || cancelled_;
+    });
+    if (cancelled_) {
+        return -1;
+    }
+    if (ringCount_ == 0) {
+        if (finished_) {
+            return -1;
+        }
+        if (stats_.firstSampleSeconds >= 0) {
+            ++stats_.underruns;
+        }
+        return 0;
+    }
+    size_t capacity = ring_.size();
+    size_t count = std::min(maxSamples - maxSamples % (size_t) channels_, ringCount_);
+    size_t first = std::min(count, capacity - ringRead_);
+    memcpy(out, &ring_[ringRead_], first * sizeof(int16_t));
+    memcpy(out + first, &ring_[0], (count - first) * sizeof(int16_t));
+    ringRead_ = (ringRead_ + count) % capacity;
+    ringCount_ -= count;
+    spaceAvailable_.notify_one();
+    return (int) count;
+}
+
+OpusStreamStats OpusStreamDecoder::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace audio
@@ -0,0 +1,131 @@
+#ifndef DICIO_AUDIO_OPUS_STREAM_DECODER_H
+#define DICIO_AUDIO_OPUS_STREAM_DECODER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+struct OpusDecoder;
+
+namespace audio {
+
+enum OpusStreamFormat {
+    // 根据开头的4个字节判断："OggS"为Ogg Opus，否则为带长度前缀的裸Opus包
+    OPUS_STREAM_AUTO = 0,
+    // Ogg Opus（RFC 7845），只解码第一个逻辑流
+    OPUS_STREAM_OGG = 1,
+    // 每个包前面是2字节大端的包长度
+    OPUS_STREAM_LENGTH_PREFIXED = 2,
+};
+
+struct OpusStreamStats {
+    uint64_t bytesIn = 0;
+    size_t packets = 0;
+    uint64_t samplesOut = 0; // 写入播放环的每声道样本数（已去掉pre-skip和末尾填充）
+    double firstByteSeconds = -1; // 从init到收到第一个字节，-1表示还没有
+    double firstSampleSeconds = -1; // 从init到第一个样本进入播放环
+    size_t producerWaits = 0; // 播放环满时feed等待的次数
+    size_t underruns = 0; // 开始播放后read超时返回0的次数
+    bool truncated = false; // finish时还有不完整的页或包
+};
+
+/**
+ * 边下载边解码的Opus流（云端TTS的HTTP响应体）。
+ *
+ * 网络线程把收到的每一块数据交给feed，不需要按页或包对齐；解析出完整的包后立即解码，
+ * 写入固定大小的播放环。播放线程用read从环中取出PCM写入AudioTrack。环满时feed阻塞，
+ * 让TCP的流量控制把下载速度压到播放速度，内存用量与句子长短无关。
+ *
+ * feed和finish只能在一个线程上调用，read只能在另一个线程上调用；cancel和stats可以在
+ * 任何线程上调用。
+ */
+class OpusStreamDecoder {
+public:
+    /**
+     * @param sampleRate 输出采样率（8000、12000、16000、24000或48000）
+     * @param channels 输出声道数，与流的声道数不同时由解码器混音
+     * @param ringMs 播放环的长度
+     */
+    OpusStreamDecoder(int32_t sampleRate, int channels, int ringMs,
+                      OpusStreamFormat format = OPUS_STREAM_AUTO);
+    ~OpusStreamDecoder();
+
+    OpusStreamDecoder(const OpusStreamDecoder &) = delete;
+    OpusStreamDecoder &operator=(const OpusStreamDecoder &) = delete;
+
+    /**
+     * 创建解码器，并开始计算首字节和首样本的时间（在发出HTTP请求之前调用）
+     * @return OPUS_OK或opus错误码
+     */
+    int init();
+
+    /**
+     * 送入响应体的下一块数据。播放环满时阻塞，直到read取走样本或cancel。
+     * @return OPUS_OK，或流格式不对、解码失败时的opus错误码（之后的调用都返回这个错误）
+     */
+    int feed(const uint8_t *data, size_t size);
+
+    /**
+     * 响应体结束，read取完环中的样本后返回-1
+     */
+    void finish();
+
+    /**
+     * 停止播放：唤醒阻塞中的feed和read，之后feed直接返回，read返回-1
+     */
+    void cancel();
+
+    /**
+     * 从播放环中取出最多maxSamples个样本（多声道为交错存储的总数），环为空时最多等待
+     * timeoutMs毫秒。
+     * @return 取出的样本数，超时返回0，流已结束（或取消）且环为空返回-1
+     */
+    int read(int16_t *out, size_t maxSamples, int timeoutMs);
+
+    OpusStreamStats stats() const;
+
+private:
+    int parse();
+    int parseOggPage();
+    int parseLengthPrefixed();
+    int handleOggPacket(const uint8_t *data, size_t size);
+    int decodePacket(const uint8_t *data, size_t size);
+    void writeRing(const int16_t *pcm, size_t samples);
+
+    const int32_t sampleRate_;
+    const int channels_;
+    OpusStreamFormat format_;
+    OpusDecoder *decoder_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+    int error_ = 0;
+
+    // 网络线程独占的解析状态
+    std::vector<uint8_t> input_; // 还没有解析的字节
+    size_t inputPos_ = 0;
+    std::vector<uint8_t> packet_; // 跨页的Ogg包
+    std::vector<int16_t> scratch_; // 一个包解码的结果
+    bool haveSerial_ = false;
+    uint32_t serial_ = 0;
+    size_t oggPackets_ = 0; // 包括OpusHead和OpusTags
+    uint64_t preSkip_ = 0; // 输出采样率下每声道样本
+    uint64_t decodedTotal_ = 0; // 解码出的每声道样本总数，包括pre-skip
+    uint64_t endLimit_ = UINT64_MAX; // EOS页的granule换算出的decodedTotal_上限
+
+    // 播放环，由mutex_保护
+    mutable std::mutex mutex_;
+    std::condition_variable spaceAvailable_;
+    std::condition_variable samplesAvailable_;
+    std::vector<int16_t> ring_;
+    size_t ringRead_ = 0;
+    size_t ringCount_ = 0;
+    bool finished_ = false;
+    bool cancelled_ = false;
+    OpusStreamStats stats_;
+};
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_OPUS_STREAM_DECODER_H
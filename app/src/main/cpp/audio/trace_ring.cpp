@@ -0,0 +1,339 @@
+#include "trace_ring.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <set>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace audio {
+
+namespace {
+
+int64_t monotonicNanos() {
+#ifdef __linux__
+    // vDSO，不进内核
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+int32_t currentTid() {
+    static thread_local int32_t tid =
+#ifdef __linux__
+            (int32_t) syscall(SYS_gettid);
+#else
+            (int32_t) std::hash<std::thread::id>()(std::this_thread::get_id());
+#endif
+    return tid;
+}
+
+struct EventInfo {
+    bool registered = false;
+    std::string tag;
+    std::string name;
+    std::vector<std::string> argNames;
+    std::string format;
+};
+
+struct Registry {
+    std::mutex mutex;
+    EventInfo events[TRACE_MAX_EVENTS];
+};
+
+// 只接受整数转换，参数都是int32，%s之类的会读到错误的类型
+bool validFormat(const std::string &format) {
+    int conversions = 0;
+    for (size_t i = 0; i < format.size(); ++i) {
+        if (format[i] != '%') {
+            continue;
+        }
+        ++i;
+        if (i < format.size() && format[i] == '%') {
+            continue;
+        }
+        while (i < format.size() && strchr("-+ #0123456789", format[i]) != nullptr) {
+            ++i;
+        }
+        if (i >= format.size() || strchr("diux", format[i]) == nullptr) {
+            return false;
+        }
+        ++conversions;
+    }
+    return conversions <= TRACE_ARGS;
+}
+
+std::vector<std::string> splitNames(const std::string &names) {
+    std::vector<std::string> result;
+    size_t start = 0;
+    while (start <= names.size() && !names.empty()) {
+        size_t end = names.find(',', start);
+        if (end == std::string::npos) {
+            end = names.size();
+        }
+        result.push_back(names.substr(start, end - start));
+        start = end + 1;
+    }
+    return result;
+}
+
+void setEvent(EventInfo &info, const std::string &tag, const std::string &name,
+              const std::string &argNames, const std::string &format) {
+    info.registered = true;
+    info.tag = tag;
+    info.name = name;
+    info.argNames = splitNames(argNames);
+    info.format = format;
+}
+
+Registry &registry() {
+    static Registry *instance = [] {
+        Registry *r = new Registry();
+        setEvent(r->events[TRACE_CAPTURE_HANDOFF], "CaptureSession", "capture_handoff",
+                 "owner,position", "🔀 录音交给消费者%d，切换点%u");
+        setEvent(r->events[TRACE_CAPTURE_OVERRUN], "CaptureSession", "capture_overrun",
+                 "dropped,owner", "⚠️ 录音环满，覆盖了%d个样本（所有者%d）");
+        return r;
+    }();
+    return *instance;
+}
+
+void writeJsonString(FILE *file, const std::string &value) {
+    fputc('"', file);
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            fputc('\\', file);
+            fputc(c, file);
+        } else if ((unsigned char) c < 0x20) {
+            fprintf(file, "\\u%04x", c);
+        } else {
+            fputc(c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+std::string threadName(int32_t tid) {
+#ifdef __linux__
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/comm", tid);
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) {
+        return std::string(); // 线程已经结束
+    }
+    char name[64] = {};
+    if (fgets(name, sizeof(name), file) == nullptr) {
+        name[0] = '\0';
+    }
+    fclose(file);
+    name[strcspn(name, "\n")] = '\0';
+    return name;
+#else
+    return std::string();
+#endif
+}
+
+} // namespace
+
+TraceRing::TraceRing(size_t capacity) : head_(0), lost_(0) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    slots_.reset(new Slot[size]);
+    mask_ = size - 1;
+    for (size_t i = 0; i < size; ++i) {
+        slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+void TraceRing::write(int32_t id, int32_t a0, int32_t a1, int32_t a2, int32_t a3) {
+    uint64_t index = head_.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = slots_[index & mask_];
+    // 写入的线程被挂起、期间整个环被写满一圈时，两次写入可能交错，读的一方通常能从序号
+    // 发现；在调试用的记录里可以接受
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timeNanos.store(monotonicNanos(), std::memory_order_relaxed);
+    slot.id.store(id, std::memory_order_relaxed);
+    slot.tid.store(currentTid(), std::memory_order_relaxed);
+    slot.args[0].store(a0, std::memory_order_relaxed);
+    slot.args[1].store(a1, std::memory_order_relaxed);
+    slot.args[2].store(a2, std::memory_order_relaxed);
+    slot.args[3].store(a3, std::memory_order_relaxed);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+bool TraceRing::read(uint64_t index, TraceEvent &event, bool &pending) const {
+    const Slot &slot = slots_[index & mask_];
+    uint64_t expected = 2 * index + 2;
+    uint64_t before = slot.sequence.load(std::memory_order_acquire);
+    if (before != expected) {
+        // 比期望的小：已经取得槽但还没有写完；比期望的大：已经被覆盖
+        pending = before < expected;
+        return false;
+    }
+    event.timeNanos = slot.timeNanos.load(std::memory_order_relaxed);
+    event.id = slot.id.load(std::memory_order_relaxed);
+    event.tid = slot.tid.load(std::memory_order_relaxed);
+    for (int i = 0; i < TRACE_ARGS; ++i) {
+        event.args[i] = slot.args[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    pending = false;
+    return slot.sequence.load(std::memory_order_relaxed) == expected;
+}
+
+size_t TraceRing::drain(std::vector<TraceEvent> &out, size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(drainMutex_);
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t capacity = mask_ + 1;
+    if (head - tail_ > capacity) {
+        lost_.fetch_add(head - tail_ - capacity, std::memory_order_relaxed);
+        tail_ = head - capacity;
+    }
+    size_t count = 0;
+    while (tail_ < head && count < maxEvents) {
+        TraceEvent event;
+        bool pending;
+        if (read(tail_, event, pending)) {
+            out.push_back(event);
+            ++count;
+        } else if (pending) {
+            break;
+        } else {
+            lost_.fetch_add(1, std::memory_order_relaxed);
+        }
+        ++tail_;
+    }
+    return count;
+}
+
+std::vector<TraceEvent> TraceRing::snapshot() const {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t capacity = mask_ + 1;
+    std::vector<TraceEvent> events;
+    events.reserve((size_t) std::min(head, capacity));
+    for (uint64_t index = head > capacity ? head - capacity : 0; index < head; ++index) {
+        TraceEvent event;
+        bool pending;
+        if (read(index, event, pending)) {
+            events.push_back(event);
+        }
+    }
+    return events;
+}
+
+TraceRing &traceRing() {
+    static TraceRing *ring = new TraceRing(8192);
+    return *ring;
+}
+
+bool registerTraceEvent(int32_t id, const std::string &tag, const std::string &name,
+                        const std::string &argNames, const std::string &format) {
+    if (id <= 0 || id >= TRACE_MAX_EVENTS || name.empty() || !validFormat(format)) {
+        return false;
+    }
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    setEvent(r.events[id], tag, name, argNames, format);
+    return true;
+}
+
+bool formatTraceEvent(const TraceEvent &event, std::string &line) {
+    if (event.id <= 0 || event.id >= TRACE_MAX_EVENTS) {
+        return false;
+    }
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    const EventInfo &info = r.events[event.id];
+    if (!info.registered || info.format.empty()) {
+        return false;
+    }
+    char message[512];
+    snprintf(message, sizeof(message), info.format.c_str(), event.args[0], event.args[1],
+             event.args[2], event.args[3]);
+    char time[32];
+    snprintf(time, sizeof(time), "[%lld.%03lld] ", (long long) (event.timeNanos / 1000000000),
+             (long long) (event.timeNanos / 1000000 % 1000));
+    line = info.tag + "\t" + time + message;
+    return true;
+}
+
+bool exportTraceJson(const std::vector<TraceEvent> &events, const std::string &path) {
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+#ifdef __linux__
+    int pid = (int) getpid();
+#else
+    int pid = 1;
+#endif
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    bool first = true;
+    std::set<int32_t> tids;
+    Registry &r = registry();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (const TraceEvent &event : events) {
+            const EventInfo *info = event.id > 0 && event.id < TRACE_MAX_EVENTS
+                                    && r.events[event.id].registered
+                                    ? &r.events[event.id] : nullptr;
+            fputs(first ? "\n" : ",\n", file);
+            first = false;
+            fputs("{\"name\":", file);
+            writeJsonString(file, info != nullptr ? info->name
+                                                  : "event_" + std::to_string(event.id));
+            fputs(",\"cat\":", file);
+            writeJsonString(file, info != nullptr ? info->tag : "");
+            fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld.%03d,\"pid\":%d,\"tid\":%d",
+                    (long long) (event.timeNanos / 1000), (int) (event.timeNanos % 1000), pid,
+                    event.tid);
+            fputs(",\"args\":{", file);
+            bool firstArg = true;
+            for (int i = 0; info != nullptr && i < TRACE_ARGS
+                            && i < (int) info->argNames.size(); ++i) {
+                if (info->argNames[i].empty()) {
+                    continue;
+                }
+                fputs(firstArg ? "" : ",", file);
+                firstArg = false;
+                writeJsonString(file, info->argNames[i]);
+                fprintf(file, ":%d", event.args[i]);
+            }
+            fputs("}}", file);
+            tids.insert(event.tid);
+        }
+    }
+    // 线程名让Perfetto在每条线程的轨道上显示"WakeCapture"之类的名字
+    for (int32_t tid : tids) {
+        std::string name = threadName(tid);
+        if (name.empty()) {
+            continue;
+        }
+        fputs(first ? "\n" : ",\n", file);
+        first = false;
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+                      "\"args\":{\"name\":", pid, tid);
+        writeJsonString(file, name);
+        fputs("}}", file);
+    }
+    fputs("\n]}\n", file);
+    bool ok = !ferror(file);
+    return fclose(file) == 0 && ok;
+}
+
+} // namespace audio
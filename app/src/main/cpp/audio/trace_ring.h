@@ -0,0 +1,127 @@
+#ifndef DICIO_AUDIO_TRACE_RING_H
+#define DICIO_AUDIO_TRACE_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace audio {
+
+enum TraceEventId {
+    // CaptureSession::handoff：新的所有者、切换点（样本位置的低32位）
+    TRACE_CAPTURE_HANDOFF = 1,
+    // CaptureSession::write覆盖了还没有读走的样本：覆盖的样本数、当时的所有者
+    TRACE_CAPTURE_OVERRUN = 2,
+    // 从这里开始的编号由Kotlin的AudioTrace注册
+    TRACE_FIRST_APP_EVENT = 64,
+    TRACE_MAX_EVENTS = 256,
+};
+
+constexpr int TRACE_ARGS = 4;
+
+struct TraceEvent {
+    int64_t timeNanos; // CLOCK_MONOTONIC，与Kotlin的System.nanoTime相同
+    int32_t id;
+    int32_t tid;
+    int32_t args[TRACE_ARGS];
+};
+
+/**
+ * 定长的二进制事件环，任意多个线程无锁写入，一个线程读出。
+ *
+ * write用fetch_add取得一个槽，写入之后更新槽的序号（seqlock），不分配内存、不格式化字符串，
+ * 也不会阻塞：环满时覆盖最旧的事件。读的一方按序号判断槽里的事件是否完整、是否已经被
+ * 覆盖，被覆盖的计入lost。
+ */
+class TraceRing {
+public:
+    /**
+     * @param capacity 事件数，向上取整到2的幂
+     */
+    explicit TraceRing(size_t capacity);
+
+    TraceRing(const TraceRing &) = delete;
+    TraceRing &operator=(const TraceRing &) = delete;
+
+    void write(int32_t id, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0);
+
+    /**
+     * 取出上一次drain之后写入的事件，最多maxEvents个，追加到out。只能在一个线程上调用；
+     * 遇到还没有写完的槽就停下，留到下一次。
+     * @return 取出的事件数
+     */
+    size_t drain(std::vector<TraceEvent> &out, size_t maxEvents);
+
+    /**
+     * 环中现有的全部完整事件，按写入顺序，不影响drain
+     */
+    std::vector<TraceEvent> snapshot() const;
+
+    /**
+     * drain之前就被覆盖的事件数
+     */
+    uint64_t lost() const { return lost_.load(std::memory_order_relaxed); }
+
+    size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Slot {
+        // 2*i+1：第i个事件正在写入；2*i+2：第i个事件已经写完
+        std::atomic<uint64_t> sequence;
+        std::atomic<int64_t> timeNanos;
+        std::atomic<int32_t> id;
+        std::atomic<int32_t> tid;
+        std::atomic<int32_t> args[TRACE_ARGS];
+    };
+
+    bool read(uint64_t index, TraceEvent &event, bool &pending) const;
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<uint64_t> head_; // 已经取得槽的事件总数
+    std::mutex drainMutex_;
+    uint64_t tail_ = 0; // 下一次drain开始的位置，由drainMutex_保护
+    std::atomic<uint64_t> lost_;
+};
+
+/**
+ * 本进程共用的事件环（8192个事件，256KB），第一次调用时创建
+ */
+TraceRing &traceRing();
+
+inline void trace(int32_t id, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0) {
+    traceRing().write(id, a0, a1, a2, a3);
+}
+
+/**
+ * 登记事件的名字和输出格式，不在热路径上调用。
+ * @param tag 写入日志时用的标签（DebugLogger的tag）
+ * @param name 导出的trace里的事件名
+ * @param argNames 逗号分隔的参数名，导出时只输出有名字的参数
+ * @param format 写入日志的printf格式，只能有最多4个%d、%i、%u、%x（可以带宽度和标志），
+ *               为空时这个事件只出现在导出的trace里，不写日志
+ * @return id超出范围或者格式不合法时返回false
+ */
+bool registerTraceEvent(int32_t id, const std::string &tag, const std::string &name,
+                        const std::string &argNames, const std::string &format);
+
+/**
+ * 按登记的格式把事件写成"tag\t[秒.毫秒] 消息"（时间是事件发生时的CLOCK_MONOTONIC）
+ * @return 没有登记或者不写日志的事件返回false
+ */
+bool formatTraceEvent(const TraceEvent &event, std::string &line);
+
+/**
+ * 把事件写成Chrome的JSON trace格式（Perfetto UI和chrome://tracing都能打开），
+ * 每个事件是一个瞬时事件（"ph":"i"），线程上的位置是事件发生的线程
+ * @return 写入成功返回true
+ */
+bool exportTraceJson(const std::vector<TraceEvent> &events, const std::string &path);
+
+} // namespace audio
+
+#endif // DICIO_AUDIO_TRACE_RING_H
@@ -0,0 +1,308 @@
+/*
+ * 音频线程设置（audio/audio_thread.h）的主机端测试和抖动基准测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/audio_build && cmake --build /tmp/audio_build
+ *   /tmp/audio_build/audio_thread_benchmark [--seconds N] [--quick]
+ *
+ * 先检查：
+ *   - readCpuTopology在假的sysfs目录上（三簇、两簇、所有核相同、没有cpu_capacity）选出的大核；
+ *   - AudioThreadScope析构之后，线程的调度策略、nice值和亲和性都恢复原样。
+ * 然后模拟语音识别上行的编码线程：每20毫秒醒来一次编码一帧Opus，同时每个核上都有一个
+ * 忙循环的线程抢CPU。分别在普通线程和AUDIO_THREAD_ENCODE的设置下统计唤醒的延迟、
+ * 每帧的编码时间和超时（唤醒延迟加编码时间超过一帧）的次数。没有CAP_SYS_NICE时
+ * SCHED_FIFO和负nice值都会失败，只有亲和性生效，两次的结果差不多是正常的。
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <opus.h>
+
+#include "audio/audio_thread.h"
+
+using namespace audio;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr int32_t SAMPLE_RATE = 16000;
+constexpr int FRAME_SIZE = 320; // 20ms
+constexpr int64_t FRAME_NANOS = 20000000;
+
+struct Options {
+    double seconds = 20;
+};
+
+bool writeFile(const std::string &path, const std::string &content) {
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    fputs(content.c_str(), file);
+    fclose(file);
+    return true;
+}
+
+// 在root下按capacities建一个假的/sys/devices/system/cpu，capacity为0表示没有cpu_capacity文件
+std::string makeFakeSysfs(const std::string &root, const std::vector<int> &capacities) {
+    std::string dir = root + "/" + std::to_string(rand());
+    mkdir(dir.c_str(), 0700);
+    for (size_t cpu = 0; cpu < capacities.size(); ++cpu) {
+        std::string cpuDir = dir + "/cpu" + std::to_string(cpu);
+        mkdir(cpuDir.c_str(), 0700);
+        if (capacities[cpu] > 0) {
+            writeFile(cpuDir + "/cpu_capacity", std::to_string(capacities[cpu]) + "\n");
+        }
+    }
+    // 这些不是CPU目录，必须跳过
+    mkdir((dir + "/cpufreq").c_str(), 0700);
+    mkdir((dir + "/cpuidle").c_str(), 0700);
+    return dir;
+}
+
+bool checkTopology(const std::string &root) {
+    struct Case {
+        const char *name;
+        std::vector<int> capacities;
+        int cpuCount;
+        std::vector<int> bigCores;
+    };
+    const Case cases[] = {
+        {"1+3+4", {325, 325, 325, 325, 870, 870, 870, 1024}, 8, {4, 5, 6, 7}},
+        {"2+6", {1024, 1024, 400, 400, 400, 400, 400, 400}, 8, {0, 1}},
+        {"homogeneous", {1024, 1024, 1024, 1024}, 4, {}},
+        {"no cpu_capacity", {0, 0, 0, 0}, 0, {}},
+    };
+    bool ok = true;
+    for (const Case &c : cases) {
+        CpuTopology topology = readCpuTopology(makeFakeSysfs(root, c.capacities));
+        bool match = topology.cpuCount == c.cpuCount && topology.bigCores == c.bigCores;
+        printf("topology %-16s %d cpus, %zu big cores: %s\n", c.name, topology.cpuCount,
+               topology.bigCores.size(), match ? "ok" : "MISMATCH");
+        ok = ok && match;
+    }
+    CpuTopology missing = readCpuTopology(root + "/does-not-exist");
+    ok = ok && missing.cpuCount == 0 && missing.bigCores.empty();
+    return ok;
+}
+
+struct ThreadState {
+    int policy;
+    int fifoPriority;
+    int nice;
+    cpu_set_t mask;
+};
+
+ThreadState threadState() {
+    ThreadState state;
+    pid_t tid = (pid_t) syscall(SYS_gettid);
+    state.policy = sched_getscheduler(tid);
+    struct sched_param param = {};
+    sched_getparam(tid, &param);
+    state.fifoPriority = param.sched_priority;
+    state.nice = getpriority(PRIO_PROCESS, (id_t) tid);
+    CPU_ZERO(&state.mask);
+    sched_getaffinity(tid, sizeof(state.mask), &state.mask);
+    return state;
+}
+
+bool sameState(const ThreadState &a, const ThreadState &b) {
+    return a.policy == b.policy && a.fifoPriority == b.fifoPriority && a.nice == b.nice
+           && CPU_EQUAL(&a.mask, &b.mask);
+}
+
+bool checkRestore() {
+    ThreadState before = threadState();
+    // 假装第一个允许的核是大核，这样亲和性一定会改变（只要允许的核多于一个）
+    CpuTopology topology;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &before.mask)) {
+            topology.bigCores.push_back(cpu);
+            break;
+        }
+    }
+    topology.cpuCount = CPU_COUNT(&before.mask);
+    bool ok = true;
+    for (AudioThreadRole role : {AUDIO_THREAD_CAPTURE, AUDIO_THREAD_WAKE, AUDIO_THREAD_ENCODE,
+                                 AUDIO_THREAD_PLAYBACK}) {
+        AudioThreadConfig config = audioThreadConfig(role, FRAME_NANOS);
+        bool changed;
+        {
+            AudioThreadScope scope(config, topology);
+            ThreadState during = threadState();
+            bool pinnedOk = !scope.pinned() || CPU_COUNT(&during.mask) == 1;
+            changed = !sameState(before, during);
+            ok = ok && pinnedOk
+                 && changed == (scope.pinned() || scope.priority() != AUDIO_PRIORITY_UNCHANGED);
+            printf("role %d: priority %s, %s -> ", role,
+                   scope.priority() == AUDIO_PRIORITY_FIFO ? "SCHED_FIFO"
+                   : scope.priority() == AUDIO_PRIORITY_NICE ? "nice" : "unchanged",
+                   scope.pinned() ? "pinned" : "not pinned");
+        }
+        bool restored = sameState(before, threadState());
+        printf("%s\n", restored ? "restored" : "NOT RESTORED");
+        ok = ok && restored;
+    }
+    return ok;
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t) (p * values.size()))];
+}
+
+struct JitterResult {
+    std::vector<double> latenessUs;
+    std::vector<double> workUs;
+    size_t overruns = 0;
+    size_t encodeErrors = 0;
+    std::string setup;
+};
+
+JitterResult measureJitter(bool audioThread, double seconds) {
+    std::atomic<bool> running(true);
+    std::vector<std::thread> antagonists;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < cores; ++i) {
+        antagonists.emplace_back([&running] {
+            volatile double x = 1;
+            while (running.load(std::memory_order_relaxed)) {
+                for (int j = 0; j < 10000; ++j) {
+                    x = x * 1.0000001 + 1e-9;
+                }
+            }
+        });
+    }
+
+    JitterResult result;
+    std::thread worker([&] {
+        int error;
+        OpusEncoder *encoder = opus_encoder_create(SAMPLE_RATE, 1, OPUS_APPLICATION_VOIP, &error);
+        opus_encoder_ctl(encoder, OPUS_SET_BITRATE(32000));
+        opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(8));
+        std::vector<int16_t> pcm(FRAME_SIZE);
+        uint8_t packet[4000];
+
+        AudioThreadScope *scope = nullptr;
+        if (audioThread) {
+            scope = new AudioThreadScope(audioThreadConfig(AUDIO_THREAD_ENCODE, FRAME_NANOS));
+            result.setup = std::string(scope->priority() == AUDIO_PRIORITY_FIFO ? "SCHED_FIFO"
+                                       : scope->priority() == AUDIO_PRIORITY_NICE ? "nice"
+                                       : "default priority")
+                           + (scope->pinned() ? ", big cores" : "");
+        } else {
+            result.setup = "plain thread";
+        }
+
+        size_t frames = (size_t) (seconds * 1e9 / FRAME_NANOS);
+        Clock::time_point deadline = Clock::now();
+        for (size_t frame = 0; frame < frames; ++frame) {
+            deadline += std::chrono::nanoseconds(FRAME_NANOS);
+            std::this_thread::sleep_until(deadline);
+            Clock::time_point woke = Clock::now();
+            for (int i = 0; i < FRAME_SIZE; ++i) {
+                double t = (double) (frame * FRAME_SIZE + i) / SAMPLE_RATE;
+                pcm[i] = (int16_t) (8000 * sin(2 * M_PI * 220 * t) * (1 + sin(2 * M_PI * t)));
+            }
+            if (opus_encode(encoder, pcm.data(), FRAME_SIZE, packet, sizeof(packet)) < 0) {
+                ++result.encodeErrors;
+            }
+            Clock::time_point done = Clock::now();
+            int64_t workNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    done - woke).count();
+            if (scope != nullptr) {
+                scope->reportWork(workNanos);
+            }
+            double lateness = std::chrono::duration<double, std::micro>(woke - deadline).count();
+            result.latenessUs.push_back(lateness);
+            result.workUs.push_back(workNanos / 1e3);
+            if (std::chrono::duration_cast<std::chrono::nanoseconds>(done - deadline).count()
+                > FRAME_NANOS) {
+                ++result.overruns;
+            }
+        }
+        delete scope;
+        opus_encoder_destroy(encoder);
+    });
+    worker.join();
+    running.store(false);
+    for (std::thread &thread : antagonists) {
+        thread.join();
+    }
+    return result;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查是否正确（ctest），抖动的数字没有参考价值
+            options.seconds = 1;
+        } else {
+            fprintf(stderr, "Usage: %s [--seconds N] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.seconds > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    char root[] = "/tmp/audio_thread_XXXXXX";
+    if (mkdtemp(root) == nullptr) {
+        perror("mkdtemp");
+        return 1;
+    }
+    bool ok = checkTopology(root);
+    std::string cleanup = std::string("rm -rf ") + root;
+    if (system(cleanup.c_str()) != 0) {
+        fprintf(stderr, "could not remove %s\n", root);
+    }
+    ok = checkRestore() && ok;
+
+    const CpuTopology &topology = cpuTopology();
+    printf("this machine: %d cpus with cpu_capacity, %zu big cores\n", topology.cpuCount,
+           topology.bigCores.size());
+
+    for (bool audioThread : {false, true}) {
+        JitterResult result = measureJitter(audioThread, options.seconds);
+        printf("%-28s wake-up lateness p50 %6.0f us, p99 %6.0f us, max %6.0f us; "
+               "encode p50 %4.0f us, max %5.0f us; %zu of %zu frames overran\n",
+               result.setup.c_str(), percentile(result.latenessUs, .5),
+               percentile(result.latenessUs, .99), percentile(result.latenessUs, 1),
+               percentile(result.workUs, .5), percentile(result.workUs, 1), result.overruns,
+               result.latenessUs.size());
+        ok = ok && result.encodeErrors == 0;
+    }
+
+    if (!ok) {
+        fprintf(stderr, "audio thread setup check failed\n");
+        return 1;
+    }
+    return 0;
+}
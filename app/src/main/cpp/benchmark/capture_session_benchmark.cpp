@@ -0,0 +1,307 @@
+/*
+ * 录音会话（audio/capture_session.h）的主机端测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/audio_build && cmake --build /tmp/audio_build
+ *   /tmp/audio_build/capture_session_benchmark [--seconds N] [--speed X] [--quick]
+ *
+ * 按X倍的实时速度回放一段录音：录音线程每次写入的样本数不固定（1到3000之间随机，并混入
+ * AudioRecord常见的320、640），模拟WakeService的唤醒词检测线程按512个样本一帧读取，
+ * 每隔随机的若干帧"检测到唤醒词"、把录音交给语音识别；语音识别线程每次读取随机长度，
+ * 读够随机长度的一句话后交回，再停一段随机的时间（模拟断开、下一次建立连接），这期间的
+ * 录音留在环里。检查：
+ *   - 两个消费者读到的所有片段按位置拼起来正好是写入的全部样本，没有空缺、没有重叠，
+ *     内容与写入的一致，没有样本被覆盖；
+ *   - 每次切换的位置正好是上一个所有者读到的最后一个样本之后；
+ *   - finish之后两个消费者都返回-1。
+ * 同时统计语音识别交回之后，阻塞中的检测线程多久被唤醒（旧的做法用Thread.sleep(50)轮询，
+ * 平均25毫秒，还要重新启动AudioRecord）。
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "audio/capture_session.h"
+
+using namespace audio;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr int32_t SAMPLE_RATE = 16000;
+constexpr size_t WAKE_FRAME = 512;
+
+struct Options {
+    double seconds = 600;
+    double speed = 20;
+};
+
+struct Random {
+    uint32_t state;
+
+    uint32_t next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+};
+
+// 每个位置上的样本值都不同（在65536个样本之内），错位或重复都能发现
+int16_t sampleAt(uint64_t position) {
+    return (int16_t) (uint16_t) ((position * 40503u) ^ (position >> 16));
+}
+
+struct Segment {
+    int64_t position;
+    size_t count;
+};
+
+struct ConsumerResult {
+    std::vector<Segment> segments;
+    size_t mismatches = 0;
+    size_t badBoundaries = 0;
+    size_t handoffs = 0;
+    bool ended = false; // 最后一次read返回-1
+};
+
+void checkSamples(const int16_t *pcm, int count, int64_t position, ConsumerResult &result) {
+    for (int i = 0; i < count; ++i) {
+        if (pcm[i] != sampleAt((uint64_t) position + i)) {
+            ++result.mismatches;
+        }
+    }
+    result.segments.push_back({position, (size_t) count});
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t) (p * values.size()))];
+}
+
+struct Run {
+    bool ok;
+    uint64_t samples;
+    CaptureSessionStats stats;
+    std::vector<double> wakeLatencyUs;
+    size_t wakeHandoffs;
+    size_t asrHandoffs;
+};
+
+Run run(const Options &options) {
+    uint64_t total = (uint64_t) (options.seconds * SAMPLE_RATE);
+    // 环的长度按回放速度放大，主机上线程偶尔被调度延迟也不会覆盖
+    CaptureSession session(SAMPLE_RATE, 10000, CAPTURE_WAKE);
+    if (!session.valid()) {
+        fprintf(stderr, "could not create the capture signals\n");
+        exit(1);
+    }
+    std::atomic<uint64_t> written(0);
+    std::atomic<int64_t> handbackNanos(-1);
+    std::vector<double> wakeLatencyUs;
+    ConsumerResult wake, asr;
+
+    std::thread producer([&] {
+        Random random = {3};
+        std::vector<int16_t> chunk;
+        Clock::time_point start = Clock::now();
+        uint64_t position = 0;
+        while (position < total) {
+            uint32_t r = random.next();
+            size_t count = r % 4 == 0 ? (r & 16 ? 320 : 640) : 1 + (r >> 4) % 3000;
+            count = (size_t) std::min<uint64_t>(count, total - position);
+            chunk.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                chunk[i] = sampleAt(position + i);
+            }
+            // AudioRecord.read返回的时间：这一块的最后一个样本录完时
+            std::this_thread::sleep_until(start + std::chrono::duration_cast<Clock::duration>(
+                    std::chrono::duration<double>((double) (position + count) / SAMPLE_RATE
+                                                  / options.speed)));
+            session.write(chunk.data(), count);
+            position += count;
+            written.store(position);
+        }
+        session.finish();
+    });
+
+    std::thread wakeThread([&] {
+        Random random = {5};
+        std::vector<int16_t> frame(WAKE_FRAME);
+        size_t filled = 0;
+        size_t framesUntilWake = 5 + random.next() % 30;
+        int64_t expected = 0; // 下一次read应该从哪里开始
+        bool owner = true;
+        for (;;) {
+            int64_t position;
+            int count = session.read(CAPTURE_WAKE, frame.data() + filled, WAKE_FRAME - filled,
+                                     1000, &position);
+            if (count < 0) {
+                wake.ended = true;
+                break;
+            }
+            if (count == 0) {
+                continue;
+            }
+            if (!owner) {
+                // 语音识别交回后的第一次读取，交回时环里已经有样本才算唤醒的延迟
+                int64_t handback = handbackNanos.exchange(-1);
+                if (handback >= 0) {
+                    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            Clock::now().time_since_epoch()).count();
+                    wakeLatencyUs.push_back((now - handback) / 1e3);
+                }
+                owner = true;
+                expected = position;
+            }
+            if (position != expected) {
+                ++wake.badBoundaries; // 同一段所有权之内必须连续
+            }
+            checkSamples(frame.data() + filled, count, position, wake);
+            expected = position + count;
+            filled += count;
+            if (filled < WAKE_FRAME) {
+                continue;
+            }
+            filled = 0;
+            if (--framesUntilWake == 0) {
+                framesUntilWake = 5 + random.next() % 30;
+                int64_t boundary = session.handoff(CAPTURE_ASR);
+                if (boundary != expected) {
+                    ++wake.badBoundaries;
+                }
+                ++wake.handoffs;
+                owner = false;
+            }
+        }
+    });
+
+    std::thread asrThread([&] {
+        Random random = {7};
+        std::vector<int16_t> buffer(4000);
+        uint64_t remaining = 0; // 这一句还要读多少样本，0表示还没有开始
+        int64_t expected = -1;
+        for (;;) {
+            size_t maxSamples = 1 + random.next() % buffer.size();
+            int64_t position;
+            int count = session.read(CAPTURE_ASR, buffer.data(), maxSamples, 1000, &position);
+            if (count < 0) {
+                asr.ended = true;
+                break;
+            }
+            if (count == 0) {
+                continue;
+            }
+            if (remaining == 0) {
+                remaining = SAMPLE_RATE / 4 + random.next() % (2 * SAMPLE_RATE);
+            } else if (position != expected) {
+                ++asr.badBoundaries;
+            }
+            checkSamples(buffer.data(), count, position, asr);
+            expected = position + count;
+            remaining -= std::min<uint64_t>(remaining, (uint64_t) count);
+            if (remaining > 0) {
+                continue;
+            }
+            int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now().time_since_epoch()).count();
+            // 只读到maxSamples个，环里常常还有样本
+            bool pending = written.load() > (uint64_t) expected;
+            handbackNanos.store(pending ? now : -1);
+            int64_t boundary = session.handoff(CAPTURE_WAKE);
+            if (boundary != expected) {
+                ++asr.badBoundaries;
+            }
+            ++asr.handoffs;
+            // 下一次建立连接之前的空闲（0到400毫秒录音的时间）
+            double idleSeconds = (random.next() % 400) / 1000. / options.speed;
+            std::this_thread::sleep_for(std::chrono::duration<double>(idleSeconds));
+        }
+    });
+
+    producer.join();
+    wakeThread.join();
+    asrThread.join();
+
+    Run result = {};
+    result.samples = total;
+    result.stats = session.stats();
+    result.wakeLatencyUs = wakeLatencyUs;
+    result.wakeHandoffs = wake.handoffs;
+    result.asrHandoffs = asr.handoffs;
+
+    std::vector<Segment> segments = wake.segments;
+    segments.insert(segments.end(), asr.segments.begin(), asr.segments.end());
+    std::sort(segments.begin(), segments.end(),
+              [](const Segment &a, const Segment &b) { return a.position < b.position; });
+    int64_t covered = 0;
+    size_t gaps = 0;
+    for (const Segment &segment : segments) {
+        if (segment.position != covered) {
+            ++gaps;
+        }
+        covered = segment.position + (int64_t) segment.count;
+    }
+    result.ok = wake.ended && asr.ended && gaps == 0 && covered == (int64_t) total
+            && wake.mismatches + asr.mismatches == 0
+            && wake.badBoundaries + asr.badBoundaries == 0 && result.stats.dropped == 0
+            && result.stats.samplesOut[CAPTURE_WAKE] + result.stats.samplesOut[CAPTURE_ASR]
+               == total;
+    if (!result.ok) {
+        fprintf(stderr, "ended %d/%d, %zu gaps or overlaps, covered %lld of %llu, "
+                        "%zu mismatched samples, %zu bad boundaries, %llu dropped\n",
+                wake.ended, asr.ended, gaps, (long long) covered, (unsigned long long) total,
+                wake.mismatches + asr.mismatches, wake.badBoundaries + asr.badBoundaries,
+                (unsigned long long) result.stats.dropped);
+    }
+    return result;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+            options.speed = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查输出是否正确（ctest），时间没有参考价值
+            options.seconds = 30;
+        } else {
+            fprintf(stderr, "Usage: %s [--seconds N] [--speed X] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.seconds > 0 && options.speed > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    Run result = run(options);
+    printf("%.0f s of audio at %.0fx: %zu wake->asr and %zu asr->wake handoffs, "
+           "%llu + %llu samples read, %llu dropped, %zu signalled wakeups, %s\n",
+           options.seconds, options.speed, result.wakeHandoffs, result.asrHandoffs,
+           (unsigned long long) result.stats.samplesOut[CAPTURE_WAKE],
+           (unsigned long long) result.stats.samplesOut[CAPTURE_ASR],
+           (unsigned long long) result.stats.dropped, result.stats.wakeups,
+           result.ok ? "every sample delivered exactly once" : "MISMATCH");
+    printf("wake detector resumed after handback: p50 %.0f us, p99 %.0f us, max %.0f us\n",
+           percentile(result.wakeLatencyUs, .5), percentile(result.wakeLatencyUs, .99),
+           percentile(result.wakeLatencyUs, 1));
+    if (!result.ok) {
+        fprintf(stderr, "samples were lost or duplicated across handoffs\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+#ifndef DICIO_BENCHMARK_COMPILED_GRAMMAR_BUILDER_H
+#define DICIO_BENCHMARK_COMPILED_GRAMMAR_BUILDER_H
+
+#include <string>
+#include <vector>
+
+#include "matcher/grammar.h"
+
+namespace benchmark {
+
+/**
+ * Construct树的主机端描述，只用于在没有JVM的情况下构造基准测试的语法
+ */
+struct Construct {
+    matcher::NodeType type;
+    std::string text; // WORD的词或正则，CAPTURE的名称
+    bool isRegex;
+    bool isDiacriticsSensitive;
+    float weight;
+    std::vector<Construct> children;
+};
+
+inline Construct word(const char *text, bool isRegex, bool isDiacriticsSensitive, float weight) {
+    return Construct{matcher::NODE_WORD, text, isRegex, isDiacriticsSensitive, weight, {}};
+}
+
+inline Construct orList(std::vector<Construct> children) {
+    return Construct{matcher::NODE_OR, "", false, false, 0.0f, std::move(children)};
+}
+
+inline Construct composite(std::vector<Construct> children) {
+    return Construct{matcher::NODE_COMPOSITE, "", false, false, 0.0f, std::move(children)};
+}
+
+inline Construct optional() {
+    return Construct{matcher::NODE_OPTIONAL, "", false, false, 0.0f, {}};
+}
+
+inline Construct capture(const char *name, float weight) {
+    return Construct{matcher::NODE_CAPTURE, name, false, false, weight, {}};
+}
+
+// 一个StandardRecognizerData的所有句子（句子ID不影响评分）
+struct SkillData {
+    std::vector<Construct> sentences;
+};
+
+/**
+ * 与Kotlin端 CompiledGrammarBuilder 产生完全相同的编码
+ */
+class CompiledGrammarBuilder {
+public:
+    void addSkill(const SkillData &skill) {
+        skillSentenceCounts_.push_back((int32_t) skill.sentences.size());
+        for (const Construct &sentence : skill.sentences) {
+            sentenceRoots_.push_back((int32_t) nodes_.size());
+            add(sentence);
+        }
+    }
+
+    // 调用方负责delete，编码无效时返回nullptr
+    matcher::Grammar *build() const {
+        return matcher::Grammar::parse(nodes_.data(), nodes_.size(),
+                                       weights_.data(), weights_.size(), strings_,
+                                       sentenceRoots_.data(), sentenceRoots_.size(),
+                                       skillSentenceCounts_.data(), skillSentenceCounts_.size());
+    }
+
+private:
+    void add(const Construct &construct) {
+        nodes_.push_back(construct.type);
+        switch (construct.type) {
+            case matcher::NODE_WORD:
+                nodes_.push_back((construct.isRegex ? matcher::WORD_FLAG_REGEX : 0)
+                        | (construct.isDiacriticsSensitive
+                                ? matcher::WORD_FLAG_DIACRITICS_SENSITIVE : 0));
+                nodes_.push_back(stringIndex(construct.text));
+                nodes_.push_back(weightIndex(construct.weight));
+                break;
+            case matcher::NODE_OR:
+            case matcher::NODE_COMPOSITE:
+                nodes_.push_back((int32_t) construct.children.size());
+                for (const Construct &child : construct.children) {
+                    add(child);
+                }
+                break;
+            case matcher::NODE_CAPTURE:
+                nodes_.push_back(stringIndex(construct.text));
+                nodes_.push_back(weightIndex(construct.weight));
+                break;
+            case matcher::NODE_OPTIONAL:
+            default:
+                break;
+        }
+    }
+
+    int32_t stringIndex(const std::string &string) {
+        for (size_t i = 0; i < strings_.size(); ++i) {
+            if (strings_[i] == string) {
+                return (int32_t) i;
+            }
+        }
+        strings_.push_back(string);
+        return (int32_t) strings_.size() - 1;
+    }
+
+    int32_t weightIndex(float weight) {
+        for (size_t i = 0; i < weights_.size(); ++i) {
+            if (weights_[i] == weight) {
+                return (int32_t) i;
+            }
+        }
+        weights_.push_back(weight);
+        return (int32_t) weights_.size() - 1;
+    }
+
+    std::vector<int32_t> nodes_;
+    std::vector<float> weights_;
+    std::vector<std::string> strings_;
+    std::vector<int32_t> sentenceRoots_;
+    std::vector<int32_t> skillSentenceCounts_;
+};
+
+} // namespace benchmark
+
+#endif // DICIO_BENCHMARK_COMPILED_GRAMMAR_BUILDER_H
@@ -0,0 +1,220 @@
+/*
+ * Opus整帧拼接器（audio/opus_frame_assembler.h）的主机端基准测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/audio_build && cmake --build /tmp/audio_build
+ *   /tmp/audio_build/frame_assembler_benchmark [--seconds N] [--quick]
+ *
+ * 模拟WebSocketInputDevice的录音循环：AudioRecord.read每次返回的样本数不固定（这里在
+ * 1到3000之间随机，并混入常见的640、1280、1924），把这些块送入拼接器，检查：
+ *   - 输出的数据包与用另一个编码器按整帧顺序编码的结果逐字节相同（单声道和立体声，
+ *     各种合法帧长）；
+ *   - 输出空间很小（每次只能放一个包）时，整帧留在内部、后面的调用补上，结果仍然相同；
+ *   - 结束时内部余下的样本不足一帧。
+ * 同时统计旧的做法（只有恰好一帧的块才能编码，其余的丢弃或退回PCM）会丢掉多少音频，
+ * 以及每次push的平均耗时。
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <opus.h>
+
+#include "audio/opus_frame_assembler.h"
+
+using namespace audio;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr int32_t SAMPLE_RATE = 16000;
+constexpr int MAX_PACKET = 4000;
+
+struct Options {
+    double seconds = 600;
+};
+
+uint32_t randomState = 1;
+
+uint32_t nextRandom() {
+    randomState = randomState * 1664525u + 1013904223u;
+    return randomState >> 8;
+}
+
+std::vector<int16_t> generateSpeech(double seconds, int channels) {
+    size_t frames = (size_t) (seconds * SAMPLE_RATE);
+    std::vector<int16_t> pcm(frames * channels);
+    double phase = 0;
+    for (size_t i = 0; i < frames; ++i) {
+        double t = (double) i / SAMPLE_RATE;
+        double f0 = 120 + 30 * sin(2 * M_PI * t / 1.7);
+        double envelope = fmod(t, 3) < 2.2 ? fabs(sin(2 * M_PI * t * 2.5)) : 0;
+        phase += 2 * M_PI * f0 / SAMPLE_RATE;
+        double value = 0;
+        for (int h = 1; h <= 10; ++h) {
+            value += sin(h * phase) / h;
+        }
+        value = .25 * envelope * value + .002 * ((double) (nextRandom() & 0xffff) / 65536 - .5);
+        for (int c = 0; c < channels; ++c) {
+            pcm[i * channels + c] = (int16_t) lrint(32767 * (c == 0 ? value : .7 * value));
+        }
+    }
+    return pcm;
+}
+
+// 与opus_jni.cpp的createEncoder相同的设置
+OpusEncoder *createEncoder(int channels) {
+    int error;
+    OpusEncoder *encoder = opus_encoder_create(SAMPLE_RATE, channels, OPUS_APPLICATION_VOIP,
+                                               &error);
+    if (encoder == nullptr) {
+        fprintf(stderr, "opus_encoder_create failed: %d\n", error);
+        exit(1);
+    }
+    opus_encoder_ctl(encoder, OPUS_SET_VBR(0));
+    opus_encoder_ctl(encoder, OPUS_SET_BITRATE(32000));
+    opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(8));
+    opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+    return encoder;
+}
+
+std::vector<std::vector<uint8_t>> encodeFrames(const std::vector<int16_t> &pcm, int channels,
+                                               int frameSize) {
+    OpusEncoder *encoder = createEncoder(channels);
+    std::vector<std::vector<uint8_t>> packets;
+    uint8_t packet[MAX_PACKET];
+    size_t frameSamples = (size_t) frameSize * channels;
+    for (size_t pos = 0; pos + frameSamples <= pcm.size(); pos += frameSamples) {
+        int bytes = opus_encode(encoder, &pcm[pos], frameSize, packet, MAX_PACKET);
+        if (bytes < 0) {
+            fprintf(stderr, "opus_encode failed: %d\n", bytes);
+            exit(1);
+        }
+        packets.emplace_back(packet, packet + bytes);
+    }
+    opus_encoder_destroy(encoder);
+    return packets;
+}
+
+size_t nextChunk() {
+    static const size_t common[] = {640, 1280, 1924};
+    uint32_t r = nextRandom();
+    return r % 4 == 0 ? common[(r >> 2) % 3] : 1 + (r >> 4) % 3000;
+}
+
+struct AssembleResult {
+    bool identical;
+    size_t calls;
+    size_t packets;
+    size_t leftover;
+    size_t oldPathDropped; // 旧的做法丢掉的样本
+    double seconds;
+};
+
+AssembleResult assemble(const std::vector<int16_t> &pcm, int channels, int frameSize,
+                        size_t maxPackets, const std::vector<std::vector<uint8_t>> &reference) {
+    AssembleResult result = {};
+    OpusEncoder *encoder = createEncoder(channels);
+    OpusFrameAssembler assembler(encoder, channels, frameSize);
+    std::vector<uint8_t> out(maxPackets * MAX_PACKET);
+    std::vector<int32_t> sizes(maxPackets);
+    std::vector<std::vector<uint8_t>> packets;
+    double seconds = 0;
+    size_t pos = 0;
+    randomState = 7;
+    while (pos < pcm.size()) {
+        size_t chunk = std::min(nextChunk() * channels, pcm.size() - pos);
+        if (chunk != assembler.frameSamples()) {
+            result.oldPathDropped += chunk;
+        }
+        Clock::time_point start = Clock::now();
+        int count = assembler.push(&pcm[pos], chunk, out.data(), out.size(), sizes.data(),
+                                   sizes.size());
+        seconds += std::chrono::duration<double>(Clock::now() - start).count();
+        ++result.calls;
+        if (count < 0) {
+            fprintf(stderr, "push failed: %d\n", count);
+            exit(1);
+        }
+        size_t offset = 0;
+        for (int i = 0; i < count; ++i) {
+            packets.emplace_back(&out[offset], &out[offset] + sizes[i]);
+            offset += sizes[i];
+        }
+        pos += chunk;
+    }
+    // 输出空间不够时留在内部的整帧，用空输入取出
+    for (;;) {
+        int count = assembler.push(nullptr, 0, out.data(), out.size(), sizes.data(),
+                                   sizes.size());
+        if (count <= 0) {
+            break;
+        }
+        size_t offset = 0;
+        for (int i = 0; i < count; ++i) {
+            packets.emplace_back(&out[offset], &out[offset] + sizes[i]);
+            offset += sizes[i];
+        }
+    }
+    opus_encoder_destroy(encoder);
+    result.identical = packets == reference;
+    result.packets = packets.size();
+    result.leftover = assembler.pendingSamples();
+    result.seconds = seconds;
+    return result;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查输出是否正确（ctest），时间没有参考价值
+            options.seconds = 20;
+        } else {
+            fprintf(stderr, "Usage: %s [--seconds N] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.seconds > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    bool ok = true;
+    for (int channels = 1; channels <= 2; ++channels) {
+        std::vector<int16_t> pcm = generateSpeech(options.seconds, channels);
+        // OpusAudioCodec在16kHz下支持的帧长（10、20、40、60毫秒）
+        for (int frameSize : {160, 320, 640, 960}) {
+            std::vector<std::vector<uint8_t>> reference = encodeFrames(pcm, channels, frameSize);
+            for (size_t maxPackets : {(size_t) 16, (size_t) 1}) {
+                AssembleResult result = assemble(pcm, channels, frameSize, maxPackets,
+                                                 reference);
+                printf("%d ch, %3d-sample frames, room for %2zu packets: %6zu calls -> %6zu "
+                       "packets, %.2f us per call, %zu samples left over, %s; "
+                       "exact-frame-only path would drop %.1f%% of the audio\n",
+                       channels, frameSize, maxPackets, result.calls, result.packets,
+                       1e6 * result.seconds / result.calls, result.leftover,
+                       result.identical ? "identical to frame-by-frame encoding" : "MISMATCH",
+                       100. * result.oldPathDropped / pcm.size());
+                if (!result.identical || result.leftover >= (size_t) frameSize * channels) {
+                    ok = false;
+                }
+            }
+        }
+    }
+    if (!ok) {
+        fprintf(stderr, "assembled packets differ from frame-by-frame encoding\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,301 @@
+/*
+ * 原生技能匹配器的主机端基准测试，对应 skill/src/test/java/org/dicio/skill/BenchmarkRunner.kt
+ * 和 standard/PerformanceTest.kt：同样的语法、同样的输入、同样的JSON格式，
+ * 所以结果可以和JVM的结果一起用 skill/plot_benchmarks.py 画出来。
+ *
+ * 用法（在skill目录中运行，结果写入 benchmarks/999_native/）：
+ *   cmake -S ../app/src/main/cpp -B /tmp/matcher_build && cmake --build /tmp/matcher_build
+ *   /tmp/matcher_build/matcher_benchmark [--threads N] [--quick] [输出目录]
+ *
+ * 评分函数与StandardRecognizerData.score的工作量相同：分词、为技能的每个句子打分、选出最佳句子。
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <sys/stat.h>
+#include <utility>
+#include <vector>
+
+#include "compiled_grammar_builder.h"
+#include "matcher/batch_scorer.h"
+#include "matcher/match_input.h"
+#include "matcher/tokenizer.h"
+#include "matcher/work_stealing_pool.h"
+#include "performance_data.h"
+
+using namespace matcher;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    std::string outputDir = "benchmarks/999_native";
+    size_t threads = 0;
+    // 增量测试在单次评分超过这个时间后停止，与BenchmarkRunner的maxDuration一致
+    double maxIncrementalSeconds = 1.0;
+    // 每个输入重复评分的时间，与BenchmarkRunner.getBenchmarkTime一致
+    double benchmarkSeconds = 2.0;
+    // 原生实现比JVM快得多，不限制的话增量测试的输入会大到耗尽内存
+    size_t maxIncrementalSize = 2000000;
+};
+
+class NativeScorer {
+public:
+    NativeScorer(const benchmark::SkillData &data, size_t threads)
+            : pool_(threads), scorer_(pool_) {
+        benchmark::CompiledGrammarBuilder builder;
+        builder.addSkill(data);
+        grammar_.reset(builder.build());
+    }
+
+    bool valid() const { return grammar_ != nullptr; }
+
+    void score(const std::u16string &input) {
+        Tokenizer::tokenize(input.data(), (int32_t) input.size(), &Vocabulary::instance(),
+                            tokens_);
+        MatchInput matchInput(tokens_);
+        scorer_.scoreAll(*grammar_, matchInput, results_);
+    }
+
+private:
+    WorkStealingPool pool_;
+    BatchScorer scorer_;
+    std::unique_ptr<Grammar> grammar_;
+    Tokenization tokens_;
+    std::vector<SkillResult> results_;
+};
+
+int64_t nanosSince(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+int64_t measure(NativeScorer &scorer, const std::u16string &input) {
+    const Clock::time_point start = Clock::now();
+    scorer.score(input);
+    return nanosSince(start);
+}
+
+std::u16string toUtf16(const char *ascii) {
+    return std::u16string(ascii, ascii + strlen(ascii));
+}
+
+std::string jsonString(const char *value) {
+    std::string result = "\"";
+    for (const char *c = value; *c; ++c) {
+        if (*c == '\\' || *c == '"') {
+            result += '\\';
+        }
+        result += *c;
+    }
+    return result + "\"";
+}
+
+class BenchmarkRunner {
+public:
+    BenchmarkRunner(const char *name, const benchmark::SkillData &data, const Options &options)
+            : name_(name), scorer_(data, options.threads), options_(options) {
+    }
+
+    bool valid() const { return scorer_.valid(); }
+
+    void warmup(const std::vector<const char *> &inputs) {
+        for (const char *input : inputs) {
+            scorer_.score(toUtf16(input));
+        }
+    }
+
+    void runBenchmarks(const std::vector<const char *> &inputs) {
+        for (const char *input : inputs) {
+            const std::u16string utf16 = toUtf16(input);
+            const Clock::time_point start = Clock::now();
+            const int64_t duration = (int64_t) (options_.benchmarkSeconds * 1e9);
+            int64_t times = 0;
+            while (nanosSince(start) < duration) {
+                scorer_.score(utf16);
+                times += 1;
+            }
+            const int64_t time = nanosSince(start) / times;
+            printf("[%s] [%s] %lldns\n", name_, input, (long long) time);
+            benchmarks_.push_back("{\"input\": " + jsonString(input)
+                    + ", \"time\": " + std::to_string(time) + "}");
+        }
+    }
+
+    // 与BenchmarkRunner.runIncrementalBenchmarks的步长策略完全相同
+    void runIncrementalBenchmarks() {
+        const int64_t maxDuration = (int64_t) (options_.maxIncrementalSeconds * 1e9);
+        const size_t wantedPoints = 20;
+        std::vector<std::pair<size_t, int64_t>> results;
+        std::u16string input;
+        results.emplace_back(0, measure(scorer_, input));
+
+        size_t skipUntilSize = 1;
+        float maxIncrement = 1.0f;
+        while (results.back().second < maxDuration
+                && input.size() < options_.maxIncrementalSize) {
+            input.push_back(input.size() % 4 == 3 ? u' ' : u'a');
+            if (input.size() >= skipUntilSize) {
+                const size_t currSize = input.size();
+                const int64_t currTime = measure(scorer_, input);
+                results.emplace_back(currSize, currTime);
+
+                const float dx = (float) currSize;
+                const float dy = (float) currTime * 1e-9f;
+                const float remaining = (float) (maxDuration - currTime) * 1e-9f;
+                const float rawIncrement = dx / dy * remaining
+                        / (float) std::max<long>(1, (long) wantedPoints - (long) results.size());
+                skipUntilSize += (size_t) std::max(1.0f, std::min(maxIncrement, rawIncrement));
+                maxIncrement *= 10.0f;
+            }
+        }
+
+        incremental_ = "[";
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (i > 0) {
+                incremental_ += ", ";
+            }
+            incremental_ += "{\"size\": " + std::to_string(results[i].first)
+                    + ", \"time\": " + std::to_string(results[i].second) + "}";
+        }
+        incremental_ += "]";
+        printf("[%s] [INCREMENTAL] %zu points, up to %zu characters\n",
+               name_, results.size(), results.back().first);
+    }
+
+    bool saveJson() const {
+        mkdir(options_.outputDir.c_str(), 0755);
+        const std::string path = options_.outputDir + "/" + name_ + ".json";
+        FILE *file = fopen(path.c_str(), "w");
+        if (file == nullptr) {
+            fprintf(stderr, "Could not write %s\n", path.c_str());
+            return false;
+        }
+        fprintf(file, "{\"incremental\": %s, \"benchmarks\": [", incremental_.c_str());
+        for (size_t i = 0; i < benchmarks_.size(); ++i) {
+            fprintf(file, "%s%s", i > 0 ? ", " : "", benchmarks_[i].c_str());
+        }
+        fprintf(file, "]}");
+        fclose(file);
+        return true;
+    }
+
+private:
+    const char *name_;
+    NativeScorer scorer_;
+    const Options &options_;
+    std::string incremental_ = "[]";
+    std::vector<std::string> benchmarks_;
+};
+
+// 与java.util.regex可能不一致或者无法编译的正则应该让整个语法编译失败（由JVM匹配器处理）
+bool checkRegexPatterns() {
+    const std::vector<std::pair<const char *, bool>> patterns = {
+            {"time(?:r|rs|)", true}, {"caf(?:é|e)s?", true}, {"a\\.b", true},
+            {"wor(", false}, {"a)", false}, {"caf.", false}, {"[a-z]+", false},
+            {"\\w+", false}, {"é+", false}, {"(?=a)a", false}};
+    bool ok = true;
+    for (const auto &pattern : patterns) {
+        benchmark::CompiledGrammarBuilder builder;
+        builder.addSkill({{benchmark::composite({benchmark::word(pattern.first, true, false,
+                                                                 1.0f)})}});
+        std::unique_ptr<Grammar> grammar(builder.build());
+        if ((grammar != nullptr) != pattern.second) {
+            fprintf(stderr, "Regex %s was %s\n", pattern.first,
+                    grammar != nullptr ? "accepted" : "rejected");
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// 先创建输入再编译语法：语法里的正则和词都不在输入创建时的词表里
+bool checkGrammarAfterInput() {
+    const std::u16string text = toUtf16("snoozing the grumbleberry alarm");
+    Tokenization tokens;
+    Tokenizer::tokenize(text.data(), (int32_t) text.size(), &Vocabulary::instance(), tokens);
+    MatchInput input(tokens);
+
+    benchmark::CompiledGrammarBuilder builder;
+    builder.addSkill({{benchmark::composite({benchmark::word("snooz(?:e|ed|ing)", true, false,
+                                                             1.0f)})}});
+    builder.addSkill({{benchmark::composite({benchmark::word("grumbleberry", false, false,
+                                                             1.0f)})}});
+    std::unique_ptr<Grammar> grammar(builder.build());
+    if (grammar == nullptr) {
+        fprintf(stderr, "Could not compile the late grammar\n");
+        return false;
+    }
+
+    WorkStealingPool pool(1);
+    BatchScorer scorer(pool);
+    std::vector<SkillResult> results;
+    scorer.scoreAll(*grammar, input, results);
+    bool ok = true;
+    for (size_t skill = 0; skill < results.size(); ++skill) {
+        if (!(results[skill].score.userMatched > 0.0f)) {
+            fprintf(stderr, "Late grammar skill %zu did not match the input\n", skill);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.threads = (size_t) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查基准测试能否正常运行（ctest），结果没有参考价值
+            options.maxIncrementalSeconds = 0.01;
+            options.benchmarkSeconds = 0.01;
+            options.maxIncrementalSize = 10000;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Usage: %s [--threads N] [--quick] [outputDir]\n", argv[0]);
+            return false;
+        } else {
+            options.outputDir = argv[i];
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    if (!checkGrammarAfterInput() || !checkRegexPatterns()) {
+        return 1;
+    }
+
+    BenchmarkRunner currentTime("current_time", benchmark::currentTimeData(), options);
+    BenchmarkRunner weather("weather", benchmark::weatherData(), options);
+    BenchmarkRunner timer("timer", benchmark::timerData(), options);
+    if (!currentTime.valid() || !weather.valid() || !timer.valid()) {
+        fprintf(stderr, "Could not compile the benchmark grammars\n");
+        return 1;
+    }
+
+    currentTime.warmup({"test", "time", "what time", "current time"});
+    currentTime.runBenchmarks({"time", "what time is it?", "what's the time",
+                               "hey I would like to know what time it is"});
+    currentTime.runIncrementalBenchmarks();
+
+    weather.warmup({"test", "weather", "cold", "weather in rome"});
+    weather.runBenchmarks({"weather", "what's the weather", "is it cold in budapest",
+                           "what is the weather in rome"});
+    weather.runIncrementalBenchmarks();
+
+    timer.warmup({"test", "timer", "timer 1s", "named a"});
+    timer.runBenchmarks({"set a timer", "set a timer of 5s", "set a timer named a"});
+    timer.runIncrementalBenchmarks();
+
+    return currentTime.saveJson() && weather.saveJson() && timer.saveJson() ? 0 : 1;
+}
@@ -0,0 +1,347 @@
+/*
+ * 并行离线Opus编码器（audio/offline_opus_encoder.h）的主机端基准测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/audio_build && cmake --build /tmp/audio_build
+ *   /tmp/audio_build/offline_encoder_benchmark [--seconds N] [--rate Hz] [--quick]
+ *
+ * 输入是合成的语音：谐波滑音加音节包络，句子之间有长短不一的停顿，还有一段没有停顿的长句，
+ * 全程叠加微弱的背景噪声。先用一个OpusEncoder顺序编码作为基准，再用不同的线程数并行编码，
+ * 检查：
+ *   - 各线程数的输出逐字节相同；
+ *   - Ogg页的CRC、序号、BOS/EOS标志和granule位置正确；
+ *   - 解码后去掉pre-skip、按最后的granule裁剪，长度与输入相同；
+ *   - 解码结果的信噪比与顺序编码相差不超过1dB（段边界没有引入可见的误差）。
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <opus.h>
+
+#include "audio/offline_opus_encoder.h"
+#include "audio/ogg_opus_writer.h"
+
+using namespace audio;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    double seconds = 600;
+    int32_t sampleRate = 16000;
+    size_t maxThreads = 0;
+};
+
+uint32_t randomState = 1;
+
+uint32_t nextRandom() {
+    randomState = randomState * 1664525u + 1013904223u;
+    return randomState >> 8;
+}
+
+double uniform(double low, double high) {
+    return low + (high - low) * (nextRandom() & 0xffff) / 65535.0;
+}
+
+std::vector<int16_t> generateSpeech(double seconds, int32_t sampleRate) {
+    size_t total = (size_t) (seconds * sampleRate);
+    std::vector<int16_t> pcm(total);
+    double phase = 0;
+    size_t pos = 0;
+    int utterance = 0;
+    while (pos < total) {
+        // 每八句中有一句长达25秒、没有停顿，迫使编码器在活动度最低处强制切分
+        double speechSeconds = utterance % 8 == 7 ? 25 : uniform(1, 5);
+        size_t speechEnd = std::min(total, pos + (size_t) (speechSeconds * sampleRate));
+        size_t pauseEnd = std::min(total, speechEnd + (size_t) (uniform(.25, 1.2) * sampleRate));
+        double f0Base = uniform(90, 220);
+        for (; pos < pauseEnd; ++pos) {
+            double t = (double) pos / sampleRate;
+            double v = 0;
+            if (pos < speechEnd) {
+                double f0 = f0Base * (1 + .2 * sin(2 * M_PI * t * .7));
+                double env = .2 + .8 * fabs(sin(2 * M_PI * t * 2.1));
+                phase += 2 * M_PI * f0 / sampleRate;
+                for (int h = 1; h <= 10 && h * f0 < sampleRate / 2; ++h) {
+                    v += sin(h * phase) / h;
+                }
+                v *= .15 * env;
+            }
+            v += .002 * uniform(-1, 1);
+            pcm[pos] = (int16_t) lrint(32767 * v);
+        }
+        ++utterance;
+    }
+    return pcm;
+}
+
+struct DecodedStream {
+    bool valid = false;
+    std::vector<int16_t> pcm;
+    size_t pages = 0;
+};
+
+uint32_t readLe32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+/**
+ * 解析并解码encodeOggOpus的输出，任何结构错误都返回valid=false
+ */
+DecodedStream decodeOgg(const std::vector<uint8_t> &ogg, int32_t sampleRate, int channels,
+                        uint32_t serial) {
+    DecodedStream result;
+    size_t pos = 0;
+    uint32_t sequence = 0;
+    int64_t lastGranule = 0;
+    bool eos = false;
+    int preSkip = 0;
+    int error;
+    OpusDecoder *decoder = opus_decoder_create(sampleRate, channels, &error);
+    std::vector<int16_t> frame(5760 * channels);
+    int64_t scale = 48000 / sampleRate;
+    int64_t decodedGranule = 0;
+
+    while (pos < ogg.size()) {
+        if (ogg.size() - pos < 27 || memcmp(&ogg[pos], "OggS", 4) != 0 || ogg[pos + 4] != 0
+            || eos) {
+            fprintf(stderr, "bad page header at %zu\n", pos);
+            return result;
+        }
+        const uint8_t *page = &ogg[pos];
+        uint8_t flags = page[5];
+        int64_t granule = (int64_t) readLe32(page + 6) | ((int64_t) readLe32(page + 10) << 32);
+        size_t segments = page[26];
+        size_t bodySize = 0;
+        for (size_t i = 0; i < segments; ++i) {
+            bodySize += page[27 + i];
+        }
+        size_t pageSize = 27 + segments + bodySize;
+        std::vector<uint8_t> copy(page, page + pageSize);
+        memset(&copy[22], 0, 4);
+        if (readLe32(page + 14) != serial || readLe32(page + 18) != sequence++
+            || readLe32(page + 22) != oggCrc32(copy.data(), copy.size())
+            || ((flags & 0x02) != 0) != (result.pages == 0)) {
+            fprintf(stderr, "bad serial, sequence, CRC or BOS on page %zu\n", result.pages);
+            return result;
+        }
+        eos = (flags & 0x04) != 0;
+
+        const uint8_t *body = page + 27 + segments;
+        size_t packetStart = 0, packetSize = 0;
+        for (size_t i = 0; i < segments; ++i) {
+            packetSize += page[27 + i];
+            if (page[27 + i] == 255) {
+                continue;
+            }
+            const uint8_t *packet = body + packetStart;
+            if (result.pages == 0) {
+                if (packetSize != 19 || memcmp(packet, "OpusHead", 8) != 0
+                    || packet[9] != channels) {
+                    return result;
+                }
+                preSkip = packet[10] | (packet[11] << 8);
+            } else if (result.pages == 1) {
+                if (memcmp(packet, "OpusTags", 8) != 0) {
+                    return result;
+                }
+            } else {
+                int samples = opus_decode(decoder, packet, (opus_int32) packetSize, frame.data(),
+                                          5760, 0);
+                if (samples < 0) {
+                    fprintf(stderr, "opus_decode failed: %d\n", samples);
+                    return result;
+                }
+                result.pcm.insert(result.pcm.end(), frame.begin(),
+                                  frame.begin() + samples * channels);
+                decodedGranule += samples * scale;
+            }
+            packetStart += packetSize;
+            packetSize = 0;
+        }
+        if (result.pages >= 2 && (granule < lastGranule
+                                  || (!eos && granule != decodedGranule)
+                                  || (eos && granule > decodedGranule))) {
+            fprintf(stderr, "bad granule position %lld on page %zu\n", (long long) granule,
+                    result.pages);
+            return result;
+        }
+        lastGranule = granule;
+        ++result.pages;
+        pos += pageSize;
+    }
+    opus_decoder_destroy(decoder);
+    if (!eos) {
+        return result;
+    }
+    // 去掉开头的pre-skip，按最后一页的granule裁掉末尾的填充
+    size_t begin = (size_t) (preSkip / scale) * channels;
+    size_t end = (size_t) (lastGranule / scale) * channels;
+    if (end > result.pcm.size() || begin > end) {
+        return result;
+    }
+    result.pcm = std::vector<int16_t>(result.pcm.begin() + begin, result.pcm.begin() + end);
+    result.valid = true;
+    return result;
+}
+
+double snr(const std::vector<int16_t> &reference, const std::vector<int16_t> &decoded) {
+    double signal = 0, noise = 0;
+    for (size_t i = 0; i < reference.size() && i < decoded.size(); ++i) {
+        double diff = (double) decoded[i] - reference[i];
+        signal += (double) reference[i] * reference[i];
+        noise += diff * diff;
+    }
+    return 10 * log10(signal / std::max(noise, 1.0));
+}
+
+/**
+ * 与encodeOggOpus相同的配置，一个编码器从头到尾顺序编码，只返回数据包
+ */
+bool encodeSequential(const std::vector<int16_t> &pcm, const OfflineEncodeOptions &options,
+                      std::vector<std::vector<uint8_t>> &packets, int *lookahead) {
+    int error;
+    OpusEncoder *encoder = opus_encoder_create(options.sampleRate, options.channels,
+                                               OPUS_APPLICATION_VOIP, &error);
+    if (encoder == nullptr) {
+        return false;
+    }
+    opus_encoder_ctl(encoder, OPUS_SET_BITRATE(options.bitrate));
+    opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(options.complexity));
+    opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+    opus_encoder_ctl(encoder, OPUS_SET_LSB_DEPTH(16));
+    opus_int32 delay;
+    opus_encoder_ctl(encoder, OPUS_GET_LOOKAHEAD(&delay));
+    *lookahead = delay;
+    size_t frameSize = (size_t) (options.sampleRate / 1000 * options.frameMs);
+    std::vector<int16_t> padded(pcm);
+    padded.resize((pcm.size() + delay + frameSize - 1) / frameSize * frameSize, 0);
+    uint8_t packet[4000];
+    for (size_t pos = 0; pos < padded.size(); pos += frameSize) {
+        int size = opus_encode(encoder, &padded[pos], (int) frameSize, packet, sizeof(packet));
+        if (size < 0) {
+            opus_encoder_destroy(encoder);
+            return false;
+        }
+        packets.emplace_back(packet, packet + size);
+    }
+    opus_encoder_destroy(encoder);
+    return true;
+}
+
+std::vector<int16_t> decodeSequential(const std::vector<std::vector<uint8_t>> &packets,
+                                      const OfflineEncodeOptions &options, int lookahead,
+                                      size_t length) {
+    int error;
+    OpusDecoder *decoder = opus_decoder_create(options.sampleRate, options.channels, &error);
+    std::vector<int16_t> pcm;
+    std::vector<int16_t> frame(5760);
+    for (const std::vector<uint8_t> &packet : packets) {
+        int samples = opus_decode(decoder, packet.data(), (opus_int32) packet.size(),
+                                  frame.data(), 5760, 0);
+        if (samples > 0) {
+            pcm.insert(pcm.end(), frame.begin(), frame.begin() + samples);
+        }
+    }
+    opus_decoder_destroy(decoder);
+    pcm.erase(pcm.begin(), pcm.begin() + lookahead);
+    pcm.resize(length);
+    return pcm;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+            options.sampleRate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.maxThreads = (size_t) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查编码结果是否正确（ctest），时间没有参考价值
+            options.seconds = 60;
+        } else {
+            fprintf(stderr, "Usage: %s [--seconds N] [--rate Hz] [--threads N] [--quick]\n",
+                    argv[0]);
+            return false;
+        }
+    }
+    return options.seconds > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    OfflineEncodeOptions encodeOptions;
+    encodeOptions.sampleRate = options.sampleRate;
+    std::vector<int16_t> pcm = generateSpeech(options.seconds, options.sampleRate);
+    printf("%.0f s of speech at %d Hz, %d b/s, complexity %d\n", options.seconds,
+           options.sampleRate, encodeOptions.bitrate, encodeOptions.complexity);
+
+    std::vector<std::vector<uint8_t>> sequentialPackets;
+    int lookahead;
+    Clock::time_point start = Clock::now();
+    if (!encodeSequential(pcm, encodeOptions, sequentialPackets, &lookahead)) {
+        fprintf(stderr, "sequential encoding failed\n");
+        return 1;
+    }
+    double sequentialSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    double sequentialSnr = snr(pcm, decodeSequential(sequentialPackets, encodeOptions, lookahead,
+                                                     pcm.size()));
+    printf("sequential: %7.3f s (%6.1fx realtime), SNR %.2f dB\n", sequentialSeconds,
+           options.seconds / sequentialSeconds, sequentialSnr);
+
+    size_t maxThreads = options.maxThreads != 0
+            ? options.maxThreads : std::max<size_t>(1, std::thread::hardware_concurrency());
+    std::vector<uint8_t> reference;
+    for (size_t threads = 1; threads <= maxThreads; threads = threads < maxThreads
+            ? std::min(threads * 2, maxThreads) : threads + 1) {
+        encodeOptions.threads = threads;
+        std::vector<uint8_t> ogg;
+        OfflineEncodeStats stats;
+        start = Clock::now();
+        int error = encodeOggOpus(pcm.data(), pcm.size(), encodeOptions, ogg, &stats);
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (error != OPUS_OK) {
+            fprintf(stderr, "encodeOggOpus failed: %d\n", error);
+            return 1;
+        }
+        printf("%2zu threads: %7.3f s (%6.1fx realtime, %4.2fx sequential), "
+               "VAD %.3f s, encode %.3f s, mux %.4f s\n",
+               threads, seconds, options.seconds / seconds, sequentialSeconds / seconds,
+               stats.vadSeconds, stats.encodeSeconds, stats.muxSeconds);
+        if (threads == 1) {
+            reference = ogg;
+            DecodedStream decoded = decodeOgg(ogg, encodeOptions.sampleRate,
+                                              encodeOptions.channels, encodeOptions.serial);
+            if (!decoded.valid || decoded.pcm.size() != pcm.size()) {
+                fprintf(stderr, "invalid Ogg Opus stream\n");
+                return 1;
+            }
+            double parallelSnr = snr(pcm, decoded.pcm);
+            printf("            %zu segments (%zu forced), %zu packets, %zu pre-roll frames, "
+                   "%zu pages, %zu bytes, SNR %.2f dB\n",
+                   stats.segments, stats.forcedSplits, stats.packets, stats.preRollFrames,
+                   decoded.pages, ogg.size(), parallelSnr);
+            if (stats.packets != sequentialPackets.size() || stats.segments < 2
+                || parallelSnr < sequentialSnr - 1) {
+                fprintf(stderr, "segmented stream differs too much from the sequential one\n");
+                return 1;
+            }
+        } else if (ogg != reference) {
+            fprintf(stderr, "output depends on the thread count\n");
+            return 1;
+        }
+    }
+    return 0;
+}
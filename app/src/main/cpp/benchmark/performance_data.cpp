@@ -0,0 +1,351 @@
+#include "performance_data.h"
+
+namespace benchmark {
+
+// current_time
+SkillData currentTimeData() {
+    return SkillData{{
+        composite({
+            orList({
+                word("what", false, false, 1.0f),
+                composite({
+                    word("what", false, false, 1.0f),
+                    orList({
+                        word("s", false, false, 1.0f),
+                        word("is", false, false, 1.0f),
+                    }),
+                }),
+                word("whats", false, false, 1.0f),
+            }),
+            orList({
+                word("the", false, false, 1.0f),
+                optional(),
+            }),
+            word("time", false, false, 1.0f),
+            orList({
+                composite({
+                    word("is", false, false, 1.0f),
+                    word("it", false, false, 1.0f),
+                }),
+                optional(),
+            }),
+        }),
+    }};
+}
+
+// weather
+SkillData weatherData() {
+    return SkillData{{
+        composite({
+            orList({
+                composite({
+                    word("what", false, false, 1.0f),
+                    orList({
+                        word("is", false, false, 1.0f),
+                        word("s", false, false, 1.0f),
+                    }),
+                }),
+                word("whats", false, false, 1.0f),
+            }),
+            word("the", false, false, 1.0f),
+            word("weather", false, false, 1.0f),
+            orList({
+                word("like", false, false, 1.0f),
+                optional(),
+            }),
+            orList({
+                composite({
+                    orList({
+                        word("in", false, false, 1.0f),
+                        word("on", false, false, 1.0f),
+                    }),
+                    capture("where", 1.0f),
+                }),
+                optional(),
+            }),
+        }),
+        composite({
+            word("weather", false, false, 1.0f),
+            orList({
+                composite({
+                    orList({
+                        word("in", false, false, 1.0f),
+                        word("on", false, false, 1.0f),
+                        optional(),
+                    }),
+                    capture("where", 1.0f),
+                }),
+                optional(),
+            }),
+        }),
+        composite({
+            word("how", false, false, 1.0f),
+            word("is", false, false, 1.0f),
+            word("it", false, false, 1.0f),
+            word("outside", false, false, 1.0f),
+        }),
+        composite({
+            word("is", false, false, 1.0f),
+            word("it", false, false, 1.0f),
+            orList({
+                word("cold", false, false, 1.0f),
+                word("cool", false, false, 1.0f),
+                word("warm", false, false, 1.0f),
+                word("hot", false, false, 1.0f),
+                word("sunny", false, false, 1.0f),
+                word("rainy", false, false, 1.0f),
+                word("raining", false, false, 1.0f),
+            }),
+            orList({
+                composite({
+                    orList({
+                        word("in", false, false, 1.0f),
+                        word("on", false, false, 1.0f),
+                    }),
+                    capture("where", 1.0f),
+                }),
+                word("outside", false, false, 1.0f),
+                optional(),
+            }),
+        }),
+    }};
+}
+
+// timer
+SkillData timerData() {
+    return SkillData{{
+        composite({
+            orList({
+                word("timer", false, false, 1.0f),
+                composite({
+                    word("ping", false, false, 1.0f),
+                    word("me", false, false, 1.0f),
+                    word("in", false, false, 1.0f),
+                }),
+            }),
+            capture("duration", 1.0f),
+        }),
+        composite({
+            orList({
+                composite({
+                    word("set", false, false, 1.0f),
+                    orList({
+                        word("up", false, false, 1.0f),
+                        optional(),
+                    }),
+                }),
+                word("setup", false, false, 1.0f),
+                word("start", false, false, 1.0f),
+                word("create", false, false, 1.0f),
+            }),
+            orList({
+                word("a", false, false, 1.0f),
+                optional(),
+            }),
+            orList({
+                composite({
+                    orList({
+                        capture("duration", 1.0f),
+                        optional(),
+                    }),
+                    word("timer", false, false, 1.0f),
+                }),
+                composite({
+                    word("timer", false, false, 1.0f),
+                    orList({
+                        word("for", false, false, 1.0f),
+                        word("of", false, false, 1.0f),
+                    }),
+                    capture("duration", 1.0f),
+                    orList({
+                        composite({
+                            orList({
+                                word("called", false, false, 1.0f),
+                                word("named", false, false, 1.0f),
+                                composite({
+                                    word("with", false, false, 1.0f),
+                                    word("the", false, false, 1.0f),
+                                    word("name", false, false, 1.0f),
+                                }),
+                            }),
+                            capture("name", 1.0f),
+                        }),
+                        optional(),
+                    }),
+                }),
+            }),
+        }),
+        composite({
+            orList({
+                word("cancel", false, false, 1.0f),
+                word("stop", false, false, 1.0f),
+                word("disable", false, false, 1.0f),
+                word("end", false, false, 1.0f),
+                word("terminate", false, false, 1.0f),
+            }),
+            orList({
+                word("the", false, false, 1.0f),
+                optional(),
+            }),
+            orList({
+                composite({
+                    orList({
+                        capture("name", 1.0f),
+                        optional(),
+                    }),
+                    word("time(?:r|rs|)", true, false, 1.0f),
+                }),
+                composite({
+                    word("time(?:r|rs|)", true, false, 1.0f),
+                    orList({
+                        word("called", false, false, 1.0f),
+                        word("named", false, false, 1.0f),
+                        composite({
+                            word("with", false, false, 1.0f),
+                            word("the", false, false, 1.0f),
+                            word("name", false, false, 1.0f),
+                        }),
+                    }),
+                    capture("name", 1.0f),
+                }),
+            }),
+        }),
+        composite({
+            orList({
+                word("silence", false, false, 1.0f),
+                composite({
+                    orList({
+                        word("shut", false, false, 1.0f),
+                        word("turn", false, false, 1.0f),
+                    }),
+                    word("off", false, false, 1.0f),
+                }),
+                word("quiet", false, false, 1.0f),
+                word("mute", false, false, 1.0f),
+            }),
+            orList({
+                word("the", false, false, 1.0f),
+                optional(),
+            }),
+            orList({
+                composite({
+                    orList({
+                        capture("name", 1.0f),
+                        optional(),
+                    }),
+                    orList({
+                        word("time(?:r|rs|)", true, false, 1.0f),
+                        word("bell", false, false, 1.0f),
+                        word("alert", false, false, 1.0f),
+                        word("sound", false, false, 1.0f),
+                        word("ringtone", false, false, 1.0f),
+                    }),
+                }),
+                composite({
+                    orList({
+                        word("time(?:r|rs|)", true, false, 1.0f),
+                        word("bell", false, false, 1.0f),
+                        word("alert", false, false, 1.0f),
+                        word("sound", false, false, 1.0f),
+                        word("ringtone", false, false, 1.0f),
+                    }),
+                    orList({
+                        word("called", false, false, 1.0f),
+                        word("named", false, false, 1.0f),
+                        composite({
+                            word("with", false, false, 1.0f),
+                            word("the", false, false, 1.0f),
+                            word("name", false, false, 1.0f),
+                        }),
+                    }),
+                    capture("name", 1.0f),
+                }),
+            }),
+        }),
+        composite({
+            word("how", false, false, 1.0f),
+            orList({
+                word("long", false, false, 1.0f),
+                composite({
+                    word("much", false, false, 1.0f),
+                    word("time", false, false, 1.0f),
+                }),
+            }),
+            word("is", false, false, 1.0f),
+            orList({
+                word("left", false, false, 1.0f),
+                optional(),
+            }),
+            word("on", false, false, 1.0f),
+            orList({
+                word("the", false, false, 1.0f),
+                optional(),
+            }),
+            orList({
+                composite({
+                    orList({
+                        capture("name", 1.0f),
+                        optional(),
+                    }),
+                    word("time(?:r|rs|)", true, false, 1.0f),
+                }),
+                composite({
+                    word("time(?:r|rs|)", true, false, 1.0f),
+                    orList({
+                        word("called", false, false, 1.0f),
+                        word("named", false, false, 1.0f),
+                        composite({
+                            word("with", false, false, 1.0f),
+                            word("the", false, false, 1.0f),
+                            word("name", false, false, 1.0f),
+                        }),
+                    }),
+                    capture("name", 1.0f),
+                }),
+            }),
+        }),
+        composite({
+            word("when", false, false, 1.0f),
+            orList({
+                word("will", false, false, 1.0f),
+                word("is", false, false, 1.0f),
+            }),
+            orList({
+                word("the", false, false, 1.0f),
+                optional(),
+            }),
+            orList({
+                composite({
+                    orList({
+                        capture("name", 1.0f),
+                        optional(),
+                    }),
+                    word("time(?:r|rs|)", true, false, 1.0f),
+                }),
+                composite({
+                    word("time(?:r|rs|)", true, false, 1.0f),
+                    orList({
+                        word("called", false, false, 1.0f),
+                        word("named", false, false, 1.0f),
+                        composite({
+                            word("with", false, false, 1.0f),
+                            word("the", false, false, 1.0f),
+                            word("name", false, false, 1.0f),
+                        }),
+                    }),
+                    capture("name", 1.0f),
+                }),
+            }),
+            orList({
+                composite({
+                    word("going", false, false, 1.0f),
+                    word("to", false, false, 1.0f),
+                }),
+                optional(),
+            }),
+            word("expire", false, false, 1.0f),
+        }),
+    }};
+}
+
+} // namespace benchmark
@@ -0,0 +1,15 @@
+#ifndef DICIO_BENCHMARK_PERFORMANCE_DATA_H
+#define DICIO_BENCHMARK_PERFORMANCE_DATA_H
+
+#include "compiled_grammar_builder.h"
+
+namespace benchmark {
+
+// 与 skill/src/test/java/org/dicio/skill/standard/PerformanceTest.kt 中的数据一致，修改时需要同步
+SkillData currentTimeData();
+SkillData weatherData();
+SkillData timerData();
+
+} // namespace benchmark
+
+#endif // DICIO_BENCHMARK_PERFORMANCE_DATA_H
@@ -0,0 +1,231 @@
+/*
+ * 二进制事件环（audio/trace_ring.h）的主机端测试和基准测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/audio_build && cmake --build /tmp/audio_build
+ *   /tmp/audio_build/trace_ring_benchmark [--events N] [--quick]
+ *
+ * 先检查：
+ *   - 环放得下全部事件时，多个线程并发写入之后drain出的事件不多不少、每个线程的顺序不变；
+ *   - 一边写一边drain、环很小时，drain出的加上lost正好是写入的总数，没有重复、没有乱序；
+ *   - registerTraceEvent拒绝%s等非整数的格式，formatTraceEvent和exportTraceJson的输出。
+ * 然后比较每个事件的开销：写入事件环（其中读时钟要多久），和热循环里原来的做法（拼一条
+ * 日志字符串，即使最后被丢弃）。
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "audio/trace_ring.h"
+
+using namespace audio;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr int32_t EVENT_TEST = TRACE_FIRST_APP_EVENT;
+
+struct Options {
+    size_t events = 20000000;
+    int writers = 4;
+};
+
+// 每个写入线程的事件：args[0]是线程号，args[1]是线程内的序号
+bool checkConcurrent(size_t capacity, size_t perWriter, int writers, bool drainWhileWriting) {
+    TraceRing ring(capacity);
+    std::atomic<int> running(writers);
+    std::vector<std::thread> threads;
+    for (int w = 0; w < writers; ++w) {
+        threads.emplace_back([&ring, &running, w, perWriter, drainWhileWriting] {
+            for (size_t i = 0; i < perWriter; ++i) {
+                ring.write(EVENT_TEST, w, (int32_t) i, ~(int32_t) i, w ^ (int32_t) i);
+                if (drainWhileWriting && i % 16 == 0) {
+                    std::this_thread::yield(); // 单核的机器上也让drain穿插进来
+                }
+            }
+            running.fetch_sub(1);
+        });
+    }
+    std::vector<TraceEvent> events;
+    if (drainWhileWriting) {
+        while (running.load() > 0) {
+            ring.drain(events, 256);
+        }
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    while (ring.drain(events, 4096) > 0) {
+    }
+
+    std::vector<int64_t> last(writers, -1);
+    size_t bad = 0;
+    for (const TraceEvent &event : events) {
+        int32_t w = event.args[0];
+        if (event.id != EVENT_TEST || w < 0 || w >= writers || event.args[2] != ~event.args[1]
+            || event.args[3] != (w ^ event.args[1]) || event.args[1] <= last[w]) {
+            ++bad;
+            continue;
+        }
+        last[w] = event.args[1];
+    }
+    uint64_t total = (uint64_t) perWriter * writers;
+    bool ok = bad == 0 && events.size() + ring.lost() == total
+              && (drainWhileWriting || ring.lost() == 0);
+    printf("%d writers x %zu events, ring %zu%s: %zu drained, %llu lost, %zu bad: %s\n", writers,
+           perWriter, ring.capacity(), drainWhileWriting ? ", draining concurrently" : "",
+           events.size(), (unsigned long long) ring.lost(), bad, ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+bool checkFormat() {
+    bool ok = !registerTraceEvent(EVENT_TEST, "Test", "bad", "", "%s")
+              && !registerTraceEvent(EVENT_TEST, "Test", "bad", "", "%f")
+              && !registerTraceEvent(EVENT_TEST, "Test", "bad", "", "%d %d %d %d %d")
+              && !registerTraceEvent(EVENT_TEST, "Test", "bad", "", "100%")
+              && !registerTraceEvent(TRACE_MAX_EVENTS, "Test", "bad", "", "")
+              && registerTraceEvent(EVENT_TEST, "Test", "frame", "frame,,bytes",
+                                    "Frame #%05d, %x, bytesRead=%d, 100%%")
+              && registerTraceEvent(EVENT_TEST + 1, "Test", "silent", "value", "");
+
+    TraceEvent event = {};
+    event.timeNanos = 12345678901;
+    event.id = EVENT_TEST;
+    event.tid = 42;
+    event.args[0] = 7;
+    event.args[1] = 255;
+    event.args[2] = 640;
+    std::string line;
+    bool formatted = formatTraceEvent(event, line);
+    const char *expected = "Test\t[12.345] Frame #00007, ff, bytesRead=640, 100%";
+    printf("formatted: %s\n", formatted ? line.c_str() : "(nothing)");
+    ok = ok && formatted && line == expected;
+
+    TraceEvent silent = event;
+    silent.id = EVENT_TEST + 1;
+    TraceEvent unknown = event;
+    unknown.id = EVENT_TEST + 2;
+    ok = ok && !formatTraceEvent(silent, line) && !formatTraceEvent(unknown, line);
+
+    char path[] = "/tmp/trace_ring_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return false;
+    }
+    close(fd);
+    ok = exportTraceJson({event, silent, unknown}, path) && ok;
+    FILE *file = fopen(path, "r");
+    std::string json;
+    char buffer[4096];
+    size_t n;
+    while (file != nullptr && (n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        json.append(buffer, n);
+    }
+    if (file != nullptr) {
+        fclose(file);
+    }
+    unlink(path);
+    bool exported = json.find("\"name\":\"frame\",\"cat\":\"Test\",\"ph\":\"i\"")
+                    != std::string::npos
+                    && json.find("\"ts\":12345678.901") != std::string::npos
+                    && json.find("\"args\":{\"frame\":7,\"bytes\":640}") != std::string::npos
+                    && json.find("\"name\":\"silent\"") != std::string::npos
+                    && json.find("\"name\":\"event_66\"") != std::string::npos
+                    && json.compare(json.size() - 4, 4, "\n]}\n") == 0;
+    printf("exported %zu bytes of JSON: %s\n", json.size(), exported ? "ok" : "MISMATCH");
+    return ok && exported;
+}
+
+double nanosPerEvent(Clock::time_point start, size_t events) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / events;
+}
+
+void measure(const Options &options) {
+    TraceRing ring(8192);
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < options.events; ++i) {
+        ring.write(EVENT_TEST, (int32_t) i, 640);
+    }
+    printf("trace ring, 1 thread:        %6.1f ns/event\n", nanosPerEvent(start, options.events));
+
+    std::vector<std::thread> threads;
+    size_t perWriter = options.events / options.writers;
+    start = Clock::now();
+    for (int w = 0; w < options.writers; ++w) {
+        threads.emplace_back([&ring, perWriter] {
+            for (size_t i = 0; i < perWriter; ++i) {
+                ring.write(EVENT_TEST, (int32_t) i, 640);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    printf("trace ring, %d threads:       %6.1f ns/event\n", options.writers,
+           nanosPerEvent(start, perWriter * options.writers));
+
+    // 时间戳占了大部分，虚拟机上clock_gettime可能不走vDSO
+    int64_t sum = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < options.events; ++i) {
+        sum += Clock::now().time_since_epoch().count() & 1;
+    }
+    printf("clock alone:                 %6.1f ns/event (%lld)\n",
+           nanosPerEvent(start, options.events), (long long) (sum & 1));
+
+    // 相当于Kotlin的"🔄 Frame #$frameCount, bytesRead=$bytesRead"：格式化之后整条丢弃
+    size_t formatted = options.events / 10;
+    size_t totalLength = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < formatted; ++i) {
+        std::string message = "🔄 Frame #" + std::to_string(i) + ", bytesRead="
+                              + std::to_string(640);
+        totalLength += message.size();
+    }
+    printf("string formatting:           %6.1f ns/event (%zu bytes)\n",
+           nanosPerEvent(start, formatted), totalLength);
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--events") == 0 && i + 1 < argc) {
+            options.events = (size_t) atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查是否正确（ctest），时间没有参考价值
+            options.events = 200000;
+        } else {
+            fprintf(stderr, "Usage: %s [--events N] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.events > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    size_t perWriter = std::max<size_t>(1, options.events / 100 / options.writers);
+    bool ok = checkConcurrent(perWriter * options.writers, perWriter, options.writers, false);
+    ok = checkConcurrent(64, perWriter, options.writers, true) && ok;
+    ok = checkFormat() && ok;
+    measure(options);
+    if (!ok) {
+        fprintf(stderr, "trace ring check failed\n");
+        return 1;
+    }
+    return 0;
+}
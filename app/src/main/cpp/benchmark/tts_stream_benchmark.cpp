@@ -0,0 +1,509 @@
+/*
+ * 流式Opus解码器（audio/opus_stream_decoder.h）的主机端基准测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/audio_build && cmake --build /tmp/audio_build
+ *   /tmp/audio_build/tts_stream_benchmark [--seconds N] [--link KB/s] [--quick]
+ *
+ * 在127.0.0.1上起一个代替云端TTS的HTTP服务器，把一句合成语音按限定的带宽、以大小随机的
+ * 块发出去。客户端像CloudTtsSpeechDevice一样发POST请求，边收响应体边交给解码器，另一个
+ * 线程模拟AudioTrack按实时速度播放。对比：
+ *   - 原来的做法：请求PCM，整个响应体下载完才开始播放；
+ *   - Ogg Opus和带长度前缀的裸Opus，边下载边播放。
+ * 检查：
+ *   - 流式解码的结果与直接用opus_decode逐包解码的结果逐样本相同（Ogg去掉pre-skip并按最后的
+ *     granule裁剪后与输入等长）；
+ *   - 服务器每次只发1个字节时结果仍然相同（页、包和长度前缀在任意位置被切开）；
+ *   - 播放开始后没有因为等数据而卡顿。
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opus.h>
+
+#include "audio/ogg_opus_writer.h"
+#include "audio/opus_stream_decoder.h"
+
+using namespace audio;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// 与CloudTtsSpeechDevice一致
+constexpr int32_t SAMPLE_RATE = 24000;
+constexpr int FRAME_SIZE = SAMPLE_RATE / 50; // 20ms
+constexpr int RING_MS = 500;
+// 模拟的AudioTrack缓冲区
+constexpr int TRACK_BUFFER_MS = 100;
+// 缓冲区里有这么多样本才开始播放，吸收网络抖动（与CloudTtsSpeechDevice一致）
+constexpr int PREBUFFER_MS = 60;
+
+struct Options {
+    double seconds = 8;
+    double linkKBps = 24; // 约200kbps，信号较差的移动网络
+};
+
+uint32_t randomState = 1;
+
+uint32_t nextRandom() {
+    randomState = randomState * 1664525u + 1013904223u;
+    return randomState >> 8;
+}
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<int16_t> generateSpeech(double seconds) {
+    size_t total = (size_t) (seconds * SAMPLE_RATE);
+    std::vector<int16_t> pcm(total);
+    double phase = 0;
+    for (size_t i = 0; i < total; ++i) {
+        double t = (double) i / SAMPLE_RATE;
+        double f0 = 170 + 40 * sin(2 * M_PI * t / 2.3);
+        double envelope = .2 + .8 * fabs(sin(2 * M_PI * t * 2.1));
+        phase += 2 * M_PI * f0 / SAMPLE_RATE;
+        double value = 0;
+        for (int h = 1; h <= 12; ++h) {
+            value += sin(h * phase) / h;
+        }
+        value = .25 * envelope * value + .002 * ((double) (nextRandom() & 0xffff) / 65536 - .5);
+        pcm[i] = (int16_t) lrint(32767 * value);
+    }
+    return pcm;
+}
+
+struct EncodedUtterance {
+    std::vector<uint8_t> ogg;
+    std::vector<uint8_t> lengthPrefixed;
+    std::vector<int16_t> expectedOgg; // opus_decode逐包解码，去掉pre-skip并裁到输入长度
+    std::vector<int16_t> expectedRaw; // opus_decode逐包解码的全部输出
+};
+
+EncodedUtterance encodeUtterance(const std::vector<int16_t> &pcm) {
+    int error;
+    OpusEncoder *encoder = opus_encoder_create(SAMPLE_RATE, 1, OPUS_APPLICATION_VOIP, &error);
+    OpusDecoder *decoder = opus_decoder_create(SAMPLE_RATE, 1, &error);
+    if (encoder == nullptr || decoder == nullptr) {
+        fprintf(stderr, "opus_encoder_create/opus_decoder_create failed\n");
+        exit(1);
+    }
+    opus_encoder_ctl(encoder, OPUS_SET_BITRATE(24000));
+    opus_encoder_ctl(encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+    int lookahead;
+    opus_encoder_ctl(encoder, OPUS_GET_LOOKAHEAD(&lookahead));
+    const int scale = 48000 / SAMPLE_RATE;
+
+    EncodedUtterance result;
+    OggOpusWriter writer(result.ogg, 0x54545321);
+    writer.writeHeaders(1, (uint16_t) (lookahead * scale), SAMPLE_RATE, "dicio tts benchmark");
+
+    // 末尾补零，让最后一个包覆盖编码器的延迟
+    size_t frames = (pcm.size() + lookahead + FRAME_SIZE - 1) / FRAME_SIZE;
+    std::vector<int16_t> padded(pcm);
+    padded.resize(frames * FRAME_SIZE, 0);
+    uint8_t packet[1500];
+    int16_t decoded[FRAME_SIZE];
+    int64_t endGranule = (int64_t) (lookahead + pcm.size()) * scale;
+    for (size_t f = 0; f < frames; ++f) {
+        int bytes = opus_encode(encoder, &padded[f * FRAME_SIZE], FRAME_SIZE, packet,
+                                sizeof(packet));
+        if (bytes < 0) {
+            fprintf(stderr, "opus_encode failed: %d\n", bytes);
+            exit(1);
+        }
+        bool last = f + 1 == frames;
+        int64_t granule = last ? endGranule : (int64_t) (f + 1) * FRAME_SIZE * scale;
+        writer.writePacket(packet, bytes, granule, last);
+        result.lengthPrefixed.push_back((uint8_t) (bytes >> 8));
+        result.lengthPrefixed.push_back((uint8_t) bytes);
+        result.lengthPrefixed.insert(result.lengthPrefixed.end(), packet, packet + bytes);
+        int samples = opus_decode(decoder, packet, bytes, decoded, FRAME_SIZE, 0);
+        result.expectedRaw.insert(result.expectedRaw.end(), decoded, decoded + samples);
+    }
+    result.expectedOgg.assign(result.expectedRaw.begin() + lookahead,
+                              result.expectedRaw.begin() + lookahead + pcm.size());
+    opus_encoder_destroy(encoder);
+    opus_decoder_destroy(decoder);
+    return result;
+}
+
+/**
+ * 只应答一次请求的HTTP服务器：读完请求头后按限定的带宽发出响应体
+ */
+class ThrottledServer {
+public:
+    ThrottledServer(const std::vector<uint8_t> &body, const char *contentType,
+                    double bytesPerSecond, size_t maxChunk)
+            : body_(body), contentType_(contentType), bytesPerSecond_(bytesPerSecond),
+              maxChunk_(maxChunk) {
+        listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (listenFd_ < 0 || bind(listenFd_, (sockaddr *) &address, sizeof(address)) != 0
+            || listen(listenFd_, 1) != 0
+            || getsockname(listenFd_, (sockaddr *) &address, &length) != 0) {
+            perror("server socket");
+            exit(1);
+        }
+        port_ = ntohs(address.sin_port);
+        thread_ = std::thread([this] { serve(); });
+    }
+
+    ~ThrottledServer() {
+        thread_.join();
+        close(listenFd_);
+    }
+
+    uint16_t port() const { return port_; }
+
+private:
+    void serve() {
+        int fd = accept(listenFd_, nullptr, nullptr);
+        if (fd < 0) {
+            perror("accept");
+            return;
+        }
+        std::string request;
+        char buffer[1024];
+        while (request.find("\r\n\r\n") == std::string::npos) {
+            ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) {
+                close(fd);
+                return;
+            }
+            request.append(buffer, (size_t) n);
+        }
+        char header[256];
+        int headerLength = snprintf(header, sizeof(header),
+                                    "HTTP/1.1 200 OK\r\nContent-Type: %s\r\n"
+                                    "Content-Length: %zu\r\nConnection: close\r\n\r\n",
+                                    contentType_, body_.size());
+        send(fd, header, (size_t) headerLength, MSG_NOSIGNAL);
+
+        Clock::time_point start = Clock::now();
+        size_t sent = 0;
+        while (sent < body_.size()) {
+            size_t chunk = std::min(body_.size() - sent, 1 + (size_t) nextRandom() % maxChunk_);
+            if (send(fd, &body_[sent], chunk, MSG_NOSIGNAL) != (ssize_t) chunk) {
+                break; // 客户端取消
+            }
+            sent += chunk;
+            if (bytesPerSecond_ > 0) {
+                int64_t due = (int64_t) (1e6 * sent / bytesPerSecond_);
+                std::this_thread::sleep_until(start + std::chrono::microseconds(due));
+            }
+        }
+        close(fd);
+    }
+
+    const std::vector<uint8_t> &body_;
+    const char *contentType_;
+    const double bytesPerSecond_;
+    const size_t maxChunk_;
+    int listenFd_;
+    uint16_t port_;
+    std::thread thread_;
+};
+
+/**
+ * 发出请求并在每收到一块响应体时调用onBody
+ * @return 响应体的字节数，失败返回-1
+ */
+template<typename Callback>
+long fetch(uint16_t port, Callback onBody) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (fd < 0 || connect(fd, (sockaddr *) &address, sizeof(address)) != 0) {
+        perror("connect");
+        return -1;
+    }
+    const char body[] = "{\"text\":\"今天天气怎么样\",\"format\":\"opus\"}";
+    char request[256];
+    int length = snprintf(request, sizeof(request),
+                          "POST /api/v1/tts/synthesize HTTP/1.1\r\nHost: 127.0.0.1\r\n"
+                          "Content-Type: application/json\r\nContent-Length: %zu\r\n\r\n%s",
+                          sizeof(body) - 1, body);
+    send(fd, request, (size_t) length, MSG_NOSIGNAL);
+
+    std::string header;
+    bool inBody = false;
+    long total = 0;
+    char buffer[4096];
+    for (;;) {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            break;
+        }
+        if (inBody) {
+            onBody((const uint8_t *) buffer, (size_t) n);
+            total += n;
+            continue;
+        }
+        header.append(buffer, (size_t) n);
+        size_t end = header.find("\r\n\r\n");
+        if (end == std::string::npos) {
+            continue;
+        }
+        if (header.compare(0, 12, "HTTP/1.1 200") != 0) {
+            close(fd);
+            return -1;
+        }
+        inBody = true;
+        size_t bodyBytes = header.size() - end - 4;
+        if (bodyBytes > 0) {
+            onBody((const uint8_t *) header.data() + end + 4, bodyBytes);
+            total += (long) bodyBytes;
+        }
+    }
+    close(fd);
+    return total;
+}
+
+/**
+ * 模拟以MODE_STREAM播放的AudioTrack：先写入PREBUFFER_MS再play()，之后缓冲区满时write阻塞，
+ * 缓冲区中的样本按实时速度消耗
+ */
+class SimulatedTrack {
+public:
+    explicit SimulatedTrack(Clock::time_point requestStart) : requestStart_(requestStart) {
+    }
+
+    void write(size_t samples) {
+        const size_t capacity = SAMPLE_RATE * TRACK_BUFFER_MS / 1000;
+        update();
+        while (queued_ + samples > capacity) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            update();
+        }
+        queued_ += samples;
+        if (!playing_ && queued_ >= (size_t) SAMPLE_RATE * PREBUFFER_MS / 1000) {
+            play();
+        }
+    }
+
+    void drain() {
+        if (!playing_ && queued_ > 0) {
+            play();
+        }
+        // 最后播空不算卡顿
+        draining_ = true;
+        while (queued_ > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            update();
+        }
+    }
+
+    void update() {
+        if (!playing_) {
+            return;
+        }
+        Clock::time_point now = Clock::now();
+        double played = std::chrono::duration<double>(now - last_).count() * SAMPLE_RATE;
+        last_ = now;
+        if (!draining_ && queued_ > 0 && played >= (double) queued_ + SAMPLE_RATE / 1000) {
+            ++starvations_;
+        }
+        queued_ -= std::min(queued_, (size_t) played);
+    }
+
+    // 播放开始后缓冲区被播空的次数（听得见的卡顿）
+    size_t starvations() const { return starvations_; }
+
+    double playSeconds() const { return playSeconds_; }
+
+private:
+    void play() {
+        playing_ = true;
+        last_ = Clock::now();
+        playSeconds_ = secondsSince(requestStart_);
+    }
+
+    Clock::time_point requestStart_;
+    bool playing_ = false;
+    bool draining_ = false;
+    Clock::time_point last_;
+    size_t queued_ = 0;
+    size_t starvations_ = 0;
+    double playSeconds_ = -1;
+};
+
+struct StreamResult {
+    bool identical;
+    double firstSampleSeconds;
+    double playSeconds;
+    double downloadSeconds;
+    double totalSeconds;
+    size_t starvations;
+    OpusStreamStats stats;
+};
+
+StreamResult streamOnce(const std::vector<uint8_t> &body, const char *contentType,
+                        const std::vector<int16_t> &expected, double bytesPerSecond,
+                        size_t maxChunk, bool realTimePlayback) {
+    StreamResult result = {};
+    OpusStreamDecoder decoder(SAMPLE_RATE, 1, RING_MS);
+    if (decoder.init() != OPUS_OK) {
+        fprintf(stderr, "OpusStreamDecoder init failed\n");
+        exit(1);
+    }
+    ThrottledServer server(body, contentType, bytesPerSecond, maxChunk);
+    Clock::time_point start = Clock::now();
+
+    std::vector<int16_t> played;
+    SimulatedTrack track(start);
+    std::thread playback([&] {
+        int16_t buffer[FRAME_SIZE];
+        for (;;) {
+            int samples = decoder.read(buffer, FRAME_SIZE, 20);
+            if (samples < 0) {
+                break;
+            }
+            played.insert(played.end(), buffer, buffer + samples);
+            if (realTimePlayback && samples > 0) {
+                track.write((size_t) samples);
+            } else if (realTimePlayback) {
+                track.update();
+            }
+        }
+        track.drain();
+    });
+
+    std::atomic<int> error(OPUS_OK);
+    long bytes = fetch(server.port(), [&](const uint8_t *data, size_t size) {
+        int result = decoder.feed(data, size);
+        if (result != OPUS_OK) {
+            error = result;
+        }
+    });
+    result.downloadSeconds = secondsSince(start);
+    decoder.finish();
+    playback.join();
+    result.totalSeconds = secondsSince(start);
+    if (bytes != (long) body.size() || error != OPUS_OK) {
+        fprintf(stderr, "stream failed: %ld of %zu bytes, error %d\n", bytes, body.size(),
+                error.load());
+        exit(1);
+    }
+    result.stats = decoder.stats();
+    result.firstSampleSeconds = result.stats.firstSampleSeconds;
+    result.identical = played == expected && !result.stats.truncated;
+    result.starvations = track.starvations();
+    result.playSeconds = track.playSeconds();
+    return result;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--link") == 0 && i + 1 < argc) {
+            options.linkKBps = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查输出是否正确（ctest）
+            options.seconds = 2;
+            options.linkKBps = 64;
+        } else {
+            fprintf(stderr, "Usage: %s [--seconds N] [--link KB/s] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.seconds > 0 && options.linkKBps > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    std::vector<int16_t> pcm = generateSpeech(options.seconds);
+    EncodedUtterance utterance = encodeUtterance(pcm);
+    double bytesPerSecond = options.linkKBps * 1024;
+    printf("%.1fs utterance at %dHz over a %.0f KB/s link\n", options.seconds, SAMPLE_RATE,
+           options.linkKBps);
+
+    // 原来的做法：PCM整个下载完才开始播放
+    std::vector<uint8_t> pcmBody(pcm.size() * 2);
+    memcpy(pcmBody.data(), pcm.data(), pcmBody.size());
+    {
+        ThrottledServer server(pcmBody, "audio/pcm", bytesPerSecond, 1400);
+        Clock::time_point start = Clock::now();
+        long bytes = fetch(server.port(), [](const uint8_t *, size_t) {});
+        double seconds = secondsSince(start);
+        if (bytes != (long) pcmBody.size()) {
+            fprintf(stderr, "PCM download failed\n");
+            return 1;
+        }
+        printf("  %-22s %7zu bytes, first sample after %6.0f ms (whole body), "
+               "done after %6.0f ms\n", "PCM, buffered:", pcmBody.size(), 1000 * seconds,
+               1000 * (seconds + options.seconds));
+    }
+
+    bool ok = true;
+    struct Case {
+        const char *name;
+        const std::vector<uint8_t> *body;
+        const char *contentType;
+        const std::vector<int16_t> *expected;
+        double bytesPerSecond;
+        size_t maxChunk;
+        bool realTime;
+    } cases[] = {
+        {"Ogg Opus, streamed:", &utterance.ogg, "audio/ogg", &utterance.expectedOgg,
+         bytesPerSecond, 1400, true},
+        {"raw Opus, streamed:", &utterance.lengthPrefixed, "audio/opus",
+         &utterance.expectedRaw, bytesPerSecond, 1400, true},
+        {"Ogg Opus, 1-byte sends:", &utterance.ogg, "audio/ogg", &utterance.expectedOgg, 0, 1,
+         false},
+        {"raw Opus, 1-byte sends:", &utterance.lengthPrefixed, "audio/opus",
+         &utterance.expectedRaw, 0, 1, false},
+    };
+    for (const Case &c : cases) {
+        StreamResult result = streamOnce(*c.body, c.contentType, *c.expected, c.bytesPerSecond,
+                                         c.maxChunk, c.realTime);
+        const char *verdict = result.identical ? "identical to packet-by-packet decoding"
+                                               : "MISMATCH";
+        if (c.realTime) {
+            printf("  %-22s %7zu bytes, first sample after %6.1f ms (first byte %.1f ms), "
+                   "playing after %6.1f ms, download %6.0f ms, done after %6.0f ms, "
+                   "%zu packets, %zu stalls, %zu feed waits, %s\n",
+                   c.name, c.body->size(), 1000 * result.firstSampleSeconds,
+                   1000 * result.stats.firstByteSeconds, 1000 * result.playSeconds,
+                   1000 * result.downloadSeconds, 1000 * result.totalSeconds,
+                   result.stats.packets, result.starvations, result.stats.producerWaits,
+                   verdict);
+        } else {
+            printf("  %-22s %7zu bytes, %zu packets, %s\n", c.name, c.body->size(),
+                   result.stats.packets, verdict);
+        }
+        if (!result.identical || (c.realTime && result.starvations > 0)) {
+            ok = false;
+        }
+    }
+    if (!ok) {
+        fprintf(stderr, "streamed decoding differs from reference or playback stalled\n");
+        return 1;
+    }
+    return 0;
+}
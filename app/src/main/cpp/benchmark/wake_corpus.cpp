@@ -0,0 +1,533 @@
+#include "wake_corpus.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace benchmark {
+
+namespace {
+
+constexpr double RATE = WAKE_CORPUS_RATE;
+
+class Random {
+public:
+    explicit Random(uint32_t seed) : state(seed * 2654435761u ^ 0x9e3779b9u) {
+        if (state == 0) {
+            state = 1;
+        }
+    }
+
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    double uniform(double low, double high) {
+        return low + (high - low) * (next() >> 8) / 16777216.0;
+    }
+
+    int index(int count) {
+        return (int) (next() % (uint32_t) count);
+    }
+
+    bool chance(double probability) {
+        return uniform(0, 1) < probability;
+    }
+
+    double gaussian() {
+        // 中心极限近似，比Box-Muller便宜，长时间的噪声用不着真正的正态分布
+        double sum = 0;
+        for (int i = 0; i < 4; ++i) {
+            sum += uniform(-1, 1);
+        }
+        return sum * .866;
+    }
+
+private:
+    uint32_t state;
+};
+
+double dbToLinear(double db) {
+    return pow(10, db / 20);
+}
+
+// 二阶共振器，峰值增益归一化到1左右
+class Resonator {
+public:
+    void tune(double frequency, double bandwidth) {
+        double r = exp(-M_PI * bandwidth / RATE);
+        double theta = 2 * M_PI * frequency / RATE;
+        a1 = 2 * r * cos(theta);
+        a2 = -r * r;
+        b0 = (1 - r) * sqrt(1 - 2 * r * cos(2 * theta) + r * r);
+    }
+
+    double process(double x) {
+        double y = b0 * x + a1 * y1 + a2 * y2;
+        y2 = y1;
+        y1 = y;
+        return y;
+    }
+
+private:
+    double a1 = 0, a2 = 0, b0 = 0;
+    double y1 = 0, y2 = 0;
+};
+
+// ---------------------------------------------------------------------------------------------
+// 语音合成
+// ---------------------------------------------------------------------------------------------
+
+struct Formants {
+    double f1, f2, f3;
+};
+
+const Formants VOWELS[] = {
+    {730, 1090, 2440}, {270, 2290, 3010}, {300, 870, 2240}, {530, 1840, 2480},
+    {570, 840, 2410}, {660, 1720, 2410}, {440, 1020, 2240}, {490, 1350, 1690},
+};
+constexpr int VOWEL_COUNT = sizeof(VOWELS) / sizeof(VOWELS[0]);
+
+enum class SegmentKind { Silence, Voiced, Noise, Burst };
+
+struct Segment {
+    SegmentKind kind;
+    size_t length;
+    Formants formants;  // Voiced
+    double gain;
+    double noiseCenter; // Noise、Burst
+    double noiseBandwidth;
+    double pitchAccent;
+};
+
+std::vector<Segment> planUtterance(Random &random, double seconds, double formantScale) {
+    std::vector<Segment> segments;
+    double total = 0;
+    auto add = [&](Segment segment, double segmentSeconds) {
+        segment.length = (size_t) (segmentSeconds * RATE);
+        segments.push_back(segment);
+        total += segmentSeconds;
+    };
+    while (total < seconds) {
+        double accent = random.uniform(.9, 1.2);
+        if (random.chance(.75)) {
+            Segment consonant = {SegmentKind::Noise, 0, {}, 0, 0, 0, accent};
+            switch (random.index(4)) {
+            case 0: // 擦音
+                consonant.gain = random.uniform(.15, .5);
+                consonant.noiseCenter = random.uniform(2500, 6500);
+                consonant.noiseBandwidth = random.uniform(1000, 2500);
+                add(consonant, random.uniform(.06, .15));
+                break;
+            case 1: // 塞音：闭塞、爆破、送气
+                add({SegmentKind::Silence, 0, {}, 0, 0, 0, accent}, random.uniform(.03, .06));
+                consonant.kind = SegmentKind::Burst;
+                consonant.gain = random.uniform(.4, 1);
+                consonant.noiseCenter = random.uniform(1000, 4000);
+                consonant.noiseBandwidth = 3000;
+                add(consonant, random.uniform(.008, .015));
+                consonant.kind = SegmentKind::Noise;
+                consonant.gain *= .3;
+                consonant.noiseBandwidth = 1500;
+                add(consonant, random.uniform(.02, .04));
+                break;
+            case 2: // 鼻音
+                add({SegmentKind::Voiced, 0, {250, 1200 * formantScale, 2300 * formantScale},
+                     .35, 0, 0, accent}, random.uniform(.05, .09));
+                break;
+            default: // 滑音
+                add({SegmentKind::Voiced, 0, VOWELS[random.chance(.5) ? 1 : 2], .6, 0, 0, accent},
+                    random.uniform(.04, .07));
+                break;
+            }
+        }
+        Formants vowel = VOWELS[random.index(VOWEL_COUNT)];
+        vowel.f1 *= formantScale;
+        vowel.f2 *= formantScale;
+        vowel.f3 *= formantScale;
+        add({SegmentKind::Voiced, 0, vowel, random.uniform(.7, 1), 0, 0, accent},
+            random.uniform(.09, .26));
+        if (random.chance(.25)) {
+            // 词间停顿
+            add({SegmentKind::Silence, 0, {}, 0, 0, 0, accent}, random.uniform(.06, .2));
+        }
+    }
+    return segments;
+}
+
+std::vector<float> synthesizeUtterance(Random &random, double seconds) {
+    double f0Base = random.uniform(85, 260);
+    double formantScale = f0Base > 160 ? random.uniform(1.05, 1.2) : random.uniform(.9, 1.05);
+    double breathiness = random.uniform(.02, .1);
+    std::vector<Segment> segments = planUtterance(random, seconds, formantScale);
+
+    size_t total = 0;
+    for (const Segment &segment : segments) {
+        total += segment.length;
+    }
+    std::vector<float> out(total);
+
+    Resonator formantFilters[4];
+    Resonator noiseFilter;
+    Formants current = segments[0].kind == SegmentKind::Voiced ? segments[0].formants : VOWELS[0];
+    double glottal = 0;
+    double phase = 0;
+    double jitter = 1;
+    double accent = segments[0].pitchAccent;
+    double gain = 0;
+    size_t pos = 0;
+    for (const Segment &segment : segments) {
+        noiseFilter.tune(segment.noiseCenter > 0 ? segment.noiseCenter : 1000,
+                         segment.noiseBandwidth > 0 ? segment.noiseBandwidth : 1000);
+        size_t ramp = std::min<size_t>(segment.length / 3, (size_t) (.015 * RATE));
+        for (size_t i = 0; i < segment.length; ++i, ++pos) {
+            double t = (double) pos / RATE;
+            double envelope = 1;
+            if (i < ramp) {
+                envelope = .5 - .5 * cos(M_PI * i / ramp);
+            } else if (segment.length - i <= ramp) {
+                envelope = .5 - .5 * cos(M_PI * (segment.length - i) / ramp);
+            }
+            // 音高：句内下倾，每个音节有重音，每个周期有抖动
+            accent += (segment.pitchAccent - accent) * .002;
+            double f0 = f0Base * accent * (1 - .06 * t) * jitter;
+            phase += f0 / RATE;
+            double excitation = 0;
+            if (phase >= 1) {
+                phase -= 1;
+                excitation = 1;
+                jitter = 1 + .01 * random.gaussian();
+            }
+            // 声门脉冲的频谱约为每倍频程-6dB
+            glottal = .96 * glottal + excitation;
+
+            if (i % 80 == 0) {
+                const Formants &target = segment.kind == SegmentKind::Voiced
+                        ? segment.formants : current;
+                current.f1 += (target.f1 - current.f1) * .3;
+                current.f2 += (target.f2 - current.f2) * .3;
+                current.f3 += (target.f3 - current.f3) * .3;
+                formantFilters[0].tune(current.f1, 80);
+                formantFilters[1].tune(current.f2, 120);
+                formantFilters[2].tune(current.f3, 170);
+                formantFilters[3].tune(3500 * formantScale, 250);
+            }
+
+            double targetGain = segment.kind == SegmentKind::Voiced ? segment.gain * envelope : 0;
+            gain += (targetGain - gain) * .01;
+            double voiced = gain * (glottal + breathiness * random.gaussian());
+            double v = formantFilters[0].process(voiced) * 60;
+            v = formantFilters[1].process(v) * 2 + v * .3;
+            v = formantFilters[2].process(v) * 2 + v * .3;
+            v = formantFilters[3].process(v) + v * .5;
+
+            if (segment.kind == SegmentKind::Noise || segment.kind == SegmentKind::Burst) {
+                v += segment.gain * envelope * noiseFilter.process(random.gaussian()) * .5;
+            }
+            out[pos] = (float) v;
+        }
+    }
+
+    double energy = 0;
+    size_t active = 0;
+    float peak = 0;
+    for (float v : out) {
+        peak = std::max(peak, std::fabs(v));
+    }
+    for (float v : out) {
+        if (std::fabs(v) > peak * .05f) {
+            energy += v * v;
+            ++active;
+        }
+    }
+    double scale = active > 0 ? 1 / sqrt(energy / active) : 1;
+    for (float &v : out) {
+        v = (float) (v * scale);
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------------------------
+// 背景场景
+// ---------------------------------------------------------------------------------------------
+
+enum SceneType {
+    SCENE_QUIET, SCENE_FAN, SCENE_CAR, SCENE_HUM, SCENE_MUSIC, SCENE_TYPING, SCENE_KITCHEN,
+    SCENE_RAIN, SCENE_COUNT
+};
+
+const char *const SCENE_NAMES[SCENE_COUNT] = {
+    "quiet", "fan", "car", "hum", "music", "typing", "kitchen", "rain",
+};
+
+// 各场景的RMS电平范围（dBFS）
+const double SCENE_LEVELS[SCENE_COUNT][2] = {
+    {-75, -60}, {-55, -35}, {-50, -30}, {-50, -32}, {-42, -22}, {-50, -30}, {-48, -30},
+    {-45, -30},
+};
+
+class PinkNoise {
+public:
+    double next(Random &random) {
+        // Paul Kellet的近似粉红噪声滤波器
+        double white = random.gaussian();
+        b0 = .99886 * b0 + white * .0555179;
+        b1 = .99332 * b1 + white * .0750759;
+        b2 = .96900 * b2 + white * .1538520;
+        b3 = .86650 * b3 + white * .3104856;
+        b4 = .55000 * b4 + white * .5329522;
+        b5 = -.7616 * b5 - white * .0168980;
+        double pink = b0 + b1 + b2 + b3 + b4 + b5 + b6 + white * .5362;
+        b6 = white * .115926;
+        return pink * .2;
+    }
+
+private:
+    double b0 = 0, b1 = 0, b2 = 0, b3 = 0, b4 = 0, b5 = 0, b6 = 0;
+};
+
+// 短促的衰减事件：键盘的咔嗒声、餐具的叮当声、雨滴
+struct Transient {
+    size_t start;
+    size_t length;
+    double amplitude;
+    double frequency; // 0表示带通噪声
+    double decay;     // 每个样本的衰减
+};
+
+void renderScene(Random &random, int type, double level, float *out, size_t n) {
+    std::vector<float> scene(n);
+    PinkNoise pink;
+    Resonator band;
+    double brown = 0;
+    switch (type) {
+    case SCENE_QUIET:
+        for (size_t i = 0; i < n; ++i) {
+            scene[i] = (float) random.gaussian();
+        }
+        break;
+    case SCENE_FAN: {
+        double motor = random.uniform(90, 300);
+        for (size_t i = 0; i < n; ++i) {
+            scene[i] = (float) (pink.next(random) * 4
+                                + .1 * sin(2 * M_PI * motor * i / RATE));
+        }
+        break;
+    }
+    case SCENE_CAR: {
+        double rate = random.uniform(.1, .3);
+        for (size_t i = 0; i < n; ++i) {
+            brown = .995 * brown + .1 * random.gaussian();
+            scene[i] = (float) (brown * (1 + .3 * sin(2 * M_PI * rate * i / RATE)));
+        }
+        break;
+    }
+    case SCENE_HUM: {
+        double mains = random.chance(.5) ? 50 : 60;
+        double phases[16];
+        for (double &p : phases) {
+            p = random.uniform(0, 2 * M_PI);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            double v = .05 * random.gaussian();
+            for (int h = 1; h <= 15; ++h) {
+                v += sin(2 * M_PI * mains * h * i / RATE + phases[h]) / h;
+            }
+            scene[i] = (float) v;
+        }
+        break;
+    }
+    case SCENE_MUSIC: {
+        // 五声音阶上的几个声部，加底鼓和踩镲
+        const double SCALE[] = {1, 9 / 8., 5 / 4., 3 / 2., 5 / 3., 2, 9 / 4., 5 / 2., 3, 10 / 3.};
+        double root = random.uniform(110, 220);
+        double beat = 60 / random.uniform(80, 140) * RATE;
+        int voices = 1 + random.index(3);
+        bool sustained = random.chance(.4);
+        double decay = exp(-1 / (random.uniform(.3, 1.5) * RATE));
+        bool drums = random.chance(.7);
+        struct Voice {
+            double frequency = 0, amplitude = 0, phase = 0;
+            size_t next = 0;
+        } voiceState[3];
+        Resonator hat;
+        hat.tune(7000, 3000);
+        double kick = 0, kickPhase = 0, hatLevel = 0;
+        for (size_t i = 0; i < n; ++i) {
+            double v = 0;
+            for (int k = 0; k < voices; ++k) {
+                Voice &voice = voiceState[k];
+                if (i >= voice.next) {
+                    voice.frequency = root * SCALE[random.index(10)] * (k == 0 ? 1 : .5);
+                    voice.amplitude = random.uniform(.5, 1);
+                    voice.next = i + (size_t) (beat * (random.index(3) + 1) / 2);
+                }
+                voice.phase += voice.frequency / RATE;
+                voice.phase -= floor(voice.phase);
+                for (int h = 1; h <= 6; ++h) {
+                    v += voice.amplitude * sin(2 * M_PI * h * voice.phase) / (h * h);
+                }
+                if (!sustained) {
+                    voice.amplitude *= decay;
+                }
+            }
+            if (drums) {
+                size_t inBeat = i % (size_t) beat;
+                if (inBeat == 0) {
+                    kick = 1.5;
+                    kickPhase = 0;
+                }
+                if (inBeat == 0 || inBeat == (size_t) (beat / 2)) {
+                    hatLevel = .5;
+                }
+                kickPhase += 55 / RATE;
+                v += kick * sin(2 * M_PI * kickPhase);
+                v += hatLevel * hat.process(random.gaussian()) * 4;
+                kick *= .9995;
+                hatLevel *= .998;
+            }
+            scene[i] = (float) v;
+        }
+        break;
+    }
+    case SCENE_TYPING:
+    case SCENE_KITCHEN:
+    case SCENE_RAIN: {
+        double perSecond = type == SCENE_TYPING ? random.uniform(3, 10)
+                : type == SCENE_KITCHEN ? random.uniform(.5, 2) : 20;
+        bool water = type == SCENE_KITCHEN && random.chance(.5);
+        if (water) {
+            band.tune(random.uniform(800, 2500), 2000);
+        }
+        std::vector<Transient> transients;
+        for (double t = random.uniform(0, 1 / perSecond); t * RATE < n;
+             t += random.uniform(.2, 1.8) / perSecond) {
+            Transient transient;
+            transient.start = (size_t) (t * RATE);
+            if (type == SCENE_KITCHEN) {
+                transient.frequency = random.uniform(2000, 6000);
+                transient.decay = exp(-1 / (random.uniform(.05, .3) * RATE));
+                transient.amplitude = random.uniform(2, 8);
+            } else {
+                transient.frequency = 0;
+                transient.decay = exp(-1 / (random.uniform(.002, .008) * RATE));
+                transient.amplitude = type == SCENE_TYPING ? random.uniform(4, 15)
+                        : random.uniform(1, 4);
+            }
+            transient.length = (size_t) (-log(1000.) / log(transient.decay));
+            transients.push_back(transient);
+        }
+        Resonator click;
+        click.tune(random.uniform(1000, 4000), 2500);
+        for (size_t i = 0; i < n; ++i) {
+            double v = type == SCENE_RAIN ? pink.next(random) * 3 : .1 * random.gaussian();
+            if (water) {
+                v += band.process(random.gaussian()) * (2 + sin(2 * M_PI * 3 * i / RATE));
+            }
+            scene[i] = (float) v;
+        }
+        for (const Transient &transient : transients) {
+            double amplitude = transient.amplitude;
+            for (size_t i = transient.start; i < std::min(n, transient.start + transient.length);
+                 ++i) {
+                double v = transient.frequency > 0
+                        ? sin(2 * M_PI * transient.frequency * (i - transient.start) / RATE)
+                          + .5 * sin(2 * M_PI * 2.7 * transient.frequency
+                                     * (i - transient.start) / RATE)
+                        : click.process(random.gaussian()) * 3;
+                scene[i] += (float) (amplitude * v);
+                amplitude *= transient.decay;
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    double energy = 0;
+    for (float v : scene) {
+        energy += v * v;
+    }
+    double scale = n > 0 && energy > 0 ? dbToLinear(level) / sqrt(energy / n) : 0;
+    // 场景之间交叉淡化200毫秒
+    size_t fade = std::min(n / 2, (size_t) (.2 * RATE));
+    for (size_t i = 0; i < n; ++i) {
+        double ramp = 1;
+        if (i < fade) {
+            ramp = (double) i / fade;
+        } else if (n - i <= fade) {
+            ramp = (double) (n - i) / fade;
+        }
+        out[i] += (float) (scene[i] * scale * ramp);
+    }
+}
+
+} // namespace
+
+WakeCorpus generateWakeCorpus(const WakeCorpusOptions &options) {
+    Random random(options.seed);
+    size_t total = (size_t) (options.seconds * RATE);
+    std::vector<float> mix(total);
+
+    WakeCorpus corpus;
+    std::vector<double> sceneLevels;
+    size_t fade = (size_t) (.2 * RATE);
+    for (size_t pos = 0; pos < total;) {
+        size_t length = (size_t) (random.uniform(8, 40) * RATE);
+        size_t end = std::min(total, pos + length);
+        int type = random.index(SCENE_COUNT);
+        double level = random.uniform(SCENE_LEVELS[type][0], SCENE_LEVELS[type][1]);
+        size_t renderEnd = std::min(total, end + fade);
+        renderScene(random, type, level, &mix[pos], renderEnd - pos);
+        corpus.scenes.push_back({pos, end, SCENE_NAMES[type]});
+        sceneLevels.push_back(level);
+        pos = end;
+    }
+
+    double meanGap = 60 / options.eventsPerMinute;
+    size_t pos = (size_t) (random.uniform(1, 1 + meanGap) * RATE);
+    while (pos < total) {
+        bool keyword = random.chance(.7);
+        std::vector<float> speech = synthesizeUtterance(
+            random, keyword ? random.uniform(.5, 2) : random.uniform(3, 8));
+        if (pos + speech.size() >= total) {
+            break;
+        }
+        double sceneLevel = SCENE_LEVELS[0][0];
+        for (size_t i = 0; i < corpus.scenes.size(); ++i) {
+            if (pos >= corpus.scenes[i].begin && pos < corpus.scenes[i].end) {
+                sceneLevel = sceneLevels[i];
+            }
+        }
+        double levelDb = std::min(-12., std::max(-45., sceneLevel + random.uniform(0, 25)));
+        double gain = dbToLinear(levelDb);
+        float peak = 0;
+        for (float v : speech) {
+            peak = std::max(peak, std::fabs(v));
+        }
+        size_t first = speech.size(), last = 0;
+        for (size_t i = 0; i < speech.size(); ++i) {
+            mix[pos + i] += (float) (speech[i] * gain);
+            if (std::fabs(speech[i]) > peak * .01f) {
+                first = std::min(first, i);
+                last = i;
+            }
+        }
+        if (first <= last) {
+            corpus.events.push_back({pos + first, pos + last + 1});
+        }
+        double gap = std::max(1.5, -log(std::max(1e-6, random.uniform(0, 1))) * meanGap);
+        pos += speech.size() + (size_t) (gap * RATE);
+    }
+
+    corpus.pcm.resize(total);
+    for (size_t i = 0; i < total; ++i) {
+        corpus.pcm[i] = (int16_t) std::max(-32768., std::min(32767., 32768. * mix[i]));
+    }
+    return corpus;
+}
+
+} // namespace benchmark
@@ -0,0 +1,44 @@
+#ifndef DICIO_BENCHMARK_WAKE_CORPUS_H
+#define DICIO_BENCHMARK_WAKE_CORPUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace benchmark {
+
+// 唤醒词前置过滤器（opus-1.3.1/src/wake_gate.c）的合成语料，训练工具和基准测试共用。
+// 模拟手机在房间里全天监听的情形：背景场景（安静、风扇、车内、工频嗡声、音乐、敲键盘、厨房、
+// 雨声）每8到40秒换一次，其间随机插入语音。语音用声源-滤波器模型合成：带抖动和语调的声门
+// 脉冲经过三个共振峰，音节之间有擦音、塞音和鼻音。
+constexpr int32_t WAKE_CORPUS_RATE = 16000;
+
+struct WakeCorpusOptions {
+    double seconds = 600;
+    // 每分钟的语音段数；七成是唤醒词长度（0.5到2秒）的短句，三成是3到8秒的谈话
+    double eventsPerMinute = 2;
+    uint32_t seed = 1;
+};
+
+struct SpeechEvent {
+    size_t begin; // 样本
+    size_t end;
+};
+
+struct BackgroundScene {
+    size_t begin; // 样本
+    size_t end;
+    const char *name;
+};
+
+struct WakeCorpus {
+    std::vector<int16_t> pcm;
+    std::vector<SpeechEvent> events; // 按时间排序，互不重叠
+    std::vector<BackgroundScene> scenes;
+};
+
+WakeCorpus generateWakeCorpus(const WakeCorpusOptions &options);
+
+} // namespace benchmark
+
+#endif // DICIO_BENCHMARK_WAKE_CORPUS_H
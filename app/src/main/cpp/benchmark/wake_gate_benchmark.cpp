@@ -0,0 +1,232 @@
+/*
+ * 级联唤醒检测的主机端基准测试：opus_wake_gate（opus-1.3.1/include/opus_wake_gate.h）作为常驻的
+ * 第一级，只在它打开时才把音频交给重型的唤醒模型（SherpaOnnx KWS或OpenWakeWord）。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/wake_build && cmake --build /tmp/wake_build
+ *   /tmp/wake_build/wake_gate_benchmark [--minutes N] [--frame N] [--threshold Q8]
+ *                                       [--heavy-cost PERCENT] [--quick]
+ *
+ * 回放 benchmark/wake_corpus.h 合成的“全天”音频（默认60分钟，每分钟两段语音，种子与训练和验证
+ * 语料都不同），按应用的帧长（默认1280样本，即80毫秒）送入过滤器，按 GatedWakeDevice.kt 的逻辑
+ * 模拟级联：
+ *   - 过滤器关闭时只缓存最近1.5秒的帧；
+ *   - 某帧的概率超过阈值就打开，先把缓存的帧补给重型模型，之后每帧都送过去；
+ *   - 连续1秒没有超过阈值就关闭，缓存清空。
+ * 输出：
+ *   - 过滤器的CPU时间（本机）；
+ *   - 重型模型处理的帧占全部帧的比例（占空比），以及离语音较远的帧中各背景场景的误开比例；
+ *   - 召回率：重型模型收到了整段语音（包括开头）的语音段比例；
+ *   - 电池代价的近似：常驻CPU = 过滤器 + 占空比 × 重型模型。主机上不能运行那些ONNX/TFLite
+ *     模型，重型模型的单核占用由 --heavy-cost 给出（默认10%，只是一个假设的量级），这一项只是
+ *     比例换算，真实数字需要在设备上测。
+ * --quick（ctest）用10分钟语料，检查召回率不低于95%、占空比不高于40%。
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <opus_wake_gate.h>
+
+#include "benchmark/wake_corpus.h"
+
+using namespace benchmark;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// 与 GatedWakeDevice.kt 保持一致
+constexpr int PRE_ROLL_MS = 1500;
+constexpr int HOLD_MS = 1000;
+constexpr int DEFAULT_THRESHOLD_Q8 = 128;
+
+struct Options {
+    double minutes = 60;
+    size_t frameSize = 1280;
+    int thresholdQ8 = DEFAULT_THRESHOLD_Q8;
+    double heavyCostPercent = 10;
+    bool quick = false;
+};
+
+struct CascadeResult {
+    std::vector<int> probs;      // 每帧的过滤器输出（Q8）
+    std::vector<bool> heavy;     // 每帧是否交给了重型模型（包括补送的缓存帧）
+    size_t opens = 0;
+    size_t heavyFrames = 0;
+    double gateSeconds = 0;
+};
+
+CascadeResult runCascade(const std::vector<int16_t> &pcm, const Options &options) {
+    CascadeResult result;
+    size_t frames = pcm.size() / options.frameSize;
+    double frameMs = 1000. * options.frameSize / WAKE_CORPUS_RATE;
+    size_t preRollFrames = (size_t) (PRE_ROLL_MS / frameMs + .5);
+    size_t holdFrames = std::max<size_t>(1, (size_t) (HOLD_MS / frameMs + .5));
+    result.probs.resize(frames);
+    result.heavy.assign(frames, false);
+
+    int error;
+    OpusWakeGate *gate = opus_wake_gate_create(WAKE_CORPUS_RATE, &error);
+    if (gate == nullptr) {
+        fprintf(stderr, "opus_wake_gate_create failed: %d\n", error);
+        exit(1);
+    }
+    Clock::time_point start = Clock::now();
+    for (size_t k = 0; k < frames; ++k) {
+        result.probs[k] = opus_wake_gate_process(gate, &pcm[k * options.frameSize],
+                                                 (int) options.frameSize);
+    }
+    result.gateSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    opus_wake_gate_destroy(gate);
+
+    bool open = false;
+    size_t buffered = 0, hold = 0;
+    for (size_t k = 0; k < frames; ++k) {
+        bool fired = result.probs[k] >= options.thresholdQ8;
+        if (!open) {
+            if (fired) {
+                open = true;
+                hold = holdFrames;
+                ++result.opens;
+                for (size_t j = k - buffered; j <= k; ++j) {
+                    result.heavy[j] = true;
+                }
+            } else {
+                buffered = std::min(buffered + 1, preRollFrames);
+            }
+        } else {
+            result.heavy[k] = true;
+            if (fired) {
+                hold = holdFrames;
+            } else if (--hold == 0) {
+                open = false;
+                buffered = 0;
+            }
+        }
+    }
+    for (bool h : result.heavy) {
+        result.heavyFrames += h;
+    }
+    return result;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--minutes") == 0 && i + 1 < argc) {
+            options.minutes = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--frame") == 0 && i + 1 < argc) {
+            options.frameSize = (size_t) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            options.thresholdQ8 = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--heavy-cost") == 0 && i + 1 < argc) {
+            options.heavyCostPercent = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            options.minutes = 10;
+            options.quick = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--minutes N] [--frame N] [--threshold Q8] "
+                            "[--heavy-cost PERCENT] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.minutes > 0 && options.frameSize > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    WakeCorpusOptions corpusOptions;
+    corpusOptions.seconds = options.minutes * 60;
+    corpusOptions.seed = 3000;
+    WakeCorpus corpus = generateWakeCorpus(corpusOptions);
+    size_t speechSamples = 0;
+    for (const SpeechEvent &event : corpus.events) {
+        speechSamples += event.end - event.begin;
+    }
+    printf("%.0f min replayed, %zu speech events (%.1f%% of the time), %zu-sample frames, "
+           "threshold %d/256\n", options.minutes, corpus.events.size(),
+           100. * speechSamples / corpus.pcm.size(), options.frameSize, options.thresholdQ8);
+
+    CascadeResult result = runCascade(corpus.pcm, options);
+    size_t frames = result.heavy.size();
+    double audioSeconds = (double) frames * options.frameSize / WAKE_CORPUS_RATE;
+
+    // 召回率：语音段覆盖到的每一帧都交给了重型模型
+    size_t caught = 0;
+    for (const SpeechEvent &event : corpus.events) {
+        size_t first = event.begin / options.frameSize;
+        size_t last = std::min(frames - 1, (event.end - 1) / options.frameSize);
+        bool complete = true;
+        for (size_t k = first; k <= last; ++k) {
+            complete = complete && result.heavy[k];
+        }
+        caught += complete;
+    }
+
+    // 离语音两秒以上的帧算作背景，按场景统计误开
+    std::vector<bool> nearSpeech(frames, false);
+    size_t margin = 2 * WAKE_CORPUS_RATE;
+    for (const SpeechEvent &event : corpus.events) {
+        size_t first = event.begin > margin ? (event.begin - margin) / options.frameSize : 0;
+        size_t last = std::min(frames - 1, (event.end + margin) / options.frameSize);
+        for (size_t k = first; k <= last; ++k) {
+            nearSpeech[k] = true;
+        }
+    }
+    std::map<std::string, std::pair<size_t, size_t>> scenes; // 名称 -> (误开帧, 背景帧)
+    size_t backgroundFrames = 0, backgroundOpen = 0;
+    for (const BackgroundScene &scene : corpus.scenes) {
+        std::pair<size_t, size_t> &counts = scenes[scene.name];
+        for (size_t k = scene.begin / options.frameSize;
+             k < std::min(frames, scene.end / options.frameSize); ++k) {
+            if (!nearSpeech[k]) {
+                ++counts.second;
+                counts.first += result.heavy[k];
+            }
+        }
+    }
+    for (const auto &scene : scenes) {
+        backgroundOpen += scene.second.first;
+        backgroundFrames += scene.second.second;
+    }
+
+    double duty = (double) result.heavyFrames / frames;
+    double recall = (double) caught / std::max<size_t>(1, corpus.events.size());
+    double gateCorePercent = 100 * result.gateSeconds / audioSeconds;
+    printf("gate: %.3f s for %.0f s of audio, %.2f us per 10 ms, %.4f%% of a core (host)\n",
+           result.gateSeconds, audioSeconds, 1e6 * result.gateSeconds / (audioSeconds * 100),
+           gateCorePercent);
+    printf("heavy model: %zu of %zu frames (duty cycle %.1f%%), %zu openings (%.0f per hour)\n",
+           result.heavyFrames, frames, 100 * duty, result.opens,
+           result.opens * 3600 / audioSeconds);
+    printf("recall: %zu/%zu speech events fully seen by the heavy model (%.1f%%)\n", caught,
+           corpus.events.size(), 100 * recall);
+    printf("background frames passed on: %.1f%% overall,", 100. * backgroundOpen /
+           std::max<size_t>(1, backgroundFrames));
+    for (const auto &scene : scenes) {
+        printf(" %s %.1f%%", scene.first.c_str(),
+               100. * scene.second.first / std::max<size_t>(1, scene.second.second));
+    }
+    printf("\n");
+    double always = options.heavyCostPercent;
+    double cascade = gateCorePercent + duty * options.heavyCostPercent;
+    printf("always-on CPU (heavy model at %.1f%% of a core): %.2f%% -> %.2f%% of a core, "
+           "%.0f -> %.0f CPU-seconds per hour (%.1fx less)\n", always, always, cascade,
+           always * 36, cascade * 36, always / cascade);
+
+    if (options.quick && (recall < .95 || duty > .4)) {
+        fprintf(stderr, "recall or duty cycle out of bounds\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,455 @@
+/*
+ * 唤醒词前置过滤器（opus-1.3.1/src/wake_gate.c）的训练工具，生成 opus-1.3.1/src/wake_gate_data.c。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/wake_build && cmake --build /tmp/wake_build
+ *   /tmp/wake_build/wake_gate_train [--minutes N] [--epochs N] [--out FILE]
+ *
+ * 训练数据是 benchmark/wake_corpus.h 的合成语料（语音比基准测试中的更密），特征直接由
+ * wake_gate_compute_features() 计算，与运行时完全一致。网络结构与Opus的语音/音乐分类器
+ * 相同：dense(tanh) -> GRU -> dense(sigmoid)，用浮点数和随时间反向传播训练，权重限制在
+ * [-1, 127/128]以内，训练后量化为int8（乘以128）。最后用量化后的权重和mlp.c中的
+ * compute_dense()/compute_gru()在另一份语料上验证。
+ *
+ * 目标是语音出现的帧：从语音开始30毫秒后到结束150毫秒后为1，前后的过渡区不计损失。每段语音
+ * 开头300毫秒的权重更高，因为级联检测需要过滤器尽早打开。
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "wake_gate.h"
+}
+
+#include "benchmark/wake_corpus.h"
+
+using namespace benchmark;
+
+namespace {
+
+constexpr int F = WAKE_GATE_FEATURES;
+constexpr int D = WAKE_GATE_DENSE_SIZE;
+constexpr int N = WAKE_GATE_GRU_SIZE;
+constexpr size_t HOP = WAKE_GATE_HOP;
+
+constexpr size_t CHUNK = 500;   // 每个训练序列5秒
+constexpr size_t BURN_IN = 100; // 其中前1秒只用来建立GRU状态
+constexpr size_t BATCH = 8;
+
+constexpr float WEIGHT_MIN = -1.f;
+constexpr float WEIGHT_MAX = 127.f / 128;
+
+struct Options {
+    double minutes = 120;
+    int epochs = 30;
+    const char *out = nullptr;
+};
+
+struct Dataset {
+    size_t frames = 0;
+    std::vector<float> features;
+    std::vector<float> targets;
+    std::vector<float> weights;
+    std::vector<SpeechEvent> events; // 以帧为单位
+};
+
+Dataset buildDataset(const WakeCorpus &corpus) {
+    Dataset data;
+    data.frames = corpus.pcm.size() / HOP;
+    data.features.resize(data.frames * F);
+    data.targets.assign(data.frames, 0);
+    data.weights.assign(data.frames, 1);
+
+    OpusWakeGate state;
+    opus_wake_gate_init(&state, WAKE_CORPUS_RATE);
+    for (size_t h = 0; h < data.frames; ++h) {
+        wake_gate_compute_features(&state, &corpus.pcm[h * HOP], &data.features[h * F]);
+    }
+
+    const size_t framesPerSecond = WAKE_CORPUS_RATE / HOP;
+    for (const SpeechEvent &event : corpus.events) {
+        size_t begin = event.begin / HOP;
+        size_t end = std::min(data.frames, event.end / HOP + 1);
+        data.events.push_back({begin, end});
+        size_t onset = begin + 3;
+        size_t release = std::min(data.frames, end + 15);
+        for (size_t h = begin; h < std::min(data.frames, end + 40); ++h) {
+            if (h < onset || h >= release) {
+                data.weights[h] = 0;
+            } else {
+                data.targets[h] = 1;
+                data.weights[h] = h < begin + framesPerSecond * 3 / 10 ? 6 : 2;
+            }
+        }
+    }
+    return data;
+}
+
+// 参数按mlp.c的内存布局排列：dense的权重为[输入][神经元]，GRU的为[输入][z|r|h][神经元]
+struct Layout {
+    static constexpr size_t DENSE_W = 0;
+    static constexpr size_t DENSE_B = DENSE_W + F * D;
+    static constexpr size_t GRU_W = DENSE_B + D;
+    static constexpr size_t GRU_U = GRU_W + D * 3 * N;
+    static constexpr size_t GRU_B = GRU_U + N * 3 * N;
+    static constexpr size_t OUT_W = GRU_B + 3 * N;
+    static constexpr size_t OUT_B = OUT_W + N;
+    static constexpr size_t SIZE = OUT_B + 1;
+};
+
+float sigmoid(float x) {
+    return 1 / (1 + expf(-x));
+}
+
+struct Step {
+    float d[D];
+    float z[N], r[N], c[N], h[N];
+    float p;
+};
+
+// 在一个序列上前向、反向传播，梯度累加到grad，返回加权损失之和
+double trainSequence(const std::vector<float> &params, std::vector<float> &grad,
+                     const Dataset &data, size_t start, std::vector<Step> &steps) {
+    const float *w = params.data();
+    float *g = grad.data();
+    size_t T = std::min(CHUNK, data.frames - start);
+    steps.resize(T);
+
+    float h[N] = {0};
+    double loss = 0;
+    for (size_t t = 0; t < T; ++t) {
+        const float *x = &data.features[(start + t) * F];
+        Step &s = steps[t];
+        for (int i = 0; i < D; ++i) {
+            float a = w[Layout::DENSE_B + i];
+            for (int j = 0; j < F; ++j) {
+                a += w[Layout::DENSE_W + j * D + i] * x[j];
+            }
+            s.d[i] = tanhf(a);
+        }
+        float az[N], ar[N], ah[N];
+        for (int i = 0; i < N; ++i) {
+            az[i] = w[Layout::GRU_B + i];
+            ar[i] = w[Layout::GRU_B + N + i];
+            ah[i] = w[Layout::GRU_B + 2 * N + i];
+        }
+        for (int j = 0; j < D; ++j) {
+            const float *row = &w[Layout::GRU_W + j * 3 * N];
+            for (int i = 0; i < N; ++i) {
+                az[i] += row[i] * s.d[j];
+                ar[i] += row[N + i] * s.d[j];
+                ah[i] += row[2 * N + i] * s.d[j];
+            }
+        }
+        for (int j = 0; j < N; ++j) {
+            const float *row = &w[Layout::GRU_U + j * 3 * N];
+            for (int i = 0; i < N; ++i) {
+                az[i] += row[i] * h[j];
+                ar[i] += row[N + i] * h[j];
+            }
+        }
+        for (int i = 0; i < N; ++i) {
+            s.z[i] = sigmoid(az[i]);
+            s.r[i] = sigmoid(ar[i]);
+        }
+        for (int j = 0; j < N; ++j) {
+            const float *row = &w[Layout::GRU_U + j * 3 * N];
+            float rh = s.r[j] * h[j];
+            for (int i = 0; i < N; ++i) {
+                ah[i] += row[2 * N + i] * rh;
+            }
+        }
+        float ao = w[Layout::OUT_B];
+        for (int i = 0; i < N; ++i) {
+            s.c[i] = tanhf(ah[i]);
+            s.h[i] = s.z[i] * h[i] + (1 - s.z[i]) * s.c[i];
+            h[i] = s.h[i];
+            ao += w[Layout::OUT_W + i] * h[i];
+        }
+        s.p = sigmoid(ao);
+        float weight = t < BURN_IN ? 0 : data.weights[start + t];
+        float y = data.targets[start + t];
+        loss -= weight * (y * logf(s.p + 1e-7f) + (1 - y) * logf(1 - s.p + 1e-7f));
+    }
+
+    float dh[N] = {0};
+    for (size_t t = T; t-- > 0;) {
+        const float *x = &data.features[(start + t) * F];
+        const Step &s = steps[t];
+        float hPrev[N];
+        for (int i = 0; i < N; ++i) {
+            hPrev[i] = t > 0 ? steps[t - 1].h[i] : 0;
+        }
+        float weight = t < BURN_IN ? 0 : data.weights[start + t];
+        float dOut = weight * (s.p - data.targets[start + t]);
+        g[Layout::OUT_B] += dOut;
+        for (int i = 0; i < N; ++i) {
+            g[Layout::OUT_W + i] += dOut * s.h[i];
+            dh[i] += dOut * w[Layout::OUT_W + i];
+        }
+
+        float daz[N], dar[N], dah[N], dhPrev[N], dd[D] = {0};
+        for (int i = 0; i < N; ++i) {
+            float dz = dh[i] * (hPrev[i] - s.c[i]);
+            float dc = dh[i] * (1 - s.z[i]);
+            dhPrev[i] = dh[i] * s.z[i];
+            dah[i] = dc * (1 - s.c[i] * s.c[i]);
+            daz[i] = dz * s.z[i] * (1 - s.z[i]);
+        }
+        for (int j = 0; j < N; ++j) {
+            const float *row = &w[Layout::GRU_U + j * 3 * N];
+            float *growRow = &g[Layout::GRU_U + j * 3 * N];
+            float drh = 0;
+            float rh = s.r[j] * hPrev[j];
+            for (int i = 0; i < N; ++i) {
+                drh += row[2 * N + i] * dah[i];
+                growRow[2 * N + i] += rh * dah[i];
+            }
+            dhPrev[j] += drh * s.r[j];
+            dar[j] = drh * hPrev[j] * s.r[j] * (1 - s.r[j]);
+        }
+        for (int j = 0; j < N; ++j) {
+            const float *row = &w[Layout::GRU_U + j * 3 * N];
+            float *growRow = &g[Layout::GRU_U + j * 3 * N];
+            for (int i = 0; i < N; ++i) {
+                growRow[i] += hPrev[j] * daz[i];
+                growRow[N + i] += hPrev[j] * dar[i];
+                dhPrev[j] += row[i] * daz[i] + row[N + i] * dar[i];
+            }
+        }
+        for (int j = 0; j < D; ++j) {
+            const float *row = &w[Layout::GRU_W + j * 3 * N];
+            float *growRow = &g[Layout::GRU_W + j * 3 * N];
+            for (int i = 0; i < N; ++i) {
+                growRow[i] += s.d[j] * daz[i];
+                growRow[N + i] += s.d[j] * dar[i];
+                growRow[2 * N + i] += s.d[j] * dah[i];
+                dd[j] += row[i] * daz[i] + row[N + i] * dar[i] + row[2 * N + i] * dah[i];
+            }
+        }
+        for (int i = 0; i < N; ++i) {
+            g[Layout::GRU_B + i] += daz[i];
+            g[Layout::GRU_B + N + i] += dar[i];
+            g[Layout::GRU_B + 2 * N + i] += dah[i];
+        }
+        for (int i = 0; i < D; ++i) {
+            float da = dd[i] * (1 - s.d[i] * s.d[i]);
+            g[Layout::DENSE_B + i] += da;
+            for (int j = 0; j < F; ++j) {
+                g[Layout::DENSE_W + j * D + i] += da * x[j];
+            }
+        }
+        std::copy(dhPrev, dhPrev + N, dh);
+    }
+    return loss;
+}
+
+uint32_t randomState = 12345;
+
+double uniform(double low, double high) {
+    randomState = randomState * 1664525u + 1013904223u;
+    return low + (high - low) * (randomState >> 8) / 16777216.0;
+}
+
+void initialize(std::vector<float> &params) {
+    params.assign(Layout::SIZE, 0);
+    auto fill = [&](size_t offset, size_t count, int fanIn, int fanOut) {
+        double limit = std::min(.5, sqrt(6. / (fanIn + fanOut)));
+        for (size_t i = 0; i < count; ++i) {
+            params[offset + i] = (float) uniform(-limit, limit);
+        }
+    };
+    fill(Layout::DENSE_W, F * D, F, D);
+    fill(Layout::GRU_W, D * 3 * N, D, N);
+    fill(Layout::GRU_U, N * 3 * N, N, N);
+    fill(Layout::OUT_W, N, N, 1);
+}
+
+signed char quantize(float w) {
+    return (signed char) std::max(-128.f, std::min(127.f, roundf(w * 128)));
+}
+
+struct Quantized {
+    std::vector<signed char> values;
+    DenseLayer dense;
+    GRULayer gru;
+    DenseLayer output;
+
+    explicit Quantized(const std::vector<float> &params) : values(params.size()) {
+        for (size_t i = 0; i < params.size(); ++i) {
+            values[i] = quantize(params[i]);
+        }
+        const opus_int8 *v = values.data();
+        dense = {v + Layout::DENSE_B, v + Layout::DENSE_W, F, D, 0};
+        gru = {v + Layout::GRU_B, v + Layout::GRU_W, v + Layout::GRU_U, D, N};
+        output = {v + Layout::OUT_B, v + Layout::OUT_W, N, 1, 1};
+    }
+};
+
+// 用量化后的权重、通过mlp.c运行整段验证语料，输出与运行时逐位相同的概率
+std::vector<float> runQuantized(const Quantized &net, const Dataset &data) {
+    std::vector<float> probs(data.frames);
+    float state[MAX_NEURONS] = {0};
+    for (size_t h = 0; h < data.frames; ++h) {
+        float dense[MAX_NEURONS];
+        compute_dense(&net.dense, dense, &data.features[h * F]);
+        compute_gru(&net.gru, state, dense);
+        compute_dense(&net.output, &probs[h], state);
+    }
+    return probs;
+}
+
+void report(const char *name, const std::vector<float> &probs, const Dataset &data) {
+    size_t frames = std::min(probs.size(), data.frames);
+    printf("%s:\n", name);
+    for (float threshold : {.3f, .4f, .5f, .6f, .7f}) {
+        // 语音开头一秒内（短句则在结束前）概率超过阈值算作及时检测到
+        size_t caught = 0;
+        for (const SpeechEvent &event : data.events) {
+            size_t deadline = std::min(event.end, event.begin + 100);
+            for (size_t h = event.begin; h < std::min(frames, deadline); ++h) {
+                if (probs[h] >= threshold) {
+                    ++caught;
+                    break;
+                }
+            }
+        }
+        size_t speechFrames = 0, openFrames = 0, openWithoutSpeech = 0;
+        for (size_t h = 0; h < frames; ++h) {
+            bool open = probs[h] >= threshold;
+            openFrames += open;
+            if (data.targets[h] > 0) {
+                ++speechFrames;
+            } else if (data.weights[h] > 0) {
+                openWithoutSpeech += open;
+            }
+        }
+        printf("  threshold %.1f: %zu/%zu events (%.1f%%), open %.1f%% of frames, "
+               "%.2f%% of non-speech frames\n",
+               threshold, caught, data.events.size(),
+               100. * caught / std::max<size_t>(1, data.events.size()),
+               100. * openFrames / frames,
+               100. * openWithoutSpeech / std::max<size_t>(1, frames - speechFrames));
+    }
+}
+
+void writeArray(FILE *file, const char *name, const std::vector<signed char> &values,
+                size_t offset, size_t count) {
+    fprintf(file, "static const opus_int8 %s[%zu] = {\n", name, count);
+    for (size_t i = 0; i < count; ++i) {
+        fprintf(file, "%s%d%s", i % 8 == 0 ? "   " : " ", values[offset + i],
+                i + 1 == count ? "\n" : i % 8 == 7 ? ",\n" : ",");
+    }
+    fprintf(file, "};\n\n");
+}
+
+bool writeData(const char *path, const Quantized &net) {
+    FILE *file = fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "/*This file is automatically generated by benchmark/wake_gate_train.cpp*/\n\n"
+                  "#ifdef HAVE_CONFIG_H\n#include \"config.h\"\n#endif\n\n"
+                  "#include \"mlp.h\"\n#include \"wake_gate.h\"\n\n");
+    writeArray(file, "wake_gate_dense_weights", net.values, Layout::DENSE_W, F * D);
+    writeArray(file, "wake_gate_dense_bias", net.values, Layout::DENSE_B, D);
+    writeArray(file, "wake_gate_gru_weights", net.values, Layout::GRU_W, D * 3 * N);
+    writeArray(file, "wake_gate_gru_recur_weights", net.values, Layout::GRU_U, N * 3 * N);
+    writeArray(file, "wake_gate_gru_bias", net.values, Layout::GRU_B, 3 * N);
+    writeArray(file, "wake_gate_output_weights", net.values, Layout::OUT_W, N);
+    writeArray(file, "wake_gate_output_bias", net.values, Layout::OUT_B, 1);
+    fprintf(file, "const DenseLayer wake_gate_dense = {\n   wake_gate_dense_bias,\n"
+                  "   wake_gate_dense_weights,\n   %d, %d, 0\n};\n\n", F, D);
+    fprintf(file, "const GRULayer wake_gate_gru = {\n   wake_gate_gru_bias,\n"
+                  "   wake_gate_gru_weights,\n   wake_gate_gru_recur_weights,\n"
+                  "   %d, %d\n};\n\n", D, N);
+    fprintf(file, "const DenseLayer wake_gate_output = {\n   wake_gate_output_bias,\n"
+                  "   wake_gate_output_weights,\n   %d, 1, 1\n};\n", N);
+    return fclose(file) == 0;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--minutes") == 0 && i + 1 < argc) {
+            options.minutes = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--epochs") == 0 && i + 1 < argc) {
+            options.epochs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            options.out = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--minutes N] [--epochs N] [--out FILE]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.minutes > 0 && options.epochs > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    WakeCorpusOptions corpusOptions;
+    corpusOptions.seconds = options.minutes * 60;
+    corpusOptions.eventsPerMinute = 8;
+    corpusOptions.seed = 1000;
+    Dataset train = buildDataset(generateWakeCorpus(corpusOptions));
+    // 验证语料与基准测试的语音密度相同，种子不同
+    corpusOptions.seconds = std::min(corpusOptions.seconds, 1200.);
+    corpusOptions.eventsPerMinute = 2;
+    corpusOptions.seed = 2000;
+    Dataset validation = buildDataset(generateWakeCorpus(corpusOptions));
+    printf("%zu training frames, %zu events; %zu validation frames, %zu events\n",
+           train.frames, train.events.size(), validation.frames, validation.events.size());
+
+    std::vector<float> params, grad(Layout::SIZE), m(Layout::SIZE, 0), v(Layout::SIZE, 0);
+    initialize(params);
+    std::vector<Step> steps;
+    const size_t sequences = train.frames / (CHUNK - BURN_IN);
+    double learningRate = 3e-3;
+    long long t = 0;
+    for (int epoch = 0; epoch < options.epochs; ++epoch) {
+        double loss = 0;
+        for (size_t batch = 0; batch < sequences / BATCH; ++batch) {
+            std::fill(grad.begin(), grad.end(), 0.f);
+            for (size_t k = 0; k < BATCH; ++k) {
+                size_t start = (size_t) uniform(0, (double) (train.frames - CHUNK));
+                loss += trainSequence(params, grad, train, start, steps);
+            }
+            // Adam，然后把参数限制在int8能表示的范围内
+            ++t;
+            double scale = 1. / (BATCH * (CHUNK - BURN_IN));
+            double correction = sqrt(1 - pow(.999, t)) / (1 - pow(.9, t));
+            for (size_t i = 0; i < Layout::SIZE; ++i) {
+                double gi = grad[i] * scale;
+                m[i] = (float) (.9 * m[i] + .1 * gi);
+                v[i] = (float) (.999 * v[i] + .001 * gi * gi);
+                params[i] -= (float) (learningRate * correction * m[i] / (sqrt(v[i]) + 1e-8));
+                params[i] = std::max(WEIGHT_MIN, std::min(WEIGHT_MAX, params[i]));
+            }
+        }
+        learningRate *= .93;
+        printf("epoch %2d: loss %.4f\n", epoch + 1,
+               loss / ((double) (sequences / BATCH) * BATCH * (CHUNK - BURN_IN)));
+        fflush(stdout);
+    }
+
+    Quantized net(params);
+    report("validation (int8, mlp.c)", runQuantized(net, validation), validation);
+    if (options.out != nullptr) {
+        if (!writeData(options.out, net)) {
+            fprintf(stderr, "cannot write %s\n", options.out);
+            return 1;
+        }
+        printf("wrote %s\n", options.out);
+    }
+    return 0;
+}
@@ -0,0 +1,437 @@
+/*
+ * 原生并行zip解压（archive/zip_extractor.h）的主机端基准测试。
+ *
+ * 用法：
+ *   cmake -S app/src/main/cpp -B /tmp/zip_build && cmake --build /tmp/zip_build
+ *   /tmp/zip_build/zip_extract_benchmark [--megabytes N] [--threads N] [--quick]
+ *
+ * 在临时目录里生成一个类似Vosk模型包的压缩包：一个顶层目录下有几个很大的模型文件、
+ * 一些中等大小的文件和很多小配置文件，大部分用deflate压缩，少数已经压缩过的文件直接存储。
+ * 先用与ZipUtils.kt相当的方式解压（单线程、256KB缓冲区、stored条目也经过用户态），
+ * 再用不同的线程数解压，检查：
+ *   - 每个文件的内容都与生成时相同，目录结构与getDestinationFile一致（去掉第一段）；
+ *   - 进度回调的字节数单调增加，最后一次等于总大小；
+ *   - 路径越界、CRC错误、截断的压缩包和回调取消都返回对应的错误码。
+ * 页缓存的影响：压缩包刚写出，所有轮次都从页缓存读取；写入的文件每轮删除重建。
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <ftw.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "archive/zip_extractor.h"
+
+using namespace archive;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    double megabytes = 200;
+    size_t maxThreads = 0;
+    bool quick = false;
+};
+
+struct SourceFile {
+    std::string name; // 压缩包里的名字，包括顶层目录
+    std::vector<uint8_t> data;
+    bool stored;
+};
+
+uint32_t randomState = 1;
+
+uint32_t nextRandom() {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+// 模型权重：从一个小的码本里取float，deflate大约能压缩到一半
+std::vector<uint8_t> weights(size_t size) {
+    static float codebook[4096];
+    static bool initialized = false;
+    if (!initialized) {
+        for (float &value : codebook) {
+            value = (float) ((int) (nextRandom() % 20001) - 10000) / 7919.f;
+        }
+        initialized = true;
+    }
+    std::vector<uint8_t> data(size);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t r = nextRandom();
+        // 偏向码本的前面一小部分，像量化后的权重分布
+        float value = codebook[(r & 0xfff) >> ((r >> 12) % 4 * 2)];
+        memcpy(&data[i], &value, 4);
+    }
+    for (; i < size; ++i) {
+        data[i] = 0;
+    }
+    return data;
+}
+
+std::vector<uint8_t> text(size_t size) {
+    static const char *words[] = {"--min-active=200", "--max-active=7000", "--beam=13.0",
+                                  "--lattice-beam=6.0", "--acoustic-scale=1.0",
+                                  "--frame-subsampling-factor=3", "--endpoint.silence-phones=",
+                                  "1:2:3:4:5:6:7:8:9:10", "\n"};
+    std::string result;
+    while (result.size() < size) {
+        result += words[nextRandom() % (sizeof(words) / sizeof(words[0]))];
+        result += ' ';
+    }
+    result.resize(size);
+    return std::vector<uint8_t>(result.begin(), result.end());
+}
+
+std::vector<uint8_t> randomBytes(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (uint8_t &byte : data) {
+        byte = (uint8_t) nextRandom();
+    }
+    return data;
+}
+
+std::vector<SourceFile> generateModel(double megabytes) {
+    size_t total = (size_t) (megabytes * 1024 * 1024);
+    std::vector<SourceFile> files;
+    // 与vosk-model-small-*的结构相似：两个大文件占大部分
+    files.push_back({"vosk-model/am/final.mdl", weights(total * 30 / 100), false});
+    files.push_back({"vosk-model/graph/HCLr.fst", weights(total * 25 / 100), false});
+    files.push_back({"vosk-model/graph/Gr.fst", weights(total * 15 / 100), false});
+    files.push_back({"vosk-model/rescore/G.carpa", randomBytes(total * 10 / 100), true});
+    for (int i = 0; i < 6; ++i) {
+        files.push_back({"vosk-model/ivector/part" + std::to_string(i) + ".mat",
+                         weights(total * 3 / 100), false});
+    }
+    files.push_back({"vosk-model/graph/phones/word_boundary.int", text(64 * 1024), false});
+    files.push_back({"vosk-model/graph/disambig_tid.int", text(4096), false});
+    for (int i = 0; i < 40; ++i) {
+        files.push_back({"vosk-model/conf/part" + std::to_string(i) + ".conf",
+                         text(200 + nextRandom() % 4000), false});
+    }
+    files.push_back({"vosk-model/README", text(1500), false});
+    files.push_back({"vosk-model/conf/empty.conf", {}, false});
+    return files;
+}
+
+void put16(std::vector<uint8_t> &out, uint32_t value) {
+    out.push_back((uint8_t) value);
+    out.push_back((uint8_t) (value >> 8));
+}
+
+void put32(std::vector<uint8_t> &out, uint32_t value) {
+    put16(out, value & 0xffff);
+    put16(out, value >> 16);
+}
+
+std::vector<uint8_t> deflateRaw(const std::vector<uint8_t> &data) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    deflateInit2(&stream, 6, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::vector<uint8_t> out(deflateBound(&stream, (uLong) data.size()));
+    stream.next_in = const_cast<uint8_t *>(data.data());
+    stream.avail_in = (uInt) data.size();
+    stream.next_out = out.data();
+    stream.avail_out = (uInt) out.size();
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+/**
+ * 最简单的zip写入：顶层目录条目加上所有文件，不用数据描述符，不用zip64
+ */
+std::vector<uint8_t> writeZip(const std::vector<SourceFile> &files) {
+    std::vector<uint8_t> zip, directory;
+    auto addEntry = [&](const std::string &name, const std::vector<uint8_t> &data, bool stored) {
+        std::vector<uint8_t> compressed = stored ? data : deflateRaw(data);
+        uint32_t crc = (uint32_t) crc32(crc32(0L, Z_NULL, 0), data.data(), (uInt) data.size());
+        uint32_t offset = (uint32_t) zip.size();
+        uint16_t method = stored ? 0 : 8;
+        put32(zip, 0x04034b50);
+        put16(zip, 20);
+        put16(zip, 0);
+        put16(zip, method);
+        put32(zip, 0); // 时间和日期
+        put32(zip, crc);
+        put32(zip, (uint32_t) compressed.size());
+        put32(zip, (uint32_t) data.size());
+        put16(zip, (uint32_t) name.size());
+        put16(zip, 4); // 一个空的扩展字段，让本地头与中央目录的长度不同
+        zip.insert(zip.end(), name.begin(), name.end());
+        put16(zip, 0xcafe);
+        put16(zip, 0);
+        zip.insert(zip.end(), compressed.begin(), compressed.end());
+
+        put32(directory, 0x02014b50);
+        put16(directory, 0x031e);
+        put16(directory, 20);
+        put16(directory, 0);
+        put16(directory, method);
+        put32(directory, 0);
+        put32(directory, crc);
+        put32(directory, (uint32_t) compressed.size());
+        put32(directory, (uint32_t) data.size());
+        put16(directory, (uint32_t) name.size());
+        put16(directory, 0);
+        put16(directory, 0);
+        put16(directory, 0);
+        put16(directory, 0);
+        put32(directory, 0);
+        put32(directory, offset);
+        directory.insert(directory.end(), name.begin(), name.end());
+    };
+    addEntry("vosk-model/", {}, true);
+    for (const SourceFile &file : files) {
+        addEntry(file.name, file.data, file.stored);
+    }
+    uint32_t directoryOffset = (uint32_t) zip.size();
+    zip.insert(zip.end(), directory.begin(), directory.end());
+    put32(zip, 0x06054b50);
+    put16(zip, 0);
+    put16(zip, 0);
+    put16(zip, (uint32_t) files.size() + 1);
+    put16(zip, (uint32_t) files.size() + 1);
+    put32(zip, (uint32_t) directory.size());
+    put32(zip, directoryOffset);
+    put16(zip, 0);
+    return zip;
+}
+
+bool writeFile(const std::string &path, const std::vector<uint8_t> &data) {
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    return fclose(file) == 0 && ok;
+}
+
+bool readFile(const std::string &path, std::vector<uint8_t> &data) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    data.clear();
+    uint8_t buffer[65536];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + n);
+    }
+    fclose(file);
+    return true;
+}
+
+int removeEntry(const char *path, const struct stat *, int, struct FTW *) {
+    return remove(path);
+}
+
+void removeTree(const std::string &path) {
+    nftw(path.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+bool verifyOutput(const std::string &destination, const std::vector<SourceFile> &files) {
+    std::vector<uint8_t> data;
+    for (const SourceFile &file : files) {
+        std::string path = destination + "/" + file.name.substr(file.name.find('/') + 1);
+        if (!readFile(path, data) || data != file.data) {
+            fprintf(stderr, "wrong content: %s\n", path.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Run {
+    int result;
+    double seconds;
+    size_t callbacks;
+    bool monotonic;
+    ZipProgress last;
+    ZipExtractStats stats;
+};
+
+Run runExtraction(const std::string &zipPath, const std::string &destination,
+                  const ZipExtractOptions &options, int cancelAfter = -1) {
+    removeTree(destination);
+    Run run = {};
+    run.monotonic = true;
+    Clock::time_point start = Clock::now();
+    run.result = extractZip(zipPath, destination, options, [&](const ZipProgress &progress) {
+        if (progress.doneBytes < run.last.doneBytes || progress.doneFiles < run.last.doneFiles
+                || progress.doneBytes > progress.totalBytes) {
+            run.monotonic = false;
+        }
+        run.last = progress;
+        ++run.callbacks;
+        return cancelAfter < 0 || (int) run.callbacks <= cancelAfter;
+    }, &run.stats);
+    run.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return run;
+}
+
+bool checkError(const char *what, int result, int expected) {
+    printf("  %-32s %s\n", what, zipResultString(result));
+    if (result != expected) {
+        fprintf(stderr, "%s: expected \"%s\"\n", what, zipResultString(expected));
+        return false;
+    }
+    return true;
+}
+
+bool testErrors(const std::string &work, const std::vector<uint8_t> &zip) {
+    std::string destination = work + "/errors";
+    ZipExtractOptions options;
+    printf("error handling:\n");
+
+    std::vector<SourceFile> unsafe = {{"vosk-model/conf/../../../evil", text(100), false}};
+    std::string unsafePath = work + "/unsafe.zip";
+    writeFile(unsafePath, writeZip(unsafe));
+    bool ok = checkError("entry outside the destination", runExtraction(
+            unsafePath, destination, options).result, ZIP_UNSAFE_PATH);
+
+    // a.bin是deflate，b.bin直接存储，在压缩包的最后（中央目录只有一百多字节）
+    std::vector<SourceFile> small = {{"vosk-model/a.bin", weights(300000), false},
+                                     {"vosk-model/b.bin", randomBytes(100000), true}};
+    std::vector<uint8_t> smallZip = writeZip(small);
+    std::string corruptedPath = work + "/corrupted.zip";
+    std::vector<uint8_t> corrupted = smallZip;
+    corrupted[smallZip.size() - 50000] ^= 0x55;
+    writeFile(corruptedPath, corrupted);
+    ok = checkError("corrupted stored entry", runExtraction(
+            corruptedPath, destination, options).result, ZIP_CRC_MISMATCH) && ok;
+    // deflate数据损坏时通常在解压中途就出错，少数情况下要到CRC才发现
+    corrupted = smallZip;
+    corrupted[1000] ^= 0x55;
+    writeFile(corruptedPath, corrupted);
+    int result = runExtraction(corruptedPath, destination, options).result;
+    printf("  %-32s %s\n", "corrupted deflate entry", zipResultString(result));
+    if (result != ZIP_CRC_MISMATCH && result != ZIP_BAD_ARCHIVE) {
+        fprintf(stderr, "corrupted data was not detected\n");
+        ok = false;
+    }
+
+    std::string truncatedPath = work + "/truncated.zip";
+    writeFile(truncatedPath, std::vector<uint8_t>(zip.begin(), zip.begin() + zip.size() / 2));
+    ok = checkError("truncated archive", runExtraction(truncatedPath, destination, options).result,
+                    ZIP_BAD_ARCHIVE) && ok;
+
+    options.progressIntervalMs = 1;
+    ok = checkError("cancelled by the callback", runExtraction(
+            work + "/model.zip", destination, options, 1).result, ZIP_CANCELLED) && ok;
+    removeTree(destination);
+    return ok;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--megabytes") == 0 && i + 1 < argc) {
+            options.megabytes = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.maxThreads = (size_t) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            // 只用于检查解压结果是否正确（ctest），时间没有参考价值
+            options.megabytes = 16;
+            options.quick = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--megabytes N] [--threads N] [--quick]\n", argv[0]);
+            return false;
+        }
+    }
+    return options.megabytes > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    const char *tmp = getenv("TMPDIR");
+    std::string pattern = std::string(tmp ? tmp : "/tmp") + "/zip_benchmark_XXXXXX";
+    std::vector<char> workBuffer(pattern.begin(), pattern.end());
+    workBuffer.push_back('\0');
+    if (mkdtemp(workBuffer.data()) == nullptr) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+    std::string work = workBuffer.data();
+    std::string zipPath = work + "/model.zip";
+    std::string destination = work + "/model";
+
+    std::vector<SourceFile> files = generateModel(options.megabytes);
+    std::vector<uint8_t> zip = writeZip(files);
+    size_t totalBytes = 0;
+    for (const SourceFile &file : files) {
+        totalBytes += file.data.size();
+    }
+    if (!writeFile(zipPath, zip)) {
+        fprintf(stderr, "cannot write %s\n", zipPath.c_str());
+        removeTree(work);
+        return 1;
+    }
+    printf("%zu files, %.1f MB -> %.1f MB zip\n", files.size(), totalBytes / 1048576.,
+           zip.size() / 1048576.);
+
+    bool ok = true;
+    // 与ZipUtils.kt的Kotlin实现相当：单线程、256KB缓冲区、stored条目也经过用户态
+    ZipExtractOptions baseline;
+    baseline.threads = 1;
+    baseline.bufferSize = 256 * 1024;
+    baseline.copyFileRange = false;
+    Run reference = runExtraction(zipPath, destination, baseline);
+    if (reference.result != ZIP_OK || !verifyOutput(destination, files)) {
+        fprintf(stderr, "baseline extraction failed: %s\n", zipResultString(reference.result));
+        ok = false;
+    }
+    printf("baseline (1 thread, 256 KB): %7.3f s, %6.1f MB/s\n", reference.seconds,
+           totalBytes / 1048576. / reference.seconds);
+
+    size_t maxThreads = options.maxThreads != 0
+            ? options.maxThreads : std::max<size_t>(1, std::thread::hardware_concurrency());
+    for (size_t threads = 1; ok && threads <= maxThreads; threads = threads < maxThreads
+            ? std::min(threads * 2, maxThreads) : threads + 1) {
+        ZipExtractOptions extractOptions;
+        extractOptions.threads = threads;
+        extractOptions.progressIntervalMs = 20;
+        Run run = runExtraction(zipPath, destination, extractOptions);
+        if (run.result != ZIP_OK) {
+            fprintf(stderr, "extraction failed: %s (%s, errno %d)\n",
+                    zipResultString(run.result), run.stats.failedEntry.c_str(),
+                    run.stats.systemError);
+            ok = false;
+            break;
+        }
+        printf("%2zu threads:                  %7.3f s, %6.1f MB/s (%4.2fx baseline), "
+               "directory %.4f s, %zu/%zu stored entries copied in the kernel, "
+               "%zu progress callbacks\n",
+               threads, run.seconds, totalBytes / 1048576. / run.seconds,
+               reference.seconds / run.seconds, run.stats.directorySeconds,
+               run.stats.kernelCopies, run.stats.storedFiles, run.callbacks);
+        if (!verifyOutput(destination, files)) {
+            ok = false;
+        } else if (!run.monotonic || run.last.doneBytes != totalBytes
+                   || run.last.doneFiles != files.size() || run.last.totalFiles != files.size()) {
+            fprintf(stderr, "bad progress reports\n");
+            ok = false;
+        }
+    }
+
+    ok = ok && testErrors(work, zip);
+    removeTree(work);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+#include "batch_scorer.h"
+
+#include <limits>
+
+#include "score_bound.h"
+
+namespace matcher {
+
+namespace {
+
+void atomicMax(std::atomic<float> &target, float value) {
+    float current = target.load(std::memory_order_relaxed);
+    while (value > current
+            && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+BatchScorer::BatchScorer(WorkStealingPool &pool)
+        : pool_(pool), matchers_(pool.workerCount()) {
+}
+
+BatchScorer &BatchScorer::shared() {
+    static BatchScorer scorer(WorkStealingPool::shared());
+    return scorer;
+}
+
+void BatchScorer::scoreSentence(const Grammar &grammar, const MatchInput &input,
+                                int32_t sentence, size_t worker) {
+    const Score score = matchers_[worker].scoreSentence(grammar, sentence, input);
+    sentenceScores_[sentence] = score;
+    sentenceStates_[sentence] = SENTENCE_SCORED;
+    atomicMax(skillBest_[sentenceSkills_[sentence]], score.value());
+    atomicMax(grammarBest_, score.value());
+    sentencesScored_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void BatchScorer::scoreAll(const Grammar &grammar, const MatchInput &input,
+                           std::vector<SkillResult> &results, bool pruneSkills) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const size_t sentenceCount = grammar.sentenceCount();
+    const size_t skillCount = grammar.skillCount();
+    const float lowest = -std::numeric_limits<float>::infinity();
+
+    sentenceScores_.resize(sentenceCount);
+    sentenceBounds_.resize(sentenceCount);
+    sentenceStates_.assign(sentenceCount, SENTENCE_PRUNED_BY_SKILL);
+    sentenceSkills_.resize(sentenceCount);
+    leaders_.resize(skillCount);
+    if (skillBestCapacity_ < skillCount) {
+        skillBest_.reset(new std::atomic<float>[skillCount]);
+        skillBestCapacity_ = skillCount;
+    }
+    grammarBest_.store(lowest, std::memory_order_relaxed);
+
+    for (size_t skill = 0; skill < skillCount; ++skill) {
+        skillBest_[skill].store(lowest, std::memory_order_relaxed);
+        int32_t leader = grammar.skillSentenceStart(skill);
+        for (int32_t s = leader; s < grammar.skillSentenceEnd(skill); ++s) {
+            sentenceSkills_[s] = (int32_t) skill;
+            sentenceBounds_[s] = ScoreBound::sentence(grammar, s, input);
+            if (sentenceBounds_[s] > sentenceBounds_[leader]) {
+                leader = s;
+            }
+        }
+        leaders_[skill] = leader;
+    }
+
+    // 第一轮：每个技能最有希望的句子，为后面的剪枝提供下界
+    pool_.parallelFor(skillCount, [&](size_t skill, size_t worker) {
+        scoreSentence(grammar, input, leaders_[skill], worker);
+    });
+
+    // 第二轮：其余句子，上界不够高的直接跳过
+    pool_.parallelFor(sentenceCount, [&](size_t s, size_t worker) {
+        const int32_t sentence = (int32_t) s;
+        const int32_t skill = sentenceSkills_[sentence];
+        if (sentence == leaders_[skill]) {
+            return;
+        }
+        const float bound = sentenceBounds_[sentence];
+        if (bound < skillBest_[skill].load(std::memory_order_relaxed)) {
+            sentencesPruned_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (pruneSkills && bound < grammarBest_.load(std::memory_order_relaxed)) {
+            sentenceStates_[sentence] = SENTENCE_PRUNED_BY_GRAMMAR;
+            sentencesPruned_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        scoreSentence(grammar, input, sentence, worker);
+    });
+
+    results.resize(skillCount);
+    for (size_t skill = 0; skill < skillCount; ++skill) {
+        const int32_t first = grammar.skillSentenceStart(skill);
+        int32_t best = -1;
+        for (int32_t s = first; s < grammar.skillSentenceEnd(skill); ++s) {
+            // 只有严格更高的分数才替换，与StandardRecognizerData.score一致；
+            // 被跳过的句子上界严格小于某个已打分句子的得分，不会影响结果。
+            // 上界最高的句子总是被打分，所以best一定有效
+            if (sentenceStates_[s] == SENTENCE_SCORED
+                    && (best < 0 || sentenceScores_[s].value() > sentenceScores_[best].value())) {
+                best = s;
+            }
+        }
+
+        bool pruned = false;
+        for (int32_t s = first; s < grammar.skillSentenceEnd(skill); ++s) {
+            if (sentenceStates_[s] == SENTENCE_PRUNED_BY_GRAMMAR
+                    && sentenceBounds_[s] >= sentenceScores_[best].value()) {
+                pruned = true;
+                break;
+            }
+        }
+        if (pruned) {
+            skillsPruned_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        results[skill].sentence = best - first;
+        results[skill].score = sentenceScores_[best];
+        results[skill].pruned = pruned;
+    }
+}
+
+PruningStats BatchScorer::stats() const {
+    return PruningStats{sentencesScored_.load(std::memory_order_relaxed),
+                        sentencesPruned_.load(std::memory_order_relaxed),
+                        skillsPruned_.load(std::memory_order_relaxed)};
+}
+
+} // namespace matcher
@@ -0,0 +1,85 @@
+#ifndef DICIO_MATCHER_BATCH_SCORER_H
+#define DICIO_MATCHER_BATCH_SCORER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "grammar.h"
+#include "match_input.h"
+#include "score.h"
+#include "sentence_matcher.h"
+#include "work_stealing_pool.h"
+
+namespace matcher {
+
+struct SkillResult {
+    int32_t sentence; // 技能内部的句子下标（不是grammar中的全局下标）
+    Score score;
+    // 技能的部分句子因为不可能超过其他技能而被跳过，score可能低于真实得分，这个技能不可能胜出
+    bool pruned;
+};
+
+struct PruningStats {
+    uint64_t sentencesScored;
+    uint64_t sentencesPruned; // 上界不超过同一技能已有的最佳得分，或者（允许跳过技能时）全局最佳得分
+    uint64_t skillsPruned;
+};
+
+/**
+ * 并行地为一个Grammar中所有技能的所有句子打分，然后按技能归约出最佳句子。
+ * 以句子为粒度拆分任务，同一个MatchInput被所有任务共享。
+ * 归约按句子顺序进行，结果与Kotlin端 StandardRecognizerData.score 的顺序扫描一致。
+ *
+ * 先为每个技能上界最高的句子打分，再并行处理其余句子：上界（ScoreBound）严格小于
+ * 同一技能当前最佳得分的句子不可能被选中，直接跳过；pruneSkills为true时，
+ * 上界严格小于所有技能当前最佳得分的句子也会被跳过。
+ */
+class BatchScorer {
+public:
+    explicit BatchScorer(WorkStealingPool &pool);
+
+    /**
+     * @param results 大小会被设置为 grammar.skillCount()
+     * @param pruneSkills 只有调用方按Score::value()在这些技能中选出唯一的最佳技能时才能为true，
+     * 被跳过的技能的SkillResult::pruned为true
+     */
+    void scoreAll(const Grammar &grammar, const MatchInput &input,
+                  std::vector<SkillResult> &results, bool pruneSkills = false);
+
+    PruningStats stats() const;
+
+    static BatchScorer &shared();
+
+private:
+    enum SentenceState : uint8_t {
+        SENTENCE_SCORED,
+        SENTENCE_PRUNED_BY_SKILL,
+        SENTENCE_PRUNED_BY_GRAMMAR,
+    };
+
+    void scoreSentence(const Grammar &grammar, const MatchInput &input,
+                       int32_t sentence, size_t worker);
+
+    WorkStealingPool &pool_;
+    std::mutex mutex_;
+    std::vector<SentenceMatcher> matchers_; // 每个工作者一个
+    std::vector<Score> sentenceScores_;
+    std::vector<float> sentenceBounds_;
+    std::vector<uint8_t> sentenceStates_;
+    std::vector<int32_t> sentenceSkills_;
+    std::vector<int32_t> leaders_; // 每个技能上界最高的句子
+    std::unique_ptr<std::atomic<float>[]> skillBest_;
+    size_t skillBestCapacity_ = 0;
+    std::atomic<float> grammarBest_{0.0f};
+
+    std::atomic<uint64_t> sentencesScored_{0};
+    std::atomic<uint64_t> sentencesPruned_{0};
+    std::atomic<uint64_t> skillsPruned_{0};
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_BATCH_SCORER_H
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+Generates unicode_tables.cpp, the lookup tables used by the native tokenizer (tokenizer.cpp) to
+reproduce splitWords() and nfkdNormalizeWord() from the skill module without a regex engine or ICU.
+
+Usage: python3 gen_unicode_tables.py > unicode_tables.cpp
+
+The tables reflect the Unicode version of the Python interpreter running this script.
+"""
+
+import sys
+import unicodedata
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+COMBINING_DIACRITICAL_MARKS = range(0x0300, 0x0370)
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp < 0xE000
+
+
+def is_letter(cp):
+    return not is_surrogate(cp) and unicodedata.category(chr(cp)).startswith("L")
+
+
+def is_cased(cp):
+    return not is_surrogate(cp) and unicodedata.category(chr(cp)) in ("Lu", "Ll", "Lt")
+
+
+def utf16(text):
+    units = []
+    for ch in text:
+        cp = ord(ch)
+        if cp >= 0x10000:
+            cp -= 0x10000
+            units.append(0xD800 + (cp >> 10))
+            units.append(0xDC00 + (cp & 0x3FF))
+        else:
+            units.append(cp)
+    return units
+
+
+def fold(cp):
+    return "".join(c for c in unicodedata.normalize("NFKD", chr(cp))
+                   if ord(c) not in COMBINING_DIACRITICAL_MARKS)
+
+
+def bitmap(predicate):
+    words = []
+    for base in range(0, 0x10000, 32):
+        word = 0
+        for bit in range(32):
+            if predicate(base + bit):
+                word |= 1 << bit
+        words.append(word)
+    return words
+
+
+def ranges(predicate, first, last):
+    result = []
+    start = None
+    for cp in range(first, last + 2):
+        inside = cp <= last and predicate(cp)
+        if inside and start is None:
+            start = cp
+        elif not inside and start is not None:
+            result.append((start, cp - 1))
+            start = None
+    return result
+
+
+def emit_words(out, name, words):
+    out.write("const uint32_t %s[%d] = {\n" % (name, len(words)))
+    for i in range(0, len(words), 6):
+        out.write("    " + " ".join("0x%08x," % w for w in words[i:i + 6]) + "\n")
+    out.write("};\n\n")
+
+
+def main():
+    out = sys.stdout
+
+    lowercase = []
+    folds = []
+    fold_data = []
+    for cp in range(0x110000):
+        if is_surrogate(cp):
+            continue
+        lower = chr(cp).lower()
+        # U+0130 is the only code point whose lowercase form has more than one code point, it is
+        # handled directly in tokenizer.cpp together with the final sigma
+        if len(lower) == 1 and ord(lower) != cp:
+            lowercase.append((cp, ord(lower)))
+
+        if is_letter(cp) and not HANGUL_FIRST <= cp <= HANGUL_LAST:
+            folded = fold(cp)
+            if folded != chr(cp):
+                units = utf16(folded)
+                folds.append((cp, len(fold_data), len(units)))
+                fold_data.extend(units)
+
+    out.write("// Generated by gen_unicode_tables.py from Unicode %s, do not edit.\n\n"
+              % unicodedata.unidata_version)
+    out.write('#include "unicode_tables.h"\n\n')
+    out.write("namespace matcher {\nnamespace unicode {\n\n")
+
+    emit_words(out, "LETTER_BMP", bitmap(is_letter))
+    emit_words(out, "CASED_BMP", bitmap(is_cased))
+
+    supplementary = ranges(is_letter, 0x10000, 0x10FFFF)
+    out.write("const Range LETTER_SUPPLEMENTARY[] = {\n")
+    for first, last in supplementary:
+        out.write("    {0x%05x, 0x%05x},\n" % (first, last))
+    out.write("};\nconst size_t LETTER_SUPPLEMENTARY_COUNT = %d;\n\n" % len(supplementary))
+
+    out.write("const Mapping LOWERCASE[] = {\n")
+    for i in range(0, len(lowercase), 4):
+        out.write("    " + " ".join("{0x%05x, 0x%05x}," % m for m in lowercase[i:i + 4]) + "\n")
+    out.write("};\nconst size_t LOWERCASE_COUNT = %d;\n\n" % len(lowercase))
+
+    out.write("const Fold FOLD[] = {\n")
+    for i in range(0, len(folds), 4):
+        out.write("    " + " ".join("{0x%05x, %d, %d}," % f for f in folds[i:i + 4]) + "\n")
+    out.write("};\nconst size_t FOLD_COUNT = %d;\n\n" % len(folds))
+
+    out.write("const char16_t FOLD_DATA[] = {\n")
+    for i in range(0, len(fold_data), 10):
+        out.write("    " + " ".join("0x%04x," % u for u in fold_data[i:i + 10]) + "\n")
+    out.write("};\n\n")
+
+    out.write("} // namespace unicode\n} // namespace matcher\n")
+
+    max_fold = max(length for _, _, length in folds)
+    sys.stderr.write("lowercase: %d, folds: %d (%d units, max %d)\n"
+                     % (len(lowercase), len(folds), len(fold_data), max_fold))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,257 @@
+#include "grammar.h"
+
+#include <cctype>
+
+namespace matcher {
+
+namespace {
+
+// 见Vocabulary::internRegex。量词只能跟在ASCII字面量或分组后面：跟在多字节字符后面时
+// std::regex只重复它的最后一个字节
+bool isByteSafeRegex(const std::string &pattern) {
+    int depth = 0;
+    bool quantifiable = false;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        const unsigned char c = (unsigned char) pattern[i];
+        if (c >= 0x80) {
+            quantifiable = false;
+            continue;
+        }
+        switch (c) {
+            case '\\':
+                // 只接受转义的标点，\w、\d、\b之类的不接受
+                if (i + 1 >= pattern.size() || !ispunct((unsigned char) pattern[i + 1])) {
+                    return false;
+                }
+                ++i;
+                quantifiable = true;
+                break;
+            case '(':
+                if (i + 1 < pattern.size() && pattern[i + 1] == '?') {
+                    if (i + 2 >= pattern.size() || pattern[i + 2] != ':') {
+                        return false; // 前瞻等
+                    }
+                    i += 2;
+                }
+                ++depth;
+                quantifiable = false;
+                break;
+            case ')':
+                if (--depth < 0) {
+                    return false;
+                }
+                quantifiable = true;
+                break;
+            case '?':
+            case '*':
+            case '+':
+                if (!quantifiable) {
+                    return false;
+                }
+                quantifiable = false;
+                break;
+            case '|':
+            case '^':
+            case '$':
+                quantifiable = false;
+                break;
+            case '.':
+            case '[':
+            case ']':
+            case '{':
+            case '}':
+                return false;
+            default:
+                quantifiable = true;
+                break;
+        }
+    }
+    return depth == 0;
+}
+
+} // namespace
+
+Vocabulary &Vocabulary::instance() {
+    static Vocabulary vocabulary;
+    return vocabulary;
+}
+
+int32_t Vocabulary::intern(const std::string &word) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = words_.find(word);
+    if (it != words_.end()) {
+        return it->second;
+    }
+    int32_t id = (int32_t) words_.size();
+    words_.emplace(word, id);
+    return id;
+}
+
+int32_t Vocabulary::lookup(const std::string &word) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = words_.find(word);
+    return it == words_.end() ? -1 : it->second;
+}
+
+int32_t Vocabulary::wordCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int32_t) words_.size();
+}
+
+int32_t Vocabulary::internRegex(const std::string &pattern) {
+    if (!isByteSafeRegex(pattern)) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = regexIds_.find(pattern);
+    if (it != regexIds_.end()) {
+        return it->second;
+    }
+    std::unique_ptr<std::regex> compiled;
+    try {
+        compiled.reset(new std::regex(pattern, std::regex::ECMAScript));
+    } catch (const std::regex_error &) {
+        return -1;
+    }
+    int32_t id = (int32_t) regexes_.size();
+    regexes_.push_back(std::move(compiled));
+    regexIds_.emplace(pattern, id);
+    return id;
+}
+
+std::vector<const std::regex *> Vocabulary::regexes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<const std::regex *> result;
+    result.reserve(regexes_.size());
+    for (const std::unique_ptr<std::regex> &regex : regexes_) {
+        result.push_back(regex.get());
+    }
+    return result;
+}
+
+const std::regex *Vocabulary::regex(int32_t id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return id >= 0 && (size_t) id < regexes_.size() ? regexes_[id].get() : nullptr;
+}
+
+Grammar *Grammar::parse(const int32_t *encoded, size_t encodedSize,
+                        const float *weights, size_t weightCount,
+                        const std::vector<std::string> &strings,
+                        const int32_t *sentenceRoots, size_t sentenceCount,
+                        const int32_t *skillSentenceCounts, size_t skillCount) {
+    std::unique_ptr<Grammar> grammar(new Grammar());
+
+    // 每个句子根节点在编码数组中的偏移，解析后转换为节点下标
+    for (size_t s = 0; s < sentenceCount; ++s) {
+        if (sentenceRoots[s] < 0 || (size_t) sentenceRoots[s] >= encodedSize) {
+            return nullptr;
+        }
+        size_t pos = (size_t) sentenceRoots[s];
+        int32_t root = grammar->parseNode(encoded, encodedSize, pos, weights, weightCount,
+                                          strings, 1);
+        if (grammar->failed_) {
+            return nullptr;
+        }
+        grammar->sentenceRoots_.push_back(root);
+    }
+
+    grammar->skillSentenceStart_.push_back(0);
+    int32_t total = 0;
+    for (size_t i = 0; i < skillCount; ++i) {
+        if (skillSentenceCounts[i] <= 0) {
+            // StandardRecognizerData保证每个技能至少有一个句子
+            return nullptr;
+        }
+        total += skillSentenceCounts[i];
+        grammar->skillSentenceStart_.push_back(total);
+    }
+    if ((size_t) total != sentenceCount) {
+        return nullptr;
+    }
+    return grammar.release();
+}
+
+int32_t Grammar::parseNode(const int32_t *encoded, size_t encodedSize, size_t &pos,
+                           const float *weights, size_t weightCount,
+                           const std::vector<std::string> &strings, int32_t depth) {
+    if (failed_ || pos >= encodedSize) {
+        failed_ = true;
+        return -1;
+    }
+    if (depth > maxDepth_) {
+        maxDepth_ = depth;
+    }
+
+    Node node = {};
+    node.type = (uint8_t) encoded[pos++];
+    switch (node.type) {
+        case NODE_WORD: {
+            if (pos + 3 > encodedSize) {
+                failed_ = true;
+                return -1;
+            }
+            node.flags = (uint8_t) encoded[pos++];
+            int32_t stringIndex = encoded[pos++];
+            int32_t weightIndex = encoded[pos++];
+            if (stringIndex < 0 || (size_t) stringIndex >= strings.size()
+                    || weightIndex < 0 || (size_t) weightIndex >= weightCount) {
+                failed_ = true;
+                return -1;
+            }
+            node.id = (node.flags & WORD_FLAG_REGEX)
+                    ? Vocabulary::instance().internRegex(strings[stringIndex])
+                    : Vocabulary::instance().intern(strings[stringIndex]);
+            if (node.id < 0) {
+                failed_ = true;
+                return -1;
+            }
+            node.weight = weights[weightIndex];
+            break;
+        }
+        case NODE_OR:
+        case NODE_COMPOSITE: {
+            if (pos >= encodedSize || encoded[pos] < 0) {
+                failed_ = true;
+                return -1;
+            }
+            int32_t childCount = encoded[pos++];
+            std::vector<int32_t> children;
+            children.reserve(childCount);
+            for (int32_t i = 0; i < childCount; ++i) {
+                children.push_back(parseNode(encoded, encodedSize, pos, weights, weightCount,
+                                             strings, depth + 1));
+                if (failed_) {
+                    return -1;
+                }
+            }
+            node.firstChild = (int32_t) children_.size();
+            node.childCount = childCount;
+            children_.insert(children_.end(), children.begin(), children.end());
+            break;
+        }
+        case NODE_OPTIONAL:
+            break;
+        case NODE_CAPTURE: {
+            if (pos + 2 > encodedSize) {
+                failed_ = true;
+                return -1;
+            }
+            node.id = encoded[pos++];
+            int32_t weightIndex = encoded[pos++];
+            if (weightIndex < 0 || (size_t) weightIndex >= weightCount) {
+                failed_ = true;
+                return -1;
+            }
+            node.weight = weights[weightIndex];
+            break;
+        }
+        default:
+            failed_ = true;
+            return -1;
+    }
+
+    nodes_.push_back(node);
+    return (int32_t) nodes_.size() - 1;
+}
+
+} // namespace matcher
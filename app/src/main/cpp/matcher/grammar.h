@@ -0,0 +1,129 @@
+#ifndef DICIO_MATCHER_GRAMMAR_H
+#define DICIO_MATCHER_GRAMMAR_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace matcher {
+
+/**
+ * 编译后语法的节点类型，数值必须与Kotlin端 CompiledGrammarBuilder 中的常量一致。
+ * 节点在int数组中以前序方式编码：
+ *   WORD:      [WORD, flags, stringIndex, weightIndex]
+ *   OR:        [OR, childCount, child...]
+ *   COMPOSITE: [COMPOSITE, childCount, child...]
+ *   OPTIONAL:  [OPTIONAL]
+ *   CAPTURE:   [CAPTURE, nameIndex, weightIndex]
+ */
+enum NodeType : uint8_t {
+    NODE_WORD = 0,
+    NODE_OR = 1,
+    NODE_COMPOSITE = 2,
+    NODE_OPTIONAL = 3,
+    NODE_CAPTURE = 4,
+};
+
+// WORD节点的flags位
+constexpr int WORD_FLAG_REGEX = 1;
+constexpr int WORD_FLAG_DIACRITICS_SENSITIVE = 2;
+
+struct Node {
+    uint8_t type;
+    uint8_t flags;
+    // WORD: 词表ID或正则表ID；CAPTURE: 名称在字符串表中的下标
+    int32_t id;
+    float weight;
+    int32_t firstChild; // 在 Grammar::children 中的起始下标
+    int32_t childCount;
+};
+
+/**
+ * 进程级的词表与正则表。所有语法共享同一个词表，这样输入只需要解析一次就能
+ * 被所有技能使用。只有编译语法和创建输入时才会加锁，评分过程是只读的。
+ */
+class Vocabulary {
+public:
+    static Vocabulary &instance();
+
+    int32_t intern(const std::string &word);
+    int32_t lookup(const std::string &word) const;
+    /**
+     * 已登记的词数。ID按登记顺序分配，创建输入前取一次：不小于它的ID都是之后才登记的词
+     */
+    int32_t wordCount() const;
+
+    /**
+     * std::regex按字节匹配，只接受与java.util.regex结果一定相同的正则：字面量（可以是UTF-8的
+     * 多字节字符）、(...)和(?:...)分组、|、^、$，以及跟在分组或ASCII字面量后面的?*+。
+     * 其他的正则（.、[...]、\w等遇到非ASCII字符时与Java不一致）和无法编译的正则返回-1，
+     * 整个语法编译失败，由Kotlin端的匹配器处理。
+     */
+    int32_t internRegex(const std::string &pattern);
+    /**
+     * 目前已编译的全部正则，下标是正则表ID。正则只会被追加，指针在进程生命周期内保持有效，
+     * 创建输入时取一次，评分时不再加锁
+     */
+    std::vector<const std::regex *> regexes() const;
+    /**
+     * 加锁查找一个正则，只用于创建输入之后才编译的语法（不在输入的快照里）
+     * @return id超出范围时返回nullptr
+     */
+    const std::regex *regex(int32_t id) const;
+
+private:
+    Vocabulary() = default;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, int32_t> words_;
+    std::unordered_map<std::string, int32_t> regexIds_;
+    std::vector<std::unique_ptr<std::regex>> regexes_;
+};
+
+/**
+ * 一组技能（通常是同一特异性等级的所有StandardRecognizerSkill）编译后的句子集合。
+ * 第i个技能拥有句子 [skillSentenceStart[i], skillSentenceStart[i+1])。
+ */
+class Grammar {
+public:
+    /**
+     * @return 解析失败时返回nullptr（编码损坏或下标越界）
+     */
+    static Grammar *parse(const int32_t *encoded, size_t encodedSize,
+                          const float *weights, size_t weightCount,
+                          const std::vector<std::string> &strings,
+                          const int32_t *sentenceRoots, size_t sentenceCount,
+                          const int32_t *skillSentenceCounts, size_t skillCount);
+
+    size_t skillCount() const { return skillSentenceStart_.size() - 1; }
+    size_t sentenceCount() const { return sentenceRoots_.size(); }
+    int32_t skillSentenceStart(size_t skill) const { return skillSentenceStart_[skill]; }
+    int32_t skillSentenceEnd(size_t skill) const { return skillSentenceStart_[skill + 1]; }
+    int32_t sentenceRoot(size_t sentence) const { return sentenceRoots_[sentence]; }
+
+    const Node &node(int32_t index) const { return nodes_[index]; }
+    int32_t child(const Node &node, int32_t i) const { return children_[node.firstChild + i]; }
+    // 句子嵌套最深的层数，用于预先分配DP缓冲区
+    int32_t maxDepth() const { return maxDepth_; }
+
+private:
+    Grammar() = default;
+    int32_t parseNode(const int32_t *encoded, size_t encodedSize, size_t &pos,
+                      const float *weights, size_t weightCount,
+                      const std::vector<std::string> &strings, int32_t depth);
+
+    std::vector<Node> nodes_;
+    std::vector<int32_t> children_;
+    std::vector<int32_t> sentenceRoots_;
+    std::vector<int32_t> skillSentenceStart_;
+    int32_t maxDepth_ = 0;
+    bool failed_ = false;
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_GRAMMAR_H
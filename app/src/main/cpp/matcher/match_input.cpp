@@ -0,0 +1,127 @@
+#include "match_input.h"
+
+#include <algorithm>
+#include <regex>
+
+#include "grammar.h"
+#include "tokenizer.h"
+
+namespace matcher {
+
+MatchInput::MatchInput(int32_t length,
+                       std::vector<int32_t> wordStarts, std::vector<int32_t> wordEnds,
+                       std::vector<std::string> originalWords,
+                       std::vector<std::string> normalizedWords,
+                       std::vector<float> cumulativeWeight,
+                       std::vector<int32_t> cumulativeWhitespace)
+        : length_(length),
+          wordStarts_(std::move(wordStarts)),
+          wordEnds_(std::move(wordEnds)),
+          cumulativeWeight_(std::move(cumulativeWeight)),
+          cumulativeWhitespace_(std::move(cumulativeWhitespace)),
+          wordIndexAt_(length + 1, -1) {
+    Vocabulary &vocabulary = Vocabulary::instance();
+    knownWords_ = vocabulary.wordCount();
+    originalIds_.reserve(wordStarts_.size());
+    normalizedIds_.reserve(wordStarts_.size());
+    originalOffsets_.reserve(wordStarts_.size() + 1);
+    normalizedOffsets_.reserve(wordStarts_.size() + 1);
+    originalOffsets_.push_back(0);
+    normalizedOffsets_.push_back(0);
+    for (size_t i = 0; i < wordStarts_.size(); ++i) {
+        // 不在任何语法中的词得到-1，永远不会与WORD节点匹配
+        originalIds_.push_back(vocabulary.lookup(originalWords[i]));
+        normalizedIds_.push_back(vocabulary.lookup(normalizedWords[i]));
+        originalText_ += originalWords[i];
+        normalizedText_ += normalizedWords[i];
+        originalOffsets_.push_back((int32_t) originalText_.size());
+        normalizedOffsets_.push_back((int32_t) normalizedText_.size());
+    }
+    initIndices();
+}
+
+MatchInput::MatchInput(const Tokenization &tokens)
+        : length_(tokens.length),
+          wordStarts_(tokens.wordStarts),
+          wordEnds_(tokens.wordEnds),
+          // 拼接文本和偏移整块复制，不再为每个词分配一个std::string
+          originalText_(tokens.originalText),
+          normalizedText_(tokens.foldedText),
+          originalOffsets_(tokens.originalOffsets),
+          normalizedOffsets_(tokens.foldedOffsets),
+          cumulativeWeight_(tokens.cumulativeWeight),
+          cumulativeWhitespace_(tokens.cumulativeWhitespace),
+          wordIndexAt_(tokens.length + 1, -1),
+          originalIds_(tokens.originalIds),
+          normalizedIds_(tokens.foldedIds),
+          knownWords_(tokens.vocabularyWords) {
+    initIndices();
+}
+
+void MatchInput::initIndices() {
+    for (size_t i = 0; i < wordStarts_.size(); ++i) {
+        wordIndexAt_[wordStarts_[i]] = (int32_t) i;
+    }
+    originalIdBag_ = originalIds_;
+    std::sort(originalIdBag_.begin(), originalIdBag_.end());
+    normalizedIdBag_ = normalizedIds_;
+    std::sort(normalizedIdBag_.begin(), normalizedIdBag_.end());
+
+    // 正则只会被追加，快照之后编译的正则由matchesRegex加锁查找
+    regexes_ = Vocabulary::instance().regexes();
+    size_t cacheSize = regexes_.size() * wordStarts_.size() * 2;
+    regexCache_.reset(new std::atomic<int8_t>[cacheSize]);
+    for (size_t i = 0; i < cacheSize; ++i) {
+        regexCache_[i].store(-1, std::memory_order_relaxed);
+    }
+}
+
+bool MatchInput::containsWord(int32_t wordId, bool diacriticsSensitive) const {
+    if (wordId >= knownWords_) {
+        return true;
+    }
+    const std::vector<int32_t> &bag = diacriticsSensitive ? originalIdBag_ : normalizedIdBag_;
+    return std::binary_search(bag.begin(), bag.end(), wordId);
+}
+
+void MatchInput::wordText(int32_t word, bool diacriticsSensitive,
+                          const char *&begin, const char *&end) const {
+    const std::string &text = diacriticsSensitive ? originalText_ : normalizedText_;
+    const std::vector<int32_t> &offsets = diacriticsSensitive ? originalOffsets_ : normalizedOffsets_;
+    begin = text.data() + offsets[word];
+    end = text.data() + offsets[word + 1];
+}
+
+bool MatchInput::matchesLateWord(int32_t word, int32_t wordId, bool diacriticsSensitive) const {
+    const char *begin;
+    const char *end;
+    wordText(word, diacriticsSensitive, begin, end);
+    return Vocabulary::instance().lookup(std::string(begin, end)) == wordId;
+}
+
+bool MatchInput::matchesRegex(int32_t word, int32_t regexId, bool diacriticsSensitive) const {
+    if ((size_t) regexId >= regexes_.size()) {
+        // 输入创建之后才编译的语法：不在快照和缓存里，加锁取正则、每次重新匹配
+        const std::regex *regex = Vocabulary::instance().regex(regexId);
+        const char *begin;
+        const char *end;
+        wordText(word, diacriticsSensitive, begin, end);
+        return regex != nullptr && std::regex_match(begin, end, *regex);
+    }
+
+    size_t slot = ((size_t) regexId * wordStarts_.size() + word) * 2 + (diacriticsSensitive ? 1 : 0);
+    int8_t cached = regexCache_[slot].load(std::memory_order_relaxed);
+    if (cached >= 0) {
+        return cached != 0;
+    }
+
+    const char *begin;
+    const char *end;
+    wordText(word, diacriticsSensitive, begin, end);
+    bool matches = std::regex_match(begin, end, *regexes_[regexId]);
+    // 并发计算同一格时写入的是同一个值，relaxed即可
+    regexCache_[slot].store(matches ? 1 : 0, std::memory_order_relaxed);
+    return matches;
+}
+
+} // namespace matcher
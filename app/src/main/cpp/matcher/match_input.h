@@ -0,0 +1,96 @@
+#ifndef DICIO_MATCHER_MATCH_INPUT_H
+#define DICIO_MATCHER_MATCH_INPUT_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace matcher {
+
+struct Tokenization;
+
+/**
+ * 一次用户输入的分词结果，对应Kotlin端的MatchHelper。创建后只读，
+ * 同一个输入会被线程池中的所有任务以及三轮特异性评估共享。
+ * 位置均以UTF-16码元为单位，与Kotlin字符串下标一致。
+ */
+class MatchInput {
+public:
+    MatchInput(int32_t length,
+               std::vector<int32_t> wordStarts, std::vector<int32_t> wordEnds,
+               std::vector<std::string> originalWords, std::vector<std::string> normalizedWords,
+               std::vector<float> cumulativeWeight, std::vector<int32_t> cumulativeWhitespace);
+
+    // tokens必须是传入了词表的Tokenizer::tokenize的结果
+    explicit MatchInput(const Tokenization &tokens);
+
+    int32_t length() const { return length_; }
+    size_t wordCount() const { return wordStarts_.size(); }
+    int32_t wordStart(int32_t word) const { return wordStarts_[word]; }
+    int32_t wordEnd(int32_t word) const { return wordEnds_[word]; }
+    // 所有词的小写原文/折叠文本依次拼接，第i个词为 [offsets[i], offsets[i+1])，与Tokenization相同
+    const std::string &originalText() const { return originalText_; }
+    const std::string &normalizedText() const { return normalizedText_; }
+    const std::vector<int32_t> &originalOffsets() const { return originalOffsets_; }
+    const std::vector<int32_t> &normalizedOffsets() const { return normalizedOffsets_; }
+    // 以start开头的词的下标，没有则为-1（对应splitWordsIndices）
+    int32_t wordStartingAt(int32_t start) const { return wordIndexAt_[start]; }
+
+    const float *cumulativeWeight() const { return cumulativeWeight_.data(); }
+    const int32_t *cumulativeWhitespace() const { return cumulativeWhitespace_.data(); }
+
+    /**
+     * 判断第word个输入词是否匹配词表中的wordId。
+     * @param diacriticsSensitive 为true时比较原始小写文本，否则比较NFKD折叠后的文本
+     */
+    bool matchesWord(int32_t word, int32_t wordId, bool diacriticsSensitive) const {
+        const int32_t id = diacriticsSensitive ? originalIds_[word] : normalizedIds_[word];
+        // 创建时不在词表中的词可能被之后编译的语法登记，只有这种情况需要重新查找
+        return id == wordId
+                || (id < 0 && wordId >= knownWords_ && matchesLateWord(word, wordId, diacriticsSensitive));
+    }
+
+    /**
+     * 输入中是否有词匹配wordId（不考虑位置），用于估计句子得分的上界。
+     * 创建输入之后才登记的词一律返回true
+     */
+    bool containsWord(int32_t wordId, bool diacriticsSensitive) const;
+
+    // 正则匹配结果按 (regexId, word, 是否区分变音符) 惰性缓存，多个线程可以同时调用
+    bool matchesRegex(int32_t word, int32_t regexId, bool diacriticsSensitive) const;
+
+private:
+    void initIndices();
+    // 第word个词在拼接文本中的范围
+    void wordText(int32_t word, bool diacriticsSensitive, const char *&begin, const char *&end) const;
+    bool matchesLateWord(int32_t word, int32_t wordId, bool diacriticsSensitive) const;
+
+    int32_t length_;
+    std::vector<int32_t> wordStarts_;
+    std::vector<int32_t> wordEnds_;
+    std::string originalText_;
+    std::string normalizedText_;
+    std::vector<int32_t> originalOffsets_;
+    std::vector<int32_t> normalizedOffsets_;
+    std::vector<float> cumulativeWeight_;
+    std::vector<int32_t> cumulativeWhitespace_;
+    std::vector<int32_t> wordIndexAt_;
+    std::vector<int32_t> originalIds_;
+    std::vector<int32_t> normalizedIds_;
+    // 创建时词表里的词数，不小于它的ID是之后登记的词
+    int32_t knownWords_;
+    // 排序后的ID集合
+    std::vector<int32_t> originalIdBag_;
+    std::vector<int32_t> normalizedIdBag_;
+
+    std::vector<const std::regex *> regexes_;
+    // -1 未计算, 0 不匹配, 1 匹配
+    std::unique_ptr<std::atomic<int8_t>[]> regexCache_;
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_MATCH_INPUT_H
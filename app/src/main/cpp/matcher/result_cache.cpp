@@ -0,0 +1,93 @@
+#include "result_cache.h"
+
+namespace matcher {
+
+TokenKey TokenKey::of(const MatchInput &input) {
+    TokenKey key;
+    key.length = input.length();
+    key.spans.reserve(input.wordCount() * 2);
+    for (int32_t i = 0; i < (int32_t) input.wordCount(); ++i) {
+        key.spans.push_back(input.wordStart(i));
+        key.spans.push_back(input.wordEnd(i));
+    }
+    key.originalText = input.originalText();
+    key.normalizedText = input.normalizedText();
+    key.originalOffsets = input.originalOffsets();
+    key.normalizedOffsets = input.normalizedOffsets();
+    key.cumulativeWeight.assign(input.cumulativeWeight(),
+                                input.cumulativeWeight() + input.length() + 1);
+    key.cumulativeWhitespace.assign(input.cumulativeWhitespace(),
+                                    input.cumulativeWhitespace() + input.length() + 1);
+    return key;
+}
+
+bool TokenKey::operator==(const TokenKey &other) const {
+    return length == other.length
+            && spans == other.spans
+            && originalText == other.originalText
+            && normalizedText == other.normalizedText
+            && originalOffsets == other.originalOffsets
+            && normalizedOffsets == other.normalizedOffsets
+            && cumulativeWeight == other.cumulativeWeight
+            && cumulativeWhitespace == other.cumulativeWhitespace;
+}
+
+ResultCache::ResultCache(const Grammar &grammar, BatchScorer &scorer, bool pruneSkills)
+        : grammar_(grammar), scorer_(scorer), pruneSkills_(pruneSkills) {
+    entries_.reserve(CAPACITY);
+}
+
+bool ResultCache::score(const MatchInput &input, std::vector<SkillResult> &results) {
+    TokenKey key = TokenKey::of(input);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++clock_;
+        for (Entry &entry : entries_) {
+            if (entry.key == key) {
+                entry.lastUse = clock_;
+                results = entry.results;
+                ++stats_.hits;
+                return true;
+            }
+        }
+        ++stats_.misses;
+    }
+
+    // 打分时不持有锁，其他输入的查找不必等待；同一个词序列同时未命中时会各自打分，
+    // 结果相同，只保留先插入的条目
+    scorer_.scoreAll(grammar_, input, results, pruneSkills_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++clock_;
+    for (Entry &entry : entries_) {
+        if (entry.key == key) {
+            entry.lastUse = clock_;
+            return false;
+        }
+    }
+
+    Entry *slot;
+    if (entries_.size() < CAPACITY) {
+        entries_.emplace_back();
+        slot = &entries_.back();
+    } else {
+        slot = &entries_[0];
+        for (Entry &entry : entries_) {
+            if (entry.lastUse < slot->lastUse) {
+                slot = &entry;
+            }
+        }
+    }
+    slot->key = std::move(key);
+    slot->results = results;
+    slot->lastUse = clock_;
+    return false;
+}
+
+ResultCacheStats ResultCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace matcher
@@ -0,0 +1,84 @@
+#ifndef DICIO_MATCHER_RESULT_CACHE_H
+#define DICIO_MATCHER_RESULT_CACHE_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "batch_scorer.h"
+#include "grammar.h"
+#include "match_input.h"
+
+namespace matcher {
+
+/**
+ * 决定一个MatchInput得分的全部分词数据：词的范围、原始/折叠文本以及两个累积数组。
+ * 两个输入的TokenKey相等时，任何语法在它们上面的得分都完全相同。
+ */
+struct TokenKey {
+    int32_t length = 0;
+    std::vector<int32_t> spans; // 每个词两个值: start, end
+    std::string originalText; // 见MatchInput::originalText
+    std::string normalizedText;
+    std::vector<int32_t> originalOffsets;
+    std::vector<int32_t> normalizedOffsets;
+    std::vector<float> cumulativeWeight;
+    std::vector<int32_t> cumulativeWhitespace;
+
+    static TokenKey of(const MatchInput &input);
+
+    bool operator==(const TokenKey &other) const;
+};
+
+struct ResultCacheStats {
+    uint64_t hits;   // 结果直接来自缓存
+    uint64_t misses; // 整体重新打分
+};
+
+/**
+ * 最近几个输入的打分结果缓存，每个语法一个实例，线程安全。
+ * 按词序列缓存每技能最佳句子，ASR的部分结果到来时提前在线程池上打分，最终结果与某个
+ * 部分结果的词序列完全相同时直接返回缓存，不需要再次打分。
+ *
+ * 不保存DP状态，也不会从公共前缀继续计算：DP从输入末尾向前计算，memToEnd依赖整个后缀，
+ * 追加词之后所有位置的值都会变化；为了与Kotlin端的float计算顺序保持一致，缓存没有命中时
+ * 整体重新打分。
+ */
+class ResultCache {
+public:
+    /**
+     * @param pruneSkills 传给 BatchScorer::scoreAll
+     */
+    ResultCache(const Grammar &grammar, BatchScorer &scorer, bool pruneSkills);
+
+    /**
+     * 只在查找和插入时持有锁，打分在锁外进行。
+     * @param results 大小会被设置为 grammar.skillCount()
+     * @return 结果来自缓存时返回true
+     */
+    bool score(const MatchInput &input, std::vector<SkillResult> &results);
+
+    ResultCacheStats stats() const;
+
+private:
+    struct Entry {
+        TokenKey key;
+        std::vector<SkillResult> results;
+        uint64_t lastUse;
+    };
+
+    static constexpr size_t CAPACITY = 4;
+
+    const Grammar &grammar_;
+    BatchScorer &scorer_;
+    const bool pruneSkills_;
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+    uint64_t clock_ = 0;
+    ResultCacheStats stats_ = {0, 0};
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_RESULT_CACHE_H
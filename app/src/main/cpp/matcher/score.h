@@ -0,0 +1,57 @@
+#ifndef DICIO_MATCHER_SCORE_H
+#define DICIO_MATCHER_SCORE_H
+
+namespace matcher {
+
+/**
+ * 与Kotlin端 org.dicio.skill.standard.StandardScore 数值上完全一致的评分结构，
+ * 但不包含捕获组树（捕获组只在最终选中的句子上由Kotlin重新计算）。
+ * 注意：计算顺序必须与Kotlin保持一致，否则float舍入会导致排序不同。
+ */
+struct Score {
+    float userMatched;
+    float userWeight;
+    float refMatched;
+    float refWeight;
+
+    static constexpr float UM = 2.0f;
+    static constexpr float UW = -1.1f;
+    static constexpr float RM = 2.0f;
+    static constexpr float RW = -1.1f;
+
+    float value() const {
+        return UM * userMatched + UW * userWeight + RM * refMatched + RW * refWeight;
+    }
+
+    Score plus(float um, float uw, float rm, float rw) const {
+        Score s = {userMatched + um, userWeight + uw, refMatched + rm, refWeight + rw};
+        return s;
+    }
+
+    Score plusRefWeight(float rw) const {
+        Score s = {userMatched, userWeight, refMatched, refWeight + rw};
+        return s;
+    }
+
+    Score plusUserWeight(float uw) const {
+        Score s = {userMatched, userWeight + uw, refMatched, refWeight};
+        return s;
+    }
+
+    // 对应 StandardScore.keepBest(m1, m2)：只有m2严格更好时才替换
+    static const Score &keepBest(const Score &m1, const Score &m2) {
+        return m2.value() > m1.value() ? m2 : m1;
+    }
+
+    // 对应 StandardScore.scoreIn01Range()
+    float in01Range() const {
+        if (userMatched <= 0.0f || userWeight <= 0.0f || refMatched <= 0.0f || refWeight <= 0.0f) {
+            return 0.0f;
+        }
+        return 2.0f / (userWeight / userMatched + refWeight / refMatched);
+    }
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_SCORE_H
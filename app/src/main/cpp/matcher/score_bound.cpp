@@ -0,0 +1,79 @@
+#include "score_bound.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "score.h"
+
+namespace matcher {
+
+namespace {
+
+// 相对舍入余量，DP中每个分量都是几十次float加法的结果，1e-3远大于累积误差
+constexpr float ROUNDING_MARGIN = 1e-3f;
+
+} // namespace
+
+float ScoreBound::sentence(const Grammar &grammar, int32_t sentence, const MatchInput &input) {
+    const float inputWeight = input.cumulativeWeight()[input.length()];
+    // 只有空白的输入无法被捕获
+    const bool canCapture = input.length() > input.cumulativeWhitespace()[input.length()];
+    const Bound bound = node(grammar, grammar.sentenceRoot(sentence), input,
+                             inputWeight, canCapture);
+
+    const float userMatched = std::min(inputWeight, bound.matchable);
+    const float value = Score::UM * userMatched + Score::UW * inputWeight + bound.ref;
+    return value + ROUNDING_MARGIN * (1.0f + 4.0f * inputWeight + 2.0f * bound.absWeight);
+}
+
+ScoreBound::Bound ScoreBound::node(const Grammar &grammar, int32_t nodeIndex,
+                                   const MatchInput &input, float inputWeight, bool canCapture) {
+    const Node &n = grammar.node(nodeIndex);
+    const float matched = (Score::RM + Score::RW) * n.weight;
+    const float skipped = Score::RW * n.weight;
+
+    switch (n.type) {
+        case NODE_WORD: {
+            const bool sensitive = (n.flags & WORD_FLAG_DIACRITICS_SENSITIVE) != 0;
+            const bool mayMatch = (n.flags & WORD_FLAG_REGEX) != 0
+                    ? input.wordCount() > 0
+                    : input.containsWord(n.id, sensitive);
+            return mayMatch ? Bound{1.0f, std::max(matched, skipped), std::fabs(n.weight)}
+                            : Bound{0.0f, skipped, std::fabs(n.weight)};
+        }
+        case NODE_CAPTURE:
+            return canCapture
+                    ? Bound{inputWeight, std::max(matched, skipped), std::fabs(n.weight)}
+                    : Bound{0.0f, skipped, std::fabs(n.weight)};
+        case NODE_COMPOSITE: {
+            Bound sum = {0.0f, 0.0f, 0.0f};
+            for (int32_t i = 0; i < n.childCount; ++i) {
+                const Bound child = node(grammar, grammar.child(n, i), input,
+                                         inputWeight, canCapture);
+                sum.matchable += child.matchable;
+                sum.ref += child.ref;
+                sum.absWeight += child.absWeight;
+            }
+            return sum;
+        }
+        case NODE_OR: {
+            if (n.childCount == 0) {
+                return Bound{0.0f, 0.0f, 0.0f};
+            }
+            Bound best = node(grammar, grammar.child(n, 0), input, inputWeight, canCapture);
+            for (int32_t i = 1; i < n.childCount; ++i) {
+                const Bound child = node(grammar, grammar.child(n, i), input,
+                                         inputWeight, canCapture);
+                best.matchable = std::max(best.matchable, child.matchable);
+                best.ref = std::max(best.ref, child.ref);
+                best.absWeight = std::max(best.absWeight, child.absWeight);
+            }
+            return best;
+        }
+        case NODE_OPTIONAL:
+        default:
+            return Bound{0.0f, 0.0f, 0.0f};
+    }
+}
+
+} // namespace matcher
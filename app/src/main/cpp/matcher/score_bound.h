@@ -0,0 +1,37 @@
+#ifndef DICIO_MATCHER_SCORE_BOUND_H
+#define DICIO_MATCHER_SCORE_BOUND_H
+
+#include <cstdint>
+
+#include "grammar.h"
+#include "match_input.h"
+
+namespace matcher {
+
+/**
+ * 不运行DP，只根据输入中出现的词ID集合估计句子得分 Score::value() 的上界。
+ *
+ * 任何一条匹配路径上：userWeight总是等于整个输入的权重W；每个WORD/CAPTURE节点要么匹配
+ * （RM*w + RW*w，并且为userMatched贡献至多一个词的权重1，CAPTURE可以是整个输入），
+ * 要么跳过（RW*w）；userMatched不超过W。WORD只有在输入中出现时才可能匹配，正则总是认为可能匹配。
+ * 所以 value <= UM*min(W, M) + UW*W + R，M和R分别是所有路径上可匹配词数和参考得分的最大值。
+ * 结果已经加上了float舍入的余量，可以直接与DP算出的得分比较。
+ */
+class ScoreBound {
+public:
+    static float sentence(const Grammar &grammar, int32_t sentence, const MatchInput &input);
+
+private:
+    struct Bound {
+        float matchable; // M
+        float ref;       // R
+        float absWeight; // 所有权重绝对值之和，用于计算舍入余量
+    };
+
+    static Bound node(const Grammar &grammar, int32_t nodeIndex, const MatchInput &input,
+                      float inputWeight, bool canCapture);
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_SCORE_BOUND_H
@@ -0,0 +1,172 @@
+#include "sentence_matcher.h"
+
+#include <algorithm>
+
+namespace matcher {
+
+Score SentenceMatcher::scoreSentence(const Grammar &grammar, int32_t sentence,
+                                     const MatchInput &input) {
+    const size_t size = (size_t) input.length() + 1;
+    const float *cumulativeWeight = input.cumulativeWeight();
+    const float endWeight = cumulativeWeight[input.length()];
+
+    // 对应 initialMemToEnd()
+    Score *memToEnd = acquire(size);
+    for (size_t start = 0; start < size; ++start) {
+        memToEnd[start] = {0.0f, endWeight - cumulativeWeight[start], 0.0f, 0.0f};
+    }
+
+    matchToEnd(grammar, grammar.sentenceRoot(sentence), memToEnd, input);
+    Score result = memToEnd[0];
+    release();
+    return result;
+}
+
+void SentenceMatcher::matchToEnd(const Grammar &grammar, int32_t nodeIndex,
+                                 Score *memToEnd, const MatchInput &input) {
+    const Node &node = grammar.node(nodeIndex);
+    switch (node.type) {
+        case NODE_WORD:
+            matchWord(node, memToEnd, input);
+            break;
+        case NODE_OR:
+            matchOr(grammar, node, memToEnd, input);
+            break;
+        case NODE_COMPOSITE:
+            for (int32_t i = node.childCount - 1; i >= 0; --i) {
+                matchToEnd(grammar, grammar.child(node, i), memToEnd, input);
+            }
+            normalize(memToEnd, input);
+            break;
+        case NODE_CAPTURE:
+            matchCapture(node, memToEnd, input);
+            break;
+        case NODE_OPTIONAL:
+        default:
+            break;
+    }
+}
+
+void SentenceMatcher::matchWord(const Node &node, Score *memToEnd, const MatchInput &input) {
+    const float *cumulativeWeight = input.cumulativeWeight();
+    const bool isRegex = (node.flags & WORD_FLAG_REGEX) != 0;
+    const bool diacriticsSensitive = (node.flags & WORD_FLAG_DIACRITICS_SENSITIVE) != 0;
+    const float weight = node.weight;
+
+    for (int32_t start = 0; start <= input.length(); ++start) {
+        const int32_t word = input.wordStartingAt(start);
+        if (word >= 0) {
+            const bool matches = isRegex
+                    ? input.matchesRegex(word, node.id, diacriticsSensitive)
+                    : input.matchesWord(word, node.id, diacriticsSensitive);
+            if (matches) {
+                const int32_t end = input.wordEnd(word);
+                const float userWeight = cumulativeWeight[end] - cumulativeWeight[start];
+                const Score ifMatching = memToEnd[end].plus(userWeight, userWeight, weight, weight);
+                const Score ifSkipping = memToEnd[start].plusRefWeight(weight);
+                memToEnd[start] = Score::keepBest(ifMatching, ifSkipping);
+                continue;
+            }
+        }
+
+        memToEnd[start] = memToEnd[start].plusRefWeight(weight);
+    }
+
+    normalize(memToEnd, input);
+}
+
+void SentenceMatcher::matchOr(const Grammar &grammar, const Node &node, Score *memToEnd,
+                              const MatchInput &input) {
+    if (node.childCount == 0) {
+        // 与OrConstruct一致，空的或列表等同于OptionalConstruct
+        return;
+    }
+
+    const size_t size = (size_t) input.length() + 1;
+    Score *best = acquire(size);
+    std::copy(memToEnd, memToEnd + size, best);
+    matchToEnd(grammar, grammar.child(node, 0), best, input);
+
+    for (int32_t j = 1; j < node.childCount; ++j) {
+        Score *alternative = acquire(size);
+        std::copy(memToEnd, memToEnd + size, alternative);
+        matchToEnd(grammar, grammar.child(node, j), alternative, input);
+        for (size_t start = 0; start < size; ++start) {
+            best[start] = Score::keepBest(best[start], alternative[start]);
+        }
+        release();
+    }
+
+    std::copy(best, best + size, memToEnd);
+    release();
+    normalize(memToEnd, input);
+}
+
+void SentenceMatcher::matchCapture(const Node &node, Score *memToEnd, const MatchInput &input) {
+    const float *cumulativeWeight = input.cumulativeWeight();
+    const int32_t *cumulativeWhitespace = input.cumulativeWhitespace();
+    const float weight = node.weight;
+    const int32_t length = input.length();
+
+    Score *original = acquire((size_t) length + 1);
+    std::copy(memToEnd, memToEnd + length + 1, original);
+
+    int32_t lastCapturingGroupEnd = length;
+    for (int32_t start = length - 1; start >= 0; --start) {
+        const float userWeight =
+                cumulativeWeight[lastCapturingGroupEnd] - cumulativeWeight[start];
+        const bool hasOnlyWhitespace = (lastCapturingGroupEnd - start) ==
+                (cumulativeWhitespace[lastCapturingGroupEnd] - cumulativeWhitespace[start]);
+
+        const Score ifSkipping = memToEnd[start].plusRefWeight(weight);
+        if (hasOnlyWhitespace) {
+            memToEnd[start] = ifSkipping;
+            continue;
+        }
+
+        const Score ifContinuing = original[lastCapturingGroupEnd].plus(
+                userWeight, userWeight, weight, weight);
+
+        if (ifContinuing.value() >= ifSkipping.value()) {
+            memToEnd[start] = ifContinuing;
+
+            const Score ifCreatingNew = original[start].plus(0.0f, 0.0f, weight, weight);
+            if (ifCreatingNew.value() > ifContinuing.value()) {
+                lastCapturingGroupEnd = start;
+            }
+        } else {
+            lastCapturingGroupEnd = start;
+            memToEnd[start] = ifSkipping;
+        }
+    }
+
+    memToEnd[length] = memToEnd[length].plusRefWeight(weight);
+    release();
+    normalize(memToEnd, input);
+}
+
+void SentenceMatcher::normalize(Score *memToEnd, const MatchInput &input) {
+    const float *cumulativeWeight = input.cumulativeWeight();
+    for (int32_t i = input.length() - 1; i >= 0; --i) {
+        memToEnd[i] = Score::keepBest(
+                memToEnd[i],
+                memToEnd[i + 1].plusUserWeight(cumulativeWeight[i + 1] - cumulativeWeight[i]));
+    }
+}
+
+Score *SentenceMatcher::acquire(size_t size) {
+    if (used_ == buffers_.size()) {
+        buffers_.emplace_back();
+    }
+    std::vector<Score> &buffer = buffers_[used_++];
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    return buffer.data();
+}
+
+void SentenceMatcher::release() {
+    --used_;
+}
+
+} // namespace matcher
@@ -0,0 +1,44 @@
+#ifndef DICIO_MATCHER_SENTENCE_MATCHER_H
+#define DICIO_MATCHER_SENTENCE_MATCHER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "grammar.h"
+#include "match_input.h"
+#include "score.h"
+
+namespace matcher {
+
+/**
+ * Kotlin端 Construct.matchToEnd 的原生实现（只计算分数，不构造捕获组）。
+ * 每个线程持有一个实例，内部的DP缓冲区在多次调用之间复用，评分过程中不分配内存。
+ * 非线程安全。
+ */
+class SentenceMatcher {
+public:
+    /**
+     * @return 第sentence个句子匹配整个输入的最佳得分，即Kotlin中的memToEnd[0]
+     */
+    Score scoreSentence(const Grammar &grammar, int32_t sentence, const MatchInput &input);
+
+private:
+    void matchToEnd(const Grammar &grammar, int32_t nodeIndex,
+                    Score *memToEnd, const MatchInput &input);
+    void matchWord(const Node &node, Score *memToEnd, const MatchInput &input);
+    void matchOr(const Grammar &grammar, const Node &node, Score *memToEnd,
+                 const MatchInput &input);
+    void matchCapture(const Node &node, Score *memToEnd, const MatchInput &input);
+    static void normalize(Score *memToEnd, const MatchInput &input);
+
+    // 以栈的方式分配长度为 input.length()+1 的缓冲区
+    Score *acquire(size_t size);
+    void release();
+
+    std::vector<std::vector<Score>> buffers_;
+    size_t used_ = 0;
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_SENTENCE_MATCHER_H
@@ -0,0 +1,257 @@
+#include "tokenizer.h"
+
+#include <algorithm>
+
+#include "unicode_tables.h"
+
+namespace matcher {
+
+namespace {
+
+// 与Tokenizers.kt中的常量一致
+constexpr float WORD_WEIGHT = 1.0f;
+constexpr float CHAR_WEIGHT = 0.1f;
+constexpr float PUNCTUATION_WEIGHT = 0.05f;
+constexpr float WHITESPACE_WEIGHT = 0.0f;
+
+constexpr uint32_t CAPITAL_I_WITH_DOT = 0x0130;
+constexpr uint32_t CAPITAL_SIGMA = 0x03A3;
+constexpr uint32_t FINAL_SIGMA = 0x03C2;
+constexpr uint32_t COMBINING_DOT_ABOVE = 0x0307;
+
+constexpr uint32_t HANGUL_S_BASE = 0xAC00;
+constexpr uint32_t HANGUL_L_BASE = 0x1100;
+constexpr uint32_t HANGUL_V_BASE = 0x1161;
+constexpr uint32_t HANGUL_T_BASE = 0x11A7;
+constexpr uint32_t HANGUL_V_COUNT = 21;
+constexpr uint32_t HANGUL_T_COUNT = 28;
+constexpr uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+constexpr uint32_t HANGUL_S_COUNT = 19 * HANGUL_N_COUNT;
+
+inline bool bitmapContains(const uint32_t *bitmap, uint32_t codePoint) {
+    return (bitmap[codePoint >> 5] >> (codePoint & 31)) & 1;
+}
+
+inline bool isHighSurrogate(char16_t unit) { return unit >= 0xD800 && unit < 0xDC00; }
+inline bool isLowSurrogate(char16_t unit) { return unit >= 0xDC00 && unit < 0xE000; }
+
+// 读取position处的码位，返回占用的UTF-16码元数；孤立的代理项原样返回
+inline int32_t decode(const char16_t *text, int32_t length, int32_t position,
+                      uint32_t &codePoint) {
+    const char16_t unit = text[position];
+    if (isHighSurrogate(unit) && position + 1 < length && isLowSurrogate(text[position + 1])) {
+        codePoint = 0x10000 + (((uint32_t) unit - 0xD800) << 10)
+                + ((uint32_t) text[position + 1] - 0xDC00);
+        return 2;
+    }
+    codePoint = unit;
+    return 1;
+}
+
+// 修改版UTF-8：每个UTF-16码元单独编码，U+0000编码为两个字节
+inline void appendUnit(std::string &out, char16_t unit) {
+    if (unit != 0 && unit < 0x80) {
+        out.push_back((char) unit);
+    } else if (unit < 0x800) {
+        out.push_back((char) (0xC0 | (unit >> 6)));
+        out.push_back((char) (0x80 | (unit & 0x3F)));
+    } else {
+        out.push_back((char) (0xE0 | (unit >> 12)));
+        out.push_back((char) (0x80 | ((unit >> 6) & 0x3F)));
+        out.push_back((char) (0x80 | (unit & 0x3F)));
+    }
+}
+
+inline void appendCodePoint(std::string &out, uint32_t codePoint) {
+    if (codePoint >= 0x10000) {
+        codePoint -= 0x10000;
+        appendUnit(out, (char16_t) (0xD800 + (codePoint >> 10)));
+        appendUnit(out, (char16_t) (0xDC00 + (codePoint & 0x3FF)));
+    } else {
+        appendUnit(out, (char16_t) codePoint);
+    }
+}
+
+void appendFolded(std::string &out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        out.push_back((char) codePoint);
+        return;
+    }
+    if (codePoint >= 0x0300 && codePoint < 0x0370) {
+        // \p{InCombiningDiacriticalMarks}
+        return;
+    }
+    if (codePoint >= HANGUL_S_BASE && codePoint < HANGUL_S_BASE + HANGUL_S_COUNT) {
+        const uint32_t index = codePoint - HANGUL_S_BASE;
+        appendUnit(out, (char16_t) (HANGUL_L_BASE + index / HANGUL_N_COUNT));
+        appendUnit(out, (char16_t) (HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT));
+        if (index % HANGUL_T_COUNT != 0) {
+            appendUnit(out, (char16_t) (HANGUL_T_BASE + index % HANGUL_T_COUNT));
+        }
+        return;
+    }
+
+    const unicode::Fold *end = unicode::FOLD + unicode::FOLD_COUNT;
+    const unicode::Fold *fold = std::lower_bound(
+            unicode::FOLD, end, codePoint,
+            [](const unicode::Fold &f, uint32_t cp) { return f.codePoint < cp; });
+    if (fold != end && fold->codePoint == codePoint) {
+        for (int32_t i = 0; i < fold->length; ++i) {
+            appendUnit(out, unicode::FOLD_DATA[fold->offset + i]);
+        }
+    } else {
+        appendCodePoint(out, codePoint);
+    }
+}
+
+} // namespace
+
+bool Tokenizer::isLetter(uint32_t codePoint) {
+    if (codePoint < 0x10000) {
+        return bitmapContains(unicode::LETTER_BMP, codePoint);
+    }
+    const unicode::Range *end = unicode::LETTER_SUPPLEMENTARY + unicode::LETTER_SUPPLEMENTARY_COUNT;
+    const unicode::Range *range = std::lower_bound(
+            unicode::LETTER_SUPPLEMENTARY, end, codePoint,
+            [](const unicode::Range &r, uint32_t cp) { return r.last < cp; });
+    return range != end && range->first <= codePoint;
+}
+
+bool Tokenizer::isCased(uint32_t codePoint) {
+    return codePoint < 0x10000 && bitmapContains(unicode::CASED_BMP, codePoint);
+}
+
+uint32_t Tokenizer::toLowerCase(uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        return (codePoint >= 'A' && codePoint <= 'Z') ? codePoint + ('a' - 'A') : codePoint;
+    }
+    const unicode::Mapping *end = unicode::LOWERCASE + unicode::LOWERCASE_COUNT;
+    const unicode::Mapping *mapping = std::lower_bound(
+            unicode::LOWERCASE, end, codePoint,
+            [](const unicode::Mapping &m, uint32_t cp) { return m.from < cp; });
+    return (mapping != end && mapping->from == codePoint) ? mapping->to : codePoint;
+}
+
+bool Tokenizer::isWhitespace(char16_t unit) {
+    // Kotlin的Char.isWhitespace()：Character.isWhitespace() || Character.isSpaceChar()
+    if (unit < 0x80) {
+        return unit == ' ' || (unit >= 0x09 && unit <= 0x0D) || (unit >= 0x1C && unit <= 0x1F);
+    }
+    return unit == 0x00A0 || unit == 0x1680 || (unit >= 0x2000 && unit <= 0x200A)
+            || unit == 0x2028 || unit == 0x2029 || unit == 0x202F || unit == 0x205F
+            || unit == 0x3000;
+}
+
+bool Tokenizer::isPunctuation(char16_t unit) {
+    return (unit >= 0x21 && unit <= 0x2F) || (unit >= 0x3A && unit <= 0x40)
+            || (unit >= 0x5B && unit <= 0x60) || (unit >= 0x7B && unit <= 0x7E);
+}
+
+void Tokenizer::tokenize(const char16_t *text, int32_t length, const Vocabulary *vocabulary,
+                         Tokenization &out) {
+    // 每个码元最多是一个词；每个码元（或代理对）转小写后编码为修改版UTF-8最多3个字节（或6个），
+    // 所以原文的容量是精确的上界。折叠最多能展开MAX_FOLD_LENGTH倍，但只有极少数兼容字符如此，
+    // 按原文大小预留，超出时才会重新分配
+    const size_t maxWords = (size_t) length;
+    out.length = length;
+    out.wordStarts.clear();
+    out.wordStarts.reserve(maxWords);
+    out.wordEnds.clear();
+    out.wordEnds.reserve(maxWords);
+    out.originalText.clear();
+    out.originalText.reserve((size_t) length * 3);
+    out.foldedText.clear();
+    out.foldedText.reserve((size_t) length * 3);
+    out.originalOffsets.clear();
+    out.originalOffsets.reserve(maxWords + 1);
+    out.originalOffsets.push_back(0);
+    out.foldedOffsets.clear();
+    out.foldedOffsets.reserve(maxWords + 1);
+    out.foldedOffsets.push_back(0);
+    out.originalIds.clear();
+    out.foldedIds.clear();
+    out.vocabularyWords = 0;
+    if (vocabulary != nullptr) {
+        out.vocabularyWords = vocabulary->wordCount();
+        out.originalIds.reserve(maxWords);
+        out.foldedIds.reserve(maxWords);
+        out.lookupKey.reserve(64);
+    }
+    out.cumulativeWeight.resize((size_t) length + 1);
+    out.cumulativeWhitespace.resize((size_t) length + 1);
+
+    float *weight = out.cumulativeWeight.data();
+    int32_t *whitespace = out.cumulativeWhitespace.data();
+    weight[0] = 0.0f;
+    whitespace[0] = 0;
+
+    int32_t position = 0;
+    while (position < length) {
+        uint32_t codePoint;
+        int32_t units = decode(text, length, position, codePoint);
+        if (!isLetter(codePoint)) {
+            const char16_t unit = text[position];
+            const bool isSpace = isWhitespace(unit);
+            weight[position + 1] = weight[position] + (isSpace ? WHITESPACE_WEIGHT
+                    : isPunctuation(unit) ? PUNCTUATION_WEIGHT : CHAR_WEIGHT);
+            whitespace[position + 1] = whitespace[position] + (isSpace ? 1 : 0);
+            ++position;
+            continue;
+        }
+
+        const int32_t start = position;
+        bool previousCased = false;
+        do {
+            position += units;
+            uint32_t next = 0;
+            int32_t nextUnits = 0;
+            if (position < length) {
+                nextUnits = decode(text, length, position, next);
+                if (!isLetter(next)) {
+                    nextUnits = 0;
+                }
+            }
+
+            if (codePoint == CAPITAL_I_WITH_DOT) {
+                out.originalText.push_back('i');
+                appendUnit(out.originalText, (char16_t) COMBINING_DOT_ABOVE);
+                out.foldedText.push_back('i');
+            } else {
+                uint32_t lower = toLowerCase(codePoint);
+                if (codePoint == CAPITAL_SIGMA && previousCased
+                        && (nextUnits == 0 || !isCased(next))) {
+                    lower = FINAL_SIGMA;
+                }
+                appendCodePoint(out.originalText, lower);
+                appendFolded(out.foldedText, lower);
+            }
+
+            previousCased = isCased(codePoint);
+            codePoint = next;
+            units = nextUnits;
+        } while (units != 0);
+
+        const float wordWeight = WORD_WEIGHT / (float) (position - start);
+        for (int32_t i = start; i < position; ++i) {
+            weight[i + 1] = weight[i] + wordWeight;
+            whitespace[i + 1] = whitespace[i];
+        }
+
+        out.wordStarts.push_back(start);
+        out.wordEnds.push_back(position);
+        out.originalOffsets.push_back((int32_t) out.originalText.size());
+        out.foldedOffsets.push_back((int32_t) out.foldedText.size());
+
+        if (vocabulary != nullptr) {
+            const size_t word = out.wordStarts.size() - 1;
+            out.lookupKey.assign(out.originalText, out.originalOffsets[word],
+                                 out.originalOffsets[word + 1] - out.originalOffsets[word]);
+            out.originalIds.push_back(vocabulary->lookup(out.lookupKey));
+            out.lookupKey.assign(out.foldedText, out.foldedOffsets[word],
+                                 out.foldedOffsets[word + 1] - out.foldedOffsets[word]);
+            out.foldedIds.push_back(vocabulary->lookup(out.lookupKey));
+        }
+    }
+}
+
+} // namespace matcher
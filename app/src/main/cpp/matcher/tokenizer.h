@@ -0,0 +1,74 @@
+#ifndef DICIO_MATCHER_TOKENIZER_H
+#define DICIO_MATCHER_TOKENIZER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "grammar.h"
+
+namespace matcher {
+
+/**
+ * 分词结果。所有缓冲区在多次调用之间复用，容量足够时分词过程不分配内存，
+ * 所以调用方应该为每个线程保留一个实例。
+ * 词文本使用修改版UTF-8编码（每个UTF-16码元单独编码），与JNI的GetStringUTFChars一致，
+ * 这样才能和语法编译时放入词表的字符串逐字节比较。
+ */
+struct Tokenization {
+    int32_t length = 0;
+    std::vector<int32_t> wordStarts;
+    std::vector<int32_t> wordEnds;
+    // 所有词的小写原文/折叠文本依次拼接，第i个词为 [offsets[i], offsets[i+1])
+    std::string originalText;
+    std::string foldedText;
+    std::vector<int32_t> originalOffsets;
+    std::vector<int32_t> foldedOffsets;
+    // 词表ID，不在词表中为-1；没有传入词表时为空
+    // 查找前词表里的词数，见Vocabulary::wordCount
+    int32_t vocabularyWords = 0;
+    std::vector<int32_t> originalIds;
+    std::vector<int32_t> foldedIds;
+    std::vector<float> cumulativeWeight;
+    std::vector<int32_t> cumulativeWhitespace;
+
+    size_t wordCount() const { return wordStarts.size(); }
+    std::string originalWord(size_t word) const {
+        return originalText.substr(originalOffsets[word],
+                                   originalOffsets[word + 1] - originalOffsets[word]);
+    }
+    std::string foldedWord(size_t word) const {
+        return foldedText.substr(foldedOffsets[word],
+                                 foldedOffsets[word + 1] - foldedOffsets[word]);
+    }
+
+    // 词表查找用的临时键
+    std::string lookupKey;
+};
+
+/**
+ * Kotlin端 splitWords、nfkdNormalizeWord、cumulativeWeight 和 cumulativeWhitespace 的原生实现，
+ * 只遍历一次UTF-16输入，用 gen_unicode_tables.py 生成的表代替正则和Normalizer：
+ *  - 词是\p{L}的最长连续段（按码位判断，代理对组成的字母也算）
+ *  - 原文按String.lowercase()转小写，包括U+0130和词尾的final sigma
+ *  - 折叠文本是小写原文逐码位NFKD分解并去掉U+0300..U+036F（不做组合符号的重新排序）
+ *  - 标点只包括ASCII标点，与JVM上\p{Punct}的定义一致
+ */
+class Tokenizer {
+public:
+    /**
+     * @param vocabulary 不为null时同时填充originalIds和foldedIds
+     */
+    static void tokenize(const char16_t *text, int32_t length, const Vocabulary *vocabulary,
+                         Tokenization &out);
+
+    static bool isLetter(uint32_t codePoint);
+    static bool isCased(uint32_t codePoint);
+    static uint32_t toLowerCase(uint32_t codePoint);
+    static bool isWhitespace(char16_t unit);
+    static bool isPunctuation(char16_t unit);
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_TOKENIZER_H
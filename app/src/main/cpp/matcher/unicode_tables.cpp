@@ -0,0 +1,2950 @@
+// Generated by gen_unicode_tables.py from Unicode 14.0.0, do not edit.
+
+#include "unicode_tables.h"
+
+namespace matcher {
+namespace unicode {
+
+const uint32_t LETTER_BMP[2048] = {
+    0x00000000, 0x00000000, 0x07fffffe, 0x07fffffe, 0x00000000, 0x04200400,
+    0xff7fffff, 0xff7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0003ffc3, 0x0000501f,
+    0x00000000, 0x00000000, 0x00000000, 0xbcdf0000, 0xffffd740, 0xfffffffb,
+    0xffffffff, 0xffbfffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffffc03, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffeffff,
+    0x027fffff, 0xffffffff, 0x000001ff, 0x00000000, 0xffff0000, 0x000787ff,
+    0x00000000, 0xffffffff, 0x000007ff, 0xfffec000, 0xffffffff, 0xffffffff,
+    0x002fffff, 0x9c00c060, 0xfffd0000, 0x0000ffff, 0xffffe000, 0xffffffff,
+    0xffffffff, 0x0002003f, 0xfffffc00, 0x043007ff, 0x043fffff, 0x00000110,
+    0x01ffffff, 0xffff07ff, 0x00007eff, 0xffffffff, 0x000003ff, 0x00000000,
+    0xfffffff0, 0x23ffffff, 0xff010000, 0xfffe0003, 0xfff99fe1, 0x23c5fdff,
+    0xb0004000, 0x10030003, 0xfff987e0, 0x036dfdff, 0x5e000000, 0x001c0000,
+    0xfffbbfe0, 0x23edfdff, 0x00010000, 0x02000003, 0xfff99fe0, 0x23edfdff,
+    0xb0000000, 0x00020003, 0xd63dc7e8, 0x03ffc718, 0x00010000, 0x00000000,
+    0xfffddfe0, 0x23fffdff, 0x27000000, 0x00000003, 0xfffddfe1, 0x23effdff,
+    0x60000000, 0x00060003, 0xfffddff0, 0x27ffffff, 0x80704000, 0xfc000003,
+    0xfc7fffe0, 0x2ffbffff, 0x0000007f, 0x00000000, 0xfffffffe, 0x000dffff,
+    0x0000007f, 0x00000000, 0xfffff7d6, 0x200dffaf, 0xf000005f, 0x00000000,
+    0x00000001, 0x00000000, 0xfffffeff, 0x00001fff, 0x00001f00, 0x00000000,
+    0x00000000, 0x00000000, 0xffffffff, 0x800007ff, 0x3c3f0000, 0xffe1c062,
+    0x00004003, 0xffffffff, 0xffff20bf, 0xf7ffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x3d7f3dff, 0xffffffff, 0xffff3dff, 0x7f3dffff,
+    0xff7fff3d, 0xffffffff, 0xff3dffff, 0xffffffff, 0x07ffffff, 0x00000000,
+    0x0000ffff, 0xffffffff, 0xffffffff, 0x3f3fffff, 0xfffffffe, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff9fff,
+    0x07fffffe, 0xffffffff, 0xffffffff, 0x01fe07ff, 0x8003ffff, 0x0003ffff,
+    0x0003ffff, 0x0001dfff, 0xffffffff, 0x000fffff, 0x10800000, 0x00000000,
+    0x00000000, 0xffffffff, 0xffffffff, 0x01ffffff, 0xffffff9f, 0xffff05ff,
+    0xffffffff, 0x003fffff, 0x7fffffff, 0x00000000, 0xffff0000, 0x001f3fff,
+    0xffffffff, 0xffff0fff, 0x000003ff, 0x00000000, 0x007fffff, 0xffffffff,
+    0x001fffff, 0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000,
+    0xffffffe0, 0x000fffff, 0x00001fe0, 0x00000000, 0xfffffff8, 0xfc00c001,
+    0xffffffff, 0x0000003f, 0xffffffff, 0x0000000f, 0xfc00e000, 0x3fffffff,
+    0xffff01ff, 0xe7ffffff, 0x00000000, 0x046fde00, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff,
+    0xffffffff, 0x5fdfffff, 0x0fcf1fdc, 0x1fdc1fff, 0x00000000, 0x00000000,
+    0x00000000, 0x80020000, 0x1fff0000, 0x00000000, 0x00000000, 0x00000000,
+    0x3e2ffc84, 0xf3ffbd50, 0x000043e0, 0x00000000, 0x00000018, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000c781f,
+    0xffffffff, 0xffff20bf, 0xffffffff, 0x000080ff, 0x007fffff, 0x7f7f7f7f,
+    0x7f7f7f7f, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000060, 0x183e0000, 0xfffffffe, 0xffffffff, 0xe07fffff, 0xfffffffe,
+    0xffffffff, 0xf7ffffff, 0xffffffe0, 0xfffeffff, 0xffffffff, 0xffffffff,
+    0x00007fff, 0xffffffff, 0x00000000, 0xffff0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x00001fff, 0x00000000, 0xffff0000, 0x3fffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffff1fff, 0x00000c00, 0xffffffff, 0x80007fff,
+    0x3fffffff, 0xffffffff, 0xffffffff, 0x0000003f, 0xff800000, 0xfffffffc,
+    0xffffffff, 0xffffffff, 0xfffff9ff, 0xffffffff, 0x03eb07ff, 0xfffc0000,
+    0xfffff7bb, 0x00000007, 0xffffffff, 0x000fffff, 0xfffffffc, 0x000fffff,
+    0x00000000, 0x68fc0000, 0xfffffc00, 0xffff003f, 0x0000007f, 0x1fffffff,
+    0xfffffff0, 0x0007ffff, 0x00008000, 0x7c00ffdf, 0xffffffff, 0x000001ff,
+    0x00000ff7, 0xc47fffff, 0xffffffff, 0x3e62ffff, 0x38000005, 0x001c07ff,
+    0x007e7e7e, 0xffff7f7f, 0xf7ffffff, 0xffff03ff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x00000007, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffff000f, 0xfffff87f, 0x0fffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff,
+    0xffffffff, 0xffffffff, 0x03ffffff, 0x00000000, 0xa0f8007f, 0x5f7ffdff,
+    0xffffffdb, 0xffffffff, 0xffffffff, 0x0003ffff, 0xfff80000, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, 0xffff0000, 0xffffffff,
+    0xfffcffff, 0xffffffff, 0x000000ff, 0x0fff0000, 0x00000000, 0x00000000,
+    0x00000000, 0xffdf0000, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff,
+    0x00000000, 0x07fffffe, 0x07fffffe, 0xffffffc0, 0xffffffff, 0x7fffffff,
+    0x1cfcfcfc, 0x00000000,
+};
+
+const uint32_t CASED_BMP[2048] = {
+    0x00000000, 0x00000000, 0x07fffffe, 0x07fffffe, 0x00000000, 0x00200000,
+    0xff7fffff, 0xff7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xf7ffffff, 0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffefffff, 0x0000ffff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xb8cf0000, 0xffffd740, 0xfffffffb,
+    0xffffffff, 0xffbfffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfffffc03, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffeffff,
+    0x007fffff, 0xffffffff, 0x000001ff, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xffffffff, 0xffff20bf, 0xe7ffffff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xffffffff, 0xffffffff, 0x3f3fffff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xffff01ff, 0xe7ffffff, 0x00000000, 0x00000000, 0xffffffff, 0x00000fff,
+    0x00000000, 0xfefff800, 0x07ffffff, 0x00000000, 0x00000000, 0x00000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff,
+    0xffffffff, 0x5fdfffff, 0x0fcf1fdc, 0x1fdc1fff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x3e2ffc84, 0xf21fbd50, 0x000043e0, 0x00000000, 0x00000018, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xcfffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x000c781f,
+    0xffffffff, 0x000020bf, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00003fff,
+    0x0fffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffffffc,
+    0xffffffff, 0xfffeffff, 0xffff78ff, 0xffffffff, 0x03eb07ff, 0x04600000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xffff0000, 0x07ffffff, 0xffff01ff, 0xffffffff, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00f8007f, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x07fffffe, 0x07fffffe, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000,
+};
+
+const Range LETTER_SUPPLEMENTARY[] = {
+    {0x10000, 0x1000b},
+    {0x1000d, 0x10026},
+    {0x10028, 0x1003a},
+    {0x1003c, 0x1003d},
+    {0x1003f, 0x1004d},
+    {0x10050, 0x1005d},
+    {0x10080, 0x100fa},
+    {0x10280, 0x1029c},
+    {0x102a0, 0x102d0},
+    {0x10300, 0x1031f},
+    {0x1032d, 0x10340},
+    {0x10342, 0x10349},
+    {0x10350, 0x10375},
+    {0x10380, 0x1039d},
+    {0x103a0, 0x103c3},
+    {0x103c8, 0x103cf},
+    {0x10400, 0x1049d},
+    {0x104b0, 0x104d3},
+    {0x104d8, 0x104fb},
+    {0x10500, 0x10527},
+    {0x10530, 0x10563},
+    {0x10570, 0x1057a},
+    {0x1057c, 0x1058a},
+    {0x1058c, 0x10592},
+    {0x10594, 0x10595},
+    {0x10597, 0x105a1},
+    {0x105a3, 0x105b1},
+    {0x105b3, 0x105b9},
+    {0x105bb, 0x105bc},
+    {0x10600, 0x10736},
+    {0x10740, 0x10755},
+    {0x10760, 0x10767},
+    {0x10780, 0x10785},
+    {0x10787, 0x107b0},
+    {0x107b2, 0x107ba},
+    {0x10800, 0x10805},
+    {0x10808, 0x10808},
+    {0x1080a, 0x10835},
+    {0x10837, 0x10838},
+    {0x1083c, 0x1083c},
+    {0x1083f, 0x10855},
+    {0x10860, 0x10876},
+    {0x10880, 0x1089e},
+    {0x108e0, 0x108f2},
+    {0x108f4, 0x108f5},
+    {0x10900, 0x10915},
+    {0x10920, 0x10939},
+    {0x10980, 0x109b7},
+    {0x109be, 0x109bf},
+    {0x10a00, 0x10a00},
+    {0x10a10, 0x10a13},
+    {0x10a15, 0x10a17},
+    {0x10a19, 0x10a35},
+    {0x10a60, 0x10a7c},
+    {0x10a80, 0x10a9c},
+    {0x10ac0, 0x10ac7},
+    {0x10ac9, 0x10ae4},
+    {0x10b00, 0x10b35},
+    {0x10b40, 0x10b55},
+    {0x10b60, 0x10b72},
+    {0x10b80, 0x10b91},
+    {0x10c00, 0x10c48},
+    {0x10c80, 0x10cb2},
+    {0x10cc0, 0x10cf2},
+    {0x10d00, 0x10d23},
+    {0x10e80, 0x10ea9},
+    {0x10eb0, 0x10eb1},
+    {0x10f00, 0x10f1c},
+    {0x10f27, 0x10f27},
+    {0x10f30, 0x10f45},
+    {0x10f70, 0x10f81},
+    {0x10fb0, 0x10fc4},
+    {0x10fe0, 0x10ff6},
+    {0x11003, 0x11037},
+    {0x11071, 0x11072},
+    {0x11075, 0x11075},
+    {0x11083, 0x110af},
+    {0x110d0, 0x110e8},
+    {0x11103, 0x11126},
+    {0x11144, 0x11144},
+    {0x11147, 0x11147},
+    {0x11150, 0x11172},
+    {0x11176, 0x11176},
+    {0x11183, 0x111b2},
+    {0x111c1, 0x111c4},
+    {0x111da, 0x111da},
+    {0x111dc, 0x111dc},
+    {0x11200, 0x11211},
+    {0x11213, 0x1122b},
+    {0x11280, 0x11286},
+    {0x11288, 0x11288},
+    {0x1128a, 0x1128d},
+    {0x1128f, 0x1129d},
+    {0x1129f, 0x112a8},
+    {0x112b0, 0x112de},
+    {0x11305, 0x1130c},
+    {0x1130f, 0x11310},
+    {0x11313, 0x11328},
+    {0x1132a, 0x11330},
+    {0x11332, 0x11333},
+    {0x11335, 0x11339},
+    {0x1133d, 0x1133d},
+    {0x11350, 0x11350},
+    {0x1135d, 0x11361},
+    {0x11400, 0x11434},
+    {0x11447, 0x1144a},
+    {0x1145f, 0x11461},
+    {0x11480, 0x114af},
+    {0x114c4, 0x114c5},
+    {0x114c7, 0x114c7},
+    {0x11580, 0x115ae},
+    {0x115d8, 0x115db},
+    {0x11600, 0x1162f},
+    {0x11644, 0x11644},
+    {0x11680, 0x116aa},
+    {0x116b8, 0x116b8},
+    {0x11700, 0x1171a},
+    {0x11740, 0x11746},
+    {0x11800, 0x1182b},
+    {0x118a0, 0x118df},
+    {0x118ff, 0x11906},
+    {0x11909, 0x11909},
+    {0x1190c, 0x11913},
+    {0x11915, 0x11916},
+    {0x11918, 0x1192f},
+    {0x1193f, 0x1193f},
+    {0x11941, 0x11941},
+    {0x119a0, 0x119a7},
+    {0x119aa, 0x119d0},
+    {0x119e1, 0x119e1},
+    {0x119e3, 0x119e3},
+    {0x11a00, 0x11a00},
+    {0x11a0b, 0x11a32},
+    {0x11a3a, 0x11a3a},
+    {0x11a50, 0x11a50},
+    {0x11a5c, 0x11a89},
+    {0x11a9d, 0x11a9d},
+    {0x11ab0, 0x11af8},
+    {0x11c00, 0x11c08},
+    {0x11c0a, 0x11c2e},
+    {0x11c40, 0x11c40},
+    {0x11c72, 0x11c8f},
+    {0x11d00, 0x11d06},
+    {0x11d08, 0x11d09},
+    {0x11d0b, 0x11d30},
+    {0x11d46, 0x11d46},
+    {0x11d60, 0x11d65},
+    {0x11d67, 0x11d68},
+    {0x11d6a, 0x11d89},
+    {0x11d98, 0x11d98},
+    {0x11ee0, 0x11ef2},
+    {0x11fb0, 0x11fb0},
+    {0x12000, 0x12399},
+    {0x12480, 0x12543},
+    {0x12f90, 0x12ff0},
+    {0x13000, 0x1342e},
+    {0x14400, 0x14646},
+    {0x16800, 0x16a38},
+    {0x16a40, 0x16a5e},
+    {0x16a70, 0x16abe},
+    {0x16ad0, 0x16aed},
+    {0x16b00, 0x16b2f},
+    {0x16b40, 0x16b43},
+    {0x16b63, 0x16b77},
+    {0x16b7d, 0x16b8f},
+    {0x16e40, 0x16e7f},
+    {0x16f00, 0x16f4a},
+    {0x16f50, 0x16f50},
+    {0x16f93, 0x16f9f},
+    {0x16fe0, 0x16fe1},
+    {0x16fe3, 0x16fe3},
+    {0x17000, 0x187f7},
+    {0x18800, 0x18cd5},
+    {0x18d00, 0x18d08},
+    {0x1aff0, 0x1aff3},
+    {0x1aff5, 0x1affb},
+    {0x1affd, 0x1affe},
+    {0x1b000, 0x1b122},
+    {0x1b150, 0x1b152},
+    {0x1b164, 0x1b167},
+    {0x1b170, 0x1b2fb},
+    {0x1bc00, 0x1bc6a},
+    {0x1bc70, 0x1bc7c},
+    {0x1bc80, 0x1bc88},
+    {0x1bc90, 0x1bc99},
+    {0x1d400, 0x1d454},
+    {0x1d456, 0x1d49c},
+    {0x1d49e, 0x1d49f},
+    {0x1d4a2, 0x1d4a2},
+    {0x1d4a5, 0x1d4a6},
+    {0x1d4a9, 0x1d4ac},
+    {0x1d4ae, 0x1d4b9},
+    {0x1d4bb, 0x1d4bb},
+    {0x1d4bd, 0x1d4c3},
+    {0x1d4c5, 0x1d505},
+    {0x1d507, 0x1d50a},
+    {0x1d50d, 0x1d514},
+    {0x1d516, 0x1d51c},
+    {0x1d51e, 0x1d539},
+    {0x1d53b, 0x1d53e},
+    {0x1d540, 0x1d544},
+    {0x1d546, 0x1d546},
+    {0x1d54a, 0x1d550},
+    {0x1d552, 0x1d6a5},
+    {0x1d6a8, 0x1d6c0},
+    {0x1d6c2, 0x1d6da},
+    {0x1d6dc, 0x1d6fa},
+    {0x1d6fc, 0x1d714},
+    {0x1d716, 0x1d734},
+    {0x1d736, 0x1d74e},
+    {0x1d750, 0x1d76e},
+    {0x1d770, 0x1d788},
+    {0x1d78a, 0x1d7a8},
+    {0x1d7aa, 0x1d7c2},
+    {0x1d7c4, 0x1d7cb},
+    {0x1df00, 0x1df1e},
+    {0x1e100, 0x1e12c},
+    {0x1e137, 0x1e13d},
+    {0x1e14e, 0x1e14e},
+    {0x1e290, 0x1e2ad},
+    {0x1e2c0, 0x1e2eb},
+    {0x1e7e0, 0x1e7e6},
+    {0x1e7e8, 0x1e7eb},
+    {0x1e7ed, 0x1e7ee},
+    {0x1e7f0, 0x1e7fe},
+    {0x1e800, 0x1e8c4},
+    {0x1e900, 0x1e943},
+    {0x1e94b, 0x1e94b},
+    {0x1ee00, 0x1ee03},
+    {0x1ee05, 0x1ee1f},
+    {0x1ee21, 0x1ee22},
+    {0x1ee24, 0x1ee24},
+    {0x1ee27, 0x1ee27},
+    {0x1ee29, 0x1ee32},
+    {0x1ee34, 0x1ee37},
+    {0x1ee39, 0x1ee39},
+    {0x1ee3b, 0x1ee3b},
+    {0x1ee42, 0x1ee42},
+    {0x1ee47, 0x1ee47},
+    {0x1ee49, 0x1ee49},
+    {0x1ee4b, 0x1ee4b},
+    {0x1ee4d, 0x1ee4f},
+    {0x1ee51, 0x1ee52},
+    {0x1ee54, 0x1ee54},
+    {0x1ee57, 0x1ee57},
+    {0x1ee59, 0x1ee59},
+    {0x1ee5b, 0x1ee5b},
+    {0x1ee5d, 0x1ee5d},
+    {0x1ee5f, 0x1ee5f},
+    {0x1ee61, 0x1ee62},
+    {0x1ee64, 0x1ee64},
+    {0x1ee67, 0x1ee6a},
+    {0x1ee6c, 0x1ee72},
+    {0x1ee74, 0x1ee77},
+    {0x1ee79, 0x1ee7c},
+    {0x1ee7e, 0x1ee7e},
+    {0x1ee80, 0x1ee89},
+    {0x1ee8b, 0x1ee9b},
+    {0x1eea1, 0x1eea3},
+    {0x1eea5, 0x1eea9},
+    {0x1eeab, 0x1eebb},
+    {0x20000, 0x2a6df},
+    {0x2a700, 0x2b738},
+    {0x2b740, 0x2b81d},
+    {0x2b820, 0x2cea1},
+    {0x2ceb0, 0x2ebe0},
+    {0x2f800, 0x2fa1d},
+    {0x30000, 0x3134a},
+};
+const size_t LETTER_SUPPLEMENTARY_COUNT = 268;
+
+const Mapping LOWERCASE[] = {
+    {0x00041, 0x00061}, {0x00042, 0x00062}, {0x00043, 0x00063}, {0x00044, 0x00064},
+    {0x00045, 0x00065}, {0x00046, 0x00066}, {0x00047, 0x00067}, {0x00048, 0x00068},
+    {0x00049, 0x00069}, {0x0004a, 0x0006a}, {0x0004b, 0x0006b}, {0x0004c, 0x0006c},
+    {0x0004d, 0x0006d}, {0x0004e, 0x0006e}, {0x0004f, 0x0006f}, {0x00050, 0x00070},
+    {0x00051, 0x00071}, {0x00052, 0x00072}, {0x00053, 0x00073}, {0x00054, 0x00074},
+    {0x00055, 0x00075}, {0x00056, 0x00076}, {0x00057, 0x00077}, {0x00058, 0x00078},
+    {0x00059, 0x00079}, {0x0005a, 0x0007a}, {0x000c0, 0x000e0}, {0x000c1, 0x000e1},
+    {0x000c2, 0x000e2}, {0x000c3, 0x000e3}, {0x000c4, 0x000e4}, {0x000c5, 0x000e5},
+    {0x000c6, 0x000e6}, {0x000c7, 0x000e7}, {0x000c8, 0x000e8}, {0x000c9, 0x000e9},
+    {0x000ca, 0x000ea}, {0x000cb, 0x000eb}, {0x000cc, 0x000ec}, {0x000cd, 0x000ed},
+    {0x000ce, 0x000ee}, {0x000cf, 0x000ef}, {0x000d0, 0x000f0}, {0x000d1, 0x000f1},
+    {0x000d2, 0x000f2}, {0x000d3, 0x000f3}, {0x000d4, 0x000f4}, {0x000d5, 0x000f5},
+    {0x000d6, 0x000f6}, {0x000d8, 0x000f8}, {0x000d9, 0x000f9}, {0x000da, 0x000fa},
+    {0x000db, 0x000fb}, {0x000dc, 0x000fc}, {0x000dd, 0x000fd}, {0x000de, 0x000fe},
+    {0x00100, 0x00101}, {0x00102, 0x00103}, {0x00104, 0x00105}, {0x00106, 0x00107},
+    {0x00108, 0x00109}, {0x0010a, 0x0010b}, {0x0010c, 0x0010d}, {0x0010e, 0x0010f},
+    {0x00110, 0x00111}, {0x00112, 0x00113}, {0x00114, 0x00115}, {0x00116, 0x00117},
+    {0x00118, 0x00119}, {0x0011a, 0x0011b}, {0x0011c, 0x0011d}, {0x0011e, 0x0011f},
+    {0x00120, 0x00121}, {0x00122, 0x00123}, {0x00124, 0x00125}, {0x00126, 0x00127},
+    {0x00128, 0x00129}, {0x0012a, 0x0012b}, {0x0012c, 0x0012d}, {0x0012e, 0x0012f},
+    {0x00132, 0x00133}, {0x00134, 0x00135}, {0x00136, 0x00137}, {0x00139, 0x0013a},
+    {0x0013b, 0x0013c}, {0x0013d, 0x0013e}, {0x0013f, 0x00140}, {0x00141, 0x00142},
+    {0x00143, 0x00144}, {0x00145, 0x00146}, {0x00147, 0x00148}, {0x0014a, 0x0014b},
+    {0x0014c, 0x0014d}, {0x0014e, 0x0014f}, {0x00150, 0x00151}, {0x00152, 0x00153},
+    {0x00154, 0x00155}, {0x00156, 0x00157}, {0x00158, 0x00159}, {0x0015a, 0x0015b},
+    {0x0015c, 0x0015d}, {0x0015e, 0x0015f}, {0x00160, 0x00161}, {0x00162, 0x00163},
+    {0x00164, 0x00165}, {0x00166, 0x00167}, {0x00168, 0x00169}, {0x0016a, 0x0016b},
+    {0x0016c, 0x0016d}, {0x0016e, 0x0016f}, {0x00170, 0x00171}, {0x00172, 0x00173},
+    {0x00174, 0x00175}, {0x00176, 0x00177}, {0x00178, 0x000ff}, {0x00179, 0x0017a},
+    {0x0017b, 0x0017c}, {0x0017d, 0x0017e}, {0x00181, 0x00253}, {0x00182, 0x00183},
+    {0x00184, 0x00185}, {0x00186, 0x00254}, {0x00187, 0x00188}, {0x00189, 0x00256},
+    {0x0018a, 0x00257}, {0x0018b, 0x0018c}, {0x0018e, 0x001dd}, {0x0018f, 0x00259},
+    {0x00190, 0x0025b}, {0x00191, 0x00192}, {0x00193, 0x00260}, {0x00194, 0x00263},
+    {0x00196, 0x00269}, {0x00197, 0x00268}, {0x00198, 0x00199}, {0x0019c, 0x0026f},
+    {0x0019d, 0x00272}, {0x0019f, 0x00275}, {0x001a0, 0x001a1}, {0x001a2, 0x001a3},
+    {0x001a4, 0x001a5}, {0x001a6, 0x00280}, {0x001a7, 0x001a8}, {0x001a9, 0x00283},
+    {0x001ac, 0x001ad}, {0x001ae, 0x00288}, {0x001af, 0x001b0}, {0x001b1, 0x0028a},
+    {0x001b2, 0x0028b}, {0x001b3, 0x001b4}, {0x001b5, 0x001b6}, {0x001b7, 0x00292},
+    {0x001b8, 0x001b9}, {0x001bc, 0x001bd}, {0x001c4, 0x001c6}, {0x001c5, 0x001c6},
+    {0x001c7, 0x001c9}, {0x001c8, 0x001c9}, {0x001ca, 0x001cc}, {0x001cb, 0x001cc},
+    {0x001cd, 0x001ce}, {0x001cf, 0x001d0}, {0x001d1, 0x001d2}, {0x001d3, 0x001d4},
+    {0x001d5, 0x001d6}, {0x001d7, 0x001d8}, {0x001d9, 0x001da}, {0x001db, 0x001dc},
+    {0x001de, 0x001df}, {0x001e0, 0x001e1}, {0x001e2, 0x001e3}, {0x001e4, 0x001e5},
+    {0x001e6, 0x001e7}, {0x001e8, 0x001e9}, {0x001ea, 0x001eb}, {0x001ec, 0x001ed},
+    {0x001ee, 0x001ef}, {0x001f1, 0x001f3}, {0x001f2, 0x001f3}, {0x001f4, 0x001f5},
+    {0x001f6, 0x00195}, {0x001f7, 0x001bf}, {0x001f8, 0x001f9}, {0x001fa, 0x001fb},
+    {0x001fc, 0x001fd}, {0x001fe, 0x001ff}, {0x00200, 0x00201}, {0x00202, 0x00203},
+    {0x00204, 0x00205}, {0x00206, 0x00207}, {0x00208, 0x00209}, {0x0020a, 0x0020b},
+    {0x0020c, 0x0020d}, {0x0020e, 0x0020f}, {0x00210, 0x00211}, {0x00212, 0x00213},
+    {0x00214, 0x00215}, {0x00216, 0x00217}, {0x00218, 0x00219}, {0x0021a, 0x0021b},
+    {0x0021c, 0x0021d}, {0x0021e, 0x0021f}, {0x00220, 0x0019e}, {0x00222, 0x00223},
+    {0x00224, 0x00225}, {0x00226, 0x00227}, {0x00228, 0x00229}, {0x0022a, 0x0022b},
+    {0x0022c, 0x0022d}, {0x0022e, 0x0022f}, {0x00230, 0x00231}, {0x00232, 0x00233},
+    {0x0023a, 0x02c65}, {0x0023b, 0x0023c}, {0x0023d, 0x0019a}, {0x0023e, 0x02c66},
+    {0x00241, 0x00242}, {0x00243, 0x00180}, {0x00244, 0x00289}, {0x00245, 0x0028c},
+    {0x00246, 0x00247}, {0x00248, 0x00249}, {0x0024a, 0x0024b}, {0x0024c, 0x0024d},
+    {0x0024e, 0x0024f}, {0x00370, 0x00371}, {0x00372, 0x00373}, {0x00376, 0x00377},
+    {0x0037f, 0x003f3}, {0x00386, 0x003ac}, {0x00388, 0x003ad}, {0x00389, 0x003ae},
+    {0x0038a, 0x003af}, {0x0038c, 0x003cc}, {0x0038e, 0x003cd}, {0x0038f, 0x003ce},
+    {0x00391, 0x003b1}, {0x00392, 0x003b2}, {0x00393, 0x003b3}, {0x00394, 0x003b4},
+    {0x00395, 0x003b5}, {0x00396, 0x003b6}, {0x00397, 0x003b7}, {0x00398, 0x003b8},
+    {0x00399, 0x003b9}, {0x0039a, 0x003ba}, {0x0039b, 0x003bb}, {0x0039c, 0x003bc},
+    {0x0039d, 0x003bd}, {0x0039e, 0x003be}, {0x0039f, 0x003bf}, {0x003a0, 0x003c0},
+    {0x003a1, 0x003c1}, {0x003a3, 0x003c3}, {0x003a4, 0x003c4}, {0x003a5, 0x003c5},
+    {0x003a6, 0x003c6}, {0x003a7, 0x003c7}, {0x003a8, 0x003c8}, {0x003a9, 0x003c9},
+    {0x003aa, 0x003ca}, {0x003ab, 0x003cb}, {0x003cf, 0x003d7}, {0x003d8, 0x003d9},
+    {0x003da, 0x003db}, {0x003dc, 0x003dd}, {0x003de, 0x003df}, {0x003e0, 0x003e1},
+    {0x003e2, 0x003e3}, {0x003e4, 0x003e5}, {0x003e6, 0x003e7}, {0x003e8, 0x003e9},
+    {0x003ea, 0x003eb}, {0x003ec, 0x003ed}, {0x003ee, 0x003ef}, {0x003f4, 0x003b8},
+    {0x003f7, 0x003f8}, {0x003f9, 0x003f2}, {0x003fa, 0x003fb}, {0x003fd, 0x0037b},
+    {0x003fe, 0x0037c}, {0x003ff, 0x0037d}, {0x00400, 0x00450}, {0x00401, 0x00451},
+    {0x00402, 0x00452}, {0x00403, 0x00453}, {0x00404, 0x00454}, {0x00405, 0x00455},
+    {0x00406, 0x00456}, {0x00407, 0x00457}, {0x00408, 0x00458}, {0x00409, 0x00459},
+    {0x0040a, 0x0045a}, {0x0040b, 0x0045b}, {0x0040c, 0x0045c}, {0x0040d, 0x0045d},
+    {0x0040e, 0x0045e}, {0x0040f, 0x0045f}, {0x00410, 0x00430}, {0x00411, 0x00431},
+    {0x00412, 0x00432}, {0x00413, 0x00433}, {0x00414, 0x00434}, {0x00415, 0x00435},
+    {0x00416, 0x00436}, {0x00417, 0x00437}, {0x00418, 0x00438}, {0x00419, 0x00439},
+    {0x0041a, 0x0043a}, {0x0041b, 0x0043b}, {0x0041c, 0x0043c}, {0x0041d, 0x0043d},
+    {0x0041e, 0x0043e}, {0x0041f, 0x0043f}, {0x00420, 0x00440}, {0x00421, 0x00441},
+    {0x00422, 0x00442}, {0x00423, 0x00443}, {0x00424, 0x00444}, {0x00425, 0x00445},
+    {0x00426, 0x00446}, {0x00427, 0x00447}, {0x00428, 0x00448}, {0x00429, 0x00449},
+    {0x0042a, 0x0044a}, {0x0042b, 0x0044b}, {0x0042c, 0x0044c}, {0x0042d, 0x0044d},
+    {0x0042e, 0x0044e}, {0x0042f, 0x0044f}, {0x00460, 0x00461}, {0x00462, 0x00463},
+    {0x00464, 0x00465}, {0x00466, 0x00467}, {0x00468, 0x00469}, {0x0046a, 0x0046b},
+    {0x0046c, 0x0046d}, {0x0046e, 0x0046f}, {0x00470, 0x00471}, {0x00472, 0x00473},
+    {0x00474, 0x00475}, {0x00476, 0x00477}, {0x00478, 0x00479}, {0x0047a, 0x0047b},
+    {0x0047c, 0x0047d}, {0x0047e, 0x0047f}, {0x00480, 0x00481}, {0x0048a, 0x0048b},
+    {0x0048c, 0x0048d}, {0x0048e, 0x0048f}, {0x00490, 0x00491}, {0x00492, 0x00493},
+    {0x00494, 0x00495}, {0x00496, 0x00497}, {0x00498, 0x00499}, {0x0049a, 0x0049b},
+    {0x0049c, 0x0049d}, {0x0049e, 0x0049f}, {0x004a0, 0x004a1}, {0x004a2, 0x004a3},
+    {0x004a4, 0x004a5}, {0x004a6, 0x004a7}, {0x004a8, 0x004a9}, {0x004aa, 0x004ab},
+    {0x004ac, 0x004ad}, {0x004ae, 0x004af}, {0x004b0, 0x004b1}, {0x004b2, 0x004b3},
+    {0x004b4, 0x004b5}, {0x004b6, 0x004b7}, {0x004b8, 0x004b9}, {0x004ba, 0x004bb},
+    {0x004bc, 0x004bd}, {0x004be, 0x004bf}, {0x004c0, 0x004cf}, {0x004c1, 0x004c2},
+    {0x004c3, 0x004c4}, {0x004c5, 0x004c6}, {0x004c7, 0x004c8}, {0x004c9, 0x004ca},
+    {0x004cb, 0x004cc}, {0x004cd, 0x004ce}, {0x004d0, 0x004d1}, {0x004d2, 0x004d3},
+    {0x004d4, 0x004d5}, {0x004d6, 0x004d7}, {0x004d8, 0x004d9}, {0x004da, 0x004db},
+    {0x004dc, 0x004dd}, {0x004de, 0x004df}, {0x004e0, 0x004e1}, {0x004e2, 0x004e3},
+    {0x004e4, 0x004e5}, {0x004e6, 0x004e7}, {0x004e8, 0x004e9}, {0x004ea, 0x004eb},
+    {0x004ec, 0x004ed}, {0x004ee, 0x004ef}, {0x004f0, 0x004f1}, {0x004f2, 0x004f3},
+    {0x004f4, 0x004f5}, {0x004f6, 0x004f7}, {0x004f8, 0x004f9}, {0x004fa, 0x004fb},
+    {0x004fc, 0x004fd}, {0x004fe, 0x004ff}, {0x00500, 0x00501}, {0x00502, 0x00503},
+    {0x00504, 0x00505}, {0x00506, 0x00507}, {0x00508, 0x00509}, {0x0050a, 0x0050b},
+    {0x0050c, 0x0050d}, {0x0050e, 0x0050f}, {0x00510, 0x00511}, {0x00512, 0x00513},
+    {0x00514, 0x00515}, {0x00516, 0x00517}, {0x00518, 0x00519}, {0x0051a, 0x0051b},
+    {0x0051c, 0x0051d}, {0x0051e, 0x0051f}, {0x00520, 0x00521}, {0x00522, 0x00523},
+    {0x00524, 0x00525}, {0x00526, 0x00527}, {0x00528, 0x00529}, {0x0052a, 0x0052b},
+    {0x0052c, 0x0052d}, {0x0052e, 0x0052f}, {0x00531, 0x00561}, {0x00532, 0x00562},
+    {0x00533, 0x00563}, {0x00534, 0x00564}, {0x00535, 0x00565}, {0x00536, 0x00566},
+    {0x00537, 0x00567}, {0x00538, 0x00568}, {0x00539, 0x00569}, {0x0053a, 0x0056a},
+    {0x0053b, 0x0056b}, {0x0053c, 0x0056c}, {0x0053d, 0x0056d}, {0x0053e, 0x0056e},
+    {0x0053f, 0x0056f}, {0x00540, 0x00570}, {0x00541, 0x00571}, {0x00542, 0x00572},
+    {0x00543, 0x00573}, {0x00544, 0x00574}, {0x00545, 0x00575}, {0x00546, 0x00576},
+    {0x00547, 0x00577}, {0x00548, 0x00578}, {0x00549, 0x00579}, {0x0054a, 0x0057a},
+    {0x0054b, 0x0057b}, {0x0054c, 0x0057c}, {0x0054d, 0x0057d}, {0x0054e, 0x0057e},
+    {0x0054f, 0x0057f}, {0x00550, 0x00580}, {0x00551, 0x00581}, {0x00552, 0x00582},
+    {0x00553, 0x00583}, {0x00554, 0x00584}, {0x00555, 0x00585}, {0x00556, 0x00586},
+    {0x010a0, 0x02d00}, {0x010a1, 0x02d01}, {0x010a2, 0x02d02}, {0x010a3, 0x02d03},
+    {0x010a4, 0x02d04}, {0x010a5, 0x02d05}, {0x010a6, 0x02d06}, {0x010a7, 0x02d07},
+    {0x010a8, 0x02d08}, {0x010a9, 0x02d09}, {0x010aa, 0x02d0a}, {0x010ab, 0x02d0b},
+    {0x010ac, 0x02d0c}, {0x010ad, 0x02d0d}, {0x010ae, 0x02d0e}, {0x010af, 0x02d0f},
+    {0x010b0, 0x02d10}, {0x010b1, 0x02d11}, {0x010b2, 0x02d12}, {0x010b3, 0x02d13},
+    {0x010b4, 0x02d14}, {0x010b5, 0x02d15}, {0x010b6, 0x02d16}, {0x010b7, 0x02d17},
+    {0x010b8, 0x02d18}, {0x010b9, 0x02d19}, {0x010ba, 0x02d1a}, {0x010bb, 0x02d1b},
+    {0x010bc, 0x02d1c}, {0x010bd, 0x02d1d}, {0x010be, 0x02d1e}, {0x010bf, 0x02d1f},
+    {0x010c0, 0x02d20}, {0x010c1, 0x02d21}, {0x010c2, 0x02d22}, {0x010c3, 0x02d23},
+    {0x010c4, 0x02d24}, {0x010c5, 0x02d25}, {0x010c7, 0x02d27}, {0x010cd, 0x02d2d},
+    {0x013a0, 0x0ab70}, {0x013a1, 0x0ab71}, {0x013a2, 0x0ab72}, {0x013a3, 0x0ab73},
+    {0x013a4, 0x0ab74}, {0x013a5, 0x0ab75}, {0x013a6, 0x0ab76}, {0x013a7, 0x0ab77},
+    {0x013a8, 0x0ab78}, {0x013a9, 0x0ab79}, {0x013aa, 0x0ab7a}, {0x013ab, 0x0ab7b},
+    {0x013ac, 0x0ab7c}, {0x013ad, 0x0ab7d}, {0x013ae, 0x0ab7e}, {0x013af, 0x0ab7f},
+    {0x013b0, 0x0ab80}, {0x013b1, 0x0ab81}, {0x013b2, 0x0ab82}, {0x013b3, 0x0ab83},
+    {0x013b4, 0x0ab84}, {0x013b5, 0x0ab85}, {0x013b6, 0x0ab86}, {0x013b7, 0x0ab87},
+    {0x013b8, 0x0ab88}, {0x013b9, 0x0ab89}, {0x013ba, 0x0ab8a}, {0x013bb, 0x0ab8b},
+    {0x013bc, 0x0ab8c}, {0x013bd, 0x0ab8d}, {0x013be, 0x0ab8e}, {0x013bf, 0x0ab8f},
+    {0x013c0, 0x0ab90}, {0x013c1, 0x0ab91}, {0x013c2, 0x0ab92}, {0x013c3, 0x0ab93},
+    {0x013c4, 0x0ab94}, {0x013c5, 0x0ab95}, {0x013c6, 0x0ab96}, {0x013c7, 0x0ab97},
+    {0x013c8, 0x0ab98}, {0x013c9, 0x0ab99}, {0x013ca, 0x0ab9a}, {0x013cb, 0x0ab9b},
+    {0x013cc, 0x0ab9c}, {0x013cd, 0x0ab9d}, {0x013ce, 0x0ab9e}, {0x013cf, 0x0ab9f},
+    {0x013d0, 0x0aba0}, {0x013d1, 0x0aba1}, {0x013d2, 0x0aba2}, {0x013d3, 0x0aba3},
+    {0x013d4, 0x0aba4}, {0x013d5, 0x0aba5}, {0x013d6, 0x0aba6}, {0x013d7, 0x0aba7},
+    {0x013d8, 0x0aba8}, {0x013d9, 0x0aba9}, {0x013da, 0x0abaa}, {0x013db, 0x0abab},
+    {0x013dc, 0x0abac}, {0x013dd, 0x0abad}, {0x013de, 0x0abae}, {0x013df, 0x0abaf},
+    {0x013e0, 0x0abb0}, {0x013e1, 0x0abb1}, {0x013e2, 0x0abb2}, {0x013e3, 0x0abb3},
+    {0x013e4, 0x0abb4}, {0x013e5, 0x0abb5}, {0x013e6, 0x0abb6}, {0x013e7, 0x0abb7},
+    {0x013e8, 0x0abb8}, {0x013e9, 0x0abb9}, {0x013ea, 0x0abba}, {0x013eb, 0x0abbb},
+    {0x013ec, 0x0abbc}, {0x013ed, 0x0abbd}, {0x013ee, 0x0abbe}, {0x013ef, 0x0abbf},
+    {0x013f0, 0x013f8}, {0x013f1, 0x013f9}, {0x013f2, 0x013fa}, {0x013f3, 0x013fb},
+    {0x013f4, 0x013fc}, {0x013f5, 0x013fd}, {0x01c90, 0x010d0}, {0x01c91, 0x010d1},
+    {0x01c92, 0x010d2}, {0x01c93, 0x010d3}, {0x01c94, 0x010d4}, {0x01c95, 0x010d5},
+    {0x01c96, 0x010d6}, {0x01c97, 0x010d7}, {0x01c98, 0x010d8}, {0x01c99, 0x010d9},
+    {0x01c9a, 0x010da}, {0x01c9b, 0x010db}, {0x01c9c, 0x010dc}, {0x01c9d, 0x010dd},
+    {0x01c9e, 0x010de}, {0x01c9f, 0x010df}, {0x01ca0, 0x010e0}, {0x01ca1, 0x010e1},
+    {0x01ca2, 0x010e2}, {0x01ca3, 0x010e3}, {0x01ca4, 0x010e4}, {0x01ca5, 0x010e5},
+    {0x01ca6, 0x010e6}, {0x01ca7, 0x010e7}, {0x01ca8, 0x010e8}, {0x01ca9, 0x010e9},
+    {0x01caa, 0x010ea}, {0x01cab, 0x010eb}, {0x01cac, 0x010ec}, {0x01cad, 0x010ed},
+    {0x01cae, 0x010ee}, {0x01caf, 0x010ef}, {0x01cb0, 0x010f0}, {0x01cb1, 0x010f1},
+    {0x01cb2, 0x010f2}, {0x01cb3, 0x010f3}, {0x01cb4, 0x010f4}, {0x01cb5, 0x010f5},
+    {0x01cb6, 0x010f6}, {0x01cb7, 0x010f7}, {0x01cb8, 0x010f8}, {0x01cb9, 0x010f9},
+    {0x01cba, 0x010fa}, {0x01cbd, 0x010fd}, {0x01cbe, 0x010fe}, {0x01cbf, 0x010ff},
+    {0x01e00, 0x01e01}, {0x01e02, 0x01e03}, {0x01e04, 0x01e05}, {0x01e06, 0x01e07},
+    {0x01e08, 0x01e09}, {0x01e0a, 0x01e0b}, {0x01e0c, 0x01e0d}, {0x01e0e, 0x01e0f},
+    {0x01e10, 0x01e11}, {0x01e12, 0x01e13}, {0x01e14, 0x01e15}, {0x01e16, 0x01e17},
+    {0x01e18, 0x01e19}, {0x01e1a, 0x01e1b}, {0x01e1c, 0x01e1d}, {0x01e1e, 0x01e1f},
+    {0x01e20, 0x01e21}, {0x01e22, 0x01e23}, {0x01e24, 0x01e25}, {0x01e26, 0x01e27},
+    {0x01e28, 0x01e29}, {0x01e2a, 0x01e2b}, {0x01e2c, 0x01e2d}, {0x01e2e, 0x01e2f},
+    {0x01e30, 0x01e31}, {0x01e32, 0x01e33}, {0x01e34, 0x01e35}, {0x01e36, 0x01e37},
+    {0x01e38, 0x01e39}, {0x01e3a, 0x01e3b}, {0x01e3c, 0x01e3d}, {0x01e3e, 0x01e3f},
+    {0x01e40, 0x01e41}, {0x01e42, 0x01e43}, {0x01e44, 0x01e45}, {0x01e46, 0x01e47},
+    {0x01e48, 0x01e49}, {0x01e4a, 0x01e4b}, {0x01e4c, 0x01e4d}, {0x01e4e, 0x01e4f},
+    {0x01e50, 0x01e51}, {0x01e52, 0x01e53}, {0x01e54, 0x01e55}, {0x01e56, 0x01e57},
+    {0x01e58, 0x01e59}, {0x01e5a, 0x01e5b}, {0x01e5c, 0x01e5d}, {0x01e5e, 0x01e5f},
+    {0x01e60, 0x01e61}, {0x01e62, 0x01e63}, {0x01e64, 0x01e65}, {0x01e66, 0x01e67},
+    {0x01e68, 0x01e69}, {0x01e6a, 0x01e6b}, {0x01e6c, 0x01e6d}, {0x01e6e, 0x01e6f},
+    {0x01e70, 0x01e71}, {0x01e72, 0x01e73}, {0x01e74, 0x01e75}, {0x01e76, 0x01e77},
+    {0x01e78, 0x01e79}, {0x01e7a, 0x01e7b}, {0x01e7c, 0x01e7d}, {0x01e7e, 0x01e7f},
+    {0x01e80, 0x01e81}, {0x01e82, 0x01e83}, {0x01e84, 0x01e85}, {0x01e86, 0x01e87},
+    {0x01e88, 0x01e89}, {0x01e8a, 0x01e8b}, {0x01e8c, 0x01e8d}, {0x01e8e, 0x01e8f},
+    {0x01e90, 0x01e91}, {0x01e92, 0x01e93}, {0x01e94, 0x01e95}, {0x01e9e, 0x000df},
+    {0x01ea0, 0x01ea1}, {0x01ea2, 0x01ea3}, {0x01ea4, 0x01ea5}, {0x01ea6, 0x01ea7},
+    {0x01ea8, 0x01ea9}, {0x01eaa, 0x01eab}, {0x01eac, 0x01ead}, {0x01eae, 0x01eaf},
+    {0x01eb0, 0x01eb1}, {0x01eb2, 0x01eb3}, {0x01eb4, 0x01eb5}, {0x01eb6, 0x01eb7},
+    {0x01eb8, 0x01eb9}, {0x01eba, 0x01ebb}, {0x01ebc, 0x01ebd}, {0x01ebe, 0x01ebf},
+    {0x01ec0, 0x01ec1}, {0x01ec2, 0x01ec3}, {0x01ec4, 0x01ec5}, {0x01ec6, 0x01ec7},
+    {0x01ec8, 0x01ec9}, {0x01eca, 0x01ecb}, {0x01ecc, 0x01ecd}, {0x01ece, 0x01ecf},
+    {0x01ed0, 0x01ed1}, {0x01ed2, 0x01ed3}, {0x01ed4, 0x01ed5}, {0x01ed6, 0x01ed7},
+    {0x01ed8, 0x01ed9}, {0x01eda, 0x01edb}, {0x01edc, 0x01edd}, {0x01ede, 0x01edf},
+    {0x01ee0, 0x01ee1}, {0x01ee2, 0x01ee3}, {0x01ee4, 0x01ee5}, {0x01ee6, 0x01ee7},
+    {0x01ee8, 0x01ee9}, {0x01eea, 0x01eeb}, {0x01eec, 0x01eed}, {0x01eee, 0x01eef},
+    {0x01ef0, 0x01ef1}, {0x01ef2, 0x01ef3}, {0x01ef4, 0x01ef5}, {0x01ef6, 0x01ef7},
+    {0x01ef8, 0x01ef9}, {0x01efa, 0x01efb}, {0x01efc, 0x01efd}, {0x01efe, 0x01eff},
+    {0x01f08, 0x01f00}, {0x01f09, 0x01f01}, {0x01f0a, 0x01f02}, {0x01f0b, 0x01f03},
+    {0x01f0c, 0x01f04}, {0x01f0d, 0x01f05}, {0x01f0e, 0x01f06}, {0x01f0f, 0x01f07},
+    {0x01f18, 0x01f10}, {0x01f19, 0x01f11}, {0x01f1a, 0x01f12}, {0x01f1b, 0x01f13},
+    {0x01f1c, 0x01f14}, {0x01f1d, 0x01f15}, {0x01f28, 0x01f20}, {0x01f29, 0x01f21},
+    {0x01f2a, 0x01f22}, {0x01f2b, 0x01f23}, {0x01f2c, 0x01f24}, {0x01f2d, 0x01f25},
+    {0x01f2e, 0x01f26}, {0x01f2f, 0x01f27}, {0x01f38, 0x01f30}, {0x01f39, 0x01f31},
+    {0x01f3a, 0x01f32}, {0x01f3b, 0x01f33}, {0x01f3c, 0x01f34}, {0x01f3d, 0x01f35},
+    {0x01f3e, 0x01f36}, {0x01f3f, 0x01f37}, {0x01f48, 0x01f40}, {0x01f49, 0x01f41},
+    {0x01f4a, 0x01f42}, {0x01f4b, 0x01f43}, {0x01f4c, 0x01f44}, {0x01f4d, 0x01f45},
+    {0x01f59, 0x01f51}, {0x01f5b, 0x01f53}, {0x01f5d, 0x01f55}, {0x01f5f, 0x01f57},
+    {0x01f68, 0x01f60}, {0x01f69, 0x01f61}, {0x01f6a, 0x01f62}, {0x01f6b, 0x01f63},
+    {0x01f6c, 0x01f64}, {0x01f6d, 0x01f65}, {0x01f6e, 0x01f66}, {0x01f6f, 0x01f67},
+    {0x01f88, 0x01f80}, {0x01f89, 0x01f81}, {0x01f8a, 0x01f82}, {0x01f8b, 0x01f83},
+    {0x01f8c, 0x01f84}, {0x01f8d, 0x01f85}, {0x01f8e, 0x01f86}, {0x01f8f, 0x01f87},
+    {0x01f98, 0x01f90}, {0x01f99, 0x01f91}, {0x01f9a, 0x01f92}, {0x01f9b, 0x01f93},
+    {0x01f9c, 0x01f94}, {0x01f9d, 0x01f95}, {0x01f9e, 0x01f96}, {0x01f9f, 0x01f97},
+    {0x01fa8, 0x01fa0}, {0x01fa9, 0x01fa1}, {0x01faa, 0x01fa2}, {0x01fab, 0x01fa3},
+    {0x01fac, 0x01fa4}, {0x01fad, 0x01fa5}, {0x01fae, 0x01fa6}, {0x01faf, 0x01fa7},
+    {0x01fb8, 0x01fb0}, {0x01fb9, 0x01fb1}, {0x01fba, 0x01f70}, {0x01fbb, 0x01f71},
+    {0x01fbc, 0x01fb3}, {0x01fc8, 0x01f72}, {0x01fc9, 0x01f73}, {0x01fca, 0x01f74},
+    {0x01fcb, 0x01f75}, {0x01fcc, 0x01fc3}, {0x01fd8, 0x01fd0}, {0x01fd9, 0x01fd1},
+    {0x01fda, 0x01f76}, {0x01fdb, 0x01f77}, {0x01fe8, 0x01fe0}, {0x01fe9, 0x01fe1},
+    {0x01fea, 0x01f7a}, {0x01feb, 0x01f7b}, {0x01fec, 0x01fe5}, {0x01ff8, 0x01f78},
+    {0x01ff9, 0x01f79}, {0x01ffa, 0x01f7c}, {0x01ffb, 0x01f7d}, {0x01ffc, 0x01ff3},
+    {0x02126, 0x003c9}, {0x0212a, 0x0006b}, {0x0212b, 0x000e5}, {0x02132, 0x0214e},
+    {0x02160, 0x02170}, {0x02161, 0x02171}, {0x02162, 0x02172}, {0x02163, 0x02173},
+    {0x02164, 0x02174}, {0x02165, 0x02175}, {0x02166, 0x02176}, {0x02167, 0x02177},
+    {0x02168, 0x02178}, {0x02169, 0x02179}, {0x0216a, 0x0217a}, {0x0216b, 0x0217b},
+    {0x0216c, 0x0217c}, {0x0216d, 0x0217d}, {0x0216e, 0x0217e}, {0x0216f, 0x0217f},
+    {0x02183, 0x02184}, {0x024b6, 0x024d0}, {0x024b7, 0x024d1}, {0x024b8, 0x024d2},
+    {0x024b9, 0x024d3}, {0x024ba, 0x024d4}, {0x024bb, 0x024d5}, {0x024bc, 0x024d6},
+    {0x024bd, 0x024d7}, {0x024be, 0x024d8}, {0x024bf, 0x024d9}, {0x024c0, 0x024da},
+    {0x024c1, 0x024db}, {0x024c2, 0x024dc}, {0x024c3, 0x024dd}, {0x024c4, 0x024de},
+    {0x024c5, 0x024df}, {0x024c6, 0x024e0}, {0x024c7, 0x024e1}, {0x024c8, 0x024e2},
+    {0x024c9, 0x024e3}, {0x024ca, 0x024e4}, {0x024cb, 0x024e5}, {0x024cc, 0x024e6},
+    {0x024cd, 0x024e7}, {0x024ce, 0x024e8}, {0x024cf, 0x024e9}, {0x02c00, 0x02c30},
+    {0x02c01, 0x02c31}, {0x02c02, 0x02c32}, {0x02c03, 0x02c33}, {0x02c04, 0x02c34},
+    {0x02c05, 0x02c35}, {0x02c06, 0x02c36}, {0x02c07, 0x02c37}, {0x02c08, 0x02c38},
+    {0x02c09, 0x02c39}, {0x02c0a, 0x02c3a}, {0x02c0b, 0x02c3b}, {0x02c0c, 0x02c3c},
+    {0x02c0d, 0x02c3d}, {0x02c0e, 0x02c3e}, {0x02c0f, 0x02c3f}, {0x02c10, 0x02c40},
+    {0x02c11, 0x02c41}, {0x02c12, 0x02c42}, {0x02c13, 0x02c43}, {0x02c14, 0x02c44},
+    {0x02c15, 0x02c45}, {0x02c16, 0x02c46}, {0x02c17, 0x02c47}, {0x02c18, 0x02c48},
+    {0x02c19, 0x02c49}, {0x02c1a, 0x02c4a}, {0x02c1b, 0x02c4b}, {0x02c1c, 0x02c4c},
+    {0x02c1d, 0x02c4d}, {0x02c1e, 0x02c4e}, {0x02c1f, 0x02c4f}, {0x02c20, 0x02c50},
+    {0x02c21, 0x02c51}, {0x02c22, 0x02c52}, {0x02c23, 0x02c53}, {0x02c24, 0x02c54},
+    {0x02c25, 0x02c55}, {0x02c26, 0x02c56}, {0x02c27, 0x02c57}, {0x02c28, 0x02c58},
+    {0x02c29, 0x02c59}, {0x02c2a, 0x02c5a}, {0x02c2b, 0x02c5b}, {0x02c2c, 0x02c5c},
+    {0x02c2d, 0x02c5d}, {0x02c2e, 0x02c5e}, {0x02c2f, 0x02c5f}, {0x02c60, 0x02c61},
+    {0x02c62, 0x0026b}, {0x02c63, 0x01d7d}, {0x02c64, 0x0027d}, {0x02c67, 0x02c68},
+    {0x02c69, 0x02c6a}, {0x02c6b, 0x02c6c}, {0x02c6d, 0x00251}, {0x02c6e, 0x00271},
+    {0x02c6f, 0x00250}, {0x02c70, 0x00252}, {0x02c72, 0x02c73}, {0x02c75, 0x02c76},
+    {0x02c7e, 0x0023f}, {0x02c7f, 0x00240}, {0x02c80, 0x02c81}, {0x02c82, 0x02c83},
+    {0x02c84, 0x02c85}, {0x02c86, 0x02c87}, {0x02c88, 0x02c89}, {0x02c8a, 0x02c8b},
+    {0x02c8c, 0x02c8d}, {0x02c8e, 0x02c8f}, {0x02c90, 0x02c91}, {0x02c92, 0x02c93},
+    {0x02c94, 0x02c95}, {0x02c96, 0x02c97}, {0x02c98, 0x02c99}, {0x02c9a, 0x02c9b},
+    {0x02c9c, 0x02c9d}, {0x02c9e, 0x02c9f}, {0x02ca0, 0x02ca1}, {0x02ca2, 0x02ca3},
+    {0x02ca4, 0x02ca5}, {0x02ca6, 0x02ca7}, {0x02ca8, 0x02ca9}, {0x02caa, 0x02cab},
+    {0x02cac, 0x02cad}, {0x02cae, 0x02caf}, {0x02cb0, 0x02cb1}, {0x02cb2, 0x02cb3},
+    {0x02cb4, 0x02cb5}, {0x02cb6, 0x02cb7}, {0x02cb8, 0x02cb9}, {0x02cba, 0x02cbb},
+    {0x02cbc, 0x02cbd}, {0x02cbe, 0x02cbf}, {0x02cc0, 0x02cc1}, {0x02cc2, 0x02cc3},
+    {0x02cc4, 0x02cc5}, {0x02cc6, 0x02cc7}, {0x02cc8, 0x02cc9}, {0x02cca, 0x02ccb},
+    {0x02ccc, 0x02ccd}, {0x02cce, 0x02ccf}, {0x02cd0, 0x02cd1}, {0x02cd2, 0x02cd3},
+    {0x02cd4, 0x02cd5}, {0x02cd6, 0x02cd7}, {0x02cd8, 0x02cd9}, {0x02cda, 0x02cdb},
+    {0x02cdc, 0x02cdd}, {0x02cde, 0x02cdf}, {0x02ce0, 0x02ce1}, {0x02ce2, 0x02ce3},
+    {0x02ceb, 0x02cec}, {0x02ced, 0x02cee}, {0x02cf2, 0x02cf3}, {0x0a640, 0x0a641},
+    {0x0a642, 0x0a643}, {0x0a644, 0x0a645}, {0x0a646, 0x0a647}, {0x0a648, 0x0a649},
+    {0x0a64a, 0x0a64b}, {0x0a64c, 0x0a64d}, {0x0a64e, 0x0a64f}, {0x0a650, 0x0a651},
+    {0x0a652, 0x0a653}, {0x0a654, 0x0a655}, {0x0a656, 0x0a657}, {0x0a658, 0x0a659},
+    {0x0a65a, 0x0a65b}, {0x0a65c, 0x0a65d}, {0x0a65e, 0x0a65f}, {0x0a660, 0x0a661},
+    {0x0a662, 0x0a663}, {0x0a664, 0x0a665}, {0x0a666, 0x0a667}, {0x0a668, 0x0a669},
+    {0x0a66a, 0x0a66b}, {0x0a66c, 0x0a66d}, {0x0a680, 0x0a681}, {0x0a682, 0x0a683},
+    {0x0a684, 0x0a685}, {0x0a686, 0x0a687}, {0x0a688, 0x0a689}, {0x0a68a, 0x0a68b},
+    {0x0a68c, 0x0a68d}, {0x0a68e, 0x0a68f}, {0x0a690, 0x0a691}, {0x0a692, 0x0a693},
+    {0x0a694, 0x0a695}, {0x0a696, 0x0a697}, {0x0a698, 0x0a699}, {0x0a69a, 0x0a69b},
+    {0x0a722, 0x0a723}, {0x0a724, 0x0a725}, {0x0a726, 0x0a727}, {0x0a728, 0x0a729},
+    {0x0a72a, 0x0a72b}, {0x0a72c, 0x0a72d}, {0x0a72e, 0x0a72f}, {0x0a732, 0x0a733},
+    {0x0a734, 0x0a735}, {0x0a736, 0x0a737}, {0x0a738, 0x0a739}, {0x0a73a, 0x0a73b},
+    {0x0a73c, 0x0a73d}, {0x0a73e, 0x0a73f}, {0x0a740, 0x0a741}, {0x0a742, 0x0a743},
+    {0x0a744, 0x0a745}, {0x0a746, 0x0a747}, {0x0a748, 0x0a749}, {0x0a74a, 0x0a74b},
+    {0x0a74c, 0x0a74d}, {0x0a74e, 0x0a74f}, {0x0a750, 0x0a751}, {0x0a752, 0x0a753},
+    {0x0a754, 0x0a755}, {0x0a756, 0x0a757}, {0x0a758, 0x0a759}, {0x0a75a, 0x0a75b},
+    {0x0a75c, 0x0a75d}, {0x0a75e, 0x0a75f}, {0x0a760, 0x0a761}, {0x0a762, 0x0a763},
+    {0x0a764, 0x0a765}, {0x0a766, 0x0a767}, {0x0a768, 0x0a769}, {0x0a76a, 0x0a76b},
+    {0x0a76c, 0x0a76d}, {0x0a76e, 0x0a76f}, {0x0a779, 0x0a77a}, {0x0a77b, 0x0a77c},
+    {0x0a77d, 0x01d79}, {0x0a77e, 0x0a77f}, {0x0a780, 0x0a781}, {0x0a782, 0x0a783},
+    {0x0a784, 0x0a785}, {0x0a786, 0x0a787}, {0x0a78b, 0x0a78c}, {0x0a78d, 0x00265},
+    {0x0a790, 0x0a791}, {0x0a792, 0x0a793}, {0x0a796, 0x0a797}, {0x0a798, 0x0a799},
+    {0x0a79a, 0x0a79b}, {0x0a79c, 0x0a79d}, {0x0a79e, 0x0a79f}, {0x0a7a0, 0x0a7a1},
+    {0x0a7a2, 0x0a7a3}, {0x0a7a4, 0x0a7a5}, {0x0a7a6, 0x0a7a7}, {0x0a7a8, 0x0a7a9},
+    {0x0a7aa, 0x00266}, {0x0a7ab, 0x0025c}, {0x0a7ac, 0x00261}, {0x0a7ad, 0x0026c},
+    {0x0a7ae, 0x0026a}, {0x0a7b0, 0x0029e}, {0x0a7b1, 0x00287}, {0x0a7b2, 0x0029d},
+    {0x0a7b3, 0x0ab53}, {0x0a7b4, 0x0a7b5}, {0x0a7b6, 0x0a7b7}, {0x0a7b8, 0x0a7b9},
+    {0x0a7ba, 0x0a7bb}, {0x0a7bc, 0x0a7bd}, {0x0a7be, 0x0a7bf}, {0x0a7c0, 0x0a7c1},
+    {0x0a7c2, 0x0a7c3}, {0x0a7c4, 0x0a794}, {0x0a7c5, 0x00282}, {0x0a7c6, 0x01d8e},
+    {0x0a7c7, 0x0a7c8}, {0x0a7c9, 0x0a7ca}, {0x0a7d0, 0x0a7d1}, {0x0a7d6, 0x0a7d7},
+    {0x0a7d8, 0x0a7d9}, {0x0a7f5, 0x0a7f6}, {0x0ff21, 0x0ff41}, {0x0ff22, 0x0ff42},
+    {0x0ff23, 0x0ff43}, {0x0ff24, 0x0ff44}, {0x0ff25, 0x0ff45}, {0x0ff26, 0x0ff46},
+    {0x0ff27, 0x0ff47}, {0x0ff28, 0x0ff48}, {0x0ff29, 0x0ff49}, {0x0ff2a, 0x0ff4a},
+    {0x0ff2b, 0x0ff4b}, {0x0ff2c, 0x0ff4c}, {0x0ff2d, 0x0ff4d}, {0x0ff2e, 0x0ff4e},
+    {0x0ff2f, 0x0ff4f}, {0x0ff30, 0x0ff50}, {0x0ff31, 0x0ff51}, {0x0ff32, 0x0ff52},
+    {0x0ff33, 0x0ff53}, {0x0ff34, 0x0ff54}, {0x0ff35, 0x0ff55}, {0x0ff36, 0x0ff56},
+    {0x0ff37, 0x0ff57}, {0x0ff38, 0x0ff58}, {0x0ff39, 0x0ff59}, {0x0ff3a, 0x0ff5a},
+    {0x10400, 0x10428}, {0x10401, 0x10429}, {0x10402, 0x1042a}, {0x10403, 0x1042b},
+    {0x10404, 0x1042c}, {0x10405, 0x1042d}, {0x10406, 0x1042e}, {0x10407, 0x1042f},
+    {0x10408, 0x10430}, {0x10409, 0x10431}, {0x1040a, 0x10432}, {0x1040b, 0x10433},
+    {0x1040c, 0x10434}, {0x1040d, 0x10435}, {0x1040e, 0x10436}, {0x1040f, 0x10437},
+    {0x10410, 0x10438}, {0x10411, 0x10439}, {0x10412, 0x1043a}, {0x10413, 0x1043b},
+    {0x10414, 0x1043c}, {0x10415, 0x1043d}, {0x10416, 0x1043e}, {0x10417, 0x1043f},
+    {0x10418, 0x10440}, {0x10419, 0x10441}, {0x1041a, 0x10442}, {0x1041b, 0x10443},
+    {0x1041c, 0x10444}, {0x1041d, 0x10445}, {0x1041e, 0x10446}, {0x1041f, 0x10447},
+    {0x10420, 0x10448}, {0x10421, 0x10449}, {0x10422, 0x1044a}, {0x10423, 0x1044b},
+    {0x10424, 0x1044c}, {0x10425, 0x1044d}, {0x10426, 0x1044e}, {0x10427, 0x1044f},
+    {0x104b0, 0x104d8}, {0x104b1, 0x104d9}, {0x104b2, 0x104da}, {0x104b3, 0x104db},
+    {0x104b4, 0x104dc}, {0x104b5, 0x104dd}, {0x104b6, 0x104de}, {0x104b7, 0x104df},
+    {0x104b8, 0x104e0}, {0x104b9, 0x104e1}, {0x104ba, 0x104e2}, {0x104bb, 0x104e3},
+    {0x104bc, 0x104e4}, {0x104bd, 0x104e5}, {0x104be, 0x104e6}, {0x104bf, 0x104e7},
+    {0x104c0, 0x104e8}, {0x104c1, 0x104e9}, {0x104c2, 0x104ea}, {0x104c3, 0x104eb},
+    {0x104c4, 0x104ec}, {0x104c5, 0x104ed}, {0x104c6, 0x104ee}, {0x104c7, 0x104ef},
+    {0x104c8, 0x104f0}, {0x104c9, 0x104f1}, {0x104ca, 0x104f2}, {0x104cb, 0x104f3},
+    {0x104cc, 0x104f4}, {0x104cd, 0x104f5}, {0x104ce, 0x104f6}, {0x104cf, 0x104f7},
+    {0x104d0, 0x104f8}, {0x104d1, 0x104f9}, {0x104d2, 0x104fa}, {0x104d3, 0x104fb},
+    {0x10570, 0x10597}, {0x10571, 0x10598}, {0x10572, 0x10599}, {0x10573, 0x1059a},
+    {0x10574, 0x1059b}, {0x10575, 0x1059c}, {0x10576, 0x1059d}, {0x10577, 0x1059e},
+    {0x10578, 0x1059f}, {0x10579, 0x105a0}, {0x1057a, 0x105a1}, {0x1057c, 0x105a3},
+    {0x1057d, 0x105a4}, {0x1057e, 0x105a5}, {0x1057f, 0x105a6}, {0x10580, 0x105a7},
+    {0x10581, 0x105a8}, {0x10582, 0x105a9}, {0x10583, 0x105aa}, {0x10584, 0x105ab},
+    {0x10585, 0x105ac}, {0x10586, 0x105ad}, {0x10587, 0x105ae}, {0x10588, 0x105af},
+    {0x10589, 0x105b0}, {0x1058a, 0x105b1}, {0x1058c, 0x105b3}, {0x1058d, 0x105b4},
+    {0x1058e, 0x105b5}, {0x1058f, 0x105b6}, {0x10590, 0x105b7}, {0x10591, 0x105b8},
+    {0x10592, 0x105b9}, {0x10594, 0x105bb}, {0x10595, 0x105bc}, {0x10c80, 0x10cc0},
+    {0x10c81, 0x10cc1}, {0x10c82, 0x10cc2}, {0x10c83, 0x10cc3}, {0x10c84, 0x10cc4},
+    {0x10c85, 0x10cc5}, {0x10c86, 0x10cc6}, {0x10c87, 0x10cc7}, {0x10c88, 0x10cc8},
+    {0x10c89, 0x10cc9}, {0x10c8a, 0x10cca}, {0x10c8b, 0x10ccb}, {0x10c8c, 0x10ccc},
+    {0x10c8d, 0x10ccd}, {0x10c8e, 0x10cce}, {0x10c8f, 0x10ccf}, {0x10c90, 0x10cd0},
+    {0x10c91, 0x10cd1}, {0x10c92, 0x10cd2}, {0x10c93, 0x10cd3}, {0x10c94, 0x10cd4},
+    {0x10c95, 0x10cd5}, {0x10c96, 0x10cd6}, {0x10c97, 0x10cd7}, {0x10c98, 0x10cd8},
+    {0x10c99, 0x10cd9}, {0x10c9a, 0x10cda}, {0x10c9b, 0x10cdb}, {0x10c9c, 0x10cdc},
+    {0x10c9d, 0x10cdd}, {0x10c9e, 0x10cde}, {0x10c9f, 0x10cdf}, {0x10ca0, 0x10ce0},
+    {0x10ca1, 0x10ce1}, {0x10ca2, 0x10ce2}, {0x10ca3, 0x10ce3}, {0x10ca4, 0x10ce4},
+    {0x10ca5, 0x10ce5}, {0x10ca6, 0x10ce6}, {0x10ca7, 0x10ce7}, {0x10ca8, 0x10ce8},
+    {0x10ca9, 0x10ce9}, {0x10caa, 0x10cea}, {0x10cab, 0x10ceb}, {0x10cac, 0x10cec},
+    {0x10cad, 0x10ced}, {0x10cae, 0x10cee}, {0x10caf, 0x10cef}, {0x10cb0, 0x10cf0},
+    {0x10cb1, 0x10cf1}, {0x10cb2, 0x10cf2}, {0x118a0, 0x118c0}, {0x118a1, 0x118c1},
+    {0x118a2, 0x118c2}, {0x118a3, 0x118c3}, {0x118a4, 0x118c4}, {0x118a5, 0x118c5},
+    {0x118a6, 0x118c6}, {0x118a7, 0x118c7}, {0x118a8, 0x118c8}, {0x118a9, 0x118c9},
+    {0x118aa, 0x118ca}, {0x118ab, 0x118cb}, {0x118ac, 0x118cc}, {0x118ad, 0x118cd},
+    {0x118ae, 0x118ce}, {0x118af, 0x118cf}, {0x118b0, 0x118d0}, {0x118b1, 0x118d1},
+    {0x118b2, 0x118d2}, {0x118b3, 0x118d3}, {0x118b4, 0x118d4}, {0x118b5, 0x118d5},
+    {0x118b6, 0x118d6}, {0x118b7, 0x118d7}, {0x118b8, 0x118d8}, {0x118b9, 0x118d9},
+    {0x118ba, 0x118da}, {0x118bb, 0x118db}, {0x118bc, 0x118dc}, {0x118bd, 0x118dd},
+    {0x118be, 0x118de}, {0x118bf, 0x118df}, {0x16e40, 0x16e60}, {0x16e41, 0x16e61},
+    {0x16e42, 0x16e62}, {0x16e43, 0x16e63}, {0x16e44, 0x16e64}, {0x16e45, 0x16e65},
+    {0x16e46, 0x16e66}, {0x16e47, 0x16e67}, {0x16e48, 0x16e68}, {0x16e49, 0x16e69},
+    {0x16e4a, 0x16e6a}, {0x16e4b, 0x16e6b}, {0x16e4c, 0x16e6c}, {0x16e4d, 0x16e6d},
+    {0x16e4e, 0x16e6e}, {0x16e4f, 0x16e6f}, {0x16e50, 0x16e70}, {0x16e51, 0x16e71},
+    {0x16e52, 0x16e72}, {0x16e53, 0x16e73}, {0x16e54, 0x16e74}, {0x16e55, 0x16e75},
+    {0x16e56, 0x16e76}, {0x16e57, 0x16e77}, {0x16e58, 0x16e78}, {0x16e59, 0x16e79},
+    {0x16e5a, 0x16e7a}, {0x16e5b, 0x16e7b}, {0x16e5c, 0x16e7c}, {0x16e5d, 0x16e7d},
+    {0x16e5e, 0x16e7e}, {0x16e5f, 0x16e7f}, {0x1e900, 0x1e922}, {0x1e901, 0x1e923},
+    {0x1e902, 0x1e924}, {0x1e903, 0x1e925}, {0x1e904, 0x1e926}, {0x1e905, 0x1e927},
+    {0x1e906, 0x1e928}, {0x1e907, 0x1e929}, {0x1e908, 0x1e92a}, {0x1e909, 0x1e92b},
+    {0x1e90a, 0x1e92c}, {0x1e90b, 0x1e92d}, {0x1e90c, 0x1e92e}, {0x1e90d, 0x1e92f},
+    {0x1e90e, 0x1e930}, {0x1e90f, 0x1e931}, {0x1e910, 0x1e932}, {0x1e911, 0x1e933},
+    {0x1e912, 0x1e934}, {0x1e913, 0x1e935}, {0x1e914, 0x1e936}, {0x1e915, 0x1e937},
+    {0x1e916, 0x1e938}, {0x1e917, 0x1e939}, {0x1e918, 0x1e93a}, {0x1e919, 0x1e93b},
+    {0x1e91a, 0x1e93c}, {0x1e91b, 0x1e93d}, {0x1e91c, 0x1e93e}, {0x1e91d, 0x1e93f},
+    {0x1e91e, 0x1e940}, {0x1e91f, 0x1e941}, {0x1e920, 0x1e942}, {0x1e921, 0x1e943},
+};
+const size_t LOWERCASE_COUNT = 1432;
+
+const Fold FOLD[] = {
+    {0x000aa, 0, 1}, {0x000b5, 1, 1}, {0x000ba, 2, 1}, {0x000c0, 3, 1},
+    {0x000c1, 4, 1}, {0x000c2, 5, 1}, {0x000c3, 6, 1}, {0x000c4, 7, 1},
+    {0x000c5, 8, 1}, {0x000c7, 9, 1}, {0x000c8, 10, 1}, {0x000c9, 11, 1},
+    {0x000ca, 12, 1}, {0x000cb, 13, 1}, {0x000cc, 14, 1}, {0x000cd, 15, 1},
+    {0x000ce, 16, 1}, {0x000cf, 17, 1}, {0x000d1, 18, 1}, {0x000d2, 19, 1},
+    {0x000d3, 20, 1}, {0x000d4, 21, 1}, {0x000d5, 22, 1}, {0x000d6, 23, 1},
+    {0x000d9, 24, 1}, {0x000da, 25, 1}, {0x000db, 26, 1}, {0x000dc, 27, 1},
+    {0x000dd, 28, 1}, {0x000e0, 29, 1}, {0x000e1, 30, 1}, {0x000e2, 31, 1},
+    {0x000e3, 32, 1}, {0x000e4, 33, 1}, {0x000e5, 34, 1}, {0x000e7, 35, 1},
+    {0x000e8, 36, 1}, {0x000e9, 37, 1}, {0x000ea, 38, 1}, {0x000eb, 39, 1},
+    {0x000ec, 40, 1}, {0x000ed, 41, 1}, {0x000ee, 42, 1}, {0x000ef, 43, 1},
+    {0x000f1, 44, 1}, {0x000f2, 45, 1}, {0x000f3, 46, 1}, {0x000f4, 47, 1},
+    {0x000f5, 48, 1}, {0x000f6, 49, 1}, {0x000f9, 50, 1}, {0x000fa, 51, 1},
+    {0x000fb, 52, 1}, {0x000fc, 53, 1}, {0x000fd, 54, 1}, {0x000ff, 55, 1},
+    {0x00100, 56, 1}, {0x00101, 57, 1}, {0x00102, 58, 1}, {0x00103, 59, 1},
+    {0x00104, 60, 1}, {0x00105, 61, 1}, {0x00106, 62, 1}, {0x00107, 63, 1},
+    {0x00108, 64, 1}, {0x00109, 65, 1}, {0x0010a, 66, 1}, {0x0010b, 67, 1},
+    {0x0010c, 68, 1}, {0x0010d, 69, 1}, {0x0010e, 70, 1}, {0x0010f, 71, 1},
+    {0x00112, 72, 1}, {0x00113, 73, 1}, {0x00114, 74, 1}, {0x00115, 75, 1},
+    {0x00116, 76, 1}, {0x00117, 77, 1}, {0x00118, 78, 1}, {0x00119, 79, 1},
+    {0x0011a, 80, 1}, {0x0011b, 81, 1}, {0x0011c, 82, 1}, {0x0011d, 83, 1},
+    {0x0011e, 84, 1}, {0x0011f, 85, 1}, {0x00120, 86, 1}, {0x00121, 87, 1},
+    {0x00122, 88, 1}, {0x00123, 89, 1}, {0x00124, 90, 1}, {0x00125, 91, 1},
+    {0x00128, 92, 1}, {0x00129, 93, 1}, {0x0012a, 94, 1}, {0x0012b, 95, 1},
+    {0x0012c, 96, 1}, {0x0012d, 97, 1}, {0x0012e, 98, 1}, {0x0012f, 99, 1},
+    {0x00130, 100, 1}, {0x00132, 101, 2}, {0x00133, 103, 2}, {0x00134, 105, 1},
+    {0x00135, 106, 1}, {0x00136, 107, 1}, {0x00137, 108, 1}, {0x00139, 109, 1},
+    {0x0013a, 110, 1}, {0x0013b, 111, 1}, {0x0013c, 112, 1}, {0x0013d, 113, 1},
+    {0x0013e, 114, 1}, {0x0013f, 115, 2}, {0x00140, 117, 2}, {0x00143, 119, 1},
+    {0x00144, 120, 1}, {0x00145, 121, 1}, {0x00146, 122, 1}, {0x00147, 123, 1},
+    {0x00148, 124, 1}, {0x00149, 125, 2}, {0x0014c, 127, 1}, {0x0014d, 128, 1},
+    {0x0014e, 129, 1}, {0x0014f, 130, 1}, {0x00150, 131, 1}, {0x00151, 132, 1},
+    {0x00154, 133, 1}, {0x00155, 134, 1}, {0x00156, 135, 1}, {0x00157, 136, 1},
+    {0x00158, 137, 1}, {0x00159, 138, 1}, {0x0015a, 139, 1}, {0x0015b, 140, 1},
+    {0x0015c, 141, 1}, {0x0015d, 142, 1}, {0x0015e, 143, 1}, {0x0015f, 144, 1},
+    {0x00160, 145, 1}, {0x00161, 146, 1}, {0x00162, 147, 1}, {0x00163, 148, 1},
+    {0x00164, 149, 1}, {0x00165, 150, 1}, {0x00168, 151, 1}, {0x00169, 152, 1},
+    {0x0016a, 153, 1}, {0x0016b, 154, 1}, {0x0016c, 155, 1}, {0x0016d, 156, 1},
+    {0x0016e, 157, 1}, {0x0016f, 158, 1}, {0x00170, 159, 1}, {0x00171, 160, 1},
+    {0x00172, 161, 1}, {0x00173, 162, 1}, {0x00174, 163, 1}, {0x00175, 164, 1},
+    {0x00176, 165, 1}, {0x00177, 166, 1}, {0x00178, 167, 1}, {0x00179, 168, 1},
+    {0x0017a, 169, 1}, {0x0017b, 170, 1}, {0x0017c, 171, 1}, {0x0017d, 172, 1},
+    {0x0017e, 173, 1}, {0x0017f, 174, 1}, {0x001a0, 175, 1}, {0x001a1, 176, 1},
+    {0x001af, 177, 1}, {0x001b0, 178, 1}, {0x001c4, 179, 2}, {0x001c5, 181, 2},
+    {0x001c6, 183, 2}, {0x001c7, 185, 2}, {0x001c8, 187, 2}, {0x001c9, 189, 2},
+    {0x001ca, 191, 2}, {0x001cb, 193, 2}, {0x001cc, 195, 2}, {0x001cd, 197, 1},
+    {0x001ce, 198, 1}, {0x001cf, 199, 1}, {0x001d0, 200, 1}, {0x001d1, 201, 1},
+    {0x001d2, 202, 1}, {0x001d3, 203, 1}, {0x001d4, 204, 1}, {0x001d5, 205, 1},
+    {0x001d6, 206, 1}, {0x001d7, 207, 1}, {0x001d8, 208, 1}, {0x001d9, 209, 1},
+    {0x001da, 210, 1}, {0x001db, 211, 1}, {0x001dc, 212, 1}, {0x001de, 213, 1},
+    {0x001df, 214, 1}, {0x001e0, 215, 1}, {0x001e1, 216, 1}, {0x001e2, 217, 1},
+    {0x001e3, 218, 1}, {0x001e6, 219, 1}, {0x001e7, 220, 1}, {0x001e8, 221, 1},
+    {0x001e9, 222, 1}, {0x001ea, 223, 1}, {0x001eb, 224, 1}, {0x001ec, 225, 1},
+    {0x001ed, 226, 1}, {0x001ee, 227, 1}, {0x001ef, 228, 1}, {0x001f0, 229, 1},
+    {0x001f1, 230, 2}, {0x001f2, 232, 2}, {0x001f3, 234, 2}, {0x001f4, 236, 1},
+    {0x001f5, 237, 1}, {0x001f8, 238, 1}, {0x001f9, 239, 1}, {0x001fa, 240, 1},
+    {0x001fb, 241, 1}, {0x001fc, 242, 1}, {0x001fd, 243, 1}, {0x001fe, 244, 1},
+    {0x001ff, 245, 1}, {0x00200, 246, 1}, {0x00201, 247, 1}, {0x00202, 248, 1},
+    {0x00203, 249, 1}, {0x00204, 250, 1}, {0x00205, 251, 1}, {0x00206, 252, 1},
+    {0x00207, 253, 1}, {0x00208, 254, 1}, {0x00209, 255, 1}, {0x0020a, 256, 1},
+    {0x0020b, 257, 1}, {0x0020c, 258, 1}, {0x0020d, 259, 1}, {0x0020e, 260, 1},
+    {0x0020f, 261, 1}, {0x00210, 262, 1}, {0x00211, 263, 1}, {0x00212, 264, 1},
+    {0x00213, 265, 1}, {0x00214, 266, 1}, {0x00215, 267, 1}, {0x00216, 268, 1},
+    {0x00217, 269, 1}, {0x00218, 270, 1}, {0x00219, 271, 1}, {0x0021a, 272, 1},
+    {0x0021b, 273, 1}, {0x0021e, 274, 1}, {0x0021f, 275, 1}, {0x00226, 276, 1},
+    {0x00227, 277, 1}, {0x00228, 278, 1}, {0x00229, 279, 1}, {0x0022a, 280, 1},
+    {0x0022b, 281, 1}, {0x0022c, 282, 1}, {0x0022d, 283, 1}, {0x0022e, 284, 1},
+    {0x0022f, 285, 1}, {0x00230, 286, 1}, {0x00231, 287, 1}, {0x00232, 288, 1},
+    {0x00233, 289, 1}, {0x002b0, 290, 1}, {0x002b1, 291, 1}, {0x002b2, 292, 1},
+    {0x002b3, 293, 1}, {0x002b4, 294, 1}, {0x002b5, 295, 1}, {0x002b6, 296, 1},
+    {0x002b7, 297, 1}, {0x002b8, 298, 1}, {0x002e0, 299, 1}, {0x002e1, 300, 1},
+    {0x002e2, 301, 1}, {0x002e3, 302, 1}, {0x002e4, 303, 1}, {0x00374, 304, 1},
+    {0x0037a, 305, 1}, {0x00386, 306, 1}, {0x00388, 307, 1}, {0x00389, 308, 1},
+    {0x0038a, 309, 1}, {0x0038c, 310, 1}, {0x0038e, 311, 1}, {0x0038f, 312, 1},
+    {0x00390, 313, 1}, {0x003aa, 314, 1}, {0x003ab, 315, 1}, {0x003ac, 316, 1},
+    {0x003ad, 317, 1}, {0x003ae, 318, 1}, {0x003af, 319, 1}, {0x003b0, 320, 1},
+    {0x003ca, 321, 1}, {0x003cb, 322, 1}, {0x003cc, 323, 1}, {0x003cd, 324, 1},
+    {0x003ce, 325, 1}, {0x003d0, 326, 1}, {0x003d1, 327, 1}, {0x003d2, 328, 1},
+    {0x003d3, 329, 1}, {0x003d4, 330, 1}, {0x003d5, 331, 1}, {0x003d6, 332, 1},
+    {0x003f0, 333, 1}, {0x003f1, 334, 1}, {0x003f2, 335, 1}, {0x003f4, 336, 1},
+    {0x003f5, 337, 1}, {0x003f9, 338, 1}, {0x00400, 339, 1}, {0x00401, 340, 1},
+    {0x00403, 341, 1}, {0x00407, 342, 1}, {0x0040c, 343, 1}, {0x0040d, 344, 1},
+    {0x0040e, 345, 1}, {0x00419, 346, 1}, {0x00439, 347, 1}, {0x00450, 348, 1},
+    {0x00451, 349, 1}, {0x00453, 350, 1}, {0x00457, 351, 1}, {0x0045c, 352, 1},
+    {0x0045d, 353, 1}, {0x0045e, 354, 1}, {0x00476, 355, 1}, {0x00477, 356, 1},
+    {0x004c1, 357, 1}, {0x004c2, 358, 1}, {0x004d0, 359, 1}, {0x004d1, 360, 1},
+    {0x004d2, 361, 1}, {0x004d3, 362, 1}, {0x004d6, 363, 1}, {0x004d7, 364, 1},
+    {0x004da, 365, 1}, {0x004db, 366, 1}, {0x004dc, 367, 1}, {0x004dd, 368, 1},
+    {0x004de, 369, 1}, {0x004df, 370, 1}, {0x004e2, 371, 1}, {0x004e3, 372, 1},
+    {0x004e4, 373, 1}, {0x004e5, 374, 1}, {0x004e6, 375, 1}, {0x004e7, 376, 1},
+    {0x004ea, 377, 1}, {0x004eb, 378, 1}, {0x004ec, 379, 1}, {0x004ed, 380, 1},
+    {0x004ee, 381, 1}, {0x004ef, 382, 1}, {0x004f0, 383, 1}, {0x004f1, 384, 1},
+    {0x004f2, 385, 1}, {0x004f3, 386, 1}, {0x004f4, 387, 1}, {0x004f5, 388, 1},
+    {0x004f8, 389, 1}, {0x004f9, 390, 1}, {0x00587, 391, 2}, {0x00622, 393, 2},
+    {0x00623, 395, 2}, {0x00624, 397, 2}, {0x00625, 399, 2}, {0x00626, 401, 2},
+    {0x00675, 403, 2}, {0x00676, 405, 2}, {0x00677, 407, 2}, {0x00678, 409, 2},
+    {0x006c0, 411, 2}, {0x006c2, 413, 2}, {0x006d3, 415, 2}, {0x00929, 417, 2},
+    {0x00931, 419, 2}, {0x00934, 421, 2}, {0x00958, 423, 2}, {0x00959, 425, 2},
+    {0x0095a, 427, 2}, {0x0095b, 429, 2}, {0x0095c, 431, 2}, {0x0095d, 433, 2},
+    {0x0095e, 435, 2}, {0x0095f, 437, 2}, {0x009dc, 439, 2}, {0x009dd, 441, 2},
+    {0x009df, 443, 2}, {0x00a33, 445, 2}, {0x00a36, 447, 2}, {0x00a59, 449, 2},
+    {0x00a5a, 451, 2}, {0x00a5b, 453, 2}, {0x00a5e, 455, 2}, {0x00b5c, 457, 2},
+    {0x00b5d, 459, 2}, {0x00b94, 461, 2}, {0x00e33, 463, 2}, {0x00eb3, 465, 2},
+    {0x00edc, 467, 2}, {0x00edd, 469, 2}, {0x00f43, 471, 2}, {0x00f4d, 473, 2},
+    {0x00f52, 475, 2}, {0x00f57, 477, 2}, {0x00f5c, 479, 2}, {0x00f69, 481, 2},
+    {0x01026, 483, 2}, {0x010fc, 485, 1}, {0x01b06, 486, 2}, {0x01b08, 488, 2},
+    {0x01b0a, 490, 2}, {0x01b0c, 492, 2}, {0x01b0e, 494, 2}, {0x01b12, 496, 2},
+    {0x01d2c, 498, 1}, {0x01d2d, 499, 1}, {0x01d2e, 500, 1}, {0x01d30, 501, 1},
+    {0x01d31, 502, 1}, {0x01d32, 503, 1}, {0x01d33, 504, 1}, {0x01d34, 505, 1},
+    {0x01d35, 506, 1}, {0x01d36, 507, 1}, {0x01d37, 508, 1}, {0x01d38, 509, 1},
+    {0x01d39, 510, 1}, {0x01d3a, 511, 1}, {0x01d3c, 512, 1}, {0x01d3d, 513, 1},
+    {0x01d3e, 514, 1}, {0x01d3f, 515, 1}, {0x01d40, 516, 1}, {0x01d41, 517, 1},
+    {0x01d42, 518, 1}, {0x01d43, 519, 1}, {0x01d44, 520, 1}, {0x01d45, 521, 1},
+    {0x01d46, 522, 1}, {0x01d47, 523, 1}, {0x01d48, 524, 1}, {0x01d49, 525, 1},
+    {0x01d4a, 526, 1}, {0x01d4b, 527, 1}, {0x01d4c, 528, 1}, {0x01d4d, 529, 1},
+    {0x01d4f, 530, 1}, {0x01d50, 531, 1}, {0x01d51, 532, 1}, {0x01d52, 533, 1},
+    {0x01d53, 534, 1}, {0x01d54, 535, 1}, {0x01d55, 536, 1}, {0x01d56, 537, 1},
+    {0x01d57, 538, 1}, {0x01d58, 539, 1}, {0x01d59, 540, 1}, {0x01d5a, 541, 1},
+    {0x01d5b, 542, 1}, {0x01d5c, 543, 1}, {0x01d5d, 544, 1}, {0x01d5e, 545, 1},
+    {0x01d5f, 546, 1}, {0x01d60, 547, 1}, {0x01d61, 548, 1}, {0x01d62, 549, 1},
+    {0x01d63, 550, 1}, {0x01d64, 551, 1}, {0x01d65, 552, 1}, {0x01d66, 553, 1},
+    {0x01d67, 554, 1}, {0x01d68, 555, 1}, {0x01d69, 556, 1}, {0x01d6a, 557, 1},
+    {0x01d78, 558, 1}, {0x01d9b, 559, 1}, {0x01d9c, 560, 1}, {0x01d9d, 561, 1},
+    {0x01d9e, 562, 1}, {0x01d9f, 563, 1}, {0x01da0, 564, 1}, {0x01da1, 565, 1},
+    {0x01da2, 566, 1}, {0x01da3, 567, 1}, {0x01da4, 568, 1}, {0x01da5, 569, 1},
+    {0x01da6, 570, 1}, {0x01da7, 571, 1}, {0x01da8, 572, 1}, {0x01da9, 573, 1},
+    {0x01daa, 574, 1}, {0x01dab, 575, 1}, {0x01dac, 576, 1}, {0x01dad, 577, 1},
+    {0x01dae, 578, 1}, {0x01daf, 579, 1}, {0x01db0, 580, 1}, {0x01db1, 581, 1},
+    {0x01db2, 582, 1}, {0x01db3, 583, 1}, {0x01db4, 584, 1}, {0x01db5, 585, 1},
+    {0x01db6, 586, 1}, {0x01db7, 587, 1}, {0x01db8, 588, 1}, {0x01db9, 589, 1},
+    {0x01dba, 590, 1}, {0x01dbb, 591, 1}, {0x01dbc, 592, 1}, {0x01dbd, 593, 1},
+    {0x01dbe, 594, 1}, {0x01dbf, 595, 1}, {0x01e00, 596, 1}, {0x01e01, 597, 1},
+    {0x01e02, 598, 1}, {0x01e03, 599, 1}, {0x01e04, 600, 1}, {0x01e05, 601, 1},
+    {0x01e06, 602, 1}, {0x01e07, 603, 1}, {0x01e08, 604, 1}, {0x01e09, 605, 1},
+    {0x01e0a, 606, 1}, {0x01e0b, 607, 1}, {0x01e0c, 608, 1}, {0x01e0d, 609, 1},
+    {0x01e0e, 610, 1}, {0x01e0f, 611, 1}, {0x01e10, 612, 1}, {0x01e11, 613, 1},
+    {0x01e12, 614, 1}, {0x01e13, 615, 1}, {0x01e14, 616, 1}, {0x01e15, 617, 1},
+    {0x01e16, 618, 1}, {0x01e17, 619, 1}, {0x01e18, 620, 1}, {0x01e19, 621, 1},
+    {0x01e1a, 622, 1}, {0x01e1b, 623, 1}, {0x01e1c, 624, 1}, {0x01e1d, 625, 1},
+    {0x01e1e, 626, 1}, {0x01e1f, 627, 1}, {0x01e20, 628, 1}, {0x01e21, 629, 1},
+    {0x01e22, 630, 1}, {0x01e23, 631, 1}, {0x01e24, 632, 1}, {0x01e25, 633, 1},
+    {0x01e26, 634, 1}, {0x01e27, 635, 1}, {0x01e28, 636, 1}, {0x01e29, 637, 1},
+    {0x01e2a, 638, 1}, {0x01e2b, 639, 1}, {0x01e2c, 640, 1}, {0x01e2d, 641, 1},
+    {0x01e2e, 642, 1}, {0x01e2f, 643, 1}, {0x01e30, 644, 1}, {0x01e31, 645, 1},
+    {0x01e32, 646, 1}, {0x01e33, 647, 1}, {0x01e34, 648, 1}, {0x01e35, 649, 1},
+    {0x01e36, 650, 1}, {0x01e37, 651, 1}, {0x01e38, 652, 1}, {0x01e39, 653, 1},
+    {0x01e3a, 654, 1}, {0x01e3b, 655, 1}, {0x01e3c, 656, 1}, {0x01e3d, 657, 1},
+    {0x01e3e, 658, 1}, {0x01e3f, 659, 1}, {0x01e40, 660, 1}, {0x01e41, 661, 1},
+    {0x01e42, 662, 1}, {0x01e43, 663, 1}, {0x01e44, 664, 1}, {0x01e45, 665, 1},
+    {0x01e46, 666, 1}, {0x01e47, 667, 1}, {0x01e48, 668, 1}, {0x01e49, 669, 1},
+    {0x01e4a, 670, 1}, {0x01e4b, 671, 1}, {0x01e4c, 672, 1}, {0x01e4d, 673, 1},
+    {0x01e4e, 674, 1}, {0x01e4f, 675, 1}, {0x01e50, 676, 1}, {0x01e51, 677, 1},
+    {0x01e52, 678, 1}, {0x01e53, 679, 1}, {0x01e54, 680, 1}, {0x01e55, 681, 1},
+    {0x01e56, 682, 1}, {0x01e57, 683, 1}, {0x01e58, 684, 1}, {0x01e59, 685, 1},
+    {0x01e5a, 686, 1}, {0x01e5b, 687, 1}, {0x01e5c, 688, 1}, {0x01e5d, 689, 1},
+    {0x01e5e, 690, 1}, {0x01e5f, 691, 1}, {0x01e60, 692, 1}, {0x01e61, 693, 1},
+    {0x01e62, 694, 1}, {0x01e63, 695, 1}, {0x01e64, 696, 1}, {0x01e65, 697, 1},
+    {0x01e66, 698, 1}, {0x01e67, 699, 1}, {0x01e68, 700, 1}, {0x01e69, 701, 1},
+    {0x01e6a, 702, 1}, {0x01e6b, 703, 1}, {0x01e6c, 704, 1}, {0x01e6d, 705, 1},
+    {0x01e6e, 706, 1}, {0x01e6f, 707, 1}, {0x01e70, 708, 1}, {0x01e71, 709, 1},
+    {0x01e72, 710, 1}, {0x01e73, 711, 1}, {0x01e74, 712, 1}, {0x01e75, 713, 1},
+    {0x01e76, 714, 1}, {0x01e77, 715, 1}, {0x01e78, 716, 1}, {0x01e79, 717, 1},
+    {0x01e7a, 718, 1}, {0x01e7b, 719, 1}, {0x01e7c, 720, 1}, {0x01e7d, 721, 1},
+    {0x01e7e, 722, 1}, {0x01e7f, 723, 1}, {0x01e80, 724, 1}, {0x01e81, 725, 1},
+    {0x01e82, 726, 1}, {0x01e83, 727, 1}, {0x01e84, 728, 1}, {0x01e85, 729, 1},
+    {0x01e86, 730, 1}, {0x01e87, 731, 1}, {0x01e88, 732, 1}, {0x01e89, 733, 1},
+    {0x01e8a, 734, 1}, {0x01e8b, 735, 1}, {0x01e8c, 736, 1}, {0x01e8d, 737, 1},
+    {0x01e8e, 738, 1}, {0x01e8f, 739, 1}, {0x01e90, 740, 1}, {0x01e91, 741, 1},
+    {0x01e92, 742, 1}, {0x01e93, 743, 1}, {0x01e94, 744, 1}, {0x01e95, 745, 1},
+    {0x01e96, 746, 1}, {0x01e97, 747, 1}, {0x01e98, 748, 1}, {0x01e99, 749, 1},
+    {0x01e9a, 750, 2}, {0x01e9b, 752, 1}, {0x01ea0, 753, 1}, {0x01ea1, 754, 1},
+    {0x01ea2, 755, 1}, {0x01ea3, 756, 1}, {0x01ea4, 757, 1}, {0x01ea5, 758, 1},
+    {0x01ea6, 759, 1}, {0x01ea7, 760, 1}, {0x01ea8, 761, 1}, {0x01ea9, 762, 1},
+    {0x01eaa, 763, 1}, {0x01eab, 764, 1}, {0x01eac, 765, 1}, {0x01ead, 766, 1},
+    {0x01eae, 767, 1}, {0x01eaf, 768, 1}, {0x01eb0, 769, 1}, {0x01eb1, 770, 1},
+    {0x01eb2, 771, 1}, {0x01eb3, 772, 1}, {0x01eb4, 773, 1}, {0x01eb5, 774, 1},
+    {0x01eb6, 775, 1}, {0x01eb7, 776, 1}, {0x01eb8, 777, 1}, {0x01eb9, 778, 1},
+    {0x01eba, 779, 1}, {0x01ebb, 780, 1}, {0x01ebc, 781, 1}, {0x01ebd, 782, 1},
+    {0x01ebe, 783, 1}, {0x01ebf, 784, 1}, {0x01ec0, 785, 1}, {0x01ec1, 786, 1},
+    {0x01ec2, 787, 1}, {0x01ec3, 788, 1}, {0x01ec4, 789, 1}, {0x01ec5, 790, 1},
+    {0x01ec6, 791, 1}, {0x01ec7, 792, 1}, {0x01ec8, 793, 1}, {0x01ec9, 794, 1},
+    {0x01eca, 795, 1}, {0x01ecb, 796, 1}, {0x01ecc, 797, 1}, {0x01ecd, 798, 1},
+    {0x01ece, 799, 1}, {0x01ecf, 800, 1}, {0x01ed0, 801, 1}, {0x01ed1, 802, 1},
+    {0x01ed2, 803, 1}, {0x01ed3, 804, 1}, {0x01ed4, 805, 1}, {0x01ed5, 806, 1},
+    {0x01ed6, 807, 1}, {0x01ed7, 808, 1}, {0x01ed8, 809, 1}, {0x01ed9, 810, 1},
+    {0x01eda, 811, 1}, {0x01edb, 812, 1}, {0x01edc, 813, 1}, {0x01edd, 814, 1},
+    {0x01ede, 815, 1}, {0x01edf, 816, 1}, {0x01ee0, 817, 1}, {0x01ee1, 818, 1},
+    {0x01ee2, 819, 1}, {0x01ee3, 820, 1}, {0x01ee4, 821, 1}, {0x01ee5, 822, 1},
+    {0x01ee6, 823, 1}, {0x01ee7, 824, 1}, {0x01ee8, 825, 1}, {0x01ee9, 826, 1},
+    {0x01eea, 827, 1}, {0x01eeb, 828, 1}, {0x01eec, 829, 1}, {0x01eed, 830, 1},
+    {0x01eee, 831, 1}, {0x01eef, 832, 1}, {0x01ef0, 833, 1}, {0x01ef1, 834, 1},
+    {0x01ef2, 835, 1}, {0x01ef3, 836, 1}, {0x01ef4, 837, 1}, {0x01ef5, 838, 1},
+    {0x01ef6, 839, 1}, {0x01ef7, 840, 1}, {0x01ef8, 841, 1}, {0x01ef9, 842, 1},
+    {0x01f00, 843, 1}, {0x01f01, 844, 1}, {0x01f02, 845, 1}, {0x01f03, 846, 1},
+    {0x01f04, 847, 1}, {0x01f05, 848, 1}, {0x01f06, 849, 1}, {0x01f07, 850, 1},
+    {0x01f08, 851, 1}, {0x01f09, 852, 1}, {0x01f0a, 853, 1}, {0x01f0b, 854, 1},
+    {0x01f0c, 855, 1}, {0x01f0d, 856, 1}, {0x01f0e, 857, 1}, {0x01f0f, 858, 1},
+    {0x01f10, 859, 1}, {0x01f11, 860, 1}, {0x01f12, 861, 1}, {0x01f13, 862, 1},
+    {0x01f14, 863, 1}, {0x01f15, 864, 1}, {0x01f18, 865, 1}, {0x01f19, 866, 1},
+    {0x01f1a, 867, 1}, {0x01f1b, 868, 1}, {0x01f1c, 869, 1}, {0x01f1d, 870, 1},
+    {0x01f20, 871, 1}, {0x01f21, 872, 1}, {0x01f22, 873, 1}, {0x01f23, 874, 1},
+    {0x01f24, 875, 1}, {0x01f25, 876, 1}, {0x01f26, 877, 1}, {0x01f27, 878, 1},
+    {0x01f28, 879, 1}, {0x01f29, 880, 1}, {0x01f2a, 881, 1}, {0x01f2b, 882, 1},
+    {0x01f2c, 883, 1}, {0x01f2d, 884, 1}, {0x01f2e, 885, 1}, {0x01f2f, 886, 1},
+    {0x01f30, 887, 1}, {0x01f31, 888, 1}, {0x01f32, 889, 1}, {0x01f33, 890, 1},
+    {0x01f34, 891, 1}, {0x01f35, 892, 1}, {0x01f36, 893, 1}, {0x01f37, 894, 1},
+    {0x01f38, 895, 1}, {0x01f39, 896, 1}, {0x01f3a, 897, 1}, {0x01f3b, 898, 1},
+    {0x01f3c, 899, 1}, {0x01f3d, 900, 1}, {0x01f3e, 901, 1}, {0x01f3f, 902, 1},
+    {0x01f40, 903, 1}, {0x01f41, 904, 1}, {0x01f42, 905, 1}, {0x01f43, 906, 1},
+    {0x01f44, 907, 1}, {0x01f45, 908, 1}, {0x01f48, 909, 1}, {0x01f49, 910, 1},
+    {0x01f4a, 911, 1}, {0x01f4b, 912, 1}, {0x01f4c, 913, 1}, {0x01f4d, 914, 1},
+    {0x01f50, 915, 1}, {0x01f51, 916, 1}, {0x01f52, 917, 1}, {0x01f53, 918, 1},
+    {0x01f54, 919, 1}, {0x01f55, 920, 1}, {0x01f56, 921, 1}, {0x01f57, 922, 1},
+    {0x01f59, 923, 1}, {0x01f5b, 924, 1}, {0x01f5d, 925, 1}, {0x01f5f, 926, 1},
+    {0x01f60, 927, 1}, {0x01f61, 928, 1}, {0x01f62, 929, 1}, {0x01f63, 930, 1},
+    {0x01f64, 931, 1}, {0x01f65, 932, 1}, {0x01f66, 933, 1}, {0x01f67, 934, 1},
+    {0x01f68, 935, 1}, {0x01f69, 936, 1}, {0x01f6a, 937, 1}, {0x01f6b, 938, 1},
+    {0x01f6c, 939, 1}, {0x01f6d, 940, 1}, {0x01f6e, 941, 1}, {0x01f6f, 942, 1},
+    {0x01f70, 943, 1}, {0x01f71, 944, 1}, {0x01f72, 945, 1}, {0x01f73, 946, 1},
+    {0x01f74, 947, 1}, {0x01f75, 948, 1}, {0x01f76, 949, 1}, {0x01f77, 950, 1},
+    {0x01f78, 951, 1}, {0x01f79, 952, 1}, {0x01f7a, 953, 1}, {0x01f7b, 954, 1},
+    {0x01f7c, 955, 1}, {0x01f7d, 956, 1}, {0x01f80, 957, 1}, {0x01f81, 958, 1},
+    {0x01f82, 959, 1}, {0x01f83, 960, 1}, {0x01f84, 961, 1}, {0x01f85, 962, 1},
+    {0x01f86, 963, 1}, {0x01f87, 964, 1}, {0x01f88, 965, 1}, {0x01f89, 966, 1},
+    {0x01f8a, 967, 1}, {0x01f8b, 968, 1}, {0x01f8c, 969, 1}, {0x01f8d, 970, 1},
+    {0x01f8e, 971, 1}, {0x01f8f, 972, 1}, {0x01f90, 973, 1}, {0x01f91, 974, 1},
+    {0x01f92, 975, 1}, {0x01f93, 976, 1}, {0x01f94, 977, 1}, {0x01f95, 978, 1},
+    {0x01f96, 979, 1}, {0x01f97, 980, 1}, {0x01f98, 981, 1}, {0x01f99, 982, 1},
+    {0x01f9a, 983, 1}, {0x01f9b, 984, 1}, {0x01f9c, 985, 1}, {0x01f9d, 986, 1},
+    {0x01f9e, 987, 1}, {0x01f9f, 988, 1}, {0x01fa0, 989, 1}, {0x01fa1, 990, 1},
+    {0x01fa2, 991, 1}, {0x01fa3, 992, 1}, {0x01fa4, 993, 1}, {0x01fa5, 994, 1},
+    {0x01fa6, 995, 1}, {0x01fa7, 996, 1}, {0x01fa8, 997, 1}, {0x01fa9, 998, 1},
+    {0x01faa, 999, 1}, {0x01fab, 1000, 1}, {0x01fac, 1001, 1}, {0x01fad, 1002, 1},
+    {0x01fae, 1003, 1}, {0x01faf, 1004, 1}, {0x01fb0, 1005, 1}, {0x01fb1, 1006, 1},
+    {0x01fb2, 1007, 1}, {0x01fb3, 1008, 1}, {0x01fb4, 1009, 1}, {0x01fb6, 1010, 1},
+    {0x01fb7, 1011, 1}, {0x01fb8, 1012, 1}, {0x01fb9, 1013, 1}, {0x01fba, 1014, 1},
+    {0x01fbb, 1015, 1}, {0x01fbc, 1016, 1}, {0x01fbe, 1017, 1}, {0x01fc2, 1018, 1},
+    {0x01fc3, 1019, 1}, {0x01fc4, 1020, 1}, {0x01fc6, 1021, 1}, {0x01fc7, 1022, 1},
+    {0x01fc8, 1023, 1}, {0x01fc9, 1024, 1}, {0x01fca, 1025, 1}, {0x01fcb, 1026, 1},
+    {0x01fcc, 1027, 1}, {0x01fd0, 1028, 1}, {0x01fd1, 1029, 1}, {0x01fd2, 1030, 1},
+    {0x01fd3, 1031, 1}, {0x01fd6, 1032, 1}, {0x01fd7, 1033, 1}, {0x01fd8, 1034, 1},
+    {0x01fd9, 1035, 1}, {0x01fda, 1036, 1}, {0x01fdb, 1037, 1}, {0x01fe0, 1038, 1},
+    {0x01fe1, 1039, 1}, {0x01fe2, 1040, 1}, {0x01fe3, 1041, 1}, {0x01fe4, 1042, 1},
+    {0x01fe5, 1043, 1}, {0x01fe6, 1044, 1}, {0x01fe7, 1045, 1}, {0x01fe8, 1046, 1},
+    {0x01fe9, 1047, 1}, {0x01fea, 1048, 1}, {0x01feb, 1049, 1}, {0x01fec, 1050, 1},
+    {0x01ff2, 1051, 1}, {0x01ff3, 1052, 1}, {0x01ff4, 1053, 1}, {0x01ff6, 1054, 1},
+    {0x01ff7, 1055, 1}, {0x01ff8, 1056, 1}, {0x01ff9, 1057, 1}, {0x01ffa, 1058, 1},
+    {0x01ffb, 1059, 1}, {0x01ffc, 1060, 1}, {0x02071, 1061, 1}, {0x0207f, 1062, 1},
+    {0x02090, 1063, 1}, {0x02091, 1064, 1}, {0x02092, 1065, 1}, {0x02093, 1066, 1},
+    {0x02094, 1067, 1}, {0x02095, 1068, 1}, {0x02096, 1069, 1}, {0x02097, 1070, 1},
+    {0x02098, 1071, 1}, {0x02099, 1072, 1}, {0x0209a, 1073, 1}, {0x0209b, 1074, 1},
+    {0x0209c, 1075, 1}, {0x02102, 1076, 1}, {0x02107, 1077, 1}, {0x0210a, 1078, 1},
+    {0x0210b, 1079, 1}, {0x0210c, 1080, 1}, {0x0210d, 1081, 1}, {0x0210e, 1082, 1},
+    {0x0210f, 1083, 1}, {0x02110, 1084, 1}, {0x02111, 1085, 1}, {0x02112, 1086, 1},
+    {0x02113, 1087, 1}, {0x02115, 1088, 1}, {0x02119, 1089, 1}, {0x0211a, 1090, 1},
+    {0x0211b, 1091, 1}, {0x0211c, 1092, 1}, {0x0211d, 1093, 1}, {0x02124, 1094, 1},
+    {0x02126, 1095, 1}, {0x02128, 1096, 1}, {0x0212a, 1097, 1}, {0x0212b, 1098, 1},
+    {0x0212c, 1099, 1}, {0x0212d, 1100, 1}, {0x0212f, 1101, 1}, {0x02130, 1102, 1},
+    {0x02131, 1103, 1}, {0x02133, 1104, 1}, {0x02134, 1105, 1}, {0x02135, 1106, 1},
+    {0x02136, 1107, 1}, {0x02137, 1108, 1}, {0x02138, 1109, 1}, {0x02139, 1110, 1},
+    {0x0213c, 1111, 1}, {0x0213d, 1112, 1}, {0x0213e, 1113, 1}, {0x0213f, 1114, 1},
+    {0x02145, 1115, 1}, {0x02146, 1116, 1}, {0x02147, 1117, 1}, {0x02148, 1118, 1},
+    {0x02149, 1119, 1}, {0x02c7c, 1120, 1}, {0x02c7d, 1121, 1}, {0x02d6f, 1122, 1},
+    {0x0304c, 1123, 2}, {0x0304e, 1125, 2}, {0x03050, 1127, 2}, {0x03052, 1129, 2},
+    {0x03054, 1131, 2}, {0x03056, 1133, 2}, {0x03058, 1135, 2}, {0x0305a, 1137, 2},
+    {0x0305c, 1139, 2}, {0x0305e, 1141, 2}, {0x03060, 1143, 2}, {0x03062, 1145, 2},
+    {0x03065, 1147, 2}, {0x03067, 1149, 2}, {0x03069, 1151, 2}, {0x03070, 1153, 2},
+    {0x03071, 1155, 2}, {0x03073, 1157, 2}, {0x03074, 1159, 2}, {0x03076, 1161, 2},
+    {0x03077, 1163, 2}, {0x03079, 1165, 2}, {0x0307a, 1167, 2}, {0x0307c, 1169, 2},
+    {0x0307d, 1171, 2}, {0x03094, 1173, 2}, {0x0309e, 1175, 2}, {0x0309f, 1177, 2},
+    {0x030ac, 1179, 2}, {0x030ae, 1181, 2}, {0x030b0, 1183, 2}, {0x030b2, 1185, 2},
+    {0x030b4, 1187, 2}, {0x030b6, 1189, 2}, {0x030b8, 1191, 2}, {0x030ba, 1193, 2},
+    {0x030bc, 1195, 2}, {0x030be, 1197, 2}, {0x030c0, 1199, 2}, {0x030c2, 1201, 2},
+    {0x030c5, 1203, 2}, {0x030c7, 1205, 2}, {0x030c9, 1207, 2}, {0x030d0, 1209, 2},
+    {0x030d1, 1211, 2}, {0x030d3, 1213, 2}, {0x030d4, 1215, 2}, {0x030d6, 1217, 2},
+    {0x030d7, 1219, 2}, {0x030d9, 1221, 2}, {0x030da, 1223, 2}, {0x030dc, 1225, 2},
+    {0x030dd, 1227, 2}, {0x030f4, 1229, 2}, {0x030f7, 1231, 2}, {0x030f8, 1233, 2},
+    {0x030f9, 1235, 2}, {0x030fa, 1237, 2}, {0x030fe, 1239, 2}, {0x030ff, 1241, 2},
+    {0x03131, 1243, 1}, {0x03132, 1244, 1}, {0x03133, 1245, 1}, {0x03134, 1246, 1},
+    {0x03135, 1247, 1}, {0x03136, 1248, 1}, {0x03137, 1249, 1}, {0x03138, 1250, 1},
+    {0x03139, 1251, 1}, {0x0313a, 1252, 1}, {0x0313b, 1253, 1}, {0x0313c, 1254, 1},
+    {0x0313d, 1255, 1}, {0x0313e, 1256, 1}, {0x0313f, 1257, 1}, {0x03140, 1258, 1},
+    {0x03141, 1259, 1}, {0x03142, 1260, 1}, {0x03143, 1261, 1}, {0x03144, 1262, 1},
+    {0x03145, 1263, 1}, {0x03146, 1264, 1}, {0x03147, 1265, 1}, {0x03148, 1266, 1},
+    {0x03149, 1267, 1}, {0x0314a, 1268, 1}, {0x0314b, 1269, 1}, {0x0314c, 1270, 1},
+    {0x0314d, 1271, 1}, {0x0314e, 1272, 1}, {0x0314f, 1273, 1}, {0x03150, 1274, 1},
+    {0x03151, 1275, 1}, {0x03152, 1276, 1}, {0x03153, 1277, 1}, {0x03154, 1278, 1},
+    {0x03155, 1279, 1}, {0x03156, 1280, 1}, {0x03157, 1281, 1}, {0x03158, 1282, 1},
+    {0x03159, 1283, 1}, {0x0315a, 1284, 1}, {0x0315b, 1285, 1}, {0x0315c, 1286, 1},
+    {0x0315d, 1287, 1}, {0x0315e, 1288, 1}, {0x0315f, 1289, 1}, {0x03160, 1290, 1},
+    {0x03161, 1291, 1}, {0x03162, 1292, 1}, {0x03163, 1293, 1}, {0x03164, 1294, 1},
+    {0x03165, 1295, 1}, {0x03166, 1296, 1}, {0x03167, 1297, 1}, {0x03168, 1298, 1},
+    {0x03169, 1299, 1}, {0x0316a, 1300, 1}, {0x0316b, 1301, 1}, {0x0316c, 1302, 1},
+    {0x0316d, 1303, 1}, {0x0316e, 1304, 1}, {0x0316f, 1305, 1}, {0x03170, 1306, 1},
+    {0x03171, 1307, 1}, {0x03172, 1308, 1}, {0x03173, 1309, 1}, {0x03174, 1310, 1},
+    {0x03175, 1311, 1}, {0x03176, 1312, 1}, {0x03177, 1313, 1}, {0x03178, 1314, 1},
+    {0x03179, 1315, 1}, {0x0317a, 1316, 1}, {0x0317b, 1317, 1}, {0x0317c, 1318, 1},
+    {0x0317d, 1319, 1}, {0x0317e, 1320, 1}, {0x0317f, 1321, 1}, {0x03180, 1322, 1},
+    {0x03181, 1323, 1}, {0x03182, 1324, 1}, {0x03183, 1325, 1}, {0x03184, 1326, 1},
+    {0x03185, 1327, 1}, {0x03186, 1328, 1}, {0x03187, 1329, 1}, {0x03188, 1330, 1},
+    {0x03189, 1331, 1}, {0x0318a, 1332, 1}, {0x0318b, 1333, 1}, {0x0318c, 1334, 1},
+    {0x0318d, 1335, 1}, {0x0318e, 1336, 1}, {0x0a69c, 1337, 1}, {0x0a69d, 1338, 1},
+    {0x0a770, 1339, 1}, {0x0a7f2, 1340, 1}, {0x0a7f3, 1341, 1}, {0x0a7f4, 1342, 1},
+    {0x0a7f8, 1343, 1}, {0x0a7f9, 1344, 1}, {0x0ab5c, 1345, 1}, {0x0ab5d, 1346, 1},
+    {0x0ab5e, 1347, 1}, {0x0ab5f, 1348, 1}, {0x0ab69, 1349, 1}, {0x0f900, 1350, 1},
+    {0x0f901, 1351, 1}, {0x0f902, 1352, 1}, {0x0f903, 1353, 1}, {0x0f904, 1354, 1},
+    {0x0f905, 1355, 1}, {0x0f906, 1356, 1}, {0x0f907, 1357, 1}, {0x0f908, 1358, 1},
+    {0x0f909, 1359, 1}, {0x0f90a, 1360, 1}, {0x0f90b, 1361, 1}, {0x0f90c, 1362, 1},
+    {0x0f90d, 1363, 1}, {0x0f90e, 1364, 1}, {0x0f90f, 1365, 1}, {0x0f910, 1366, 1},
+    {0x0f911, 1367, 1}, {0x0f912, 1368, 1}, {0x0f913, 1369, 1}, {0x0f914, 1370, 1},
+    {0x0f915, 1371, 1}, {0x0f916, 1372, 1}, {0x0f917, 1373, 1}, {0x0f918, 1374, 1},
+    {0x0f919, 1375, 1}, {0x0f91a, 1376, 1}, {0x0f91b, 1377, 1}, {0x0f91c, 1378, 1},
+    {0x0f91d, 1379, 1}, {0x0f91e, 1380, 1}, {0x0f91f, 1381, 1}, {0x0f920, 1382, 1},
+    {0x0f921, 1383, 1}, {0x0f922, 1384, 1}, {0x0f923, 1385, 1}, {0x0f924, 1386, 1},
+    {0x0f925, 1387, 1}, {0x0f926, 1388, 1}, {0x0f927, 1389, 1}, {0x0f928, 1390, 1},
+    {0x0f929, 1391, 1}, {0x0f92a, 1392, 1}, {0x0f92b, 1393, 1}, {0x0f92c, 1394, 1},
+    {0x0f92d, 1395, 1}, {0x0f92e, 1396, 1}, {0x0f92f, 1397, 1}, {0x0f930, 1398, 1},
+    {0x0f931, 1399, 1}, {0x0f932, 1400, 1}, {0x0f933, 1401, 1}, {0x0f934, 1402, 1},
+    {0x0f935, 1403, 1}, {0x0f936, 1404, 1}, {0x0f937, 1405, 1}, {0x0f938, 1406, 1},
+    {0x0f939, 1407, 1}, {0x0f93a, 1408, 1}, {0x0f93b, 1409, 1}, {0x0f93c, 1410, 1},
+    {0x0f93d, 1411, 1}, {0x0f93e, 1412, 1}, {0x0f93f, 1413, 1}, {0x0f940, 1414, 1},
+    {0x0f941, 1415, 1}, {0x0f942, 1416, 1}, {0x0f943, 1417, 1}, {0x0f944, 1418, 1},
+    {0x0f945, 1419, 1}, {0x0f946, 1420, 1}, {0x0f947, 1421, 1}, {0x0f948, 1422, 1},
+    {0x0f949, 1423, 1}, {0x0f94a, 1424, 1}, {0x0f94b, 1425, 1}, {0x0f94c, 1426, 1},
+    {0x0f94d, 1427, 1}, {0x0f94e, 1428, 1}, {0x0f94f, 1429, 1}, {0x0f950, 1430, 1},
+    {0x0f951, 1431, 1}, {0x0f952, 1432, 1}, {0x0f953, 1433, 1}, {0x0f954, 1434, 1},
+    {0x0f955, 1435, 1}, {0x0f956, 1436, 1}, {0x0f957, 1437, 1}, {0x0f958, 1438, 1},
+    {0x0f959, 1439, 1}, {0x0f95a, 1440, 1}, {0x0f95b, 1441, 1}, {0x0f95c, 1442, 1},
+    {0x0f95d, 1443, 1}, {0x0f95e, 1444, 1}, {0x0f95f, 1445, 1}, {0x0f960, 1446, 1},
+    {0x0f961, 1447, 1}, {0x0f962, 1448, 1}, {0x0f963, 1449, 1}, {0x0f964, 1450, 1},
+    {0x0f965, 1451, 1}, {0x0f966, 1452, 1}, {0x0f967, 1453, 1}, {0x0f968, 1454, 1},
+    {0x0f969, 1455, 1}, {0x0f96a, 1456, 1}, {0x0f96b, 1457, 1}, {0x0f96c, 1458, 1},
+    {0x0f96d, 1459, 1}, {0x0f96e, 1460, 1}, {0x0f96f, 1461, 1}, {0x0f970, 1462, 1},
+    {0x0f971, 1463, 1}, {0x0f972, 1464, 1}, {0x0f973, 1465, 1}, {0x0f974, 1466, 1},
+    {0x0f975, 1467, 1}, {0x0f976, 1468, 1}, {0x0f977, 1469, 1}, {0x0f978, 1470, 1},
+    {0x0f979, 1471, 1}, {0x0f97a, 1472, 1}, {0x0f97b, 1473, 1}, {0x0f97c, 1474, 1},
+    {0x0f97d, 1475, 1}, {0x0f97e, 1476, 1}, {0x0f97f, 1477, 1}, {0x0f980, 1478, 1},
+    {0x0f981, 1479, 1}, {0x0f982, 1480, 1}, {0x0f983, 1481, 1}, {0x0f984, 1482, 1},
+    {0x0f985, 1483, 1}, {0x0f986, 1484, 1}, {0x0f987, 1485, 1}, {0x0f988, 1486, 1},
+    {0x0f989, 1487, 1}, {0x0f98a, 1488, 1}, {0x0f98b, 1489, 1}, {0x0f98c, 1490, 1},
+    {0x0f98d, 1491, 1}, {0x0f98e, 1492, 1}, {0x0f98f, 1493, 1}, {0x0f990, 1494, 1},
+    {0x0f991, 1495, 1}, {0x0f992, 1496, 1}, {0x0f993, 1497, 1}, {0x0f994, 1498, 1},
+    {0x0f995, 1499, 1}, {0x0f996, 1500, 1}, {0x0f997, 1501, 1}, {0x0f998, 1502, 1},
+    {0x0f999, 1503, 1}, {0x0f99a, 1504, 1}, {0x0f99b, 1505, 1}, {0x0f99c, 1506, 1},
+    {0x0f99d, 1507, 1}, {0x0f99e, 1508, 1}, {0x0f99f, 1509, 1}, {0x0f9a0, 1510, 1},
+    {0x0f9a1, 1511, 1}, {0x0f9a2, 1512, 1}, {0x0f9a3, 1513, 1}, {0x0f9a4, 1514, 1},
+    {0x0f9a5, 1515, 1}, {0x0f9a6, 1516, 1}, {0x0f9a7, 1517, 1}, {0x0f9a8, 1518, 1},
+    {0x0f9a9, 1519, 1}, {0x0f9aa, 1520, 1}, {0x0f9ab, 1521, 1}, {0x0f9ac, 1522, 1},
+    {0x0f9ad, 1523, 1}, {0x0f9ae, 1524, 1}, {0x0f9af, 1525, 1}, {0x0f9b0, 1526, 1},
+    {0x0f9b1, 1527, 1}, {0x0f9b2, 1528, 1}, {0x0f9b3, 1529, 1}, {0x0f9b4, 1530, 1},
+    {0x0f9b5, 1531, 1}, {0x0f9b6, 1532, 1}, {0x0f9b7, 1533, 1}, {0x0f9b8, 1534, 1},
+    {0x0f9b9, 1535, 1}, {0x0f9ba, 1536, 1}, {0x0f9bb, 1537, 1}, {0x0f9bc, 1538, 1},
+    {0x0f9bd, 1539, 1}, {0x0f9be, 1540, 1}, {0x0f9bf, 1541, 1}, {0x0f9c0, 1542, 1},
+    {0x0f9c1, 1543, 1}, {0x0f9c2, 1544, 1}, {0x0f9c3, 1545, 1}, {0x0f9c4, 1546, 1},
+    {0x0f9c5, 1547, 1}, {0x0f9c6, 1548, 1}, {0x0f9c7, 1549, 1}, {0x0f9c8, 1550, 1},
+    {0x0f9c9, 1551, 1}, {0x0f9ca, 1552, 1}, {0x0f9cb, 1553, 1}, {0x0f9cc, 1554, 1},
+    {0x0f9cd, 1555, 1}, {0x0f9ce, 1556, 1}, {0x0f9cf, 1557, 1}, {0x0f9d0, 1558, 1},
+    {0x0f9d1, 1559, 1}, {0x0f9d2, 1560, 1}, {0x0f9d3, 1561, 1}, {0x0f9d4, 1562, 1},
+    {0x0f9d5, 1563, 1}, {0x0f9d6, 1564, 1}, {0x0f9d7, 1565, 1}, {0x0f9d8, 1566, 1},
+    {0x0f9d9, 1567, 1}, {0x0f9da, 1568, 1}, {0x0f9db, 1569, 1}, {0x0f9dc, 1570, 1},
+    {0x0f9dd, 1571, 1}, {0x0f9de, 1572, 1}, {0x0f9df, 1573, 1}, {0x0f9e0, 1574, 1},
+    {0x0f9e1, 1575, 1}, {0x0f9e2, 1576, 1}, {0x0f9e3, 1577, 1}, {0x0f9e4, 1578, 1},
+    {0x0f9e5, 1579, 1}, {0x0f9e6, 1580, 1}, {0x0f9e7, 1581, 1}, {0x0f9e8, 1582, 1},
+    {0x0f9e9, 1583, 1}, {0x0f9ea, 1584, 1}, {0x0f9eb, 1585, 1}, {0x0f9ec, 1586, 1},
+    {0x0f9ed, 1587, 1}, {0x0f9ee, 1588, 1}, {0x0f9ef, 1589, 1}, {0x0f9f0, 1590, 1},
+    {0x0f9f1, 1591, 1}, {0x0f9f2, 1592, 1}, {0x0f9f3, 1593, 1}, {0x0f9f4, 1594, 1},
+    {0x0f9f5, 1595, 1}, {0x0f9f6, 1596, 1}, {0x0f9f7, 1597, 1}, {0x0f9f8, 1598, 1},
+    {0x0f9f9, 1599, 1}, {0x0f9fa, 1600, 1}, {0x0f9fb, 1601, 1}, {0x0f9fc, 1602, 1},
+    {0x0f9fd, 1603, 1}, {0x0f9fe, 1604, 1}, {0x0f9ff, 1605, 1}, {0x0fa00, 1606, 1},
+    {0x0fa01, 1607, 1}, {0x0fa02, 1608, 1}, {0x0fa03, 1609, 1}, {0x0fa04, 1610, 1},
+    {0x0fa05, 1611, 1}, {0x0fa06, 1612, 1}, {0x0fa07, 1613, 1}, {0x0fa08, 1614, 1},
+    {0x0fa09, 1615, 1}, {0x0fa0a, 1616, 1}, {0x0fa0b, 1617, 1}, {0x0fa0c, 1618, 1},
+    {0x0fa0d, 1619, 1}, {0x0fa10, 1620, 1}, {0x0fa12, 1621, 1}, {0x0fa15, 1622, 1},
+    {0x0fa16, 1623, 1}, {0x0fa17, 1624, 1}, {0x0fa18, 1625, 1}, {0x0fa19, 1626, 1},
+    {0x0fa1a, 1627, 1}, {0x0fa1b, 1628, 1}, {0x0fa1c, 1629, 1}, {0x0fa1d, 1630, 1},
+    {0x0fa1e, 1631, 1}, {0x0fa20, 1632, 1}, {0x0fa22, 1633, 1}, {0x0fa25, 1634, 1},
+    {0x0fa26, 1635, 1}, {0x0fa2a, 1636, 1}, {0x0fa2b, 1637, 1}, {0x0fa2c, 1638, 1},
+    {0x0fa2d, 1639, 1}, {0x0fa2e, 1640, 1}, {0x0fa2f, 1641, 1}, {0x0fa30, 1642, 1},
+    {0x0fa31, 1643, 1}, {0x0fa32, 1644, 1}, {0x0fa33, 1645, 1}, {0x0fa34, 1646, 1},
+    {0x0fa35, 1647, 1}, {0x0fa36, 1648, 1}, {0x0fa37, 1649, 1}, {0x0fa38, 1650, 1},
+    {0x0fa39, 1651, 1}, {0x0fa3a, 1652, 1}, {0x0fa3b, 1653, 1}, {0x0fa3c, 1654, 1},
+    {0x0fa3d, 1655, 1}, {0x0fa3e, 1656, 1}, {0x0fa3f, 1657, 1}, {0x0fa40, 1658, 1},
+    {0x0fa41, 1659, 1}, {0x0fa42, 1660, 1}, {0x0fa43, 1661, 1}, {0x0fa44, 1662, 1},
+    {0x0fa45, 1663, 1}, {0x0fa46, 1664, 1}, {0x0fa47, 1665, 1}, {0x0fa48, 1666, 1},
+    {0x0fa49, 1667, 1}, {0x0fa4a, 1668, 1}, {0x0fa4b, 1669, 1}, {0x0fa4c, 1670, 1},
+    {0x0fa4d, 1671, 1}, {0x0fa4e, 1672, 1}, {0x0fa4f, 1673, 1}, {0x0fa50, 1674, 1},
+    {0x0fa51, 1675, 1}, {0x0fa52, 1676, 1}, {0x0fa53, 1677, 1}, {0x0fa54, 1678, 1},
+    {0x0fa55, 1679, 1}, {0x0fa56, 1680, 1}, {0x0fa57, 1681, 1}, {0x0fa58, 1682, 1},
+    {0x0fa59, 1683, 1}, {0x0fa5a, 1684, 1}, {0x0fa5b, 1685, 1}, {0x0fa5c, 1686, 1},
+    {0x0fa5d, 1687, 1}, {0x0fa5e, 1688, 1}, {0x0fa5f, 1689, 1}, {0x0fa60, 1690, 1},
+    {0x0fa61, 1691, 1}, {0x0fa62, 1692, 1}, {0x0fa63, 1693, 1}, {0x0fa64, 1694, 1},
+    {0x0fa65, 1695, 1}, {0x0fa66, 1696, 1}, {0x0fa67, 1697, 1}, {0x0fa68, 1698, 1},
+    {0x0fa69, 1699, 1}, {0x0fa6a, 1700, 1}, {0x0fa6b, 1701, 1}, {0x0fa6c, 1702, 2},
+    {0x0fa6d, 1704, 1}, {0x0fa70, 1705, 1}, {0x0fa71, 1706, 1}, {0x0fa72, 1707, 1},
+    {0x0fa73, 1708, 1}, {0x0fa74, 1709, 1}, {0x0fa75, 1710, 1}, {0x0fa76, 1711, 1},
+    {0x0fa77, 1712, 1}, {0x0fa78, 1713, 1}, {0x0fa79, 1714, 1}, {0x0fa7a, 1715, 1},
+    {0x0fa7b, 1716, 1}, {0x0fa7c, 1717, 1}, {0x0fa7d, 1718, 1}, {0x0fa7e, 1719, 1},
+    {0x0fa7f, 1720, 1}, {0x0fa80, 1721, 1}, {0x0fa81, 1722, 1}, {0x0fa82, 1723, 1},
+    {0x0fa83, 1724, 1}, {0x0fa84, 1725, 1}, {0x0fa85, 1726, 1}, {0x0fa86, 1727, 1},
+    {0x0fa87, 1728, 1}, {0x0fa88, 1729, 1}, {0x0fa89, 1730, 1}, {0x0fa8a, 1731, 1},
+    {0x0fa8b, 1732, 1}, {0x0fa8c, 1733, 1}, {0x0fa8d, 1734, 1}, {0x0fa8e, 1735, 1},
+    {0x0fa8f, 1736, 1}, {0x0fa90, 1737, 1}, {0x0fa91, 1738, 1}, {0x0fa92, 1739, 1},
+    {0x0fa93, 1740, 1}, {0x0fa94, 1741, 1}, {0x0fa95, 1742, 1}, {0x0fa96, 1743, 1},
+    {0x0fa97, 1744, 1}, {0x0fa98, 1745, 1}, {0x0fa99, 1746, 1}, {0x0fa9a, 1747, 1},
+    {0x0fa9b, 1748, 1}, {0x0fa9c, 1749, 1}, {0x0fa9d, 1750, 1}, {0x0fa9e, 1751, 1},
+    {0x0fa9f, 1752, 1}, {0x0faa0, 1753, 1}, {0x0faa1, 1754, 1}, {0x0faa2, 1755, 1},
+    {0x0faa3, 1756, 1}, {0x0faa4, 1757, 1}, {0x0faa5, 1758, 1}, {0x0faa6, 1759, 1},
+    {0x0faa7, 1760, 1}, {0x0faa8, 1761, 1}, {0x0faa9, 1762, 1}, {0x0faaa, 1763, 1},
+    {0x0faab, 1764, 1}, {0x0faac, 1765, 1}, {0x0faad, 1766, 1}, {0x0faae, 1767, 1},
+    {0x0faaf, 1768, 1}, {0x0fab0, 1769, 1}, {0x0fab1, 1770, 1}, {0x0fab2, 1771, 1},
+    {0x0fab3, 1772, 1}, {0x0fab4, 1773, 1}, {0x0fab5, 1774, 1}, {0x0fab6, 1775, 1},
+    {0x0fab7, 1776, 1}, {0x0fab8, 1777, 1}, {0x0fab9, 1778, 1}, {0x0faba, 1779, 1},
+    {0x0fabb, 1780, 1}, {0x0fabc, 1781, 1}, {0x0fabd, 1782, 1}, {0x0fabe, 1783, 1},
+    {0x0fabf, 1784, 1}, {0x0fac0, 1785, 1}, {0x0fac1, 1786, 1}, {0x0fac2, 1787, 1},
+    {0x0fac3, 1788, 1}, {0x0fac4, 1789, 1}, {0x0fac5, 1790, 1}, {0x0fac6, 1791, 1},
+    {0x0fac7, 1792, 1}, {0x0fac8, 1793, 1}, {0x0fac9, 1794, 1}, {0x0faca, 1795, 1},
+    {0x0facb, 1796, 1}, {0x0facc, 1797, 1}, {0x0facd, 1798, 1}, {0x0face, 1799, 1},
+    {0x0facf, 1800, 2}, {0x0fad0, 1802, 2}, {0x0fad1, 1804, 2}, {0x0fad2, 1806, 1},
+    {0x0fad3, 1807, 1}, {0x0fad4, 1808, 1}, {0x0fad5, 1809, 2}, {0x0fad6, 1811, 2},
+    {0x0fad7, 1813, 2}, {0x0fad8, 1815, 1}, {0x0fad9, 1816, 1}, {0x0fb00, 1817, 2},
+    {0x0fb01, 1819, 2}, {0x0fb02, 1821, 2}, {0x0fb03, 1823, 3}, {0x0fb04, 1826, 3},
+    {0x0fb05, 1829, 2}, {0x0fb06, 1831, 2}, {0x0fb13, 1833, 2}, {0x0fb14, 1835, 2},
+    {0x0fb15, 1837, 2}, {0x0fb16, 1839, 2}, {0x0fb17, 1841, 2}, {0x0fb1d, 1843, 2},
+    {0x0fb1f, 1845, 2}, {0x0fb20, 1847, 1}, {0x0fb21, 1848, 1}, {0x0fb22, 1849, 1},
+    {0x0fb23, 1850, 1}, {0x0fb24, 1851, 1}, {0x0fb25, 1852, 1}, {0x0fb26, 1853, 1},
+    {0x0fb27, 1854, 1}, {0x0fb28, 1855, 1}, {0x0fb2a, 1856, 2}, {0x0fb2b, 1858, 2},
+    {0x0fb2c, 1860, 3}, {0x0fb2d, 1863, 3}, {0x0fb2e, 1866, 2}, {0x0fb2f, 1868, 2},
+    {0x0fb30, 1870, 2}, {0x0fb31, 1872, 2}, {0x0fb32, 1874, 2}, {0x0fb33, 1876, 2},
+    {0x0fb34, 1878, 2}, {0x0fb35, 1880, 2}, {0x0fb36, 1882, 2}, {0x0fb38, 1884, 2},
+    {0x0fb39, 1886, 2}, {0x0fb3a, 1888, 2}, {0x0fb3b, 1890, 2}, {0x0fb3c, 1892, 2},
+    {0x0fb3e, 1894, 2}, {0x0fb40, 1896, 2}, {0x0fb41, 1898, 2}, {0x0fb43, 1900, 2},
+    {0x0fb44, 1902, 2}, {0x0fb46, 1904, 2}, {0x0fb47, 1906, 2}, {0x0fb48, 1908, 2},
+    {0x0fb49, 1910, 2}, {0x0fb4a, 1912, 2}, {0x0fb4b, 1914, 2}, {0x0fb4c, 1916, 2},
+    {0x0fb4d, 1918, 2}, {0x0fb4e, 1920, 2}, {0x0fb4f, 1922, 2}, {0x0fb50, 1924, 1},
+    {0x0fb51, 1925, 1}, {0x0fb52, 1926, 1}, {0x0fb53, 1927, 1}, {0x0fb54, 1928, 1},
+    {0x0fb55, 1929, 1}, {0x0fb56, 1930, 1}, {0x0fb57, 1931, 1}, {0x0fb58, 1932, 1},
+    {0x0fb59, 1933, 1}, {0x0fb5a, 1934, 1}, {0x0fb5b, 1935, 1}, {0x0fb5c, 1936, 1},
+    {0x0fb5d, 1937, 1}, {0x0fb5e, 1938, 1}, {0x0fb5f, 1939, 1}, {0x0fb60, 1940, 1},
+    {0x0fb61, 1941, 1}, {0x0fb62, 1942, 1}, {0x0fb63, 1943, 1}, {0x0fb64, 1944, 1},
+    {0x0fb65, 1945, 1}, {0x0fb66, 1946, 1}, {0x0fb67, 1947, 1}, {0x0fb68, 1948, 1},
+    {0x0fb69, 1949, 1}, {0x0fb6a, 1950, 1}, {0x0fb6b, 1951, 1}, {0x0fb6c, 1952, 1},
+    {0x0fb6d, 1953, 1}, {0x0fb6e, 1954, 1}, {0x0fb6f, 1955, 1}, {0x0fb70, 1956, 1},
+    {0x0fb71, 1957, 1}, {0x0fb72, 1958, 1}, {0x0fb73, 1959, 1}, {0x0fb74, 1960, 1},
+    {0x0fb75, 1961, 1}, {0x0fb76, 1962, 1}, {0x0fb77, 1963, 1}, {0x0fb78, 1964, 1},
+    {0x0fb79, 1965, 1}, {0x0fb7a, 1966, 1}, {0x0fb7b, 1967, 1}, {0x0fb7c, 1968, 1},
+    {0x0fb7d, 1969, 1}, {0x0fb7e, 1970, 1}, {0x0fb7f, 1971, 1}, {0x0fb80, 1972, 1},
+    {0x0fb81, 1973, 1}, {0x0fb82, 1974, 1}, {0x0fb83, 1975, 1}, {0x0fb84, 1976, 1},
+    {0x0fb85, 1977, 1}, {0x0fb86, 1978, 1}, {0x0fb87, 1979, 1}, {0x0fb88, 1980, 1},
+    {0x0fb89, 1981, 1}, {0x0fb8a, 1982, 1}, {0x0fb8b, 1983, 1}, {0x0fb8c, 1984, 1},
+    {0x0fb8d, 1985, 1}, {0x0fb8e, 1986, 1}, {0x0fb8f, 1987, 1}, {0x0fb90, 1988, 1},
+    {0x0fb91, 1989, 1}, {0x0fb92, 1990, 1}, {0x0fb93, 1991, 1}, {0x0fb94, 1992, 1},
+    {0x0fb95, 1993, 1}, {0x0fb96, 1994, 1}, {0x0fb97, 1995, 1}, {0x0fb98, 1996, 1},
+    {0x0fb99, 1997, 1}, {0x0fb9a, 1998, 1}, {0x0fb9b, 1999, 1}, {0x0fb9c, 2000, 1},
+    {0x0fb9d, 2001, 1}, {0x0fb9e, 2002, 1}, {0x0fb9f, 2003, 1}, {0x0fba0, 2004, 1},
+    {0x0fba1, 2005, 1}, {0x0fba2, 2006, 1}, {0x0fba3, 2007, 1}, {0x0fba4, 2008, 2},
+    {0x0fba5, 2010, 2}, {0x0fba6, 2012, 1}, {0x0fba7, 2013, 1}, {0x0fba8, 2014, 1},
+    {0x0fba9, 2015, 1}, {0x0fbaa, 2016, 1}, {0x0fbab, 2017, 1}, {0x0fbac, 2018, 1},
+    {0x0fbad, 2019, 1}, {0x0fbae, 2020, 1}, {0x0fbaf, 2021, 1}, {0x0fbb0, 2022, 2},
+    {0x0fbb1, 2024, 2}, {0x0fbd3, 2026, 1}, {0x0fbd4, 2027, 1}, {0x0fbd5, 2028, 1},
+    {0x0fbd6, 2029, 1}, {0x0fbd7, 2030, 1}, {0x0fbd8, 2031, 1}, {0x0fbd9, 2032, 1},
+    {0x0fbda, 2033, 1}, {0x0fbdb, 2034, 1}, {0x0fbdc, 2035, 1}, {0x0fbdd, 2036, 2},
+    {0x0fbde, 2038, 1}, {0x0fbdf, 2039, 1}, {0x0fbe0, 2040, 1}, {0x0fbe1, 2041, 1},
+    {0x0fbe2, 2042, 1}, {0x0fbe3, 2043, 1}, {0x0fbe4, 2044, 1}, {0x0fbe5, 2045, 1},
+    {0x0fbe6, 2046, 1}, {0x0fbe7, 2047, 1}, {0x0fbe8, 2048, 1}, {0x0fbe9, 2049, 1},
+    {0x0fbea, 2050, 3}, {0x0fbeb, 2053, 3}, {0x0fbec, 2056, 3}, {0x0fbed, 2059, 3},
+    {0x0fbee, 2062, 3}, {0x0fbef, 2065, 3}, {0x0fbf0, 2068, 3}, {0x0fbf1, 2071, 3},
+    {0x0fbf2, 2074, 3}, {0x0fbf3, 2077, 3}, {0x0fbf4, 2080, 3}, {0x0fbf5, 2083, 3},
+    {0x0fbf6, 2086, 3}, {0x0fbf7, 2089, 3}, {0x0fbf8, 2092, 3}, {0x0fbf9, 2095, 3},
+    {0x0fbfa, 2098, 3}, {0x0fbfb, 2101, 3}, {0x0fbfc, 2104, 1}, {0x0fbfd, 2105, 1},
+    {0x0fbfe, 2106, 1}, {0x0fbff, 2107, 1}, {0x0fc00, 2108, 3}, {0x0fc01, 2111, 3},
+    {0x0fc02, 2114, 3}, {0x0fc03, 2117, 3}, {0x0fc04, 2120, 3}, {0x0fc05, 2123, 2},
+    {0x0fc06, 2125, 2}, {0x0fc07, 2127, 2}, {0x0fc08, 2129, 2}, {0x0fc09, 2131, 2},
+    {0x0fc0a, 2133, 2}, {0x0fc0b, 2135, 2}, {0x0fc0c, 2137, 2}, {0x0fc0d, 2139, 2},
+    {0x0fc0e, 2141, 2}, {0x0fc0f, 2143, 2}, {0x0fc10, 2145, 2}, {0x0fc11, 2147, 2},
+    {0x0fc12, 2149, 2}, {0x0fc13, 2151, 2}, {0x0fc14, 2153, 2}, {0x0fc15, 2155, 2},
+    {0x0fc16, 2157, 2}, {0x0fc17, 2159, 2}, {0x0fc18, 2161, 2}, {0x0fc19, 2163, 2},
+    {0x0fc1a, 2165, 2}, {0x0fc1b, 2167, 2}, {0x0fc1c, 2169, 2}, {0x0fc1d, 2171, 2},
+    {0x0fc1e, 2173, 2}, {0x0fc1f, 2175, 2}, {0x0fc20, 2177, 2}, {0x0fc21, 2179, 2},
+    {0x0fc22, 2181, 2}, {0x0fc23, 2183, 2}, {0x0fc24, 2185, 2}, {0x0fc25, 2187, 2},
+    {0x0fc26, 2189, 2}, {0x0fc27, 2191, 2}, {0x0fc28, 2193, 2}, {0x0fc29, 2195, 2},
+    {0x0fc2a, 2197, 2}, {0x0fc2b, 2199, 2}, {0x0fc2c, 2201, 2}, {0x0fc2d, 2203, 2},
+    {0x0fc2e, 2205, 2}, {0x0fc2f, 2207, 2}, {0x0fc30, 2209, 2}, {0x0fc31, 2211, 2},
+    {0x0fc32, 2213, 2}, {0x0fc33, 2215, 2}, {0x0fc34, 2217, 2}, {0x0fc35, 2219, 2},
+    {0x0fc36, 2221, 2}, {0x0fc37, 2223, 2}, {0x0fc38, 2225, 2}, {0x0fc39, 2227, 2},
+    {0x0fc3a, 2229, 2}, {0x0fc3b, 2231, 2}, {0x0fc3c, 2233, 2}, {0x0fc3d, 2235, 2},
+    {0x0fc3e, 2237, 2}, {0x0fc3f, 2239, 2}, {0x0fc40, 2241, 2}, {0x0fc41, 2243, 2},
+    {0x0fc42, 2245, 2}, {0x0fc43, 2247, 2}, {0x0fc44, 2249, 2}, {0x0fc45, 2251, 2},
+    {0x0fc46, 2253, 2}, {0x0fc47, 2255, 2}, {0x0fc48, 2257, 2}, {0x0fc49, 2259, 2},
+    {0x0fc4a, 2261, 2}, {0x0fc4b, 2263, 2}, {0x0fc4c, 2265, 2}, {0x0fc4d, 2267, 2},
+    {0x0fc4e, 2269, 2}, {0x0fc4f, 2271, 2}, {0x0fc50, 2273, 2}, {0x0fc51, 2275, 2},
+    {0x0fc52, 2277, 2}, {0x0fc53, 2279, 2}, {0x0fc54, 2281, 2}, {0x0fc55, 2283, 2},
+    {0x0fc56, 2285, 2}, {0x0fc57, 2287, 2}, {0x0fc58, 2289, 2}, {0x0fc59, 2291, 2},
+    {0x0fc5a, 2293, 2}, {0x0fc5b, 2295, 2}, {0x0fc5c, 2297, 2}, {0x0fc5d, 2299, 2},
+    {0x0fc5e, 2301, 3}, {0x0fc5f, 2304, 3}, {0x0fc60, 2307, 3}, {0x0fc61, 2310, 3},
+    {0x0fc62, 2313, 3}, {0x0fc63, 2316, 3}, {0x0fc64, 2319, 3}, {0x0fc65, 2322, 3},
+    {0x0fc66, 2325, 3}, {0x0fc67, 2328, 3}, {0x0fc68, 2331, 3}, {0x0fc69, 2334, 3},
+    {0x0fc6a, 2337, 2}, {0x0fc6b, 2339, 2}, {0x0fc6c, 2341, 2}, {0x0fc6d, 2343, 2},
+    {0x0fc6e, 2345, 2}, {0x0fc6f, 2347, 2}, {0x0fc70, 2349, 2}, {0x0fc71, 2351, 2},
+    {0x0fc72, 2353, 2}, {0x0fc73, 2355, 2}, {0x0fc74, 2357, 2}, {0x0fc75, 2359, 2},
+    {0x0fc76, 2361, 2}, {0x0fc77, 2363, 2}, {0x0fc78, 2365, 2}, {0x0fc79, 2367, 2},
+    {0x0fc7a, 2369, 2}, {0x0fc7b, 2371, 2}, {0x0fc7c, 2373, 2}, {0x0fc7d, 2375, 2},
+    {0x0fc7e, 2377, 2}, {0x0fc7f, 2379, 2}, {0x0fc80, 2381, 2}, {0x0fc81, 2383, 2},
+    {0x0fc82, 2385, 2}, {0x0fc83, 2387, 2}, {0x0fc84, 2389, 2}, {0x0fc85, 2391, 2},
+    {0x0fc86, 2393, 2}, {0x0fc87, 2395, 2}, {0x0fc88, 2397, 2}, {0x0fc89, 2399, 2},
+    {0x0fc8a, 2401, 2}, {0x0fc8b, 2403, 2}, {0x0fc8c, 2405, 2}, {0x0fc8d, 2407, 2},
+    {0x0fc8e, 2409, 2}, {0x0fc8f, 2411, 2}, {0x0fc90, 2413, 2}, {0x0fc91, 2415, 2},
+    {0x0fc92, 2417, 2}, {0x0fc93, 2419, 2}, {0x0fc94, 2421, 2}, {0x0fc95, 2423, 2},
+    {0x0fc96, 2425, 2}, {0x0fc97, 2427, 3}, {0x0fc98, 2430, 3}, {0x0fc99, 2433, 3},
+    {0x0fc9a, 2436, 3}, {0x0fc9b, 2439, 3}, {0x0fc9c, 2442, 2}, {0x0fc9d, 2444, 2},
+    {0x0fc9e, 2446, 2}, {0x0fc9f, 2448, 2}, {0x0fca0, 2450, 2}, {0x0fca1, 2452, 2},
+    {0x0fca2, 2454, 2}, {0x0fca3, 2456, 2}, {0x0fca4, 2458, 2}, {0x0fca5, 2460, 2},
+    {0x0fca6, 2462, 2}, {0x0fca7, 2464, 2}, {0x0fca8, 2466, 2}, {0x0fca9, 2468, 2},
+    {0x0fcaa, 2470, 2}, {0x0fcab, 2472, 2}, {0x0fcac, 2474, 2}, {0x0fcad, 2476, 2},
+    {0x0fcae, 2478, 2}, {0x0fcaf, 2480, 2}, {0x0fcb0, 2482, 2}, {0x0fcb1, 2484, 2},
+    {0x0fcb2, 2486, 2}, {0x0fcb3, 2488, 2}, {0x0fcb4, 2490, 2}, {0x0fcb5, 2492, 2},
+    {0x0fcb6, 2494, 2}, {0x0fcb7, 2496, 2}, {0x0fcb8, 2498, 2}, {0x0fcb9, 2500, 2},
+    {0x0fcba, 2502, 2}, {0x0fcbb, 2504, 2}, {0x0fcbc, 2506, 2}, {0x0fcbd, 2508, 2},
+    {0x0fcbe, 2510, 2}, {0x0fcbf, 2512, 2}, {0x0fcc0, 2514, 2}, {0x0fcc1, 2516, 2},
+    {0x0fcc2, 2518, 2}, {0x0fcc3, 2520, 2}, {0x0fcc4, 2522, 2}, {0x0fcc5, 2524, 2},
+    {0x0fcc6, 2526, 2}, {0x0fcc7, 2528, 2}, {0x0fcc8, 2530, 2}, {0x0fcc9, 2532, 2},
+    {0x0fcca, 2534, 2}, {0x0fccb, 2536, 2}, {0x0fccc, 2538, 2}, {0x0fccd, 2540, 2},
+    {0x0fcce, 2542, 2}, {0x0fccf, 2544, 2}, {0x0fcd0, 2546, 2}, {0x0fcd1, 2548, 2},
+    {0x0fcd2, 2550, 2}, {0x0fcd3, 2552, 2}, {0x0fcd4, 2554, 2}, {0x0fcd5, 2556, 2},
+    {0x0fcd6, 2558, 2}, {0x0fcd7, 2560, 2}, {0x0fcd8, 2562, 2}, {0x0fcd9, 2564, 2},
+    {0x0fcda, 2566, 2}, {0x0fcdb, 2568, 2}, {0x0fcdc, 2570, 2}, {0x0fcdd, 2572, 2},
+    {0x0fcde, 2574, 2}, {0x0fcdf, 2576, 3}, {0x0fce0, 2579, 3}, {0x0fce1, 2582, 2},
+    {0x0fce2, 2584, 2}, {0x0fce3, 2586, 2}, {0x0fce4, 2588, 2}, {0x0fce5, 2590, 2},
+    {0x0fce6, 2592, 2}, {0x0fce7, 2594, 2}, {0x0fce8, 2596, 2}, {0x0fce9, 2598, 2},
+    {0x0fcea, 2600, 2}, {0x0fceb, 2602, 2}, {0x0fcec, 2604, 2}, {0x0fced, 2606, 2},
+    {0x0fcee, 2608, 2}, {0x0fcef, 2610, 2}, {0x0fcf0, 2612, 2}, {0x0fcf1, 2614, 2},
+    {0x0fcf2, 2616, 3}, {0x0fcf3, 2619, 3}, {0x0fcf4, 2622, 3}, {0x0fcf5, 2625, 2},
+    {0x0fcf6, 2627, 2}, {0x0fcf7, 2629, 2}, {0x0fcf8, 2631, 2}, {0x0fcf9, 2633, 2},
+    {0x0fcfa, 2635, 2}, {0x0fcfb, 2637, 2}, {0x0fcfc, 2639, 2}, {0x0fcfd, 2641, 2},
+    {0x0fcfe, 2643, 2}, {0x0fcff, 2645, 2}, {0x0fd00, 2647, 2}, {0x0fd01, 2649, 2},
+    {0x0fd02, 2651, 2}, {0x0fd03, 2653, 2}, {0x0fd04, 2655, 2}, {0x0fd05, 2657, 2},
+    {0x0fd06, 2659, 2}, {0x0fd07, 2661, 2}, {0x0fd08, 2663, 2}, {0x0fd09, 2665, 2},
+    {0x0fd0a, 2667, 2}, {0x0fd0b, 2669, 2}, {0x0fd0c, 2671, 2}, {0x0fd0d, 2673, 2},
+    {0x0fd0e, 2675, 2}, {0x0fd0f, 2677, 2}, {0x0fd10, 2679, 2}, {0x0fd11, 2681, 2},
+    {0x0fd12, 2683, 2}, {0x0fd13, 2685, 2}, {0x0fd14, 2687, 2}, {0x0fd15, 2689, 2},
+    {0x0fd16, 2691, 2}, {0x0fd17, 2693, 2}, {0x0fd18, 2695, 2}, {0x0fd19, 2697, 2},
+    {0x0fd1a, 2699, 2}, {0x0fd1b, 2701, 2}, {0x0fd1c, 2703, 2}, {0x0fd1d, 2705, 2},
+    {0x0fd1e, 2707, 2}, {0x0fd1f, 2709, 2}, {0x0fd20, 2711, 2}, {0x0fd21, 2713, 2},
+    {0x0fd22, 2715, 2}, {0x0fd23, 2717, 2}, {0x0fd24, 2719, 2}, {0x0fd25, 2721, 2},
+    {0x0fd26, 2723, 2}, {0x0fd27, 2725, 2}, {0x0fd28, 2727, 2}, {0x0fd29, 2729, 2},
+    {0x0fd2a, 2731, 2}, {0x0fd2b, 2733, 2}, {0x0fd2c, 2735, 2}, {0x0fd2d, 2737, 2},
+    {0x0fd2e, 2739, 2}, {0x0fd2f, 2741, 2}, {0x0fd30, 2743, 2}, {0x0fd31, 2745, 2},
+    {0x0fd32, 2747, 2}, {0x0fd33, 2749, 2}, {0x0fd34, 2751, 2}, {0x0fd35, 2753, 2},
+    {0x0fd36, 2755, 2}, {0x0fd37, 2757, 2}, {0x0fd38, 2759, 2}, {0x0fd39, 2761, 2},
+    {0x0fd3a, 2763, 2}, {0x0fd3b, 2765, 2}, {0x0fd3c, 2767, 2}, {0x0fd3d, 2769, 2},
+    {0x0fd50, 2771, 3}, {0x0fd51, 2774, 3}, {0x0fd52, 2777, 3}, {0x0fd53, 2780, 3},
+    {0x0fd54, 2783, 3}, {0x0fd55, 2786, 3}, {0x0fd56, 2789, 3}, {0x0fd57, 2792, 3},
+    {0x0fd58, 2795, 3}, {0x0fd59, 2798, 3}, {0x0fd5a, 2801, 3}, {0x0fd5b, 2804, 3},
+    {0x0fd5c, 2807, 3}, {0x0fd5d, 2810, 3}, {0x0fd5e, 2813, 3}, {0x0fd5f, 2816, 3},
+    {0x0fd60, 2819, 3}, {0x0fd61, 2822, 3}, {0x0fd62, 2825, 3}, {0x0fd63, 2828, 3},
+    {0x0fd64, 2831, 3}, {0x0fd65, 2834, 3}, {0x0fd66, 2837, 3}, {0x0fd67, 2840, 3},
+    {0x0fd68, 2843, 3}, {0x0fd69, 2846, 3}, {0x0fd6a, 2849, 3}, {0x0fd6b, 2852, 3},
+    {0x0fd6c, 2855, 3}, {0x0fd6d, 2858, 3}, {0x0fd6e, 2861, 3}, {0x0fd6f, 2864, 3},
+    {0x0fd70, 2867, 3}, {0x0fd71, 2870, 3}, {0x0fd72, 2873, 3}, {0x0fd73, 2876, 3},
+    {0x0fd74, 2879, 3}, {0x0fd75, 2882, 3}, {0x0fd76, 2885, 3}, {0x0fd77, 2888, 3},
+    {0x0fd78, 2891, 3}, {0x0fd79, 2894, 3}, {0x0fd7a, 2897, 3}, {0x0fd7b, 2900, 3},
+    {0x0fd7c, 2903, 3}, {0x0fd7d, 2906, 3}, {0x0fd7e, 2909, 3}, {0x0fd7f, 2912, 3},
+    {0x0fd80, 2915, 3}, {0x0fd81, 2918, 3}, {0x0fd82, 2921, 3}, {0x0fd83, 2924, 3},
+    {0x0fd84, 2927, 3}, {0x0fd85, 2930, 3}, {0x0fd86, 2933, 3}, {0x0fd87, 2936, 3},
+    {0x0fd88, 2939, 3}, {0x0fd89, 2942, 3}, {0x0fd8a, 2945, 3}, {0x0fd8b, 2948, 3},
+    {0x0fd8c, 2951, 3}, {0x0fd8d, 2954, 3}, {0x0fd8e, 2957, 3}, {0x0fd8f, 2960, 3},
+    {0x0fd92, 2963, 3}, {0x0fd93, 2966, 3}, {0x0fd94, 2969, 3}, {0x0fd95, 2972, 3},
+    {0x0fd96, 2975, 3}, {0x0fd97, 2978, 3}, {0x0fd98, 2981, 3}, {0x0fd99, 2984, 3},
+    {0x0fd9a, 2987, 3}, {0x0fd9b, 2990, 3}, {0x0fd9c, 2993, 3}, {0x0fd9d, 2996, 3},
+    {0x0fd9e, 2999, 3}, {0x0fd9f, 3002, 3}, {0x0fda0, 3005, 3}, {0x0fda1, 3008, 3},
+    {0x0fda2, 3011, 3}, {0x0fda3, 3014, 3}, {0x0fda4, 3017, 3}, {0x0fda5, 3020, 3},
+    {0x0fda6, 3023, 3}, {0x0fda7, 3026, 3}, {0x0fda8, 3029, 3}, {0x0fda9, 3032, 3},
+    {0x0fdaa, 3035, 3}, {0x0fdab, 3038, 3}, {0x0fdac, 3041, 3}, {0x0fdad, 3044, 3},
+    {0x0fdae, 3047, 3}, {0x0fdaf, 3050, 3}, {0x0fdb0, 3053, 3}, {0x0fdb1, 3056, 3},
+    {0x0fdb2, 3059, 3}, {0x0fdb3, 3062, 3}, {0x0fdb4, 3065, 3}, {0x0fdb5, 3068, 3},
+    {0x0fdb6, 3071, 3}, {0x0fdb7, 3074, 3}, {0x0fdb8, 3077, 3}, {0x0fdb9, 3080, 3},
+    {0x0fdba, 3083, 3}, {0x0fdbb, 3086, 3}, {0x0fdbc, 3089, 3}, {0x0fdbd, 3092, 3},
+    {0x0fdbe, 3095, 3}, {0x0fdbf, 3098, 3}, {0x0fdc0, 3101, 3}, {0x0fdc1, 3104, 3},
+    {0x0fdc2, 3107, 3}, {0x0fdc3, 3110, 3}, {0x0fdc4, 3113, 3}, {0x0fdc5, 3116, 3},
+    {0x0fdc6, 3119, 3}, {0x0fdc7, 3122, 3}, {0x0fdf0, 3125, 3}, {0x0fdf1, 3128, 3},
+    {0x0fdf2, 3131, 4}, {0x0fdf3, 3135, 4}, {0x0fdf4, 3139, 4}, {0x0fdf5, 3143, 4},
+    {0x0fdf6, 3147, 4}, {0x0fdf7, 3151, 4}, {0x0fdf8, 3155, 4}, {0x0fdf9, 3159, 3},
+    {0x0fdfa, 3162, 18}, {0x0fdfb, 3180, 8}, {0x0fe70, 3188, 2}, {0x0fe71, 3190, 2},
+    {0x0fe72, 3192, 2}, {0x0fe74, 3194, 2}, {0x0fe76, 3196, 2}, {0x0fe77, 3198, 2},
+    {0x0fe78, 3200, 2}, {0x0fe79, 3202, 2}, {0x0fe7a, 3204, 2}, {0x0fe7b, 3206, 2},
+    {0x0fe7c, 3208, 2}, {0x0fe7d, 3210, 2}, {0x0fe7e, 3212, 2}, {0x0fe7f, 3214, 2},
+    {0x0fe80, 3216, 1}, {0x0fe81, 3217, 2}, {0x0fe82, 3219, 2}, {0x0fe83, 3221, 2},
+    {0x0fe84, 3223, 2}, {0x0fe85, 3225, 2}, {0x0fe86, 3227, 2}, {0x0fe87, 3229, 2},
+    {0x0fe88, 3231, 2}, {0x0fe89, 3233, 2}, {0x0fe8a, 3235, 2}, {0x0fe8b, 3237, 2},
+    {0x0fe8c, 3239, 2}, {0x0fe8d, 3241, 1}, {0x0fe8e, 3242, 1}, {0x0fe8f, 3243, 1},
+    {0x0fe90, 3244, 1}, {0x0fe91, 3245, 1}, {0x0fe92, 3246, 1}, {0x0fe93, 3247, 1},
+    {0x0fe94, 3248, 1}, {0x0fe95, 3249, 1}, {0x0fe96, 3250, 1}, {0x0fe97, 3251, 1},
+    {0x0fe98, 3252, 1}, {0x0fe99, 3253, 1}, {0x0fe9a, 3254, 1}, {0x0fe9b, 3255, 1},
+    {0x0fe9c, 3256, 1}, {0x0fe9d, 3257, 1}, {0x0fe9e, 3258, 1}, {0x0fe9f, 3259, 1},
+    {0x0fea0, 3260, 1}, {0x0fea1, 3261, 1}, {0x0fea2, 3262, 1}, {0x0fea3, 3263, 1},
+    {0x0fea4, 3264, 1}, {0x0fea5, 3265, 1}, {0x0fea6, 3266, 1}, {0x0fea7, 3267, 1},
+    {0x0fea8, 3268, 1}, {0x0fea9, 3269, 1}, {0x0feaa, 3270, 1}, {0x0feab, 3271, 1},
+    {0x0feac, 3272, 1}, {0x0fead, 3273, 1}, {0x0feae, 3274, 1}, {0x0feaf, 3275, 1},
+    {0x0feb0, 3276, 1}, {0x0feb1, 3277, 1}, {0x0feb2, 3278, 1}, {0x0feb3, 3279, 1},
+    {0x0feb4, 3280, 1}, {0x0feb5, 3281, 1}, {0x0feb6, 3282, 1}, {0x0feb7, 3283, 1},
+    {0x0feb8, 3284, 1}, {0x0feb9, 3285, 1}, {0x0feba, 3286, 1}, {0x0febb, 3287, 1},
+    {0x0febc, 3288, 1}, {0x0febd, 3289, 1}, {0x0febe, 3290, 1}, {0x0febf, 3291, 1},
+    {0x0fec0, 3292, 1}, {0x0fec1, 3293, 1}, {0x0fec2, 3294, 1}, {0x0fec3, 3295, 1},
+    {0x0fec4, 3296, 1}, {0x0fec5, 3297, 1}, {0x0fec6, 3298, 1}, {0x0fec7, 3299, 1},
+    {0x0fec8, 3300, 1}, {0x0fec9, 3301, 1}, {0x0feca, 3302, 1}, {0x0fecb, 3303, 1},
+    {0x0fecc, 3304, 1}, {0x0fecd, 3305, 1}, {0x0fece, 3306, 1}, {0x0fecf, 3307, 1},
+    {0x0fed0, 3308, 1}, {0x0fed1, 3309, 1}, {0x0fed2, 3310, 1}, {0x0fed3, 3311, 1},
+    {0x0fed4, 3312, 1}, {0x0fed5, 3313, 1}, {0x0fed6, 3314, 1}, {0x0fed7, 3315, 1},
+    {0x0fed8, 3316, 1}, {0x0fed9, 3317, 1}, {0x0feda, 3318, 1}, {0x0fedb, 3319, 1},
+    {0x0fedc, 3320, 1}, {0x0fedd, 3321, 1}, {0x0fede, 3322, 1}, {0x0fedf, 3323, 1},
+    {0x0fee0, 3324, 1}, {0x0fee1, 3325, 1}, {0x0fee2, 3326, 1}, {0x0fee3, 3327, 1},
+    {0x0fee4, 3328, 1}, {0x0fee5, 3329, 1}, {0x0fee6, 3330, 1}, {0x0fee7, 3331, 1},
+    {0x0fee8, 3332, 1}, {0x0fee9, 3333, 1}, {0x0feea, 3334, 1}, {0x0feeb, 3335, 1},
+    {0x0feec, 3336, 1}, {0x0feed, 3337, 1}, {0x0feee, 3338, 1}, {0x0feef, 3339, 1},
+    {0x0fef0, 3340, 1}, {0x0fef1, 3341, 1}, {0x0fef2, 3342, 1}, {0x0fef3, 3343, 1},
+    {0x0fef4, 3344, 1}, {0x0fef5, 3345, 3}, {0x0fef6, 3348, 3}, {0x0fef7, 3351, 3},
+    {0x0fef8, 3354, 3}, {0x0fef9, 3357, 3}, {0x0fefa, 3360, 3}, {0x0fefb, 3363, 2},
+    {0x0fefc, 3365, 2}, {0x0ff21, 3367, 1}, {0x0ff22, 3368, 1}, {0x0ff23, 3369, 1},
+    {0x0ff24, 3370, 1}, {0x0ff25, 3371, 1}, {0x0ff26, 3372, 1}, {0x0ff27, 3373, 1},
+    {0x0ff28, 3374, 1}, {0x0ff29, 3375, 1}, {0x0ff2a, 3376, 1}, {0x0ff2b, 3377, 1},
+    {0x0ff2c, 3378, 1}, {0x0ff2d, 3379, 1}, {0x0ff2e, 3380, 1}, {0x0ff2f, 3381, 1},
+    {0x0ff30, 3382, 1}, {0x0ff31, 3383, 1}, {0x0ff32, 3384, 1}, {0x0ff33, 3385, 1},
+    {0x0ff34, 3386, 1}, {0x0ff35, 3387, 1}, {0x0ff36, 3388, 1}, {0x0ff37, 3389, 1},
+    {0x0ff38, 3390, 1}, {0x0ff39, 3391, 1}, {0x0ff3a, 3392, 1}, {0x0ff41, 3393, 1},
+    {0x0ff42, 3394, 1}, {0x0ff43, 3395, 1}, {0x0ff44, 3396, 1}, {0x0ff45, 3397, 1},
+    {0x0ff46, 3398, 1}, {0x0ff47, 3399, 1}, {0x0ff48, 3400, 1}, {0x0ff49, 3401, 1},
+    {0x0ff4a, 3402, 1}, {0x0ff4b, 3403, 1}, {0x0ff4c, 3404, 1}, {0x0ff4d, 3405, 1},
+    {0x0ff4e, 3406, 1}, {0x0ff4f, 3407, 1}, {0x0ff50, 3408, 1}, {0x0ff51, 3409, 1},
+    {0x0ff52, 3410, 1}, {0x0ff53, 3411, 1}, {0x0ff54, 3412, 1}, {0x0ff55, 3413, 1},
+    {0x0ff56, 3414, 1}, {0x0ff57, 3415, 1}, {0x0ff58, 3416, 1}, {0x0ff59, 3417, 1},
+    {0x0ff5a, 3418, 1}, {0x0ff66, 3419, 1}, {0x0ff67, 3420, 1}, {0x0ff68, 3421, 1},
+    {0x0ff69, 3422, 1}, {0x0ff6a, 3423, 1}, {0x0ff6b, 3424, 1}, {0x0ff6c, 3425, 1},
+    {0x0ff6d, 3426, 1}, {0x0ff6e, 3427, 1}, {0x0ff6f, 3428, 1}, {0x0ff70, 3429, 1},
+    {0x0ff71, 3430, 1}, {0x0ff72, 3431, 1}, {0x0ff73, 3432, 1}, {0x0ff74, 3433, 1},
+    {0x0ff75, 3434, 1}, {0x0ff76, 3435, 1}, {0x0ff77, 3436, 1}, {0x0ff78, 3437, 1},
+    {0x0ff79, 3438, 1}, {0x0ff7a, 3439, 1}, {0x0ff7b, 3440, 1}, {0x0ff7c, 3441, 1},
+    {0x0ff7d, 3442, 1}, {0x0ff7e, 3443, 1}, {0x0ff7f, 3444, 1}, {0x0ff80, 3445, 1},
+    {0x0ff81, 3446, 1}, {0x0ff82, 3447, 1}, {0x0ff83, 3448, 1}, {0x0ff84, 3449, 1},
+    {0x0ff85, 3450, 1}, {0x0ff86, 3451, 1}, {0x0ff87, 3452, 1}, {0x0ff88, 3453, 1},
+    {0x0ff89, 3454, 1}, {0x0ff8a, 3455, 1}, {0x0ff8b, 3456, 1}, {0x0ff8c, 3457, 1},
+    {0x0ff8d, 3458, 1}, {0x0ff8e, 3459, 1}, {0x0ff8f, 3460, 1}, {0x0ff90, 3461, 1},
+    {0x0ff91, 3462, 1}, {0x0ff92, 3463, 1}, {0x0ff93, 3464, 1}, {0x0ff94, 3465, 1},
+    {0x0ff95, 3466, 1}, {0x0ff96, 3467, 1}, {0x0ff97, 3468, 1}, {0x0ff98, 3469, 1},
+    {0x0ff99, 3470, 1}, {0x0ff9a, 3471, 1}, {0x0ff9b, 3472, 1}, {0x0ff9c, 3473, 1},
+    {0x0ff9d, 3474, 1}, {0x0ff9e, 3475, 1}, {0x0ff9f, 3476, 1}, {0x0ffa0, 3477, 1},
+    {0x0ffa1, 3478, 1}, {0x0ffa2, 3479, 1}, {0x0ffa3, 3480, 1}, {0x0ffa4, 3481, 1},
+    {0x0ffa5, 3482, 1}, {0x0ffa6, 3483, 1}, {0x0ffa7, 3484, 1}, {0x0ffa8, 3485, 1},
+    {0x0ffa9, 3486, 1}, {0x0ffaa, 3487, 1}, {0x0ffab, 3488, 1}, {0x0ffac, 3489, 1},
+    {0x0ffad, 3490, 1}, {0x0ffae, 3491, 1}, {0x0ffaf, 3492, 1}, {0x0ffb0, 3493, 1},
+    {0x0ffb1, 3494, 1}, {0x0ffb2, 3495, 1}, {0x0ffb3, 3496, 1}, {0x0ffb4, 3497, 1},
+    {0x0ffb5, 3498, 1}, {0x0ffb6, 3499, 1}, {0x0ffb7, 3500, 1}, {0x0ffb8, 3501, 1},
+    {0x0ffb9, 3502, 1}, {0x0ffba, 3503, 1}, {0x0ffbb, 3504, 1}, {0x0ffbc, 3505, 1},
+    {0x0ffbd, 3506, 1}, {0x0ffbe, 3507, 1}, {0x0ffc2, 3508, 1}, {0x0ffc3, 3509, 1},
+    {0x0ffc4, 3510, 1}, {0x0ffc5, 3511, 1}, {0x0ffc6, 3512, 1}, {0x0ffc7, 3513, 1},
+    {0x0ffca, 3514, 1}, {0x0ffcb, 3515, 1}, {0x0ffcc, 3516, 1}, {0x0ffcd, 3517, 1},
+    {0x0ffce, 3518, 1}, {0x0ffcf, 3519, 1}, {0x0ffd2, 3520, 1}, {0x0ffd3, 3521, 1},
+    {0x0ffd4, 3522, 1}, {0x0ffd5, 3523, 1}, {0x0ffd6, 3524, 1}, {0x0ffd7, 3525, 1},
+    {0x0ffda, 3526, 1}, {0x0ffdb, 3527, 1}, {0x0ffdc, 3528, 1}, {0x10781, 3529, 1},
+    {0x10782, 3530, 1}, {0x10783, 3531, 1}, {0x10784, 3532, 1}, {0x10785, 3533, 1},
+    {0x10787, 3534, 1}, {0x10788, 3535, 1}, {0x10789, 3536, 1}, {0x1078a, 3537, 1},
+    {0x1078b, 3538, 1}, {0x1078c, 3539, 1}, {0x1078d, 3540, 1}, {0x1078e, 3541, 1},
+    {0x1078f, 3542, 1}, {0x10790, 3543, 1}, {0x10791, 3544, 1}, {0x10792, 3545, 1},
+    {0x10793, 3546, 1}, {0x10794, 3547, 1}, {0x10795, 3548, 1}, {0x10796, 3549, 1},
+    {0x10797, 3550, 1}, {0x10798, 3551, 1}, {0x10799, 3552, 1}, {0x1079a, 3553, 1},
+    {0x1079b, 3554, 1}, {0x1079c, 3555, 2}, {0x1079d, 3557, 1}, {0x1079e, 3558, 1},
+    {0x1079f, 3559, 2}, {0x107a0, 3561, 1}, {0x107a1, 3562, 2}, {0x107a2, 3564, 1},
+    {0x107a3, 3565, 1}, {0x107a4, 3566, 1}, {0x107a5, 3567, 1}, {0x107a6, 3568, 1},
+    {0x107a7, 3569, 2}, {0x107a8, 3571, 1}, {0x107a9, 3572, 1}, {0x107aa, 3573, 1},
+    {0x107ab, 3574, 1}, {0x107ac, 3575, 1}, {0x107ad, 3576, 1}, {0x107ae, 3577, 1},
+    {0x107af, 3578, 1}, {0x107b0, 3579, 1}, {0x107b2, 3580, 1}, {0x107b3, 3581, 1},
+    {0x107b4, 3582, 1}, {0x107b5, 3583, 1}, {0x107b6, 3584, 1}, {0x107b7, 3585, 1},
+    {0x107b8, 3586, 1}, {0x107b9, 3587, 2}, {0x107ba, 3589, 2}, {0x1109a, 3591, 4},
+    {0x1109c, 3595, 4}, {0x110ab, 3599, 4}, {0x1d400, 3603, 1}, {0x1d401, 3604, 1},
+    {0x1d402, 3605, 1}, {0x1d403, 3606, 1}, {0x1d404, 3607, 1}, {0x1d405, 3608, 1},
+    {0x1d406, 3609, 1}, {0x1d407, 3610, 1}, {0x1d408, 3611, 1}, {0x1d409, 3612, 1},
+    {0x1d40a, 3613, 1}, {0x1d40b, 3614, 1}, {0x1d40c, 3615, 1}, {0x1d40d, 3616, 1},
+    {0x1d40e, 3617, 1}, {0x1d40f, 3618, 1}, {0x1d410, 3619, 1}, {0x1d411, 3620, 1},
+    {0x1d412, 3621, 1}, {0x1d413, 3622, 1}, {0x1d414, 3623, 1}, {0x1d415, 3624, 1},
+    {0x1d416, 3625, 1}, {0x1d417, 3626, 1}, {0x1d418, 3627, 1}, {0x1d419, 3628, 1},
+    {0x1d41a, 3629, 1}, {0x1d41b, 3630, 1}, {0x1d41c, 3631, 1}, {0x1d41d, 3632, 1},
+    {0x1d41e, 3633, 1}, {0x1d41f, 3634, 1}, {0x1d420, 3635, 1}, {0x1d421, 3636, 1},
+    {0x1d422, 3637, 1}, {0x1d423, 3638, 1}, {0x1d424, 3639, 1}, {0x1d425, 3640, 1},
+    {0x1d426, 3641, 1}, {0x1d427, 3642, 1}, {0x1d428, 3643, 1}, {0x1d429, 3644, 1},
+    {0x1d42a, 3645, 1}, {0x1d42b, 3646, 1}, {0x1d42c, 3647, 1}, {0x1d42d, 3648, 1},
+    {0x1d42e, 3649, 1}, {0x1d42f, 3650, 1}, {0x1d430, 3651, 1}, {0x1d431, 3652, 1},
+    {0x1d432, 3653, 1}, {0x1d433, 3654, 1}, {0x1d434, 3655, 1}, {0x1d435, 3656, 1},
+    {0x1d436, 3657, 1}, {0x1d437, 3658, 1}, {0x1d438, 3659, 1}, {0x1d439, 3660, 1},
+    {0x1d43a, 3661, 1}, {0x1d43b, 3662, 1}, {0x1d43c, 3663, 1}, {0x1d43d, 3664, 1},
+    {0x1d43e, 3665, 1}, {0x1d43f, 3666, 1}, {0x1d440, 3667, 1}, {0x1d441, 3668, 1},
+    {0x1d442, 3669, 1}, {0x1d443, 3670, 1}, {0x1d444, 3671, 1}, {0x1d445, 3672, 1},
+    {0x1d446, 3673, 1}, {0x1d447, 3674, 1}, {0x1d448, 3675, 1}, {0x1d449, 3676, 1},
+    {0x1d44a, 3677, 1}, {0x1d44b, 3678, 1}, {0x1d44c, 3679, 1}, {0x1d44d, 3680, 1},
+    {0x1d44e, 3681, 1}, {0x1d44f, 3682, 1}, {0x1d450, 3683, 1}, {0x1d451, 3684, 1},
+    {0x1d452, 3685, 1}, {0x1d453, 3686, 1}, {0x1d454, 3687, 1}, {0x1d456, 3688, 1},
+    {0x1d457, 3689, 1}, {0x1d458, 3690, 1}, {0x1d459, 3691, 1}, {0x1d45a, 3692, 1},
+    {0x1d45b, 3693, 1}, {0x1d45c, 3694, 1}, {0x1d45d, 3695, 1}, {0x1d45e, 3696, 1},
+    {0x1d45f, 3697, 1}, {0x1d460, 3698, 1}, {0x1d461, 3699, 1}, {0x1d462, 3700, 1},
+    {0x1d463, 3701, 1}, {0x1d464, 3702, 1}, {0x1d465, 3703, 1}, {0x1d466, 3704, 1},
+    {0x1d467, 3705, 1}, {0x1d468, 3706, 1}, {0x1d469, 3707, 1}, {0x1d46a, 3708, 1},
+    {0x1d46b, 3709, 1}, {0x1d46c, 3710, 1}, {0x1d46d, 3711, 1}, {0x1d46e, 3712, 1},
+    {0x1d46f, 3713, 1}, {0x1d470, 3714, 1}, {0x1d471, 3715, 1}, {0x1d472, 3716, 1},
+    {0x1d473, 3717, 1}, {0x1d474, 3718, 1}, {0x1d475, 3719, 1}, {0x1d476, 3720, 1},
+    {0x1d477, 3721, 1}, {0x1d478, 3722, 1}, {0x1d479, 3723, 1}, {0x1d47a, 3724, 1},
+    {0x1d47b, 3725, 1}, {0x1d47c, 3726, 1}, {0x1d47d, 3727, 1}, {0x1d47e, 3728, 1},
+    {0x1d47f, 3729, 1}, {0x1d480, 3730, 1}, {0x1d481, 3731, 1}, {0x1d482, 3732, 1},
+    {0x1d483, 3733, 1}, {0x1d484, 3734, 1}, {0x1d485, 3735, 1}, {0x1d486, 3736, 1},
+    {0x1d487, 3737, 1}, {0x1d488, 3738, 1}, {0x1d489, 3739, 1}, {0x1d48a, 3740, 1},
+    {0x1d48b, 3741, 1}, {0x1d48c, 3742, 1}, {0x1d48d, 3743, 1}, {0x1d48e, 3744, 1},
+    {0x1d48f, 3745, 1}, {0x1d490, 3746, 1}, {0x1d491, 3747, 1}, {0x1d492, 3748, 1},
+    {0x1d493, 3749, 1}, {0x1d494, 3750, 1}, {0x1d495, 3751, 1}, {0x1d496, 3752, 1},
+    {0x1d497, 3753, 1}, {0x1d498, 3754, 1}, {0x1d499, 3755, 1}, {0x1d49a, 3756, 1},
+    {0x1d49b, 3757, 1}, {0x1d49c, 3758, 1}, {0x1d49e, 3759, 1}, {0x1d49f, 3760, 1},
+    {0x1d4a2, 3761, 1}, {0x1d4a5, 3762, 1}, {0x1d4a6, 3763, 1}, {0x1d4a9, 3764, 1},
+    {0x1d4aa, 3765, 1}, {0x1d4ab, 3766, 1}, {0x1d4ac, 3767, 1}, {0x1d4ae, 3768, 1},
+    {0x1d4af, 3769, 1}, {0x1d4b0, 3770, 1}, {0x1d4b1, 3771, 1}, {0x1d4b2, 3772, 1},
+    {0x1d4b3, 3773, 1}, {0x1d4b4, 3774, 1}, {0x1d4b5, 3775, 1}, {0x1d4b6, 3776, 1},
+    {0x1d4b7, 3777, 1}, {0x1d4b8, 3778, 1}, {0x1d4b9, 3779, 1}, {0x1d4bb, 3780, 1},
+    {0x1d4bd, 3781, 1}, {0x1d4be, 3782, 1}, {0x1d4bf, 3783, 1}, {0x1d4c0, 3784, 1},
+    {0x1d4c1, 3785, 1}, {0x1d4c2, 3786, 1}, {0x1d4c3, 3787, 1}, {0x1d4c5, 3788, 1},
+    {0x1d4c6, 3789, 1}, {0x1d4c7, 3790, 1}, {0x1d4c8, 3791, 1}, {0x1d4c9, 3792, 1},
+    {0x1d4ca, 3793, 1}, {0x1d4cb, 3794, 1}, {0x1d4cc, 3795, 1}, {0x1d4cd, 3796, 1},
+    {0x1d4ce, 3797, 1}, {0x1d4cf, 3798, 1}, {0x1d4d0, 3799, 1}, {0x1d4d1, 3800, 1},
+    {0x1d4d2, 3801, 1}, {0x1d4d3, 3802, 1}, {0x1d4d4, 3803, 1}, {0x1d4d5, 3804, 1},
+    {0x1d4d6, 3805, 1}, {0x1d4d7, 3806, 1}, {0x1d4d8, 3807, 1}, {0x1d4d9, 3808, 1},
+    {0x1d4da, 3809, 1}, {0x1d4db, 3810, 1}, {0x1d4dc, 3811, 1}, {0x1d4dd, 3812, 1},
+    {0x1d4de, 3813, 1}, {0x1d4df, 3814, 1}, {0x1d4e0, 3815, 1}, {0x1d4e1, 3816, 1},
+    {0x1d4e2, 3817, 1}, {0x1d4e3, 3818, 1}, {0x1d4e4, 3819, 1}, {0x1d4e5, 3820, 1},
+    {0x1d4e6, 3821, 1}, {0x1d4e7, 3822, 1}, {0x1d4e8, 3823, 1}, {0x1d4e9, 3824, 1},
+    {0x1d4ea, 3825, 1}, {0x1d4eb, 3826, 1}, {0x1d4ec, 3827, 1}, {0x1d4ed, 3828, 1},
+    {0x1d4ee, 3829, 1}, {0x1d4ef, 3830, 1}, {0x1d4f0, 3831, 1}, {0x1d4f1, 3832, 1},
+    {0x1d4f2, 3833, 1}, {0x1d4f3, 3834, 1}, {0x1d4f4, 3835, 1}, {0x1d4f5, 3836, 1},
+    {0x1d4f6, 3837, 1}, {0x1d4f7, 3838, 1}, {0x1d4f8, 3839, 1}, {0x1d4f9, 3840, 1},
+    {0x1d4fa, 3841, 1}, {0x1d4fb, 3842, 1}, {0x1d4fc, 3843, 1}, {0x1d4fd, 3844, 1},
+    {0x1d4fe, 3845, 1}, {0x1d4ff, 3846, 1}, {0x1d500, 3847, 1}, {0x1d501, 3848, 1},
+    {0x1d502, 3849, 1}, {0x1d503, 3850, 1}, {0x1d504, 3851, 1}, {0x1d505, 3852, 1},
+    {0x1d507, 3853, 1}, {0x1d508, 3854, 1}, {0x1d509, 3855, 1}, {0x1d50a, 3856, 1},
+    {0x1d50d, 3857, 1}, {0x1d50e, 3858, 1}, {0x1d50f, 3859, 1}, {0x1d510, 3860, 1},
+    {0x1d511, 3861, 1}, {0x1d512, 3862, 1}, {0x1d513, 3863, 1}, {0x1d514, 3864, 1},
+    {0x1d516, 3865, 1}, {0x1d517, 3866, 1}, {0x1d518, 3867, 1}, {0x1d519, 3868, 1},
+    {0x1d51a, 3869, 1}, {0x1d51b, 3870, 1}, {0x1d51c, 3871, 1}, {0x1d51e, 3872, 1},
+    {0x1d51f, 3873, 1}, {0x1d520, 3874, 1}, {0x1d521, 3875, 1}, {0x1d522, 3876, 1},
+    {0x1d523, 3877, 1}, {0x1d524, 3878, 1}, {0x1d525, 3879, 1}, {0x1d526, 3880, 1},
+    {0x1d527, 3881, 1}, {0x1d528, 3882, 1}, {0x1d529, 3883, 1}, {0x1d52a, 3884, 1},
+    {0x1d52b, 3885, 1}, {0x1d52c, 3886, 1}, {0x1d52d, 3887, 1}, {0x1d52e, 3888, 1},
+    {0x1d52f, 3889, 1}, {0x1d530, 3890, 1}, {0x1d531, 3891, 1}, {0x1d532, 3892, 1},
+    {0x1d533, 3893, 1}, {0x1d534, 3894, 1}, {0x1d535, 3895, 1}, {0x1d536, 3896, 1},
+    {0x1d537, 3897, 1}, {0x1d538, 3898, 1}, {0x1d539, 3899, 1}, {0x1d53b, 3900, 1},
+    {0x1d53c, 3901, 1}, {0x1d53d, 3902, 1}, {0x1d53e, 3903, 1}, {0x1d540, 3904, 1},
+    {0x1d541, 3905, 1}, {0x1d542, 3906, 1}, {0x1d543, 3907, 1}, {0x1d544, 3908, 1},
+    {0x1d546, 3909, 1}, {0x1d54a, 3910, 1}, {0x1d54b, 3911, 1}, {0x1d54c, 3912, 1},
+    {0x1d54d, 3913, 1}, {0x1d54e, 3914, 1}, {0x1d54f, 3915, 1}, {0x1d550, 3916, 1},
+    {0x1d552, 3917, 1}, {0x1d553, 3918, 1}, {0x1d554, 3919, 1}, {0x1d555, 3920, 1},
+    {0x1d556, 3921, 1}, {0x1d557, 3922, 1}, {0x1d558, 3923, 1}, {0x1d559, 3924, 1},
+    {0x1d55a, 3925, 1}, {0x1d55b, 3926, 1}, {0x1d55c, 3927, 1}, {0x1d55d, 3928, 1},
+    {0x1d55e, 3929, 1}, {0x1d55f, 3930, 1}, {0x1d560, 3931, 1}, {0x1d561, 3932, 1},
+    {0x1d562, 3933, 1}, {0x1d563, 3934, 1}, {0x1d564, 3935, 1}, {0x1d565, 3936, 1},
+    {0x1d566, 3937, 1}, {0x1d567, 3938, 1}, {0x1d568, 3939, 1}, {0x1d569, 3940, 1},
+    {0x1d56a, 3941, 1}, {0x1d56b, 3942, 1}, {0x1d56c, 3943, 1}, {0x1d56d, 3944, 1},
+    {0x1d56e, 3945, 1}, {0x1d56f, 3946, 1}, {0x1d570, 3947, 1}, {0x1d571, 3948, 1},
+    {0x1d572, 3949, 1}, {0x1d573, 3950, 1}, {0x1d574, 3951, 1}, {0x1d575, 3952, 1},
+    {0x1d576, 3953, 1}, {0x1d577, 3954, 1}, {0x1d578, 3955, 1}, {0x1d579, 3956, 1},
+    {0x1d57a, 3957, 1}, {0x1d57b, 3958, 1}, {0x1d57c, 3959, 1}, {0x1d57d, 3960, 1},
+    {0x1d57e, 3961, 1}, {0x1d57f, 3962, 1}, {0x1d580, 3963, 1}, {0x1d581, 3964, 1},
+    {0x1d582, 3965, 1}, {0x1d583, 3966, 1}, {0x1d584, 3967, 1}, {0x1d585, 3968, 1},
+    {0x1d586, 3969, 1}, {0x1d587, 3970, 1}, {0x1d588, 3971, 1}, {0x1d589, 3972, 1},
+    {0x1d58a, 3973, 1}, {0x1d58b, 3974, 1}, {0x1d58c, 3975, 1}, {0x1d58d, 3976, 1},
+    {0x1d58e, 3977, 1}, {0x1d58f, 3978, 1}, {0x1d590, 3979, 1}, {0x1d591, 3980, 1},
+    {0x1d592, 3981, 1}, {0x1d593, 3982, 1}, {0x1d594, 3983, 1}, {0x1d595, 3984, 1},
+    {0x1d596, 3985, 1}, {0x1d597, 3986, 1}, {0x1d598, 3987, 1}, {0x1d599, 3988, 1},
+    {0x1d59a, 3989, 1}, {0x1d59b, 3990, 1}, {0x1d59c, 3991, 1}, {0x1d59d, 3992, 1},
+    {0x1d59e, 3993, 1}, {0x1d59f, 3994, 1}, {0x1d5a0, 3995, 1}, {0x1d5a1, 3996, 1},
+    {0x1d5a2, 3997, 1}, {0x1d5a3, 3998, 1}, {0x1d5a4, 3999, 1}, {0x1d5a5, 4000, 1},
+    {0x1d5a6, 4001, 1}, {0x1d5a7, 4002, 1}, {0x1d5a8, 4003, 1}, {0x1d5a9, 4004, 1},
+    {0x1d5aa, 4005, 1}, {0x1d5ab, 4006, 1}, {0x1d5ac, 4007, 1}, {0x1d5ad, 4008, 1},
+    {0x1d5ae, 4009, 1}, {0x1d5af, 4010, 1}, {0x1d5b0, 4011, 1}, {0x1d5b1, 4012, 1},
+    {0x1d5b2, 4013, 1}, {0x1d5b3, 4014, 1}, {0x1d5b4, 4015, 1}, {0x1d5b5, 4016, 1},
+    {0x1d5b6, 4017, 1}, {0x1d5b7, 4018, 1}, {0x1d5b8, 4019, 1}, {0x1d5b9, 4020, 1},
+    {0x1d5ba, 4021, 1}, {0x1d5bb, 4022, 1}, {0x1d5bc, 4023, 1}, {0x1d5bd, 4024, 1},
+    {0x1d5be, 4025, 1}, {0x1d5bf, 4026, 1}, {0x1d5c0, 4027, 1}, {0x1d5c1, 4028, 1},
+    {0x1d5c2, 4029, 1}, {0x1d5c3, 4030, 1}, {0x1d5c4, 4031, 1}, {0x1d5c5, 4032, 1},
+    {0x1d5c6, 4033, 1}, {0x1d5c7, 4034, 1}, {0x1d5c8, 4035, 1}, {0x1d5c9, 4036, 1},
+    {0x1d5ca, 4037, 1}, {0x1d5cb, 4038, 1}, {0x1d5cc, 4039, 1}, {0x1d5cd, 4040, 1},
+    {0x1d5ce, 4041, 1}, {0x1d5cf, 4042, 1}, {0x1d5d0, 4043, 1}, {0x1d5d1, 4044, 1},
+    {0x1d5d2, 4045, 1}, {0x1d5d3, 4046, 1}, {0x1d5d4, 4047, 1}, {0x1d5d5, 4048, 1},
+    {0x1d5d6, 4049, 1}, {0x1d5d7, 4050, 1}, {0x1d5d8, 4051, 1}, {0x1d5d9, 4052, 1},
+    {0x1d5da, 4053, 1}, {0x1d5db, 4054, 1}, {0x1d5dc, 4055, 1}, {0x1d5dd, 4056, 1},
+    {0x1d5de, 4057, 1}, {0x1d5df, 4058, 1}, {0x1d5e0, 4059, 1}, {0x1d5e1, 4060, 1},
+    {0x1d5e2, 4061, 1}, {0x1d5e3, 4062, 1}, {0x1d5e4, 4063, 1}, {0x1d5e5, 4064, 1},
+    {0x1d5e6, 4065, 1}, {0x1d5e7, 4066, 1}, {0x1d5e8, 4067, 1}, {0x1d5e9, 4068, 1},
+    {0x1d5ea, 4069, 1}, {0x1d5eb, 4070, 1}, {0x1d5ec, 4071, 1}, {0x1d5ed, 4072, 1},
+    {0x1d5ee, 4073, 1}, {0x1d5ef, 4074, 1}, {0x1d5f0, 4075, 1}, {0x1d5f1, 4076, 1},
+    {0x1d5f2, 4077, 1}, {0x1d5f3, 4078, 1}, {0x1d5f4, 4079, 1}, {0x1d5f5, 4080, 1},
+    {0x1d5f6, 4081, 1}, {0x1d5f7, 4082, 1}, {0x1d5f8, 4083, 1}, {0x1d5f9, 4084, 1},
+    {0x1d5fa, 4085, 1}, {0x1d5fb, 4086, 1}, {0x1d5fc, 4087, 1}, {0x1d5fd, 4088, 1},
+    {0x1d5fe, 4089, 1}, {0x1d5ff, 4090, 1}, {0x1d600, 4091, 1}, {0x1d601, 4092, 1},
+    {0x1d602, 4093, 1}, {0x1d603, 4094, 1}, {0x1d604, 4095, 1}, {0x1d605, 4096, 1},
+    {0x1d606, 4097, 1}, {0x1d607, 4098, 1}, {0x1d608, 4099, 1}, {0x1d609, 4100, 1},
+    {0x1d60a, 4101, 1}, {0x1d60b, 4102, 1}, {0x1d60c, 4103, 1}, {0x1d60d, 4104, 1},
+    {0x1d60e, 4105, 1}, {0x1d60f, 4106, 1}, {0x1d610, 4107, 1}, {0x1d611, 4108, 1},
+    {0x1d612, 4109, 1}, {0x1d613, 4110, 1}, {0x1d614, 4111, 1}, {0x1d615, 4112, 1},
+    {0x1d616, 4113, 1}, {0x1d617, 4114, 1}, {0x1d618, 4115, 1}, {0x1d619, 4116, 1},
+    {0x1d61a, 4117, 1}, {0x1d61b, 4118, 1}, {0x1d61c, 4119, 1}, {0x1d61d, 4120, 1},
+    {0x1d61e, 4121, 1}, {0x1d61f, 4122, 1}, {0x1d620, 4123, 1}, {0x1d621, 4124, 1},
+    {0x1d622, 4125, 1}, {0x1d623, 4126, 1}, {0x1d624, 4127, 1}, {0x1d625, 4128, 1},
+    {0x1d626, 4129, 1}, {0x1d627, 4130, 1}, {0x1d628, 4131, 1}, {0x1d629, 4132, 1},
+    {0x1d62a, 4133, 1}, {0x1d62b, 4134, 1}, {0x1d62c, 4135, 1}, {0x1d62d, 4136, 1},
+    {0x1d62e, 4137, 1}, {0x1d62f, 4138, 1}, {0x1d630, 4139, 1}, {0x1d631, 4140, 1},
+    {0x1d632, 4141, 1}, {0x1d633, 4142, 1}, {0x1d634, 4143, 1}, {0x1d635, 4144, 1},
+    {0x1d636, 4145, 1}, {0x1d637, 4146, 1}, {0x1d638, 4147, 1}, {0x1d639, 4148, 1},
+    {0x1d63a, 4149, 1}, {0x1d63b, 4150, 1}, {0x1d63c, 4151, 1}, {0x1d63d, 4152, 1},
+    {0x1d63e, 4153, 1}, {0x1d63f, 4154, 1}, {0x1d640, 4155, 1}, {0x1d641, 4156, 1},
+    {0x1d642, 4157, 1}, {0x1d643, 4158, 1}, {0x1d644, 4159, 1}, {0x1d645, 4160, 1},
+    {0x1d646, 4161, 1}, {0x1d647, 4162, 1}, {0x1d648, 4163, 1}, {0x1d649, 4164, 1},
+    {0x1d64a, 4165, 1}, {0x1d64b, 4166, 1}, {0x1d64c, 4167, 1}, {0x1d64d, 4168, 1},
+    {0x1d64e, 4169, 1}, {0x1d64f, 4170, 1}, {0x1d650, 4171, 1}, {0x1d651, 4172, 1},
+    {0x1d652, 4173, 1}, {0x1d653, 4174, 1}, {0x1d654, 4175, 1}, {0x1d655, 4176, 1},
+    {0x1d656, 4177, 1}, {0x1d657, 4178, 1}, {0x1d658, 4179, 1}, {0x1d659, 4180, 1},
+    {0x1d65a, 4181, 1}, {0x1d65b, 4182, 1}, {0x1d65c, 4183, 1}, {0x1d65d, 4184, 1},
+    {0x1d65e, 4185, 1}, {0x1d65f, 4186, 1}, {0x1d660, 4187, 1}, {0x1d661, 4188, 1},
+    {0x1d662, 4189, 1}, {0x1d663, 4190, 1}, {0x1d664, 4191, 1}, {0x1d665, 4192, 1},
+    {0x1d666, 4193, 1}, {0x1d667, 4194, 1}, {0x1d668, 4195, 1}, {0x1d669, 4196, 1},
+    {0x1d66a, 4197, 1}, {0x1d66b, 4198, 1}, {0x1d66c, 4199, 1}, {0x1d66d, 4200, 1},
+    {0x1d66e, 4201, 1}, {0x1d66f, 4202, 1}, {0x1d670, 4203, 1}, {0x1d671, 4204, 1},
+    {0x1d672, 4205, 1}, {0x1d673, 4206, 1}, {0x1d674, 4207, 1}, {0x1d675, 4208, 1},
+    {0x1d676, 4209, 1}, {0x1d677, 4210, 1}, {0x1d678, 4211, 1}, {0x1d679, 4212, 1},
+    {0x1d67a, 4213, 1}, {0x1d67b, 4214, 1}, {0x1d67c, 4215, 1}, {0x1d67d, 4216, 1},
+    {0x1d67e, 4217, 1}, {0x1d67f, 4218, 1}, {0x1d680, 4219, 1}, {0x1d681, 4220, 1},
+    {0x1d682, 4221, 1}, {0x1d683, 4222, 1}, {0x1d684, 4223, 1}, {0x1d685, 4224, 1},
+    {0x1d686, 4225, 1}, {0x1d687, 4226, 1}, {0x1d688, 4227, 1}, {0x1d689, 4228, 1},
+    {0x1d68a, 4229, 1}, {0x1d68b, 4230, 1}, {0x1d68c, 4231, 1}, {0x1d68d, 4232, 1},
+    {0x1d68e, 4233, 1}, {0x1d68f, 4234, 1}, {0x1d690, 4235, 1}, {0x1d691, 4236, 1},
+    {0x1d692, 4237, 1}, {0x1d693, 4238, 1}, {0x1d694, 4239, 1}, {0x1d695, 4240, 1},
+    {0x1d696, 4241, 1}, {0x1d697, 4242, 1}, {0x1d698, 4243, 1}, {0x1d699, 4244, 1},
+    {0x1d69a, 4245, 1}, {0x1d69b, 4246, 1}, {0x1d69c, 4247, 1}, {0x1d69d, 4248, 1},
+    {0x1d69e, 4249, 1}, {0x1d69f, 4250, 1}, {0x1d6a0, 4251, 1}, {0x1d6a1, 4252, 1},
+    {0x1d6a2, 4253, 1}, {0x1d6a3, 4254, 1}, {0x1d6a4, 4255, 1}, {0x1d6a5, 4256, 1},
+    {0x1d6a8, 4257, 1}, {0x1d6a9, 4258, 1}, {0x1d6aa, 4259, 1}, {0x1d6ab, 4260, 1},
+    {0x1d6ac, 4261, 1}, {0x1d6ad, 4262, 1}, {0x1d6ae, 4263, 1}, {0x1d6af, 4264, 1},
+    {0x1d6b0, 4265, 1}, {0x1d6b1, 4266, 1}, {0x1d6b2, 4267, 1}, {0x1d6b3, 4268, 1},
+    {0x1d6b4, 4269, 1}, {0x1d6b5, 4270, 1}, {0x1d6b6, 4271, 1}, {0x1d6b7, 4272, 1},
+    {0x1d6b8, 4273, 1}, {0x1d6b9, 4274, 1}, {0x1d6ba, 4275, 1}, {0x1d6bb, 4276, 1},
+    {0x1d6bc, 4277, 1}, {0x1d6bd, 4278, 1}, {0x1d6be, 4279, 1}, {0x1d6bf, 4280, 1},
+    {0x1d6c0, 4281, 1}, {0x1d6c2, 4282, 1}, {0x1d6c3, 4283, 1}, {0x1d6c4, 4284, 1},
+    {0x1d6c5, 4285, 1}, {0x1d6c6, 4286, 1}, {0x1d6c7, 4287, 1}, {0x1d6c8, 4288, 1},
+    {0x1d6c9, 4289, 1}, {0x1d6ca, 4290, 1}, {0x1d6cb, 4291, 1}, {0x1d6cc, 4292, 1},
+    {0x1d6cd, 4293, 1}, {0x1d6ce, 4294, 1}, {0x1d6cf, 4295, 1}, {0x1d6d0, 4296, 1},
+    {0x1d6d1, 4297, 1}, {0x1d6d2, 4298, 1}, {0x1d6d3, 4299, 1}, {0x1d6d4, 4300, 1},
+    {0x1d6d5, 4301, 1}, {0x1d6d6, 4302, 1}, {0x1d6d7, 4303, 1}, {0x1d6d8, 4304, 1},
+    {0x1d6d9, 4305, 1}, {0x1d6da, 4306, 1}, {0x1d6dc, 4307, 1}, {0x1d6dd, 4308, 1},
+    {0x1d6de, 4309, 1}, {0x1d6df, 4310, 1}, {0x1d6e0, 4311, 1}, {0x1d6e1, 4312, 1},
+    {0x1d6e2, 4313, 1}, {0x1d6e3, 4314, 1}, {0x1d6e4, 4315, 1}, {0x1d6e5, 4316, 1},
+    {0x1d6e6, 4317, 1}, {0x1d6e7, 4318, 1}, {0x1d6e8, 4319, 1}, {0x1d6e9, 4320, 1},
+    {0x1d6ea, 4321, 1}, {0x1d6eb, 4322, 1}, {0x1d6ec, 4323, 1}, {0x1d6ed, 4324, 1},
+    {0x1d6ee, 4325, 1}, {0x1d6ef, 4326, 1}, {0x1d6f0, 4327, 1}, {0x1d6f1, 4328, 1},
+    {0x1d6f2, 4329, 1}, {0x1d6f3, 4330, 1}, {0x1d6f4, 4331, 1}, {0x1d6f5, 4332, 1},
+    {0x1d6f6, 4333, 1}, {0x1d6f7, 4334, 1}, {0x1d6f8, 4335, 1}, {0x1d6f9, 4336, 1},
+    {0x1d6fa, 4337, 1}, {0x1d6fc, 4338, 1}, {0x1d6fd, 4339, 1}, {0x1d6fe, 4340, 1},
+    {0x1d6ff, 4341, 1}, {0x1d700, 4342, 1}, {0x1d701, 4343, 1}, {0x1d702, 4344, 1},
+    {0x1d703, 4345, 1}, {0x1d704, 4346, 1}, {0x1d705, 4347, 1}, {0x1d706, 4348, 1},
+    {0x1d707, 4349, 1}, {0x1d708, 4350, 1}, {0x1d709, 4351, 1}, {0x1d70a, 4352, 1},
+    {0x1d70b, 4353, 1}, {0x1d70c, 4354, 1}, {0x1d70d, 4355, 1}, {0x1d70e, 4356, 1},
+    {0x1d70f, 4357, 1}, {0x1d710, 4358, 1}, {0x1d711, 4359, 1}, {0x1d712, 4360, 1},
+    {0x1d713, 4361, 1}, {0x1d714, 4362, 1}, {0x1d716, 4363, 1}, {0x1d717, 4364, 1},
+    {0x1d718, 4365, 1}, {0x1d719, 4366, 1}, {0x1d71a, 4367, 1}, {0x1d71b, 4368, 1},
+    {0x1d71c, 4369, 1}, {0x1d71d, 4370, 1}, {0x1d71e, 4371, 1}, {0x1d71f, 4372, 1},
+    {0x1d720, 4373, 1}, {0x1d721, 4374, 1}, {0x1d722, 4375, 1}, {0x1d723, 4376, 1},
+    {0x1d724, 4377, 1}, {0x1d725, 4378, 1}, {0x1d726, 4379, 1}, {0x1d727, 4380, 1},
+    {0x1d728, 4381, 1}, {0x1d729, 4382, 1}, {0x1d72a, 4383, 1}, {0x1d72b, 4384, 1},
+    {0x1d72c, 4385, 1}, {0x1d72d, 4386, 1}, {0x1d72e, 4387, 1}, {0x1d72f, 4388, 1},
+    {0x1d730, 4389, 1}, {0x1d731, 4390, 1}, {0x1d732, 4391, 1}, {0x1d733, 4392, 1},
+    {0x1d734, 4393, 1}, {0x1d736, 4394, 1}, {0x1d737, 4395, 1}, {0x1d738, 4396, 1},
+    {0x1d739, 4397, 1}, {0x1d73a, 4398, 1}, {0x1d73b, 4399, 1}, {0x1d73c, 4400, 1},
+    {0x1d73d, 4401, 1}, {0x1d73e, 4402, 1}, {0x1d73f, 4403, 1}, {0x1d740, 4404, 1},
+    {0x1d741, 4405, 1}, {0x1d742, 4406, 1}, {0x1d743, 4407, 1}, {0x1d744, 4408, 1},
+    {0x1d745, 4409, 1}, {0x1d746, 4410, 1}, {0x1d747, 4411, 1}, {0x1d748, 4412, 1},
+    {0x1d749, 4413, 1}, {0x1d74a, 4414, 1}, {0x1d74b, 4415, 1}, {0x1d74c, 4416, 1},
+    {0x1d74d, 4417, 1}, {0x1d74e, 4418, 1}, {0x1d750, 4419, 1}, {0x1d751, 4420, 1},
+    {0x1d752, 4421, 1}, {0x1d753, 4422, 1}, {0x1d754, 4423, 1}, {0x1d755, 4424, 1},
+    {0x1d756, 4425, 1}, {0x1d757, 4426, 1}, {0x1d758, 4427, 1}, {0x1d759, 4428, 1},
+    {0x1d75a, 4429, 1}, {0x1d75b, 4430, 1}, {0x1d75c, 4431, 1}, {0x1d75d, 4432, 1},
+    {0x1d75e, 4433, 1}, {0x1d75f, 4434, 1}, {0x1d760, 4435, 1}, {0x1d761, 4436, 1},
+    {0x1d762, 4437, 1}, {0x1d763, 4438, 1}, {0x1d764, 4439, 1}, {0x1d765, 4440, 1},
+    {0x1d766, 4441, 1}, {0x1d767, 4442, 1}, {0x1d768, 4443, 1}, {0x1d769, 4444, 1},
+    {0x1d76a, 4445, 1}, {0x1d76b, 4446, 1}, {0x1d76c, 4447, 1}, {0x1d76d, 4448, 1},
+    {0x1d76e, 4449, 1}, {0x1d770, 4450, 1}, {0x1d771, 4451, 1}, {0x1d772, 4452, 1},
+    {0x1d773, 4453, 1}, {0x1d774, 4454, 1}, {0x1d775, 4455, 1}, {0x1d776, 4456, 1},
+    {0x1d777, 4457, 1}, {0x1d778, 4458, 1}, {0x1d779, 4459, 1}, {0x1d77a, 4460, 1},
+    {0x1d77b, 4461, 1}, {0x1d77c, 4462, 1}, {0x1d77d, 4463, 1}, {0x1d77e, 4464, 1},
+    {0x1d77f, 4465, 1}, {0x1d780, 4466, 1}, {0x1d781, 4467, 1}, {0x1d782, 4468, 1},
+    {0x1d783, 4469, 1}, {0x1d784, 4470, 1}, {0x1d785, 4471, 1}, {0x1d786, 4472, 1},
+    {0x1d787, 4473, 1}, {0x1d788, 4474, 1}, {0x1d78a, 4475, 1}, {0x1d78b, 4476, 1},
+    {0x1d78c, 4477, 1}, {0x1d78d, 4478, 1}, {0x1d78e, 4479, 1}, {0x1d78f, 4480, 1},
+    {0x1d790, 4481, 1}, {0x1d791, 4482, 1}, {0x1d792, 4483, 1}, {0x1d793, 4484, 1},
+    {0x1d794, 4485, 1}, {0x1d795, 4486, 1}, {0x1d796, 4487, 1}, {0x1d797, 4488, 1},
+    {0x1d798, 4489, 1}, {0x1d799, 4490, 1}, {0x1d79a, 4491, 1}, {0x1d79b, 4492, 1},
+    {0x1d79c, 4493, 1}, {0x1d79d, 4494, 1}, {0x1d79e, 4495, 1}, {0x1d79f, 4496, 1},
+    {0x1d7a0, 4497, 1}, {0x1d7a1, 4498, 1}, {0x1d7a2, 4499, 1}, {0x1d7a3, 4500, 1},
+    {0x1d7a4, 4501, 1}, {0x1d7a5, 4502, 1}, {0x1d7a6, 4503, 1}, {0x1d7a7, 4504, 1},
+    {0x1d7a8, 4505, 1}, {0x1d7aa, 4506, 1}, {0x1d7ab, 4507, 1}, {0x1d7ac, 4508, 1},
+    {0x1d7ad, 4509, 1}, {0x1d7ae, 4510, 1}, {0x1d7af, 4511, 1}, {0x1d7b0, 4512, 1},
+    {0x1d7b1, 4513, 1}, {0x1d7b2, 4514, 1}, {0x1d7b3, 4515, 1}, {0x1d7b4, 4516, 1},
+    {0x1d7b5, 4517, 1}, {0x1d7b6, 4518, 1}, {0x1d7b7, 4519, 1}, {0x1d7b8, 4520, 1},
+    {0x1d7b9, 4521, 1}, {0x1d7ba, 4522, 1}, {0x1d7bb, 4523, 1}, {0x1d7bc, 4524, 1},
+    {0x1d7bd, 4525, 1}, {0x1d7be, 4526, 1}, {0x1d7bf, 4527, 1}, {0x1d7c0, 4528, 1},
+    {0x1d7c1, 4529, 1}, {0x1d7c2, 4530, 1}, {0x1d7c4, 4531, 1}, {0x1d7c5, 4532, 1},
+    {0x1d7c6, 4533, 1}, {0x1d7c7, 4534, 1}, {0x1d7c8, 4535, 1}, {0x1d7c9, 4536, 1},
+    {0x1d7ca, 4537, 1}, {0x1d7cb, 4538, 1}, {0x1ee00, 4539, 1}, {0x1ee01, 4540, 1},
+    {0x1ee02, 4541, 1}, {0x1ee03, 4542, 1}, {0x1ee05, 4543, 1}, {0x1ee06, 4544, 1},
+    {0x1ee07, 4545, 1}, {0x1ee08, 4546, 1}, {0x1ee09, 4547, 1}, {0x1ee0a, 4548, 1},
+    {0x1ee0b, 4549, 1}, {0x1ee0c, 4550, 1}, {0x1ee0d, 4551, 1}, {0x1ee0e, 4552, 1},
+    {0x1ee0f, 4553, 1}, {0x1ee10, 4554, 1}, {0x1ee11, 4555, 1}, {0x1ee12, 4556, 1},
+    {0x1ee13, 4557, 1}, {0x1ee14, 4558, 1}, {0x1ee15, 4559, 1}, {0x1ee16, 4560, 1},
+    {0x1ee17, 4561, 1}, {0x1ee18, 4562, 1}, {0x1ee19, 4563, 1}, {0x1ee1a, 4564, 1},
+    {0x1ee1b, 4565, 1}, {0x1ee1c, 4566, 1}, {0x1ee1d, 4567, 1}, {0x1ee1e, 4568, 1},
+    {0x1ee1f, 4569, 1}, {0x1ee21, 4570, 1}, {0x1ee22, 4571, 1}, {0x1ee24, 4572, 1},
+    {0x1ee27, 4573, 1}, {0x1ee29, 4574, 1}, {0x1ee2a, 4575, 1}, {0x1ee2b, 4576, 1},
+    {0x1ee2c, 4577, 1}, {0x1ee2d, 4578, 1}, {0x1ee2e, 4579, 1}, {0x1ee2f, 4580, 1},
+    {0x1ee30, 4581, 1}, {0x1ee31, 4582, 1}, {0x1ee32, 4583, 1}, {0x1ee34, 4584, 1},
+    {0x1ee35, 4585, 1}, {0x1ee36, 4586, 1}, {0x1ee37, 4587, 1}, {0x1ee39, 4588, 1},
+    {0x1ee3b, 4589, 1}, {0x1ee42, 4590, 1}, {0x1ee47, 4591, 1}, {0x1ee49, 4592, 1},
+    {0x1ee4b, 4593, 1}, {0x1ee4d, 4594, 1}, {0x1ee4e, 4595, 1}, {0x1ee4f, 4596, 1},
+    {0x1ee51, 4597, 1}, {0x1ee52, 4598, 1}, {0x1ee54, 4599, 1}, {0x1ee57, 4600, 1},
+    {0x1ee59, 4601, 1}, {0x1ee5b, 4602, 1}, {0x1ee5d, 4603, 1}, {0x1ee5f, 4604, 1},
+    {0x1ee61, 4605, 1}, {0x1ee62, 4606, 1}, {0x1ee64, 4607, 1}, {0x1ee67, 4608, 1},
+    {0x1ee68, 4609, 1}, {0x1ee69, 4610, 1}, {0x1ee6a, 4611, 1}, {0x1ee6c, 4612, 1},
+    {0x1ee6d, 4613, 1}, {0x1ee6e, 4614, 1}, {0x1ee6f, 4615, 1}, {0x1ee70, 4616, 1},
+    {0x1ee71, 4617, 1}, {0x1ee72, 4618, 1}, {0x1ee74, 4619, 1}, {0x1ee75, 4620, 1},
+    {0x1ee76, 4621, 1}, {0x1ee77, 4622, 1}, {0x1ee79, 4623, 1}, {0x1ee7a, 4624, 1},
+    {0x1ee7b, 4625, 1}, {0x1ee7c, 4626, 1}, {0x1ee7e, 4627, 1}, {0x1ee80, 4628, 1},
+    {0x1ee81, 4629, 1}, {0x1ee82, 4630, 1}, {0x1ee83, 4631, 1}, {0x1ee84, 4632, 1},
+    {0x1ee85, 4633, 1}, {0x1ee86, 4634, 1}, {0x1ee87, 4635, 1}, {0x1ee88, 4636, 1},
+    {0x1ee89, 4637, 1}, {0x1ee8b, 4638, 1}, {0x1ee8c, 4639, 1}, {0x1ee8d, 4640, 1},
+    {0x1ee8e, 4641, 1}, {0x1ee8f, 4642, 1}, {0x1ee90, 4643, 1}, {0x1ee91, 4644, 1},
+    {0x1ee92, 4645, 1}, {0x1ee93, 4646, 1}, {0x1ee94, 4647, 1}, {0x1ee95, 4648, 1},
+    {0x1ee96, 4649, 1}, {0x1ee97, 4650, 1}, {0x1ee98, 4651, 1}, {0x1ee99, 4652, 1},
+    {0x1ee9a, 4653, 1}, {0x1ee9b, 4654, 1}, {0x1eea1, 4655, 1}, {0x1eea2, 4656, 1},
+    {0x1eea3, 4657, 1}, {0x1eea5, 4658, 1}, {0x1eea6, 4659, 1}, {0x1eea7, 4660, 1},
+    {0x1eea8, 4661, 1}, {0x1eea9, 4662, 1}, {0x1eeab, 4663, 1}, {0x1eeac, 4664, 1},
+    {0x1eead, 4665, 1}, {0x1eeae, 4666, 1}, {0x1eeaf, 4667, 1}, {0x1eeb0, 4668, 1},
+    {0x1eeb1, 4669, 1}, {0x1eeb2, 4670, 1}, {0x1eeb3, 4671, 1}, {0x1eeb4, 4672, 1},
+    {0x1eeb5, 4673, 1}, {0x1eeb6, 4674, 1}, {0x1eeb7, 4675, 1}, {0x1eeb8, 4676, 1},
+    {0x1eeb9, 4677, 1}, {0x1eeba, 4678, 1}, {0x1eebb, 4679, 1}, {0x2f800, 4680, 1},
+    {0x2f801, 4681, 1}, {0x2f802, 4682, 1}, {0x2f803, 4683, 2}, {0x2f804, 4685, 1},
+    {0x2f805, 4686, 1}, {0x2f806, 4687, 1}, {0x2f807, 4688, 1}, {0x2f808, 4689, 1},
+    {0x2f809, 4690, 1}, {0x2f80a, 4691, 1}, {0x2f80b, 4692, 1}, {0x2f80c, 4693, 1},
+    {0x2f80d, 4694, 2}, {0x2f80e, 4696, 1}, {0x2f80f, 4697, 1}, {0x2f810, 4698, 1},
+    {0x2f811, 4699, 1}, {0x2f812, 4700, 2}, {0x2f813, 4702, 1}, {0x2f814, 4703, 1},
+    {0x2f815, 4704, 1}, {0x2f816, 4705, 2}, {0x2f817, 4707, 1}, {0x2f818, 4708, 1},
+    {0x2f819, 4709, 1}, {0x2f81a, 4710, 1}, {0x2f81b, 4711, 1}, {0x2f81c, 4712, 2},
+    {0x2f81d, 4714, 1}, {0x2f81e, 4715, 1}, {0x2f81f, 4716, 1}, {0x2f820, 4717, 1},
+    {0x2f821, 4718, 1}, {0x2f822, 4719, 1}, {0x2f823, 4720, 1}, {0x2f824, 4721, 1},
+    {0x2f825, 4722, 1}, {0x2f826, 4723, 1}, {0x2f827, 4724, 1}, {0x2f828, 4725, 1},
+    {0x2f829, 4726, 1}, {0x2f82a, 4727, 1}, {0x2f82b, 4728, 1}, {0x2f82c, 4729, 1},
+    {0x2f82d, 4730, 1}, {0x2f82e, 4731, 1}, {0x2f82f, 4732, 1}, {0x2f830, 4733, 1},
+    {0x2f831, 4734, 1}, {0x2f832, 4735, 1}, {0x2f833, 4736, 1}, {0x2f834, 4737, 2},
+    {0x2f835, 4739, 1}, {0x2f836, 4740, 1}, {0x2f837, 4741, 1}, {0x2f838, 4742, 2},
+    {0x2f839, 4744, 1}, {0x2f83a, 4745, 1}, {0x2f83b, 4746, 1}, {0x2f83c, 4747, 1},
+    {0x2f83d, 4748, 1}, {0x2f83e, 4749, 1}, {0x2f83f, 4750, 1}, {0x2f840, 4751, 1},
+    {0x2f841, 4752, 1}, {0x2f842, 4753, 1}, {0x2f843, 4754, 1}, {0x2f844, 4755, 1},
+    {0x2f845, 4756, 1}, {0x2f846, 4757, 1}, {0x2f847, 4758, 1}, {0x2f848, 4759, 1},
+    {0x2f849, 4760, 1}, {0x2f84a, 4761, 1}, {0x2f84b, 4762, 1}, {0x2f84c, 4763, 1},
+    {0x2f84d, 4764, 1}, {0x2f84e, 4765, 1}, {0x2f84f, 4766, 1}, {0x2f850, 4767, 1},
+    {0x2f851, 4768, 1}, {0x2f852, 4769, 1}, {0x2f853, 4770, 1}, {0x2f854, 4771, 1},
+    {0x2f855, 4772, 1}, {0x2f856, 4773, 1}, {0x2f857, 4774, 1}, {0x2f858, 4775, 1},
+    {0x2f859, 4776, 2}, {0x2f85a, 4778, 1}, {0x2f85b, 4779, 1}, {0x2f85c, 4780, 1},
+    {0x2f85d, 4781, 1}, {0x2f85e, 4782, 1}, {0x2f85f, 4783, 1}, {0x2f860, 4784, 2},
+    {0x2f861, 4786, 2}, {0x2f862, 4788, 1}, {0x2f863, 4789, 1}, {0x2f864, 4790, 1},
+    {0x2f865, 4791, 1}, {0x2f866, 4792, 1}, {0x2f867, 4793, 1}, {0x2f868, 4794, 1},
+    {0x2f869, 4795, 1}, {0x2f86a, 4796, 1}, {0x2f86b, 4797, 1}, {0x2f86c, 4798, 2},
+    {0x2f86d, 4800, 1}, {0x2f86e, 4801, 1}, {0x2f86f, 4802, 1}, {0x2f870, 4803, 1},
+    {0x2f871, 4804, 2}, {0x2f872, 4806, 1}, {0x2f873, 4807, 1}, {0x2f874, 4808, 1},
+    {0x2f875, 4809, 1}, {0x2f876, 4810, 1}, {0x2f877, 4811, 1}, {0x2f878, 4812, 1},
+    {0x2f879, 4813, 1}, {0x2f87a, 4814, 1}, {0x2f87b, 4815, 2}, {0x2f87c, 4817, 1},
+    {0x2f87d, 4818, 2}, {0x2f87e, 4820, 1}, {0x2f87f, 4821, 1}, {0x2f880, 4822, 1},
+    {0x2f881, 4823, 1}, {0x2f882, 4824, 1}, {0x2f883, 4825, 1}, {0x2f884, 4826, 1},
+    {0x2f885, 4827, 1}, {0x2f886, 4828, 1}, {0x2f887, 4829, 1}, {0x2f888, 4830, 1},
+    {0x2f889, 4831, 2}, {0x2f88a, 4833, 1}, {0x2f88b, 4834, 1}, {0x2f88c, 4835, 1},
+    {0x2f88d, 4836, 1}, {0x2f88e, 4837, 1}, {0x2f88f, 4838, 2}, {0x2f890, 4840, 1},
+    {0x2f891, 4841, 2}, {0x2f892, 4843, 2}, {0x2f893, 4845, 1}, {0x2f894, 4846, 1},
+    {0x2f895, 4847, 1}, {0x2f896, 4848, 1}, {0x2f897, 4849, 2}, {0x2f898, 4851, 2},
+    {0x2f899, 4853, 1}, {0x2f89a, 4854, 1}, {0x2f89b, 4855, 1}, {0x2f89c, 4856, 1},
+    {0x2f89d, 4857, 1}, {0x2f89e, 4858, 1}, {0x2f89f, 4859, 1}, {0x2f8a0, 4860, 1},
+    {0x2f8a1, 4861, 1}, {0x2f8a2, 4862, 1}, {0x2f8a3, 4863, 1}, {0x2f8a4, 4864, 2},
+    {0x2f8a5, 4866, 1}, {0x2f8a6, 4867, 1}, {0x2f8a7, 4868, 1}, {0x2f8a8, 4869, 1},
+    {0x2f8a9, 4870, 1}, {0x2f8aa, 4871, 1}, {0x2f8ab, 4872, 1}, {0x2f8ac, 4873, 1},
+    {0x2f8ad, 4874, 1}, {0x2f8ae, 4875, 1}, {0x2f8af, 4876, 1}, {0x2f8b0, 4877, 1},
+    {0x2f8b1, 4878, 1}, {0x2f8b2, 4879, 1}, {0x2f8b3, 4880, 1}, {0x2f8b4, 4881, 1},
+    {0x2f8b5, 4882, 1}, {0x2f8b6, 4883, 1}, {0x2f8b7, 4884, 1}, {0x2f8b8, 4885, 2},
+    {0x2f8b9, 4887, 1}, {0x2f8ba, 4888, 1}, {0x2f8bb, 4889, 1}, {0x2f8bc, 4890, 1},
+    {0x2f8bd, 4891, 1}, {0x2f8be, 4892, 2}, {0x2f8bf, 4894, 1}, {0x2f8c0, 4895, 1},
+    {0x2f8c1, 4896, 1}, {0x2f8c2, 4897, 1}, {0x2f8c3, 4898, 1}, {0x2f8c4, 4899, 1},
+    {0x2f8c5, 4900, 1}, {0x2f8c6, 4901, 1}, {0x2f8c7, 4902, 1}, {0x2f8c8, 4903, 1},
+    {0x2f8c9, 4904, 1}, {0x2f8ca, 4905, 2}, {0x2f8cb, 4907, 1}, {0x2f8cc, 4908, 1},
+    {0x2f8cd, 4909, 1}, {0x2f8ce, 4910, 1}, {0x2f8cf, 4911, 1}, {0x2f8d0, 4912, 1},
+    {0x2f8d1, 4913, 1}, {0x2f8d2, 4914, 1}, {0x2f8d3, 4915, 1}, {0x2f8d4, 4916, 1},
+    {0x2f8d5, 4917, 1}, {0x2f8d6, 4918, 1}, {0x2f8d7, 4919, 1}, {0x2f8d8, 4920, 1},
+    {0x2f8d9, 4921, 1}, {0x2f8da, 4922, 1}, {0x2f8db, 4923, 1}, {0x2f8dc, 4924, 1},
+    {0x2f8dd, 4925, 2}, {0x2f8de, 4927, 1}, {0x2f8df, 4928, 1}, {0x2f8e0, 4929, 1},
+    {0x2f8e1, 4930, 1}, {0x2f8e2, 4931, 1}, {0x2f8e3, 4932, 2}, {0x2f8e4, 4934, 1},
+    {0x2f8e5, 4935, 1}, {0x2f8e6, 4936, 1}, {0x2f8e7, 4937, 1}, {0x2f8e8, 4938, 1},
+    {0x2f8e9, 4939, 1}, {0x2f8ea, 4940, 1}, {0x2f8eb, 4941, 1}, {0x2f8ec, 4942, 2},
+    {0x2f8ed, 4944, 1}, {0x2f8ee, 4945, 1}, {0x2f8ef, 4946, 1}, {0x2f8f0, 4947, 2},
+    {0x2f8f1, 4949, 1}, {0x2f8f2, 4950, 1}, {0x2f8f3, 4951, 1}, {0x2f8f4, 4952, 1},
+    {0x2f8f5, 4953, 1}, {0x2f8f6, 4954, 1}, {0x2f8f7, 4955, 2}, {0x2f8f8, 4957, 2},
+    {0x2f8f9, 4959, 2}, {0x2f8fa, 4961, 1}, {0x2f8fb, 4962, 2}, {0x2f8fc, 4964, 1},
+    {0x2f8fd, 4965, 1}, {0x2f8fe, 4966, 1}, {0x2f8ff, 4967, 1}, {0x2f900, 4968, 1},
+    {0x2f901, 4969, 1}, {0x2f902, 4970, 1}, {0x2f903, 4971, 1}, {0x2f904, 4972, 1},
+    {0x2f905, 4973, 1}, {0x2f906, 4974, 2}, {0x2f907, 4976, 1}, {0x2f908, 4977, 1},
+    {0x2f909, 4978, 1}, {0x2f90a, 4979, 1}, {0x2f90b, 4980, 1}, {0x2f90c, 4981, 1},
+    {0x2f90d, 4982, 2}, {0x2f90e, 4984, 1}, {0x2f90f, 4985, 1}, {0x2f910, 4986, 2},
+    {0x2f911, 4988, 2}, {0x2f912, 4990, 1}, {0x2f913, 4991, 1}, {0x2f914, 4992, 1},
+    {0x2f915, 4993, 1}, {0x2f916, 4994, 1}, {0x2f917, 4995, 1}, {0x2f918, 4996, 1},
+    {0x2f919, 4997, 1}, {0x2f91a, 4998, 1}, {0x2f91b, 4999, 2}, {0x2f91c, 5001, 1},
+    {0x2f91d, 5002, 2}, {0x2f91e, 5004, 1}, {0x2f91f, 5005, 2}, {0x2f920, 5007, 1},
+    {0x2f921, 5008, 1}, {0x2f922, 5009, 1}, {0x2f923, 5010, 2}, {0x2f924, 5012, 1},
+    {0x2f925, 5013, 1}, {0x2f926, 5014, 2}, {0x2f927, 5016, 2}, {0x2f928, 5018, 1},
+    {0x2f929, 5019, 1}, {0x2f92a, 5020, 1}, {0x2f92b, 5021, 1}, {0x2f92c, 5022, 1},
+    {0x2f92d, 5023, 1}, {0x2f92e, 5024, 1}, {0x2f92f, 5025, 1}, {0x2f930, 5026, 1},
+    {0x2f931, 5027, 1}, {0x2f932, 5028, 1}, {0x2f933, 5029, 1}, {0x2f934, 5030, 1},
+    {0x2f935, 5031, 2}, {0x2f936, 5033, 1}, {0x2f937, 5034, 2}, {0x2f938, 5036, 1},
+    {0x2f939, 5037, 2}, {0x2f93a, 5039, 1}, {0x2f93b, 5040, 2}, {0x2f93c, 5042, 2},
+    {0x2f93d, 5044, 2}, {0x2f93e, 5046, 1}, {0x2f93f, 5047, 1}, {0x2f940, 5048, 1},
+    {0x2f941, 5049, 2}, {0x2f942, 5051, 2}, {0x2f943, 5053, 2}, {0x2f944, 5055, 2},
+    {0x2f945, 5057, 1}, {0x2f946, 5058, 1}, {0x2f947, 5059, 1}, {0x2f948, 5060, 1},
+    {0x2f949, 5061, 1}, {0x2f94a, 5062, 1}, {0x2f94b, 5063, 1}, {0x2f94c, 5064, 1},
+    {0x2f94d, 5065, 2}, {0x2f94e, 5067, 1}, {0x2f94f, 5068, 1}, {0x2f950, 5069, 1},
+    {0x2f951, 5070, 1}, {0x2f952, 5071, 2}, {0x2f953, 5073, 1}, {0x2f954, 5074, 2},
+    {0x2f955, 5076, 2}, {0x2f956, 5078, 1}, {0x2f957, 5079, 1}, {0x2f958, 5080, 1},
+    {0x2f959, 5081, 1}, {0x2f95a, 5082, 1}, {0x2f95b, 5083, 1}, {0x2f95c, 5084, 2},
+    {0x2f95d, 5086, 2}, {0x2f95e, 5088, 2}, {0x2f95f, 5090, 1}, {0x2f960, 5091, 1},
+    {0x2f961, 5092, 2}, {0x2f962, 5094, 1}, {0x2f963, 5095, 1}, {0x2f964, 5096, 1},
+    {0x2f965, 5097, 2}, {0x2f966, 5099, 1}, {0x2f967, 5100, 1}, {0x2f968, 5101, 1},
+    {0x2f969, 5102, 1}, {0x2f96a, 5103, 1}, {0x2f96b, 5104, 2}, {0x2f96c, 5106, 1},
+    {0x2f96d, 5107, 1}, {0x2f96e, 5108, 1}, {0x2f96f, 5109, 1}, {0x2f970, 5110, 1},
+    {0x2f971, 5111, 1}, {0x2f972, 5112, 2}, {0x2f973, 5114, 2}, {0x2f974, 5116, 1},
+    {0x2f975, 5117, 2}, {0x2f976, 5119, 1}, {0x2f977, 5120, 2}, {0x2f978, 5122, 1},
+    {0x2f979, 5123, 1}, {0x2f97a, 5124, 1}, {0x2f97b, 5125, 2}, {0x2f97c, 5127, 2},
+    {0x2f97d, 5129, 1}, {0x2f97e, 5130, 2}, {0x2f97f, 5132, 1}, {0x2f980, 5133, 2},
+    {0x2f981, 5135, 1}, {0x2f982, 5136, 1}, {0x2f983, 5137, 1}, {0x2f984, 5138, 1},
+    {0x2f985, 5139, 1}, {0x2f986, 5140, 1}, {0x2f987, 5141, 2}, {0x2f988, 5143, 2},
+    {0x2f989, 5145, 2}, {0x2f98a, 5147, 2}, {0x2f98b, 5149, 1}, {0x2f98c, 5150, 1},
+    {0x2f98d, 5151, 1}, {0x2f98e, 5152, 1}, {0x2f98f, 5153, 1}, {0x2f990, 5154, 1},
+    {0x2f991, 5155, 1}, {0x2f992, 5156, 1}, {0x2f993, 5157, 1}, {0x2f994, 5158, 1},
+    {0x2f995, 5159, 1}, {0x2f996, 5160, 1}, {0x2f997, 5161, 2}, {0x2f998, 5163, 1},
+    {0x2f999, 5164, 1}, {0x2f99a, 5165, 1}, {0x2f99b, 5166, 1}, {0x2f99c, 5167, 1},
+    {0x2f99d, 5168, 1}, {0x2f99e, 5169, 1}, {0x2f99f, 5170, 1}, {0x2f9a0, 5171, 1},
+    {0x2f9a1, 5172, 1}, {0x2f9a2, 5173, 1}, {0x2f9a3, 5174, 1}, {0x2f9a4, 5175, 2},
+    {0x2f9a5, 5177, 2}, {0x2f9a6, 5179, 2}, {0x2f9a7, 5181, 1}, {0x2f9a8, 5182, 1},
+    {0x2f9a9, 5183, 1}, {0x2f9aa, 5184, 1}, {0x2f9ab, 5185, 2}, {0x2f9ac, 5187, 1},
+    {0x2f9ad, 5188, 2}, {0x2f9ae, 5190, 1}, {0x2f9af, 5191, 1}, {0x2f9b0, 5192, 2},
+    {0x2f9b1, 5194, 2}, {0x2f9b2, 5196, 1}, {0x2f9b3, 5197, 1}, {0x2f9b4, 5198, 1},
+    {0x2f9b5, 5199, 1}, {0x2f9b6, 5200, 1}, {0x2f9b7, 5201, 1}, {0x2f9b8, 5202, 1},
+    {0x2f9b9, 5203, 1}, {0x2f9ba, 5204, 1}, {0x2f9bb, 5205, 1}, {0x2f9bc, 5206, 1},
+    {0x2f9bd, 5207, 1}, {0x2f9be, 5208, 1}, {0x2f9bf, 5209, 1}, {0x2f9c0, 5210, 1},
+    {0x2f9c1, 5211, 1}, {0x2f9c2, 5212, 1}, {0x2f9c3, 5213, 1}, {0x2f9c4, 5214, 1},
+    {0x2f9c5, 5215, 2}, {0x2f9c6, 5217, 1}, {0x2f9c7, 5218, 1}, {0x2f9c8, 5219, 1},
+    {0x2f9c9, 5220, 1}, {0x2f9ca, 5221, 1}, {0x2f9cb, 5222, 2}, {0x2f9cc, 5224, 2},
+    {0x2f9cd, 5226, 1}, {0x2f9ce, 5227, 1}, {0x2f9cf, 5228, 1}, {0x2f9d0, 5229, 1},
+    {0x2f9d1, 5230, 1}, {0x2f9d2, 5231, 1}, {0x2f9d3, 5232, 2}, {0x2f9d4, 5234, 1},
+    {0x2f9d5, 5235, 1}, {0x2f9d6, 5236, 1}, {0x2f9d7, 5237, 1}, {0x2f9d8, 5238, 2},
+    {0x2f9d9, 5240, 2}, {0x2f9da, 5242, 1}, {0x2f9db, 5243, 1}, {0x2f9dc, 5244, 1},
+    {0x2f9dd, 5245, 2}, {0x2f9de, 5247, 1}, {0x2f9df, 5248, 1}, {0x2f9e0, 5249, 2},
+    {0x2f9e1, 5251, 2}, {0x2f9e2, 5253, 1}, {0x2f9e3, 5254, 1}, {0x2f9e4, 5255, 1},
+    {0x2f9e5, 5256, 2}, {0x2f9e6, 5258, 1}, {0x2f9e7, 5259, 1}, {0x2f9e8, 5260, 1},
+    {0x2f9e9, 5261, 1}, {0x2f9ea, 5262, 1}, {0x2f9eb, 5263, 1}, {0x2f9ec, 5264, 1},
+    {0x2f9ed, 5265, 2}, {0x2f9ee, 5267, 1}, {0x2f9ef, 5268, 1}, {0x2f9f0, 5269, 1},
+    {0x2f9f1, 5270, 2}, {0x2f9f2, 5272, 1}, {0x2f9f3, 5273, 1}, {0x2f9f4, 5274, 1},
+    {0x2f9f5, 5275, 1}, {0x2f9f6, 5276, 2}, {0x2f9f7, 5278, 2}, {0x2f9f8, 5280, 1},
+    {0x2f9f9, 5281, 1}, {0x2f9fa, 5282, 1}, {0x2f9fb, 5283, 2}, {0x2f9fc, 5285, 1},
+    {0x2f9fd, 5286, 2}, {0x2f9fe, 5288, 1}, {0x2f9ff, 5289, 1}, {0x2fa00, 5290, 1},
+    {0x2fa01, 5291, 2}, {0x2fa02, 5293, 1}, {0x2fa03, 5294, 1}, {0x2fa04, 5295, 1},
+    {0x2fa05, 5296, 1}, {0x2fa06, 5297, 1}, {0x2fa07, 5298, 1}, {0x2fa08, 5299, 1},
+    {0x2fa09, 5300, 2}, {0x2fa0a, 5302, 1}, {0x2fa0b, 5303, 1}, {0x2fa0c, 5304, 1},
+    {0x2fa0d, 5305, 1}, {0x2fa0e, 5306, 1}, {0x2fa0f, 5307, 1}, {0x2fa10, 5308, 2},
+    {0x2fa11, 5310, 1}, {0x2fa12, 5311, 2}, {0x2fa13, 5313, 2}, {0x2fa14, 5315, 2},
+    {0x2fa15, 5317, 1}, {0x2fa16, 5318, 1}, {0x2fa17, 5319, 1}, {0x2fa18, 5320, 1},
+    {0x2fa19, 5321, 1}, {0x2fa1a, 5322, 1}, {0x2fa1b, 5323, 1}, {0x2fa1c, 5324, 1},
+    {0x2fa1d, 5325, 2},
+};
+const size_t FOLD_COUNT = 4305;
+
+const char16_t FOLD_DATA[] = {
+    0x0061, 0x03bc, 0x006f, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0043,
+    0x0045, 0x0045, 0x0045, 0x0045, 0x0049, 0x0049, 0x0049, 0x0049, 0x004e, 0x004f,
+    0x004f, 0x004f, 0x004f, 0x004f, 0x0055, 0x0055, 0x0055, 0x0055, 0x0059, 0x0061,
+    0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0063, 0x0065, 0x0065, 0x0065, 0x0065,
+    0x0069, 0x0069, 0x0069, 0x0069, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f,
+    0x0075, 0x0075, 0x0075, 0x0075, 0x0079, 0x0079, 0x0041, 0x0061, 0x0041, 0x0061,
+    0x0041, 0x0061, 0x0043, 0x0063, 0x0043, 0x0063, 0x0043, 0x0063, 0x0043, 0x0063,
+    0x0044, 0x0064, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065,
+    0x0045, 0x0065, 0x0047, 0x0067, 0x0047, 0x0067, 0x0047, 0x0067, 0x0047, 0x0067,
+    0x0048, 0x0068, 0x0049, 0x0069, 0x0049, 0x0069, 0x0049, 0x0069, 0x0049, 0x0069,
+    0x0049, 0x0049, 0x004a, 0x0069, 0x006a, 0x004a, 0x006a, 0x004b, 0x006b, 0x004c,
+    0x006c, 0x004c, 0x006c, 0x004c, 0x006c, 0x004c, 0x00b7, 0x006c, 0x00b7, 0x004e,
+    0x006e, 0x004e, 0x006e, 0x004e, 0x006e, 0x02bc, 0x006e, 0x004f, 0x006f, 0x004f,
+    0x006f, 0x004f, 0x006f, 0x0052, 0x0072, 0x0052, 0x0072, 0x0052, 0x0072, 0x0053,
+    0x0073, 0x0053, 0x0073, 0x0053, 0x0073, 0x0053, 0x0073, 0x0054, 0x0074, 0x0054,
+    0x0074, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055,
+    0x0075, 0x0055, 0x0075, 0x0057, 0x0077, 0x0059, 0x0079, 0x0059, 0x005a, 0x007a,
+    0x005a, 0x007a, 0x005a, 0x007a, 0x0073, 0x004f, 0x006f, 0x0055, 0x0075, 0x0044,
+    0x005a, 0x0044, 0x007a, 0x0064, 0x007a, 0x004c, 0x004a, 0x004c, 0x006a, 0x006c,
+    0x006a, 0x004e, 0x004a, 0x004e, 0x006a, 0x006e, 0x006a, 0x0041, 0x0061, 0x0049,
+    0x0069, 0x004f, 0x006f, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055,
+    0x0075, 0x0055, 0x0075, 0x0041, 0x0061, 0x0041, 0x0061, 0x00c6, 0x00e6, 0x0047,
+    0x0067, 0x004b, 0x006b, 0x004f, 0x006f, 0x004f, 0x006f, 0x01b7, 0x0292, 0x006a,
+    0x0044, 0x005a, 0x0044, 0x007a, 0x0064, 0x007a, 0x0047, 0x0067, 0x004e, 0x006e,
+    0x0041, 0x0061, 0x00c6, 0x00e6, 0x00d8, 0x00f8, 0x0041, 0x0061, 0x0041, 0x0061,
+    0x0045, 0x0065, 0x0045, 0x0065, 0x0049, 0x0069, 0x0049, 0x0069, 0x004f, 0x006f,
+    0x004f, 0x006f, 0x0052, 0x0072, 0x0052, 0x0072, 0x0055, 0x0075, 0x0055, 0x0075,
+    0x0053, 0x0073, 0x0054, 0x0074, 0x0048, 0x0068, 0x0041, 0x0061, 0x0045, 0x0065,
+    0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x0059, 0x0079,
+    0x0068, 0x0266, 0x006a, 0x0072, 0x0279, 0x027b, 0x0281, 0x0077, 0x0079, 0x0263,
+    0x006c, 0x0073, 0x0078, 0x0295, 0x02b9, 0x0020, 0x0391, 0x0395, 0x0397, 0x0399,
+    0x039f, 0x03a5, 0x03a9, 0x03b9, 0x0399, 0x03a5, 0x03b1, 0x03b5, 0x03b7, 0x03b9,
+    0x03c5, 0x03b9, 0x03c5, 0x03bf, 0x03c5, 0x03c9, 0x03b2, 0x03b8, 0x03a5, 0x03a5,
+    0x03a5, 0x03c6, 0x03c0, 0x03ba, 0x03c1, 0x03c2, 0x0398, 0x03b5, 0x03a3, 0x0415,
+    0x0415, 0x0413, 0x0406, 0x041a, 0x0418, 0x0423, 0x0418, 0x0438, 0x0435, 0x0435,
+    0x0433, 0x0456, 0x043a, 0x0438, 0x0443, 0x0474, 0x0475, 0x0416, 0x0436, 0x0410,
+    0x0430, 0x0410, 0x0430, 0x0415, 0x0435, 0x04d8, 0x04d9, 0x0416, 0x0436, 0x0417,
+    0x0437, 0x0418, 0x0438, 0x0418, 0x0438, 0x041e, 0x043e, 0x04e8, 0x04e9, 0x042d,
+    0x044d, 0x0423, 0x0443, 0x0423, 0x0443, 0x0423, 0x0443, 0x0427, 0x0447, 0x042b,
+    0x044b, 0x0565, 0x0582, 0x0627, 0x0653, 0x0627, 0x0654, 0x0648, 0x0654, 0x0627,
+    0x0655, 0x064a, 0x0654, 0x0627, 0x0674, 0x0648, 0x0674, 0x06c7, 0x0674, 0x064a,
+    0x0674, 0x06d5, 0x0654, 0x06c1, 0x0654, 0x06d2, 0x0654, 0x0928, 0x093c, 0x0930,
+    0x093c, 0x0933, 0x093c, 0x0915, 0x093c, 0x0916, 0x093c, 0x0917, 0x093c, 0x091c,
+    0x093c, 0x0921, 0x093c, 0x0922, 0x093c, 0x092b, 0x093c, 0x092f, 0x093c, 0x09a1,
+    0x09bc, 0x09a2, 0x09bc, 0x09af, 0x09bc, 0x0a32, 0x0a3c, 0x0a38, 0x0a3c, 0x0a16,
+    0x0a3c, 0x0a17, 0x0a3c, 0x0a1c, 0x0a3c, 0x0a2b, 0x0a3c, 0x0b21, 0x0b3c, 0x0b22,
+    0x0b3c, 0x0b92, 0x0bd7, 0x0e4d, 0x0e32, 0x0ecd, 0x0eb2, 0x0eab, 0x0e99, 0x0eab,
+    0x0ea1, 0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7, 0x0f5b,
+    0x0fb7, 0x0f40, 0x0fb5, 0x1025, 0x102e, 0x10dc, 0x1b05, 0x1b35, 0x1b07, 0x1b35,
+    0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35, 0x0041, 0x00c6,
+    0x0042, 0x0044, 0x0045, 0x018e, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c,
+    0x004d, 0x004e, 0x004f, 0x0222, 0x0050, 0x0052, 0x0054, 0x0055, 0x0057, 0x0061,
+    0x0250, 0x0251, 0x1d02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025b, 0x025c, 0x0067,
+    0x006b, 0x006d, 0x014b, 0x006f, 0x0254, 0x1d16, 0x1d17, 0x0070, 0x0074, 0x0075,
+    0x1d1d, 0x026f, 0x0076, 0x1d25, 0x03b2, 0x03b3, 0x03b4, 0x03c6, 0x03c7, 0x0069,
+    0x0072, 0x0075, 0x0076, 0x03b2, 0x03b3, 0x03c1, 0x03c6, 0x03c7, 0x043d, 0x0252,
+    0x0063, 0x0255, 0x00f0, 0x025c, 0x0066, 0x025f, 0x0261, 0x0265, 0x0268, 0x0269,
+    0x026a, 0x1d7b, 0x029d, 0x026d, 0x1d85, 0x029f, 0x0271, 0x0270, 0x0272, 0x0273,
+    0x0274, 0x0275, 0x0278, 0x0282, 0x0283, 0x01ab, 0x0289, 0x028a, 0x1d1c, 0x028b,
+    0x028c, 0x007a, 0x0290, 0x0291, 0x0292, 0x03b8, 0x0041, 0x0061, 0x0042, 0x0062,
+    0x0042, 0x0062, 0x0042, 0x0062, 0x0043, 0x0063, 0x0044, 0x0064, 0x0044, 0x0064,
+    0x0044, 0x0064, 0x0044, 0x0064, 0x0044, 0x0064, 0x0045, 0x0065, 0x0045, 0x0065,
+    0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0046, 0x0066, 0x0047, 0x0067,
+    0x0048, 0x0068, 0x0048, 0x0068, 0x0048, 0x0068, 0x0048, 0x0068, 0x0048, 0x0068,
+    0x0049, 0x0069, 0x0049, 0x0069, 0x004b, 0x006b, 0x004b, 0x006b, 0x004b, 0x006b,
+    0x004c, 0x006c, 0x004c, 0x006c, 0x004c, 0x006c, 0x004c, 0x006c, 0x004d, 0x006d,
+    0x004d, 0x006d, 0x004d, 0x006d, 0x004e, 0x006e, 0x004e, 0x006e, 0x004e, 0x006e,
+    0x004e, 0x006e, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f,
+    0x0050, 0x0070, 0x0050, 0x0070, 0x0052, 0x0072, 0x0052, 0x0072, 0x0052, 0x0072,
+    0x0052, 0x0072, 0x0053, 0x0073, 0x0053, 0x0073, 0x0053, 0x0073, 0x0053, 0x0073,
+    0x0053, 0x0073, 0x0054, 0x0074, 0x0054, 0x0074, 0x0054, 0x0074, 0x0054, 0x0074,
+    0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075,
+    0x0056, 0x0076, 0x0056, 0x0076, 0x0057, 0x0077, 0x0057, 0x0077, 0x0057, 0x0077,
+    0x0057, 0x0077, 0x0057, 0x0077, 0x0058, 0x0078, 0x0058, 0x0078, 0x0059, 0x0079,
+    0x005a, 0x007a, 0x005a, 0x007a, 0x005a, 0x007a, 0x0068, 0x0074, 0x0077, 0x0079,
+    0x0061, 0x02be, 0x0073, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041,
+    0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041,
+    0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0041, 0x0061, 0x0045, 0x0065, 0x0045,
+    0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045, 0x0065, 0x0045,
+    0x0065, 0x0045, 0x0065, 0x0049, 0x0069, 0x0049, 0x0069, 0x004f, 0x006f, 0x004f,
+    0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f,
+    0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f, 0x006f, 0x004f,
+    0x006f, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0055,
+    0x0075, 0x0055, 0x0075, 0x0055, 0x0075, 0x0059, 0x0079, 0x0059, 0x0079, 0x0059,
+    0x0079, 0x0059, 0x0079, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1,
+    0x03b1, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x03b5,
+    0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x0395, 0x0395, 0x0395, 0x0395, 0x0395,
+    0x0395, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x0397,
+    0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x03b9, 0x03b9, 0x03b9,
+    0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x0399, 0x0399, 0x0399, 0x0399, 0x0399,
+    0x0399, 0x0399, 0x0399, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x039f,
+    0x039f, 0x039f, 0x039f, 0x039f, 0x039f, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5,
+    0x03c5, 0x03c5, 0x03c5, 0x03a5, 0x03a5, 0x03a5, 0x03a5, 0x03c9, 0x03c9, 0x03c9,
+    0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03a9, 0x03a9, 0x03a9, 0x03a9, 0x03a9,
+    0x03a9, 0x03a9, 0x03a9, 0x03b1, 0x03b1, 0x03b5, 0x03b5, 0x03b7, 0x03b7, 0x03b9,
+    0x03b9, 0x03bf, 0x03bf, 0x03c5, 0x03c5, 0x03c9, 0x03c9, 0x03b1, 0x03b1, 0x03b1,
+    0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391,
+    0x0391, 0x0391, 0x0391, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7,
+    0x03b7, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x0397, 0x03c9,
+    0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03a9, 0x03a9, 0x03a9,
+    0x03a9, 0x03a9, 0x03a9, 0x03a9, 0x03a9, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1,
+    0x03b1, 0x03b1, 0x0391, 0x0391, 0x0391, 0x0391, 0x0391, 0x03b9, 0x03b7, 0x03b7,
+    0x03b7, 0x03b7, 0x03b7, 0x0395, 0x0395, 0x0397, 0x0397, 0x0397, 0x03b9, 0x03b9,
+    0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x0399, 0x0399, 0x0399, 0x0399, 0x03c5, 0x03c5,
+    0x03c5, 0x03c5, 0x03c1, 0x03c1, 0x03c5, 0x03c5, 0x03a5, 0x03a5, 0x03a5, 0x03a5,
+    0x03a1, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x039f, 0x039f, 0x03a9, 0x03a9,
+    0x03a9, 0x0069, 0x006e, 0x0061, 0x0065, 0x006f, 0x0078, 0x0259, 0x0068, 0x006b,
+    0x006c, 0x006d, 0x006e, 0x0070, 0x0073, 0x0074, 0x0043, 0x0190, 0x0067, 0x0048,
+    0x0048, 0x0048, 0x0068, 0x0127, 0x0049, 0x0049, 0x004c, 0x006c, 0x004e, 0x0050,
+    0x0051, 0x0052, 0x0052, 0x0052, 0x005a, 0x03a9, 0x005a, 0x004b, 0x0041, 0x0042,
+    0x0043, 0x0065, 0x0045, 0x0046, 0x004d, 0x006f, 0x05d0, 0x05d1, 0x05d2, 0x05d3,
+    0x0069, 0x03c0, 0x03b3, 0x0393, 0x03a0, 0x0044, 0x0064, 0x0065, 0x0069, 0x006a,
+    0x006a, 0x0056, 0x2d61, 0x304b, 0x3099, 0x304d, 0x3099, 0x304f, 0x3099, 0x3051,
+    0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305b,
+    0x3099, 0x305d, 0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+    0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f, 0x309a, 0x3072, 0x3099, 0x3072,
+    0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078, 0x3099, 0x3078, 0x309a, 0x307b,
+    0x3099, 0x307b, 0x309a, 0x3046, 0x3099, 0x309d, 0x3099, 0x3088, 0x308a, 0x30ab,
+    0x3099, 0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1, 0x3099, 0x30b3, 0x3099, 0x30b5,
+    0x3099, 0x30b7, 0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd, 0x3099, 0x30bf,
+    0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8, 0x3099, 0x30cf,
+    0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2, 0x309a, 0x30d5, 0x3099, 0x30d5,
+    0x309a, 0x30d8, 0x3099, 0x30d8, 0x309a, 0x30db, 0x3099, 0x30db, 0x309a, 0x30a6,
+    0x3099, 0x30ef, 0x3099, 0x30f0, 0x3099, 0x30f1, 0x3099, 0x30f2, 0x3099, 0x30fd,
+    0x3099, 0x30b3, 0x30c8, 0x1100, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103,
+    0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106,
+    0x1107, 0x1108, 0x1121, 0x1109, 0x110a, 0x110b, 0x110c, 0x110d, 0x110e, 0x110f,
+    0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167,
+    0x1168, 0x1169, 0x116a, 0x116b, 0x116c, 0x116d, 0x116e, 0x116f, 0x1170, 0x1171,
+    0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11c7, 0x11c8, 0x11cc,
+    0x11ce, 0x11d3, 0x11d7, 0x11d9, 0x111c, 0x11dd, 0x11df, 0x111d, 0x111e, 0x1120,
+    0x1122, 0x1123, 0x1127, 0x1129, 0x112b, 0x112c, 0x112d, 0x112e, 0x112f, 0x1132,
+    0x1136, 0x1140, 0x1147, 0x114c, 0x11f1, 0x11f2, 0x1157, 0x1158, 0x1159, 0x1184,
+    0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119e, 0x11a1, 0x044a, 0x044c, 0xa76f,
+    0x0043, 0x0046, 0x0051, 0x0126, 0x0153, 0xa727, 0xab37, 0x026b, 0xab52, 0x028d,
+    0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5, 0x9f9c, 0x9f9c, 0x5951,
+    0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f, 0x87ba, 0x88f8, 0x908f,
+    0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04,
+    0x721b, 0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f,
+    0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7, 0x52de, 0x64c4, 0x6ad3,
+    0x7210, 0x76e7, 0x8001, 0x8606, 0x865c, 0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c,
+    0x797f, 0x7da0, 0x83c9, 0x9304, 0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e,
+    0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f, 0x7d2f,
+    0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe, 0x83f1, 0x9675,
+    0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7, 0x6012, 0x7387, 0x7570, 0x5317,
+    0x78fb, 0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701,
+    0x8449, 0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565, 0x4eae,
+    0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf, 0x52f5, 0x5442, 0x5973,
+    0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97, 0x9ece, 0x529b, 0x66c6,
+    0x6b77, 0x8f62, 0x5e74, 0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca,
+    0x7df4, 0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8,
+    0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375, 0x4ee4, 0x56f9,
+    0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046, 0x9234, 0x96f6, 0x9748,
+    0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8, 0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f,
+    0x6599, 0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e, 0x5289,
+    0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10, 0x985e, 0x516d,
+    0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x7387,
+    0x9686, 0x5229, 0x540f, 0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2,
+    0x7f79, 0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0, 0x7498,
+    0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8, 0x7acb, 0x7b20, 0x7c92,
+    0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207, 0x5ea6, 0x62d3, 0x7cd6,
+    0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c, 0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0,
+    0x585a, 0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f, 0x9756,
+    0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef, 0x98fc, 0x9928, 0x9db4,
+    0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606,
+    0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e, 0x6094, 0x6168, 0x618e, 0x61f2, 0x654f,
+    0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422, 0x7891,
+    0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d, 0x798e, 0x7a40, 0x7a81,
+    0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed, 0x8279, 0x8279, 0x8457,
+    0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff,
+    0x983b, 0x6075, 0xd850, 0xdeee, 0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145,
+    0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a, 0x58b3, 0x5944,
+    0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8, 0x614e, 0x6108,
+    0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c, 0x6452, 0x6556, 0x6674, 0x6717,
+    0x671b, 0x6756, 0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e,
+    0x77a7, 0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76ca,
+    0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b, 0x7d5b, 0x7df4,
+    0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941, 0x8986, 0x8996, 0x8abf, 0x8af8,
+    0x8acb, 0x8b01, 0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199,
+    0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b, 0x9b12, 0x9f9c,
+    0xd84a, 0xdc4a, 0xd84a, 0xdc44, 0xd84c, 0xdfd5, 0x3b9d, 0x4018, 0x4039, 0xd854,
+    0xde49, 0xd857, 0xdcd0, 0xd85f, 0xded3, 0x9f43, 0x9f8e, 0x0066, 0x0066, 0x0066,
+    0x0069, 0x0066, 0x006c, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006c, 0x0073,
+    0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056b, 0x057e,
+    0x0576, 0x0574, 0x056d, 0x05d9, 0x05b4, 0x05f2, 0x05b7, 0x05e2, 0x05d0, 0x05d3,
+    0x05d4, 0x05db, 0x05dc, 0x05dd, 0x05e8, 0x05ea, 0x05e9, 0x05c1, 0x05e9, 0x05c2,
+    0x05e9, 0x05bc, 0x05c1, 0x05e9, 0x05bc, 0x05c2, 0x05d0, 0x05b7, 0x05d0, 0x05b8,
+    0x05d0, 0x05bc, 0x05d1, 0x05bc, 0x05d2, 0x05bc, 0x05d3, 0x05bc, 0x05d4, 0x05bc,
+    0x05d5, 0x05bc, 0x05d6, 0x05bc, 0x05d8, 0x05bc, 0x05d9, 0x05bc, 0x05da, 0x05bc,
+    0x05db, 0x05bc, 0x05dc, 0x05bc, 0x05de, 0x05bc, 0x05e0, 0x05bc, 0x05e1, 0x05bc,
+    0x05e3, 0x05bc, 0x05e4, 0x05bc, 0x05e6, 0x05bc, 0x05e7, 0x05bc, 0x05e8, 0x05bc,
+    0x05e9, 0x05bc, 0x05ea, 0x05bc, 0x05d5, 0x05b9, 0x05d1, 0x05bf, 0x05db, 0x05bf,
+    0x05e4, 0x05bf, 0x05d0, 0x05dc, 0x0671, 0x0671, 0x067b, 0x067b, 0x067b, 0x067b,
+    0x067e, 0x067e, 0x067e, 0x067e, 0x0680, 0x0680, 0x0680, 0x0680, 0x067a, 0x067a,
+    0x067a, 0x067a, 0x067f, 0x067f, 0x067f, 0x067f, 0x0679, 0x0679, 0x0679, 0x0679,
+    0x06a4, 0x06a4, 0x06a4, 0x06a4, 0x06a6, 0x06a6, 0x06a6, 0x06a6, 0x0684, 0x0684,
+    0x0684, 0x0684, 0x0683, 0x0683, 0x0683, 0x0683, 0x0686, 0x0686, 0x0686, 0x0686,
+    0x0687, 0x0687, 0x0687, 0x0687, 0x068d, 0x068d, 0x068c, 0x068c, 0x068e, 0x068e,
+    0x0688, 0x0688, 0x0698, 0x0698, 0x0691, 0x0691, 0x06a9, 0x06a9, 0x06a9, 0x06a9,
+    0x06af, 0x06af, 0x06af, 0x06af, 0x06b3, 0x06b3, 0x06b3, 0x06b3, 0x06b1, 0x06b1,
+    0x06b1, 0x06b1, 0x06ba, 0x06ba, 0x06bb, 0x06bb, 0x06bb, 0x06bb, 0x06d5, 0x0654,
+    0x06d5, 0x0654, 0x06c1, 0x06c1, 0x06c1, 0x06c1, 0x06be, 0x06be, 0x06be, 0x06be,
+    0x06d2, 0x06d2, 0x06d2, 0x0654, 0x06d2, 0x0654, 0x06ad, 0x06ad, 0x06ad, 0x06ad,
+    0x06c7, 0x06c7, 0x06c6, 0x06c6, 0x06c8, 0x06c8, 0x06c7, 0x0674, 0x06cb, 0x06cb,
+    0x06c5, 0x06c5, 0x06c9, 0x06c9, 0x06d0, 0x06d0, 0x06d0, 0x06d0, 0x0649, 0x0649,
+    0x064a, 0x0654, 0x0627, 0x064a, 0x0654, 0x0627, 0x064a, 0x0654, 0x06d5, 0x064a,
+    0x0654, 0x06d5, 0x064a, 0x0654, 0x0648, 0x064a, 0x0654, 0x0648, 0x064a, 0x0654,
+    0x06c7, 0x064a, 0x0654, 0x06c7, 0x064a, 0x0654, 0x06c6, 0x064a, 0x0654, 0x06c6,
+    0x064a, 0x0654, 0x06c8, 0x064a, 0x0654, 0x06c8, 0x064a, 0x0654, 0x06d0, 0x064a,
+    0x0654, 0x06d0, 0x064a, 0x0654, 0x06d0, 0x064a, 0x0654, 0x0649, 0x064a, 0x0654,
+    0x0649, 0x064a, 0x0654, 0x0649, 0x06cc, 0x06cc, 0x06cc, 0x06cc, 0x064a, 0x0654,
+    0x062c, 0x064a, 0x0654, 0x062d, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654, 0x0649,
+    0x064a, 0x0654, 0x064a, 0x0628, 0x062c, 0x0628, 0x062d, 0x0628, 0x062e, 0x0628,
+    0x0645, 0x0628, 0x0649, 0x0628, 0x064a, 0x062a, 0x062c, 0x062a, 0x062d, 0x062a,
+    0x062e, 0x062a, 0x0645, 0x062a, 0x0649, 0x062a, 0x064a, 0x062b, 0x062c, 0x062b,
+    0x0645, 0x062b, 0x0649, 0x062b, 0x064a, 0x062c, 0x062d, 0x062c, 0x0645, 0x062d,
+    0x062c, 0x062d, 0x0645, 0x062e, 0x062c, 0x062e, 0x062d, 0x062e, 0x0645, 0x0633,
+    0x062c, 0x0633, 0x062d, 0x0633, 0x062e, 0x0633, 0x0645, 0x0635, 0x062d, 0x0635,
+    0x0645, 0x0636, 0x062c, 0x0636, 0x062d, 0x0636, 0x062e, 0x0636, 0x0645, 0x0637,
+    0x062d, 0x0637, 0x0645, 0x0638, 0x0645, 0x0639, 0x062c, 0x0639, 0x0645, 0x063a,
+    0x062c, 0x063a, 0x0645, 0x0641, 0x062c, 0x0641, 0x062d, 0x0641, 0x062e, 0x0641,
+    0x0645, 0x0641, 0x0649, 0x0641, 0x064a, 0x0642, 0x062d, 0x0642, 0x0645, 0x0642,
+    0x0649, 0x0642, 0x064a, 0x0643, 0x0627, 0x0643, 0x062c, 0x0643, 0x062d, 0x0643,
+    0x062e, 0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064a, 0x0644,
+    0x062c, 0x0644, 0x062d, 0x0644, 0x062e, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644,
+    0x064a, 0x0645, 0x062c, 0x0645, 0x062d, 0x0645, 0x062e, 0x0645, 0x0645, 0x0645,
+    0x0649, 0x0645, 0x064a, 0x0646, 0x062c, 0x0646, 0x062d, 0x0646, 0x062e, 0x0646,
+    0x0645, 0x0646, 0x0649, 0x0646, 0x064a, 0x0647, 0x062c, 0x0647, 0x0645, 0x0647,
+    0x0649, 0x0647, 0x064a, 0x064a, 0x062c, 0x064a, 0x062d, 0x064a, 0x062e, 0x064a,
+    0x0645, 0x064a, 0x0649, 0x064a, 0x064a, 0x0630, 0x0670, 0x0631, 0x0670, 0x0649,
+    0x0670, 0x0020, 0x064c, 0x0651, 0x0020, 0x064d, 0x0651, 0x0020, 0x064e, 0x0651,
+    0x0020, 0x064f, 0x0651, 0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670, 0x064a,
+    0x0654, 0x0631, 0x064a, 0x0654, 0x0632, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654,
+    0x0646, 0x064a, 0x0654, 0x0649, 0x064a, 0x0654, 0x064a, 0x0628, 0x0631, 0x0628,
+    0x0632, 0x0628, 0x0645, 0x0628, 0x0646, 0x0628, 0x0649, 0x0628, 0x064a, 0x062a,
+    0x0631, 0x062a, 0x0632, 0x062a, 0x0645, 0x062a, 0x0646, 0x062a, 0x0649, 0x062a,
+    0x064a, 0x062b, 0x0631, 0x062b, 0x0632, 0x062b, 0x0645, 0x062b, 0x0646, 0x062b,
+    0x0649, 0x062b, 0x064a, 0x0641, 0x0649, 0x0641, 0x064a, 0x0642, 0x0649, 0x0642,
+    0x064a, 0x0643, 0x0627, 0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643,
+    0x064a, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064a, 0x0645, 0x0627, 0x0645,
+    0x0645, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0645, 0x0646, 0x0646, 0x0646,
+    0x0649, 0x0646, 0x064a, 0x0649, 0x0670, 0x064a, 0x0631, 0x064a, 0x0632, 0x064a,
+    0x0645, 0x064a, 0x0646, 0x064a, 0x0649, 0x064a, 0x064a, 0x064a, 0x0654, 0x062c,
+    0x064a, 0x0654, 0x062d, 0x064a, 0x0654, 0x062e, 0x064a, 0x0654, 0x0645, 0x064a,
+    0x0654, 0x0647, 0x0628, 0x062c, 0x0628, 0x062d, 0x0628, 0x062e, 0x0628, 0x0645,
+    0x0628, 0x0647, 0x062a, 0x062c, 0x062a, 0x062d, 0x062a, 0x062e, 0x062a, 0x0645,
+    0x062a, 0x0647, 0x062b, 0x0645, 0x062c, 0x062d, 0x062c, 0x0645, 0x062d, 0x062c,
+    0x062d, 0x0645, 0x062e, 0x062c, 0x062e, 0x0645, 0x0633, 0x062c, 0x0633, 0x062d,
+    0x0633, 0x062e, 0x0633, 0x0645, 0x0635, 0x062d, 0x0635, 0x062e, 0x0635, 0x0645,
+    0x0636, 0x062c, 0x0636, 0x062d, 0x0636, 0x062e, 0x0636, 0x0645, 0x0637, 0x062d,
+    0x0638, 0x0645, 0x0639, 0x062c, 0x0639, 0x0645, 0x063a, 0x062c, 0x063a, 0x0645,
+    0x0641, 0x062c, 0x0641, 0x062d, 0x0641, 0x062e, 0x0641, 0x0645, 0x0642, 0x062d,
+    0x0642, 0x0645, 0x0643, 0x062c, 0x0643, 0x062d, 0x0643, 0x062e, 0x0643, 0x0644,
+    0x0643, 0x0645, 0x0644, 0x062c, 0x0644, 0x062d, 0x0644, 0x062e, 0x0644, 0x0645,
+    0x0644, 0x0647, 0x0645, 0x062c, 0x0645, 0x062d, 0x0645, 0x062e, 0x0645, 0x0645,
+    0x0646, 0x062c, 0x0646, 0x062d, 0x0646, 0x062e, 0x0646, 0x0645, 0x0646, 0x0647,
+    0x0647, 0x062c, 0x0647, 0x0645, 0x0647, 0x0670, 0x064a, 0x062c, 0x064a, 0x062d,
+    0x064a, 0x062e, 0x064a, 0x0645, 0x064a, 0x0647, 0x064a, 0x0654, 0x0645, 0x064a,
+    0x0654, 0x0647, 0x0628, 0x0645, 0x0628, 0x0647, 0x062a, 0x0645, 0x062a, 0x0647,
+    0x062b, 0x0645, 0x062b, 0x0647, 0x0633, 0x0645, 0x0633, 0x0647, 0x0634, 0x0645,
+    0x0634, 0x0647, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x0645, 0x0646, 0x0645,
+    0x0646, 0x0647, 0x064a, 0x0645, 0x064a, 0x0647, 0x0640, 0x064e, 0x0651, 0x0640,
+    0x064f, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649, 0x0637, 0x064a, 0x0639,
+    0x0649, 0x0639, 0x064a, 0x063a, 0x0649, 0x063a, 0x064a, 0x0633, 0x0649, 0x0633,
+    0x064a, 0x0634, 0x0649, 0x0634, 0x064a, 0x062d, 0x0649, 0x062d, 0x064a, 0x062c,
+    0x0649, 0x062c, 0x064a, 0x062e, 0x0649, 0x062e, 0x064a, 0x0635, 0x0649, 0x0635,
+    0x064a, 0x0636, 0x0649, 0x0636, 0x064a, 0x0634, 0x062c, 0x0634, 0x062d, 0x0634,
+    0x062e, 0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636,
+    0x0631, 0x0637, 0x0649, 0x0637, 0x064a, 0x0639, 0x0649, 0x0639, 0x064a, 0x063a,
+    0x0649, 0x063a, 0x064a, 0x0633, 0x0649, 0x0633, 0x064a, 0x0634, 0x0649, 0x0634,
+    0x064a, 0x062d, 0x0649, 0x062d, 0x064a, 0x062c, 0x0649, 0x062c, 0x064a, 0x062e,
+    0x0649, 0x062e, 0x064a, 0x0635, 0x0649, 0x0635, 0x064a, 0x0636, 0x0649, 0x0636,
+    0x064a, 0x0634, 0x062c, 0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0634,
+    0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0634, 0x062c, 0x0634,
+    0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0633, 0x0647, 0x0634, 0x0647, 0x0637,
+    0x0645, 0x0633, 0x062c, 0x0633, 0x062d, 0x0633, 0x062e, 0x0634, 0x062c, 0x0634,
+    0x062d, 0x0634, 0x062e, 0x0637, 0x0645, 0x0638, 0x0645, 0x0627, 0x064b, 0x0627,
+    0x064b, 0x062a, 0x062c, 0x0645, 0x062a, 0x062d, 0x062c, 0x062a, 0x062d, 0x062c,
+    0x062a, 0x062d, 0x0645, 0x062a, 0x062e, 0x0645, 0x062a, 0x0645, 0x062c, 0x062a,
+    0x0645, 0x062d, 0x062a, 0x0645, 0x062e, 0x062c, 0x0645, 0x062d, 0x062c, 0x0645,
+    0x062d, 0x062d, 0x0645, 0x064a, 0x062d, 0x0645, 0x0649, 0x0633, 0x062d, 0x062c,
+    0x0633, 0x062c, 0x062d, 0x0633, 0x062c, 0x0649, 0x0633, 0x0645, 0x062d, 0x0633,
+    0x0645, 0x062d, 0x0633, 0x0645, 0x062c, 0x0633, 0x0645, 0x0645, 0x0633, 0x0645,
+    0x0645, 0x0635, 0x062d, 0x062d, 0x0635, 0x062d, 0x062d, 0x0635, 0x0645, 0x0645,
+    0x0634, 0x062d, 0x0645, 0x0634, 0x062d, 0x0645, 0x0634, 0x062c, 0x064a, 0x0634,
+    0x0645, 0x062e, 0x0634, 0x0645, 0x062e, 0x0634, 0x0645, 0x0645, 0x0634, 0x0645,
+    0x0645, 0x0636, 0x062d, 0x0649, 0x0636, 0x062e, 0x0645, 0x0636, 0x062e, 0x0645,
+    0x0637, 0x0645, 0x062d, 0x0637, 0x0645, 0x062d, 0x0637, 0x0645, 0x0645, 0x0637,
+    0x0645, 0x064a, 0x0639, 0x062c, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645,
+    0x0645, 0x0639, 0x0645, 0x0649, 0x063a, 0x0645, 0x0645, 0x063a, 0x0645, 0x064a,
+    0x063a, 0x0645, 0x0649, 0x0641, 0x062e, 0x0645, 0x0641, 0x062e, 0x0645, 0x0642,
+    0x0645, 0x062d, 0x0642, 0x0645, 0x0645, 0x0644, 0x062d, 0x0645, 0x0644, 0x062d,
+    0x064a, 0x0644, 0x062d, 0x0649, 0x0644, 0x062c, 0x062c, 0x0644, 0x062c, 0x062c,
+    0x0644, 0x062e, 0x0645, 0x0644, 0x062e, 0x0645, 0x0644, 0x0645, 0x062d, 0x0644,
+    0x0645, 0x062d, 0x0645, 0x062d, 0x062c, 0x0645, 0x062d, 0x0645, 0x0645, 0x062d,
+    0x064a, 0x0645, 0x062c, 0x062d, 0x0645, 0x062c, 0x0645, 0x0645, 0x062e, 0x062c,
+    0x0645, 0x062e, 0x0645, 0x0645, 0x062c, 0x062e, 0x0647, 0x0645, 0x062c, 0x0647,
+    0x0645, 0x0645, 0x0646, 0x062d, 0x0645, 0x0646, 0x062d, 0x0649, 0x0646, 0x062c,
+    0x0645, 0x0646, 0x062c, 0x0645, 0x0646, 0x062c, 0x0649, 0x0646, 0x0645, 0x064a,
+    0x0646, 0x0645, 0x0649, 0x064a, 0x0645, 0x0645, 0x064a, 0x0645, 0x0645, 0x0628,
+    0x062e, 0x064a, 0x062a, 0x062c, 0x064a, 0x062a, 0x062c, 0x0649, 0x062a, 0x062e,
+    0x064a, 0x062a, 0x062e, 0x0649, 0x062a, 0x0645, 0x064a, 0x062a, 0x0645, 0x0649,
+    0x062c, 0x0645, 0x064a, 0x062c, 0x062d, 0x0649, 0x062c, 0x0645, 0x0649, 0x0633,
+    0x062e, 0x0649, 0x0635, 0x062d, 0x064a, 0x0634, 0x062d, 0x064a, 0x0636, 0x062d,
+    0x064a, 0x0644, 0x062c, 0x064a, 0x0644, 0x0645, 0x064a, 0x064a, 0x062d, 0x064a,
+    0x064a, 0x062c, 0x064a, 0x064a, 0x0645, 0x064a, 0x0645, 0x0645, 0x064a, 0x0642,
+    0x0645, 0x064a, 0x0646, 0x062d, 0x064a, 0x0642, 0x0645, 0x062d, 0x0644, 0x062d,
+    0x0645, 0x0639, 0x0645, 0x064a, 0x0643, 0x0645, 0x064a, 0x0646, 0x062c, 0x062d,
+    0x0645, 0x062e, 0x064a, 0x0644, 0x062c, 0x0645, 0x0643, 0x0645, 0x0645, 0x0644,
+    0x062c, 0x0645, 0x0646, 0x062c, 0x062d, 0x062c, 0x062d, 0x064a, 0x062d, 0x062c,
+    0x064a, 0x0645, 0x062c, 0x064a, 0x0641, 0x0645, 0x064a, 0x0628, 0x062d, 0x064a,
+    0x0643, 0x0645, 0x0645, 0x0639, 0x062c, 0x0645, 0x0635, 0x0645, 0x0645, 0x0633,
+    0x062e, 0x064a, 0x0646, 0x062c, 0x064a, 0x0635, 0x0644, 0x06d2, 0x0642, 0x0644,
+    0x06d2, 0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645,
+    0x062d, 0x0645, 0x062f, 0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648,
+    0x0644, 0x0639, 0x0644, 0x064a, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635,
+    0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647,
+    0x0020, 0x0639, 0x0644, 0x064a, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645,
+    0x062c, 0x0644, 0x0020, 0x062c, 0x0644, 0x0627, 0x0644, 0x0647, 0x0020, 0x064b,
+    0x0640, 0x064b, 0x0020, 0x064c, 0x0020, 0x064d, 0x0020, 0x064e, 0x0640, 0x064e,
+    0x0020, 0x064f, 0x0640, 0x064f, 0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651,
+    0x0640, 0x0651, 0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0653, 0x0627,
+    0x0653, 0x0627, 0x0654, 0x0627, 0x0654, 0x0648, 0x0654, 0x0648, 0x0654, 0x0627,
+    0x0655, 0x0627, 0x0655, 0x064a, 0x0654, 0x064a, 0x0654, 0x064a, 0x0654, 0x064a,
+    0x0654, 0x0627, 0x0627, 0x0628, 0x0628, 0x0628, 0x0628, 0x0629, 0x0629, 0x062a,
+    0x062a, 0x062a, 0x062a, 0x062b, 0x062b, 0x062b, 0x062b, 0x062c, 0x062c, 0x062c,
+    0x062c, 0x062d, 0x062d, 0x062d, 0x062d, 0x062e, 0x062e, 0x062e, 0x062e, 0x062f,
+    0x062f, 0x0630, 0x0630, 0x0631, 0x0631, 0x0632, 0x0632, 0x0633, 0x0633, 0x0633,
+    0x0633, 0x0634, 0x0634, 0x0634, 0x0634, 0x0635, 0x0635, 0x0635, 0x0635, 0x0636,
+    0x0636, 0x0636, 0x0636, 0x0637, 0x0637, 0x0637, 0x0637, 0x0638, 0x0638, 0x0638,
+    0x0638, 0x0639, 0x0639, 0x0639, 0x0639, 0x063a, 0x063a, 0x063a, 0x063a, 0x0641,
+    0x0641, 0x0641, 0x0641, 0x0642, 0x0642, 0x0642, 0x0642, 0x0643, 0x0643, 0x0643,
+    0x0643, 0x0644, 0x0644, 0x0644, 0x0644, 0x0645, 0x0645, 0x0645, 0x0645, 0x0646,
+    0x0646, 0x0646, 0x0646, 0x0647, 0x0647, 0x0647, 0x0647, 0x0648, 0x0648, 0x0649,
+    0x0649, 0x064a, 0x064a, 0x064a, 0x064a, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627,
+    0x0653, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0655,
+    0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0644, 0x0627, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+    0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x30f2,
+    0x30a1, 0x30a3, 0x30a5, 0x30a7, 0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30c3, 0x30fc,
+    0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab, 0x30ad, 0x30af, 0x30b1, 0x30b3,
+    0x30b5, 0x30b7, 0x30b9, 0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8,
+    0x30ca, 0x30cb, 0x30cc, 0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db,
+    0x30de, 0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6, 0x30e8, 0x30e9, 0x30ea,
+    0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f3, 0x3099, 0x309a, 0x1160, 0x1100, 0x1101,
+    0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103, 0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2,
+    0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110a,
+    0x110b, 0x110c, 0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162,
+    0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116a, 0x116b, 0x116c,
+    0x116d, 0x116e, 0x116f, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x02d0,
+    0x02d1, 0x00e6, 0x0299, 0x0253, 0x02a3, 0xab66, 0x02a5, 0x02a4, 0x0256, 0x0257,
+    0x1d91, 0x0258, 0x025e, 0x02a9, 0x0264, 0x0262, 0x0260, 0x029b, 0x0127, 0x029c,
+    0x0267, 0x0284, 0x02aa, 0x02ab, 0x026c, 0xd837, 0xdf04, 0xa78e, 0x026e, 0xd837,
+    0xdf05, 0x028e, 0xd837, 0xdf06, 0x00f8, 0x0276, 0x0277, 0x0071, 0x027a, 0xd837,
+    0xdf08, 0x027d, 0x027e, 0x0280, 0x02a8, 0x02a6, 0xab67, 0x02a7, 0x0288, 0x2c71,
+    0x028f, 0x02a1, 0x02a2, 0x0298, 0x01c0, 0x01c1, 0x01c2, 0xd837, 0xdf0a, 0xd837,
+    0xdf1e, 0xd804, 0xdc99, 0xd804, 0xdcba, 0xd804, 0xdc9b, 0xd804, 0xdcba, 0xd804,
+    0xdca5, 0xd804, 0xdcba, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+    0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+    0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0069, 0x006a,
+    0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074,
+    0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e,
+    0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+    0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+    0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072,
+    0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0043,
+    0x0044, 0x0047, 0x004a, 0x004b, 0x004e, 0x004f, 0x0050, 0x0051, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064,
+    0x0066, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+    0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+    0x007a, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046, 0x0047, 0x004a, 0x004b, 0x004c,
+    0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+    0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072,
+    0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004f,
+    0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0061, 0x0062, 0x0063,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+    0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+    0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+    0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+    0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+    0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+    0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+    0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+    0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+    0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+    0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0131, 0x0237, 0x0391, 0x0392, 0x0393,
+    0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d,
+    0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+    0x03a8, 0x03a9, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8,
+    0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2,
+    0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x03b5, 0x03b8, 0x03ba,
+    0x03c6, 0x03c1, 0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+    0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1,
+    0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x03b1, 0x03b2,
+    0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc,
+    0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6,
+    0x03c7, 0x03c8, 0x03c9, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x0391,
+    0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b,
+    0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5,
+    0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6,
+    0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0,
+    0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x03b5,
+    0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
+    0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+    0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9,
+    0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba,
+    0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4,
+    0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1,
+    0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399,
+    0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3,
+    0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x03b1, 0x03b2, 0x03b3, 0x03b4,
+    0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be,
+    0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8,
+    0x03c9, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x03dc, 0x03dd, 0x0627,
+    0x0628, 0x062c, 0x062f, 0x0648, 0x0632, 0x062d, 0x0637, 0x064a, 0x0643, 0x0644,
+    0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062a,
+    0x062b, 0x062e, 0x0630, 0x0636, 0x0638, 0x063a, 0x066e, 0x06ba, 0x06a1, 0x066f,
+    0x0628, 0x062c, 0x0647, 0x062d, 0x064a, 0x0643, 0x0644, 0x0645, 0x0646, 0x0633,
+    0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062a, 0x062b, 0x062e, 0x0636, 0x063a,
+    0x062c, 0x062d, 0x064a, 0x0644, 0x0646, 0x0633, 0x0639, 0x0635, 0x0642, 0x0634,
+    0x062e, 0x0636, 0x063a, 0x06ba, 0x066f, 0x0628, 0x062c, 0x0647, 0x062d, 0x0637,
+    0x064a, 0x0643, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634,
+    0x062a, 0x062b, 0x062e, 0x0636, 0x0638, 0x063a, 0x066e, 0x06a1, 0x0627, 0x0628,
+    0x062c, 0x062f, 0x0647, 0x0648, 0x0632, 0x062d, 0x0637, 0x064a, 0x0644, 0x0645,
+    0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062a, 0x062b,
+    0x062e, 0x0630, 0x0636, 0x0638, 0x063a, 0x0628, 0x062c, 0x062f, 0x0648, 0x0632,
+    0x062d, 0x0637, 0x064a, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635,
+    0x0642, 0x0631, 0x0634, 0x062a, 0x062b, 0x062e, 0x0630, 0x0636, 0x0638, 0x063a,
+    0x4e3d, 0x4e38, 0x4e41, 0xd840, 0xdd22, 0x4f60, 0x4fae, 0x4fbb, 0x5002, 0x507a,
+    0x5099, 0x50e7, 0x50cf, 0x349e, 0xd841, 0xde3a, 0x514d, 0x5154, 0x5164, 0x5177,
+    0xd841, 0xdd1c, 0x34b9, 0x5167, 0x518d, 0xd841, 0xdd4b, 0x5197, 0x51a4, 0x4ecc,
+    0x51ac, 0x51b5, 0xd864, 0xdddf, 0x51f5, 0x5203, 0x34df, 0x523b, 0x5246, 0x5272,
+    0x5277, 0x3515, 0x52c7, 0x52c9, 0x52e4, 0x52fa, 0x5305, 0x5306, 0x5317, 0x5349,
+    0x5351, 0x535a, 0x5373, 0x537d, 0x537f, 0x537f, 0x537f, 0xd842, 0xde2c, 0x7070,
+    0x53ca, 0x53df, 0xd842, 0xdf63, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448,
+    0x5468, 0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab,
+    0x55b3, 0x55c2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58ee, 0x57ce,
+    0x57f4, 0x580d, 0x578b, 0x5832, 0x5831, 0x58ac, 0xd845, 0xdce4, 0x58f2, 0x58f7,
+    0x5906, 0x591a, 0x5922, 0x5962, 0xd845, 0xdea8, 0xd845, 0xdeea, 0x59ec, 0x5a1b,
+    0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08, 0x5b3e, 0x5b3e, 0xd846, 0xddc8,
+    0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0xd846, 0xdf18, 0x5bff, 0x5c06, 0x5f53, 0x5c22,
+    0x3781, 0x5c60, 0x5c6e, 0x5cc0, 0x5c8d, 0xd847, 0xdde4, 0x5d43, 0xd847, 0xdde6,
+    0x5d6e, 0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69,
+    0x3862, 0xd848, 0xdd83, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0xd868, 0xdf92,
+    0x5efe, 0xd848, 0xdf31, 0xd848, 0xdf31, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0xd84c,
+    0xdeb8, 0xd858, 0xddda, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9,
+    0x6081, 0x393a, 0x391c, 0x6094, 0xd849, 0xded4, 0x60c7, 0x6148, 0x614c, 0x614e,
+    0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de, 0x61f2, 0x61f6, 0x6210,
+    0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0xd84a, 0xdf0c, 0x633d, 0x62fc, 0x6368,
+    0x6383, 0x63e4, 0xd84a, 0xdff1, 0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469, 0x647e,
+    0x649d, 0x6477, 0x3a6c, 0x654f, 0x656c, 0xd84c, 0xdc0a, 0x65e3, 0x66f8, 0x6649,
+    0x3b19, 0x6691, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9,
+    0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0xd84c, 0xdfc3, 0x3b49, 0x67fa, 0x6785,
+    0x6852, 0x6885, 0xd84d, 0xdc6d, 0x688e, 0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3,
+    0x69ea, 0x6aa8, 0xd84d, 0xdea3, 0x6adb, 0x3c18, 0x6b21, 0xd84e, 0xdca7, 0x6b54,
+    0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb, 0xd84e, 0xde8d, 0xd847, 0xdd0b, 0xd84e,
+    0xdefa, 0x6c4e, 0xd84f, 0xdcbc, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e, 0x6d77,
+    0x6d41, 0x6d69, 0x6d78, 0x6d85, 0xd84f, 0xdd1e, 0x6d34, 0x6e2f, 0x6e6e, 0x3d33,
+    0x6ecb, 0x6ec7, 0xd84f, 0xded1, 0x6df9, 0x6f6e, 0xd84f, 0xdf5e, 0xd84f, 0xdf8e,
+    0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad, 0xd841,
+    0xdd25, 0x7145, 0xd850, 0xde63, 0x719c, 0xd850, 0xdfab, 0x7228, 0x7235, 0x7250,
+    0xd851, 0xde08, 0x7280, 0x7295, 0xd851, 0xdf35, 0xd852, 0xdc14, 0x737a, 0x738b,
+    0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447, 0x745c, 0x7471, 0x7485, 0x74ca, 0x3f1b,
+    0x7524, 0xd853, 0xdc36, 0x753e, 0xd853, 0xdc92, 0x7570, 0xd848, 0xdd9f, 0x7610,
+    0xd853, 0xdfa1, 0xd853, 0xdfb8, 0xd854, 0xdc44, 0x3ffc, 0x4008, 0x76f4, 0xd854,
+    0xdcf3, 0xd854, 0xdcf2, 0xd854, 0xdd19, 0xd854, 0xdd33, 0x771e, 0x771f, 0x771f,
+    0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0xd855, 0xdc1d, 0x784e, 0x788c, 0x78cc,
+    0x40e3, 0xd855, 0xde26, 0x7956, 0xd855, 0xde9a, 0xd855, 0xdec5, 0x798f, 0x79eb,
+    0x412f, 0x7a40, 0x7a4a, 0x7a4f, 0xd856, 0xdd7c, 0xd856, 0xdea7, 0xd856, 0xdea7,
+    0x7aee, 0x4202, 0xd856, 0xdfab, 0x7bc6, 0x7bc9, 0x4227, 0xd857, 0xdc80, 0x7cd2,
+    0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0xd857, 0xdf86, 0x7d63, 0x4301, 0x7dc7, 0x7e02,
+    0x7e45, 0x4334, 0xd858, 0xde28, 0xd858, 0xde47, 0x4359, 0xd858, 0xded9, 0x7f7a,
+    0xd858, 0xdf3e, 0x7f95, 0x7ffa, 0x8005, 0xd859, 0xdcda, 0xd859, 0xdd23, 0x8060,
+    0xd859, 0xdda8, 0x8070, 0xd84c, 0xdf5f, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e,
+    0x5ab5, 0xd859, 0xdfa7, 0xd859, 0xdfb5, 0xd84c, 0xdf93, 0xd84c, 0xdf9c, 0x8201,
+    0x8204, 0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd,
+    0x82e6, 0xd85a, 0xdf3c, 0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7,
+    0x8457, 0x8353, 0x83ca, 0x83cc, 0x83dc, 0xd85b, 0xdc36, 0xd85b, 0xdd6b, 0xd85b,
+    0xdcd5, 0x452b, 0x84f1, 0x84f3, 0x8516, 0xd85c, 0xdfca, 0x8564, 0xd85b, 0xdf2c,
+    0x455d, 0x4561, 0xd85b, 0xdfb1, 0xd85c, 0xdcd2, 0x456b, 0x8650, 0x865c, 0x8667,
+    0x8669, 0x86a9, 0x8688, 0x870e, 0x86e2, 0x8779, 0x8728, 0x876b, 0x8786, 0x45d7,
+    0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0xd85d, 0xde67, 0x88d7, 0x88de, 0x4635,
+    0x88fa, 0x34bb, 0xd85e, 0xdcae, 0xd85e, 0xdd66, 0x46be, 0x46c7, 0x8aa0, 0x8aed,
+    0x8b8a, 0x8c55, 0xd85f, 0xdca8, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0xd85f, 0xdf2f,
+    0xd842, 0xdc04, 0x8dcb, 0x8dbc, 0x8df0, 0xd842, 0xdcde, 0x8ed4, 0x8f38, 0xd861,
+    0xddd2, 0xd861, 0xdded, 0x9094, 0x90f1, 0x9111, 0xd861, 0xdf2e, 0x911b, 0x9238,
+    0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0xd862, 0xdffa, 0x958b, 0x4995, 0x95b7,
+    0xd863, 0xdd77, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0xd864, 0xdd45, 0xd864, 0xde1a,
+    0x4a6e, 0x4a76, 0x97e0, 0xd865, 0xdc0a, 0x4ab2, 0xd865, 0xdc96, 0x980b, 0x980b,
+    0x9829, 0xd865, 0xddb6, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce,
+    0xd866, 0xdf30, 0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0xd868, 0xdcce,
+    0x4cf8, 0xd868, 0xdd05, 0xd868, 0xde0e, 0xd868, 0xde91, 0x9ebb, 0x4d56, 0x9ef9,
+    0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b, 0xd869, 0xde00,
+};
+
+} // namespace unicode
+} // namespace matcher
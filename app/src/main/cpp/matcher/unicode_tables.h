@@ -0,0 +1,51 @@
+#ifndef DICIO_MATCHER_UNICODE_TABLES_H
+#define DICIO_MATCHER_UNICODE_TABLES_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace matcher {
+namespace unicode {
+
+// 以下表由 gen_unicode_tables.py 生成（unicode_tables.cpp），修改后需要重新生成
+
+struct Range {
+    uint32_t first;
+    uint32_t last; // 包含
+};
+
+struct Mapping {
+    uint32_t from;
+    uint32_t to;
+};
+
+struct Fold {
+    uint32_t codePoint;
+    uint16_t offset; // 在FOLD_DATA中的起始下标
+    uint8_t length;  // UTF-16码元数，可以为0
+};
+
+// NFKD展开后最长的折叠结果（UTF-16码元），用于预先分配输出缓冲区
+constexpr int32_t MAX_FOLD_LENGTH = 18;
+
+// BMP中每个码位一位: \p{L}，以及Lu/Ll/Lt（final sigma判断用）
+extern const uint32_t LETTER_BMP[2048];
+extern const uint32_t CASED_BMP[2048];
+
+// 辅助平面中的\p{L}区间，按码位排序
+extern const Range LETTER_SUPPLEMENTARY[];
+extern const size_t LETTER_SUPPLEMENTARY_COUNT;
+
+// 单码位的小写映射（不包括U+0130），按码位排序
+extern const Mapping LOWERCASE[];
+extern const size_t LOWERCASE_COUNT;
+
+// 字母的NFKD分解去掉U+0300..U+036F之后的结果（不包括韩文音节，算法分解），按码位排序
+extern const Fold FOLD[];
+extern const size_t FOLD_COUNT;
+extern const char16_t FOLD_DATA[];
+
+} // namespace unicode
+} // namespace matcher
+
+#endif // DICIO_MATCHER_UNICODE_TABLES_H
@@ -0,0 +1,146 @@
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace matcher {
+
+namespace {
+constexpr size_t MAX_SHARED_WORKERS = 4;
+}
+
+WorkStealingPool::WorkStealingPool(size_t threadCount) {
+    for (size_t i = 0; i < threadCount + 1; ++i) {
+        queues_.emplace_back(new Queue());
+    }
+    for (size_t i = 1; i <= threadCount; ++i) {
+        threads_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+}
+
+WorkStealingPool &WorkStealingPool::shared() {
+    static WorkStealingPool pool([] {
+        size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+        return std::min(cores, MAX_SHARED_WORKERS) - 1;
+    }());
+    return pool;
+}
+
+void WorkStealingPool::parallelFor(size_t count, const Task &task) {
+    if (count == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+    if (threads_.empty() || count == 1) {
+        // 没有后台线程或只有一个任务时，直接在调用线程执行，避免唤醒开销
+        for (size_t i = 0; i < count; ++i) {
+            task(i, 0);
+        }
+        return;
+    }
+
+    // 轮流分配到各个队列，之后由窃取来平衡负载
+    for (size_t i = 0; i < count; ++i) {
+        Queue &queue = *queues_[i % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.indices.push_back(i);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        task_ = &task;
+        remaining_.store(count, std::memory_order_relaxed);
+        ++generation_;
+    }
+    workAvailable_.notify_all();
+
+    while (runOne(0, task)) {
+    }
+
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    workDone_.wait(lock, [this] {
+        return remaining_.load(std::memory_order_acquire) == 0 && activeWorkers_ == 0;
+    });
+    task_ = nullptr;
+}
+
+bool WorkStealingPool::runOne(size_t worker, const Task &task) {
+    size_t index = 0;
+    bool found = false;
+
+    {
+        Queue &own = *queues_[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.indices.empty()) {
+            index = own.indices.back();
+            own.indices.pop_back();
+            found = true;
+        }
+    }
+
+    for (size_t i = 1; !found && i < queues_.size(); ++i) {
+        Queue &victim = *queues_[(worker + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.indices.empty()) {
+            index = victim.indices.front();
+            victim.indices.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    task(index, worker);
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        workDone_.notify_all();
+    }
+    return true;
+}
+
+void WorkStealingPool::workerLoop(size_t worker) {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        const Task *task;
+        {
+            std::unique_lock<std::mutex> lock(stateMutex_);
+            workAvailable_.wait(lock, [this, seenGeneration] {
+                return stopping_ || generation_ != seenGeneration;
+            });
+            if (stopping_) {
+                return;
+            }
+            seenGeneration = generation_;
+            task = task_;
+            if (task == nullptr) {
+                // 醒得太晚，这一批任务已经结束了
+                continue;
+            }
+            ++activeWorkers_;
+        }
+
+        while (runOne(worker, *task)) {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            --activeWorkers_;
+        }
+        workDone_.notify_all();
+    }
+}
+
+} // namespace matcher
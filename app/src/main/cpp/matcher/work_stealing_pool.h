@@ -0,0 +1,75 @@
+#ifndef DICIO_MATCHER_WORK_STEALING_POOL_H
+#define DICIO_MATCHER_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace matcher {
+
+/**
+ * 常驻的小型工作窃取线程池。每个工作者（包括调用parallelFor的线程，编号为0）
+ * 拥有自己的任务队列：从自己队列的尾部取任务，空了就从其他队列的头部窃取，
+ * 这样句子长短不一时各个核心也能保持忙碌。
+ * 同一时刻只执行一个parallelFor，并发调用会排队。
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void(size_t index, size_t worker)>;
+
+    /**
+     * @param threadCount 后台线程数，调用线程也会参与执行，所以总并发为threadCount+1
+     */
+    explicit WorkStealingPool(size_t threadCount);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    /**
+     * 对 [0, count) 中的每个下标执行一次task，所有任务完成后返回。
+     * task的worker参数在 [0, workerCount()) 之间，可用于索引线程私有的缓冲区。
+     */
+    void parallelFor(size_t count, const Task &task);
+
+    size_t workerCount() const { return queues_.size(); }
+
+    /**
+     * 进程级共享实例，后台线程数为 min(CPU核数, 4) - 1
+     */
+    static WorkStealingPool &shared();
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> indices;
+    };
+
+    void workerLoop(size_t worker);
+    bool runOne(size_t worker, const Task &task);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::mutex submitMutex_; // 串行化parallelFor
+    std::mutex stateMutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable workDone_;
+    const Task *task_ = nullptr;
+    uint64_t generation_ = 0;
+    std::atomic<size_t> remaining_{0};
+    // 正在执行当前批次的后台线程数，归零后parallelFor才能返回，避免线程拿着旧任务执行新批次
+    size_t activeWorkers_ = 0;
+    bool stopping_ = false;
+};
+
+} // namespace matcher
+
+#endif // DICIO_MATCHER_WORK_STEALING_POOL_H
@@ -0,0 +1,238 @@
+#include <jni.h>
+#include <android/log.h>
+#include <string>
+#include <vector>
+
+#include "matcher/batch_scorer.h"
+#include "matcher/grammar.h"
+#include "matcher/result_cache.h"
+#include "matcher/match_input.h"
+#include "matcher/tokenizer.h"
+
+#define LOG_TAG "SkillMatcherJNI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+using matcher::BatchScorer;
+using matcher::Grammar;
+using matcher::MatchInput;
+using matcher::PruningStats;
+using matcher::ResultCache;
+using matcher::ResultCacheStats;
+using matcher::SkillResult;
+using matcher::Tokenization;
+using matcher::Tokenizer;
+using matcher::Vocabulary;
+
+namespace {
+
+std::vector<int32_t> toVector(JNIEnv *env, jintArray array) {
+    std::vector<int32_t> result(array ? env->GetArrayLength(array) : 0);
+    if (!result.empty()) {
+        env->GetIntArrayRegion(array, 0, (jsize) result.size(), result.data());
+    }
+    return result;
+}
+
+std::vector<float> toVector(JNIEnv *env, jfloatArray array) {
+    std::vector<float> result(array ? env->GetArrayLength(array) : 0);
+    if (!result.empty()) {
+        env->GetFloatArrayRegion(array, 0, (jsize) result.size(), result.data());
+    }
+    return result;
+}
+
+std::vector<std::string> toVector(JNIEnv *env, jobjectArray array) {
+    std::vector<std::string> result;
+    jsize size = array ? env->GetArrayLength(array) : 0;
+    result.reserve(size);
+    for (jsize i = 0; i < size; ++i) {
+        jstring string = (jstring) env->GetObjectArrayElement(array, i);
+        const char *chars = string ? env->GetStringUTFChars(string, nullptr) : nullptr;
+        result.emplace_back(chars ? chars : "");
+        if (chars) {
+            env->ReleaseStringUTFChars(string, chars);
+        }
+        env->DeleteLocalRef(string);
+    }
+    return result;
+}
+
+bool checkOutput(JNIEnv *env, const Grammar &grammar,
+                 jintArray outSentences, jfloatArray outScores) {
+    const jsize skillCount = (jsize) grammar.skillCount();
+    return env->GetArrayLength(outSentences) >= skillCount
+            && env->GetArrayLength(outScores) >= skillCount * 4;
+}
+
+void writeResults(JNIEnv *env, const std::vector<SkillResult> &results,
+                  jintArray outSentences, jfloatArray outScores) {
+    const jsize skillCount = (jsize) results.size();
+    std::vector<jint> sentences(skillCount);
+    std::vector<jfloat> scores(skillCount * 4);
+    for (jsize i = 0; i < skillCount; ++i) {
+        // 被剪枝的技能不可能胜出，用-1标记
+        sentences[i] = results[i].pruned ? -1 : results[i].sentence;
+        scores[i * 4] = results[i].score.userMatched;
+        scores[i * 4 + 1] = results[i].score.userWeight;
+        scores[i * 4 + 2] = results[i].score.refMatched;
+        scores[i * 4 + 3] = results[i].score.refWeight;
+    }
+    env->SetIntArrayRegion(outSentences, 0, skillCount, sentences.data());
+    env->SetFloatArrayRegion(outScores, 0, skillCount * 4, scores.data());
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_compileGrammar(JNIEnv *env, jobject thiz,
+                                                             jintArray nodes, jfloatArray weights,
+                                                             jobjectArray strings,
+                                                             jintArray sentenceRoots,
+                                                             jintArray skillSentenceCounts) {
+    std::vector<int32_t> encoded = toVector(env, nodes);
+    std::vector<float> weightValues = toVector(env, weights);
+    std::vector<std::string> stringValues = toVector(env, strings);
+    std::vector<int32_t> roots = toVector(env, sentenceRoots);
+    std::vector<int32_t> counts = toVector(env, skillSentenceCounts);
+
+    Grammar *grammar = Grammar::parse(encoded.data(), encoded.size(),
+                                      weightValues.data(), weightValues.size(), stringValues,
+                                      roots.data(), roots.size(), counts.data(), counts.size());
+    if (grammar == nullptr) {
+        LOGE("❌ 语法编译失败: nodes=%zu, sentences=%zu, skills=%zu",
+             encoded.size(), roots.size(), counts.size());
+        return 0;
+    }
+    LOGI("✅ 语法编译成功: %zu个技能, %zu个句子", grammar->skillCount(), grammar->sentenceCount());
+    return (jlong) grammar;
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_destroyGrammar(JNIEnv *env, jobject thiz,
+                                                             jlong grammarPtr) {
+    delete (Grammar *) grammarPtr;
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_createInput(JNIEnv *env, jobject thiz,
+                                                          jstring text) {
+    if (!text) {
+        LOGE("❌ createInput: 输入为空");
+        return 0;
+    }
+
+    // 每个线程复用同一组缓冲区，分词过程本身不分配内存
+    thread_local std::vector<jchar> chars;
+    thread_local Tokenization tokens;
+
+    const jsize length = env->GetStringLength(text);
+    chars.resize(length);
+    if (length > 0) {
+        env->GetStringRegion(text, 0, length, chars.data());
+    }
+    Tokenizer::tokenize(reinterpret_cast<const char16_t *>(chars.data()), length,
+                        &Vocabulary::instance(), tokens);
+    return (jlong) new MatchInput(tokens);
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_destroyInput(JNIEnv *env, jobject thiz,
+                                                           jlong inputPtr) {
+    delete (MatchInput *) inputPtr;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_scoreGrammar(JNIEnv *env, jobject thiz,
+                                                           jlong grammarPtr, jlong inputPtr,
+                                                           jintArray outSentences,
+                                                           jfloatArray outScores) {
+    Grammar *grammar = (Grammar *) grammarPtr;
+    MatchInput *input = (MatchInput *) inputPtr;
+    if (!grammar || !input || !outSentences || !outScores) {
+        LOGE("❌ scoreGrammar: 无效参数");
+        return -1;
+    }
+
+    if (!checkOutput(env, *grammar, outSentences, outScores)) {
+        LOGE("❌ scoreGrammar: 输出缓冲区太小 skills=%zu", grammar->skillCount());
+        return -1;
+    }
+
+    std::vector<SkillResult> results;
+    BatchScorer::shared().scoreAll(*grammar, *input, results);
+    writeResults(env, results, outSentences, outScores);
+    return (jint) results.size();
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_createResultCache(JNIEnv *env, jobject thiz,
+                                                                jlong grammarPtr,
+                                                                jboolean pruneSkills) {
+    Grammar *grammar = (Grammar *) grammarPtr;
+    if (!grammar) {
+        LOGE("❌ createResultCache: 无效的语法");
+        return 0;
+    }
+    return (jlong) new ResultCache(*grammar, BatchScorer::shared(), pruneSkills);
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_destroyResultCache(JNIEnv *env, jobject thiz,
+                                                                 jlong cachePtr) {
+    delete (ResultCache *) cachePtr;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_scoreCached(JNIEnv *env, jobject thiz,
+                                                          jlong grammarPtr,
+                                                          jlong cachePtr,
+                                                          jlong inputPtr,
+                                                          jintArray outSentences,
+                                                          jfloatArray outScores) {
+    Grammar *grammar = (Grammar *) grammarPtr;
+    ResultCache *cache = (ResultCache *) cachePtr;
+    MatchInput *input = (MatchInput *) inputPtr;
+    if (!grammar || !cache || !input || !outSentences || !outScores) {
+        LOGE("❌ scoreCached: 无效参数");
+        return -1;
+    }
+    if (!checkOutput(env, *grammar, outSentences, outScores)) {
+        LOGE("❌ scoreCached: 输出缓冲区太小 skills=%zu", grammar->skillCount());
+        return -1;
+    }
+
+    std::vector<SkillResult> results;
+    cache->score(*input, results);
+    writeResults(env, results, outSentences, outScores);
+    return (jint) results.size();
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_resultCacheStats(JNIEnv *env, jobject thiz,
+                                                               jlong cachePtr,
+                                                               jlongArray outStats) {
+    ResultCache *cache = (ResultCache *) cachePtr;
+    if (!cache || !outStats || env->GetArrayLength(outStats) < 2) {
+        return;
+    }
+    ResultCacheStats stats = cache->stats();
+    jlong values[2] = {(jlong) stats.hits, (jlong) stats.misses};
+    env->SetLongArrayRegion(outStats, 0, 2, values);
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_eval_NativeSkillMatcher_pruningStats(JNIEnv *env, jobject thiz,
+                                                           jlongArray outStats) {
+    if (!outStats || env->GetArrayLength(outStats) < 3) {
+        return;
+    }
+    PruningStats stats = BatchScorer::shared().stats();
+    jlong values[3] = {(jlong) stats.sentencesScored, (jlong) stats.sentencesPruned,
+                       (jlong) stats.skillsPruned};
+    env->SetLongArrayRegion(outStats, 0, 3, values);
+}
+
+} // extern "C"
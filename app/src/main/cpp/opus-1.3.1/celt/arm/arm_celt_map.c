@@ -29,6 +29,7 @@
 #include "config.h"
 #endif
 
+#include "celt_lpc.h"
 #include "pitch.h"
 #include "kiss_fft.h"
 #include "mdct.h"
@@ -92,6 +93,32 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   xcorr_kernel_neon_fixed,       /* Neon */
 };
 
+void (*const CELT_FIR_IMPL[OPUS_ARCHMASK+1])(const opus_val16 *x,
+      const opus_val16 *num, opus_val16 *y, int N, int ord, int arch) = {
+  celt_fir_c,                    /* ARMv4 */
+  celt_fir_c,                    /* EDSP */
+  celt_fir_c,                    /* Media */
+  celt_fir_neon,                 /* Neon */
+};
+
+void (*const CELT_IIR_IMPL[OPUS_ARCHMASK+1])(const opus_val32 *x,
+      const opus_val16 *den, opus_val32 *y, int N, int ord, opus_val16 *mem,
+      int arch) = {
+  celt_iir_c,                    /* ARMv4 */
+  celt_iir_c,                    /* EDSP */
+  celt_iir_c,                    /* Media */
+  celt_iir_neon,                 /* Neon */
+};
+
+int (*const CELT_AUTOCORR_IMPL[OPUS_ARCHMASK+1])(const opus_val16 *x,
+      opus_val32 *ac, const opus_val16 *window, int overlap, int lag, int n,
+      int arch) = {
+  _celt_autocorr_c,              /* ARMv4 */
+  _celt_autocorr_c,              /* EDSP */
+  _celt_autocorr_c,              /* Media */
+  _celt_autocorr_neon,           /* Neon */
+};
+
 #endif
 
 # if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
@@ -0,0 +1,93 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined(CELT_LPC_ARM_H)
+# define CELT_LPC_ARM_H
+
+# include "armcpu.h"
+
+# if defined(FIXED_POINT) && defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+void celt_fir_neon(
+         const opus_val16 *x,
+         const opus_val16 *num,
+         opus_val16 *y,
+         int N,
+         int ord,
+         int arch);
+
+void celt_iir_neon(
+         const opus_val32 *x,
+         const opus_val16 *den,
+         opus_val32 *y,
+         int N,
+         int ord,
+         opus_val16 *mem,
+         int arch);
+
+int _celt_autocorr_neon(
+         const opus_val16 *x,
+         opus_val32 *ac,
+         const opus_val16 *window,
+         int overlap,
+         int lag,
+         int n,
+         int arch);
+
+#  if defined(OPUS_HAVE_RTCD) && !defined(OPUS_ARM_PRESUME_NEON_INTR)
+extern void (*const CELT_FIR_IMPL[OPUS_ARCHMASK+1])(const opus_val16 *x,
+      const opus_val16 *num, opus_val16 *y, int N, int ord, int arch);
+#   define OVERRIDE_CELT_FIR (1)
+#   define celt_fir(x, num, y, N, ord, arch) \
+  ((*CELT_FIR_IMPL[(arch)&OPUS_ARCHMASK])(x, num, y, N, ord, arch))
+
+extern void (*const CELT_IIR_IMPL[OPUS_ARCHMASK+1])(const opus_val32 *x,
+      const opus_val16 *den, opus_val32 *y, int N, int ord, opus_val16 *mem, int arch);
+#   define OVERRIDE_CELT_IIR (1)
+#   define celt_iir(x, den, y, N, ord, mem, arch) \
+  ((*CELT_IIR_IMPL[(arch)&OPUS_ARCHMASK])(x, den, y, N, ord, mem, arch))
+
+extern int (*const CELT_AUTOCORR_IMPL[OPUS_ARCHMASK+1])(const opus_val16 *x,
+      opus_val32 *ac, const opus_val16 *window, int overlap, int lag, int n, int arch);
+#   define OVERRIDE_CELT_AUTOCORR (1)
+#   define _celt_autocorr(x, ac, window, overlap, lag, n, arch) \
+  ((*CELT_AUTOCORR_IMPL[(arch)&OPUS_ARCHMASK])(x, ac, window, overlap, lag, n, arch))
+
+#  elif defined(OPUS_ARM_PRESUME_NEON_INTR)
+#   define OVERRIDE_CELT_FIR (1)
+#   define celt_fir(x, num, y, N, ord, arch) \
+  ((void)(arch), celt_fir_neon(x, num, y, N, ord, arch))
+
+#   define OVERRIDE_CELT_IIR (1)
+#   define celt_iir(x, den, y, N, ord, mem, arch) \
+  ((void)(arch), celt_iir_neon(x, den, y, N, ord, mem, arch))
+
+#   define OVERRIDE_CELT_AUTOCORR (1)
+#   define _celt_autocorr(x, ac, window, overlap, lag, n, arch) \
+  ((void)(arch), _celt_autocorr_neon(x, ac, window, overlap, lag, n, arch))
+#  endif
+# endif
+
+#endif
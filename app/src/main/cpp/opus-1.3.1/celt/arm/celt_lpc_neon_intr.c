@@ -0,0 +1,361 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "celt_lpc.h"
+#include "stack_alloc.h"
+#include "mathops.h"
+#include "pitch.h"
+
+#if defined(FIXED_POINT)
+
+void celt_fir_neon(const opus_val16 *x,
+         const opus_val16 *num,
+         opus_val16 *y,
+         int N,
+         int ord,
+         int arch)
+{
+   int i,j;
+   VARDECL(opus_val16, rnum);
+   SAVE_STACK;
+   celt_assert(x != y);
+   ALLOC(rnum, ord, opus_val16);
+   for(i=0;i<ord;i++)
+      rnum[i] = num[ord-i-1];
+   for (i=0;i<N-7;i+=8)
+   {
+      int16x8_t xj;
+      int32x4_t sum_lo, sum_hi;
+      xj = vld1q_s16(x+i);
+      sum_lo = vshll_n_s16(vget_low_s16(xj), SIG_SHIFT);
+      sum_hi = vshll_n_s16(vget_high_s16(xj), SIG_SHIFT);
+      for (j=0;j<ord;j++)
+      {
+         xj = vld1q_s16(x+i+j-ord);
+         sum_lo = vmlal_n_s16(sum_lo, vget_low_s16(xj), rnum[j]);
+         sum_hi = vmlal_n_s16(sum_hi, vget_high_s16(xj), rnum[j]);
+      }
+      /* Rounds like PSHR32() and saturates, as celt_fir_sse4_1() does */
+      vst1q_s16(y+i, vcombine_s16(vqrshrn_n_s32(sum_lo, SIG_SHIFT),
+                                  vqrshrn_n_s32(sum_hi, SIG_SHIFT)));
+   }
+   for (;i<N;i++)
+   {
+      opus_val32 sum = SHL32(EXTEND32(x[i]), SIG_SHIFT);
+      for (j=0;j<ord;j++)
+         sum = MAC16_16(sum,rnum[j],x[i+j-ord]);
+      y[i] = SATURATE16(PSHR32(sum, SIG_SHIFT));
+   }
+   RESTORE_STACK;
+   (void)arch;
+}
+
+/* Adds tap k to the sums of the 8-output block, the past outputs it applies
+   to being a window of the 16 in lo and hi, which start at tap k&~7 */
+#define IIR_TAP(lo, hi, k) do { \
+   int16x8_t w_ = vextq_s16(lo, hi, (k)&7); \
+   sum_lo = vmlal_n_s16(sum_lo, vget_low_s16(w_), rden[k]); \
+   sum_hi = vmlal_n_s16(sum_hi, vget_high_s16(w_), rden[k]); \
+} while (0)
+
+void celt_iir_neon(const opus_val32 *_x,
+         const opus_val16 *den,
+         opus_val32 *_y,
+         int N,
+         int ord,
+         opus_val16 *mem,
+         int arch)
+{
+   int i,j;
+   opus_val16 rden[LPC_ORDER];
+   opus_val16 y[LPC_ORDER+16];
+   opus_val16 *yptr;
+   int16x8_t y_0, y_8, y_16;
+
+   if (ord != LPC_ORDER)
+   {
+      celt_iir_c(_x, den, _y, N, ord, mem, arch);
+      return;
+   }
+   for(i=0;i<LPC_ORDER;i++)
+      rden[i] = den[LPC_ORDER-i-1];
+   for(i=0;i<LPC_ORDER;i++)
+      y[i] = -mem[LPC_ORDER-i-1];
+   for(;i<LPC_ORDER+16;i++)
+      y[i]=0;
+   /* The last 24 outputs stay in registers: storing them one at a time and
+      reading them back as vectors would stall on every block */
+   y_0 = vld1q_s16(y);
+   y_8 = vld1q_s16(y+8);
+   y_16 = vld1q_s16(y+16);
+   for (i=0;i<N-7;i+=8)
+   {
+      /* Unroll by 8 as if it were an FIR filter */
+      opus_val32 sum[8];
+      opus_val16 y0, y1, y2, y3, y4, y5, y6, y7;
+      int32x4_t sum_lo, sum_hi;
+      const int16x8_t zero = vdupq_n_s16(0);
+      sum_lo = vld1q_s32(_x+i);
+      sum_hi = vld1q_s32(_x+i+4);
+      IIR_TAP(y_0, y_8, 0);
+      IIR_TAP(y_0, y_8, 1);
+      IIR_TAP(y_0, y_8, 2);
+      IIR_TAP(y_0, y_8, 3);
+      IIR_TAP(y_0, y_8, 4);
+      IIR_TAP(y_0, y_8, 5);
+      IIR_TAP(y_0, y_8, 6);
+      IIR_TAP(y_0, y_8, 7);
+      IIR_TAP(y_8, y_16, 8);
+      IIR_TAP(y_8, y_16, 9);
+      IIR_TAP(y_8, y_16, 10);
+      IIR_TAP(y_8, y_16, 11);
+      IIR_TAP(y_8, y_16, 12);
+      IIR_TAP(y_8, y_16, 13);
+      IIR_TAP(y_8, y_16, 14);
+      IIR_TAP(y_8, y_16, 15);
+      IIR_TAP(y_16, zero, 16);
+      IIR_TAP(y_16, zero, 17);
+      IIR_TAP(y_16, zero, 18);
+      IIR_TAP(y_16, zero, 19);
+      IIR_TAP(y_16, zero, 20);
+      IIR_TAP(y_16, zero, 21);
+      IIR_TAP(y_16, zero, 22);
+      IIR_TAP(y_16, zero, 23);
+      vst1q_s32(sum, sum_lo);
+      vst1q_s32(sum+4, sum_hi);
+
+      /* Patch up the result to compensate for the fact that this is an IIR.
+         The most recent output goes last, so that only one MAC waits for it. */
+      y0 = -SROUND16(sum[0],SIG_SHIFT);
+      _y[i+0] = sum[0];
+      sum[1] = MAC16_16(sum[1], y0, den[0]);
+      y1 = -SROUND16(sum[1],SIG_SHIFT);
+      _y[i+1] = sum[1];
+      sum[2] = MAC16_16(sum[2], y0, den[1]);
+      sum[2] = MAC16_16(sum[2], y1, den[0]);
+      y2 = -SROUND16(sum[2],SIG_SHIFT);
+      _y[i+2] = sum[2];
+      sum[3] = MAC16_16(sum[3], y0, den[2]);
+      sum[3] = MAC16_16(sum[3], y1, den[1]);
+      sum[3] = MAC16_16(sum[3], y2, den[0]);
+      y3 = -SROUND16(sum[3],SIG_SHIFT);
+      _y[i+3] = sum[3];
+      sum[4] = MAC16_16(sum[4], y0, den[3]);
+      sum[4] = MAC16_16(sum[4], y1, den[2]);
+      sum[4] = MAC16_16(sum[4], y2, den[1]);
+      sum[4] = MAC16_16(sum[4], y3, den[0]);
+      y4 = -SROUND16(sum[4],SIG_SHIFT);
+      _y[i+4] = sum[4];
+      sum[5] = MAC16_16(sum[5], y0, den[4]);
+      sum[5] = MAC16_16(sum[5], y1, den[3]);
+      sum[5] = MAC16_16(sum[5], y2, den[2]);
+      sum[5] = MAC16_16(sum[5], y3, den[1]);
+      sum[5] = MAC16_16(sum[5], y4, den[0]);
+      y5 = -SROUND16(sum[5],SIG_SHIFT);
+      _y[i+5] = sum[5];
+      sum[6] = MAC16_16(sum[6], y0, den[5]);
+      sum[6] = MAC16_16(sum[6], y1, den[4]);
+      sum[6] = MAC16_16(sum[6], y2, den[3]);
+      sum[6] = MAC16_16(sum[6], y3, den[2]);
+      sum[6] = MAC16_16(sum[6], y4, den[1]);
+      sum[6] = MAC16_16(sum[6], y5, den[0]);
+      y6 = -SROUND16(sum[6],SIG_SHIFT);
+      _y[i+6] = sum[6];
+      sum[7] = MAC16_16(sum[7], y0, den[6]);
+      sum[7] = MAC16_16(sum[7], y1, den[5]);
+      sum[7] = MAC16_16(sum[7], y2, den[4]);
+      sum[7] = MAC16_16(sum[7], y3, den[3]);
+      sum[7] = MAC16_16(sum[7], y4, den[2]);
+      sum[7] = MAC16_16(sum[7], y5, den[1]);
+      sum[7] = MAC16_16(sum[7], y6, den[0]);
+      y7 = -SROUND16(sum[7],SIG_SHIFT);
+      _y[i+7] = sum[7];
+
+      y_0 = y_8;
+      y_8 = y_16;
+      y_16 = vsetq_lane_s16(y0, y_16, 0);
+      y_16 = vsetq_lane_s16(y1, y_16, 1);
+      y_16 = vsetq_lane_s16(y2, y_16, 2);
+      y_16 = vsetq_lane_s16(y3, y_16, 3);
+      y_16 = vsetq_lane_s16(y4, y_16, 4);
+      y_16 = vsetq_lane_s16(y5, y_16, 5);
+      y_16 = vsetq_lane_s16(y6, y_16, 6);
+      y_16 = vsetq_lane_s16(y7, y_16, 7);
+   }
+   /* Whatever is left goes through the same 4-output block and scalar loop as
+      in celt_iir_c() */
+   vst1q_s16(y, y_0);
+   vst1q_s16(y+8, y_8);
+   vst1q_s16(y+16, y_16);
+   yptr = y;
+   if (i<N-3)
+   {
+      opus_val32 sum[4];
+      sum[0]=_x[i];
+      sum[1]=_x[i+1];
+      sum[2]=_x[i+2];
+      sum[3]=_x[i+3];
+      xcorr_kernel(rden, yptr, sum, LPC_ORDER, arch);
+      yptr[LPC_ORDER  ] = -SROUND16(sum[0],SIG_SHIFT);
+      _y[i  ] = sum[0];
+      sum[1] = MAC16_16(sum[1], yptr[LPC_ORDER  ], den[0]);
+      yptr[LPC_ORDER+1] = -SROUND16(sum[1],SIG_SHIFT);
+      _y[i+1] = sum[1];
+      sum[2] = MAC16_16(sum[2], yptr[LPC_ORDER+1], den[0]);
+      sum[2] = MAC16_16(sum[2], yptr[LPC_ORDER  ], den[1]);
+      yptr[LPC_ORDER+2] = -SROUND16(sum[2],SIG_SHIFT);
+      _y[i+2] = sum[2];
+      sum[3] = MAC16_16(sum[3], yptr[LPC_ORDER+2], den[0]);
+      sum[3] = MAC16_16(sum[3], yptr[LPC_ORDER+1], den[1]);
+      sum[3] = MAC16_16(sum[3], yptr[LPC_ORDER  ], den[2]);
+      yptr[LPC_ORDER+3] = -SROUND16(sum[3],SIG_SHIFT);
+      _y[i+3] = sum[3];
+      i+=4;
+      yptr+=4;
+   }
+   for (;i<N;i++,yptr++)
+   {
+      opus_val32 sum = _x[i];
+      for (j=0;j<LPC_ORDER;j++)
+         sum -= MULT16_16(rden[j],yptr[j]);
+      yptr[LPC_ORDER] = SROUND16(sum,SIG_SHIFT);
+      _y[i] = sum;
+   }
+   for(i=0;i<LPC_ORDER;i++)
+      mem[i] = _y[N-i-1];
+}
+
+#undef IIR_TAP
+
+int _celt_autocorr_neon(
+                   const opus_val16 *x,   /*  in: [0...n-1] samples x   */
+                   opus_val32       *ac,  /* out: [0...lag-1] ac values */
+                   const opus_val16       *window,
+                   int          overlap,
+                   int          lag,
+                   int          n,
+                   int          arch
+                  )
+{
+   int i;
+   int shift;
+   opus_val32 ac0;
+   VARDECL(opus_val16, xx);
+   SAVE_STACK;
+   /* Zero-padded by lag samples so that the correlation of the last samples,
+      done separately in _celt_autocorr_c(), is part of the same xcorr */
+   ALLOC(xx, n+lag, opus_val16);
+   celt_assert(n>0);
+   celt_assert(overlap>=0);
+   OPUS_COPY(xx, x, n);
+   i = 0;
+   if (2*overlap <= n)
+   {
+      /* VQDMULH is MULT16_16_Q15() except for -32768*-32768, and the window
+         is never negative */
+      for (;i<overlap-7;i+=8)
+      {
+         int16x8_t w, w_rev;
+         w = vld1q_s16(window+i);
+         w_rev = vrev64q_s16(w);
+         w_rev = vcombine_s16(vget_high_s16(w_rev), vget_low_s16(w_rev));
+         vst1q_s16(xx+i, vqdmulhq_s16(vld1q_s16(x+i), w));
+         vst1q_s16(xx+n-i-8, vqdmulhq_s16(vld1q_s16(x+n-i-8), w_rev));
+      }
+   }
+   for (;i<overlap;i++)
+   {
+      xx[i] = MULT16_16_Q15(x[i],window[i]);
+      xx[n-i-1] = MULT16_16_Q15(x[n-i-1],window[i]);
+   }
+
+   {
+      /* Each square is shifted before the sum, in any order */
+      int32x4_t acc = vdupq_n_s32(0);
+      ac0 = 1+(n<<7);
+      for (i=0;i<n-7;i+=8)
+      {
+         int16x8_t v = vld1q_s16(xx+i);
+         acc = vsraq_n_s32(acc, vmull_s16(vget_low_s16(v), vget_low_s16(v)), 9);
+         acc = vsraq_n_s32(acc, vmull_s16(vget_high_s16(v), vget_high_s16(v)), 9);
+      }
+#if defined(OPUS_ARM_PRESUME_AARCH64_NEON_INTR)
+      ac0 += vaddvq_s32(acc);
+#else
+      {
+         int32x2_t acc2 = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+         ac0 += vget_lane_s32(vpadd_s32(acc2, acc2), 0);
+      }
+#endif
+      for (;i<n;i++)
+         ac0 += SHR32(MULT16_16(xx[i],xx[i]),9);
+   }
+
+   shift = celt_ilog2(ac0)-30+10;
+   shift = (shift)/2;
+   if (shift>0)
+   {
+      /* VRSHL by -shift is PSHR32() without the 32-bit intermediate */
+      const int16x8_t count = vdupq_n_s16(-shift);
+      for (i=0;i<n-7;i+=8)
+         vst1q_s16(xx+i, vrshlq_s16(vld1q_s16(xx+i), count));
+      for (;i<n;i++)
+         xx[i] = PSHR32(xx[i], shift);
+   } else
+      shift = 0;
+
+   OPUS_CLEAR(xx+n, lag);
+   celt_pitch_xcorr(xx, xx, ac, n, lag+1, arch);
+
+   shift = 2*shift;
+   if (shift<=0)
+      ac[0] += SHL32((opus_int32)1, -shift);
+   if (ac[0] < 268435456)
+   {
+      int shift2 = 29 - EC_ILOG(ac[0]);
+      for (i=0;i<=lag;i++)
+         ac[i] = SHL32(ac[i], shift2);
+      shift -= shift2;
+   } else if (ac[0] >= 536870912)
+   {
+      int shift2=1;
+      if (ac[0] >= 1073741824)
+         shift2++;
+      for (i=0;i<=lag;i++)
+         ac[i] = SHR32(ac[i], shift2);
+      shift += shift2;
+   }
+
+   RESTORE_STACK;
+   return shift;
+}
+
+#endif
@@ -131,6 +131,25 @@ typedef struct {
 #define CELT_SET_SILK_INFO_REQUEST    10028
 #define CELT_SET_SILK_INFO(x) CELT_SET_SILK_INFO_REQUEST, __celt_check_silkinfo_ptr(x)
 
+#define CELT_GET_ALLOC_CACHE_HITS_REQUEST    10030
+/** Get the number of bit allocations that reused a cached result */
+#define CELT_GET_ALLOC_CACHE_HITS(x) CELT_GET_ALLOC_CACHE_HITS_REQUEST, __opus_check_uint_ptr(x)
+
+#define CELT_GET_ALLOC_CACHE_MISSES_REQUEST    10032
+/** Get the number of bit allocations that had to be computed */
+#define CELT_GET_ALLOC_CACHE_MISSES(x) CELT_GET_ALLOC_CACHE_MISSES_REQUEST, __opus_check_uint_ptr(x)
+
+#define CELT_SET_SINGLE_PASS_ENERGY_REQUEST    10034
+/** Code the coarse energy once, with intra or inter prediction picked from
+    estimated rates, instead of trying both (which complexity >= 4 does).
+    The packet size does not change: it is fixed under CBR, and VBR picks it
+    before the coarse energy is coded. Only frames where the estimate picks a
+    different prediction than the two-pass search spend their bits differently.
+    0=Follow the complexity (default)
+    1=Single pass
+ */
+#define CELT_SET_SINGLE_PASS_ENERGY(x) CELT_SET_SINGLE_PASS_ENERGY_REQUEST, __opus_check_int(x)
+
 /* Encoder stuff */
 
 int celt_encoder_get_size(int channels);
@@ -84,6 +84,9 @@ struct OpusCustomDecoder {
    int disable_inv;
    int arch;
 
+   /* Only depends on the mode, so it survives a reset */
+   AllocCache alloc_cache;
+
    /* Everything beyond this point gets cleared on a reset */
 #define DECODER_RESET_START rng
 
@@ -1061,7 +1064,7 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *dat
 
    codedBands = clt_compute_allocation(mode, start, end, offsets, cap,
          alloc_trim, &intensity, &dual_stereo, bits, &balance, pulses,
-         fine_quant, fine_priority, C, LM, dec, 0, 0, 0);
+         fine_quant, fine_priority, C, LM, dec, 0, 0, 0, &st->alloc_cache);
 
    unquant_fine_energy(mode, start, end, oldBandE, fine_quant, dec, C);
 
@@ -1324,6 +1327,22 @@ int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
          *value=st->mode;
       }
       break;
+      case CELT_GET_ALLOC_CACHE_HITS_REQUEST:
+      {
+         opus_uint32 * value = va_arg(ap, opus_uint32 *);
+         if (value==0)
+            goto bad_arg;
+         *value=st->alloc_cache.hits;
+      }
+      break;
+      case CELT_GET_ALLOC_CACHE_MISSES_REQUEST:
+      {
+         opus_uint32 * value = va_arg(ap, opus_uint32 *);
+         if (value==0)
+            goto bad_arg;
+         *value=st->alloc_cache.misses;
+      }
+      break;
       case CELT_SET_SIGNALLING_REQUEST:
       {
          opus_int32 value = va_arg(ap, opus_int32);
@@ -75,8 +75,12 @@ struct OpusCustomEncoder {
    int lsb_depth;
    int lfe;
    int disable_inv;
+   int single_pass_energy;
    int arch;
 
+   /* Only depends on the mode, so it survives a reset */
+   AllocCache alloc_cache;
+
    /* Everything beyond this point gets cleared on a reset */
 #define ENCODER_RESET_START rng
 
@@ -1926,7 +1930,8 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
    quant_coarse_energy(mode, start, end, effEnd, bandLogE,
          oldBandE, total_bits, error, enc,
          C, LM, nbAvailableBytes, st->force_intra,
-         &st->delayedIntra, st->complexity >= 4, st->loss_rate, st->lfe);
+         &st->delayedIntra, st->complexity >= 4 && !st->single_pass_energy,
+         st->single_pass_energy, st->loss_rate, st->lfe);
 
    tf_encode(start, end, isTransient, tf_res, LM, tf_select, enc);
 
@@ -2193,7 +2198,8 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
       signalBandwidth = 1;
    codedBands = clt_compute_allocation(mode, start, end, offsets, cap,
          alloc_trim, &st->intensity, &dual_stereo, bits, &balance, pulses,
-         fine_quant, fine_priority, C, LM, enc, 1, st->lastCodedBands, signalBandwidth);
+         fine_quant, fine_priority, C, LM, enc, 1, st->lastCodedBands, signalBandwidth,
+         &st->alloc_cache);
    if (st->lastCodedBands)
       st->lastCodedBands = IMIN(st->lastCodedBands+1,IMAX(st->lastCodedBands-1,codedBands));
    else
@@ -2421,6 +2427,14 @@ int opus_custom_encoder_ctl(CELTEncoder * OPUS_RESTRICT st, int request, ...)
          st->complexity = value;
       }
       break;
+      case CELT_SET_SINGLE_PASS_ENERGY_REQUEST:
+      {
+         opus_int32 value = va_arg(ap, opus_int32);
+         if (value<0 || value>1)
+            goto bad_arg;
+         st->single_pass_energy = value;
+      }
+      break;
       case CELT_SET_START_BAND_REQUEST:
       {
          opus_int32 value = va_arg(ap, opus_int32);
@@ -2573,6 +2587,22 @@ int opus_custom_encoder_ctl(CELTEncoder * OPUS_RESTRICT st, int request, ...)
          *value=st->mode;
       }
       break;
+      case CELT_GET_ALLOC_CACHE_HITS_REQUEST:
+      {
+         opus_uint32 * value = va_arg(ap, opus_uint32 *);
+         if (value==0)
+            goto bad_arg;
+         *value=st->alloc_cache.hits;
+      }
+      break;
+      case CELT_GET_ALLOC_CACHE_MISSES_REQUEST:
+      {
+         opus_uint32 * value = va_arg(ap, opus_uint32 *);
+         if (value==0)
+            goto bad_arg;
+         *value=st->alloc_cache.misses;
+      }
+      break;
       case OPUS_GET_FINAL_RANGE_REQUEST:
       {
          opus_uint32 * value = va_arg(ap, opus_uint32 *);
@@ -126,7 +126,7 @@ void celt_fir_c(
    RESTORE_STACK;
 }
 
-void celt_iir(const opus_val32 *_x,
+void celt_iir_c(const opus_val32 *_x,
          const opus_val16 *den,
          opus_val32 *_y,
          int N,
@@ -207,7 +207,7 @@ void celt_iir(const opus_val32 *_x,
 #endif
 }
 
-int _celt_autocorr(
+int _celt_autocorr_c(
                    const opus_val16 *x,   /*  in: [0...n-1] samples x   */
                    opus_val32       *ac,  /* out: [0...lag-1] ac values */
                    const opus_val16       *window,
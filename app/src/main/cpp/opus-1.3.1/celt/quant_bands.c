@@ -137,6 +137,88 @@ static const unsigned char e_prob_model[4][2][42] = {
    }
 };
 
+/* Approximate cost of the e_prob_model symbols, in 1/8 bits: for each band,
+   coding 0, coding +/-1 and each further step away from 0. Only used to
+   estimate the rate of intra and inter prediction. */
+static const unsigned char e_cost_model[4][2][63] = {
+   /*120 sample frames.*/
+   {
+      /*Inter*/
+      {
+          15,  20,   8,  16,  19,   8,  16,  19,   8,  16,  19,   8,  16,  19,   8,
+          16,  19,   8,  16,  19,   8,  16,  19,   8,  12,  17,  14,  12,  17,  14,
+          12,  17,  14,  12,  17,  14,   9,  17,  21,   9,  17,  21,   9,  17,  21,
+           8,  18,  26,   8,  18,  26,   7,  18,  31,   5,  20,  35,   4,  22,  37,
+           4,  22,  36
+      },
+      /*Intra*/
+      {
+          27,  23,   4,  19,  19,   7,  18,  19,   7,  18,  19,   8,  18,  19,   7,
+          18,  19,   8,  18,  19,   8,  18,  19,   8,  17,  18,   9,  15,  17,  11,
+          14,  17,  12,  14,  17,  12,  12,  17,  14,  12,  16,  16,  12,  17,  15,
+          11,  17,  17,  10,  17,  19,   9,  17,  21,   9,  17,  22,  11,  16,  21,
+          14,  15,  19
+      }
+   },
+   /*240 sample frames.*/
+   {
+      /*Inter*/
+      {
+          13,  17,  14,  13,  17,  13,  12,  17,  14,  13,  17,  14,  12,  17,  15,
+          12,  17,  14,  12,  17,  14,  12,  17,  14,  10,  16,  21,   9,  17,  23,
+           9,  17,  23,   9,  17,  23,   7,  18,  31,   7,  19,  31,   6,  19,  30,
+           5,  20,  35,   5,  20,  37,   4,  22,  42,   4,  24,  43,   3,  24,  40,
+           4,  22,  39
+      },
+      /*Intra*/
+      {
+          28,  23,   4,  18,  18,   9,  16,  17,  11,  16,  17,  11,  15,  17,  11,
+          14,  17,  12,  15,  17,  12,  14,  17,  12,  14,  17,  12,  13,  17,  13,
+          12,  17,  16,  12,  17,  16,  11,  17,  17,  11,  17,  17,  10,  17,  17,
+           9,  18,  18,   8,  18,  20,   7,  19,  23,   8,  18,  24,  11,  15,  22,
+          14,  14,  20
+      }
+   },
+   /*480 sample frames.*/
+   {
+      /*Inter*/
+      {
+          17,  16,  12,  12,  16,  17,  10,  16,  21,  10,  16,  21,  10,  17,  20,
+           9,  17,  22,   9,  17,  22,  10,  17,  22,   8,  17,  26,   8,  18,  26,
+           7,  18,  30,   7,  18,  29,   6,  19,  34,   5,  20,  32,   6,  20,  31,
+           5,  21,  34,   4,  22,  37,   4,  24,  40,   3,  24,  43,   4,  22,  39,
+           5,  20,  37
+      },
+      /*Intra*/
+      {
+          29,  23,   4,  17,  18,  10,  15,  16,  13,  14,  17,  13,  13,  17,  13,
+          12,  17,  16,  12,  17,  14,  12,  17,  15,  12,  17,  14,  11,  17,  15,
+          10,  17,  17,  10,  17,  18,   9,  18,  18,   9,  18,  18,  10,  18,  18,
+           8,  19,  19,   8,  18,  21,   6,  20,  24,   7,  19,  25,  11,  15,  23,
+          14,  14,  21
+      }
+   },
+   /*960 sample frames.*/
+   {
+      /*Inter*/
+      {
+          21,  17,   9,  11,  17,  16,  10,  16,  21,  10,  17,  21,   9,  17,  20,
+           8,  17,  24,   9,  17,  23,   9,  17,  24,   8,  18,  24,   7,  18,  23,
+           7,  18,  29,   6,  19,  28,   6,  19,  29,   6,  20,  27,   6,  20,  26,
+           5,  21,  29,   5,  22,  32,   4,  23,  34,   4,  23,  37,   6,  19,  34,
+           7,  18,  33
+      },
+      /*Intra*/
+      {
+          28,  23,   4,  16,  18,   9,  14,  16,  13,  13,  17,  13,  12,  18,  13,
+          11,  17,  16,  11,  17,  15,  11,  17,  15,  11,  18,  14,  10,  18,  15,
+           9,  18,  18,   9,  18,  18,   8,  18,  18,   9,  18,  18,   9,  18,  18,
+           7,  19,  19,   7,  19,  22,   6,  21,  24,   7,  19,  25,  11,  15,  24,
+          14,  14,  21
+      }
+   }
+};
+
 static const unsigned char small_energy_icdf[3]={2,1,0};
 
 static opus_val32 loss_distortion(const opus_val16 *eBands, opus_val16 *oldEBands, int start, int end, int len, int C)
@@ -258,10 +340,81 @@ static int quant_coarse_energy_impl(const CELTMode *m, int start, int end,
    return lfe ? 0 : badness;
 }
 
+/* Estimates the bits quant_coarse_energy_impl() would spend on the same
+   energies, without the budget limits. Only used to pick intra or inter
+   prediction without running both, so it gives up as soon as the estimate
+   reaches limit. */
+static opus_int32 coarse_energy_cost(const CELTMode *m, int start, int end,
+      const opus_val16 *eBands, const opus_val16 *oldEBands,
+      const unsigned char *cost_model, int C, int LM, int intra, opus_val16 max_decay, int lfe,
+      opus_int32 limit)
+{
+   int i, c;
+   opus_int32 cost;
+   opus_val32 prev[2] = {0,0};
+   opus_val16 coef;
+   opus_val16 beta;
+
+   /* The intra flag, coded with logp=3 */
+   cost = intra ? 3<<BITRES : 1;
+   if (intra)
+   {
+      coef = 0;
+      beta = beta_intra;
+   } else {
+      beta = beta_coef[LM];
+      coef = pred_coef[LM];
+   }
+
+   for (i=start;i<end;i++)
+   {
+      c=0;
+      do {
+         int qi;
+         opus_val32 q;
+         opus_val16 x;
+         opus_val32 f;
+         opus_val16 oldE;
+         opus_val16 decay_bound;
+         int pi, aq;
+         x = eBands[i+c*m->nbEBands];
+         oldE = MAX16(-QCONST16(9.f,DB_SHIFT), oldEBands[i+c*m->nbEBands]);
+#ifdef FIXED_POINT
+         f = SHL32(EXTEND32(x),7) - PSHR32(MULT16_16(coef,oldE), 8) - prev[c];
+         qi = (f+QCONST32(.5f,DB_SHIFT+7))>>(DB_SHIFT+7);
+         decay_bound = EXTRACT16(MAX32(-QCONST16(28.f,DB_SHIFT),
+               SUB32((opus_val32)oldEBands[i+c*m->nbEBands],max_decay)));
+#else
+         f = x-coef*oldE-prev[c];
+         qi = (int)floor(.5f+f);
+         decay_bound = MAX16(-QCONST16(28.f,DB_SHIFT), oldEBands[i+c*m->nbEBands]) - max_decay;
+#endif
+         if (qi < 0 && x < decay_bound)
+         {
+            qi += (int)SHR16(SUB16(decay_bound,x), DB_SHIFT);
+            if (qi > 0)
+               qi = 0;
+         }
+         if (lfe && i>=2)
+            qi = IMIN(qi, 0);
+         pi = 3*IMIN(i,20);
+         aq = abs(qi);
+         /* Without a branch, the sign of qi is as good as random */
+         cost += cost_model[pi] + (aq>0)*(cost_model[pi+1]-cost_model[pi])
+               + IMAX(aq-1, 0)*cost_model[pi+2];
+         q = (opus_val32)SHL32(EXTEND32(qi),DB_SHIFT);
+         prev[c] = prev[c] + SHL32(q,7) - MULT16_16(beta,PSHR32(q,8));
+      } while (++c < C);
+      if (cost >= limit)
+         break;
+   }
+   return cost;
+}
+
 void quant_coarse_energy(const CELTMode *m, int start, int end, int effEnd,
       const opus_val16 *eBands, opus_val16 *oldEBands, opus_uint32 budget,
       opus_val16 *error, ec_enc *enc, int C, int LM, int nbAvailableBytes,
-      int force_intra, opus_val32 *delayedIntra, int two_pass, int loss_rate, int lfe)
+      int force_intra, opus_val32 *delayedIntra, int two_pass, int predict_intra, int loss_rate, int lfe)
 {
    int intra;
    opus_val16 max_decay;
@@ -274,13 +427,15 @@ void quant_coarse_energy(const CELTMode *m, int start, int end, int effEnd,
    opus_val32 new_distortion;
    SAVE_STACK;
 
-   intra = force_intra || (!two_pass && *delayedIntra>2*C*(end-start) && nbAvailableBytes > (end-start)*C);
+   if (two_pass)
+      predict_intra = 0;
+   intra = force_intra || (!two_pass && !predict_intra && *delayedIntra>2*C*(end-start) && nbAvailableBytes > (end-start)*C);
    intra_bias = (opus_int32)((budget**delayedIntra*loss_rate)/(C*512));
    new_distortion = loss_distortion(eBands, oldEBands, start, effEnd, m->nbEBands, C);
 
    tell = ec_tell(enc);
    if (tell+3 > budget)
-      two_pass = intra = 0;
+      two_pass = predict_intra = intra = 0;
 
    max_decay = QCONST16(16.f,DB_SHIFT);
    if (end-start>10)
@@ -293,6 +448,18 @@ void quant_coarse_energy(const CELTMode *m, int start, int end, int effEnd,
    }
    if (lfe)
       max_decay = QCONST16(3.f,DB_SHIFT);
+   /* Single pass: make the same choice as the two-pass search would from
+      estimated rates, then only code that one */
+   if (predict_intra && !intra)
+   {
+      opus_int32 intra_cost, inter_cost;
+      inter_cost = coarse_energy_cost(m, start, end, eBands, oldEBands, e_cost_model[LM][0],
+            C, LM, 0, max_decay, lfe, 0x7FFFFFFF);
+      /* The first bands usually settle it, intra prediction starts from 0 */
+      intra_cost = coarse_energy_cost(m, start, end, eBands, oldEBands, e_cost_model[LM][1],
+            C, LM, 1, max_decay, lfe, inter_cost+intra_bias);
+      intra = inter_cost+intra_bias > intra_cost;
+   }
    enc_start_state = *enc;
 
    ALLOC(oldEBands_intra, C*m->nbEBands, opus_val16);
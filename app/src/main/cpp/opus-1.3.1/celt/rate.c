@@ -243,12 +243,11 @@ void compute_pulse_cache(CELTMode *m, int LM)
 
 #endif /* CUSTOM_MODES */
 
-#define ALLOC_STEPS 6
-
 static OPUS_INLINE int interp_bits2pulses(const CELTMode *m, int start, int end, int skip_start,
       const int *bits1, const int *bits2, const int *thresh, const int *cap, opus_int32 total, opus_int32 *_balance,
       int skip_rsv, int *intensity, int intensity_rsv, int *dual_stereo, int dual_stereo_rsv, int *bits,
-      int *ebits, int *fine_priority, int C, int LM, ec_ctx *ec, int encode, int prev, int signalBandwidth)
+      int *ebits, int *fine_priority, int C, int LM, ec_ctx *ec, int encode, int prev, int signalBandwidth,
+      opus_int32 *interp_psum)
 {
    opus_int32 psum;
    int lo, hi;
@@ -271,20 +270,26 @@ static OPUS_INLINE int interp_bits2pulses(const CELTMode *m, int start, int end,
    for (i=0;i<ALLOC_STEPS;i++)
    {
       int mid = (lo+hi)>>1;
-      psum = 0;
-      done = 0;
-      for (j=end;j-->start;)
+      psum = interp_psum ? interp_psum[mid] : -1;
+      if (psum < 0)
       {
-         int tmp = bits1[j] + (mid*(opus_int32)bits2[j]>>ALLOC_STEPS);
-         if (tmp >= thresh[j] || done)
+         psum = 0;
+         done = 0;
+         for (j=end;j-->start;)
          {
-            done = 1;
-            /* Don't allocate more than we can actually use */
-            psum += IMIN(tmp, cap[j]);
-         } else {
-            if (tmp >= alloc_floor)
-               psum += alloc_floor;
+            int tmp = bits1[j] + (mid*(opus_int32)bits2[j]>>ALLOC_STEPS);
+            if (tmp >= thresh[j] || done)
+            {
+               done = 1;
+               /* Don't allocate more than we can actually use */
+               psum += IMIN(tmp, cap[j]);
+            } else {
+               if (tmp >= alloc_floor)
+                  psum += alloc_floor;
+            }
          }
+         if (interp_psum)
+            interp_psum[mid] = psum;
       }
       if (psum > total)
          hi = mid;
@@ -529,8 +534,55 @@ static OPUS_INLINE int interp_bits2pulses(const CELTMode *m, int start, int end,
    return codedBands;
 }
 
+static AllocCacheEntry *alloc_cache_lookup(AllocCache *cache, const CELTMode *m, int start, int end,
+      const int *offsets, int alloc_trim, int C, int LM)
+{
+   int i, j;
+   opus_uint32 hash;
+   AllocCacheEntry *e;
+   if (end > ALLOC_CACHE_MAX_BANDS || m->nbAllocVectors > ALLOC_CACHE_MAX_VECTORS)
+      return NULL;
+   /* FNV-1a over the key. The budget isn't part of it: it changes from frame
+      to frame with the bits used by the coarse energy, even with CBR. */
+   hash = 2166136261U;
+   hash = (hash^(opus_uint32)(start | end<<8 | alloc_trim<<16 | C<<24 | LM<<28))*16777619U;
+   for (j=start;j<end;j++)
+      hash = (hash^(opus_uint32)offsets[j])*16777619U;
+   for (i=0;i<ALLOC_CACHE_SIZE;i++)
+   {
+      e = &cache->entry[i];
+      if (!e->valid || e->hash != hash || e->start != start || e->end != end
+            || e->alloc_trim != alloc_trim || e->C != C || e->LM != LM)
+         continue;
+      for (j=start;j<end;j++)
+         if (e->offsets[j] != offsets[j])
+            break;
+      if (j==end)
+      {
+         cache->hits++;
+         return e;
+      }
+   }
+   cache->misses++;
+   e = &cache->entry[cache->next];
+   cache->next = (cache->next+1)%ALLOC_CACHE_SIZE;
+   e->valid = 1;
+   e->hash = hash;
+   e->start = start;
+   e->end = end;
+   e->alloc_trim = alloc_trim;
+   e->C = C;
+   e->LM = LM;
+   OPUS_COPY(e->offsets+start, offsets+start, end-start);
+   for (i=0;i<ALLOC_CACHE_MAX_VECTORS;i++)
+      e->vector_psum[i] = -1;
+   e->interp_lo = -1;
+   return e;
+}
+
 int clt_compute_allocation(const CELTMode *m, int start, int end, const int *offsets, const int *cap, int alloc_trim, int *intensity, int *dual_stereo,
-      opus_int32 total, opus_int32 *balance, int *pulses, int *ebits, int *fine_priority, int C, int LM, ec_ctx *ec, int encode, int prev, int signalBandwidth)
+      opus_int32 total, opus_int32 *balance, int *pulses, int *ebits, int *fine_priority, int C, int LM, ec_ctx *ec, int encode, int prev, int signalBandwidth,
+      AllocCache *cache)
 {
    int lo, hi, len, j;
    int codedBands;
@@ -538,8 +590,11 @@ int clt_compute_allocation(const CELTMode *m, int start, int end, const int *off
    int skip_rsv;
    int intensity_rsv;
    int dual_stereo_rsv;
-   VARDECL(int, bits1);
-   VARDECL(int, bits2);
+   const int *bits1;
+   const int *bits2;
+   AllocCacheEntry *entry;
+   VARDECL(int, _bits1);
+   VARDECL(int, _bits2);
    VARDECL(int, thresh);
    VARDECL(int, trim_offset);
    SAVE_STACK;
@@ -564,8 +619,11 @@ int clt_compute_allocation(const CELTMode *m, int start, int end, const int *off
          total -= dual_stereo_rsv;
       }
    }
-   ALLOC(bits1, len, int);
-   ALLOC(bits2, len, int);
+   /* Everything up to the budget comparisons only depends on the key, so
+      the sums are kept in the cache */
+   entry = cache ? alloc_cache_lookup(cache, m, start, end, offsets, alloc_trim, C, LM) : NULL;
+   ALLOC(_bits1, len, int);
+   ALLOC(_bits2, len, int);
    ALLOC(thresh, len, int);
    ALLOC(trim_offset, len, int);
 
@@ -586,25 +644,31 @@ int clt_compute_allocation(const CELTMode *m, int start, int end, const int *off
    do
    {
       int done = 0;
-      int psum = 0;
       int mid = (lo+hi) >> 1;
-      for (j=end;j-->start;)
+      opus_int32 psum = entry ? entry->vector_psum[mid] : -1;
+      if (psum < 0)
       {
-         int bitsj;
-         int N = m->eBands[j+1]-m->eBands[j];
-         bitsj = C*N*m->allocVectors[mid*len+j]<<LM>>2;
-         if (bitsj > 0)
-            bitsj = IMAX(0, bitsj + trim_offset[j]);
-         bitsj += offsets[j];
-         if (bitsj >= thresh[j] || done)
+         psum = 0;
+         for (j=end;j-->start;)
          {
-            done = 1;
-            /* Don't allocate more than we can actually use */
-            psum += IMIN(bitsj, cap[j]);
-         } else {
-            if (bitsj >= C<<BITRES)
-               psum += C<<BITRES;
+            int bitsj;
+            int N = m->eBands[j+1]-m->eBands[j];
+            bitsj = C*N*m->allocVectors[mid*len+j]<<LM>>2;
+            if (bitsj > 0)
+               bitsj = IMAX(0, bitsj + trim_offset[j]);
+            bitsj += offsets[j];
+            if (bitsj >= thresh[j] || done)
+            {
+               done = 1;
+               /* Don't allocate more than we can actually use */
+               psum += IMIN(bitsj, cap[j]);
+            } else {
+               if (bitsj >= C<<BITRES)
+                  psum += C<<BITRES;
+            }
          }
+         if (entry)
+            entry->vector_psum[mid] = psum;
       }
       if (psum > total)
          hi = mid - 1;
@@ -615,29 +679,48 @@ int clt_compute_allocation(const CELTMode *m, int start, int end, const int *off
    while (lo <= hi);
    hi = lo--;
    /*printf ("interp between %d and %d\n", lo, hi);*/
-   for (j=start;j<end;j++)
+   if (entry && entry->interp_lo == lo)
    {
-      int bits1j, bits2j;
-      int N = m->eBands[j+1]-m->eBands[j];
-      bits1j = C*N*m->allocVectors[lo*len+j]<<LM>>2;
-      bits2j = hi>=m->nbAllocVectors ?
-            cap[j] : C*N*m->allocVectors[hi*len+j]<<LM>>2;
-      if (bits1j > 0)
-         bits1j = IMAX(0, bits1j + trim_offset[j]);
-      if (bits2j > 0)
-         bits2j = IMAX(0, bits2j + trim_offset[j]);
-      if (lo > 0)
-         bits1j += offsets[j];
-      bits2j += offsets[j];
-      if (offsets[j]>0)
-         skip_start = j;
-      bits2j = IMAX(0,bits2j-bits1j);
-      bits1[j] = bits1j;
-      bits2[j] = bits2j;
+      bits1 = entry->bits1;
+      bits2 = entry->bits2;
+      skip_start = entry->skip_start;
+   } else {
+      int *b1 = entry ? entry->bits1 : _bits1;
+      int *b2 = entry ? entry->bits2 : _bits2;
+      for (j=start;j<end;j++)
+      {
+         int bits1j, bits2j;
+         int N = m->eBands[j+1]-m->eBands[j];
+         bits1j = C*N*m->allocVectors[lo*len+j]<<LM>>2;
+         bits2j = hi>=m->nbAllocVectors ?
+               cap[j] : C*N*m->allocVectors[hi*len+j]<<LM>>2;
+         if (bits1j > 0)
+            bits1j = IMAX(0, bits1j + trim_offset[j]);
+         if (bits2j > 0)
+            bits2j = IMAX(0, bits2j + trim_offset[j]);
+         if (lo > 0)
+            bits1j += offsets[j];
+         bits2j += offsets[j];
+         if (offsets[j]>0)
+            skip_start = j;
+         bits2j = IMAX(0,bits2j-bits1j);
+         b1[j] = bits1j;
+         b2[j] = bits2j;
+      }
+      if (entry)
+      {
+         entry->interp_lo = lo;
+         entry->skip_start = skip_start;
+         for (j=0;j<1<<ALLOC_STEPS;j++)
+            entry->interp_psum[j] = -1;
+      }
+      bits1 = b1;
+      bits2 = b2;
    }
    codedBands = interp_bits2pulses(m, start, end, skip_start, bits1, bits2, thresh, cap,
          total, balance, skip_rsv, intensity, intensity_rsv, dual_stereo, dual_stereo_rsv,
-         pulses, ebits, fine_priority, C, LM, ec, encode, prev, signalBandwidth);
+         pulses, ebits, fine_priority, C, LM, ec, encode, prev, signalBandwidth,
+         entry ? entry->interp_psum : NULL);
    RESTORE_STACK;
    return codedBands;
 }
@@ -43,6 +43,46 @@
 #include "cwrs.h"
 #include "modes.h"
 
+#define ALLOC_STEPS 6
+
+/* Number of allocation inputs kept by each encoder and decoder */
+#define ALLOC_CACHE_SIZE 4
+/* Modes with more bands or vectors (custom modes only) bypass the cache */
+#define ALLOC_CACHE_MAX_BANDS 21
+#define ALLOC_CACHE_MAX_VECTORS 11
+
+/** Bisection state of clt_compute_allocation() for one set of inputs. The
+    budget isn't part of the key: the sums it is compared with are kept
+    instead, -1 until they are first needed. */
+typedef struct {
+   int valid;
+   opus_uint32 hash;
+   /* Key */
+   int start;
+   int end;
+   int alloc_trim;
+   int C;
+   int LM;
+   int offsets[ALLOC_CACHE_MAX_BANDS];
+   /* Bits used by each static allocation vector */
+   opus_int32 vector_psum[ALLOC_CACHE_MAX_VECTORS];
+   /* Interpolation between vectors interp_lo and interp_lo+1 */
+   int interp_lo;
+   int skip_start;
+   int bits1[ALLOC_CACHE_MAX_BANDS];
+   int bits2[ALLOC_CACHE_MAX_BANDS];
+   opus_int32 interp_psum[1<<ALLOC_STEPS];
+} AllocCacheEntry;
+
+/** Allocation inputs of recent frames. With CBR the trim, offsets and band
+    range settle quickly, so the same entries keep coming back. */
+typedef struct {
+   AllocCacheEntry entry[ALLOC_CACHE_SIZE];
+   int next;
+   opus_uint32 hits;
+   opus_uint32 misses;
+} AllocCache;
+
 void compute_pulse_cache(CELTMode *m, int LM);
 
 static OPUS_INLINE int get_pulses(int i)
@@ -93,9 +133,11 @@ static OPUS_INLINE int pulses2bits(const CELTMode *m, int band, int LM, int puls
                 each band
  @param total Number of bands
  @param pulses Number of pulses per band (returned)
+ @param cache Results of previous calls to reuse, or NULL
  @return Total number of bits allocated
 */
 int clt_compute_allocation(const CELTMode *m, int start, int end, const int *offsets, const int *cap, int alloc_trim, int *intensity, int *dual_stereo,
-      opus_int32 total, opus_int32 *balance, int *pulses, int *ebits, int *fine_priority, int C, int LM, ec_ctx *ec, int encode, int prev, int signalBandwidth);
+      opus_int32 total, opus_int32 *balance, int *pulses, int *ebits, int *fine_priority, int C, int LM, ec_ctx *ec, int encode, int prev, int signalBandwidth,
+      AllocCache *cache);
 
 #endif
@@ -0,0 +1,235 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "celt_lpc.h"
+#include "cpu_support.h"
+#include "stack_alloc.h"
+
+#ifdef FIXED_POINT
+
+#ifndef M_PI
+#define M_PI 3.141592653
+#endif
+
+#define LOOPS 1000
+#define MAX_N 1200
+#define OVERLAP 120
+
+#define TIMED(t, call) do { clock_t start_ = clock(); call; (t) += clock() - start_; } while (0)
+
+static const int sizes[] = {1, 7, 24, 31, 120, 240, 480, 960, 1080, MAX_N};
+#define NB_SIZES ((int)(sizeof(sizes)/sizeof(sizes[0])))
+
+static clock_t fir_c, fir_opt, iir_c, iir_opt, ac_c, ac_opt;
+
+/* Noise through a random resonance, at a random level, like the excitation
+   celt_decode_lost() and pitch_downsample() work on */
+static void random_signal(opus_val16 *x, int N, int max_level)
+{
+   int i;
+   int level = 1 + rand()%max_level;
+   double r = .9 + .099*rand()/RAND_MAX;
+   double w = M_PI*rand()/RAND_MAX;
+   double m1=0, m2=0;
+   for (i=0;i<N;i++)
+   {
+      double v = (rand()%2001-1000)/1000. + 2*r*cos(w)*m1 - r*r*m2;
+      m2 = m1;
+      m1 = v;
+      v *= level*(1-r)*.5;
+      if (v > 32767) v = 32767;
+      if (v < -32768) v = -32768;
+      x[i] = (opus_val16)floor(.5+v);
+   }
+   if (max_level == 32767 && rand()%8 == 0)
+   {
+      /* Full scale square wave, the worst case for the energy sum */
+      for (i=0;i<N;i++)
+         x[i] = (i/17)&1 ? 32767 : -32768;
+   }
+}
+
+/* A stable LPC filter, computed the way the decoder PLC does */
+static void random_lpc(opus_val16 *lpc, int arch)
+{
+   opus_val16 x[MAX_N];
+   opus_val32 ac[LPC_ORDER+1];
+   int i;
+   random_signal(x, MAX_N, 32767);
+   _celt_autocorr_c(x, ac, NULL, 0, LPC_ORDER, MAX_N, arch);
+   ac[0] += SHR32(ac[0],13);
+   for (i=1;i<=LPC_ORDER;i++)
+      ac[i] -= MULT16_32_Q15(2*i*i, ac[i]);
+   _celt_lpc(lpc, ac, LPC_ORDER);
+}
+
+static int test_fir(int N, int arch)
+{
+   opus_val16 buf[LPC_ORDER+MAX_N];
+   opus_val16 num[LPC_ORDER];
+   opus_val16 y_c[MAX_N], y_opt[MAX_N];
+   opus_val16 *x = buf+LPC_ORDER;
+   int i;
+   random_lpc(num, arch);
+   /* The optimized versions saturate where the C one wraps around, keep the
+      output in range */
+   random_signal(buf, LPC_ORDER+N, 2048);
+   TIMED(fir_c, celt_fir_c(x, num, y_c, N, LPC_ORDER, arch));
+   TIMED(fir_opt, celt_fir(x, num, y_opt, N, LPC_ORDER, arch));
+   for (i=0;i<N;i++)
+   {
+      if (y_c[i] != y_opt[i])
+      {
+         fprintf(stderr, "**celt_fir() mismatch, N=%d, y[%d]: %d vs %d**\n",
+               N, i, y_c[i], y_opt[i]);
+         return 1;
+      }
+   }
+   return 0;
+}
+
+static int test_iir(int N, int arch)
+{
+   opus_val16 exc[MAX_N];
+   opus_val32 x[MAX_N];
+   opus_val16 den[LPC_ORDER];
+   opus_val16 mem_c[LPC_ORDER], mem_opt[LPC_ORDER];
+   opus_val32 y_c[MAX_N], y_opt[MAX_N];
+   int i;
+   random_lpc(den, arch);
+   random_signal(exc, N, 32767);
+   for (i=0;i<N;i++)
+      x[i] = SHL32(EXTEND32(exc[i]), SIG_SHIFT-4);
+   for (i=0;i<LPC_ORDER;i++)
+      mem_c[i] = mem_opt[i] = (rand()%2001-1000);
+   TIMED(iir_c, celt_iir_c(x, den, y_c, N, LPC_ORDER, mem_c, arch));
+   TIMED(iir_opt, celt_iir(x, den, y_opt, N, LPC_ORDER, mem_opt, arch));
+   for (i=0;i<N;i++)
+   {
+      if (y_c[i] != y_opt[i])
+      {
+         fprintf(stderr, "**celt_iir() mismatch, N=%d, y[%d]: %d vs %d**\n",
+               N, i, y_c[i], y_opt[i]);
+         return 1;
+      }
+   }
+   if (N >= LPC_ORDER && memcmp(mem_c, mem_opt, sizeof(mem_c)))
+   {
+      fprintf(stderr, "**celt_iir() memory mismatch, N=%d**\n", N);
+      return 1;
+   }
+   return 0;
+}
+
+static int test_autocorr(int n, int lag, const opus_val16 *window, int overlap, int arch)
+{
+   opus_val16 x[MAX_N];
+   opus_val32 ac_ref[LPC_ORDER+1], ac_arch[LPC_ORDER+1];
+   int shift_ref, shift_arch;
+   int i;
+   random_signal(x, n, 32767);
+   TIMED(ac_c, shift_ref = _celt_autocorr_c(x, ac_ref, window, overlap, lag, n, arch));
+   TIMED(ac_opt, shift_arch = _celt_autocorr(x, ac_arch, window, overlap, lag, n, arch));
+   if (shift_ref != shift_arch)
+   {
+      fprintf(stderr, "**_celt_autocorr() shift mismatch, n=%d lag=%d overlap=%d**\n",
+            n, lag, overlap);
+      return 1;
+   }
+   for (i=0;i<=lag;i++)
+   {
+      if (ac_ref[i] != ac_arch[i])
+      {
+         fprintf(stderr, "**_celt_autocorr() mismatch, n=%d lag=%d overlap=%d, ac[%d]**\n",
+               n, lag, overlap, i);
+         return 1;
+      }
+   }
+   return 0;
+}
+
+int main(void)
+{
+   const int arch = opus_select_arch();
+   opus_val16 window[OVERLAP];
+   int count, k, i;
+   ALLOC_STACK;
+   srand(0);
+   /* Same shape as the CELT mode window, in Q15 */
+   for (i=0;i<OVERLAP;i++)
+   {
+      double s = sin(.5*M_PI*(i+.5)/OVERLAP);
+      window[i] = (opus_val16)floor(.5+32767*sin(.5*M_PI*s*s));
+   }
+   printf("Testing celt_fir(), celt_iir() and _celt_autocorr() optimizations ...\n");
+   for (count=0;count<LOOPS;count++)
+   {
+      for (k=0;k<NB_SIZES;k++)
+      {
+         int N = sizes[k];
+         if (test_fir(N, arch) || test_iir(N, arch))
+            return 1;
+         /* pitch_downsample() and the PLC LPC analysis. The C version needs
+            at least 3 samples past the lag for its xcorr. */
+         if (N >= 4+3 && test_autocorr(N, 4, NULL, 0, arch))
+            return 1;
+         if (N >= LPC_ORDER+3 && test_autocorr(N, LPC_ORDER, window,
+               IMIN(OVERLAP, N/2), arch))
+            return 1;
+         /* Overlap longer than half the frame takes the scalar path */
+         if (N >= LPC_ORDER+3 && N < 2*OVERLAP && test_autocorr(N, LPC_ORDER, window,
+               IMIN(OVERLAP, N-1), arch))
+            return 1;
+      }
+   }
+   printf("  celt_fir():       C %6.3f s, optimized %6.3f s\n",
+         (double)fir_c/CLOCKS_PER_SEC, (double)fir_opt/CLOCKS_PER_SEC);
+   printf("  celt_iir():       C %6.3f s, optimized %6.3f s\n",
+         (double)iir_c/CLOCKS_PER_SEC, (double)iir_opt/CLOCKS_PER_SEC);
+   printf("  _celt_autocorr(): C %6.3f s, optimized %6.3f s\n",
+         (double)ac_c/CLOCKS_PER_SEC, (double)ac_opt/CLOCKS_PER_SEC);
+   printf("celt_fir(), celt_iir() and _celt_autocorr() optimizations passed\n");
+   return 0;
+}
+
+#else
+
+int main(void)
+{
+   printf("celt_fir(), celt_iir() and _celt_autocorr() optimization test needs FIXED_POINT, skipped\n");
+   return 0;
+}
+
+#endif
@@ -0,0 +1,146 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "celt.h"
+#include "modes.h"
+#include "quant_bands.h"
+#include "entenc.h"
+#include "entdec.h"
+#include "stack_alloc.h"
+
+#define FRAMES 20000
+#define NB_BANDS 21
+#define BUF_SIZE 200
+
+/* Band energies of a talker: slow drifts, with onsets and drops to silence */
+static void next_energies(float *e, int C)
+{
+   int i, c;
+   int event = rand()%40;
+   for (c=0;c<C;c++)
+   {
+      for (i=0;i<NB_BANDS;i++)
+      {
+         if (event == 0)
+            e[i+c*NB_BANDS] += 10+rand()%10;
+         else if (event == 1)
+            e[i+c*NB_BANDS] -= 10+rand()%10;
+         else
+            e[i+c*NB_BANDS] += ((rand()%2001)-1000)/1000.f;
+         if (e[i+c*NB_BANDS] < -20)
+            e[i+c*NB_BANDS] = -20;
+         if (e[i+c*NB_BANDS] > 20)
+            e[i+c*NB_BANDS] = 20;
+      }
+   }
+}
+
+/* Codes the same energies with the two-pass search and with the single pass,
+   checks that the single pass decodes to what it encoded, and compares the
+   intra/inter choices, the bits spent and the time spent quantizing */
+static int test_single_pass(const CELTMode *m, int C, int LM, int nbBytes)
+{
+   float e[2*NB_BANDS];
+   opus_val16 eBands[2*NB_BANDS], oldE[2][2*NB_BANDS], decE[2*NB_BANDS], error[2*NB_BANDS];
+   opus_val32 delayedIntra[2] = {1, 1};
+   long agree = 0, bits[2] = {0, 0};
+   clock_t ticks[2] = {0, 0};
+   int i, frame, k;
+   for (i=0;i<C*NB_BANDS;i++)
+   {
+      e[i] = (float)(rand()%20 - 10);
+      oldE[0][i] = oldE[1][i] = decE[i] = -QCONST16(28.f,DB_SHIFT);
+   }
+   for (frame=0;frame<FRAMES;frame++)
+   {
+      unsigned char buf[2][BUF_SIZE];
+      int intra[2];
+      next_energies(e, C);
+      for (i=0;i<C*NB_BANDS;i++)
+         eBands[i] = (opus_val16)QCONST16(e[i],DB_SHIFT);
+      for (k=0;k<2;k++)
+      {
+         ec_enc enc;
+         ec_dec dec;
+         clock_t start;
+         ec_enc_init(&enc, buf[k], nbBytes);
+         start = clock();
+         quant_coarse_energy(m, 0, NB_BANDS, NB_BANDS, eBands, oldE[k], nbBytes*8, error, &enc,
+               C, LM, nbBytes, 0, &delayedIntra[k], k==0, k==1, 0, 0);
+         ticks[k] += clock() - start;
+         bits[k] += ec_tell(&enc);
+         ec_enc_done(&enc);
+         ec_dec_init(&dec, buf[k], nbBytes);
+         intra[k] = ec_dec_bit_logp(&dec, 3);
+         if (k==1)
+         {
+            unquant_coarse_energy(m, 0, NB_BANDS, decE, intra[k], &dec, C, LM);
+            for (i=0;i<C*NB_BANDS;i++)
+            {
+               if (decE[i] != oldE[1][i])
+               {
+                  fprintf(stderr, "**single pass coarse energy decoded differently, frame %d band %d**\n",
+                        frame, i);
+                  return 1;
+               }
+            }
+         }
+      }
+      agree += intra[0] == intra[1];
+   }
+   printf("  C=%d LM=%d %3d bytes: same choice as two passes in %.1f%% of frames, %.2f vs %.2f bits per frame\n",
+         C, LM, nbBytes, 100.f*agree/FRAMES, (float)bits[1]/FRAMES, (float)bits[0]/FRAMES);
+   /* Reported only: clock() is too coarse and too noisy here to fail the test on */
+   printf("    single pass %.3f us vs two passes %.3f us per frame\n",
+         1e6*ticks[1]/CLOCKS_PER_SEC/FRAMES, 1e6*ticks[0]/CLOCKS_PER_SEC/FRAMES);
+   if (agree < FRAMES*9/10 || bits[1] > bits[0]*102/100)
+   {
+      fprintf(stderr, "**single pass picks intra/inter prediction poorly**\n");
+      return 1;
+   }
+   return 0;
+}
+
+int main(void)
+{
+   const CELTMode *m;
+   ALLOC_STACK;
+   srand(0);
+   m = opus_custom_mode_create(48000, 960, NULL);
+   printf("Testing single pass coarse energy quantization ...\n");
+   if (test_single_pass(m, 1, 3, 60) || test_single_pass(m, 1, 2, 40) || test_single_pass(m, 2, 3, 160)
+         || test_single_pass(m, 1, 0, 20))
+      return 1;
+   printf("Single pass coarse energy quantization passed\n");
+   return 0;
+}
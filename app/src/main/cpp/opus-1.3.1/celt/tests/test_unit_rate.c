@@ -0,0 +1,265 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "celt.h"
+#include "modes.h"
+#include "rate.h"
+#include "entenc.h"
+#include "entdec.h"
+#include "cpu_support.h"
+#include "stack_alloc.h"
+
+#ifndef M_PI
+#define M_PI 3.141592653
+#endif
+
+#define LOOPS 100000
+#define NB_KEYS 8
+#define BUF_SIZE 1275
+#define MAX_BANDS 21
+
+typedef struct {
+   int start, end, C, LM, alloc_trim;
+   opus_int32 total;
+   int offsets[MAX_BANDS];
+   int prev, signalBandwidth, intensity, dual_stereo;
+} AllocInputs;
+
+static void random_inputs(AllocInputs *in, const CELTMode *m)
+{
+   int j;
+   in->C = 1+rand()%2;
+   in->LM = rand()%4;
+   in->start = rand()%4 ? 0 : 17;
+   in->end = m->effEBands - (rand()%2 ? 0 : rand()%4);
+   in->alloc_trim = rand()%11;
+   in->total = (rand()%(BUF_SIZE*8)) << BITRES;
+   for (j=0;j<MAX_BANDS;j++)
+      in->offsets[j] = rand()%4 ? 0 : in->C*(rand()%6)<<BITRES;
+   in->prev = rand()%(in->end+1);
+   in->signalBandwidth = rand()%in->end;
+   in->intensity = in->start+rand()%(in->end-in->start+1);
+   in->dual_stereo = rand()%2;
+}
+
+/* Runs the same allocation with and without a cache and checks that both
+   the results and the coded bits match, when encoding and then decoding */
+static int test_allocation(const CELTMode *m, const AllocInputs *in, AllocCache *enc_cache,
+      AllocCache *dec_cache)
+{
+   int cap[MAX_BANDS];
+   int pulses[2][MAX_BANDS], ebits[2][MAX_BANDS], fine_priority[2][MAX_BANDS];
+   int intensity[2], dual_stereo[2], coded[2];
+   opus_int32 balance[2];
+   unsigned char buf[2][BUF_SIZE];
+   int k, pre;
+   init_caps(m, cap, in->LM, in->C);
+   pre = rand()%1000;
+   for (k=0;k<2;k++)
+   {
+      ec_enc enc;
+      ec_enc_init(&enc, buf[k], BUF_SIZE);
+      /* Something ahead of it in the frame */
+      ec_enc_uint(&enc, pre, 1000);
+      intensity[k] = in->intensity;
+      dual_stereo[k] = in->dual_stereo;
+      memset(pulses[k], 0, sizeof(pulses[k]));
+      memset(ebits[k], 0, sizeof(ebits[k]));
+      memset(fine_priority[k], 0, sizeof(fine_priority[k]));
+      coded[k] = clt_compute_allocation(m, in->start, in->end, in->offsets, cap, in->alloc_trim,
+            &intensity[k], &dual_stereo[k], in->total, &balance[k], pulses[k], ebits[k],
+            fine_priority[k], in->C, in->LM, &enc, 1, in->prev, in->signalBandwidth,
+            k ? enc_cache : NULL);
+      ec_enc_uint(&enc, pre, 1000);
+      ec_enc_done(&enc);
+   }
+   if (coded[0] != coded[1] || balance[0] != balance[1] || intensity[0] != intensity[1]
+         || dual_stereo[0] != dual_stereo[1] || memcmp(pulses[0], pulses[1], sizeof(pulses[0]))
+         || memcmp(ebits[0], ebits[1], sizeof(ebits[0]))
+         || memcmp(fine_priority[0], fine_priority[1], sizeof(fine_priority[0])))
+   {
+      fprintf(stderr, "**cached encoder allocation differs**\n");
+      return 1;
+   }
+   if (memcmp(buf[0], buf[1], BUF_SIZE))
+   {
+      fprintf(stderr, "**cached encoder allocation coded different bits**\n");
+      return 1;
+   }
+   for (k=0;k<2;k++)
+   {
+      ec_dec dec;
+      ec_dec_init(&dec, buf[0], BUF_SIZE);
+      if ((int)ec_dec_uint(&dec, 1000) != pre)
+         return 1;
+      intensity[k] = dual_stereo[k] = 0;
+      memset(pulses[k], 0, sizeof(pulses[k]));
+      memset(ebits[k], 0, sizeof(ebits[k]));
+      memset(fine_priority[k], 0, sizeof(fine_priority[k]));
+      coded[k] = clt_compute_allocation(m, in->start, in->end, in->offsets, cap, in->alloc_trim,
+            &intensity[k], &dual_stereo[k], in->total, &balance[k], pulses[k], ebits[k],
+            fine_priority[k], in->C, in->LM, &dec, 0, 0, 0, k ? dec_cache : NULL);
+      if ((int)ec_dec_uint(&dec, 1000) != pre)
+      {
+         fprintf(stderr, "**decoder allocation read the wrong number of bits**\n");
+         return 1;
+      }
+   }
+   if (coded[0] != coded[1] || balance[0] != balance[1] || intensity[0] != intensity[1]
+         || dual_stereo[0] != dual_stereo[1] || memcmp(pulses[0], pulses[1], sizeof(pulses[0]))
+         || memcmp(ebits[0], ebits[1], sizeof(ebits[0]))
+         || memcmp(fine_priority[0], fine_priority[1], sizeof(fine_priority[0])))
+   {
+      fprintf(stderr, "**cached decoder allocation differs**\n");
+      return 1;
+   }
+   return 0;
+}
+
+static int test_random_allocations(const CELTMode *m)
+{
+   AllocInputs keys[NB_KEYS];
+   AllocCache enc_cache, dec_cache;
+   int i;
+   memset(&enc_cache, 0, sizeof(enc_cache));
+   memset(&dec_cache, 0, sizeof(dec_cache));
+   for (i=0;i<NB_KEYS;i++)
+      random_inputs(&keys[i], m);
+   for (i=0;i<LOOPS;i++)
+   {
+      AllocInputs in;
+      int r = rand()%8;
+      if (r < 2)
+      {
+         random_inputs(&in, m);
+         keys[rand()%NB_KEYS] = in;
+      } else {
+         in = keys[rand()%NB_KEYS];
+         /* Same key with another budget, as in consecutive CBR frames */
+         if (r <= 4)
+            in.total = IMAX(0, in.total + ((rand()%401)-200));
+         if (r == 2)
+         {
+            in.prev = rand()%(in.end+1);
+            in.intensity = in.start+rand()%(in.end-in.start+1);
+            in.dual_stereo = rand()%2;
+         }
+      }
+      if (test_allocation(m, &in, &enc_cache, &dec_cache))
+         return 1;
+   }
+   printf("  random inputs: encoder %u hits, %u misses, decoder %u hits, %u misses\n",
+         enc_cache.hits, enc_cache.misses, dec_cache.hits, dec_cache.misses);
+   if (enc_cache.hits == 0 || dec_cache.hits == 0)
+   {
+      fprintf(stderr, "**allocation cache never hit**\n");
+      return 1;
+   }
+   return 0;
+}
+
+/* Hit rate of a CBR CELT encoder and decoder on a voice-like signal */
+static int test_cbr_stream(int C, int frame_size, int nbBytes)
+{
+   CELTEncoder *enc;
+   CELTDecoder *dec;
+   opus_val16 pcm[2*960], out[2*960];
+   unsigned char packet[BUF_SIZE];
+   opus_uint32 enc_hits, enc_misses, dec_hits, dec_misses;
+   double phase = 0;
+   int i, j, frame;
+   int arch = opus_select_arch();
+   enc = (CELTEncoder *)malloc(celt_encoder_get_size(C));
+   dec = (CELTDecoder *)malloc(celt_decoder_get_size(C));
+   if (celt_encoder_init(enc, 48000, C, arch) != OPUS_OK
+         || celt_decoder_init(dec, 48000, C) != OPUS_OK)
+      return 1;
+   celt_encoder_ctl(enc, CELT_SET_SIGNALLING(0));
+   celt_decoder_ctl(dec, CELT_SET_SIGNALLING(0));
+   for (frame=0;frame<500;frame++)
+   {
+      int len;
+      /* A gliding harmonic tone with a syllable envelope, plus some noise */
+      double f0 = 120+40*sin(2*M_PI*frame/97.);
+      double env = .2+.8*fabs(sin(2*M_PI*frame/23.));
+      for (i=0;i<frame_size;i++)
+      {
+         double v = 0;
+         phase += 2*M_PI*f0/48000;
+         for (j=1;j<=8;j++)
+            v += sin(j*phase)/j;
+         v = env*.15*v + .01*((rand()%2001)-1000)/1000.;
+         for (j=0;j<C;j++)
+#ifdef FIXED_POINT
+            pcm[i*C+j] = (opus_val16)floor(.5+32767*v);
+#else
+            pcm[i*C+j] = (opus_val16)v;
+#endif
+      }
+      len = celt_encode_with_ec(enc, pcm, frame_size, packet, nbBytes, NULL);
+      if (len != nbBytes)
+         return 1;
+      if (celt_decode_with_ec(dec, packet, len, out, frame_size, NULL, 0) != frame_size)
+         return 1;
+   }
+   celt_encoder_ctl(enc, CELT_GET_ALLOC_CACHE_HITS(&enc_hits));
+   celt_encoder_ctl(enc, CELT_GET_ALLOC_CACHE_MISSES(&enc_misses));
+   celt_decoder_ctl(dec, CELT_GET_ALLOC_CACHE_HITS(&dec_hits));
+   celt_decoder_ctl(dec, CELT_GET_ALLOC_CACHE_MISSES(&dec_misses));
+   printf("  CBR %d ch, %d samples, %d bytes: encoder %u hits, %u misses, decoder %u hits, %u misses\n",
+         C, frame_size, nbBytes, enc_hits, enc_misses, dec_hits, dec_misses);
+   free(enc);
+   free(dec);
+   if (enc_hits+enc_misses != 500 || dec_hits+dec_misses != 500)
+   {
+      fprintf(stderr, "**allocation cache counters are off**\n");
+      return 1;
+   }
+   return 0;
+}
+
+int main(void)
+{
+   const CELTMode *m;
+   ALLOC_STACK;
+   srand(0);
+   m = opus_custom_mode_create(48000, 960, NULL);
+   printf("Testing cached CELT bit allocation ...\n");
+   if (test_random_allocations(m))
+      return 1;
+   if (test_cbr_stream(1, 960, 60) || test_cbr_stream(1, 480, 40) || test_cbr_stream(2, 960, 160))
+      return 1;
+   printf("Cached CELT bit allocation passed\n");
+   return 0;
+}
@@ -0,0 +1,399 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "celt_lpc.h"
+#include "stack_alloc.h"
+#include "mathops.h"
+#include "pitch.h"
+#include "x86cpu.h"
+
+#if defined(FIXED_POINT)
+
+/* Packs two 16-bit taps so that _mm256_madd_epi16() applies a to the even
+   and b to the odd 16-bit lanes */
+static OPUS_INLINE opus_int32 pack_taps(opus_val16 a, opus_val16 b)
+{
+   return (opus_int32)((opus_uint32)(opus_uint16)a | ((opus_uint32)(opus_uint16)b << 16));
+}
+
+/* MULT16_16_Q15() of 16 lanes, built from both halves of the 32-bit products
+   so that it truncates like the C macro */
+static OPUS_INLINE __m256i mult16_16_q15_avx2(__m256i a, __m256i b)
+{
+   return _mm256_or_si256(_mm256_slli_epi16(_mm256_mulhi_epi16(a, b), 1),
+                          _mm256_srli_epi16(_mm256_mullo_epi16(a, b), 15));
+}
+
+void celt_fir_avx2(const opus_val16 *x,
+         const opus_val16 *num,
+         opus_val16 *y,
+         int N,
+         int ord,
+         int arch)
+{
+   int i,j,taps;
+   VARDECL(opus_val16, rnum);
+   VARDECL(opus_int32, rnum2);
+   __m256i round;
+   SAVE_STACK;
+   celt_assert(x != y);
+   /* x[i] itself is the last tap, with a gain of 1 << SIG_SHIFT, as it is
+      added to the sum before rounding */
+   taps = ord+1;
+   ALLOC(rnum, taps+1, opus_val16);
+   ALLOC(rnum2, (taps+1)>>1, opus_int32);
+   for(i=0;i<ord;i++)
+      rnum[i] = num[ord-i-1];
+   rnum[ord] = 1<<SIG_SHIFT;
+   rnum[ord+1] = 0;
+   for(j=0;j<taps;j+=2)
+      rnum2[j>>1] = pack_taps(rnum[j], rnum[j+1]);
+   round = _mm256_set1_epi32(EXTEND32(1) << SIG_SHIFT >> 1);
+
+   for (i=0;i<N-15;i+=16)
+   {
+      /* Interleaving x[k] and x[k+1] leaves outputs 0-3 and 8-11 in sum_lo
+         and outputs 4-7 and 12-15 in sum_hi, which the pack puts back in
+         order */
+      __m256i sum_lo, sum_hi, x0, x1, taps2;
+      const opus_val16 *xptr = x+i-ord;
+      sum_lo = _mm256_setzero_si256();
+      sum_hi = _mm256_setzero_si256();
+      for (j=0;j<taps-1;j+=2)
+      {
+         x0 = _mm256_loadu_si256((const __m256i *)(xptr+j));
+         x1 = _mm256_loadu_si256((const __m256i *)(xptr+j+1));
+         taps2 = _mm256_set1_epi32(rnum2[j>>1]);
+         sum_lo = _mm256_add_epi32(sum_lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(x0, x1), taps2));
+         sum_hi = _mm256_add_epi32(sum_hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(x0, x1), taps2));
+      }
+      if (j<taps)
+      {
+         /* Odd number of taps: pair the last one with a zero tap rather than
+            reading past x[i+15] */
+         x0 = _mm256_loadu_si256((const __m256i *)(xptr+j));
+         taps2 = _mm256_set1_epi32(rnum2[j>>1]);
+         sum_lo = _mm256_add_epi32(sum_lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(x0, x0), taps2));
+         sum_hi = _mm256_add_epi32(sum_hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(x0, x0), taps2));
+      }
+      sum_lo = _mm256_srai_epi32(_mm256_add_epi32(sum_lo, round), SIG_SHIFT);
+      sum_hi = _mm256_srai_epi32(_mm256_add_epi32(sum_hi, round), SIG_SHIFT);
+      _mm256_storeu_si256((__m256i *)(y+i), _mm256_packs_epi32(sum_lo, sum_hi));
+   }
+   for (;i<N;i++)
+   {
+      opus_val32 sum = SHL32(EXTEND32(x[i]), SIG_SHIFT);
+      for (j=0;j<ord;j++)
+         sum = MAC16_16(sum,rnum[j],x[i+j-ord]);
+      y[i] = SATURATE16(PSHR32(sum, SIG_SHIFT));
+   }
+   RESTORE_STACK;
+   (void)arch;
+}
+
+/* Adds taps k and k+1 to the sums of the 8-output block, the past outputs
+   they apply to being a window of the 16 in lo and hi, which start at tap
+   k&~7 */
+#define IIR_TAPS(lo, hi, k) do { \
+   __m128i w0_ = _mm_alignr_epi8(hi, lo, 2*((k)&7)); \
+   __m128i w1_ = _mm_alignr_epi8(hi, lo, 2*((k)&7)+2); \
+   __m128i t_ = _mm_set1_epi32(rden2[(k)>>1]); \
+   sum_lo = _mm_add_epi32(sum_lo, _mm_madd_epi16(_mm_unpacklo_epi16(w0_, w1_), t_)); \
+   sum_hi = _mm_add_epi32(sum_hi, _mm_madd_epi16(_mm_unpackhi_epi16(w0_, w1_), t_)); \
+} while (0)
+
+void celt_iir_avx2(const opus_val32 *_x,
+         const opus_val16 *den,
+         opus_val32 *_y,
+         int N,
+         int ord,
+         opus_val16 *mem,
+         int arch)
+{
+   int i,j;
+   opus_val16 rden[LPC_ORDER];
+   opus_int32 rden2[LPC_ORDER/2];
+   opus_val16 y[LPC_ORDER+16];
+   opus_val16 *yptr;
+   __m128i y_0, y_8, y_16;
+
+   if (ord != LPC_ORDER)
+   {
+      celt_iir_c(_x, den, _y, N, ord, mem, arch);
+      return;
+   }
+   for(i=0;i<LPC_ORDER;i++)
+      rden[i] = den[LPC_ORDER-i-1];
+   for(i=0;i<LPC_ORDER;i+=2)
+      rden2[i>>1] = pack_taps(rden[i], rden[i+1]);
+   for(i=0;i<LPC_ORDER;i++)
+      y[i] = -mem[LPC_ORDER-i-1];
+   for(;i<LPC_ORDER+16;i++)
+      y[i]=0;
+   /* The last 24 outputs stay in registers: storing them one at a time and
+      reading them back as vectors would stall on every block */
+   y_0 = _mm_loadu_si128((const __m128i *)y);
+   y_8 = _mm_loadu_si128((const __m128i *)(y+8));
+   y_16 = _mm_loadu_si128((const __m128i *)(y+16));
+   for (i=0;i<N-7;i+=8)
+   {
+      /* Unroll by 8 as if it were an FIR filter */
+      opus_val32 sum[8];
+      opus_val16 y0, y1, y2, y3, y4, y5, y6, y7;
+      __m128i sum_lo, sum_hi, zero;
+      sum_lo = _mm_loadu_si128((const __m128i *)(_x+i));
+      sum_hi = _mm_loadu_si128((const __m128i *)(_x+i+4));
+      zero = _mm_setzero_si128();
+      IIR_TAPS(y_0, y_8, 0);
+      IIR_TAPS(y_0, y_8, 2);
+      IIR_TAPS(y_0, y_8, 4);
+      IIR_TAPS(y_0, y_8, 6);
+      IIR_TAPS(y_8, y_16, 8);
+      IIR_TAPS(y_8, y_16, 10);
+      IIR_TAPS(y_8, y_16, 12);
+      IIR_TAPS(y_8, y_16, 14);
+      IIR_TAPS(y_16, zero, 16);
+      IIR_TAPS(y_16, zero, 18);
+      IIR_TAPS(y_16, zero, 20);
+      IIR_TAPS(y_16, zero, 22);
+      _mm_storeu_si128((__m128i *)sum, sum_lo);
+      _mm_storeu_si128((__m128i *)(sum+4), sum_hi);
+
+      /* Patch up the result to compensate for the fact that this is an IIR.
+         The most recent output goes last, so that only one MAC waits for it. */
+      y0 = -SROUND16(sum[0],SIG_SHIFT);
+      _y[i+0] = sum[0];
+      sum[1] = MAC16_16(sum[1], y0, den[0]);
+      y1 = -SROUND16(sum[1],SIG_SHIFT);
+      _y[i+1] = sum[1];
+      sum[2] = MAC16_16(sum[2], y0, den[1]);
+      sum[2] = MAC16_16(sum[2], y1, den[0]);
+      y2 = -SROUND16(sum[2],SIG_SHIFT);
+      _y[i+2] = sum[2];
+      sum[3] = MAC16_16(sum[3], y0, den[2]);
+      sum[3] = MAC16_16(sum[3], y1, den[1]);
+      sum[3] = MAC16_16(sum[3], y2, den[0]);
+      y3 = -SROUND16(sum[3],SIG_SHIFT);
+      _y[i+3] = sum[3];
+      sum[4] = MAC16_16(sum[4], y0, den[3]);
+      sum[4] = MAC16_16(sum[4], y1, den[2]);
+      sum[4] = MAC16_16(sum[4], y2, den[1]);
+      sum[4] = MAC16_16(sum[4], y3, den[0]);
+      y4 = -SROUND16(sum[4],SIG_SHIFT);
+      _y[i+4] = sum[4];
+      sum[5] = MAC16_16(sum[5], y0, den[4]);
+      sum[5] = MAC16_16(sum[5], y1, den[3]);
+      sum[5] = MAC16_16(sum[5], y2, den[2]);
+      sum[5] = MAC16_16(sum[5], y3, den[1]);
+      sum[5] = MAC16_16(sum[5], y4, den[0]);
+      y5 = -SROUND16(sum[5],SIG_SHIFT);
+      _y[i+5] = sum[5];
+      sum[6] = MAC16_16(sum[6], y0, den[5]);
+      sum[6] = MAC16_16(sum[6], y1, den[4]);
+      sum[6] = MAC16_16(sum[6], y2, den[3]);
+      sum[6] = MAC16_16(sum[6], y3, den[2]);
+      sum[6] = MAC16_16(sum[6], y4, den[1]);
+      sum[6] = MAC16_16(sum[6], y5, den[0]);
+      y6 = -SROUND16(sum[6],SIG_SHIFT);
+      _y[i+6] = sum[6];
+      sum[7] = MAC16_16(sum[7], y0, den[6]);
+      sum[7] = MAC16_16(sum[7], y1, den[5]);
+      sum[7] = MAC16_16(sum[7], y2, den[4]);
+      sum[7] = MAC16_16(sum[7], y3, den[3]);
+      sum[7] = MAC16_16(sum[7], y4, den[2]);
+      sum[7] = MAC16_16(sum[7], y5, den[1]);
+      sum[7] = MAC16_16(sum[7], y6, den[0]);
+      y7 = -SROUND16(sum[7],SIG_SHIFT);
+      _y[i+7] = sum[7];
+
+      y_0 = y_8;
+      y_8 = y_16;
+      y_16 = _mm_setr_epi16(y0, y1, y2, y3, y4, y5, y6, y7);
+   }
+   /* Whatever is left goes through the same 4-output block and scalar loop as
+      in celt_iir_c() */
+   _mm_storeu_si128((__m128i *)y, y_0);
+   _mm_storeu_si128((__m128i *)(y+8), y_8);
+   _mm_storeu_si128((__m128i *)(y+16), y_16);
+   yptr = y;
+   if (i<N-3)
+   {
+      opus_val32 sum[4];
+      sum[0]=_x[i];
+      sum[1]=_x[i+1];
+      sum[2]=_x[i+2];
+      sum[3]=_x[i+3];
+      xcorr_kernel(rden, yptr, sum, LPC_ORDER, arch);
+      yptr[LPC_ORDER  ] = -SROUND16(sum[0],SIG_SHIFT);
+      _y[i  ] = sum[0];
+      sum[1] = MAC16_16(sum[1], yptr[LPC_ORDER  ], den[0]);
+      yptr[LPC_ORDER+1] = -SROUND16(sum[1],SIG_SHIFT);
+      _y[i+1] = sum[1];
+      sum[2] = MAC16_16(sum[2], yptr[LPC_ORDER+1], den[0]);
+      sum[2] = MAC16_16(sum[2], yptr[LPC_ORDER  ], den[1]);
+      yptr[LPC_ORDER+2] = -SROUND16(sum[2],SIG_SHIFT);
+      _y[i+2] = sum[2];
+      sum[3] = MAC16_16(sum[3], yptr[LPC_ORDER+2], den[0]);
+      sum[3] = MAC16_16(sum[3], yptr[LPC_ORDER+1], den[1]);
+      sum[3] = MAC16_16(sum[3], yptr[LPC_ORDER  ], den[2]);
+      yptr[LPC_ORDER+3] = -SROUND16(sum[3],SIG_SHIFT);
+      _y[i+3] = sum[3];
+      i+=4;
+      yptr+=4;
+   }
+   for (;i<N;i++,yptr++)
+   {
+      opus_val32 sum = _x[i];
+      for (j=0;j<LPC_ORDER;j++)
+         sum -= MULT16_16(rden[j],yptr[j]);
+      yptr[LPC_ORDER] = SROUND16(sum,SIG_SHIFT);
+      _y[i] = sum;
+   }
+   for(i=0;i<LPC_ORDER;i++)
+      mem[i] = _y[N-i-1];
+}
+
+#undef IIR_TAPS
+
+int _celt_autocorr_avx2(
+                   const opus_val16 *x,   /*  in: [0...n-1] samples x   */
+                   opus_val32       *ac,  /* out: [0...lag-1] ac values */
+                   const opus_val16       *window,
+                   int          overlap,
+                   int          lag,
+                   int          n,
+                   int          arch
+                  )
+{
+   int i;
+   int shift;
+   opus_val32 ac0;
+   VARDECL(opus_val16, xx);
+   SAVE_STACK;
+   /* Zero-padded by lag samples so that the correlation of the last samples,
+      done separately in _celt_autocorr_c(), is part of the same xcorr */
+   ALLOC(xx, n+lag, opus_val16);
+   celt_assert(n>0);
+   celt_assert(overlap>=0);
+   OPUS_COPY(xx, x, n);
+   if (2*overlap <= n)
+   {
+      const __m256i reverse = _mm256_setr_epi8(
+            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+      for (i=0;i<overlap-15;i+=16)
+      {
+         __m256i w, w_rev;
+         w = _mm256_loadu_si256((const __m256i *)(window+i));
+         w_rev = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(w, reverse), _MM_SHUFFLE(1, 0, 3, 2));
+         _mm256_storeu_si256((__m256i *)(xx+i),
+               mult16_16_q15_avx2(_mm256_loadu_si256((const __m256i *)(x+i)), w));
+         _mm256_storeu_si256((__m256i *)(xx+n-i-16),
+               mult16_16_q15_avx2(_mm256_loadu_si256((const __m256i *)(x+n-i-16)), w_rev));
+      }
+   } else {
+      i = 0;
+   }
+   for (;i<overlap;i++)
+   {
+      xx[i] = MULT16_16_Q15(x[i],window[i]);
+      xx[n-i-1] = MULT16_16_Q15(x[n-i-1],window[i]);
+   }
+
+   {
+      __m256i acc = _mm256_setzero_si256();
+      ac0 = 1+(n<<7);
+      /* Each square is shifted before the sum, in any order */
+      for (i=0;i<n-15;i+=16)
+      {
+         __m256i v, lo, hi;
+         v = _mm256_loadu_si256((const __m256i *)(xx+i));
+         lo = _mm256_mullo_epi16(v, v);
+         hi = _mm256_mulhi_epi16(v, v);
+         acc = _mm256_add_epi32(acc, _mm256_srli_epi32(_mm256_unpacklo_epi16(lo, hi), 9));
+         acc = _mm256_add_epi32(acc, _mm256_srli_epi32(_mm256_unpackhi_epi16(lo, hi), 9));
+      }
+      acc = _mm256_add_epi32(acc, _mm256_permute2x128_si256(acc, acc, 1));
+      acc = _mm256_add_epi32(acc, _mm256_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+      acc = _mm256_add_epi32(acc, _mm256_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+      ac0 += _mm256_cvtsi256_si32(acc);
+      for (;i<n;i++)
+         ac0 += SHR32(MULT16_16(xx[i],xx[i]),9);
+   }
+
+   shift = celt_ilog2(ac0)-30+10;
+   shift = (shift)/2;
+   if (shift>0)
+   {
+      /* PSHR32() as (x >> shift) plus the last bit shifted out, which cannot
+         overflow in 16 bits */
+      const __m128i count = _mm_cvtsi32_si128(shift);
+      const __m128i count1 = _mm_cvtsi32_si128(shift-1);
+      const __m256i one = _mm256_set1_epi16(1);
+      for (i=0;i<n-15;i+=16)
+      {
+         __m256i v = _mm256_loadu_si256((const __m256i *)(xx+i));
+         v = _mm256_add_epi16(_mm256_sra_epi16(v, count),
+                              _mm256_and_si256(_mm256_sra_epi16(v, count1), one));
+         _mm256_storeu_si256((__m256i *)(xx+i), v);
+      }
+      for (;i<n;i++)
+         xx[i] = PSHR32(xx[i], shift);
+   } else
+      shift = 0;
+
+   OPUS_CLEAR(xx+n, lag);
+   celt_pitch_xcorr(xx, xx, ac, n, lag+1, arch);
+
+   shift = 2*shift;
+   if (shift<=0)
+      ac[0] += SHL32((opus_int32)1, -shift);
+   if (ac[0] < 268435456)
+   {
+      int shift2 = 29 - EC_ILOG(ac[0]);
+      for (i=0;i<=lag;i++)
+         ac[i] = SHL32(ac[i], shift2);
+      shift -= shift2;
+   } else if (ac[0] >= 536870912)
+   {
+      int shift2=1;
+      if (ac[0] >= 1073741824)
+         shift2++;
+      for (i=0;i<=lag;i++)
+         ac[i] = SHR32(ac[i], shift2);
+      shift += shift2;
+   }
+
+   RESTORE_STACK;
+   return shift;
+}
+
+#endif
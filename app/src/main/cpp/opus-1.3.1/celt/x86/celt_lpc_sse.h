@@ -32,9 +32,9 @@
 #include "config.h"
 #endif
 
-#if defined(OPUS_X86_MAY_HAVE_SSE4_1) && defined(FIXED_POINT)
-#define OVERRIDE_CELT_FIR
+#if defined(FIXED_POINT)
 
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
 void celt_fir_sse4_1(
          const opus_val16 *x,
          const opus_val16 *num,
@@ -42,8 +42,51 @@ void celt_fir_sse4_1(
          int N,
          int ord,
          int arch);
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+void celt_fir_avx2(
+         const opus_val16 *x,
+         const opus_val16 *num,
+         opus_val16 *y,
+         int N,
+         int ord,
+         int arch);
 
-#if defined(OPUS_X86_PRESUME_SSE4_1)
+void celt_iir_avx2(
+         const opus_val32 *x,
+         const opus_val16 *den,
+         opus_val32 *y,
+         int N,
+         int ord,
+         opus_val16 *mem,
+         int arch);
+
+int _celt_autocorr_avx2(
+         const opus_val16 *x,
+         opus_val32 *ac,
+         const opus_val16 *window,
+         int overlap,
+         int lag,
+         int n,
+         int arch);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+#define OVERRIDE_CELT_FIR
+#define celt_fir(x, num, y, N, ord, arch) \
+    ((void)arch, celt_fir_avx2(x, num, y, N, ord, arch))
+
+#define OVERRIDE_CELT_IIR
+#define celt_iir(x, den, y, N, ord, mem, arch) \
+    ((void)arch, celt_iir_avx2(x, den, y, N, ord, mem, arch))
+
+#define OVERRIDE_CELT_AUTOCORR
+#define _celt_autocorr(x, ac, window, overlap, lag, n, arch) \
+    ((void)arch, _celt_autocorr_avx2(x, ac, window, overlap, lag, n, arch))
+
+#elif defined(OPUS_X86_PRESUME_SSE4_1) && !defined(OPUS_X86_MAY_HAVE_AVX2)
+#define OVERRIDE_CELT_FIR
 #define celt_fir(x, num, y, N, ord, arch) \
     ((void)arch, celt_fir_sse4_1(x, num, y, N, ord, arch))
 
@@ -57,9 +100,39 @@ extern void (*const CELT_FIR_IMPL[OPUS_ARCHMASK + 1])(
          int ord,
          int arch);
 
+#define OVERRIDE_CELT_FIR
 #  define celt_fir(x, num, y, N, ord, arch) \
     ((*CELT_FIR_IMPL[(arch) & OPUS_ARCHMASK])(x, num, y, N, ord, arch))
 
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+
+extern void (*const CELT_IIR_IMPL[OPUS_ARCHMASK + 1])(
+         const opus_val32 *x,
+         const opus_val16 *den,
+         opus_val32 *y,
+         int N,
+         int ord,
+         opus_val16 *mem,
+         int arch);
+
+#define OVERRIDE_CELT_IIR
+#  define celt_iir(x, den, y, N, ord, mem, arch) \
+    ((*CELT_IIR_IMPL[(arch) & OPUS_ARCHMASK])(x, den, y, N, ord, mem, arch))
+
+extern int (*const CELT_AUTOCORR_IMPL[OPUS_ARCHMASK + 1])(
+         const opus_val16 *x,
+         opus_val32 *ac,
+         const opus_val16 *window,
+         int overlap,
+         int lag,
+         int n,
+         int arch);
+
+#define OVERRIDE_CELT_AUTOCORR
+#  define _celt_autocorr(x, ac, window, overlap, lag, n, arch) \
+    ((*CELT_AUTOCORR_IMPL[(arch) & OPUS_ARCHMASK])(x, ac, window, overlap, lag, n, arch))
+
+#endif
 #endif
 #endif
 
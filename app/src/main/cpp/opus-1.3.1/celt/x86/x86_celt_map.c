@@ -39,7 +39,8 @@
 
 # if defined(FIXED_POINT)
 
-#if defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)
+#if (defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) || \
+ (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2))
 
 void (*const CELT_FIR_IMPL[OPUS_ARCHMASK + 1])(
          const opus_val16 *x,
@@ -53,9 +54,52 @@ void (*const CELT_FIR_IMPL[OPUS_ARCHMASK + 1])(
   celt_fir_c,
   celt_fir_c,
   MAY_HAVE_SSE4_1(celt_fir), /* sse4.1  */
-  MAY_HAVE_SSE4_1(celt_fir)  /* avx  */
+  MAY_HAVE_SSE4_1(celt_fir), /* avx  */
+  MAY_HAVE_AVX2(celt_fir)    /* avx2 */
+};
+
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)
+
+void (*const CELT_IIR_IMPL[OPUS_ARCHMASK + 1])(
+         const opus_val32 *x,
+         const opus_val16 *den,
+         opus_val32       *y,
+         int              N,
+         int              ord,
+         opus_val16       *mem,
+         int              arch
+) = {
+  celt_iir_c,                /* non-sse */
+  celt_iir_c,
+  celt_iir_c,
+  celt_iir_c,                /* sse4.1  */
+  celt_iir_c,                /* avx  */
+  MAY_HAVE_AVX2(celt_iir)    /* avx2 */
+};
+
+int (*const CELT_AUTOCORR_IMPL[OPUS_ARCHMASK + 1])(
+         const opus_val16 *x,
+         opus_val32       *ac,
+         const opus_val16 *window,
+         int              overlap,
+         int              lag,
+         int              n,
+         int              arch
+) = {
+  _celt_autocorr_c,               /* non-sse */
+  _celt_autocorr_c,
+  _celt_autocorr_c,
+  _celt_autocorr_c,               /* sse4.1  */
+  _celt_autocorr_c,               /* avx  */
+  MAY_HAVE_AVX2(_celt_autocorr)   /* avx2 */
 };
 
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)
+
 void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
          const opus_val16 *x,
          const opus_val16 *y,
@@ -66,7 +110,8 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   xcorr_kernel_c,
   xcorr_kernel_c,
   MAY_HAVE_SSE4_1(xcorr_kernel), /* sse4.1  */
-  MAY_HAVE_SSE4_1(xcorr_kernel)  /* avx  */
+  MAY_HAVE_SSE4_1(xcorr_kernel), /* avx  */
+  MAY_HAVE_SSE4_1(xcorr_kernel)  /* avx2 */
 };
 
 #endif
@@ -83,7 +128,8 @@ opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   celt_inner_prod_c,
   MAY_HAVE_SSE2(celt_inner_prod),
   MAY_HAVE_SSE4_1(celt_inner_prod), /* sse4.1  */
-  MAY_HAVE_SSE4_1(celt_inner_prod)  /* avx  */
+  MAY_HAVE_SSE4_1(celt_inner_prod), /* avx  */
+  MAY_HAVE_SSE4_1(celt_inner_prod)  /* avx2 */
 };
 
 #endif
@@ -102,6 +148,7 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel),
+  MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel)
 };
 
@@ -114,6 +161,7 @@ opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod),
+  MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod)
 };
 
@@ -129,6 +177,7 @@ void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod),
+  MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod)
 };
 
@@ -145,6 +194,7 @@ void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const),
+  MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const)
 };
 
@@ -159,6 +209,7 @@ opus_val16 (*const OP_PVQ_SEARCH_IMPL[OPUS_ARCHMASK + 1])(
   op_pvq_search_c,
   MAY_HAVE_SSE2(op_pvq_search),
   MAY_HAVE_SSE2(op_pvq_search),
+  MAY_HAVE_SSE2(op_pvq_search),
   MAY_HAVE_SSE2(op_pvq_search)
 };
 #endif
@@ -31,6 +31,9 @@ CELT_SOURCES_SSE4_1 = \
 celt/x86/celt_lpc_sse4_1.c \
 celt/x86/pitch_sse4_1.c
 
+CELT_SOURCES_AVX2 = \
+celt/x86/celt_lpc_avx2.c
+
 CELT_SOURCES_ARM = \
 celt/arm/armcpu.c \
 celt/arm/arm_celt_map.c
@@ -42,6 +45,7 @@ CELT_AM_SOURCES_ARM_ASM = \
 celt/arm/armopts.s.in
 
 CELT_SOURCES_ARM_NEON_INTR = \
+celt/arm/celt_lpc_neon_intr.c \
 celt/arm/celt_neon_intr.c \
 celt/arm/pitch_neon_intr.c
 
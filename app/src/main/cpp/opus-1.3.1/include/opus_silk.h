@@ -0,0 +1,409 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file opus_silk.h
+ * @brief Opus reference implementation SILK-only API
+ */
+
+#ifndef OPUS_SILK_H
+#define OPUS_SILK_H
+
+#include "opus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup opus_silk Opus SILK-only API
+  * @{
+  *
+  * The SILK-only API is a reduced encoder and decoder for speech streams that
+  * never leave the SILK layer, e.g. 16 kHz voice at a fixed bitrate.
+  * Its states hold only a SILK encoder or decoder, without the CELT state,
+  * the tonality analysis or the delay buffers of a regular
+  * <code>OpusEncoder</code> or <code>OpusDecoder</code>, so they are several
+  * times smaller and initialize faster.
+  *
+  * The encoder produces standard SILK-only Opus packets (configurations 0 to
+  * 11 in <a href="https://tools.ietf.org/html/rfc6716">RFC 6716</a>), which
+  * any Opus decoder can play. It always behaves like an
+  * #OPUS_APPLICATION_VOIP encoder without the signal analysis: the bandwidth
+  * follows the bitrate, capped at wideband, and stereo input is always coded
+  * as stereo. It takes 10, 20, 40 or 60 ms frames and adds no extra
+  * look-ahead to SILK's own.
+  *
+  * The decoder decodes SILK-only packets, including the PLC and in-band FEC.
+  * Its output is identical to that of opus_decode() on the same packets.
+  * Hybrid and CELT-only packets are rejected with #OPUS_UNIMPLEMENTED. The
+  * CELT redundancy frame the regular encoder sometimes appends to a SILK-only
+  * packet on a bandwidth switch is skipped.
+  */
+
+/** Opus SILK-only encoder state.
+  * It is position independent and can be freely copied.
+  * @see opus_silk_encoder_create
+  * @see opus_silk_encoder_init
+  */
+typedef struct OpusSilkEncoder OpusSilkEncoder;
+
+/** Opus SILK-only decoder state.
+  * It is position independent and can be freely copied.
+  * @see opus_silk_decoder_create
+  * @see opus_silk_decoder_init
+  */
+typedef struct OpusSilkDecoder OpusSilkDecoder;
+
+/**\name SILK-only encoder functions */
+/**@{*/
+
+/** Gets the size of an <code>OpusSilkEncoder</code> structure.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2).
+  * @returns The size in bytes, or 0 if <code>channels</code> is invalid.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_silk_encoder_get_size(int channels);
+
+/** Allocates and initializes a SILK-only encoder state.
+  * @param Fs <tt>opus_int32</tt>: Sampling rate of the input signal (in Hz).
+  *                                This must be one of 8000, 12000, 16000,
+  *                                24000, or 48000.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) in the input
+  *                               signal.
+  * @param[out] error <tt>int*</tt>: #OPUS_OK on success, or an error code
+  *                                  (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusSilkEncoder *opus_silk_encoder_create(
+    opus_int32 Fs,
+    int channels,
+    int *error
+);
+
+/** Initializes a previously allocated SILK-only encoder state.
+  * The memory pointed to by \a st must be at least the size returned by
+  * opus_silk_encoder_get_size().
+  * To reset a previously initialized state, use the #OPUS_RESET_STATE CTL.
+  * @param st <tt>OpusSilkEncoder*</tt>: Encoder state to initialize.
+  * @param Fs <tt>opus_int32</tt>: Sampling rate of the input signal (in Hz).
+  *                                This must be one of 8000, 12000, 16000,
+  *                                24000, or 48000.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) in the input
+  *                               signal.
+  * @returns #OPUS_OK on success, or an error code (see @ref opus_errorcodes)
+  *          on failure.
+  */
+OPUS_EXPORT int opus_silk_encoder_init(
+    OpusSilkEncoder *st,
+    opus_int32 Fs,
+    int channels
+) OPUS_ARG_NONNULL(1);
+
+/** Encodes a SILK-only Opus frame.
+  * @param st <tt>OpusSilkEncoder*</tt>: Encoder state.
+  * @param[in] pcm <tt>const opus_int16*</tt>: Input signal (interleaved if
+  *                                            2 channels). The length is
+  *                                            <code>frame_size*channels</code>.
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal. This must be 10, 20, 40 or 60 ms
+  *                                 at the encoder sampling rate.
+  * @param[out] data <tt>unsigned char*</tt>: Output payload.
+  * @param max_data_bytes <tt>opus_int32</tt>: Size of the allocated memory
+  *                                            for the output payload.
+  * @returns The length of the encoded packet (in bytes) on success, or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  *          A 1-byte packet means the frame was not coded (DTX).
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_silk_encode(
+    OpusSilkEncoder *st,
+    const opus_int16 *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
+/** Frees an <code>OpusSilkEncoder</code> allocated by
+  * opus_silk_encoder_create().
+  * @param st <tt>OpusSilkEncoder*</tt>: Encoder state to be freed.
+  */
+OPUS_EXPORT void opus_silk_encoder_destroy(OpusSilkEncoder *st);
+
+/** Perform a CTL function on a SILK-only encoder.
+  *
+  * The supported requests are #OPUS_RESET_STATE, #OPUS_GET_FINAL_RANGE,
+  * #OPUS_GET_SAMPLE_RATE, #OPUS_GET_BANDWIDTH and the SET/GET pairs for
+  * #OPUS_SET_BITRATE, #OPUS_SET_COMPLEXITY, #OPUS_SET_VBR,
+  * #OPUS_SET_INBAND_FEC, #OPUS_SET_PACKET_LOSS_PERC, #OPUS_SET_DTX and
+  * #OPUS_SET_MAX_BANDWIDTH. Any other request returns #OPUS_UNIMPLEMENTED.
+  * @param st <tt>OpusSilkEncoder*</tt>: Encoder state.
+  * @param request This and all remaining parameters should be replaced by one
+  *                of the convenience macros in @ref opus_genericctls or
+  *                @ref opus_encoderctls.
+  */
+OPUS_EXPORT int opus_silk_encoder_ctl(OpusSilkEncoder *st, int request, ...) OPUS_ARG_NONNULL(1);
+
+/**@}*/
+
+/**\name SILK-only decoder functions */
+/**@{*/
+
+/** Gets the size of an <code>OpusSilkDecoder</code> structure.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2).
+  * @returns The size in bytes, or 0 if <code>channels</code> is invalid.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_silk_decoder_get_size(int channels);
+
+/** Allocates and initializes a SILK-only decoder state.
+  * @param Fs <tt>opus_int32</tt>: Sample rate to decode at (Hz).
+  *                                This must be one of 8000, 12000, 16000,
+  *                                24000, or 48000.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) to decode.
+  * @param[out] error <tt>int*</tt>: #OPUS_OK on success, or an error code
+  *                                  (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusSilkDecoder *opus_silk_decoder_create(
+    opus_int32 Fs,
+    int channels,
+    int *error
+);
+
+/** Initializes a previously allocated SILK-only decoder state.
+  * The memory pointed to by \a st must be at least the size returned by
+  * opus_silk_decoder_get_size().
+  * To reset a previously initialized state, use the #OPUS_RESET_STATE CTL.
+  * @param st <tt>OpusSilkDecoder*</tt>: Decoder state.
+  * @param Fs <tt>opus_int32</tt>: Sample rate to decode at (Hz).
+  *                                This must be one of 8000, 12000, 16000,
+  *                                24000, or 48000.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) to decode.
+  * @returns #OPUS_OK on success, or an error code (see @ref opus_errorcodes)
+  *          on failure.
+  */
+OPUS_EXPORT int opus_silk_decoder_init(
+    OpusSilkDecoder *st,
+    opus_int32 Fs,
+    int channels
+) OPUS_ARG_NONNULL(1);
+
+/** Decodes a SILK-only Opus packet.
+  * @param st <tt>OpusSilkDecoder*</tt>: Decoder state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input payload.
+  *                                                Use a NULL pointer to
+  *                                                indicate packet loss.
+  * @param len <tt>opus_int32</tt>: Number of bytes in payload.
+  * @param[out] pcm <tt>opus_int16*</tt>: Output signal (interleaved if
+  *                                       2 channels). The length is
+  *                                       <code>frame_size*channels</code>.
+  * @param frame_size <tt>int</tt>: Number of samples per channel of available
+  *                                 space in \a pcm. In the case of PLC
+  *                                 (data==NULL) or FEC (decode_fec=1), this
+  *                                 must be a multiple of 10 ms and is
+  *                                 exactly the duration of audio that is
+  *                                 missing.
+  * @param decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band
+  *                                 forward error correction data be decoded.
+  *                                 If no such data is available, the frame is
+  *                                 decoded as if it were lost.
+  * @returns Number of decoded samples per channel, or a negative error code
+  *          (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_silk_decode(
+    OpusSilkDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    opus_int16 *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
+/** Perform a CTL function on a SILK-only decoder.
+  *
+  * The supported requests are #OPUS_RESET_STATE, #OPUS_GET_FINAL_RANGE,
+  * #OPUS_GET_SAMPLE_RATE, #OPUS_GET_BANDWIDTH and
+  * #OPUS_GET_LAST_PACKET_DURATION. Any other request returns
+  * #OPUS_UNIMPLEMENTED.
+  * @param st <tt>OpusSilkDecoder*</tt>: Decoder state.
+  * @param request This and all remaining parameters should be replaced by one
+  *                of the convenience macros in @ref opus_genericctls or
+  *                @ref opus_decoderctls.
+  */
+OPUS_EXPORT int opus_silk_decoder_ctl(OpusSilkDecoder *st, int request, ...) OPUS_ARG_NONNULL(1);
+
+/** Frees an <code>OpusSilkDecoder</code> allocated by
+  * opus_silk_decoder_create().
+  * @param st <tt>OpusSilkDecoder*</tt>: Decoder state to be freed.
+  */
+OPUS_EXPORT void opus_silk_decoder_destroy(OpusSilkDecoder *st);
+
+/**@}*/
+
+/** SILK voice activity detector state.
+  * It is position independent and can be freely copied.
+  * @see opus_silk_vad_create
+  * @see opus_silk_vad_init
+  */
+typedef struct OpusSilkVad OpusSilkVad;
+
+/** @cond OPUS_INTERNAL_DOC */
+#define OPUS_SET_VAD_STATE_REQUEST 11040
+#define __opus_check_silk_vad_ptr(ptr) (1 ? (ptr) : (const OpusSilkVad*)0)
+/** @endcond */
+
+/**\name SILK voice activity detector functions
+  *
+  * The detector used by the SILK encoder, on its own: it is much cheaper than
+  * an encoder and can be run over a whole recording, e.g. to find the silences
+  * where it can be cut. Input at 24 or 48 kHz is resampled to 16 kHz first.
+  */
+/**@{*/
+
+/** Gets the size of an <code>OpusSilkVad</code> structure.
+  * @returns The size in bytes.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_silk_vad_get_size(void);
+
+/** Allocates and initializes a voice activity detector state.
+  * @param [in] Fs <tt>opus_int32</tt>: Sampling rate of input signal (Hz).
+  *                                      This must be one of 8000, 12000, 16000,
+  *                                      24000, or 48000.
+  * @param [out] error <tt>int*</tt>: #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusSilkVad *opus_silk_vad_create(
+    opus_int32 Fs,
+    int *error
+);
+
+/** Initializes a previously allocated voice activity detector state.
+  * The memory pointed to by st must be at least the size returned by
+  * opus_silk_vad_get_size().
+  * @param [in] st <tt>OpusSilkVad*</tt>: Detector state
+  * @param [in] Fs <tt>opus_int32</tt>: Sampling rate of input signal (Hz).
+  * @retval #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT int opus_silk_vad_init(
+    OpusSilkVad *st,
+    opus_int32 Fs
+) OPUS_ARG_NONNULL(1);
+
+/** Runs the detector on one frame of mono audio.
+  * @param [in] st <tt>OpusSilkVad*</tt>: Detector state
+  * @param [in] pcm <tt>opus_int16*</tt>: Input signal (mono)
+  * @param [in] frame_size <tt>int</tt>: Number of samples in the frame. This
+  *                                      must be 10 or 20 ms of audio.
+  * @returns The speech activity in Q8 (0 to 255), the same value the SILK
+  *          encoder compares against its DTX and bandwidth switching
+  *          thresholds, or a negative error code.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_silk_vad_process(
+    OpusSilkVad *st,
+    const opus_int16 *pcm,
+    int frame_size
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2);
+
+/** Copies the detector state into an encoder.
+  *
+  * The SILK encoder's own detector learns the background noise level over
+  * the first 20 seconds or so, which makes its bit allocation depend on a
+  * long stretch of past input. An encoder started in the middle of a
+  * recording can take over the state of a detector that has run over
+  * everything before that point (see opus_silk_vad_process()), to code the
+  * following frames like an encoder that has seen the whole recording.
+  *
+  * Valid for both <code>OpusEncoder</code> and <code>OpusSilkEncoder</code>,
+  * after the encoder is initialized or reset. Stereo encoders use the state
+  * for both their channels.
+  * @param[in] x <tt>const OpusSilkVad*</tt>: Detector state
+  * @hideinitializer */
+#define OPUS_SET_VAD_STATE(x) OPUS_SET_VAD_STATE_REQUEST, __opus_check_silk_vad_ptr(x)
+
+/** Frees an <code>OpusSilkVad</code> allocated by opus_silk_vad_create().
+  * @param st <tt>OpusSilkVad*</tt>: Detector state to be freed.
+  */
+OPUS_EXPORT void opus_silk_vad_destroy(OpusSilkVad *st);
+
+/**@}*/
+
+/** @cond OPUS_INTERNAL_DOC */
+#define OPUS_SET_SILK_GAIN_PREDICTION_REQUEST 11042
+#define OPUS_GET_SILK_GAIN_PREDICTION_REQUEST 11044
+#define OPUS_GET_SILK_RATE_FRAMES_REQUEST 11046
+#define OPUS_GET_SILK_RATE_ITERATIONS_REQUEST 11048
+#define OPUS_GET_SILK_RATE_UNUSED_BITS_REQUEST 11050
+/** @endcond */
+
+/**\name SILK rate control
+  *
+  * With constant bitrate the SILK encoder runs its noise shaping quantizer
+  * up to seven times per frame, adjusting the gains until the frame fits
+  * within a few bits of its budget. These requests are valid for both
+  * <code>OpusEncoder</code> and <code>OpusSilkEncoder</code>; the counters
+  * only cover frames coded by SILK with a budget to meet, and are cleared
+  * when the encoder is reset.
+  */
+/**@{*/
+
+/** Configures where the CBR rate control loop starts.
+  * The loop normally starts every frame from the gains the noise shaping
+  * analysis picked. With prediction, it starts from the gain multiplier
+  * earlier frames of the same signal type (voiced or not) ended up with, and
+  * steps along the bits versus gain slope measured on those frames, which
+  * takes fewer quantizer runs to reach the budget.
+  * @param[in] x <tt>opus_int32</tt>: Allowed values:
+  * <dl>
+  * <dt>0</dt><dd>Start from the analysis gains and assume one bit per
+  *               sample per doubling of the gains.</dd>
+  * <dt>1</dt><dd>Predict from earlier frames (default).</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_SET_SILK_GAIN_PREDICTION(x) OPUS_SET_SILK_GAIN_PREDICTION_REQUEST, __opus_check_int(x)
+/** Gets the encoder's configured CBR gain prediction.
+  * @see OPUS_SET_SILK_GAIN_PREDICTION
+  * @param[out] x <tt>opus_int32 *</tt>: Returns 0 or 1.
+  * @hideinitializer */
+#define OPUS_GET_SILK_GAIN_PREDICTION(x) OPUS_GET_SILK_GAIN_PREDICTION_REQUEST, __opus_check_int_ptr(x)
+/** Gets the number of frames the CBR rate control loop has coded.
+  * @param[out] x <tt>opus_uint32 *</tt>: Number of frames
+  * @hideinitializer */
+#define OPUS_GET_SILK_RATE_FRAMES(x) OPUS_GET_SILK_RATE_FRAMES_REQUEST, __opus_check_uint_ptr(x)
+/** Gets the number of times the CBR rate control loop ran the quantizer,
+  * over all the frames counted by #OPUS_GET_SILK_RATE_FRAMES.
+  * @param[out] x <tt>opus_uint32 *</tt>: Number of quantizer runs
+  * @hideinitializer */
+#define OPUS_GET_SILK_RATE_ITERATIONS(x) OPUS_GET_SILK_RATE_ITERATIONS_REQUEST, __opus_check_uint_ptr(x)
+/** Gets the number of bits the frames counted by #OPUS_GET_SILK_RATE_FRAMES
+  * left unused of their budgets, a measure of how closely the loop meets the
+  * bitrate (the Opus layer pads the packets to the constant size).
+  * @param[out] x <tt>opus_uint32 *</tt>: Number of bits
+  * @hideinitializer */
+#define OPUS_GET_SILK_RATE_UNUSED_BITS(x) OPUS_GET_SILK_RATE_UNUSED_BITS_REQUEST, __opus_check_uint_ptr(x)
+
+/**@}*/
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPUS_SILK_H */
@@ -0,0 +1,124 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file opus_wake_gate.h
+ * @brief Wake word pre-filter built on the Opus analysis MLP
+ */
+
+#ifndef OPUS_WAKE_GATE_H
+#define OPUS_WAKE_GATE_H
+
+#include "opus_types.h"
+#include "opus_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup opus_wake_gate Wake word pre-filter
+  * @{
+  *
+  * A tiny recurrent network (one dense layer, one GRU layer and a sigmoid
+  * output, on the same int8 runtime as the speech/music classifier of the
+  * encoder analysis) that estimates, every 10 ms, the probability that
+  * someone is speaking. Its features are 16 band energies above a tracked
+  * noise floor plus the overall level and the spectral flux, so stationary
+  * noise, hum and sustained tones stay low while speech onsets rise within
+  * 100 to 200 ms.
+  *
+  * It is meant to run all the time in front of a much more expensive keyword
+  * spotter and to wake that one up only when there is speech to look at, so
+  * it is tuned for recall: it fires on any speech, not only on the keyword.
+  * The caller is expected to keep a second or so of audio and to feed it to
+  * the keyword spotter when the gate opens.
+  *
+  * It costs one 240-point FFT and about 2000 multiply-adds per 10 ms and
+  * takes under 700 bytes of state.
+  */
+
+/** Wake word pre-filter state.
+  * It is position independent and can be freely copied.
+  * @see opus_wake_gate_create
+  * @see opus_wake_gate_init
+  */
+typedef struct OpusWakeGate OpusWakeGate;
+
+/** Gets the size of an <code>OpusWakeGate</code> structure.
+  * @returns The size in bytes.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_wake_gate_get_size(void);
+
+/** Allocates and initializes a pre-filter state.
+  * @param [in] Fs <tt>opus_int32</tt>: Sampling rate of input signal (Hz).
+  *                                      This must be 16000.
+  * @param [out] error <tt>int*</tt>: #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusWakeGate *opus_wake_gate_create(
+    opus_int32 Fs,
+    int *error
+);
+
+/** Initializes a previously allocated pre-filter state, or resets one.
+  * The memory pointed to by st must be at least the size returned by
+  * opus_wake_gate_get_size().
+  * @param [in] st <tt>OpusWakeGate*</tt>: Pre-filter state
+  * @param [in] Fs <tt>opus_int32</tt>: Sampling rate of input signal (Hz).
+  * @retval #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT int opus_wake_gate_init(
+    OpusWakeGate *st,
+    opus_int32 Fs
+) OPUS_ARG_NONNULL(1);
+
+/** Runs the pre-filter on a block of mono audio.
+  * The block can have any length: the samples that do not complete a 10 ms
+  * frame are kept for the next call.
+  * @param [in] st <tt>OpusWakeGate*</tt>: Pre-filter state
+  * @param [in] pcm <tt>opus_int16*</tt>: Input signal (mono)
+  * @param [in] len <tt>int</tt>: Number of samples
+  * @returns The highest speech probability in Q8 (0 to 255) of the 10 ms
+  *          frames completed by this block, the one of the last frame if the
+  *          block completed none, or a negative error code.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_wake_gate_process(
+    OpusWakeGate *st,
+    const opus_int16 *pcm,
+    int len
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2);
+
+/** Frees an <code>OpusWakeGate</code> allocated by opus_wake_gate_create().
+  * @param st <tt>OpusWakeGate*</tt>: Pre-filter state to be freed.
+  */
+OPUS_EXPORT void opus_wake_gate_destroy(OpusWakeGate *st);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPUS_WAKE_GATE_H */
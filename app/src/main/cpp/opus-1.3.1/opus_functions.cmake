@@ -102,7 +102,7 @@ function(check_flag NAME FLAG)
 endfunction()
 
 include(CheckIncludeFile)
-# function to check if compiler supports SSE, SSE2, SSE4.1 and AVX if target
+# function to check if compiler supports SSE, SSE2, SSE4.1, AVX and AVX2 if target
 # systems may not have SSE support then use OPUS_MAY_HAVE_SSE option if target
 # system is guaranteed to have SSE support then OPUS_PRESUME_SSE can be used to
 # skip SSE runtime check
@@ -154,15 +154,19 @@ function(opus_detect_sse COMPILER_SUPPORT_SIMD)
     set(SSE4_1_SUPPORTED 0 PARENT_SCOPE)
   endif()
 
-  check_include_file(immintrin.h HAVE_IMMINTRIN_H) # AVX
+  check_include_file(immintrin.h HAVE_IMMINTRIN_H) # AVX, AVX2
   if(HAVE_IMMINTRIN_H)
     if(MSVC)
       check_flag(AVX /arch:AVX)
+      check_flag(AVX2 /arch:AVX2)
     else()
       check_and_set_flag(AVX -mavx)
+      # not added globally, only the AVX2 sources are compiled with it
+      check_flag(AVX2 -mavx2)
     endif()
   else()
     set(AVX_SUPPORTED 0 PARENT_SCOPE)
+    set(AVX2_SUPPORTED 0 PARENT_SCOPE)
   endif()
 
   if(MSVC) # To avoid warning D9025 of overriding compiler options
@@ -177,7 +181,8 @@ function(opus_detect_sse COMPILER_SUPPORT_SIMD)
     endif()
   endif()
 
-  if(SSE1_SUPPORTED OR SSE2_SUPPORTED OR SSE4_1_SUPPORTED OR AVX_SUPPORTED)
+  if(SSE1_SUPPORTED OR SSE2_SUPPORTED OR SSE4_1_SUPPORTED OR AVX_SUPPORTED
+     OR AVX2_SUPPORTED)
     set(COMPILER_SUPPORT_SIMD 1 PARENT_SCOPE)
   else()
     message(STATUS "No SIMD support in compiler")
@@ -2,8 +2,11 @@ OPUS_HEAD = \
 include/opus.h \
 include/opus_multistream.h \
 include/opus_projection.h \
+include/opus_silk.h \
+include/opus_wake_gate.h \
 src/opus_private.h \
 src/analysis.h \
 src/mapping_matrix.h \
 src/mlp.h \
-src/tansig_table.h
+src/tansig_table.h \
+src/wake_gate.h
@@ -5,6 +5,9 @@ src/opus_encoder.c \
 src/opus_multistream.c \
 src/opus_multistream_encoder.c \
 src/opus_multistream_decoder.c \
+src/opus_silk_encoder.c \
+src/opus_silk_decoder.c \
+src/opus_silk_vad.c \
 src/repacketizer.c \
 src/opus_projection_encoder.c \
 src/opus_projection_decoder.c \
@@ -13,4 +16,6 @@ src/mapping_matrix.c
 OPUS_SOURCES_FLOAT = \
 src/analysis.c \
 src/mlp.c \
-src/mlp_data.c
+src/mlp_data.c \
+src/wake_gate.c \
+src/wake_gate_data.c
@@ -84,6 +84,14 @@ opus_int silk_Encode(                                   /* O    Returns error co
     int                             activity            /* I    Decision of Opus voice activity detector        */
 );
 
+/*******************************************************/
+/* Read the rate control counters since the last reset */
+/*******************************************************/
+void silk_GetRateControlStats(
+    const void                      *encState,          /* I    State                                           */
+    silk_RateControlStats           *stats              /* O    Counters                                        */
+);
+
 /****************************************/
 /* Decoder functions                    */
 /****************************************/
@@ -32,6 +32,31 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "main.h"
 #include "stack_alloc.h"
 
+/* Lowest rate the trellis quantizer can spend on the residual, weighted by mu as in */
+/* silk_NLSF_del_dec_quant(). Indices outside the table cost at least 280 in Q5.    */
+static opus_int32 silk_NLSF_residual_rate_bound_Q25(
+    const opus_int16            ec_ix[],                        /* I    Indices to entropy coding tables [ order ]  */
+    const opus_uint8            ec_rates_Q5[],                  /* I    Rates []                                    */
+    const opus_int32            mu_Q20,                         /* I    R/D tradeoff                                */
+    const opus_int              order                           /* I    Number of input values                      */
+)
+{
+    opus_int         i, j, min_rate_Q5;
+    opus_int32       bound_Q25;
+    const opus_uint8 *rates_Q5;
+
+    bound_Q25 = 0;
+    for( i = 0; i < order; i++ ) {
+        rates_Q5 = &ec_rates_Q5[ ec_ix[ i ] ];
+        min_rate_Q5 = 280;
+        for( j = 0; j <= 2 * NLSF_QUANT_MAX_AMPLITUDE; j++ ) {
+            min_rate_Q5 = silk_min_int( min_rate_Q5, rates_Q5[ j ] );
+        }
+        bound_Q25 = silk_SMLABB( bound_Q25, mu_Q20, min_rate_Q5 );
+    }
+    return bound_Q25;
+}
+
 /***********************/
 /* NLSF vector encoder */
 /***********************/
@@ -42,11 +67,12 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
     const opus_int16            *pW_Q2,                         /* I    NLSF weight vector [ LPC_ORDER ]            */
     const opus_int              NLSF_mu_Q20,                    /* I    Rate weight for the RD optimization         */
     const opus_int              nSurvivors,                     /* I    Max survivors after first stage             */
-    const opus_int              signalType                      /* I    Signal type: 0/1/2                          */
+    const opus_int              signalType,                     /* I    Signal type: 0/1/2                          */
+    int                         arch                            /* I    Run-time architecture                       */
 )
 {
     opus_int         i, s, ind1, bestIndex, prob_Q8, bits_q7;
-    opus_int32       W_tmp_Q9, ret;
+    opus_int32       W_tmp_Q9, ret, rate1_Q25, best_RD_Q25;
     VARDECL( opus_int32, err_Q24 );
     VARDECL( opus_int32, RD_Q25 );
     VARDECL( opus_int, tempIndices1 );
@@ -68,7 +94,7 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
 
     /* First stage: VQ */
     ALLOC( err_Q24, psNLSF_CB->nVectors, opus_int32 );
-    silk_NLSF_VQ( err_Q24, pNLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order );
+    silk_NLSF_VQ( err_Q24, pNLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order, arch );
 
     /* Sort the quantization errors */
     ALLOC( tempIndices1, nSurvivors, opus_int );
@@ -78,9 +104,32 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
     ALLOC( tempIndices2, nSurvivors * MAX_LPC_ORDER, opus_int8 );
 
     /* Loop over survivors */
+    best_RD_Q25 = silk_int32_MAX;
     for( s = 0; s < nSurvivors; s++ ) {
         ind1 = tempIndices1[ s ];
 
+        /* Rate for first stage */
+        iCDF_ptr = &psNLSF_CB->CB1_iCDF[ ( signalType >> 1 ) * psNLSF_CB->nVectors ];
+        if( ind1 == 0 ) {
+            prob_Q8 = 256 - iCDF_ptr[ ind1 ];
+        } else {
+            prob_Q8 = iCDF_ptr[ ind1 - 1 ] - iCDF_ptr[ ind1 ];
+        }
+        bits_q7 = ( 8 << 7 ) - silk_lin2log( prob_Q8 );
+        rate1_Q25 = silk_SMULBB( bits_q7, silk_RSHIFT( NLSF_mu_Q20, 2 ) );
+
+        /* Unpack entropy table indices and predictor for current CB1 index */
+        silk_NLSF_unpack( ec_ix, pred_Q8, psNLSF_CB, ind1 );
+
+        /* The trellis only adds non-negative distortion and rate terms, so a survivor whose */
+        /* rate alone cannot beat the best RD so far is skipped. Ties already go to the      */
+        /* earlier survivor, so the result is the same as searching all of them.             */
+        if( silk_ADD32( rate1_Q25, silk_NLSF_residual_rate_bound_Q25( ec_ix, psNLSF_CB->ec_Rates_Q5,
+                NLSF_mu_Q20, psNLSF_CB->order ) ) >= best_RD_Q25 ) {
+            RD_Q25[ s ] = silk_int32_MAX;
+            continue;
+        }
+
         /* Residual after first stage */
         pCB_element = &psNLSF_CB->CB1_NLSF_Q8[ ind1 * psNLSF_CB->order ];
         pCB_Wght_Q9 = &psNLSF_CB->CB1_Wght_Q9[ ind1 * psNLSF_CB->order ];
@@ -91,22 +140,13 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
             W_adj_Q5[ i ] = silk_DIV32_varQ( (opus_int32)pW_Q2[ i ], silk_SMULBB( W_tmp_Q9, W_tmp_Q9 ), 21 );
         }
 
-        /* Unpack entropy table indices and predictor for current CB1 index */
-        silk_NLSF_unpack( ec_ix, pred_Q8, psNLSF_CB, ind1 );
-
         /* Trellis quantizer */
         RD_Q25[ s ] = silk_NLSF_del_dec_quant( &tempIndices2[ s * MAX_LPC_ORDER ], res_Q10, W_adj_Q5, pred_Q8, ec_ix,
             psNLSF_CB->ec_Rates_Q5, psNLSF_CB->quantStepSize_Q16, psNLSF_CB->invQuantStepSize_Q6, NLSF_mu_Q20, psNLSF_CB->order );
 
         /* Add rate for first stage */
-        iCDF_ptr = &psNLSF_CB->CB1_iCDF[ ( signalType >> 1 ) * psNLSF_CB->nVectors ];
-        if( ind1 == 0 ) {
-            prob_Q8 = 256 - iCDF_ptr[ ind1 ];
-        } else {
-            prob_Q8 = iCDF_ptr[ ind1 - 1 ] - iCDF_ptr[ ind1 ];
-        }
-        bits_q7 = ( 8 << 7 ) - silk_lin2log( prob_Q8 );
-        RD_Q25[ s ] = silk_SMLABB( RD_Q25[ s ], bits_q7, silk_RSHIFT( NLSF_mu_Q20, 2 ) );
+        RD_Q25[ s ] = silk_ADD32( RD_Q25[ s ], rate1_Q25 );
+        best_RD_Q25 = silk_min_32( best_RD_Q25, RD_Q25[ s ] );
     }
 
     /* Find the lowest rate-distortion error */
@@ -50,6 +50,7 @@ extern "C"
 #if (defined(OPUS_ARM_ASM) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR))
 #include "arm/biquad_alt_arm.h"
 #include "arm/LPC_inv_pred_gain_arm.h"
+#include "arm/SigProc_FIX_arm.h"
 #endif
 
 /********************************************************************/
@@ -120,7 +121,7 @@ void silk_biquad_alt_stride2_c(
 );
 
 /* Variable order MA prediction error filter. */
-void silk_LPC_analysis_filter(
+void silk_LPC_analysis_filter_c(
     opus_int16                  *out,               /* O    Output signal                                               */
     const opus_int16            *in,                /* I    Input signal                                                */
     const opus_int16            *B,                 /* I    MA prediction coefficients, Q12 [order]                     */
@@ -167,6 +168,10 @@ void silk_ana_filt_bank_1(
 #define silk_LPC_inverse_pred_gain(A_Q12, order, arch)     ((void)(arch), silk_LPC_inverse_pred_gain_c(A_Q12, order))
 #endif
 
+#if !defined(OVERRIDE_silk_LPC_analysis_filter)
+#define silk_LPC_analysis_filter(out, in, B, len, d, arch) silk_LPC_analysis_filter_c(out, in, B, len, d, arch)
+#endif
+
 /********************************************************************/
 /*                        SCALAR FUNCTIONS                          */
 /********************************************************************/
@@ -190,7 +195,7 @@ opus_int32 silk_log2lin(
 
 /* Compute number of bits to right shift the sum of squares of a vector    */
 /* of int16s to make it fit in an int32                                    */
-void silk_sum_sqr_shift(
+void silk_sum_sqr_shift_c(
     opus_int32                  *energy,            /* O   Energy of x, after shifting to the right                     */
     opus_int                    *shift,             /* O   Number of bits right shift applied to energy                 */
     const opus_int16            *x,                 /* I   Input vector                                                 */
@@ -346,7 +351,7 @@ void silk_burg_modified_c(
 );
 
 /* Copy and multiply a vector by a constant */
-void silk_scale_copy_vector16(
+void silk_scale_copy_vector16_c(
     opus_int16                  *data_out,
     const opus_int16            *data_in,
     opus_int32                  gain_Q16,           /* I    Gain in Q16                                                 */
@@ -374,7 +379,7 @@ opus_int32 silk_inner_prod_aligned(
 );
 
 
-opus_int32 silk_inner_prod_aligned_scale(
+opus_int32 silk_inner_prod_aligned_scale_c(
     const opus_int16 *const     inVec1,             /*    I input vector 1                                              */
     const opus_int16 *const     inVec2,             /*    I input vector 2                                              */
     const opus_int              scale,              /*    I number of bits to shift                                     */
@@ -609,6 +614,18 @@ static OPUS_INLINE opus_int64 silk_max_64(opus_int64 a, opus_int64 b)
 /* the following seems faster on x86 */
 #define silk_SMMUL(a32, b32)                (opus_int32)silk_RSHIFT64(silk_SMULL((a32), (b32)), 32)
 
+#if !defined(OVERRIDE_silk_sum_sqr_shift)
+#define silk_sum_sqr_shift(energy, shift, x, len) silk_sum_sqr_shift_c(energy, shift, x, len)
+#endif
+
+#if !defined(OVERRIDE_silk_inner_prod_aligned_scale)
+#define silk_inner_prod_aligned_scale(inVec1, inVec2, scale, len) silk_inner_prod_aligned_scale_c(inVec1, inVec2, scale, len)
+#endif
+
+#if !defined(OVERRIDE_silk_scale_copy_vector16)
+#define silk_scale_copy_vector16(data_out, data_in, gain_Q16, dataSize) silk_scale_copy_vector16_c(data_out, data_in, gain_Q16, dataSize)
+#endif
+
 #if !defined(OPUS_X86_MAY_HAVE_SSE4_1)
 #define silk_burg_modified(res_nrg, res_nrg_Q, A_Q16, x, minInvGain_Q30, subfr_length, nb_subfr, D, arch) \
     ((void)(arch), silk_burg_modified_c(res_nrg, res_nrg_Q, A_Q16, x, minInvGain_Q30, subfr_length, nb_subfr, D, arch))
@@ -0,0 +1,61 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifndef SILK_NLSF_VQ_ARM_H
+#define SILK_NLSF_VQ_ARM_H
+
+#include "celt/arm/armcpu.h"
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+void silk_NLSF_VQ_neon(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
+    const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
+    const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
+    const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
+    const opus_int              K,                              /* I    Number of codebook vectors                  */
+    const opus_int              LPC_order                       /* I    Number of LPCs                              */
+);
+#endif
+
+#if !defined(OVERRIDE_silk_NLSF_VQ)
+/*Is run-time CPU detection enabled on this platform?*/
+#if defined(OPUS_HAVE_RTCD) && (defined(OPUS_ARM_MAY_HAVE_NEON_INTR) && \
+                                !defined(OPUS_ARM_PRESUME_NEON_INTR))
+extern void (*const SILK_NLSF_VQ_IMPL[OPUS_ARCHMASK + 1])(
+    opus_int32 err_Q24[], const opus_int16 in_Q15[], const opus_uint8 pCB_Q8[],
+    const opus_int16 pWght_Q9[], const opus_int K, const opus_int LPC_order);
+#define OVERRIDE_silk_NLSF_VQ (1)
+#define silk_NLSF_VQ(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order, arch) \
+    ((*SILK_NLSF_VQ_IMPL[(arch)&OPUS_ARCHMASK])(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order))
+#elif defined(OPUS_ARM_PRESUME_NEON_INTR)
+#define OVERRIDE_silk_NLSF_VQ (1)
+#define silk_NLSF_VQ(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order, arch) \
+    ((void)(arch),silk_NLSF_VQ_neon(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order))
+#endif
+#endif
+
+#endif /* end SILK_NLSF_VQ_ARM_H */
@@ -0,0 +1,109 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "main.h"
+
+/* Weighted error of one codebook vector, see silk_NLSF_VQ_c(). The differences */
+/* are formed in 16 bits, which is what silk_SMULBB() keeps of them anyway, and */
+/* the absolute predictive errors are summed in any order since none overflow.  */
+static OPUS_INLINE opus_int32 silk_NLSF_VQ_err_neon(
+    const opus_int16            in_Q15[],                       /* I    Input vector [LPC_order]                    */
+    const opus_uint8            cb_Q8[],                        /* I    Codebook vector [LPC_order]                 */
+    const opus_int16            w_Q9[],                         /* I    Codebook weights [LPC_order]                */
+    const opus_int              LPC_order                       /* I    Number of LPCs, 10 or 16                    */
+)
+{
+    int32x4_t diffw_Q24[ MAX_LPC_ORDER / 4 + 1 ];
+    int32x4_t pred_Q24, sum_error_Q24;
+    int16x8_t diff_Q15, w;
+    opus_int m, k, nvec;
+
+    for( m = 0; m < ( LPC_order & ~7 ); m += 8 ) {
+        diff_Q15 = vsubq_s16( vld1q_s16( &in_Q15[ m ] ),
+                              vreinterpretq_s16_u16( vshll_n_u8( vld1_u8( &cb_Q8[ m ] ), 7 ) ) );
+        w = vld1q_s16( &w_Q9[ m ] );
+        diffw_Q24[ m >> 2 ]       = vmull_s16( vget_low_s16( diff_Q15 ), vget_low_s16( w ) );
+        diffw_Q24[ ( m >> 2 ) + 1 ] = vmull_s16( vget_high_s16( diff_Q15 ), vget_high_s16( w ) );
+    }
+    nvec = ( LPC_order + 3 ) >> 2;
+    diffw_Q24[ nvec ] = vdupq_n_s32( 0 );
+    if( LPC_order & 7 ) {
+        /* The last two coefficients of a 10th order vector */
+        diffw_Q24[ m >> 2 ] = vsetq_lane_s32(
+            silk_SMULBB( silk_SUB_LSHIFT32( in_Q15[ m ], (opus_int32)cb_Q8[ m ], 7 ), w_Q9[ m ] ),
+            vdupq_n_s32( 0 ), 0 );
+        diffw_Q24[ m >> 2 ] = vsetq_lane_s32(
+            silk_SMULBB( silk_SUB_LSHIFT32( in_Q15[ m + 1 ], (opus_int32)cb_Q8[ m + 1 ], 7 ), w_Q9[ m + 1 ] ),
+            diffw_Q24[ m >> 2 ], 1 );
+    }
+
+    /* Each error is predicted from the weighted difference of the next coefficient */
+    sum_error_Q24 = vdupq_n_s32( 0 );
+    for( k = 0; k < nvec; k++ ) {
+        pred_Q24 = vextq_s32( diffw_Q24[ k ], diffw_Q24[ k + 1 ], 1 );
+        sum_error_Q24 = vaddq_s32( sum_error_Q24, vabsq_s32( vsubq_s32( diffw_Q24[ k ], vshrq_n_s32( pred_Q24, 1 ) ) ) );
+    }
+#if defined(OPUS_ARM_PRESUME_AARCH64_NEON_INTR)
+    return vaddvq_s32( sum_error_Q24 );
+#else
+    {
+        int32x2_t sum = vadd_s32( vget_low_s32( sum_error_Q24 ), vget_high_s32( sum_error_Q24 ) );
+        return vget_lane_s32( vpadd_s32( sum, sum ), 0 );
+    }
+#endif
+}
+
+/* Compute quantization errors for an LPC_order element input vector for a VQ codebook */
+void silk_NLSF_VQ_neon(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
+    const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
+    const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
+    const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
+    const opus_int              K,                              /* I    Number of codebook vectors                  */
+    const opus_int              LPC_order                       /* I    Number of LPCs                              */
+)
+{
+    opus_int i;
+
+    /* The codebooks are 10th order for NB/MB and 16th order for WB */
+    if( LPC_order == 16 ) {
+        for( i = 0; i < K; i++ ) {
+            err_Q24[ i ] = silk_NLSF_VQ_err_neon( in_Q15, &pCB_Q8[ i * 16 ], &pWght_Q9[ i * 16 ], 16 );
+        }
+    } else if( LPC_order == 10 ) {
+        for( i = 0; i < K; i++ ) {
+            err_Q24[ i ] = silk_NLSF_VQ_err_neon( in_Q15, &pCB_Q8[ i * 10 ], &pWght_Q9[ i * 10 ], 10 );
+        }
+    } else {
+        silk_NLSF_VQ_c( err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order );
+    }
+}
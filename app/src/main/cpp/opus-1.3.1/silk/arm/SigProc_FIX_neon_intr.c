@@ -0,0 +1,182 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "SigProc_FIX.h"
+
+/* Sum of ( x[ i ]^2 + x[ i + 1 ]^2 ) >> shft over the pairs of x, wrapping like the */
+/* unsigned sum in silk_sum_sqr_shift_c(). The pairs are split into even and odd    */
+/* samples by VLD2, and a pair sum only overflows the signed lanes for two -32768   */
+/* samples, where it still has the right bit pattern for the logical shift.        */
+static OPUS_INLINE opus_uint32 silk_sum_sqr_shift_pass_neon(
+    opus_uint32                 nrg,
+    const opus_int16            *x,
+    opus_int                    len,
+    opus_int                    shft
+)
+{
+    opus_int    i;
+    opus_uint32 nrg_tmp;
+    uint32x4_t  acc;
+    uint32x2_t  acc2;
+    int32x4_t   neg_shift, pair;
+    int16x8x2_t xx;
+
+    acc = vdupq_n_u32( 0 );
+    neg_shift = vdupq_n_s32( -shft );
+    for( i = 0; i < len - 15; i += 16 ) {
+        xx = vld2q_s16( &x[ i ] );
+        pair = vmlal_s16( vmull_s16( vget_low_s16( xx.val[ 0 ] ), vget_low_s16( xx.val[ 0 ] ) ),
+                          vget_low_s16( xx.val[ 1 ] ), vget_low_s16( xx.val[ 1 ] ) );
+        acc = vaddq_u32( acc, vshlq_u32( vreinterpretq_u32_s32( pair ), neg_shift ) );
+        pair = vmlal_s16( vmull_s16( vget_high_s16( xx.val[ 0 ] ), vget_high_s16( xx.val[ 0 ] ) ),
+                          vget_high_s16( xx.val[ 1 ] ), vget_high_s16( xx.val[ 1 ] ) );
+        acc = vaddq_u32( acc, vshlq_u32( vreinterpretq_u32_s32( pair ), neg_shift ) );
+    }
+    acc2 = vadd_u32( vget_low_u32( acc ), vget_high_u32( acc ) );
+    nrg += vget_lane_u32( vpadd_u32( acc2, acc2 ), 0 );
+
+    for( ; i < len - 1; i += 2 ) {
+        nrg_tmp = silk_SMULBB( x[ i ], x[ i ] );
+        nrg_tmp = silk_SMLABB_ovflw( nrg_tmp, x[ i + 1 ], x[ i + 1 ] );
+        nrg = silk_ADD_RSHIFT_uint( nrg, nrg_tmp, shft );
+    }
+    if( i < len ) {
+        nrg_tmp = silk_SMULBB( x[ i ], x[ i ] );
+        nrg = silk_ADD_RSHIFT_uint( nrg, nrg_tmp, shft );
+    }
+    return nrg;
+}
+
+void silk_sum_sqr_shift_neon(
+    opus_int32                  *energy,            /* O   Energy of x, after shifting to the right                     */
+    opus_int                    *shift,             /* O   Number of bits right shift applied to energy                 */
+    const opus_int16            *x,                 /* I   Input vector                                                 */
+    opus_int                    len                 /* I   Length of input vector                                       */
+)
+{
+    opus_int   shft;
+    opus_int32 nrg;
+
+    /* Same two passes as silk_sum_sqr_shift_c() */
+    shft = 31 - silk_CLZ32( len );
+    nrg = (opus_int32)silk_sum_sqr_shift_pass_neon( len, x, len, shft );
+    silk_assert( nrg >= 0 );
+    shft = silk_max_32( 0, shft + 3 - silk_CLZ32( nrg ) );
+    nrg = (opus_int32)silk_sum_sqr_shift_pass_neon( 0, x, len, shft );
+    silk_assert( nrg >= 0 );
+
+    *shift  = shft;
+    *energy = nrg;
+}
+
+opus_int32 silk_inner_prod_aligned_scale_neon(
+    const opus_int16 *const     inVec1,             /*    I input vector 1                                              */
+    const opus_int16 *const     inVec2,             /*    I input vector 2                                              */
+    const opus_int              scale,              /*    I number of bits to shift                                     */
+    const opus_int              len                 /*    I vector lengths                                              */
+)
+{
+    opus_int   i;
+    opus_int32 sum;
+    int32x4_t  acc, neg_scale;
+    int32x2_t  acc2;
+    int16x8_t  a, b;
+
+    acc = vdupq_n_s32( 0 );
+    neg_scale = vdupq_n_s32( -scale );
+    for( i = 0; i < len - 7; i += 8 ) {
+        a = vld1q_s16( &inVec1[ i ] );
+        b = vld1q_s16( &inVec2[ i ] );
+        /* Each product is shifted on its own before it is added */
+        acc = vaddq_s32( acc, vshlq_s32( vmull_s16( vget_low_s16( a ), vget_low_s16( b ) ), neg_scale ) );
+        acc = vaddq_s32( acc, vshlq_s32( vmull_s16( vget_high_s16( a ), vget_high_s16( b ) ), neg_scale ) );
+    }
+    acc2 = vadd_s32( vget_low_s32( acc ), vget_high_s32( acc ) );
+    sum = vget_lane_s32( vpadd_s32( acc2, acc2 ), 0 );
+
+    for( ; i < len; i++ ) {
+        sum = silk_ADD_RSHIFT32( sum, silk_SMULBB( inVec1[ i ], inVec2[ i ] ), scale );
+    }
+    return sum;
+}
+
+/* Eight outputs at a time, with one widening multiply-accumulate per tap and half. */
+/* The sums wrap like the _ovflw macros of the C version, and VQRSHRN rounds and    */
+/* saturates like silk_RSHIFT_ROUND() followed by silk_SAT16().                     */
+void silk_LPC_analysis_filter_neon(
+    opus_int16                  *out,               /* O    Output signal                                               */
+    const opus_int16            *in,                /* I    Input signal                                                */
+    const opus_int16            *B,                 /* I    MA prediction coefficients, Q12 [order]                     */
+    const opus_int32            len,                /* I    Signal length                                               */
+    const opus_int32            d,                  /* I    Filter order                                                */
+    int                         arch                /* I    Run-time architecture                                       */
+)
+{
+    opus_int   ix, j;
+    opus_int32 out32_Q12, out32;
+    const opus_int16 *in_ptr;
+    int32x4_t  acc_lo, acc_hi;
+    int16x8_t  x;
+
+    (void)arch;
+    celt_assert( d >= 6 );
+    celt_assert( (d & 1) == 0 );
+    celt_assert( d <= len );
+
+    for( ix = d; ix < len - 7; ix += 8 ) {
+        acc_lo = vdupq_n_s32( 0 );
+        acc_hi = vdupq_n_s32( 0 );
+        for( j = 0; j < d; j++ ) {
+            x = vld1q_s16( &in[ ix - 1 - j ] );
+            acc_lo = vmlal_n_s16( acc_lo, vget_low_s16( x ), B[ j ] );
+            acc_hi = vmlal_n_s16( acc_hi, vget_high_s16( x ), B[ j ] );
+        }
+        x = vld1q_s16( &in[ ix ] );
+        acc_lo = vsubq_s32( vshll_n_s16( vget_low_s16( x ), 12 ), acc_lo );
+        acc_hi = vsubq_s32( vshll_n_s16( vget_high_s16( x ), 12 ), acc_hi );
+        vst1q_s16( &out[ ix ], vcombine_s16( vqrshrn_n_s32( acc_lo, 12 ), vqrshrn_n_s32( acc_hi, 12 ) ) );
+    }
+
+    for( ; ix < len; ix++ ) {
+        in_ptr = &in[ ix - 1 ];
+        out32_Q12 = silk_SMULBB( in_ptr[ 0 ], B[ 0 ] );
+        for( j = 1; j < d; j++ ) {
+            out32_Q12 = silk_SMLABB_ovflw( out32_Q12, in_ptr[ -j ], B[ j ] );
+        }
+        out32_Q12 = silk_SUB32_ovflw( silk_LSHIFT( (opus_int32)in_ptr[ 1 ], 12 ), out32_Q12 );
+        out32 = silk_RSHIFT_ROUND( out32_Q12, 12 );
+        out[ ix ] = (opus_int16)silk_SAT16( out32 );
+    }
+
+    /* Set first d output samples to zero */
+    silk_memset( out, 0, d * sizeof( opus_int16 ) );
+}
@@ -0,0 +1,146 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "main.h"
+
+/* Byte positions of element j of four consecutive 5-element codebook vectors, */
+/* in a table of the bytes 0-7, 8-15 and 12-19 of those four vectors           */
+static const opus_int8 cb_deinterleave[ 3 ][ 8 ] = {
+    { 0, 5, 10, 15, 1, 6, 11, 20 },
+    { 2, 7, 12, 21, 3, 8, 13, 22 },
+    { 4, 9, 14, 23, 4, 9, 14, 23 }
+};
+
+/* Entropy constrained matrix-weighted VQ, hard-coded to 5-element vectors, for a single input data vector. */
+/* Four codebook vectors are evaluated at once, one per lane. Products and sums wrap like the int32        */
+/* arithmetic of silk_VQ_WMat_EC_c(), and silk_SMLAWB() is a floor of the 48-bit product, so the energies */
+/* are bit-exact. The rate decision is scalar and in codebook order to keep the tie-breaking.             */
+void silk_VQ_WMat_EC_neon(
+    opus_int8                   *ind,                           /* O    index of best codebook vector               */
+    opus_int32                  *res_nrg_Q15,                   /* O    best residual energy                        */
+    opus_int32                  *rate_dist_Q8,                  /* O    best total bitrate                          */
+    opus_int                    *gain_Q7,                       /* O    sum of absolute LTP coefficients            */
+    const opus_int32            *XX_Q17,                        /* I    correlation matrix                          */
+    const opus_int32            *xX_Q17,                        /* I    correlation vector                          */
+    const opus_int8             *cb_Q7,                         /* I    codebook                                    */
+    const opus_uint8            *cb_gain_Q7,                    /* I    codebook effective gain                     */
+    const opus_uint8            *cl_Q5,                         /* I    code length for each codebook vector        */
+    const opus_int              subfr_len,                      /* I    number of samples per subframe              */
+    const opus_int32            max_gain_Q7,                    /* I    maximum sum of absolute LTP coefficients    */
+    const opus_int              L                               /* I    number of vectors in codebook               */
+)
+{
+    opus_int   i, j, k, n, gain_tmp_Q7;
+    opus_int32 neg_xX_Q24[ LTP_ORDER ];
+    opus_int32 sum1_Q15[ 4 ];
+    opus_int32 penalty, bits_res_Q8, bits_tot_Q8;
+    int8x8x3_t cb_bytes;
+    int8x8_t   idx[ 3 ];
+    int16x8_t  cb01, cb23, cb44;
+    int32x4_t  cb_Q7_vec[ LTP_ORDER ];
+    int32x4_t  sum1_Q15_vec, sum2_Q24;
+    int64x2_t  prod_lo, prod_hi;
+
+    if( L & 3 ) {
+        /* All LTP codebooks have a multiple of four vectors */
+        silk_VQ_WMat_EC_c( ind, res_nrg_Q15, rate_dist_Q8, gain_Q7, XX_Q17, xX_Q17, cb_Q7, cb_gain_Q7,
+            cl_Q5, subfr_len, max_gain_Q7, L );
+        return;
+    }
+
+    /* Negate and convert to new Q domain */
+    for( i = 0; i < LTP_ORDER; i++ ) {
+        neg_xX_Q24[ i ] = -silk_LSHIFT32( xX_Q17[ i ], 7 );
+    }
+    for( i = 0; i < 3; i++ ) {
+        idx[ i ] = vld1_s8( cb_deinterleave[ i ] );
+    }
+
+    *rate_dist_Q8 = silk_int32_MAX;
+    *res_nrg_Q15 = silk_int32_MAX;
+    /* In things go really bad, at least *ind is set to something safe. */
+    *ind = 0;
+    for( k = 0; k < L; k += 4 ) {
+        const opus_int8 *cb_row_Q7 = &cb_Q7[ k * LTP_ORDER ];
+
+        /* Transpose the 20 bytes of four codebook vectors into one vector per element */
+        cb_bytes.val[ 0 ] = vld1_s8( &cb_row_Q7[ 0 ] );
+        cb_bytes.val[ 1 ] = vld1_s8( &cb_row_Q7[ 8 ] );
+        cb_bytes.val[ 2 ] = vld1_s8( &cb_row_Q7[ 12 ] );
+        cb01 = vmovl_s8( vtbl3_s8( cb_bytes, idx[ 0 ] ) );
+        cb23 = vmovl_s8( vtbl3_s8( cb_bytes, idx[ 1 ] ) );
+        cb44 = vmovl_s8( vtbl3_s8( cb_bytes, idx[ 2 ] ) );
+        cb_Q7_vec[ 0 ] = vmovl_s16( vget_low_s16( cb01 ) );
+        cb_Q7_vec[ 1 ] = vmovl_s16( vget_high_s16( cb01 ) );
+        cb_Q7_vec[ 2 ] = vmovl_s16( vget_low_s16( cb23 ) );
+        cb_Q7_vec[ 3 ] = vmovl_s16( vget_high_s16( cb23 ) );
+        cb_Q7_vec[ 4 ] = vmovl_s16( vget_low_s16( cb44 ) );
+
+        /* Quantization error: 1 - 2 * xX * cb + cb' * XX * cb */
+        sum1_Q15_vec = vdupq_n_s32( SILK_FIX_CONST( 1.001, 15 ) );
+        for( i = 0; i < LTP_ORDER; i++ ) {
+            /* Row i of XX_Q17: off-diagonal terms count twice */
+            sum2_Q24 = vdupq_n_s32( neg_xX_Q24[ i ] );
+            for( j = i + 1; j < LTP_ORDER; j++ ) {
+                sum2_Q24 = vmlaq_n_s32( sum2_Q24, cb_Q7_vec[ j ], XX_Q17[ i * LTP_ORDER + j ] );
+            }
+            sum2_Q24 = vshlq_n_s32( sum2_Q24, 1 );
+            sum2_Q24 = vmlaq_n_s32( sum2_Q24, cb_Q7_vec[ i ], XX_Q17[ i * LTP_ORDER + i ] );
+
+            /* silk_SMLAWB( sum1_Q15, sum2_Q24, cb_row_Q7[ i ] ) */
+            prod_lo = vmull_s32( vget_low_s32( sum2_Q24 ), vget_low_s32( cb_Q7_vec[ i ] ) );
+            prod_hi = vmull_s32( vget_high_s32( sum2_Q24 ), vget_high_s32( cb_Q7_vec[ i ] ) );
+            sum1_Q15_vec = vaddq_s32( sum1_Q15_vec,
+                vcombine_s32( vshrn_n_s64( prod_lo, 16 ), vshrn_n_s64( prod_hi, 16 ) ) );
+        }
+        vst1q_s32( sum1_Q15, sum1_Q15_vec );
+
+        /* find best */
+        for( n = 0; n < 4; n++ ) {
+            if( sum1_Q15[ n ] >= 0 ) {
+                gain_tmp_Q7 = cb_gain_Q7[ k + n ];
+                /* Penalty for too large gain */
+                penalty = silk_LSHIFT32( silk_max( silk_SUB32( gain_tmp_Q7, max_gain_Q7 ), 0 ), 11 );
+                /* Translate residual energy to bits using high-rate assumption (6 dB ==> 1 bit/sample) */
+                bits_res_Q8 = silk_SMULBB( subfr_len, silk_lin2log( sum1_Q15[ n ] + penalty ) - ( 15 << 7 ) );
+                /* Codelength component reduced by half, as in silk_VQ_WMat_EC_c() */
+                bits_tot_Q8 = silk_ADD_LSHIFT32( bits_res_Q8, cl_Q5[ k + n ], 3-1 );
+                if( bits_tot_Q8 <= *rate_dist_Q8 ) {
+                    *rate_dist_Q8 = bits_tot_Q8;
+                    *res_nrg_Q15 = sum1_Q15[ n ] + penalty;
+                    *ind = (opus_int8)( k + n );
+                    *gain_Q7 = gain_tmp_Q7;
+                }
+            }
+        }
+    }
+}
@@ -31,6 +31,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "main_FIX.h"
 #include "NSQ.h"
 #include "SigProc_FIX.h"
+#if defined(FIXED_POINT)
+#include "fixed/pitch_analysis_core_FIX.h"
+#endif
 
 #if defined(OPUS_HAVE_RTCD)
 
@@ -61,6 +64,40 @@ opus_int32 (*const SILK_LPC_INVERSE_PRED_GAIN_IMPL[OPUS_ARCHMASK + 1])( /* O   R
       silk_LPC_inverse_pred_gain_neon, /* Neon */
 };
 
+void (*const SILK_NLSF_VQ_IMPL[OPUS_ARCHMASK + 1])(
+        opus_int32                  err_Q24[],          /* O    Quantization errors [K]                                     */
+        const opus_int16            in_Q15[],           /* I    Input vectors to be quantized [LPC_order]                   */
+        const opus_uint8            pCB_Q8[],           /* I    Codebook vectors [K*LPC_order]                              */
+        const opus_int16            pWght_Q9[],         /* I    Codebook weights [K*LPC_order]                              */
+        const opus_int              K,                  /* I    Number of codebook vectors                                  */
+        const opus_int              LPC_order           /* I    Number of LPCs                                              */
+) = {
+      silk_NLSF_VQ_c,    /* ARMv4 */
+      silk_NLSF_VQ_c,    /* EDSP */
+      silk_NLSF_VQ_c,    /* Media */
+      silk_NLSF_VQ_neon, /* Neon */
+};
+
+void (*const SILK_VQ_WMAT_EC_IMPL[OPUS_ARCHMASK + 1])(
+        opus_int8                   *ind,               /* O    index of best codebook vector                               */
+        opus_int32                  *res_nrg_Q15,       /* O    best residual energy                                        */
+        opus_int32                  *rate_dist_Q8,      /* O    best total bitrate                                          */
+        opus_int                    *gain_Q7,           /* O    sum of absolute LTP coefficients                            */
+        const opus_int32            *XX_Q17,            /* I    correlation matrix                                          */
+        const opus_int32            *xX_Q17,            /* I    correlation vector                                          */
+        const opus_int8             *cb_Q7,             /* I    codebook                                                    */
+        const opus_uint8            *cb_gain_Q7,        /* I    codebook effective gain                                     */
+        const opus_uint8            *cl_Q5,             /* I    code length for each codebook vector                        */
+        const opus_int              subfr_len,          /* I    number of samples per subframe                              */
+        const opus_int32            max_gain_Q7,        /* I    maximum sum of absolute LTP coefficients                    */
+        const opus_int              L                   /* I    number of vectors in codebook                               */
+) = {
+      silk_VQ_WMat_EC_c,    /* ARMv4 */
+      silk_VQ_WMat_EC_c,    /* EDSP */
+      silk_VQ_WMat_EC_c,    /* Media */
+      silk_VQ_WMat_EC_neon, /* Neon */
+};
+
 void  (*const SILK_NSQ_DEL_DEC_IMPL[OPUS_ARCHMASK + 1])(
         const silk_encoder_state    *psEncC,                                    /* I    Encoder State                   */
         silk_nsq_state              *NSQ,                                       /* I/O  NSQ state                       */
@@ -84,6 +121,20 @@ void  (*const SILK_NSQ_DEL_DEC_IMPL[OPUS_ARCHMASK + 1])(
       silk_NSQ_del_dec_neon, /* Neon */
 };
 
+void (*const SILK_LPC_ANALYSIS_FILTER_IMPL[OPUS_ARCHMASK + 1])(
+        opus_int16                  *out,               /* O    Output signal                                               */
+        const opus_int16            *in,                /* I    Input signal                                                */
+        const opus_int16            *B,                 /* I    MA prediction coefficients, Q12 [order]                     */
+        const opus_int32            len,                /* I    Signal length                                               */
+        const opus_int32            d,                  /* I    Filter order                                                */
+        int                         arch                /* I    Run-time architecture                                       */
+) = {
+      silk_LPC_analysis_filter_c,    /* ARMv4 */
+      silk_LPC_analysis_filter_c,    /* EDSP */
+      silk_LPC_analysis_filter_c,    /* Media */
+      silk_LPC_analysis_filter_neon, /* Neon */
+};
+
 /*There is no table for silk_noise_shape_quantizer_short_prediction because the
    NEON version takes different parameters than the C version.
   Instead RTCD is done via if statements at the call sites.
@@ -118,6 +169,98 @@ void (*const SILK_WARPED_AUTOCORRELATION_FIX_IMPL[OPUS_ARCHMASK + 1])(
       silk_warped_autocorrelation_FIX_neon, /* Neon */
 };
 
+void (*const SILK_P_ANA_CALC_CORR_ST2_IMPL[OPUS_ARCHMASK + 1])(
+          opus_int16                *C,                                     /* O    normalized correlations                                                     */
+    const opus_int16                *target_ptr,                            /* I    subframe, lags index back from here                                         */
+    const opus_int16                *d_comp,                                /* I    lags to evaluate                                                            */
+          opus_int                  length_d_comp,                          /* I    number of lags                                                              */
+          opus_int                  C_offset,                               /* I    lag stored at C[ 0 ]                                                        */
+          opus_int                  sf_length,                              /* I    length of a 5 ms subframe                                                   */
+          int                       arch                                    /* I    Run-time architecture                                                       */
+) = {
+      silk_P_Ana_calc_corr_st2_c,    /* ARMv4 */
+      silk_P_Ana_calc_corr_st2_c,    /* EDSP */
+      silk_P_Ana_calc_corr_st2_c,    /* Media */
+      silk_P_Ana_calc_corr_st2_neon, /* Neon */
+};
+
+void (*const SILK_P_ANA_CALC_CORR_ST3_IMPL[OPUS_ARCHMASK + 1])(
+          silk_pe_stage3_vals       *cross_corr_st3,                        /* O    3 DIM correlation array                                                     */
+    const opus_int16                *frame,                                 /* I    vector to correlate                                                         */
+          opus_int                  start_lag,                              /* I    lag offset to search around                                                 */
+          opus_int                  sf_length,                              /* I    length of a 5 ms subframe                                                   */
+          opus_int                  nb_subfr,                               /* I    number of subframes                                                         */
+          opus_int                  complexity,                             /* I    Complexity setting                                                          */
+          int                       arch                                    /* I    Run-time architecture                                                       */
+) = {
+      silk_P_Ana_calc_corr_st3_c,    /* ARMv4 */
+      silk_P_Ana_calc_corr_st3_c,    /* EDSP */
+      silk_P_Ana_calc_corr_st3_c,    /* Media */
+      silk_P_Ana_calc_corr_st3_neon, /* Neon */
+};
+
+void (*const SILK_P_ANA_CALC_ENERGY_ST3_IMPL[OPUS_ARCHMASK + 1])(
+          silk_pe_stage3_vals       *energies_st3,                          /* O    3 DIM energy array                                                          */
+    const opus_int16                *frame,                                 /* I    vector to calc energy in                                                    */
+          opus_int                  start_lag,                              /* I    lag offset to search around                                                 */
+          opus_int                  sf_length,                              /* I    length of one 5 ms subframe                                                 */
+          opus_int                  nb_subfr,                               /* I    number of subframes                                                         */
+          opus_int                  complexity,                             /* I    Complexity setting                                                          */
+          int                       arch                                    /* I    Run-time architecture                                                       */
+) = {
+      silk_P_Ana_calc_energy_st3_c,    /* ARMv4 */
+      silk_P_Ana_calc_energy_st3_c,    /* EDSP */
+      silk_P_Ana_calc_energy_st3_c,    /* Media */
+      silk_P_Ana_calc_energy_st3_neon, /* Neon */
+};
+
+void (*const SILK_CORRVECTOR_FIX_IMPL[OPUS_ARCHMASK + 1])(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *Xt,                                    /* O    Pointer to X'*t correlation vector [order]                                  */
+    const opus_int                  rshifts,                                /* I    Right shifts of correlations                                                */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+) = {
+      silk_corrVector_FIX_c,    /* ARMv4 */
+      silk_corrVector_FIX_c,    /* EDSP */
+      silk_corrVector_FIX_c,    /* Media */
+      silk_corrVector_FIX_neon, /* Neon */
+};
+
+void (*const SILK_CORRMATRIX_FIX_IMPL[OPUS_ARCHMASK + 1])(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *XX,                                    /* O    Pointer to X'*X correlation matrix [ order x order ]                        */
+    opus_int32                      *nrg,                                   /* O    Energy of x vector                                                          */
+    opus_int                        *rshifts,                               /* O    Right shifts of correlations and energy                                     */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+) = {
+      silk_corrMatrix_FIX_c,    /* ARMv4 */
+      silk_corrMatrix_FIX_c,    /* EDSP */
+      silk_corrMatrix_FIX_c,    /* Media */
+      silk_corrMatrix_FIX_neon, /* Neon */
+};
+
+void (*const SILK_LTP_ANALYSIS_FILTER_FIX_IMPL[OPUS_ARCHMASK + 1])(
+    opus_int16                      *LTP_res,                               /* O    LTP residual signal of length MAX_NB_SUBFR * ( pre_length + subfr_length )  */
+    const opus_int16                *x,                                     /* I    Pointer to input signal with at least max( pitchL ) preceding samples       */
+    const opus_int16                LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],/* I    LTP_ORDER LTP coefficients for each MAX_NB_SUBFR subframe                   */
+    const opus_int                  pitchL[ MAX_NB_SUBFR ],                 /* I    Pitch lag, one for each subframe                                            */
+    const opus_int32                invGains_Q16[ MAX_NB_SUBFR ],           /* I    Inverse quantization gains, one for each subframe                           */
+    const opus_int                  subfr_length,                           /* I    Length of each subframe                                                     */
+    const opus_int                  nb_subfr,                               /* I    Number of subframes                                                         */
+    const opus_int                  pre_length,                             /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+) = {
+      silk_LTP_analysis_filter_FIX_c,    /* ARMv4 */
+      silk_LTP_analysis_filter_FIX_c,    /* EDSP */
+      silk_LTP_analysis_filter_FIX_c,    /* Media */
+      silk_LTP_analysis_filter_FIX_neon, /* Neon */
+};
+
 # endif
 
 #endif /* OPUS_HAVE_RTCD */
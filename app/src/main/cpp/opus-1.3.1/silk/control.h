@@ -98,6 +98,9 @@ typedef struct {
     /* I: Make frames as independent as possible (but still use LPC)                        */
     opus_int reducedDependency;
 
+    /* I:   Flag to start the CBR rate control loop from a gain predicted from earlier frames */
+    opus_int useGainPrediction;
+
     /* O:   Internal sampling rate used, in Hertz; 8000/12000/16000                         */
     opus_int32 internalSampleRate;
 
@@ -120,6 +123,20 @@ typedef struct {
     opus_int offset;
 } silk_EncControlStruct;
 
+/***********************************************/
+/* Counters of the CBR rate control loop       */
+/***********************************************/
+typedef struct {
+    /* Number of frames coded with a bit budget to meet                                     */
+    opus_uint32 frames;
+
+    /* Number of times these frames ran the noise shaping quantizer                         */
+    opus_uint32 iterations;
+
+    /* Bits of the budgets these frames left unused                                         */
+    opus_uint32 unusedBits;
+} silk_RateControlStats;
+
 /**************************************************************************/
 /* Structure for controlling decoder operation and reading decoder status */
 /**************************************************************************/
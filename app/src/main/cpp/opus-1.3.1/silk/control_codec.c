@@ -74,6 +74,7 @@ opus_int silk_control_encoder(
 
     psEnc->sCmn.useDTX                 = encControl->useDTX;
     psEnc->sCmn.useCBR                 = encControl->useCBR;
+    psEnc->sCmn.useGainPrediction      = encControl->useGainPrediction;
     psEnc->sCmn.API_fs_Hz              = encControl->API_sampleRate;
     psEnc->sCmn.maxInternal_fs_Hz      = encControl->maxInternalSampleRate;
     psEnc->sCmn.minInternal_fs_Hz      = encControl->minInternalSampleRate;
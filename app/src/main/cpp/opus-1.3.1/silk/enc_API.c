@@ -131,6 +131,17 @@ static opus_int silk_QueryEncoder(                      /* O    Returns error co
     return ret;
 }
 
+/*******************************************************/
+/* Read the rate control counters since the last reset */
+/*******************************************************/
+void silk_GetRateControlStats(
+    const void                      *encState,          /* I    State                                           */
+    silk_RateControlStats           *stats              /* O    Counters                                        */
+)
+{
+    *stats = ( (const silk_encoder *)encState )->rateStats;
+}
+
 
 /**************************/
 /* Encode frame with Silk */
@@ -499,6 +510,11 @@ opus_int silk_Encode(                                   /* O    Returns error co
                     if( ( ret = silk_encode_frame_Fxx( &psEnc->state_Fxx[ n ], nBytesOut, psRangeEnc, condCoding, maxBits, useCBR ) ) != 0 ) {
                         silk_assert( 0 );
                     }
+                    if( useCBR && psEnc->state_Fxx[ n ].sCmn.rateIterations > 0 ) {
+                        psEnc->rateStats.frames++;
+                        psEnc->rateStats.iterations += psEnc->state_Fxx[ n ].sCmn.rateIterations;
+                        psEnc->rateStats.unusedBits += psEnc->state_Fxx[ n ].sCmn.rateUnusedBits;
+                    }
                 }
                 psEnc->state_Fxx[ n ].sCmn.controlled_since_last_payload = 0;
                 psEnc->state_Fxx[ n ].sCmn.inputBufIx = 0;
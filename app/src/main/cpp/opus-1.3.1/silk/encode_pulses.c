@@ -36,23 +36,33 @@ POSSIBILITY OF SUCH DAMAGE.
 /* Encode quantization indices of excitation */
 /*********************************************/
 
-static OPUS_INLINE opus_int combine_and_check(    /* return ok                           */
-    opus_int         *pulses_comb,           /* O                                   */
-    const opus_int   *pulses_in,             /* I                                   */
-    opus_int         max_pulses,             /* I    max value for sum of pulses    */
-    opus_int         len                     /* I    number of output values        */
+/* Fills in the sums of a pulse tree from its 16 leaves, see shell_coder.c */
+static OPUS_INLINE void pulse_tree_sum(
+    opus_int         *pulse_tree             /* I/O  pulse counts per tree node [32]    */
 )
 {
-    opus_int k, sum;
+    opus_int n;
 
-    for( k = 0; k < len; k++ ) {
-        sum = pulses_in[ 2 * k ] + pulses_in[ 2 * k + 1 ];
-        if( sum > max_pulses ) {
-            return 1;
-        }
-        pulses_comb[ k ] = sum;
+    for( n = SHELL_CODEC_FRAME_LENGTH - 1; n > 0; n-- ) {
+        pulse_tree[ n ] = pulse_tree[ 2 * n ] + pulse_tree[ 2 * n + 1 ];
     }
+}
 
+static OPUS_INLINE opus_int pulse_tree_too_large( /* return 1 if the tree must be scaled down */
+    const opus_int   *pulse_tree             /* I    pulse counts per tree node [32]    */
+)
+{
+    opus_int n, level;
+
+    /* 8+8 -> 16, 4+4 -> 8, 2+2 -> 4, 1+1 -> 2 */
+    for( level = 0, n = 1; n < SHELL_CODEC_FRAME_LENGTH; level++ ) {
+        opus_int end = 2 * n;
+        for( ; n < end; n++ ) {
+            if( pulse_tree[ n ] > silk_max_pulses_table[ 3 - level ] ) {
+                return 1;
+            }
+        }
+    }
     return 0;
 }
 
@@ -65,20 +75,17 @@ void silk_encode_pulses(
     const opus_int              frame_length                    /* I    Frame length                                */
 )
 {
-    opus_int   i, k, j, iter, bit, nLS, scale_down, RateLevelIndex = 0;
+    opus_int   i, k, j, iter, bit, nLS, RateLevelIndex = 0;
     opus_int32 abs_q, minSumBits_Q5, sumBits_Q5;
-    VARDECL( opus_int, abs_pulses );
+    VARDECL( opus_int, pulse_trees );
     VARDECL( opus_int, sum_pulses );
     VARDECL( opus_int, nRshifts );
-    opus_int   pulses_comb[ 8 ];
-    opus_int   *abs_pulses_ptr;
+    opus_int   *pulse_tree;
     const opus_int8 *pulses_ptr;
     const opus_uint8 *cdf_ptr;
     const opus_uint8 *nBits_ptr;
     SAVE_STACK;
 
-    silk_memset( pulses_comb, 0, 8 * sizeof( opus_int ) ); /* Fixing Valgrind reported problem*/
-
     /****************************/
     /* Prepare for shell coding */
     /****************************/
@@ -91,45 +98,31 @@ void silk_encode_pulses(
         silk_memset( &pulses[ frame_length ], 0, SHELL_CODEC_FRAME_LENGTH * sizeof(opus_int8));
     }
 
-    /* Take the absolute value of the pulses */
-    ALLOC( abs_pulses, iter * SHELL_CODEC_FRAME_LENGTH, opus_int );
-    silk_assert( !( SHELL_CODEC_FRAME_LENGTH & 3 ) );
-    for( i = 0; i < iter * SHELL_CODEC_FRAME_LENGTH; i+=4 ) {
-        abs_pulses[i+0] = ( opus_int )silk_abs( pulses[ i + 0 ] );
-        abs_pulses[i+1] = ( opus_int )silk_abs( pulses[ i + 1 ] );
-        abs_pulses[i+2] = ( opus_int )silk_abs( pulses[ i + 2 ] );
-        abs_pulses[i+3] = ( opus_int )silk_abs( pulses[ i + 3 ] );
-    }
-
-    /* Calc sum pulses per shell code frame */
+    /* Build the pulse tree of each shell code frame from the absolute values of the pulses */
+    ALLOC( pulse_trees, iter * 2 * SHELL_CODEC_FRAME_LENGTH, opus_int );
     ALLOC( sum_pulses, iter, opus_int );
     ALLOC( nRshifts, iter, opus_int );
-    abs_pulses_ptr = abs_pulses;
     for( i = 0; i < iter; i++ ) {
-        nRshifts[ i ] = 0;
+        pulse_tree = &pulse_trees[ i * 2 * SHELL_CODEC_FRAME_LENGTH ];
+        pulses_ptr = &pulses[ i * SHELL_CODEC_FRAME_LENGTH ];
+        for( k = 0; k < SHELL_CODEC_FRAME_LENGTH; k++ ) {
+            pulse_tree[ SHELL_CODEC_FRAME_LENGTH + k ] = ( opus_int )silk_abs( pulses_ptr[ k ] );
+        }
+        pulse_tree_sum( pulse_tree );
 
-        while( 1 ) {
-            /* 1+1 -> 2 */
-            scale_down = combine_and_check( pulses_comb, abs_pulses_ptr, silk_max_pulses_table[ 0 ], 8 );
-            /* 2+2 -> 4 */
-            scale_down += combine_and_check( pulses_comb, pulses_comb, silk_max_pulses_table[ 1 ], 4 );
-            /* 4+4 -> 8 */
-            scale_down += combine_and_check( pulses_comb, pulses_comb, silk_max_pulses_table[ 2 ], 2 );
-            /* 8+8 -> 16 */
-            scale_down += combine_and_check( &sum_pulses[ i ], pulses_comb, silk_max_pulses_table[ 3 ], 1 );
-
-            if( scale_down ) {
+        /* No node can exceed its limit with 8 pulses or less, the smallest limit */
+        nRshifts[ i ] = 0;
+        if( pulse_tree[ 1 ] > silk_max_pulses_table[ 0 ] ) {
+            while( pulse_tree_too_large( pulse_tree ) ) {
                 /* We need to downscale the quantization signal */
                 nRshifts[ i ]++;
-                for( k = 0; k < SHELL_CODEC_FRAME_LENGTH; k++ ) {
-                    abs_pulses_ptr[ k ] = silk_RSHIFT( abs_pulses_ptr[ k ], 1 );
+                for( k = SHELL_CODEC_FRAME_LENGTH; k < 2 * SHELL_CODEC_FRAME_LENGTH; k++ ) {
+                    pulse_tree[ k ] = silk_RSHIFT( pulse_tree[ k ], 1 );
                 }
-            } else {
-                /* Jump out of while(1) loop and go to next shell coding frame */
-                break;
+                pulse_tree_sum( pulse_tree );
             }
         }
-        abs_pulses_ptr += SHELL_CODEC_FRAME_LENGTH;
+        sum_pulses[ i ] = pulse_tree[ 1 ];
     }
 
     /**************/
@@ -175,7 +168,7 @@ void silk_encode_pulses(
     /******************/
     for( i = 0; i < iter; i++ ) {
         if( sum_pulses[ i ] > 0 ) {
-            silk_shell_encoder( psRangeEnc, &abs_pulses[ i * SHELL_CODEC_FRAME_LENGTH ] );
+            silk_shell_encoder( psRangeEnc, &pulse_trees[ i * 2 * SHELL_CODEC_FRAME_LENGTH ] );
         }
     }
 
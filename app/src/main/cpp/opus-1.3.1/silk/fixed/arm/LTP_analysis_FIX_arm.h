@@ -0,0 +1,106 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifndef SILK_LTP_ANALYSIS_FIX_ARM_H
+# define SILK_LTP_ANALYSIS_FIX_ARM_H
+
+# include "celt/arm/armcpu.h"
+
+# if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+void silk_corrVector_FIX_neon(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *Xt,                                    /* O    Pointer to X'*t correlation vector [order]                                  */
+    const opus_int                  rshifts,                                /* I    Right shifts of correlations                                                */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+);
+
+void silk_corrMatrix_FIX_neon(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *XX,                                    /* O    Pointer to X'*X correlation matrix [ order x order ]                        */
+    opus_int32                      *nrg,                                   /* O    Energy of x vector                                                          */
+    opus_int                        *rshifts,                               /* O    Right shifts of correlations and energy                                     */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+);
+
+void silk_LTP_analysis_filter_FIX_neon(
+    opus_int16                      *LTP_res,                               /* O    LTP residual signal of length MAX_NB_SUBFR * ( pre_length + subfr_length )  */
+    const opus_int16                *x,                                     /* I    Pointer to input signal with at least max( pitchL ) preceding samples       */
+    const opus_int16                LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],/* I    LTP_ORDER LTP coefficients for each MAX_NB_SUBFR subframe                   */
+    const opus_int                  pitchL[ MAX_NB_SUBFR ],                 /* I    Pitch lag, one for each subframe                                            */
+    const opus_int32                invGains_Q16[ MAX_NB_SUBFR ],           /* I    Inverse quantization gains, one for each subframe                           */
+    const opus_int                  subfr_length,                           /* I    Length of each subframe                                                     */
+    const opus_int                  nb_subfr,                               /* I    Number of subframes                                                         */
+    const opus_int                  pre_length,                             /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+);
+
+#  if defined(OPUS_ARM_PRESUME_NEON_INTR)
+#   define OVERRIDE_silk_corrVector_FIX
+#   define silk_corrVector_FIX(x, t, L, order, Xt, rshifts, arch) \
+    silk_corrVector_FIX_neon(x, t, L, order, Xt, rshifts, arch)
+
+#   define OVERRIDE_silk_corrMatrix_FIX
+#   define silk_corrMatrix_FIX(x, L, order, XX, nrg, rshifts, arch) \
+    silk_corrMatrix_FIX_neon(x, L, order, XX, nrg, rshifts, arch)
+
+#   define OVERRIDE_silk_LTP_analysis_filter_FIX
+#   define silk_LTP_analysis_filter_FIX(LTP_res, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch) \
+    silk_LTP_analysis_filter_FIX_neon(LTP_res, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch)
+
+#  elif defined(OPUS_HAVE_RTCD)
+
+extern void (*const SILK_CORRVECTOR_FIX_IMPL[ OPUS_ARCHMASK + 1 ])(
+    const opus_int16 *x, const opus_int16 *t, const opus_int L, const opus_int order, opus_int32 *Xt,
+    const opus_int rshifts, int arch);
+#   define OVERRIDE_silk_corrVector_FIX
+#   define silk_corrVector_FIX(x, t, L, order, Xt, rshifts, arch) \
+    ((*SILK_CORRVECTOR_FIX_IMPL[ (arch) & OPUS_ARCHMASK ])(x, t, L, order, Xt, rshifts, arch))
+
+extern void (*const SILK_CORRMATRIX_FIX_IMPL[ OPUS_ARCHMASK + 1 ])(
+    const opus_int16 *x, const opus_int L, const opus_int order, opus_int32 *XX, opus_int32 *nrg,
+    opus_int *rshifts, int arch);
+#   define OVERRIDE_silk_corrMatrix_FIX
+#   define silk_corrMatrix_FIX(x, L, order, XX, nrg, rshifts, arch) \
+    ((*SILK_CORRMATRIX_FIX_IMPL[ (arch) & OPUS_ARCHMASK ])(x, L, order, XX, nrg, rshifts, arch))
+
+extern void (*const SILK_LTP_ANALYSIS_FILTER_FIX_IMPL[ OPUS_ARCHMASK + 1 ])(
+    opus_int16 *LTP_res, const opus_int16 *x, const opus_int16 LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],
+    const opus_int pitchL[ MAX_NB_SUBFR ], const opus_int32 invGains_Q16[ MAX_NB_SUBFR ],
+    const opus_int subfr_length, const opus_int nb_subfr, const opus_int pre_length, int arch);
+#   define OVERRIDE_silk_LTP_analysis_filter_FIX
+#   define silk_LTP_analysis_filter_FIX(LTP_res, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch) \
+    ((*SILK_LTP_ANALYSIS_FILTER_FIX_IMPL[ (arch) & OPUS_ARCHMASK ])(LTP_res, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch))
+
+#  endif
+# endif
+
+#endif /* SILK_LTP_ANALYSIS_FIX_ARM_H */
@@ -0,0 +1,208 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "main_FIX.h"
+
+/* The correlations reuse silk_inner_prod_aligned_scale_neon(), which shifts */
+/* each product like the C loops, and the LTP prediction wraps like          */
+/* silk_SMLABB_ovflw(), so the results are bit-exact. The O( order^2 )       */
+/* recursions stay scalar.                                                   */
+
+/* Calculates correlation vector X'*t */
+void silk_corrVector_FIX_neon(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *Xt,                                    /* O    Pointer to X'*t correlation vector [order]                                  */
+    const opus_int                  rshifts,                                /* I    Right shifts of correlations                                                */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+)
+{
+    opus_int         lag;
+    const opus_int16 *ptr1;
+
+    ptr1 = &x[ order - 1 ]; /* Points to first sample of column 0 of X: X[:,0] */
+    if( rshifts > 0 ) {
+        for( lag = 0; lag < order; lag++ ) {
+            Xt[ lag ] = silk_inner_prod_aligned_scale_neon( ptr1 - lag, t, rshifts, L ); /* X[:,lag]'*t */
+        }
+    } else {
+        silk_assert( rshifts == 0 );
+        for( lag = 0; lag < order; lag++ ) {
+            Xt[ lag ] = silk_inner_prod_aligned( ptr1 - lag, t, L, arch ); /* X[:,lag]'*t */
+        }
+    }
+}
+
+/* Calculates correlation matrix X'*X */
+void silk_corrMatrix_FIX_neon(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *XX,                                    /* O    Pointer to X'*X correlation matrix [ order x order ]                        */
+    opus_int32                      *nrg,                                   /* O    Energy of x vector                                                          */
+    opus_int                        *rshifts,                               /* O    Right shifts of correlations and energy                                     */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+)
+{
+    opus_int         i, j, lag;
+    opus_int32       energy;
+    const opus_int16 *ptr1, *ptr2;
+
+    /* Calculate energy to find shift used to fit in 32 bits */
+    silk_sum_sqr_shift( nrg, rshifts, x, L + order - 1 );
+    energy = *nrg;
+
+    /* Calculate energy of first column (0) of X: X[:,0]'*X[:,0] */
+    /* Remove contribution of first order - 1 samples */
+    for( i = 0; i < order - 1; i++ ) {
+        energy -= silk_RSHIFT32( silk_SMULBB( x[ i ], x[ i ] ), *rshifts );
+    }
+
+    /* Calculate energy of remaining columns of X: X[:,j]'*X[:,j] */
+    /* Fill out the diagonal of the correlation matrix */
+    matrix_ptr( XX, 0, 0, order ) = energy;
+    silk_assert( energy >= 0 );
+    ptr1 = &x[ order - 1 ]; /* First sample of column 0 of X */
+    for( j = 1; j < order; j++ ) {
+        energy = silk_SUB32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ L - j ], ptr1[ L - j ] ), *rshifts ) );
+        energy = silk_ADD32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ -j ], ptr1[ -j ] ), *rshifts ) );
+        matrix_ptr( XX, j, j, order ) = energy;
+        silk_assert( energy >= 0 );
+    }
+
+    ptr2 = &x[ order - 2 ]; /* First sample of column 1 of X */
+    /* Calculate the remaining elements of the correlation matrix */
+    for( lag = 1; lag < order; lag++ ) {
+        /* Inner product of column 0 and column lag: X[:,0]'*X[:,lag] */
+        if( *rshifts > 0 ) {
+            energy = silk_inner_prod_aligned_scale_neon( ptr1, ptr2, *rshifts, L );
+        } else {
+            energy = silk_inner_prod_aligned( ptr1, ptr2, L, arch );
+        }
+        matrix_ptr( XX, lag, 0, order ) = energy;
+        matrix_ptr( XX, 0, lag, order ) = energy;
+        /* Calculate remaining off diagonal: X[:,j]'*X[:,j + lag] */
+        for( j = 1; j < ( order - lag ); j++ ) {
+            energy = silk_SUB32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ L - j ], ptr2[ L - j ] ), *rshifts ) );
+            energy = silk_ADD32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ -j ], ptr2[ -j ] ), *rshifts ) );
+            matrix_ptr( XX, lag + j, j, order ) = energy;
+            matrix_ptr( XX, j, lag + j, order ) = energy;
+        }
+        ptr2--; /* Update pointer to first sample of next column (lag) in X */
+    }
+}
+
+void silk_LTP_analysis_filter_FIX_neon(
+    opus_int16                      *LTP_res,                               /* O    LTP residual signal of length MAX_NB_SUBFR * ( pre_length + subfr_length )  */
+    const opus_int16                *x,                                     /* I    Pointer to input signal with at least max( pitchL ) preceding samples       */
+    const opus_int16                LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],/* I    LTP_ORDER LTP coefficients for each MAX_NB_SUBFR subframe                   */
+    const opus_int                  pitchL[ MAX_NB_SUBFR ],                 /* I    Pitch lag, one for each subframe                                            */
+    const opus_int32                invGains_Q16[ MAX_NB_SUBFR ],           /* I    Inverse quantization gains, one for each subframe                           */
+    const opus_int                  subfr_length,                           /* I    Length of each subframe                                                     */
+    const opus_int                  nb_subfr,                               /* I    Number of subframes                                                         */
+    const opus_int                  pre_length,                             /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+)
+{
+    const opus_int16 *x_ptr, *x_lag_ptr, *B_Q14;
+    opus_int16   *LTP_res_ptr;
+    opus_int     k, i, len;
+    opus_int32   LTP_est;
+    opus_int16   gain_lo;
+    int16x8_t    gain_hi, gain_lo_neg, xv, p2, p1, p0, m1, m2, res;
+    int32x4_t    est_lo, est_hi;
+    int16x4_t    scaled_lo, scaled_hi;
+
+    (void)arch;
+    len = subfr_length + pre_length;
+    x_ptr = x;
+    LTP_res_ptr = LTP_res;
+    for( k = 0; k < nb_subfr; k++ ) {
+
+        x_lag_ptr = x_ptr - pitchL[ k ];
+        B_Q14 = &LTPCoef_Q14[ k * LTP_ORDER ];
+
+        /* silk_SMULWB() modulo 2^16, with the gain split into signed 16-bit halves */
+        gain_hi = vdupq_n_s16( (opus_int16)( invGains_Q16[ k ] >> 16 ) );
+        gain_lo = (opus_int16)invGains_Q16[ k ];
+        gain_lo_neg = vdupq_n_s16( gain_lo < 0 ? -1 : 0 );
+
+        for( i = 0; i < len - 7; i += 8 ) {
+            p2 = vld1q_s16( &x_lag_ptr[ i + 2 ] );
+            p1 = vld1q_s16( &x_lag_ptr[ i + 1 ] );
+            p0 = vld1q_s16( &x_lag_ptr[ i ] );
+            m1 = vld1q_s16( &x_lag_ptr[ i - 1 ] );
+            m2 = vld1q_s16( &x_lag_ptr[ i - 2 ] );
+
+            /* Long-term prediction */
+            est_lo = vmull_n_s16( vget_low_s16( p2 ), B_Q14[ 0 ] );
+            est_lo = vmlal_n_s16( est_lo, vget_low_s16( p1 ), B_Q14[ 1 ] );
+            est_lo = vmlal_n_s16( est_lo, vget_low_s16( p0 ), B_Q14[ 2 ] );
+            est_lo = vmlal_n_s16( est_lo, vget_low_s16( m1 ), B_Q14[ 3 ] );
+            est_lo = vmlal_n_s16( est_lo, vget_low_s16( m2 ), B_Q14[ 4 ] );
+            est_hi = vmull_n_s16( vget_high_s16( p2 ), B_Q14[ 0 ] );
+            est_hi = vmlal_n_s16( est_hi, vget_high_s16( p1 ), B_Q14[ 1 ] );
+            est_hi = vmlal_n_s16( est_hi, vget_high_s16( p0 ), B_Q14[ 2 ] );
+            est_hi = vmlal_n_s16( est_hi, vget_high_s16( m1 ), B_Q14[ 3 ] );
+            est_hi = vmlal_n_s16( est_hi, vget_high_s16( m2 ), B_Q14[ 4 ] );
+
+            /* Subtract long-term prediction; vrshrq_n_s32() rounds like silk_RSHIFT_ROUND() */
+            xv = vld1q_s16( &x_ptr[ i ] );
+            est_lo = vsubq_s32( vmovl_s16( vget_low_s16( xv ) ), vrshrq_n_s32( est_lo, 14 ) );
+            est_hi = vsubq_s32( vmovl_s16( vget_high_s16( xv ) ), vrshrq_n_s32( est_hi, 14 ) );
+            res = vcombine_s16( vqmovn_s32( est_lo ), vqmovn_s32( est_hi ) );
+
+            /* Scale residual */
+            scaled_lo = vshrn_n_s32( vmull_n_s16( vget_low_s16( res ), gain_lo ), 16 );
+            scaled_hi = vshrn_n_s32( vmull_n_s16( vget_high_s16( res ), gain_lo ), 16 );
+            res = vaddq_s16( vmulq_s16( res, gain_hi ),
+                  vaddq_s16( vcombine_s16( scaled_lo, scaled_hi ), vandq_s16( res, gain_lo_neg ) ) );
+            vst1q_s16( &LTP_res_ptr[ i ], res );
+        }
+        for( ; i < len; i++ ) {
+            LTP_est = silk_SMULBB( x_lag_ptr[ i + LTP_ORDER / 2 ], B_Q14[ 0 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i + 1 ], B_Q14[ 1 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i ], B_Q14[ 2 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i - 1 ], B_Q14[ 3 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i - 2 ], B_Q14[ 4 ] );
+            LTP_est = silk_RSHIFT_ROUND( LTP_est, 14 );
+            LTP_res_ptr[ i ] = (opus_int16)silk_SAT16( (opus_int32)x_ptr[ i ] - LTP_est );
+            LTP_res_ptr[ i ] = silk_SMULWB( invGains_Q16[ k ], LTP_res_ptr[ i ] );
+        }
+
+        /* Update pointers */
+        LTP_res_ptr += len;
+        x_ptr       += subfr_length;
+    }
+}
@@ -0,0 +1,103 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifndef SILK_PITCH_ANALYSIS_CORE_FIX_ARM_H
+# define SILK_PITCH_ANALYSIS_CORE_FIX_ARM_H
+
+# include "celt/arm/armcpu.h"
+
+# if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+void silk_P_Ana_calc_corr_st2_neon(
+    opus_int16        C[],                              /* O    normalized correlations                 */
+    const opus_int16  target_ptr[],                     /* I    subframe, lags index back from here     */
+    const opus_int16  d_comp[],                         /* I    lags to evaluate                        */
+    opus_int          length_d_comp,                    /* I    number of lags                          */
+    opus_int          C_offset,                         /* I    lag stored at C[ 0 ]                    */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    int               arch                              /* I    Run-time architecture                   */
+);
+
+void silk_P_Ana_calc_corr_st3_neon(
+    silk_pe_stage3_vals cross_corr_st3[],               /* O    3 DIM correlation array                 */
+    const opus_int16  frame[],                          /* I    vector to correlate                     */
+    opus_int          start_lag,                        /* I    lag offset to search around             */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    int               arch                              /* I    Run-time architecture                   */
+);
+
+void silk_P_Ana_calc_energy_st3_neon(
+    silk_pe_stage3_vals energies_st3[],                 /* O    3 DIM energy array                      */
+    const opus_int16  frame[],                          /* I    vector to calc energy in                */
+    opus_int          start_lag,                        /* I    lag offset to search around             */
+    opus_int          sf_length,                        /* I    length of one 5 ms subframe             */
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    int               arch                              /* I    Run-time architecture                   */
+);
+
+#  if defined(OPUS_ARM_PRESUME_NEON_INTR)
+#   define OVERRIDE_silk_P_Ana_calc_corr_st2
+#   define silk_P_Ana_calc_corr_st2(C, target_ptr, d_comp, length_d_comp, C_offset, sf_length, arch) \
+    silk_P_Ana_calc_corr_st2_neon(C, target_ptr, d_comp, length_d_comp, C_offset, sf_length, arch)
+
+#   define OVERRIDE_silk_P_Ana_calc_corr_st3
+#   define silk_P_Ana_calc_corr_st3(cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch) \
+    silk_P_Ana_calc_corr_st3_neon(cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch)
+
+#   define OVERRIDE_silk_P_Ana_calc_energy_st3
+#   define silk_P_Ana_calc_energy_st3(energies_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch) \
+    silk_P_Ana_calc_energy_st3_neon(energies_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch)
+
+#  elif defined(OPUS_HAVE_RTCD)
+
+extern void (*const SILK_P_ANA_CALC_CORR_ST2_IMPL[ OPUS_ARCHMASK + 1 ])(
+    opus_int16 *C, const opus_int16 *target_ptr, const opus_int16 *d_comp, opus_int length_d_comp,
+    opus_int C_offset, opus_int sf_length, int arch);
+#   define OVERRIDE_silk_P_Ana_calc_corr_st2
+#   define silk_P_Ana_calc_corr_st2(C, target_ptr, d_comp, length_d_comp, C_offset, sf_length, arch) \
+    ((*SILK_P_ANA_CALC_CORR_ST2_IMPL[ (arch) & OPUS_ARCHMASK ])(C, target_ptr, d_comp, length_d_comp, C_offset, sf_length, arch))
+
+extern void (*const SILK_P_ANA_CALC_CORR_ST3_IMPL[ OPUS_ARCHMASK + 1 ])(
+    silk_pe_stage3_vals *cross_corr_st3, const opus_int16 *frame, opus_int start_lag, opus_int sf_length,
+    opus_int nb_subfr, opus_int complexity, int arch);
+#   define OVERRIDE_silk_P_Ana_calc_corr_st3
+#   define silk_P_Ana_calc_corr_st3(cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch) \
+    ((*SILK_P_ANA_CALC_CORR_ST3_IMPL[ (arch) & OPUS_ARCHMASK ])(cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch))
+
+extern void (*const SILK_P_ANA_CALC_ENERGY_ST3_IMPL[ OPUS_ARCHMASK + 1 ])(
+    silk_pe_stage3_vals *energies_st3, const opus_int16 *frame, opus_int start_lag, opus_int sf_length,
+    opus_int nb_subfr, opus_int complexity, int arch);
+#   define OVERRIDE_silk_P_Ana_calc_energy_st3
+#   define silk_P_Ana_calc_energy_st3(energies_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch) \
+    ((*SILK_P_ANA_CALC_ENERGY_ST3_IMPL[ (arch) & OPUS_ARCHMASK ])(energies_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch))
+
+#  endif
+# endif
+
+#endif /* SILK_PITCH_ANALYSIS_CORE_FIX_ARM_H */
@@ -0,0 +1,271 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "SigProc_FIX.h"
+#include "pitch_analysis_core_FIX.h"
+
+/* All sums are plain 32-bit additions of 16x16 products, exactly as in    */
+/* silk_inner_prod_aligned() and celt_pitch_xcorr(), so evaluating them in */
+/* a different order gives bit-exact results.                              */
+
+/* Lane i of the result is the sum of all lanes of ai */
+static OPUS_INLINE int32x4_t silk_hsum4_neon( int32x4_t a0, int32x4_t a1, int32x4_t a2, int32x4_t a3 )
+{
+#if defined(OPUS_ARM_PRESUME_AARCH64_NEON_INTR)
+    return vpaddq_s32( vpaddq_s32( a0, a1 ), vpaddq_s32( a2, a3 ) );
+#else
+    int32x2_t s0, s1, s2, s3;
+    s0 = vpadd_s32( vget_low_s32( a0 ), vget_high_s32( a0 ) );
+    s1 = vpadd_s32( vget_low_s32( a1 ), vget_high_s32( a1 ) );
+    s2 = vpadd_s32( vget_low_s32( a2 ), vget_high_s32( a2 ) );
+    s3 = vpadd_s32( vget_low_s32( a3 ), vget_high_s32( a3 ) );
+    return vcombine_s32( vpadd_s32( s0, s1 ), vpadd_s32( s2, s3 ) );
+#endif
+}
+
+static OPUS_INLINE int32x4_t silk_mlal8_neon( int32x4_t acc, int16x8_t a, int16x8_t b )
+{
+    acc = vmlal_s16( acc, vget_low_s16( a ), vget_low_s16( b ) );
+    return vmlal_s16( acc, vget_high_s16( a ), vget_high_s16( b ) );
+}
+
+/* out[ k ] = x . y[ k ] over len samples, for the 4 vectors y[ k ] */
+static OPUS_INLINE void silk_xcorr4_neon(
+    const opus_int16 *x,
+    const opus_int16 *y0,
+    const opus_int16 *y1,
+    const opus_int16 *y2,
+    const opus_int16 *y3,
+    opus_int          len,
+    opus_int32        out[ 4 ]
+)
+{
+    int32x4_t acc0, acc1, acc2, acc3;
+    int16x8_t xv;
+    int16x4_t xt;
+    opus_int i;
+
+    acc0 = acc1 = acc2 = acc3 = vdupq_n_s32( 0 );
+    for( i = 0; i < len - 7; i += 8 ) {
+        xv = vld1q_s16( &x[ i ] );
+        acc0 = silk_mlal8_neon( acc0, xv, vld1q_s16( &y0[ i ] ) );
+        acc1 = silk_mlal8_neon( acc1, xv, vld1q_s16( &y1[ i ] ) );
+        acc2 = silk_mlal8_neon( acc2, xv, vld1q_s16( &y2[ i ] ) );
+        acc3 = silk_mlal8_neon( acc3, xv, vld1q_s16( &y3[ i ] ) );
+    }
+    if( i < len - 3 ) {
+        xt = vld1_s16( &x[ i ] );
+        acc0 = vmlal_s16( acc0, xt, vld1_s16( &y0[ i ] ) );
+        acc1 = vmlal_s16( acc1, xt, vld1_s16( &y1[ i ] ) );
+        acc2 = vmlal_s16( acc2, xt, vld1_s16( &y2[ i ] ) );
+        acc3 = vmlal_s16( acc3, xt, vld1_s16( &y3[ i ] ) );
+        i += 4;
+    }
+    vst1q_s32( out, silk_hsum4_neon( acc0, acc1, acc2, acc3 ) );
+    for( ; i < len; i++ ) {
+        out[ 0 ] = silk_MLA( out[ 0 ], x[ i ], y0[ i ] );
+        out[ 1 ] = silk_MLA( out[ 1 ], x[ i ], y1[ i ] );
+        out[ 2 ] = silk_MLA( out[ 2 ], x[ i ], y2[ i ] );
+        out[ 3 ] = silk_MLA( out[ 3 ], x[ i ], y3[ i ] );
+    }
+}
+
+/* out = { x . y0, y0 . y0, x . y1, y1 . y1 } over len samples */
+static OPUS_INLINE void silk_corr_energy2_neon(
+    const opus_int16 *x,
+    const opus_int16 *y0,
+    const opus_int16 *y1,
+    opus_int          len,
+    opus_int32        out[ 4 ]
+)
+{
+    int32x4_t acc0, acc1, acc2, acc3;
+    int16x8_t xv, yv0, yv1;
+    int16x4_t xt, yt0, yt1;
+    opus_int i;
+
+    acc0 = acc1 = acc2 = acc3 = vdupq_n_s32( 0 );
+    for( i = 0; i < len - 7; i += 8 ) {
+        xv  = vld1q_s16( &x[ i ] );
+        yv0 = vld1q_s16( &y0[ i ] );
+        yv1 = vld1q_s16( &y1[ i ] );
+        acc0 = silk_mlal8_neon( acc0, xv, yv0 );
+        acc1 = silk_mlal8_neon( acc1, yv0, yv0 );
+        acc2 = silk_mlal8_neon( acc2, xv, yv1 );
+        acc3 = silk_mlal8_neon( acc3, yv1, yv1 );
+    }
+    if( i < len - 3 ) {
+        xt  = vld1_s16( &x[ i ] );
+        yt0 = vld1_s16( &y0[ i ] );
+        yt1 = vld1_s16( &y1[ i ] );
+        acc0 = vmlal_s16( acc0, xt, yt0 );
+        acc1 = vmlal_s16( acc1, yt0, yt0 );
+        acc2 = vmlal_s16( acc2, xt, yt1 );
+        acc3 = vmlal_s16( acc3, yt1, yt1 );
+        i += 4;
+    }
+    vst1q_s32( out, silk_hsum4_neon( acc0, acc1, acc2, acc3 ) );
+    for( ; i < len; i++ ) {
+        out[ 0 ] = silk_MLA( out[ 0 ], x[ i ], y0[ i ] );
+        out[ 1 ] = silk_MLA( out[ 1 ], y0[ i ], y0[ i ] );
+        out[ 2 ] = silk_MLA( out[ 2 ], x[ i ], y1[ i ] );
+        out[ 3 ] = silk_MLA( out[ 3 ], y1[ i ], y1[ i ] );
+    }
+}
+
+static OPUS_INLINE opus_int32 silk_energy_neon( const opus_int16 *x, opus_int len )
+{
+    opus_int32 out[ 4 ];
+    silk_corr_energy2_neon( x, x, x, len, out );
+    return out[ 0 ];
+}
+
+static OPUS_INLINE opus_int16 silk_P_Ana_normalize_st2( opus_int32 cross_corr, opus_int32 energy_target, opus_int32 energy_basis )
+{
+    if( cross_corr > 0 ) {
+        return (opus_int16)silk_DIV32_varQ( cross_corr, silk_ADD32( energy_target, energy_basis ), 13 + 1 ); /* Q13 */
+    }
+    return 0;
+}
+
+void silk_P_Ana_calc_corr_st2_neon(
+    opus_int16        C[],                              /* O    normalized correlations                 */
+    const opus_int16  target_ptr[],                     /* I    subframe, lags index back from here     */
+    const opus_int16  d_comp[],                         /* I    lags to evaluate                        */
+    opus_int          length_d_comp,                    /* I    number of lags                          */
+    opus_int          C_offset,                         /* I    lag stored at C[ 0 ]                    */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    int               arch                              /* I    Run-time architecture                   */
+)
+{
+    opus_int32 energy_target, sums[ 4 ];
+    opus_int   j;
+
+    (void)arch;
+    energy_target = silk_ADD32( silk_energy_neon( target_ptr, sf_length ), 1 );
+    /* Correlation and basis energy of two lags at a time, the energy is */
+    /* always computed since it costs less than a branch here            */
+    for( j = 0; j < length_d_comp - 1; j += 2 ) {
+        silk_corr_energy2_neon( target_ptr, target_ptr - d_comp[ j ], target_ptr - d_comp[ j + 1 ], sf_length, sums );
+        C[ d_comp[ j ] - C_offset ]     = silk_P_Ana_normalize_st2( sums[ 0 ], energy_target, sums[ 1 ] );
+        C[ d_comp[ j + 1 ] - C_offset ] = silk_P_Ana_normalize_st2( sums[ 2 ], energy_target, sums[ 3 ] );
+    }
+    if( j < length_d_comp ) {
+        silk_corr_energy2_neon( target_ptr, target_ptr - d_comp[ j ], target_ptr - d_comp[ j ], sf_length, sums );
+        C[ d_comp[ j ] - C_offset ] = silk_P_Ana_normalize_st2( sums[ 0 ], energy_target, sums[ 1 ] );
+    }
+}
+
+void silk_P_Ana_calc_corr_st3_neon(
+    silk_pe_stage3_vals cross_corr_st3[],               /* O    3 DIM correlation array                 */
+    const opus_int16  frame[],                          /* I    vector to correlate                     */
+    opus_int          start_lag,                        /* I    lag offset to search around             */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    int               arch                              /* I    Run-time architecture                   */
+)
+{
+    const opus_int16 *target_ptr, *basis_ptr;
+    opus_int32 scratch_mem[ SILK_PE_ST3_MAX_LAGS + 3 ];
+    opus_int   k, j, lag_low, lag_high, lag_counter, last;
+    opus_int   nb_cbk_search, cbk_size;
+    const opus_int8 *Lag_range_ptr, *Lag_CB_ptr;
+
+    (void)arch;
+    silk_P_Ana_stage3_codebook( nb_subfr, complexity, &Lag_range_ptr, &Lag_CB_ptr, &nb_cbk_search, &cbk_size );
+
+    target_ptr = &frame[ silk_LSHIFT( sf_length, 2 ) ]; /* Pointer to middle of frame */
+    for( k = 0; k < nb_subfr; k++ ) {
+        lag_low  = matrix_ptr( Lag_range_ptr, k, 0, 2 );
+        lag_high = matrix_ptr( Lag_range_ptr, k, 1, 2 );
+        lag_counter = lag_high - lag_low + 1;
+        celt_assert( lag_counter <= SILK_PE_ST3_MAX_LAGS );
+
+        /* scratch_mem[ j ] is the correlation at lag start_lag + lag_low + j, */
+        /* the last group repeats its final lag rather than reading past it   */
+        basis_ptr = target_ptr - start_lag - lag_low;
+        last = lag_counter - 1;
+        for( j = 0; j < lag_counter; j += 4 ) {
+            silk_xcorr4_neon( target_ptr, basis_ptr - j, basis_ptr - silk_min_int( j + 1, last ),
+                              basis_ptr - silk_min_int( j + 2, last ), basis_ptr - silk_min_int( j + 3, last ),
+                              sf_length, &scratch_mem[ j ] );
+        }
+
+        silk_P_Ana_scatter_st3( cross_corr_st3, scratch_mem, lag_counter, Lag_range_ptr, Lag_CB_ptr,
+                                k, nb_cbk_search, cbk_size );
+        target_ptr += sf_length;
+    }
+}
+
+void silk_P_Ana_calc_energy_st3_neon(
+    silk_pe_stage3_vals energies_st3[],                 /* O    3 DIM energy array                      */
+    const opus_int16  frame[],                          /* I    vector to calc energy in                */
+    opus_int          start_lag,                        /* I    lag offset to search around             */
+    opus_int          sf_length,                        /* I    length of one 5 ms subframe             */
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    int               arch                              /* I    Run-time architecture                   */
+)
+{
+    const opus_int16 *target_ptr, *basis_ptr;
+    opus_int32 energy, scratch_mem[ SILK_PE_ST3_MAX_LAGS ];
+    opus_int   k, i, lag_diff;
+    opus_int   nb_cbk_search, cbk_size;
+    const opus_int8 *Lag_range_ptr, *Lag_CB_ptr;
+
+    (void)arch;
+    silk_P_Ana_stage3_codebook( nb_subfr, complexity, &Lag_range_ptr, &Lag_CB_ptr, &nb_cbk_search, &cbk_size );
+
+    target_ptr = &frame[ silk_LSHIFT( sf_length, 2 ) ];
+    for( k = 0; k < nb_subfr; k++ ) {
+        /* Energy of the first lag, the others follow recursively as in the */
+        /* C version, including its saturation                              */
+        basis_ptr = target_ptr - ( start_lag + matrix_ptr( Lag_range_ptr, k, 0, 2 ) );
+        energy = silk_energy_neon( basis_ptr, sf_length );
+        silk_assert( energy >= 0 );
+        scratch_mem[ 0 ] = energy;
+
+        lag_diff = ( matrix_ptr( Lag_range_ptr, k, 1, 2 ) -  matrix_ptr( Lag_range_ptr, k, 0, 2 ) + 1 );
+        celt_assert( lag_diff <= SILK_PE_ST3_MAX_LAGS );
+        for( i = 1; i < lag_diff; i++ ) {
+            energy -= silk_SMULBB( basis_ptr[ sf_length - i ], basis_ptr[ sf_length - i ] );
+            energy = silk_ADD_SAT32( energy, silk_SMULBB( basis_ptr[ -i ], basis_ptr[ -i ] ) );
+            silk_assert( energy >= 0 );
+            scratch_mem[ i ] = energy;
+        }
+
+        silk_P_Ana_scatter_st3( energies_st3, scratch_mem, lag_diff, Lag_range_ptr, Lag_CB_ptr,
+                                k, nb_cbk_search, cbk_size );
+        target_ptr += sf_length;
+    }
+}
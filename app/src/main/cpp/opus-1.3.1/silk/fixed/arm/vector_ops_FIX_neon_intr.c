@@ -0,0 +1,63 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "SigProc_FIX.h"
+
+/* silk_SMULWB() split as ( gain_Q16 >> 16 ) * x + ( ( gain_Q16 & 0xFFFF ) * x ) >> 16, */
+/* where both products fit in 32 bits. VMOVN keeps the low 16 bits, like the cast.    */
+void silk_scale_copy_vector16_neon(
+    opus_int16                  *data_out,
+    const opus_int16            *data_in,
+    opus_int32                  gain_Q16,           /* I    Gain in Q16                                                 */
+    const opus_int              dataSize            /* I    Length                                                      */
+)
+{
+    opus_int   i;
+    opus_int32 tmp32, gain_hi, gain_lo;
+    int16x8_t  x;
+    int32x4_t  x_lo, x_hi;
+
+    gain_hi = silk_RSHIFT( gain_Q16, 16 );
+    gain_lo = gain_Q16 & 0x0000FFFF;
+    for( i = 0; i < dataSize - 7; i += 8 ) {
+        x = vld1q_s16( &data_in[ i ] );
+        x_lo = vmovl_s16( vget_low_s16( x ) );
+        x_hi = vmovl_s16( vget_high_s16( x ) );
+        x_lo = vaddq_s32( vmulq_n_s32( x_lo, gain_hi ), vshrq_n_s32( vmulq_n_s32( x_lo, gain_lo ), 16 ) );
+        x_hi = vaddq_s32( vmulq_n_s32( x_hi, gain_hi ), vshrq_n_s32( vmulq_n_s32( x_hi, gain_lo ), 16 ) );
+        vst1q_s16( &data_out[ i ], vcombine_s16( vmovn_s32( x_lo ), vmovn_s32( x_hi ) ) );
+    }
+    for( ; i < dataSize; i++ ) {
+        tmp32 = silk_SMULWB( gain_Q16, data_in[ i ] );
+        data_out[ i ] = (opus_int16)silk_CHECK_FIT16( tmp32 );
+    }
+}
@@ -36,7 +36,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "main_FIX.h"
 
 /* Calculates correlation vector X'*t */
-void silk_corrVector_FIX(
+void silk_corrVector_FIX_c(
     const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
     const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
     const opus_int                  L,                                      /* I    Length of vectors                                                           */
@@ -73,7 +73,7 @@ void silk_corrVector_FIX(
 }
 
 /* Calculates correlation matrix X'*X */
-void silk_corrMatrix_FIX(
+void silk_corrMatrix_FIX_c(
     const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
     const opus_int                  L,                                      /* I    Length of vectors                                                           */
     const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
@@ -98,7 +98,9 @@ opus_int silk_encode_frame_FIX(
     silk_nsq_state sNSQ_copy, sNSQ_copy2;
     opus_int32   seed_copy, nBits, nBits_lower, nBits_upper, gainMult_lower, gainMult_upper;
     opus_int32   gainsID, gainsID_lower, gainsID_upper;
-    opus_int16   gainMult_Q8;
+    opus_int16   gainMult_Q8, gainMult_prev_Q8;
+    opus_int32   nBits_prev;
+    opus_int     predict;
     opus_int16   ec_prevLagIndex_copy;
     opus_int     ec_prevSignalType_copy;
     opus_int8    LastGainIndex_copy2;
@@ -111,6 +113,8 @@ opus_int silk_encode_frame_FIX(
     LastGainIndex_copy2 = nBits_lower = nBits_upper = gainMult_lower = gainMult_upper = 0;
 
     psEnc->sCmn.indices.Seed = psEnc->sCmn.frameCounter++ & 3;
+    psEnc->sCmn.rateIterations = 0;
+    psEnc->sCmn.rateUnusedBits = 0;
 
     /**************************************************************/
     /* Set up Input Pointers, and insert frame in input buffer   */
@@ -169,6 +173,21 @@ opus_int silk_encode_frame_FIX(
         gainMult_Q8 = SILK_FIX_CONST( 1, 8 );
         found_lower = 0;
         found_upper = 0;
+        predict = useCBR && psEnc->sCmn.useGainPrediction;
+        gainMult_prev_Q8 = 0;
+        nBits_prev = -1;
+        if( predict ) {
+            /* Start from the gain multiplier that earlier frames of this signal type ended up with */
+            gainMult_Q8 = silk_gain_mult_predict( &psEnc->sCmn );
+            if( gainMult_Q8 != SILK_FIX_CONST( 1, 8 ) ) {
+                for( i = 0; i < psEnc->sCmn.nb_subfr; i++ ) {
+                    sEncCtrl.Gains_Q16[ i ] = silk_LSHIFT_SAT32( silk_SMULWB( sEncCtrl.GainsUnq_Q16[ i ], gainMult_Q8 ), 8 );
+                }
+                psEnc->sShape.LastGainIndex = sEncCtrl.lastGainIndexPrev;
+                silk_gains_quant( psEnc->sCmn.indices.GainsIndices, sEncCtrl.Gains_Q16,
+                      &psEnc->sShape.LastGainIndex, condCoding == CODE_CONDITIONALLY, psEnc->sCmn.nb_subfr );
+            }
+        }
         gainsID = silk_gains_ID( psEnc->sCmn.indices.GainsIndices, psEnc->sCmn.nb_subfr );
         gainsID_lower = -1;
         gainsID_upper = -1;
@@ -197,6 +216,7 @@ opus_int silk_encode_frame_FIX(
                 /*****************************************/
                 /* Noise shaping quantization            */
                 /*****************************************/
+                psEnc->sCmn.rateIterations++;
                 if( psEnc->sCmn.nStatesDelayedDecision > 1 || psEnc->sCmn.warping_Q16 > 0 ) {
                     silk_NSQ_del_dec( &psEnc->sCmn, &psEnc->sCmn.sNSQ, &psEnc->sCmn.indices, x_frame, psEnc->sCmn.pulses,
                            sEncCtrl.PredCoef_Q12[ 0 ], sEncCtrl.LTPCoef_Q14, sEncCtrl.AR_Q13, sEncCtrl.HarmShapeGain_Q14,
@@ -226,6 +246,14 @@ opus_int silk_encode_frame_FIX(
 
                 nBits = ec_tell( psRangeEnc );
 
+                if( predict ) {
+                    if( nBits_prev >= 0 ) {
+                        silk_gain_mult_learn( &psEnc->sCmn, gainMult_prev_Q8, nBits_prev, gainMult_Q8, nBits );
+                    }
+                    gainMult_prev_Q8 = gainMult_Q8;
+                    nBits_prev = nBits;
+                }
+
                 /* If we still bust after the last iteration, do some damage control. */
                 if ( iter == maxIter && !found_lower && nBits > maxBits ) {
                     silk_memcpy( psRangeEnc, &sRangeEnc_copy2, sizeof( ec_enc ) );
@@ -266,6 +294,7 @@ opus_int silk_encode_frame_FIX(
                     silk_memcpy( psRangeEnc->buf, ec_buf_copy, sRangeEnc_copy2.offs );
                     silk_memcpy( &psEnc->sCmn.sNSQ, &sNSQ_copy2, sizeof( silk_nsq_state ) );
                     psEnc->sShape.LastGainIndex = LastGainIndex_copy2;
+                    gainMult_Q8 = gainMult_lower;
                 }
                 break;
             }
@@ -276,6 +305,8 @@ opus_int silk_encode_frame_FIX(
                     sEncCtrl.Lambda_Q10 = silk_ADD_RSHIFT32( sEncCtrl.Lambda_Q10, sEncCtrl.Lambda_Q10, 1 );
                     found_upper = 0;
                     gainsID_upper = -1;
+                    /* The rate/gain curve changed with lambda */
+                    nBits_prev = -1;
                 } else {
                     found_upper = 1;
                     nBits_upper = nBits;
@@ -317,7 +348,10 @@ opus_int silk_encode_frame_FIX(
             }
             if( ( found_lower & found_upper ) == 0 ) {
                 /* Adjust gain according to high-rate rate/distortion curve */
-                if( nBits > maxBits ) {
+                if( predict ) {
+                    /* ... or rather the slope measured on earlier frames */
+                    gainMult_Q8 = silk_gain_mult_step( &psEnc->sCmn, gainMult_Q8, nBits, maxBits );
+                } else if( nBits > maxBits ) {
                     if (gainMult_Q8 < 16384) {
                         gainMult_Q8 *= 2;
                     } else {
@@ -359,6 +393,11 @@ opus_int silk_encode_frame_FIX(
             /* Unique identifier of gains vector */
             gainsID = silk_gains_ID( psEnc->sCmn.indices.GainsIndices, psEnc->sCmn.nb_subfr );
         }
+
+        if( predict ) {
+            silk_gain_mult_update( &psEnc->sCmn, gainMult_Q8 );
+        }
+        psEnc->sCmn.rateUnusedBits = silk_max_int( maxBits - ec_tell( psRangeEnc ), 0 );
     }
 
     /* Update input buffer */
@@ -41,6 +41,14 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "fixed/arm/warped_autocorrelation_FIX_arm.h"
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+#include "fixed/x86/LTP_analysis_FIX_x86.h"
+#endif
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+#include "fixed/arm/LTP_analysis_FIX_arm.h"
+#endif
+
 #ifndef FORCE_CPP_BUILD
 #ifdef __cplusplus
 extern "C"
@@ -169,7 +177,7 @@ void silk_find_LTP_FIX(
     int                             arch                                    /* I    Run-time architecture                                                       */
 );
 
-void silk_LTP_analysis_filter_FIX(
+void silk_LTP_analysis_filter_FIX_c(
     opus_int16                      *LTP_res,                               /* O    LTP residual signal of length MAX_NB_SUBFR * ( pre_length + subfr_length )  */
     const opus_int16                *x,                                     /* I    Pointer to input signal with at least max( pitchL ) preceding samples       */
     const opus_int16                LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],/* I    LTP_ORDER LTP coefficients for each MAX_NB_SUBFR subframe                   */
@@ -177,9 +185,15 @@ void silk_LTP_analysis_filter_FIX(
     const opus_int32                invGains_Q16[ MAX_NB_SUBFR ],           /* I    Inverse quantization gains, one for each subframe                           */
     const opus_int                  subfr_length,                           /* I    Length of each subframe                                                     */
     const opus_int                  nb_subfr,                               /* I    Number of subframes                                                         */
-    const opus_int                  pre_length                              /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    const opus_int                  pre_length,                             /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    int                             arch                                    /* I    Run-time architecture                                                       */
 );
 
+#if !defined(OVERRIDE_silk_LTP_analysis_filter_FIX)
+#define silk_LTP_analysis_filter_FIX(LTP_res, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch) \
+    silk_LTP_analysis_filter_FIX_c(LTP_res, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch)
+#endif
+
 /* Calculates residual energies of input subframes where all subframes have LPC_order   */
 /* of preceding samples                                                                 */
 void silk_residual_energy_FIX(
@@ -215,7 +229,7 @@ void silk_process_gains_FIX(
 /* Linear Algebra */
 /******************/
 /* Calculates correlation matrix X'*X */
-void silk_corrMatrix_FIX(
+void silk_corrMatrix_FIX_c(
     const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
     const opus_int                  L,                                      /* I    Length of vectors                                                           */
     const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
@@ -226,7 +240,7 @@ void silk_corrMatrix_FIX(
 );
 
 /* Calculates correlation vector X'*t */
-void silk_corrVector_FIX(
+void silk_corrVector_FIX_c(
     const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
     const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
     const opus_int                  L,                                      /* I    Length of vectors                                                           */
@@ -236,6 +250,16 @@ void silk_corrVector_FIX(
     int                             arch                                    /* I    Run-time architecture                                                       */
 );
 
+#if !defined(OVERRIDE_silk_corrMatrix_FIX)
+#define silk_corrMatrix_FIX(x, L, order, XX, nrg, rshifts, arch) \
+    silk_corrMatrix_FIX_c(x, L, order, XX, nrg, rshifts, arch)
+#endif
+
+#if !defined(OVERRIDE_silk_corrVector_FIX)
+#define silk_corrVector_FIX(x, t, L, order, Xt, rshifts, arch) \
+    silk_corrVector_FIX_c(x, t, L, order, Xt, rshifts, arch)
+#endif
+
 #ifndef FORCE_CPP_BUILD
 #ifdef __cplusplus
 }
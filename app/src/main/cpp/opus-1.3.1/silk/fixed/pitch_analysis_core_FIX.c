@@ -34,11 +34,12 @@ POSSIBILITY OF SUCH DAMAGE.
 ********************************************************** */
 #include "SigProc_FIX.h"
 #include "pitch_est_defines.h"
+#include "pitch_analysis_core_FIX.h"
 #include "stack_alloc.h"
 #include "debug.h"
 #include "pitch.h"
 
-#define SCRATCH_SIZE    22
+#define SCRATCH_SIZE    SILK_PE_ST3_MAX_LAGS
 #define SF_LENGTH_4KHZ  ( PE_SUBFR_LENGTH_MS * 4 )
 #define SF_LENGTH_8KHZ  ( PE_SUBFR_LENGTH_MS * 8 )
 #define MIN_LAG_4KHZ    ( PE_MIN_LAG_MS * 4 )
@@ -51,31 +52,6 @@ POSSIBILITY OF SUCH DAMAGE.
 #define D_COMP_MAX      ( MAX_LAG_8KHZ + 4 )
 #define D_COMP_STRIDE   ( D_COMP_MAX - D_COMP_MIN )
 
-typedef opus_int32 silk_pe_stage3_vals[ PE_NB_STAGE3_LAGS ];
-
-/************************************************************/
-/* Internally used functions                                */
-/************************************************************/
-static void silk_P_Ana_calc_corr_st3(
-    silk_pe_stage3_vals cross_corr_st3[],              /* O 3 DIM correlation array */
-    const opus_int16  frame[],                         /* I vector to correlate         */
-    opus_int          start_lag,                       /* I lag offset to search around */
-    opus_int          sf_length,                       /* I length of a 5 ms subframe   */
-    opus_int          nb_subfr,                        /* I number of subframes         */
-    opus_int          complexity,                      /* I Complexity setting          */
-    int               arch                             /* I Run-time architecture       */
-);
-
-static void silk_P_Ana_calc_energy_st3(
-    silk_pe_stage3_vals energies_st3[],                /* O 3 DIM energy array */
-    const opus_int16  frame[],                         /* I vector to calc energy in    */
-    opus_int          start_lag,                       /* I lag offset to search around */
-    opus_int          sf_length,                       /* I length of one 5 ms subframe */
-    opus_int          nb_subfr,                        /* I number of subframes         */
-    opus_int          complexity,                      /* I Complexity setting          */
-    int               arch                             /* I Run-time architecture       */
-);
-
 /*************************************************************/
 /*      FIXED POINT CORE PITCH ANALYSIS FUNCTION             */
 /*************************************************************/
@@ -103,7 +79,7 @@ opus_int silk_pitch_analysis_core(                  /* O    Voicing estimate: 0
     VARDECL( opus_int16, C );
     VARDECL( opus_int32, xcorr32 );
     const opus_int16 *target_ptr, *basis_ptr;
-    opus_int32 cross_corr, normalizer, energy, energy_basis, energy_target;
+    opus_int32 cross_corr, normalizer, energy, energy_target;
     opus_int   d_srch[ PE_D_SRCH_LENGTH ], Cmax, length_d_srch, length_d_comp, shift;
     VARDECL( opus_int16, d_comp );
     opus_int32 sum, threshold, lag_counter;
@@ -327,28 +303,10 @@ opus_int silk_pitch_analysis_core(                  /* O    Voicing estimate: 0
         /* Check that we are within range of the array */
         celt_assert( target_ptr >= frame_8kHz );
         celt_assert( target_ptr + SF_LENGTH_8KHZ <= frame_8kHz + frame_length_8kHz );
+        celt_assert( target_ptr - d_comp[ length_d_comp - 1 ] >= frame_8kHz );
 
-        energy_target = silk_ADD32( silk_inner_prod_aligned( target_ptr, target_ptr, SF_LENGTH_8KHZ, arch ), 1 );
-        for( j = 0; j < length_d_comp; j++ ) {
-            d = d_comp[ j ];
-            basis_ptr = target_ptr - d;
-
-            /* Check that we are within range of the array */
-            silk_assert( basis_ptr >= frame_8kHz );
-            silk_assert( basis_ptr + SF_LENGTH_8KHZ <= frame_8kHz + frame_length_8kHz );
-
-            cross_corr = silk_inner_prod_aligned( target_ptr, basis_ptr, SF_LENGTH_8KHZ, arch );
-            if( cross_corr > 0 ) {
-                energy_basis = silk_inner_prod_aligned( basis_ptr, basis_ptr, SF_LENGTH_8KHZ, arch );
-                matrix_ptr( C, k, d - ( MIN_LAG_8KHZ - 2 ), CSTRIDE_8KHZ ) =
-                    (opus_int16)silk_DIV32_varQ( cross_corr,
-                                                 silk_ADD32( energy_target,
-                                                             energy_basis ),
-                                                 13 + 1 );                                      /* Q13 */
-            } else {
-                matrix_ptr( C, k, d - ( MIN_LAG_8KHZ - 2 ), CSTRIDE_8KHZ ) = 0;
-            }
-        }
+        silk_P_Ana_calc_corr_st2( &matrix_ptr( C, k, 0, CSTRIDE_8KHZ ), target_ptr, d_comp, length_d_comp,
+                                  MIN_LAG_8KHZ - 2, SF_LENGTH_8KHZ, arch );
         target_ptr += SF_LENGTH_8KHZ;
     }
 
@@ -556,6 +514,41 @@ opus_int silk_pitch_analysis_core(                  /* O    Voicing estimate: 0
     return 0;
 }
 
+/*****************************************************************/
+/* Normalized correlations of one subframe for the stage 2 search */
+/*****************************************************************/
+void silk_P_Ana_calc_corr_st2_c(
+    opus_int16        C[],                              /* O    normalized correlations                 */
+    const opus_int16  target_ptr[],                     /* I    subframe, lags index back from here     */
+    const opus_int16  d_comp[],                         /* I    lags to evaluate                        */
+    opus_int          length_d_comp,                    /* I    number of lags                          */
+    opus_int          C_offset,                         /* I    lag stored at C[ 0 ]                    */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    int               arch                              /* I    Run-time architecture                   */
+)
+{
+    const opus_int16 *basis_ptr;
+    opus_int32 cross_corr, energy_target, energy_basis;
+    opus_int   j, d;
+
+    energy_target = silk_ADD32( silk_inner_prod_aligned( target_ptr, target_ptr, sf_length, arch ), 1 );
+    for( j = 0; j < length_d_comp; j++ ) {
+        d = d_comp[ j ];
+        basis_ptr = target_ptr - d;
+
+        cross_corr = silk_inner_prod_aligned( target_ptr, basis_ptr, sf_length, arch );
+        if( cross_corr > 0 ) {
+            energy_basis = silk_inner_prod_aligned( basis_ptr, basis_ptr, sf_length, arch );
+            C[ d - C_offset ] = (opus_int16)silk_DIV32_varQ( cross_corr,
+                                                             silk_ADD32( energy_target,
+                                                                         energy_basis ),
+                                                             13 + 1 );                          /* Q13 */
+        } else {
+            C[ d - C_offset ] = 0;
+        }
+    }
+}
+
 /***********************************************************************
  * Calculates the correlations used in stage 3 search. In order to cover
  * the whole lag codebook for all the searched offset lags (lag +- 2),
@@ -569,7 +562,7 @@ opus_int silk_pitch_analysis_core(                  /* O    Voicing estimate: 0
  * In total 48 correlations. The direct implementation computed in worst
  * case 4*12*5 = 240 correlations, but more likely around 120.
  ***********************************************************************/
-static void silk_P_Ana_calc_corr_st3(
+void silk_P_Ana_calc_corr_st3_c(
     silk_pe_stage3_vals cross_corr_st3[],              /* O 3 DIM correlation array */
     const opus_int16  frame[],                         /* I vector to correlate         */
     opus_int          start_lag,                       /* I lag offset to search around */
@@ -580,28 +573,14 @@ static void silk_P_Ana_calc_corr_st3(
 )
 {
     const opus_int16 *target_ptr;
-    opus_int   i, j, k, lag_counter, lag_low, lag_high;
-    opus_int   nb_cbk_search, delta, idx, cbk_size;
+    opus_int   j, k, lag_counter, lag_low, lag_high;
+    opus_int   nb_cbk_search, cbk_size;
     VARDECL( opus_int32, scratch_mem );
     VARDECL( opus_int32, xcorr32 );
     const opus_int8 *Lag_range_ptr, *Lag_CB_ptr;
     SAVE_STACK;
 
-    celt_assert( complexity >= SILK_PE_MIN_COMPLEX );
-    celt_assert( complexity <= SILK_PE_MAX_COMPLEX );
-
-    if( nb_subfr == PE_MAX_NB_SUBFR ) {
-        Lag_range_ptr = &silk_Lag_range_stage3[ complexity ][ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3[ 0 ][ 0 ];
-        nb_cbk_search = silk_nb_cbk_searchs_stage3[ complexity ];
-        cbk_size      = PE_NB_CBKS_STAGE3_MAX;
-    } else {
-        celt_assert( nb_subfr == PE_MAX_NB_SUBFR >> 1);
-        Lag_range_ptr = &silk_Lag_range_stage3_10_ms[ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3_10_ms[ 0 ][ 0 ];
-        nb_cbk_search = PE_NB_CBKS_STAGE3_10MS;
-        cbk_size      = PE_NB_CBKS_STAGE3_10MS;
-    }
+    silk_P_Ana_stage3_codebook( nb_subfr, complexity, &Lag_range_ptr, &Lag_CB_ptr, &nb_cbk_search, &cbk_size );
     ALLOC( scratch_mem, SCRATCH_SIZE, opus_int32 );
     ALLOC( xcorr32, SCRATCH_SIZE, opus_int32 );
 
@@ -620,18 +599,8 @@ static void silk_P_Ana_calc_corr_st3(
             lag_counter++;
         }
 
-        delta = matrix_ptr( Lag_range_ptr, k, 0, 2 );
-        for( i = 0; i < nb_cbk_search; i++ ) {
-            /* Fill out the 3 dim array that stores the correlations for */
-            /* each code_book vector for each start lag */
-            idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - delta;
-            for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
-                silk_assert( idx + j < SCRATCH_SIZE );
-                silk_assert( idx + j < lag_counter );
-                matrix_ptr( cross_corr_st3, k, i, nb_cbk_search )[ j ] =
-                    scratch_mem[ idx + j ];
-            }
-        }
+        silk_P_Ana_scatter_st3( cross_corr_st3, scratch_mem, lag_counter, Lag_range_ptr, Lag_CB_ptr,
+                                k, nb_cbk_search, cbk_size );
         target_ptr += sf_length;
     }
     RESTORE_STACK;
@@ -641,7 +610,7 @@ static void silk_P_Ana_calc_corr_st3(
 /* Calculate the energies for first two subframes. The energies are */
 /* calculated recursively.                                          */
 /********************************************************************/
-static void silk_P_Ana_calc_energy_st3(
+void silk_P_Ana_calc_energy_st3_c(
     silk_pe_stage3_vals energies_st3[],                 /* O 3 DIM energy array */
     const opus_int16  frame[],                          /* I vector to calc energy in    */
     opus_int          start_lag,                        /* I lag offset to search around */
@@ -653,27 +622,13 @@ static void silk_P_Ana_calc_energy_st3(
 {
     const opus_int16 *target_ptr, *basis_ptr;
     opus_int32 energy;
-    opus_int   k, i, j, lag_counter;
-    opus_int   nb_cbk_search, delta, idx, cbk_size, lag_diff;
+    opus_int   k, i, lag_counter;
+    opus_int   nb_cbk_search, cbk_size, lag_diff;
     VARDECL( opus_int32, scratch_mem );
     const opus_int8 *Lag_range_ptr, *Lag_CB_ptr;
     SAVE_STACK;
 
-    celt_assert( complexity >= SILK_PE_MIN_COMPLEX );
-    celt_assert( complexity <= SILK_PE_MAX_COMPLEX );
-
-    if( nb_subfr == PE_MAX_NB_SUBFR ) {
-        Lag_range_ptr = &silk_Lag_range_stage3[ complexity ][ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3[ 0 ][ 0 ];
-        nb_cbk_search = silk_nb_cbk_searchs_stage3[ complexity ];
-        cbk_size      = PE_NB_CBKS_STAGE3_MAX;
-    } else {
-        celt_assert( nb_subfr == PE_MAX_NB_SUBFR >> 1);
-        Lag_range_ptr = &silk_Lag_range_stage3_10_ms[ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3_10_ms[ 0 ][ 0 ];
-        nb_cbk_search = PE_NB_CBKS_STAGE3_10MS;
-        cbk_size      = PE_NB_CBKS_STAGE3_10MS;
-    }
+    silk_P_Ana_stage3_codebook( nb_subfr, complexity, &Lag_range_ptr, &Lag_CB_ptr, &nb_cbk_search, &cbk_size );
     ALLOC( scratch_mem, SCRATCH_SIZE, opus_int32 );
 
     target_ptr = &frame[ silk_LSHIFT( sf_length, 2 ) ];
@@ -701,20 +656,8 @@ static void silk_P_Ana_calc_energy_st3(
             lag_counter++;
         }
 
-        delta = matrix_ptr( Lag_range_ptr, k, 0, 2 );
-        for( i = 0; i < nb_cbk_search; i++ ) {
-            /* Fill out the 3 dim array that stores the correlations for    */
-            /* each code_book vector for each start lag                     */
-            idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - delta;
-            for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
-                silk_assert( idx + j < SCRATCH_SIZE );
-                silk_assert( idx + j < lag_counter );
-                matrix_ptr( energies_st3, k, i, nb_cbk_search )[ j ] =
-                    scratch_mem[ idx + j ];
-                silk_assert(
-                    matrix_ptr( energies_st3, k, i, nb_cbk_search )[ j ] >= 0 );
-            }
-        }
+        silk_P_Ana_scatter_st3( energies_st3, scratch_mem, lag_counter, Lag_range_ptr, Lag_CB_ptr,
+                                k, nb_cbk_search, cbk_size );
         target_ptr += sf_length;
     }
     RESTORE_STACK;
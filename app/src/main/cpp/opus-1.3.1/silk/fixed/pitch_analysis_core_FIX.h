@@ -0,0 +1,158 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifndef SILK_PITCH_ANALYSIS_CORE_FIX_H
+#define SILK_PITCH_ANALYSIS_CORE_FIX_H
+
+#include "SigProc_FIX.h"
+#include "pitch_est_defines.h"
+
+/* Upper bound on the number of lags of one subframe in the stage 3 search */
+#define SILK_PE_ST3_MAX_LAGS    22
+
+typedef opus_int32 silk_pe_stage3_vals[ PE_NB_STAGE3_LAGS ];
+
+#if defined(FIXED_POINT) && defined(OPUS_X86_MAY_HAVE_AVX2)
+#include "fixed/x86/pitch_analysis_core_FIX_x86.h"
+#endif
+
+#if defined(FIXED_POINT) && defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+#include "fixed/arm/pitch_analysis_core_FIX_arm.h"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Normalized correlations (Q13) of one 8 kHz subframe with its history, for */
+/* the lags in d_comp. Results are stored in C[ d - C_offset ].             */
+void silk_P_Ana_calc_corr_st2_c(
+    opus_int16        C[],                              /* O    normalized correlations                 */
+    const opus_int16  target_ptr[],                     /* I    subframe, lags index back from here     */
+    const opus_int16  d_comp[],                         /* I    lags to evaluate                        */
+    opus_int          length_d_comp,                    /* I    number of lags                          */
+    opus_int          C_offset,                         /* I    lag stored at C[ 0 ]                    */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    int               arch                              /* I    Run-time architecture                   */
+);
+
+/* Correlations for the stage 3 search, see pitch_analysis_core_FIX.c */
+void silk_P_Ana_calc_corr_st3_c(
+    silk_pe_stage3_vals cross_corr_st3[],               /* O    3 DIM correlation array                 */
+    const opus_int16  frame[],                          /* I    vector to correlate                     */
+    opus_int          start_lag,                        /* I    lag offset to search around             */
+    opus_int          sf_length,                        /* I    length of a 5 ms subframe               */
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    int               arch                              /* I    Run-time architecture                   */
+);
+
+/* Energies for the stage 3 search, see pitch_analysis_core_FIX.c */
+void silk_P_Ana_calc_energy_st3_c(
+    silk_pe_stage3_vals energies_st3[],                 /* O    3 DIM energy array                      */
+    const opus_int16  frame[],                          /* I    vector to calc energy in                */
+    opus_int          start_lag,                        /* I    lag offset to search around             */
+    opus_int          sf_length,                        /* I    length of one 5 ms subframe             */
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    int               arch                              /* I    Run-time architecture                   */
+);
+
+#if !defined(OVERRIDE_silk_P_Ana_calc_corr_st2)
+#define silk_P_Ana_calc_corr_st2(C, target_ptr, d_comp, length_d_comp, C_offset, sf_length, arch) \
+    silk_P_Ana_calc_corr_st2_c(C, target_ptr, d_comp, length_d_comp, C_offset, sf_length, arch)
+#endif
+
+#if !defined(OVERRIDE_silk_P_Ana_calc_corr_st3)
+#define silk_P_Ana_calc_corr_st3(cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch) \
+    silk_P_Ana_calc_corr_st3_c(cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch)
+#endif
+
+#if !defined(OVERRIDE_silk_P_Ana_calc_energy_st3)
+#define silk_P_Ana_calc_energy_st3(energies_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch) \
+    silk_P_Ana_calc_energy_st3_c(energies_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch)
+#endif
+
+/* Lag range and codebook used by the stage 3 search */
+static OPUS_INLINE void silk_P_Ana_stage3_codebook(
+    opus_int          nb_subfr,                         /* I    number of subframes                     */
+    opus_int          complexity,                       /* I    Complexity setting                      */
+    const opus_int8   **Lag_range_ptr,                  /* O    [ nb_subfr ][ 2 ] lag ranges            */
+    const opus_int8   **Lag_CB_ptr,                     /* O    [ nb_subfr ][ cbk_size ] codebook       */
+    opus_int          *nb_cbk_search,                   /* O    number of codebook vectors to search    */
+    opus_int          *cbk_size                         /* O    codebook stride                         */
+)
+{
+    celt_assert( complexity >= SILK_PE_MIN_COMPLEX );
+    celt_assert( complexity <= SILK_PE_MAX_COMPLEX );
+
+    if( nb_subfr == PE_MAX_NB_SUBFR ) {
+        *Lag_range_ptr = &silk_Lag_range_stage3[ complexity ][ 0 ][ 0 ];
+        *Lag_CB_ptr    = &silk_CB_lags_stage3[ 0 ][ 0 ];
+        *nb_cbk_search = silk_nb_cbk_searchs_stage3[ complexity ];
+        *cbk_size      = PE_NB_CBKS_STAGE3_MAX;
+    } else {
+        celt_assert( nb_subfr == PE_MAX_NB_SUBFR >> 1);
+        *Lag_range_ptr = &silk_Lag_range_stage3_10_ms[ 0 ][ 0 ];
+        *Lag_CB_ptr    = &silk_CB_lags_stage3_10_ms[ 0 ][ 0 ];
+        *nb_cbk_search = PE_NB_CBKS_STAGE3_10MS;
+        *cbk_size      = PE_NB_CBKS_STAGE3_10MS;
+    }
+}
+
+/* Fills out the 3 dim array that stores the values of subframe k */
+/* for each code_book vector for each start lag                   */
+static OPUS_INLINE void silk_P_Ana_scatter_st3(
+    silk_pe_stage3_vals out[],                          /* O    3 DIM array                             */
+    const opus_int32  scratch_mem[],                    /* I    values for lags lag_low...lag_high      */
+    opus_int          lag_counter,                      /* I    number of values in scratch_mem         */
+    const opus_int8   *Lag_range_ptr,                   /* I    lag ranges                              */
+    const opus_int8   *Lag_CB_ptr,                      /* I    codebook                                */
+    opus_int          k,                                /* I    subframe                                */
+    opus_int          nb_cbk_search,                    /* I    number of codebook vectors to search    */
+    opus_int          cbk_size                          /* I    codebook stride                         */
+)
+{
+    opus_int i, j, idx, delta;
+
+    delta = matrix_ptr( Lag_range_ptr, k, 0, 2 );
+    for( i = 0; i < nb_cbk_search; i++ ) {
+        idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - delta;
+        for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
+            silk_assert( idx + j < lag_counter );
+            matrix_ptr( out, k, i, nb_cbk_search )[ j ] = scratch_mem[ idx + j ];
+        }
+    }
+    (void)lag_counter;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SILK_PITCH_ANALYSIS_CORE_FIX_H */
@@ -106,6 +106,7 @@ typedef struct {
     opus_int                    timeSinceSwitchAllowed_ms;
     opus_int                    allowBandwidthSwitch;
     opus_int                    prev_decode_only_middle;
+    silk_RateControlStats       rateStats;
 } silk_encoder;
 
 
@@ -33,7 +33,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "pitch.h"
 
 /* Copy and multiply a vector by a constant */
-void silk_scale_copy_vector16(
+void silk_scale_copy_vector16_c(
     opus_int16                  *data_out,
     const opus_int16            *data_in,
     opus_int32                  gain_Q16,           /* I    Gain in Q16                                                 */
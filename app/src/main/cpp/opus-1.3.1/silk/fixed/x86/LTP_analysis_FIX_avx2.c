@@ -0,0 +1,292 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "main_FIX.h"
+
+/* Correlations are plain 32-bit sums of 16x16 products, each shifted     */
+/* right by rshifts first when rshifts > 0, and the LTP prediction wraps  */
+/* like silk_SMLABB_ovflw(), so summing in a different order gives        */
+/* bit-exact results. The O( order^2 ) recursions stay scalar.            */
+
+static OPUS_INLINE opus_int32 silk_hsum_avx2( __m256i acc, __m128i tail )
+{
+    __m128i sum;
+    sum = _mm_add_epi32( _mm_add_epi32( _mm256_castsi256_si128( acc ), _mm256_extracti128_si256( acc, 1 ) ), tail );
+    sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    return _mm_cvtsi128_si32( sum );
+}
+
+/* sum( a[ i ] * b[ i ] ) */
+static OPUS_INLINE opus_int32 silk_inner_prod_avx2(
+    const opus_int16 *a,
+    const opus_int16 *b,
+    opus_int          len
+)
+{
+    __m256i acc;
+    __m128i tail;
+    opus_int32 sum;
+    opus_int i;
+
+    acc = _mm256_setzero_si256();
+    for( i = 0; i < len - 15; i += 16 ) {
+        acc = _mm256_add_epi32( acc, _mm256_madd_epi16( _mm256_loadu_si256( (const __m256i *)&a[ i ] ),
+                                                        _mm256_loadu_si256( (const __m256i *)&b[ i ] ) ) );
+    }
+    tail = _mm_setzero_si128();
+    if( i < len - 7 ) {
+        tail = _mm_madd_epi16( _mm_loadu_si128( (const __m128i *)&a[ i ] ), _mm_loadu_si128( (const __m128i *)&b[ i ] ) );
+        i += 8;
+    }
+    sum = silk_hsum_avx2( acc, tail );
+    for( ; i < len; i++ ) {
+        sum = silk_MLA( sum, a[ i ], b[ i ] );
+    }
+    return sum;
+}
+
+/* sum( ( a[ i ] * b[ i ] ) >> rshifts ) */
+static OPUS_INLINE opus_int32 silk_inner_prod_rshift_avx2(
+    const opus_int16 *a,
+    const opus_int16 *b,
+    opus_int          len,
+    opus_int          rshifts
+)
+{
+    __m256i acc, av, bv, lo, hi;
+    __m128i tail, at, bt, lo4, hi4, shift;
+    opus_int32 sum;
+    opus_int i;
+
+    shift = _mm_cvtsi32_si128( rshifts );
+    acc = _mm256_setzero_si256();
+    for( i = 0; i < len - 15; i += 16 ) {
+        av = _mm256_loadu_si256( (const __m256i *)&a[ i ] );
+        bv = _mm256_loadu_si256( (const __m256i *)&b[ i ] );
+        lo = _mm256_mullo_epi16( av, bv );
+        hi = _mm256_mulhi_epi16( av, bv );
+        acc = _mm256_add_epi32( acc, _mm256_sra_epi32( _mm256_unpacklo_epi16( lo, hi ), shift ) );
+        acc = _mm256_add_epi32( acc, _mm256_sra_epi32( _mm256_unpackhi_epi16( lo, hi ), shift ) );
+    }
+    tail = _mm_setzero_si128();
+    if( i < len - 7 ) {
+        at = _mm_loadu_si128( (const __m128i *)&a[ i ] );
+        bt = _mm_loadu_si128( (const __m128i *)&b[ i ] );
+        lo4 = _mm_mullo_epi16( at, bt );
+        hi4 = _mm_mulhi_epi16( at, bt );
+        tail = _mm_add_epi32( _mm_sra_epi32( _mm_unpacklo_epi16( lo4, hi4 ), shift ),
+                              _mm_sra_epi32( _mm_unpackhi_epi16( lo4, hi4 ), shift ) );
+        i += 8;
+    }
+    sum = silk_hsum_avx2( acc, tail );
+    for( ; i < len; i++ ) {
+        sum = silk_ADD_RSHIFT32( sum, silk_SMULBB( a[ i ], b[ i ] ), rshifts );
+    }
+    return sum;
+}
+
+/* Calculates correlation vector X'*t */
+void silk_corrVector_FIX_avx2(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *Xt,                                    /* O    Pointer to X'*t correlation vector [order]                                  */
+    const opus_int                  rshifts,                                /* I    Right shifts of correlations                                                */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+)
+{
+    opus_int         lag;
+    const opus_int16 *ptr1;
+
+    (void)arch;
+    ptr1 = &x[ order - 1 ]; /* Points to first sample of column 0 of X: X[:,0] */
+    if( rshifts > 0 ) {
+        for( lag = 0; lag < order; lag++ ) {
+            Xt[ lag ] = silk_inner_prod_rshift_avx2( ptr1 - lag, t, L, rshifts ); /* X[:,lag]'*t */
+        }
+    } else {
+        silk_assert( rshifts == 0 );
+        for( lag = 0; lag < order; lag++ ) {
+            Xt[ lag ] = silk_inner_prod_avx2( ptr1 - lag, t, L ); /* X[:,lag]'*t */
+        }
+    }
+}
+
+/* Calculates correlation matrix X'*X */
+void silk_corrMatrix_FIX_avx2(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *XX,                                    /* O    Pointer to X'*X correlation matrix [ order x order ]                        */
+    opus_int32                      *nrg,                                   /* O    Energy of x vector                                                          */
+    opus_int                        *rshifts,                               /* O    Right shifts of correlations and energy                                     */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+)
+{
+    opus_int         i, j, lag;
+    opus_int32       energy;
+    const opus_int16 *ptr1, *ptr2;
+
+    (void)arch;
+
+    /* Calculate energy to find shift used to fit in 32 bits */
+    silk_sum_sqr_shift( nrg, rshifts, x, L + order - 1 );
+    energy = *nrg;
+
+    /* Calculate energy of first column (0) of X: X[:,0]'*X[:,0] */
+    /* Remove contribution of first order - 1 samples */
+    for( i = 0; i < order - 1; i++ ) {
+        energy -= silk_RSHIFT32( silk_SMULBB( x[ i ], x[ i ] ), *rshifts );
+    }
+
+    /* Calculate energy of remaining columns of X: X[:,j]'*X[:,j] */
+    /* Fill out the diagonal of the correlation matrix */
+    matrix_ptr( XX, 0, 0, order ) = energy;
+    silk_assert( energy >= 0 );
+    ptr1 = &x[ order - 1 ]; /* First sample of column 0 of X */
+    for( j = 1; j < order; j++ ) {
+        energy = silk_SUB32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ L - j ], ptr1[ L - j ] ), *rshifts ) );
+        energy = silk_ADD32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ -j ], ptr1[ -j ] ), *rshifts ) );
+        matrix_ptr( XX, j, j, order ) = energy;
+        silk_assert( energy >= 0 );
+    }
+
+    ptr2 = &x[ order - 2 ]; /* First sample of column 1 of X */
+    /* Calculate the remaining elements of the correlation matrix */
+    for( lag = 1; lag < order; lag++ ) {
+        /* Inner product of column 0 and column lag: X[:,0]'*X[:,lag] */
+        if( *rshifts > 0 ) {
+            energy = silk_inner_prod_rshift_avx2( ptr1, ptr2, L, *rshifts );
+        } else {
+            energy = silk_inner_prod_avx2( ptr1, ptr2, L );
+        }
+        matrix_ptr( XX, lag, 0, order ) = energy;
+        matrix_ptr( XX, 0, lag, order ) = energy;
+        /* Calculate remaining off diagonal: X[:,j]'*X[:,j + lag] */
+        for( j = 1; j < ( order - lag ); j++ ) {
+            energy = silk_SUB32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ L - j ], ptr2[ L - j ] ), *rshifts ) );
+            energy = silk_ADD32( energy, silk_RSHIFT32( silk_SMULBB( ptr1[ -j ], ptr2[ -j ] ), *rshifts ) );
+            matrix_ptr( XX, lag + j, j, order ) = energy;
+            matrix_ptr( XX, j, lag + j, order ) = energy;
+        }
+        ptr2--; /* Update pointer to first sample of next column (lag) in X */
+    }
+}
+
+void silk_LTP_analysis_filter_FIX_avx2(
+    opus_int16                      *LTP_res,                               /* O    LTP residual signal of length MAX_NB_SUBFR * ( pre_length + subfr_length )  */
+    const opus_int16                *x,                                     /* I    Pointer to input signal with at least max( pitchL ) preceding samples       */
+    const opus_int16                LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],/* I    LTP_ORDER LTP coefficients for each MAX_NB_SUBFR subframe                   */
+    const opus_int                  pitchL[ MAX_NB_SUBFR ],                 /* I    Pitch lag, one for each subframe                                            */
+    const opus_int32                invGains_Q16[ MAX_NB_SUBFR ],           /* I    Inverse quantization gains, one for each subframe                           */
+    const opus_int                  subfr_length,                           /* I    Length of each subframe                                                     */
+    const opus_int                  nb_subfr,                               /* I    Number of subframes                                                         */
+    const opus_int                  pre_length,                             /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+)
+{
+    const opus_int16 *x_ptr, *x_lag_ptr, *B_Q14;
+    opus_int16   *LTP_res_ptr;
+    opus_int     k, i, len;
+    opus_int32   LTP_est;
+    __m256i      B01, B23, B4, gain_hi, gain_lo, gain_lo_neg, zero, one;
+    __m256i      xv, p2, p1, p0, m1, m2, est_lo, est_hi, res;
+
+    (void)arch;
+    zero = _mm256_setzero_si256();
+    one = _mm256_set1_epi32( 1 );
+    len = subfr_length + pre_length;
+    x_ptr = x;
+    LTP_res_ptr = LTP_res;
+    for( k = 0; k < nb_subfr; k++ ) {
+
+        x_lag_ptr = x_ptr - pitchL[ k ];
+        B_Q14 = &LTPCoef_Q14[ k * LTP_ORDER ];
+
+        /* Taps paired up for _mm256_madd_epi16(): ( x_lag[ 2 ], x_lag[ 1 ] ), ( x_lag[ 0 ], x_lag[ -1 ] ), ( x_lag[ -2 ], 0 ) */
+        B01 = _mm256_set1_epi32( (opus_int32)( (opus_uint16)B_Q14[ 0 ] | ( (opus_uint32)(opus_uint16)B_Q14[ 1 ] << 16 ) ) );
+        B23 = _mm256_set1_epi32( (opus_int32)( (opus_uint16)B_Q14[ 2 ] | ( (opus_uint32)(opus_uint16)B_Q14[ 3 ] << 16 ) ) );
+        B4 = _mm256_set1_epi32( (opus_uint16)B_Q14[ 4 ] );
+
+        /* silk_SMULWB() modulo 2^16, with the gain split into signed 16-bit halves */
+        gain_hi = _mm256_set1_epi16( (opus_int16)( invGains_Q16[ k ] >> 16 ) );
+        gain_lo = _mm256_set1_epi16( (opus_int16)invGains_Q16[ k ] );
+        gain_lo_neg = _mm256_cmpgt_epi16( zero, gain_lo );
+
+        for( i = 0; i < len - 15; i += 16 ) {
+            p2 = _mm256_loadu_si256( (const __m256i *)&x_lag_ptr[ i + 2 ] );
+            p1 = _mm256_loadu_si256( (const __m256i *)&x_lag_ptr[ i + 1 ] );
+            p0 = _mm256_loadu_si256( (const __m256i *)&x_lag_ptr[ i ] );
+            m1 = _mm256_loadu_si256( (const __m256i *)&x_lag_ptr[ i - 1 ] );
+            m2 = _mm256_loadu_si256( (const __m256i *)&x_lag_ptr[ i - 2 ] );
+
+            /* Long-term prediction */
+            est_lo = _mm256_madd_epi16( _mm256_unpacklo_epi16( p2, p1 ), B01 );
+            est_lo = _mm256_add_epi32( est_lo, _mm256_madd_epi16( _mm256_unpacklo_epi16( p0, m1 ), B23 ) );
+            est_lo = _mm256_add_epi32( est_lo, _mm256_madd_epi16( _mm256_unpacklo_epi16( m2, zero ), B4 ) );
+            est_hi = _mm256_madd_epi16( _mm256_unpackhi_epi16( p2, p1 ), B01 );
+            est_hi = _mm256_add_epi32( est_hi, _mm256_madd_epi16( _mm256_unpackhi_epi16( p0, m1 ), B23 ) );
+            est_hi = _mm256_add_epi32( est_hi, _mm256_madd_epi16( _mm256_unpackhi_epi16( m2, zero ), B4 ) );
+
+            /* silk_RSHIFT_ROUND( LTP_est, 14 ) */
+            est_lo = _mm256_srai_epi32( _mm256_add_epi32( _mm256_srai_epi32( est_lo, 13 ), one ), 1 );
+            est_hi = _mm256_srai_epi32( _mm256_add_epi32( _mm256_srai_epi32( est_hi, 13 ), one ), 1 );
+
+            /* Subtract long-term prediction, in the same lane order as the unpacks above */
+            xv = _mm256_loadu_si256( (const __m256i *)&x_ptr[ i ] );
+            est_lo = _mm256_sub_epi32( _mm256_srai_epi32( _mm256_unpacklo_epi16( xv, xv ), 16 ), est_lo );
+            est_hi = _mm256_sub_epi32( _mm256_srai_epi32( _mm256_unpackhi_epi16( xv, xv ), 16 ), est_hi );
+            res = _mm256_packs_epi32( est_lo, est_hi );
+
+            /* Scale residual */
+            res = _mm256_add_epi16( _mm256_mullo_epi16( res, gain_hi ),
+                  _mm256_add_epi16( _mm256_mulhi_epi16( res, gain_lo ), _mm256_and_si256( res, gain_lo_neg ) ) );
+            _mm256_storeu_si256( (__m256i *)&LTP_res_ptr[ i ], res );
+        }
+        for( ; i < len; i++ ) {
+            LTP_est = silk_SMULBB( x_lag_ptr[ i + LTP_ORDER / 2 ], B_Q14[ 0 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i + 1 ], B_Q14[ 1 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i ], B_Q14[ 2 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i - 1 ], B_Q14[ 3 ] );
+            LTP_est = silk_SMLABB_ovflw( LTP_est, x_lag_ptr[ i - 2 ], B_Q14[ 4 ] );
+            LTP_est = silk_RSHIFT_ROUND( LTP_est, 14 );
+            LTP_res_ptr[ i ] = (opus_int16)silk_SAT16( (opus_int32)x_ptr[ i ] - LTP_est );
+            LTP_res_ptr[ i ] = silk_SMULWB( invGains_Q16[ k ], LTP_res_ptr[ i ] );
+        }
+
+        /* Update pointers */
+        LTP_res_ptr += len;
+        x_ptr       += subfr_length;
+    }
+}
@@ -86,3 +86,32 @@ opus_int64 silk_inner_prod16_aligned_64_sse4_1(
 
     return sum;
 }
+
+/* Only the low 16 bits of silk_SMULWB( gain_Q16, x ) are kept, so it is computed */
+/* modulo 2^16 as ( gain_Q16 >> 16 ) * x plus the high half of the unsigned      */
+/* product of the low gain bits and x, corrected for a negative x.                */
+void silk_scale_copy_vector16_sse4_1(
+    opus_int16                  *data_out,
+    const opus_int16            *data_in,
+    opus_int32                  gain_Q16,           /* I    Gain in Q16                                                 */
+    const opus_int              dataSize            /* I    Length                                                      */
+)
+{
+    opus_int  i;
+    opus_int32 tmp32;
+    __m128i xmm_in, xmm_gain_hi, xmm_gain_lo, xmm_frac;
+
+    xmm_gain_hi = _mm_set1_epi16( (opus_int16)silk_RSHIFT( gain_Q16, 16 ) );
+    xmm_gain_lo = _mm_set1_epi16( (opus_int16)( gain_Q16 & 0x0000FFFF ) );
+    for( i = 0; i < dataSize - 7; i += 8 ) {
+        xmm_in = _mm_loadu_si128( (const __m128i *)&data_in[ i ] );
+        xmm_frac = _mm_sub_epi16( _mm_mulhi_epu16( xmm_in, xmm_gain_lo ),
+                                  _mm_and_si128( _mm_srai_epi16( xmm_in, 15 ), xmm_gain_lo ) );
+        _mm_storeu_si128( (__m128i *)&data_out[ i ],
+                          _mm_add_epi16( _mm_mullo_epi16( xmm_in, xmm_gain_hi ), xmm_frac ) );
+    }
+    for( ; i < dataSize; i++ ) {
+        tmp32 = silk_SMULWB( gain_Q16, data_in[ i ] );
+        data_out[ i ] = (opus_int16)silk_CHECK_FIT16( tmp32 );
+    }
+}
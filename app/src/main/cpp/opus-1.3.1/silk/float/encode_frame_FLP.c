@@ -98,7 +98,9 @@ opus_int silk_encode_frame_FLP(
     silk_nsq_state sNSQ_copy, sNSQ_copy2;
     opus_int32   seed_copy, nBits, nBits_lower, nBits_upper, gainMult_lower, gainMult_upper;
     opus_int32   gainsID, gainsID_lower, gainsID_upper;
-    opus_int16   gainMult_Q8;
+    opus_int16   gainMult_Q8, gainMult_prev_Q8;
+    opus_int32   nBits_prev;
+    opus_int     predict;
     opus_int16   ec_prevLagIndex_copy;
     opus_int     ec_prevSignalType_copy;
     opus_int8    LastGainIndex_copy2;
@@ -112,6 +114,8 @@ opus_int silk_encode_frame_FLP(
     LastGainIndex_copy2 = nBits_lower = nBits_upper = gainMult_lower = gainMult_upper = 0;
 
     psEnc->sCmn.indices.Seed = psEnc->sCmn.frameCounter++ & 3;
+    psEnc->sCmn.rateIterations = 0;
+    psEnc->sCmn.rateUnusedBits = 0;
 
     /**************************************************************/
     /* Set up Input Pointers, and insert frame in input buffer    */
@@ -166,6 +170,24 @@ opus_int silk_encode_frame_FLP(
         gainMult_Q8 = SILK_FIX_CONST( 1, 8 );
         found_lower = 0;
         found_upper = 0;
+        predict = useCBR && psEnc->sCmn.useGainPrediction;
+        gainMult_prev_Q8 = 0;
+        nBits_prev = -1;
+        if( predict ) {
+            /* Start from the gain multiplier that earlier frames of this signal type ended up with */
+            gainMult_Q8 = silk_gain_mult_predict( &psEnc->sCmn );
+            if( gainMult_Q8 != SILK_FIX_CONST( 1, 8 ) ) {
+                for( i = 0; i < psEnc->sCmn.nb_subfr; i++ ) {
+                    pGains_Q16[ i ] = silk_LSHIFT_SAT32( silk_SMULWB( sEncCtrl.GainsUnq_Q16[ i ], gainMult_Q8 ), 8 );
+                }
+                psEnc->sShape.LastGainIndex = sEncCtrl.lastGainIndexPrev;
+                silk_gains_quant( psEnc->sCmn.indices.GainsIndices, pGains_Q16,
+                      &psEnc->sShape.LastGainIndex, condCoding == CODE_CONDITIONALLY, psEnc->sCmn.nb_subfr );
+                for( i = 0; i < psEnc->sCmn.nb_subfr; i++ ) {
+                    sEncCtrl.Gains[ i ] = pGains_Q16[ i ] / 65536.0f;
+                }
+            }
+        }
         gainsID = silk_gains_ID( psEnc->sCmn.indices.GainsIndices, psEnc->sCmn.nb_subfr );
         gainsID_lower = -1;
         gainsID_upper = -1;
@@ -193,6 +215,7 @@ opus_int silk_encode_frame_FLP(
                 /*****************************************/
                 /* Noise shaping quantization            */
                 /*****************************************/
+                psEnc->sCmn.rateIterations++;
                 silk_NSQ_wrapper_FLP( psEnc, &sEncCtrl, &psEnc->sCmn.indices, &psEnc->sCmn.sNSQ, psEnc->sCmn.pulses, x_frame );
 
                 if ( iter == maxIter && !found_lower ) {
@@ -212,6 +235,14 @@ opus_int silk_encode_frame_FLP(
 
                 nBits = ec_tell( psRangeEnc );
 
+                if( predict ) {
+                    if( nBits_prev >= 0 ) {
+                        silk_gain_mult_learn( &psEnc->sCmn, gainMult_prev_Q8, nBits_prev, gainMult_Q8, nBits );
+                    }
+                    gainMult_prev_Q8 = gainMult_Q8;
+                    nBits_prev = nBits;
+                }
+
                 /* If we still bust after the last iteration, do some damage control. */
                 if ( iter == maxIter && !found_lower && nBits > maxBits ) {
                     silk_memcpy( psRangeEnc, &sRangeEnc_copy2, sizeof( ec_enc ) );
@@ -252,6 +283,7 @@ opus_int silk_encode_frame_FLP(
                     silk_memcpy( psRangeEnc->buf, ec_buf_copy, sRangeEnc_copy2.offs );
                     silk_memcpy( &psEnc->sCmn.sNSQ, &sNSQ_copy2, sizeof( silk_nsq_state ) );
                     psEnc->sShape.LastGainIndex = LastGainIndex_copy2;
+                    gainMult_Q8 = gainMult_lower;
                 }
                 break;
             }
@@ -264,6 +296,8 @@ opus_int silk_encode_frame_FLP(
                     psEnc->sCmn.indices.quantOffsetType = 0;
                     found_upper = 0;
                     gainsID_upper = -1;
+                    /* The rate/gain curve changed with lambda */
+                    nBits_prev = -1;
                 } else {
                     found_upper = 1;
                     nBits_upper = nBits;
@@ -305,7 +339,10 @@ opus_int silk_encode_frame_FLP(
             }
             if( ( found_lower & found_upper ) == 0 ) {
                 /* Adjust gain according to high-rate rate/distortion curve */
-                if( nBits > maxBits ) {
+                if( predict ) {
+                    /* ... or rather the slope measured on earlier frames */
+                    gainMult_Q8 = silk_gain_mult_step( &psEnc->sCmn, gainMult_Q8, nBits, maxBits );
+                } else if( nBits > maxBits ) {
                     if (gainMult_Q8 < 16384) {
                         gainMult_Q8 *= 2;
                     } else {
@@ -351,6 +388,11 @@ opus_int silk_encode_frame_FLP(
                 sEncCtrl.Gains[ i ] = pGains_Q16[ i ] / 65536.0f;
             }
         }
+
+        if( predict ) {
+            silk_gain_mult_update( &psEnc->sCmn, gainMult_Q8 );
+        }
+        psEnc->sCmn.rateUnusedBits = silk_max_int( maxBits - ec_tell( psRangeEnc ), 0 );
     }
 
     /* Update input buffer */
@@ -30,6 +30,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include "main.h"
+#include "tuning_parameters.h"
 
 #define OFFSET                  ( ( MIN_QGAIN_DB * 128 ) / 6 + 16 * 128 )
 #define SCALE_Q16               ( ( 65536 * ( N_LEVELS_QGAIN - 1 ) ) / ( ( ( MAX_QGAIN_DB - MIN_QGAIN_DB ) * 128 ) / 6 ) )
@@ -140,3 +141,84 @@ opus_int32 silk_gains_ID(                                       /* O    returns
 
     return gainsID;
 }
+
+/* Gain multiplier to start the CBR rate control loop from, predicted from earlier frames of the same signal type */
+opus_int16 silk_gain_mult_predict(                              /* O    gain multiplier, Q8                         */
+    const silk_encoder_state    *psEncC                         /* I    Encoder state                               */
+)
+{
+    opus_int voiced = psEncC->indices.signalType == TYPE_VOICED;
+
+    return (opus_int16)silk_log2lin( psEncC->gainPredLog2_Q7[ voiced ] + SILK_FIX_CONST( 8, 7 ) );
+}
+
+/* Next gain multiplier while the rate control loop has not found gains on both sides of the budget */
+opus_int16 silk_gain_mult_step(                                 /* O    gain multiplier, Q8                         */
+    const silk_encoder_state    *psEncC,                        /* I    Encoder state                               */
+    const opus_int16            gainMult_Q8,                    /* I    gain multiplier of the last run             */
+    const opus_int32            nBits,                          /* I    bits used by the last run                   */
+    const opus_int              maxBits                         /* I    bit budget                                  */
+)
+{
+    opus_int   voiced = psEncC->indices.signalType == TYPE_VOICED;
+    opus_int32 slope_Q8, bitsPerOctave, step_Q7, gainMult;
+
+    slope_Q8 = psEncC->gainPredSlope_Q8[ voiced ];
+    if( slope_Q8 == 0 ) {
+        slope_Q8 = GAIN_PRED_SLOPE_DEFAULT_Q8;
+    }
+    bitsPerOctave = silk_max_32( silk_RSHIFT( silk_SMULBB( slope_Q8, psEncC->frame_length ), 8 ), 1 );
+
+    /* Doubling the gains saves bitsPerOctave bits; aim for the middle of the accepted range */
+    step_Q7 = silk_DIV32( silk_LSHIFT( nBits - ( maxBits - GAIN_PRED_TARGET_MARGIN_BITS ), 7 ), bitsPerOctave );
+    if( step_Q7 >= 0 ) {
+        step_Q7 = silk_LIMIT_32( step_Q7, GAIN_PRED_MIN_STEP_Q7, SILK_FIX_CONST( 1, 7 ) );
+    } else {
+        step_Q7 = silk_LIMIT_32( step_Q7, -SILK_FIX_CONST( 1, 7 ), -GAIN_PRED_MIN_STEP_Q7 );
+    }
+
+    gainMult = silk_SMULWB( silk_log2lin( step_Q7 + SILK_FIX_CONST( 16, 7 ) ), gainMult_Q8 );
+    return (opus_int16)silk_LIMIT_32( gainMult, 1, silk_int16_MAX );
+}
+
+/* Update the measured bits versus gain slope from two quantizer runs on the same frame */
+void silk_gain_mult_learn(
+    silk_encoder_state          *psEncC,                        /* I/O  Encoder state                               */
+    const opus_int16            gainMult0_Q8,                   /* I    gain multiplier of the first run            */
+    const opus_int32            nBits0,                         /* I    bits used by the first run                  */
+    const opus_int16            gainMult1_Q8,                   /* I    gain multiplier of the second run           */
+    const opus_int32            nBits1                          /* I    bits used by the second run                 */
+)
+{
+    opus_int   voiced = psEncC->indices.signalType == TYPE_VOICED;
+    opus_int32 octaves_Q7, slope_Q8;
+
+    octaves_Q7 = silk_lin2log( gainMult1_Q8 ) - silk_lin2log( gainMult0_Q8 );
+    if( silk_abs( octaves_Q7 ) < GAIN_PRED_MIN_STEP_Q7 / 2 ) {
+        /* Gain quantization makes the bit counts of close multipliers meaningless */
+        return;
+    }
+    slope_Q8 = silk_DIV32( silk_LSHIFT( nBits0 - nBits1, 15 ), silk_SMULBB( octaves_Q7, psEncC->frame_length ) );
+    if( slope_Q8 <= 0 ) {
+        return;
+    }
+    slope_Q8 = silk_LIMIT_32( slope_Q8, SILK_FIX_CONST( 0.125, 8 ), SILK_FIX_CONST( 4, 8 ) );
+    if( psEncC->gainPredSlope_Q8[ voiced ] == 0 ) {
+        psEncC->gainPredSlope_Q8[ voiced ] = (opus_int16)slope_Q8;
+    } else {
+        psEncC->gainPredSlope_Q8[ voiced ] += (opus_int16)silk_RSHIFT( slope_Q8 - psEncC->gainPredSlope_Q8[ voiced ], 2 );
+    }
+}
+
+/* Update the prediction with the gain multiplier the frame was coded with */
+void silk_gain_mult_update(
+    silk_encoder_state          *psEncC,                        /* I/O  Encoder state                               */
+    const opus_int16            gainMult_Q8                     /* I    final gain multiplier                       */
+)
+{
+    opus_int   voiced = psEncC->indices.signalType == TYPE_VOICED;
+    opus_int32 log2_Q7;
+
+    log2_Q7 = silk_LIMIT_32( silk_lin2log( silk_max_int( gainMult_Q8, 1 ) ) - SILK_FIX_CONST( 8, 7 ), -SILK_FIX_CONST( 4, 7 ), SILK_FIX_CONST( 6, 7 ) );
+    psEncC->gainPredLog2_Q7[ voiced ] += (opus_int16)silk_RSHIFT( log2_Q7 - psEncC->gainPredLog2_Q7[ voiced ], 1 );
+}
@@ -31,7 +31,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "SigProc_FIX.h"
 
-opus_int32 silk_inner_prod_aligned_scale(
+opus_int32 silk_inner_prod_aligned_scale_c(
     const opus_int16 *const     inVec1,             /*    I input vector 1                                              */
     const opus_int16 *const     inVec2,             /*    I input vector 2                                              */
     const opus_int              scale,              /*    I number of bits to shift                                     */
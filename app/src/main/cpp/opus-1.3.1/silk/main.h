@@ -44,6 +44,8 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #if (defined(OPUS_ARM_ASM) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR))
 #include "arm/NSQ_del_dec_arm.h"
+#include "arm/NLSF_VQ_arm.h"
+#include "arm/VQ_WMat_EC_arm.h"
 #endif
 
 /* Convert Left/Right stereo signal to adaptive Mid/Side representation */
@@ -164,7 +166,7 @@ void silk_encode_pulses(
 /* Shell encoder, operates on one shell code frame of 16 pulses */
 void silk_shell_encoder(
     ec_enc                      *psRangeEnc,                    /* I/O  compressor data structure                   */
-    const opus_int              *pulses0                        /* I    data: nonnegative pulse amplitudes          */
+    const opus_int              *pulse_tree                     /* I    pulse counts per tree node [32]             */
 );
 
 /* Shell decoder, operates on one shell code frame of 16 pulses */
@@ -198,6 +200,34 @@ opus_int32 silk_gains_ID(                                       /* O    returns
     const opus_int              nb_subfr                        /* I    number of subframes                         */
 );
 
+/* Gain multiplier to start the CBR rate control loop from, predicted from earlier frames of the same signal type */
+opus_int16 silk_gain_mult_predict(                              /* O    gain multiplier, Q8                         */
+    const silk_encoder_state    *psEncC                         /* I    Encoder state                               */
+);
+
+/* Next gain multiplier while the rate control loop has not found gains on both sides of the budget */
+opus_int16 silk_gain_mult_step(                                 /* O    gain multiplier, Q8                         */
+    const silk_encoder_state    *psEncC,                        /* I    Encoder state                               */
+    const opus_int16            gainMult_Q8,                    /* I    gain multiplier of the last run             */
+    const opus_int32            nBits,                          /* I    bits used by the last run                   */
+    const opus_int              maxBits                         /* I    bit budget                                  */
+);
+
+/* Update the measured bits versus gain slope from two quantizer runs on the same frame */
+void silk_gain_mult_learn(
+    silk_encoder_state          *psEncC,                        /* I/O  Encoder state                               */
+    const opus_int16            gainMult0_Q8,                   /* I    gain multiplier of the first run            */
+    const opus_int32            nBits0,                         /* I    bits used by the first run                  */
+    const opus_int16            gainMult1_Q8,                   /* I    gain multiplier of the second run           */
+    const opus_int32            nBits1                          /* I    bits used by the second run                 */
+);
+
+/* Update the prediction with the gain multiplier the frame was coded with */
+void silk_gain_mult_update(
+    silk_encoder_state          *psEncC,                        /* I/O  Encoder state                               */
+    const opus_int16            gainMult_Q8                     /* I    final gain multiplier                       */
+);
+
 /* Interpolate two vectors */
 void silk_interpolate(
     opus_int16                  xi[ MAX_LPC_ORDER ],            /* O    interpolated vector                         */
@@ -342,12 +372,13 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
     const opus_int16            *pW_QW,                         /* I    NLSF weight vector [ LPC_ORDER ]            */
     const opus_int              NLSF_mu_Q20,                    /* I    Rate weight for the RD optimization         */
     const opus_int              nSurvivors,                     /* I    Max survivors after first stage             */
-    const opus_int              signalType                      /* I    Signal type: 0/1/2                          */
+    const opus_int              signalType,                     /* I    Signal type: 0/1/2                          */
+    int                         arch                            /* I    Run-time architecture                       */
 );
 
 /* Compute quantization errors for an LPC_order element input vector for a VQ codebook */
-void silk_NLSF_VQ(
-    opus_int32                  err_Q26[],                      /* O    Quantization errors [K]                     */
+void silk_NLSF_VQ_c(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
     const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
     const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
     const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
@@ -355,6 +386,11 @@ void silk_NLSF_VQ(
     const opus_int              LPC_order                       /* I    Number of LPCs                              */
 );
 
+#if !defined(OVERRIDE_silk_NLSF_VQ)
+#define silk_NLSF_VQ(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order, arch) \
+    ((void)(arch),silk_NLSF_VQ_c(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order))
+#endif
+
 /* Delayed-decision quantizer for NLSF residuals */
 opus_int32 silk_NLSF_del_dec_quant(                             /* O    Returns RD value in Q25                     */
     opus_int8                   indices[],                      /* O    Quantization indices [ order ]              */
@@ -33,18 +33,6 @@ POSSIBILITY OF SUCH DAMAGE.
 
 /* shell coder; pulse-subframe length is hardcoded */
 
-static OPUS_INLINE void combine_pulses(
-    opus_int         *out,   /* O    combined pulses vector [len] */
-    const opus_int   *in,    /* I    input vector       [2 * len] */
-    const opus_int   len     /* I    number of OUTPUT samples     */
-)
-{
-    opus_int k;
-    for( k = 0; k < len; k++ ) {
-        out[ k ] = in[ 2 * k ] + in[ 2 * k + 1 ];
-    }
-}
-
 static OPUS_INLINE void encode_split(
     ec_enc                      *psRangeEnc,    /* I/O  compressor data structure                   */
     const opus_int              p_child1,       /* I    pulse amplitude of first child subframe     */
@@ -74,23 +62,31 @@ static OPUS_INLINE void decode_split(
     }
 }
 
-/* Shell encoder, operates on one shell code frame of 16 pulses */
+/* Table of shell cdfs for the split of each tree node, see silk_shell_encoder() */
+static const opus_uint8 * const silk_shell_split_table[ SHELL_CODEC_FRAME_LENGTH ] = {
+    NULL,
+    silk_shell_code_table3,
+    silk_shell_code_table2, silk_shell_code_table2,
+    silk_shell_code_table1, silk_shell_code_table1, silk_shell_code_table1, silk_shell_code_table1,
+    silk_shell_code_table0, silk_shell_code_table0, silk_shell_code_table0, silk_shell_code_table0,
+    silk_shell_code_table0, silk_shell_code_table0, silk_shell_code_table0, silk_shell_code_table0
+};
+
+/* Shell encoder, operates on one shell code frame of 16 pulses.                                  */
+/* The pulse counts form a binary tree stored like a heap: node 1 is the whole frame, the children */
+/* of node n are 2 * n and 2 * n + 1, and nodes 16 to 31 are the 16 pulses. silk_encode_pulses()  */
+/* needs the sums anyway to check the pulse limits, so it passes the whole tree.                  */
 void silk_shell_encoder(
     ec_enc                      *psRangeEnc,                    /* I/O  compressor data structure                   */
-    const opus_int              *pulses0                        /* I    data: nonnegative pulse amplitudes          */
+    const opus_int              *pulse_tree                     /* I    pulse counts per tree node [32]             */
 )
 {
-    opus_int pulses1[ 8 ], pulses2[ 4 ], pulses3[ 2 ], pulses4[ 1 ];
+    const opus_int *pulses0 = &pulse_tree[ 16 ], *pulses1 = &pulse_tree[ 8 ], *pulses2 = &pulse_tree[ 4 ];
+    const opus_int *pulses3 = &pulse_tree[ 2 ], *pulses4 = &pulse_tree[ 1 ];
 
     /* this function operates on one shell code frame of 16 pulses */
     silk_assert( SHELL_CODEC_FRAME_LENGTH == 16 );
 
-    /* tree representation per pulse-subframe */
-    combine_pulses( pulses1, pulses0, 8 );
-    combine_pulses( pulses2, pulses1, 4 );
-    combine_pulses( pulses3, pulses2, 2 );
-    combine_pulses( pulses4, pulses3, 1 );
-
     encode_split( psRangeEnc, pulses3[  0 ], pulses4[ 0 ], silk_shell_code_table3 );
 
     encode_split( psRangeEnc, pulses2[  0 ], pulses3[ 0 ], silk_shell_code_table2 );
@@ -122,11 +118,23 @@ void silk_shell_decoder(
     const opus_int              pulses4                         /* I    number of pulses per pulse-subframe         */
 )
 {
+    opus_int   n;
     opus_int16 pulses3[ 2 ], pulses2[ 4 ], pulses1[ 8 ];
 
     /* this function operates on one shell code frame of 16 pulses */
     silk_assert( SHELL_CODEC_FRAME_LENGTH == 16 );
 
+    if( pulses4 == 1 ) {
+        /* A single pulse: only the splits on its path are coded, follow them down to the pulse */
+        for( n = 1; n < SHELL_CODEC_FRAME_LENGTH; ) {
+            n = 2 * n + 1 - ec_dec_icdf( psRangeDec,
+                &silk_shell_split_table[ n ][ silk_shell_code_table_offsets[ 1 ] ], 8 );
+        }
+        silk_memset( pulses0, 0, SHELL_CODEC_FRAME_LENGTH * sizeof( opus_int16 ) );
+        pulses0[ n - SHELL_CODEC_FRAME_LENGTH ] = 1;
+        return;
+    }
+
     decode_split( &pulses3[  0 ], &pulses3[  1 ], psRangeDec, pulses4,      silk_shell_code_table3 );
 
     decode_split( &pulses2[  0 ], &pulses2[  1 ], psRangeDec, pulses3[ 0 ], silk_shell_code_table2 );
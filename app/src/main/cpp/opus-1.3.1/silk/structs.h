@@ -212,6 +212,13 @@ typedef struct {
     opus_int                     ec_prevSignalType;
     opus_int16                   ec_prevLagIndex;
 
+    /* CBR rate control */
+    opus_int                     useGainPrediction;                 /* Flag to start the rate control loop from a predicted gain        */
+    opus_int16                   gainPredLog2_Q7[ 2 ];              /* Smoothed log2 of the final gain multipliers, unvoiced/voiced     */
+    opus_int16                   gainPredSlope_Q8[ 2 ];             /* Bits per sample per doubling of the gains, 0 if not measured yet */
+    opus_int                     rateIterations;                    /* Number of quantizer runs for the last frame                      */
+    opus_int                     rateUnusedBits;                    /* Bits of the budget the last frame left unused                    */
+
     silk_resampler_state_struct resampler_state;
 
     /* DTX */
@@ -33,7 +33,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 /* Compute number of bits to right shift the sum of squares of a vector */
 /* of int16s to make it fit in an int32                                 */
-void silk_sum_sqr_shift(
+void silk_sum_sqr_shift_c(
     opus_int32                  *energy,            /* O   Energy of x, after shifting to the right                     */
     opus_int                    *shift,             /* O   Number of bits right shift applied to energy                 */
     const opus_int16            *x,                 /* I   Input vector                                                 */
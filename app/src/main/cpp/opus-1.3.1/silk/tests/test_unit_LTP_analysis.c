@@ -0,0 +1,180 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "celt/stack_alloc.h"
+#include "cpu_support.h"
+#include "SigProc_FIX.h"
+
+#ifdef FIXED_POINT
+
+#include "main_FIX.h"
+
+#define MAX_ORDER       16
+#define MAX_L           ( 4 * MAX_SUB_FRAME_LENGTH )
+#define MAX_PRE_LENGTH  MAX_LPC_ORDER
+#define MAX_LAG         ( 18 * MAX_FS_KHZ )
+#define MAX_FRAME       ( MAX_NB_SUBFR * MAX_SUB_FRAME_LENGTH )
+
+/* Time spent in the C and the selected implementation of each function */
+static clock_t time_c[ 3 ], time_arch[ 3 ];
+
+#define TIMED( t, call ) do { clock_t start_ = clock(); call; ( t ) += clock() - start_; } while( 0 )
+
+static void fill_signal( opus_int16 *x, int len, int shift )
+{
+    int i;
+    for( i = 0; i < len; i++ ) {
+        x[ i ] = (opus_int16)( ( rand() & 0xFFFF ) - 32768 ) >> shift;
+    }
+}
+
+/* Lengths of the LTP analysis at 8, 12 and 16 kHz, then arbitrary ones for the vector tails */
+static int pick_length( int count )
+{
+    static const int lengths[ 3 ] = { 40, 60, 80 };
+    return count % 4 ? lengths[ count % 4 - 1 ] : 1 + rand() % MAX_L;
+}
+
+static int test_corr( int arch )
+{
+    opus_int16 x[ MAX_L + MAX_ORDER - 1 ], t[ MAX_L ];
+    opus_int32 XX_ref[ MAX_ORDER * MAX_ORDER ], XX_opt[ MAX_ORDER * MAX_ORDER ];
+    opus_int32 Xt_ref[ MAX_ORDER ], Xt_opt[ MAX_ORDER ];
+    opus_int32 nrg_ref, nrg_opt;
+    opus_int   shifts_ref, shifts_opt;
+    int count, L, order, rshifts;
+
+    for( count = 0; count < 20000; count++ ) {
+        L = pick_length( count );
+        order = count % 2 ? LTP_ORDER : 1 + rand() % MAX_ORDER;
+        /* Full scale input needs a right shift to fit the energy in 32 bits */
+        fill_signal( x, L + order - 1, count % 8 );
+        fill_signal( t, L, count % 8 );
+
+        memset( XX_ref, 0, sizeof( XX_ref ) );
+        memset( XX_opt, 0, sizeof( XX_opt ) );
+        TIMED( time_c[ 0 ], silk_corrMatrix_FIX_c( x, L, order, XX_ref, &nrg_ref, &shifts_ref, 0 ) );
+        TIMED( time_arch[ 0 ], silk_corrMatrix_FIX( x, L, order, XX_opt, &nrg_opt, &shifts_opt, arch ) );
+        if( memcmp( XX_ref, XX_opt, sizeof( XX_ref ) ) || nrg_ref != nrg_opt || shifts_ref != shifts_opt ) {
+            fprintf( stderr, "**silk_corrMatrix_FIX() mismatch, loop %d L %d order %d rshifts %d**\n",
+                count, L, order, shifts_ref );
+            return 1;
+        }
+
+        rshifts = count % 3 ? shifts_ref : rand() % 8;
+        memset( Xt_ref, 0, sizeof( Xt_ref ) );
+        memset( Xt_opt, 0, sizeof( Xt_opt ) );
+        TIMED( time_c[ 1 ], silk_corrVector_FIX_c( x, t, L, order, Xt_ref, rshifts, 0 ) );
+        TIMED( time_arch[ 1 ], silk_corrVector_FIX( x, t, L, order, Xt_opt, rshifts, arch ) );
+        if( memcmp( Xt_ref, Xt_opt, sizeof( Xt_ref ) ) ) {
+            fprintf( stderr, "**silk_corrVector_FIX() mismatch, loop %d L %d order %d rshifts %d**\n",
+                count, L, order, rshifts );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_LTP_analysis_filter( int arch )
+{
+    opus_int16 buf[ MAX_LAG + LTP_ORDER + MAX_PRE_LENGTH + MAX_FRAME ];
+    opus_int16 res_ref[ MAX_NB_SUBFR * ( MAX_PRE_LENGTH + MAX_SUB_FRAME_LENGTH ) ];
+    opus_int16 res_opt[ MAX_NB_SUBFR * ( MAX_PRE_LENGTH + MAX_SUB_FRAME_LENGTH ) ];
+    opus_int16 LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ];
+    opus_int   pitchL[ MAX_NB_SUBFR ];
+    opus_int32 invGains_Q16[ MAX_NB_SUBFR ];
+    static const int fs_kHz[ 3 ] = { 8, 12, 16 };
+    const opus_int16 *x;
+    int count, fs, nb_subfr, subfr_length, pre_length, k;
+
+    for( count = 0; count < 10000; count++ ) {
+        fs = fs_kHz[ count % 3 ];
+        nb_subfr = count % 2 ? MAX_NB_SUBFR : MAX_NB_SUBFR / 2;
+        subfr_length = SUB_FRAME_LENGTH_MS * fs;
+        pre_length = count % 5 ? MAX_PRE_LENGTH : MIN_LPC_ORDER + rand() % ( MAX_PRE_LENGTH - MIN_LPC_ORDER );
+        fill_signal( buf, sizeof( buf ) / sizeof( buf[ 0 ] ), count % 6 );
+        for( k = 0; k < nb_subfr; k++ ) {
+            pitchL[ k ] = 2 * fs + rand() % ( 16 * fs );
+            /* Gains up to the largest inverse gain, and occasionally over the whole range */
+            invGains_Q16[ k ] = count % 7 ? rand() % silk_int32_MAX : (opus_int32)( (opus_uint32)rand() << 16 ^ (opus_uint32)rand() );
+        }
+        /* Coefficients over the whole 16-bit range saturate the residual */
+        fill_signal( LTPCoef_Q14, LTP_ORDER * MAX_NB_SUBFR, count % 2 ? 2 : 0 );
+        x = &buf[ MAX_LAG + LTP_ORDER ];
+
+        memset( res_ref, 0, sizeof( res_ref ) );
+        memset( res_opt, 0, sizeof( res_opt ) );
+        TIMED( time_c[ 2 ], silk_LTP_analysis_filter_FIX_c( res_ref, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, 0 ) );
+        TIMED( time_arch[ 2 ], silk_LTP_analysis_filter_FIX( res_opt, x, LTPCoef_Q14, pitchL, invGains_Q16, subfr_length, nb_subfr, pre_length, arch ) );
+        if( memcmp( res_ref, res_opt, sizeof( res_ref ) ) ) {
+            fprintf( stderr, "**silk_LTP_analysis_filter_FIX() mismatch, loop %d fs %d nb_subfr %d pre_length %d**\n",
+                count, fs, nb_subfr, pre_length );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void print_function( const char *name, int index )
+{
+    printf( "  %-32s C %6.3f s, optimized %6.3f s\n", name,
+        (double)time_c[ index ] / CLOCKS_PER_SEC, (double)time_arch[ index ] / CLOCKS_PER_SEC );
+}
+
+int main(void) {
+    const int arch = opus_select_arch();
+    ALLOC_STACK;
+
+    srand(0);
+
+    printf("Testing silk LTP analysis optimization ...\n");
+    if( test_corr( arch ) || test_LTP_analysis_filter( arch ) ) {
+        return 1;
+    }
+    print_function( "silk_corrMatrix_FIX()", 0 );
+    print_function( "silk_corrVector_FIX()", 1 );
+    print_function( "silk_LTP_analysis_filter_FIX()", 2 );
+    printf("silk LTP analysis optimization passed\n");
+    return 0;
+}
+
+#else
+
+int main(void) {
+    printf("silk LTP analysis optimization test needs FIXED_POINT, skipped\n");
+    return 0;
+}
+
+#endif
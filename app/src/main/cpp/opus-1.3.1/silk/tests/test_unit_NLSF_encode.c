@@ -0,0 +1,197 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "celt/stack_alloc.h"
+#include "cpu_support.h"
+#include "main.h"
+#include "tables.h"
+
+#define LOOPS 20000
+
+/* Survivors used by silk_setup_complexity() for complexities 5 to 10 */
+static const int survivors[ 6 ] = { 6, 8, 8, 16, 16, 16 };
+
+/* silk_NLSF_encode() as it was before survivor pruning, with the plain C VQ */
+static opus_int32 NLSF_encode_reference(
+          opus_int8             *NLSFIndices,
+          opus_int16            *pNLSF_Q15,
+    const silk_NLSF_CB_struct   *psNLSF_CB,
+    const opus_int16            *pW_Q2,
+    const opus_int              NLSF_mu_Q20,
+    const opus_int              nSurvivors,
+    const opus_int              signalType
+)
+{
+    opus_int         i, s, ind1, bestIndex, prob_Q8, bits_q7;
+    opus_int32       W_tmp_Q9;
+    opus_int32       err_Q24[ 32 ];
+    opus_int32       RD_Q25[ 16 ];
+    opus_int         tempIndices1[ 16 ];
+    opus_int8        tempIndices2[ 16 * MAX_LPC_ORDER ];
+    opus_int16       res_Q10[ MAX_LPC_ORDER ];
+    opus_int16       W_adj_Q5[ MAX_LPC_ORDER ];
+    opus_uint8       pred_Q8[ MAX_LPC_ORDER ];
+    opus_int16       ec_ix[ MAX_LPC_ORDER ];
+    const opus_uint8 *pCB_element, *iCDF_ptr;
+    const opus_int16 *pCB_Wght_Q9;
+
+    silk_NLSF_stabilize( pNLSF_Q15, psNLSF_CB->deltaMin_Q15, psNLSF_CB->order );
+    silk_NLSF_VQ_c( err_Q24, pNLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order );
+    silk_insertion_sort_increasing( err_Q24, tempIndices1, psNLSF_CB->nVectors, nSurvivors );
+
+    for( s = 0; s < nSurvivors; s++ ) {
+        ind1 = tempIndices1[ s ];
+        pCB_element = &psNLSF_CB->CB1_NLSF_Q8[ ind1 * psNLSF_CB->order ];
+        pCB_Wght_Q9 = &psNLSF_CB->CB1_Wght_Q9[ ind1 * psNLSF_CB->order ];
+        for( i = 0; i < psNLSF_CB->order; i++ ) {
+            W_tmp_Q9 = pCB_Wght_Q9[ i ];
+            res_Q10[ i ] = (opus_int16)silk_RSHIFT( silk_SMULBB( pNLSF_Q15[ i ] - silk_LSHIFT16( (opus_int16)pCB_element[ i ], 7 ), W_tmp_Q9 ), 14 );
+            W_adj_Q5[ i ] = silk_DIV32_varQ( (opus_int32)pW_Q2[ i ], silk_SMULBB( W_tmp_Q9, W_tmp_Q9 ), 21 );
+        }
+        silk_NLSF_unpack( ec_ix, pred_Q8, psNLSF_CB, ind1 );
+        RD_Q25[ s ] = silk_NLSF_del_dec_quant( &tempIndices2[ s * MAX_LPC_ORDER ], res_Q10, W_adj_Q5, pred_Q8, ec_ix,
+            psNLSF_CB->ec_Rates_Q5, psNLSF_CB->quantStepSize_Q16, psNLSF_CB->invQuantStepSize_Q6, NLSF_mu_Q20, psNLSF_CB->order );
+        iCDF_ptr = &psNLSF_CB->CB1_iCDF[ ( signalType >> 1 ) * psNLSF_CB->nVectors ];
+        if( ind1 == 0 ) {
+            prob_Q8 = 256 - iCDF_ptr[ ind1 ];
+        } else {
+            prob_Q8 = iCDF_ptr[ ind1 - 1 ] - iCDF_ptr[ ind1 ];
+        }
+        bits_q7 = ( 8 << 7 ) - silk_lin2log( prob_Q8 );
+        RD_Q25[ s ] = silk_SMLABB( RD_Q25[ s ], bits_q7, silk_RSHIFT( NLSF_mu_Q20, 2 ) );
+    }
+    silk_insertion_sort_increasing( RD_Q25, &bestIndex, nSurvivors, 1 );
+
+    NLSFIndices[ 0 ] = (opus_int8)tempIndices1[ bestIndex ];
+    silk_memcpy( &NLSFIndices[ 1 ], &tempIndices2[ bestIndex * MAX_LPC_ORDER ], psNLSF_CB->order * sizeof( opus_int8 ) );
+    silk_NLSF_decode( pNLSF_Q15, NLSFIndices, psNLSF_CB );
+    return RD_Q25[ 0 ];
+}
+
+/* A random codebook vector with noise on top, roughly what the encoder sees */
+static void random_NLSF( opus_int16 *NLSF_Q15, const silk_NLSF_CB_struct *psNLSF_CB, int spread )
+{
+    int i, ind1 = rand() % psNLSF_CB->nVectors;
+    for( i = 0; i < psNLSF_CB->order; i++ ) {
+        opus_int32 v = silk_LSHIFT( psNLSF_CB->CB1_NLSF_Q8[ ind1 * psNLSF_CB->order + i ], 7 )
+            + rand() % ( 2 * spread + 1 ) - spread;
+        NLSF_Q15[ i ] = (opus_int16)silk_LIMIT( v, 0, 32767 );
+    }
+    silk_insertion_sort_increasing_all_values_int16( NLSF_Q15, psNLSF_CB->order );
+}
+
+static int test_NLSF_VQ( int arch )
+{
+    static const silk_NLSF_CB_struct *const codebooks[ 2 ] = { &silk_NLSF_CB_NB_MB, &silk_NLSF_CB_WB };
+    opus_int16 NLSF_Q15[ MAX_LPC_ORDER ];
+    opus_int32 err_ref[ 32 ], err_opt[ 32 ];
+    int count, cb;
+
+    for( count = 0; count < LOOPS; count++ ) {
+        for( cb = 0; cb < 2; cb++ ) {
+            const silk_NLSF_CB_struct *psNLSF_CB = codebooks[ cb ];
+            random_NLSF( NLSF_Q15, psNLSF_CB, 1 << ( count % 15 ) );
+            silk_NLSF_VQ_c( err_ref, NLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order );
+            silk_NLSF_VQ( err_opt, NLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order, arch );
+            if( memcmp( err_ref, err_opt, psNLSF_CB->nVectors * sizeof( opus_int32 ) ) ) {
+                fprintf( stderr, "**silk_NLSF_VQ() mismatch, loop %d order %d**\n", count, psNLSF_CB->order );
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Compares silk_NLSF_encode() with the reference for the survivor counts of */
+/* complexities 5 to 10 and prints the time spent by both                    */
+static int test_NLSF_encode( int arch )
+{
+    static const silk_NLSF_CB_struct *const codebooks[ 2 ] = { &silk_NLSF_CB_NB_MB, &silk_NLSF_CB_WB };
+    opus_int16 NLSF_Q15[ MAX_LPC_ORDER ], NLSF_ref[ MAX_LPC_ORDER ], NLSF_opt[ MAX_LPC_ORDER ];
+    opus_int16 W_QW[ MAX_LPC_ORDER ];
+    opus_int8  ind_ref[ MAX_LPC_ORDER + 1 ], ind_opt[ MAX_LPC_ORDER + 1 ];
+    opus_int32 RD_ref, RD_opt;
+    clock_t    start, time_ref, time_opt;
+    int        complexity, count, cb, mu_Q20, signalType;
+
+    for( complexity = 5; complexity <= 10; complexity++ ) {
+        time_ref = time_opt = 0;
+        for( count = 0; count < LOOPS; count++ ) {
+            for( cb = 0; cb < 2; cb++ ) {
+                const silk_NLSF_CB_struct *psNLSF_CB = codebooks[ cb ];
+                random_NLSF( NLSF_Q15, psNLSF_CB, 1 << ( count % 12 ) );
+                silk_NLSF_VQ_weights_laroia( W_QW, NLSF_Q15, psNLSF_CB->order );
+                mu_Q20 = SILK_FIX_CONST( 0.001, 20 ) + rand() % SILK_FIX_CONST( 0.004, 20 );
+                signalType = rand() % 3;
+
+                silk_memcpy( NLSF_ref, NLSF_Q15, sizeof( NLSF_Q15 ) );
+                silk_memcpy( NLSF_opt, NLSF_Q15, sizeof( NLSF_Q15 ) );
+                start = clock();
+                RD_ref = NLSF_encode_reference( ind_ref, NLSF_ref, psNLSF_CB, W_QW, mu_Q20,
+                    survivors[ complexity - 5 ], signalType );
+                time_ref += clock() - start;
+                start = clock();
+                RD_opt = silk_NLSF_encode( ind_opt, NLSF_opt, psNLSF_CB, W_QW, mu_Q20,
+                    survivors[ complexity - 5 ], signalType, arch );
+                time_opt += clock() - start;
+
+                if( RD_ref != RD_opt || memcmp( ind_ref, ind_opt, psNLSF_CB->order + 1 )
+                    || memcmp( NLSF_ref, NLSF_opt, psNLSF_CB->order * sizeof( opus_int16 ) ) ) {
+                    fprintf( stderr, "**silk_NLSF_encode() mismatch, complexity %d loop %d order %d**\n",
+                        complexity, count, psNLSF_CB->order );
+                    return 1;
+                }
+            }
+        }
+        printf( "  complexity %2d, %2d survivors: reference %6.3f s, optimized %6.3f s\n",
+            complexity, survivors[ complexity - 5 ],
+            (double)time_ref / CLOCKS_PER_SEC, (double)time_opt / CLOCKS_PER_SEC );
+    }
+    return 0;
+}
+
+int main(void) {
+    const int arch = opus_select_arch();
+    ALLOC_STACK;
+
+    srand(0);
+
+    printf("Testing silk_NLSF_encode() optimization ...\n");
+    if( test_NLSF_VQ( arch ) || test_NLSF_encode( arch ) ) {
+        return 1;
+    }
+    printf("silk_NLSF_encode() optimization passed\n");
+    return 0;
+}
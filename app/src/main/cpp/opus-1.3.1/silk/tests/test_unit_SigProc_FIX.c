@@ -0,0 +1,231 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "celt/stack_alloc.h"
+#include "cpu_support.h"
+#include "SigProc_FIX.h"
+
+/* The primitives without an arch argument are only wired in when the build */
+/* presumes the instruction set, so test the optimized versions directly    */
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
+# define OPT( name ) name ## _sse4_1
+# if defined(OPUS_X86_PRESUME_SSE4_1)
+#  define OPT_AVAILABLE( arch ) ( (void)( arch ), 1 )
+# else
+#  define OPT_AVAILABLE( arch ) ( ( arch ) >= 3 )
+# endif
+#elif defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+# define OPT( name ) name ## _neon
+# if defined(OPUS_ARM_PRESUME_NEON_INTR)
+#  define OPT_AVAILABLE( arch ) ( (void)( arch ), 1 )
+# else
+#  define OPT_AVAILABLE( arch ) ( ( arch ) >= OPUS_ARCH_ARM_NEON )
+# endif
+#endif
+
+#define MAX_LEN         640
+#define NB_PRIMITIVES   4
+
+static const char *const names[ NB_PRIMITIVES ] = {
+    "silk_sum_sqr_shift()",
+    "silk_inner_prod_aligned_scale()",
+    "silk_LPC_analysis_filter()",
+    "silk_scale_copy_vector16()"
+};
+
+/* Time spent in the C and the optimized implementation of each primitive */
+static clock_t time_c[ NB_PRIMITIVES ], time_opt[ NB_PRIMITIVES ];
+
+#define TIMED( t, call ) do { clock_t start_ = clock(); call; ( t ) += clock() - start_; } while( 0 )
+
+/* Random signal scaled down by shift, with a few full scale samples */
+static void fill_signal( opus_int16 *x, int len, int shift )
+{
+    int i;
+    for( i = 0; i < len; i++ ) {
+        x[ i ] = (opus_int16)( ( rand() & 0xFFFF ) - 32768 ) >> shift;
+        if( rand() % 64 == 0 ) {
+            x[ i ] = rand() & 1 ? silk_int16_MAX : silk_int16_MIN;
+        }
+    }
+}
+
+static int test_sum_sqr_shift( int arch )
+{
+    opus_int16 x[ MAX_LEN ];
+    opus_int32 nrg_ref, nrg_opt;
+    opus_int   shift_ref, shift_opt;
+    int count, len;
+
+    for( count = 0; count < 20000; count++ ) {
+        len = rand() % MAX_LEN + 1;
+        fill_signal( x, len, count % 16 );
+        TIMED( time_c[ 0 ], silk_sum_sqr_shift_c( &nrg_ref, &shift_ref, x, len ) );
+#ifdef OPT
+        if( OPT_AVAILABLE( arch ) ) {
+            TIMED( time_opt[ 0 ], OPT( silk_sum_sqr_shift )( &nrg_opt, &shift_opt, x, len ) );
+        } else
+#endif
+        {
+            (void)arch;
+            TIMED( time_opt[ 0 ], silk_sum_sqr_shift( &nrg_opt, &shift_opt, x, len ) );
+        }
+        if( nrg_ref != nrg_opt || shift_ref != shift_opt ) {
+            fprintf( stderr, "**silk_sum_sqr_shift() mismatch, loop %d len %d**\n", count, len );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_inner_prod_aligned_scale( int arch )
+{
+    opus_int16 x[ MAX_LEN ], y[ MAX_LEN ];
+    opus_int32 ref, opt;
+    int count, len, scale;
+
+    for( count = 0; count < 20000; count++ ) {
+        len = rand() % MAX_LEN + 1;
+        /* Keep the shifted sum within 32 bits, as the callers do */
+        scale = 6 + rand() % 10;
+        fill_signal( x, len, 0 );
+        fill_signal( y, len, 0 );
+        if( len > 1 << ( scale - 1 ) ) {
+            len = 1 << ( scale - 1 );
+        }
+        TIMED( time_c[ 1 ], ref = silk_inner_prod_aligned_scale_c( x, y, scale, len ) );
+#ifdef OPT
+        if( OPT_AVAILABLE( arch ) ) {
+            TIMED( time_opt[ 1 ], opt = OPT( silk_inner_prod_aligned_scale )( x, y, scale, len ) );
+        } else
+#endif
+        {
+            (void)arch;
+            TIMED( time_opt[ 1 ], opt = silk_inner_prod_aligned_scale( x, y, scale, len ) );
+        }
+        if( ref != opt ) {
+            fprintf( stderr, "**silk_inner_prod_aligned_scale() mismatch, loop %d len %d scale %d**\n", count, len, scale );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_LPC_analysis_filter( int arch )
+{
+    opus_int16 in[ MAX_LEN ], B[ SILK_MAX_ORDER_LPC ];
+    opus_int16 out_ref[ MAX_LEN ], out_opt[ MAX_LEN ];
+    int count, len, d, i;
+
+    for( count = 0; count < 20000; count++ ) {
+        d = 6 + 2 * ( rand() % ( ( SILK_MAX_ORDER_LPC - 6 ) / 2 + 1 ) );
+        len = d + rand() % ( MAX_LEN - d + 1 );
+        fill_signal( in, len, count % 8 );
+        /* Mostly stable filters, sometimes wild ones to exercise saturation */
+        for( i = 0; i < d; i++ ) {
+            B[ i ] = count % 4 ? (opus_int16)( ( rand() % 8192 ) - 4096 ) >> ( i / 2 ) : (opus_int16)( ( rand() & 0xFFFF ) - 32768 );
+        }
+        memset( out_ref, 0x55, sizeof( out_ref ) );
+        memset( out_opt, 0x55, sizeof( out_opt ) );
+        TIMED( time_c[ 2 ], silk_LPC_analysis_filter_c( out_ref, in, B, len, d, 0 ) );
+        TIMED( time_opt[ 2 ], silk_LPC_analysis_filter( out_opt, in, B, len, d, arch ) );
+        if( memcmp( out_ref, out_opt, sizeof( out_ref ) ) ) {
+            fprintf( stderr, "**silk_LPC_analysis_filter() mismatch, loop %d len %d order %d**\n", count, len, d );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#ifdef FIXED_POINT
+
+static int test_scale_copy_vector16( int arch )
+{
+    opus_int16 in[ MAX_LEN ], out_ref[ MAX_LEN ], out_opt[ MAX_LEN ];
+    opus_int32 gain_Q16;
+    int count, len;
+
+    for( count = 0; count < 20000; count++ ) {
+        len = rand() % MAX_LEN + 1;
+        fill_signal( in, len, count % 4 );
+        /* Gains in the range the encoder uses, and some negative and large ones */
+        gain_Q16 = count % 8 ? rand() % ( 1 << 17 ) : (opus_int32)( rand() - RAND_MAX / 2 );
+        memset( out_ref, 0x55, sizeof( out_ref ) );
+        memset( out_opt, 0x55, sizeof( out_opt ) );
+        TIMED( time_c[ 3 ], silk_scale_copy_vector16_c( out_ref, in, gain_Q16, len ) );
+#ifdef OPT
+        if( OPT_AVAILABLE( arch ) ) {
+            TIMED( time_opt[ 3 ], OPT( silk_scale_copy_vector16 )( out_opt, in, gain_Q16, len ) );
+        } else
+#endif
+        {
+            (void)arch;
+            TIMED( time_opt[ 3 ], silk_scale_copy_vector16( out_opt, in, gain_Q16, len ) );
+        }
+        if( memcmp( out_ref, out_opt, sizeof( out_ref ) ) ) {
+            fprintf( stderr, "**silk_scale_copy_vector16() mismatch, loop %d len %d gain %d**\n", count, len, (int)gain_Q16 );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#endif
+
+int main(void) {
+    const int arch = opus_select_arch();
+    int i;
+    ALLOC_STACK;
+
+    srand(0);
+
+    printf("Testing SILK signal processing primitives optimization ...\n");
+    if( test_sum_sqr_shift( arch ) || test_inner_prod_aligned_scale( arch ) || test_LPC_analysis_filter( arch ) ) {
+        return 1;
+    }
+#ifdef FIXED_POINT
+    if( test_scale_copy_vector16( arch ) ) {
+        return 1;
+    }
+#endif
+    for( i = 0; i < NB_PRIMITIVES; i++ ) {
+        if( time_c[ i ] + time_opt[ i ] > 0 ) {
+            printf( "  %-34s C %6.3f s, optimized %6.3f s\n", names[ i ],
+                (double)time_c[ i ] / CLOCKS_PER_SEC, (double)time_opt[ i ] / CLOCKS_PER_SEC );
+        }
+    }
+    printf("SILK signal processing primitives optimization passed\n");
+    return 0;
+}
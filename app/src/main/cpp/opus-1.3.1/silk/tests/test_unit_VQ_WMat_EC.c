@@ -0,0 +1,150 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "celt/stack_alloc.h"
+#include "cpu_support.h"
+#include "main.h"
+#include "tables.h"
+
+#ifdef FIXED_POINT
+
+#include "main_FIX.h"
+
+#define LOOPS           20000
+#define SUBFR_LENGTH    ( 5 * 16 )
+#define NB_SUBFR        4
+#define LTP_MEM         ( 20 * 16 )
+
+#define TIMED( t, call ) do { clock_t start_ = clock(); call; ( t ) += clock() - start_; } while( 0 )
+
+/* Correlations of a voiced 16 kHz residual, as silk_find_pred_coefs_FIX() feeds them to the LTP quantizer */
+static void voiced_correlations( opus_int32 XX_Q17[], opus_int32 xX_Q17[], int arch )
+{
+    opus_int16 res[ LTP_MEM + NB_SUBFR * SUBFR_LENGTH ];
+    opus_int   lag[ NB_SUBFR ];
+    opus_int   i, period, gain_Q10, noise;
+
+    period = 32 + rand() % ( 18 * 16 - 32 - LTP_ORDER );
+    gain_Q10 = 512 + rand() % 512;
+    noise = 1 + rand() % 4000;
+    for( i = 0; i < LTP_MEM + NB_SUBFR * SUBFR_LENGTH; i++ ) {
+        opus_int32 v = rand() % ( 2 * noise + 1 ) - noise;
+        if( i >= period ) {
+            v += silk_RSHIFT( silk_SMULBB( res[ i - period ], gain_Q10 ), 10 );
+        }
+        res[ i ] = (opus_int16)silk_SAT16( v );
+    }
+    for( i = 0; i < NB_SUBFR; i++ ) {
+        lag[ i ] = silk_LIMIT( period + rand() % 5 - 2, 32, 18 * 16 - LTP_ORDER );
+    }
+    silk_find_LTP_FIX( XX_Q17, xX_Q17, &res[ LTP_MEM ], lag, SUBFR_LENGTH, NB_SUBFR, arch );
+}
+
+/* Arbitrary, also indefinite, correlations that exercise the negative energy branch */
+static void random_correlations( opus_int32 XX_Q17[], opus_int32 xX_Q17[] )
+{
+    opus_int i;
+    for( i = 0; i < NB_SUBFR * LTP_ORDER * LTP_ORDER; i++ ) {
+        XX_Q17[ i ] = rand() % ( 1 << 21 ) - ( 1 << 20 );
+    }
+    for( i = 0; i < NB_SUBFR * LTP_ORDER; i++ ) {
+        xX_Q17[ i ] = rand() % ( 1 << 21 ) - ( 1 << 20 );
+    }
+}
+
+/* Compares silk_VQ_WMat_EC() with the C version on all three LTP codebooks */
+/* and prints the time spent by both on each codebook                       */
+static int test_VQ_WMat_EC( int arch )
+{
+    opus_int32 XX_Q17[ NB_SUBFR * LTP_ORDER * LTP_ORDER ], xX_Q17[ NB_SUBFR * LTP_ORDER ];
+    opus_int8  ind_ref, ind_opt;
+    opus_int32 res_nrg_ref, res_nrg_opt, rate_dist_ref, rate_dist_opt, max_gain_Q7;
+    opus_int   gain_ref, gain_opt;
+    clock_t    time_c[ 3 ] = { 0 }, time_arch[ 3 ] = { 0 };
+    int        count, k, j;
+
+    for( count = 0; count < LOOPS; count++ ) {
+        if( count & 7 ) {
+            voiced_correlations( XX_Q17, xX_Q17, arch );
+        } else {
+            random_correlations( XX_Q17, xX_Q17 );
+        }
+        max_gain_Q7 = rand() % ( 2 << 7 );
+        for( k = 0; k < 3; k++ ) {
+            for( j = 0; j < NB_SUBFR; j++ ) {
+                const opus_int32 *XX_ptr = &XX_Q17[ j * LTP_ORDER * LTP_ORDER ];
+                const opus_int32 *xX_ptr = &xX_Q17[ j * LTP_ORDER ];
+                /* Outputs the C version may leave untouched */
+                gain_ref = gain_opt = -1;
+                TIMED( time_c[ k ], silk_VQ_WMat_EC_c( &ind_ref, &res_nrg_ref, &rate_dist_ref, &gain_ref, XX_ptr, xX_ptr,
+                    silk_LTP_vq_ptrs_Q7[ k ], silk_LTP_vq_gain_ptrs_Q7[ k ], silk_LTP_gain_BITS_Q5_ptrs[ k ],
+                    SUBFR_LENGTH, max_gain_Q7, silk_LTP_vq_sizes[ k ] ) );
+                TIMED( time_arch[ k ], silk_VQ_WMat_EC( &ind_opt, &res_nrg_opt, &rate_dist_opt, &gain_opt, XX_ptr, xX_ptr,
+                    silk_LTP_vq_ptrs_Q7[ k ], silk_LTP_vq_gain_ptrs_Q7[ k ], silk_LTP_gain_BITS_Q5_ptrs[ k ],
+                    SUBFR_LENGTH, max_gain_Q7, silk_LTP_vq_sizes[ k ], arch ) );
+                if( ind_ref != ind_opt || res_nrg_ref != res_nrg_opt || rate_dist_ref != rate_dist_opt
+                    || gain_ref != gain_opt ) {
+                    fprintf( stderr, "**silk_VQ_WMat_EC() mismatch, loop %d codebook %d subframe %d**\n", count, k, j );
+                    return 1;
+                }
+            }
+        }
+    }
+    for( k = 0; k < 3; k++ ) {
+        printf( "  codebook %d, %2d vectors: C %6.3f s, optimized %6.3f s\n", k, silk_LTP_vq_sizes[ k ],
+            (double)time_c[ k ] / CLOCKS_PER_SEC, (double)time_arch[ k ] / CLOCKS_PER_SEC );
+    }
+    return 0;
+}
+
+int main(void) {
+    const int arch = opus_select_arch();
+    ALLOC_STACK;
+    srand(0);
+    printf("Testing silk_VQ_WMat_EC() optimization ...\n");
+    if( test_VQ_WMat_EC( arch ) ) {
+        return 1;
+    }
+    printf("silk_VQ_WMat_EC() optimization passed\n");
+    return 0;
+}
+
+#else
+
+int main(void) {
+    printf("silk_VQ_WMat_EC() optimization test needs FIXED_POINT, skipped\n");
+    return 0;
+}
+
+#endif
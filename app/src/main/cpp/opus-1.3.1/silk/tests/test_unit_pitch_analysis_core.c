@@ -0,0 +1,223 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "celt/stack_alloc.h"
+#include "cpu_support.h"
+#include "SigProc_FIX.h"
+
+#ifdef FIXED_POINT
+
+#include "fixed/pitch_analysis_core_FIX.h"
+
+#define MIN_LAG_8KHZ    ( PE_MIN_LAG_MS * 8 )
+#define MAX_LAG_8KHZ    ( PE_MAX_LAG_MS * 8 - 1 )
+#define CSTRIDE_8KHZ    ( MAX_LAG_8KHZ + 3 - ( MIN_LAG_8KHZ - 2 ) )
+#define SF_LENGTH_8KHZ  ( PE_SUBFR_LENGTH_MS * 8 )
+
+/* Time spent in the C and the selected implementation of each stage */
+static clock_t time_c[ 3 ], time_arch[ 3 ];
+
+#define TIMED( t, call ) do { clock_t start_ = clock(); call; ( t ) += clock() - start_; } while( 0 )
+
+/* Padding in front of the frames, the kernels never read it but it keeps */
+/* an out of range lag from going unnoticed by memory checkers            */
+#define GUARD           64
+
+static void fill_signal( opus_int16 *x, int len, int shift )
+{
+    int i;
+    for( i = 0; i < len; i++ ) {
+        x[ i ] = (opus_int16)( ( rand() & 0xFFFF ) - 32768 ) >> shift;
+    }
+}
+
+/* Pulse train with noise, so the encoder path reaches stage 3 */
+static void fill_voiced( opus_int16 *x, int len, int period, int shift )
+{
+    int i;
+    for( i = 0; i < len; i++ ) {
+        opus_int32 v = ( ( rand() & 0x3FF ) - 512 ) + ( i % period < 3 ? 20000 : 0 );
+        x[ i ] = (opus_int16)silk_SAT16( v >> shift );
+    }
+}
+
+static int test_corr_st2( int arch )
+{
+    opus_int16 buf[ GUARD + PE_MAX_FRAME_LENGTH_ST_2 ];
+    opus_int16 C_ref[ CSTRIDE_8KHZ ], C_opt[ CSTRIDE_8KHZ ];
+    opus_int16 d_comp[ CSTRIDE_8KHZ ];
+    const opus_int16 *target_ptr;
+    int count, shift, k, length_d_comp, d;
+
+    for( count = 0; count < 2000; count++ ) {
+        shift = 4 + count % 12;
+        fill_signal( buf, GUARD + PE_MAX_FRAME_LENGTH_ST_2, shift );
+        /* Random sorted subset of the lags, including odd lengths */
+        length_d_comp = 0;
+        for( d = MIN_LAG_8KHZ - 2; d <= MAX_LAG_8KHZ + 2; d++ ) {
+            if( rand() % 4 == 0 ) {
+                d_comp[ length_d_comp++ ] = d;
+            }
+        }
+        for( k = 0; k < PE_MAX_NB_SUBFR; k++ ) {
+            target_ptr = &buf[ GUARD + PE_LTP_MEM_LENGTH_MS * 8 + k * SF_LENGTH_8KHZ ];
+            memset( C_ref, 0, sizeof( C_ref ) );
+            memset( C_opt, 0, sizeof( C_opt ) );
+            TIMED( time_c[ 0 ], silk_P_Ana_calc_corr_st2_c( C_ref, target_ptr, d_comp, length_d_comp, MIN_LAG_8KHZ - 2, SF_LENGTH_8KHZ, 0 ) );
+            TIMED( time_arch[ 0 ], silk_P_Ana_calc_corr_st2( C_opt, target_ptr, d_comp, length_d_comp, MIN_LAG_8KHZ - 2, SF_LENGTH_8KHZ, arch ) );
+            if( memcmp( C_ref, C_opt, sizeof( C_ref ) ) ) {
+                fprintf( stderr, "**silk_P_Ana_calc_corr_st2() mismatch, loop %d subframe %d**\n", count, k );
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int test_st3( int arch )
+{
+    opus_int16 buf[ GUARD + PE_MAX_FRAME_LENGTH ];
+    silk_pe_stage3_vals ref[ PE_MAX_NB_SUBFR * PE_NB_CBKS_STAGE3_MAX ];
+    silk_pe_stage3_vals opt[ PE_MAX_NB_SUBFR * PE_NB_CBKS_STAGE3_MAX ];
+    static const int fs_kHz[ 3 ] = { 8, 12, 16 };
+    int count, fs, nb_subfr, complexity, sf_length, start_lag, frame_length;
+
+    for( count = 0; count < 500; count++ ) {
+        for( fs = 0; fs < 3; fs++ ) {
+            for( nb_subfr = 2; nb_subfr <= PE_MAX_NB_SUBFR; nb_subfr += 2 ) {
+                for( complexity = SILK_PE_MIN_COMPLEX; complexity <= SILK_PE_MAX_COMPLEX; complexity++ ) {
+                    sf_length = PE_SUBFR_LENGTH_MS * fs_kHz[ fs ];
+                    frame_length = ( PE_LTP_MEM_LENGTH_MS + nb_subfr * PE_SUBFR_LENGTH_MS ) * fs_kHz[ fs ];
+                    start_lag = PE_MIN_LAG_MS * fs_kHz[ fs ]
+                        + rand() % ( ( PE_MAX_LAG_MS - PE_MIN_LAG_MS ) * fs_kHz[ fs ] );
+                    fill_signal( buf, GUARD + frame_length, 4 + count % 12 );
+
+                    memset( ref, 0, sizeof( ref ) );
+                    memset( opt, 0, sizeof( opt ) );
+                    TIMED( time_c[ 1 ], silk_P_Ana_calc_corr_st3_c( ref, &buf[ GUARD ], start_lag, sf_length, nb_subfr, complexity, 0 ) );
+                    TIMED( time_arch[ 1 ], silk_P_Ana_calc_corr_st3( opt, &buf[ GUARD ], start_lag, sf_length, nb_subfr, complexity, arch ) );
+                    if( memcmp( ref, opt, sizeof( ref ) ) ) {
+                        fprintf( stderr, "**silk_P_Ana_calc_corr_st3() mismatch, loop %d fs %d nb_subfr %d complexity %d**\n",
+                            count, fs_kHz[ fs ], nb_subfr, complexity );
+                        return 1;
+                    }
+
+                    memset( ref, 0, sizeof( ref ) );
+                    memset( opt, 0, sizeof( opt ) );
+                    TIMED( time_c[ 2 ], silk_P_Ana_calc_energy_st3_c( ref, &buf[ GUARD ], start_lag, sf_length, nb_subfr, complexity, 0 ) );
+                    TIMED( time_arch[ 2 ], silk_P_Ana_calc_energy_st3( opt, &buf[ GUARD ], start_lag, sf_length, nb_subfr, complexity, arch ) );
+                    if( memcmp( ref, opt, sizeof( ref ) ) ) {
+                        fprintf( stderr, "**silk_P_Ana_calc_energy_st3() mismatch, loop %d fs %d nb_subfr %d complexity %d**\n",
+                            count, fs_kHz[ fs ], nb_subfr, complexity );
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/* Runs the whole pitch analysis on voiced frames with arch 0 and with the */
+/* selected arch, the outputs must match and the time per frame is printed */
+static int test_pitch_analysis_core( int arch )
+{
+    opus_int16 frame[ PE_MAX_FRAME_LENGTH ];
+    opus_int   pitch_ref[ PE_MAX_NB_SUBFR ], pitch_opt[ PE_MAX_NB_SUBFR ];
+    opus_int16 lag_ref, lag_opt;
+    opus_int8  contour_ref, contour_opt;
+    opus_int   corr_ref, corr_opt, voiced_ref, voiced_opt;
+    static const int fs_kHz[ 3 ] = { 8, 12, 16 };
+    clock_t    time_ref = 0, time_opt = 0;
+    int count, fs, complexity, frame_length, frames = 0;
+
+    for( count = 0; count < 200; count++ ) {
+        for( fs = 0; fs < 3; fs++ ) {
+            for( complexity = SILK_PE_MIN_COMPLEX; complexity <= SILK_PE_MAX_COMPLEX; complexity++ ) {
+                frame_length = PE_MAX_FRAME_LENGTH_MS * fs_kHz[ fs ];
+                fill_voiced( frame, frame_length, PE_MIN_LAG_MS * fs_kHz[ fs ] + count % 100, count % 4 );
+
+                corr_ref = corr_opt = 0;
+                TIMED( time_ref, voiced_ref = silk_pitch_analysis_core( frame, pitch_ref, &lag_ref, &contour_ref, &corr_ref, 0,
+                    SILK_FIX_CONST( 0.6, 16 ), SILK_FIX_CONST( 0.3, 13 ), fs_kHz[ fs ], complexity, PE_MAX_NB_SUBFR, 0 ) );
+                TIMED( time_opt, voiced_opt = silk_pitch_analysis_core( frame, pitch_opt, &lag_opt, &contour_opt, &corr_opt, 0,
+                    SILK_FIX_CONST( 0.6, 16 ), SILK_FIX_CONST( 0.3, 13 ), fs_kHz[ fs ], complexity, PE_MAX_NB_SUBFR, arch ) );
+                frames++;
+
+                if( voiced_ref != voiced_opt || corr_ref != corr_opt || lag_ref != lag_opt || contour_ref != contour_opt
+                    || ( voiced_ref == 0 && memcmp( pitch_ref, pitch_opt, sizeof( pitch_ref ) ) ) ) {
+                    fprintf( stderr, "**silk_pitch_analysis_core() mismatch, loop %d fs %d complexity %d**\n",
+                        count, fs_kHz[ fs ], complexity );
+                    return 1;
+                }
+            }
+        }
+    }
+    printf( "silk_pitch_analysis_core(): %.2f us/frame with arch 0, %.2f us/frame with arch %d\n",
+        1e6 * time_ref / CLOCKS_PER_SEC / frames, 1e6 * time_opt / CLOCKS_PER_SEC / frames, arch );
+    return 0;
+}
+
+static void print_stage( const char *name, int stage )
+{
+    printf( "  %-28s C %6.3f s, optimized %6.3f s\n", name,
+        (double)time_c[ stage ] / CLOCKS_PER_SEC, (double)time_arch[ stage ] / CLOCKS_PER_SEC );
+}
+
+int main(void) {
+    const int arch = opus_select_arch();
+    ALLOC_STACK;
+
+    srand(0);
+
+    printf("Testing silk_pitch_analysis_core() optimization ...\n");
+    if( test_corr_st2( arch ) || test_st3( arch ) || test_pitch_analysis_core( arch ) ) {
+        return 1;
+    }
+    print_stage( "silk_P_Ana_calc_corr_st2()", 0 );
+    print_stage( "silk_P_Ana_calc_corr_st3()", 1 );
+    print_stage( "silk_P_Ana_calc_energy_st3()", 2 );
+    printf("silk_pitch_analysis_core() optimization passed\n");
+    return 0;
+}
+
+#else
+
+int main(void) {
+    printf("silk_pitch_analysis_core() optimization test needs FIXED_POINT, skipped\n");
+    return 0;
+}
+
+#endif
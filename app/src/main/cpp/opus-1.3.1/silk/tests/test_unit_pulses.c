@@ -0,0 +1,520 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* Checks that the pulse coding in encode_pulses.c, decode_pulses.c and shell_coder.c writes and */
+/* reads the same bitstream as the original code of Opus 1.3.1, kept below, and prints the time   */
+/* spent by both                                                                                  */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "celt/stack_alloc.h"
+#include "main.h"
+#include "tables.h"
+
+#define LOOPS           20000
+#define MAX_BYTES       1275
+
+#define TIMED( t, call ) do { clock_t start_ = clock(); call; ( t ) += clock() - start_; } while( 0 )
+
+/*************************************************/
+/* Reference: the original code of Opus 1.3.1    */
+/*************************************************/
+
+static OPUS_INLINE void ref_combine_pulses( opus_int *out, const opus_int *in, const opus_int len )
+{
+    opus_int k;
+    for( k = 0; k < len; k++ ) {
+        out[ k ] = in[ 2 * k ] + in[ 2 * k + 1 ];
+    }
+}
+
+static OPUS_INLINE void ref_encode_split( ec_enc *psRangeEnc, const opus_int p_child1, const opus_int p,
+    const opus_uint8 *shell_table )
+{
+    if( p > 0 ) {
+        ec_enc_icdf( psRangeEnc, p_child1, &shell_table[ silk_shell_code_table_offsets[ p ] ], 8 );
+    }
+}
+
+static OPUS_INLINE void ref_decode_split( opus_int16 *p_child1, opus_int16 *p_child2, ec_dec *psRangeDec,
+    const opus_int p, const opus_uint8 *shell_table )
+{
+    if( p > 0 ) {
+        p_child1[ 0 ] = ec_dec_icdf( psRangeDec, &shell_table[ silk_shell_code_table_offsets[ p ] ], 8 );
+        p_child2[ 0 ] = p - p_child1[ 0 ];
+    } else {
+        p_child1[ 0 ] = 0;
+        p_child2[ 0 ] = 0;
+    }
+}
+
+static void ref_shell_encoder( ec_enc *psRangeEnc, const opus_int *pulses0 )
+{
+    opus_int pulses1[ 8 ], pulses2[ 4 ], pulses3[ 2 ], pulses4[ 1 ];
+
+    ref_combine_pulses( pulses1, pulses0, 8 );
+    ref_combine_pulses( pulses2, pulses1, 4 );
+    ref_combine_pulses( pulses3, pulses2, 2 );
+    ref_combine_pulses( pulses4, pulses3, 1 );
+
+    ref_encode_split( psRangeEnc, pulses3[  0 ], pulses4[ 0 ], silk_shell_code_table3 );
+
+    ref_encode_split( psRangeEnc, pulses2[  0 ], pulses3[ 0 ], silk_shell_code_table2 );
+
+    ref_encode_split( psRangeEnc, pulses1[  0 ], pulses2[ 0 ], silk_shell_code_table1 );
+    ref_encode_split( psRangeEnc, pulses0[  0 ], pulses1[ 0 ], silk_shell_code_table0 );
+    ref_encode_split( psRangeEnc, pulses0[  2 ], pulses1[ 1 ], silk_shell_code_table0 );
+
+    ref_encode_split( psRangeEnc, pulses1[  2 ], pulses2[ 1 ], silk_shell_code_table1 );
+    ref_encode_split( psRangeEnc, pulses0[  4 ], pulses1[ 2 ], silk_shell_code_table0 );
+    ref_encode_split( psRangeEnc, pulses0[  6 ], pulses1[ 3 ], silk_shell_code_table0 );
+
+    ref_encode_split( psRangeEnc, pulses2[  2 ], pulses3[ 1 ], silk_shell_code_table2 );
+
+    ref_encode_split( psRangeEnc, pulses1[  4 ], pulses2[ 2 ], silk_shell_code_table1 );
+    ref_encode_split( psRangeEnc, pulses0[  8 ], pulses1[ 4 ], silk_shell_code_table0 );
+    ref_encode_split( psRangeEnc, pulses0[ 10 ], pulses1[ 5 ], silk_shell_code_table0 );
+
+    ref_encode_split( psRangeEnc, pulses1[  6 ], pulses2[ 3 ], silk_shell_code_table1 );
+    ref_encode_split( psRangeEnc, pulses0[ 12 ], pulses1[ 6 ], silk_shell_code_table0 );
+    ref_encode_split( psRangeEnc, pulses0[ 14 ], pulses1[ 7 ], silk_shell_code_table0 );
+}
+
+static void ref_shell_decoder( opus_int16 *pulses0, ec_dec *psRangeDec, const opus_int pulses4 )
+{
+    opus_int16 pulses3[ 2 ], pulses2[ 4 ], pulses1[ 8 ];
+
+    ref_decode_split( &pulses3[  0 ], &pulses3[  1 ], psRangeDec, pulses4,      silk_shell_code_table3 );
+
+    ref_decode_split( &pulses2[  0 ], &pulses2[  1 ], psRangeDec, pulses3[ 0 ], silk_shell_code_table2 );
+
+    ref_decode_split( &pulses1[  0 ], &pulses1[  1 ], psRangeDec, pulses2[ 0 ], silk_shell_code_table1 );
+    ref_decode_split( &pulses0[  0 ], &pulses0[  1 ], psRangeDec, pulses1[ 0 ], silk_shell_code_table0 );
+    ref_decode_split( &pulses0[  2 ], &pulses0[  3 ], psRangeDec, pulses1[ 1 ], silk_shell_code_table0 );
+
+    ref_decode_split( &pulses1[  2 ], &pulses1[  3 ], psRangeDec, pulses2[ 1 ], silk_shell_code_table1 );
+    ref_decode_split( &pulses0[  4 ], &pulses0[  5 ], psRangeDec, pulses1[ 2 ], silk_shell_code_table0 );
+    ref_decode_split( &pulses0[  6 ], &pulses0[  7 ], psRangeDec, pulses1[ 3 ], silk_shell_code_table0 );
+
+    ref_decode_split( &pulses2[  2 ], &pulses2[  3 ], psRangeDec, pulses3[ 1 ], silk_shell_code_table2 );
+
+    ref_decode_split( &pulses1[  4 ], &pulses1[  5 ], psRangeDec, pulses2[ 2 ], silk_shell_code_table1 );
+    ref_decode_split( &pulses0[  8 ], &pulses0[  9 ], psRangeDec, pulses1[ 4 ], silk_shell_code_table0 );
+    ref_decode_split( &pulses0[ 10 ], &pulses0[ 11 ], psRangeDec, pulses1[ 5 ], silk_shell_code_table0 );
+
+    ref_decode_split( &pulses1[  6 ], &pulses1[  7 ], psRangeDec, pulses2[ 3 ], silk_shell_code_table1 );
+    ref_decode_split( &pulses0[ 12 ], &pulses0[ 13 ], psRangeDec, pulses1[ 6 ], silk_shell_code_table0 );
+    ref_decode_split( &pulses0[ 14 ], &pulses0[ 15 ], psRangeDec, pulses1[ 7 ], silk_shell_code_table0 );
+}
+
+#define ref_enc_map(a)                  ( silk_RSHIFT( (a), 15 ) + 1 )
+#define ref_dec_map(a)                  ( silk_LSHIFT( (a),  1 ) - 1 )
+
+static void ref_encode_signs( ec_enc *psRangeEnc, const opus_int8 pulses[], opus_int length,
+    const opus_int signalType, const opus_int quantOffsetType, const opus_int sum_pulses[ MAX_NB_SHELL_BLOCKS ] )
+{
+    opus_int         i, j, p;
+    opus_uint8       icdf[ 2 ];
+    const opus_int8  *q_ptr;
+    const opus_uint8 *icdf_ptr;
+
+    icdf[ 1 ] = 0;
+    q_ptr = pulses;
+    i = silk_SMULBB( 7, silk_ADD_LSHIFT( quantOffsetType, signalType, 1 ) );
+    icdf_ptr = &silk_sign_iCDF[ i ];
+    length = silk_RSHIFT( length + SHELL_CODEC_FRAME_LENGTH/2, LOG2_SHELL_CODEC_FRAME_LENGTH );
+    for( i = 0; i < length; i++ ) {
+        p = sum_pulses[ i ];
+        if( p > 0 ) {
+            icdf[ 0 ] = icdf_ptr[ silk_min( p & 0x1F, 6 ) ];
+            for( j = 0; j < SHELL_CODEC_FRAME_LENGTH; j++ ) {
+                if( q_ptr[ j ] != 0 ) {
+                    ec_enc_icdf( psRangeEnc, ref_enc_map( q_ptr[ j ]), icdf, 8 );
+                }
+            }
+        }
+        q_ptr += SHELL_CODEC_FRAME_LENGTH;
+    }
+}
+
+static void ref_decode_signs( ec_dec *psRangeDec, opus_int16 pulses[], opus_int length,
+    const opus_int signalType, const opus_int quantOffsetType, const opus_int sum_pulses[ MAX_NB_SHELL_BLOCKS ] )
+{
+    opus_int         i, j, p;
+    opus_uint8       icdf[ 2 ];
+    opus_int16       *q_ptr;
+    const opus_uint8 *icdf_ptr;
+
+    icdf[ 1 ] = 0;
+    q_ptr = pulses;
+    i = silk_SMULBB( 7, silk_ADD_LSHIFT( quantOffsetType, signalType, 1 ) );
+    icdf_ptr = &silk_sign_iCDF[ i ];
+    length = silk_RSHIFT( length + SHELL_CODEC_FRAME_LENGTH/2, LOG2_SHELL_CODEC_FRAME_LENGTH );
+    for( i = 0; i < length; i++ ) {
+        p = sum_pulses[ i ];
+        if( p > 0 ) {
+            icdf[ 0 ] = icdf_ptr[ silk_min( p & 0x1F, 6 ) ];
+            for( j = 0; j < SHELL_CODEC_FRAME_LENGTH; j++ ) {
+                if( q_ptr[ j ] > 0 ) {
+                    q_ptr[ j ] *= ref_dec_map( ec_dec_icdf( psRangeDec, icdf, 8 ) );
+                }
+            }
+        }
+        q_ptr += SHELL_CODEC_FRAME_LENGTH;
+    }
+}
+
+static OPUS_INLINE opus_int ref_combine_and_check( opus_int *pulses_comb, const opus_int *pulses_in,
+    opus_int max_pulses, opus_int len )
+{
+    opus_int k, sum;
+
+    for( k = 0; k < len; k++ ) {
+        sum = pulses_in[ 2 * k ] + pulses_in[ 2 * k + 1 ];
+        if( sum > max_pulses ) {
+            return 1;
+        }
+        pulses_comb[ k ] = sum;
+    }
+
+    return 0;
+}
+
+static void ref_encode_pulses( ec_enc *psRangeEnc, const opus_int signalType, const opus_int quantOffsetType,
+    opus_int8 pulses[], const opus_int frame_length )
+{
+    opus_int   i, k, j, iter, bit, nLS, scale_down, RateLevelIndex = 0;
+    opus_int32 abs_q, minSumBits_Q5, sumBits_Q5;
+    opus_int   abs_pulses[ MAX_FRAME_LENGTH + SHELL_CODEC_FRAME_LENGTH ];
+    opus_int   sum_pulses[ MAX_NB_SHELL_BLOCKS + 1 ];
+    opus_int   nRshifts[ MAX_NB_SHELL_BLOCKS + 1 ];
+    opus_int   pulses_comb[ 8 ];
+    opus_int   *abs_pulses_ptr;
+    const opus_int8 *pulses_ptr;
+    const opus_uint8 *cdf_ptr;
+    const opus_uint8 *nBits_ptr;
+
+    silk_memset( pulses_comb, 0, 8 * sizeof( opus_int ) );
+
+    iter = silk_RSHIFT( frame_length, LOG2_SHELL_CODEC_FRAME_LENGTH );
+    if( iter * SHELL_CODEC_FRAME_LENGTH < frame_length ) {
+        iter++;
+        silk_memset( &pulses[ frame_length ], 0, SHELL_CODEC_FRAME_LENGTH * sizeof(opus_int8));
+    }
+
+    for( i = 0; i < iter * SHELL_CODEC_FRAME_LENGTH; i+=4 ) {
+        abs_pulses[i+0] = ( opus_int )silk_abs( pulses[ i + 0 ] );
+        abs_pulses[i+1] = ( opus_int )silk_abs( pulses[ i + 1 ] );
+        abs_pulses[i+2] = ( opus_int )silk_abs( pulses[ i + 2 ] );
+        abs_pulses[i+3] = ( opus_int )silk_abs( pulses[ i + 3 ] );
+    }
+
+    abs_pulses_ptr = abs_pulses;
+    for( i = 0; i < iter; i++ ) {
+        nRshifts[ i ] = 0;
+
+        while( 1 ) {
+            scale_down = ref_combine_and_check( pulses_comb, abs_pulses_ptr, silk_max_pulses_table[ 0 ], 8 );
+            scale_down += ref_combine_and_check( pulses_comb, pulses_comb, silk_max_pulses_table[ 1 ], 4 );
+            scale_down += ref_combine_and_check( pulses_comb, pulses_comb, silk_max_pulses_table[ 2 ], 2 );
+            scale_down += ref_combine_and_check( &sum_pulses[ i ], pulses_comb, silk_max_pulses_table[ 3 ], 1 );
+
+            if( scale_down ) {
+                nRshifts[ i ]++;
+                for( k = 0; k < SHELL_CODEC_FRAME_LENGTH; k++ ) {
+                    abs_pulses_ptr[ k ] = silk_RSHIFT( abs_pulses_ptr[ k ], 1 );
+                }
+            } else {
+                break;
+            }
+        }
+        abs_pulses_ptr += SHELL_CODEC_FRAME_LENGTH;
+    }
+
+    minSumBits_Q5 = silk_int32_MAX;
+    for( k = 0; k < N_RATE_LEVELS - 1; k++ ) {
+        nBits_ptr  = silk_pulses_per_block_BITS_Q5[ k ];
+        sumBits_Q5 = silk_rate_levels_BITS_Q5[ signalType >> 1 ][ k ];
+        for( i = 0; i < iter; i++ ) {
+            if( nRshifts[ i ] > 0 ) {
+                sumBits_Q5 += nBits_ptr[ SILK_MAX_PULSES + 1 ];
+            } else {
+                sumBits_Q5 += nBits_ptr[ sum_pulses[ i ] ];
+            }
+        }
+        if( sumBits_Q5 < minSumBits_Q5 ) {
+            minSumBits_Q5 = sumBits_Q5;
+            RateLevelIndex = k;
+        }
+    }
+    ec_enc_icdf( psRangeEnc, RateLevelIndex, silk_rate_levels_iCDF[ signalType >> 1 ], 8 );
+
+    cdf_ptr = silk_pulses_per_block_iCDF[ RateLevelIndex ];
+    for( i = 0; i < iter; i++ ) {
+        if( nRshifts[ i ] == 0 ) {
+            ec_enc_icdf( psRangeEnc, sum_pulses[ i ], cdf_ptr, 8 );
+        } else {
+            ec_enc_icdf( psRangeEnc, SILK_MAX_PULSES + 1, cdf_ptr, 8 );
+            for( k = 0; k < nRshifts[ i ] - 1; k++ ) {
+                ec_enc_icdf( psRangeEnc, SILK_MAX_PULSES + 1, silk_pulses_per_block_iCDF[ N_RATE_LEVELS - 1 ], 8 );
+            }
+            ec_enc_icdf( psRangeEnc, sum_pulses[ i ], silk_pulses_per_block_iCDF[ N_RATE_LEVELS - 1 ], 8 );
+        }
+    }
+
+    for( i = 0; i < iter; i++ ) {
+        if( sum_pulses[ i ] > 0 ) {
+            ref_shell_encoder( psRangeEnc, &abs_pulses[ i * SHELL_CODEC_FRAME_LENGTH ] );
+        }
+    }
+
+    for( i = 0; i < iter; i++ ) {
+        if( nRshifts[ i ] > 0 ) {
+            pulses_ptr = &pulses[ i * SHELL_CODEC_FRAME_LENGTH ];
+            nLS = nRshifts[ i ] - 1;
+            for( k = 0; k < SHELL_CODEC_FRAME_LENGTH; k++ ) {
+                abs_q = (opus_int8)silk_abs( pulses_ptr[ k ] );
+                for( j = nLS; j > 0; j-- ) {
+                    bit = silk_RSHIFT( abs_q, j ) & 1;
+                    ec_enc_icdf( psRangeEnc, bit, silk_lsb_iCDF, 8 );
+                }
+                bit = abs_q & 1;
+                ec_enc_icdf( psRangeEnc, bit, silk_lsb_iCDF, 8 );
+            }
+        }
+    }
+
+    ref_encode_signs( psRangeEnc, pulses, frame_length, signalType, quantOffsetType, sum_pulses );
+}
+
+static void ref_decode_pulses( ec_dec *psRangeDec, opus_int16 pulses[], const opus_int signalType,
+    const opus_int quantOffsetType, const opus_int frame_length )
+{
+    opus_int   i, j, k, iter, abs_q, nLS, RateLevelIndex;
+    opus_int   sum_pulses[ MAX_NB_SHELL_BLOCKS ], nLshifts[ MAX_NB_SHELL_BLOCKS ];
+    opus_int16 *pulses_ptr;
+    const opus_uint8 *cdf_ptr;
+
+    RateLevelIndex = ec_dec_icdf( psRangeDec, silk_rate_levels_iCDF[ signalType >> 1 ], 8 );
+
+    iter = silk_RSHIFT( frame_length, LOG2_SHELL_CODEC_FRAME_LENGTH );
+    if( iter * SHELL_CODEC_FRAME_LENGTH < frame_length ) {
+        iter++;
+    }
+
+    cdf_ptr = silk_pulses_per_block_iCDF[ RateLevelIndex ];
+    for( i = 0; i < iter; i++ ) {
+        nLshifts[ i ] = 0;
+        sum_pulses[ i ] = ec_dec_icdf( psRangeDec, cdf_ptr, 8 );
+
+        while( sum_pulses[ i ] == SILK_MAX_PULSES + 1 ) {
+            nLshifts[ i ]++;
+            sum_pulses[ i ] = ec_dec_icdf( psRangeDec,
+                    silk_pulses_per_block_iCDF[ N_RATE_LEVELS - 1] + ( nLshifts[ i ] == 10 ), 8 );
+        }
+    }
+
+    for( i = 0; i < iter; i++ ) {
+        if( sum_pulses[ i ] > 0 ) {
+            ref_shell_decoder( &pulses[ silk_SMULBB( i, SHELL_CODEC_FRAME_LENGTH ) ], psRangeDec, sum_pulses[ i ] );
+        } else {
+            silk_memset( &pulses[ silk_SMULBB( i, SHELL_CODEC_FRAME_LENGTH ) ], 0, SHELL_CODEC_FRAME_LENGTH * sizeof( pulses[0] ) );
+        }
+    }
+
+    for( i = 0; i < iter; i++ ) {
+        if( nLshifts[ i ] > 0 ) {
+            nLS = nLshifts[ i ];
+            pulses_ptr = &pulses[ silk_SMULBB( i, SHELL_CODEC_FRAME_LENGTH ) ];
+            for( k = 0; k < SHELL_CODEC_FRAME_LENGTH; k++ ) {
+                abs_q = pulses_ptr[ k ];
+                for( j = 0; j < nLS; j++ ) {
+                    abs_q = silk_LSHIFT( abs_q, 1 );
+                    abs_q += ec_dec_icdf( psRangeDec, silk_lsb_iCDF, 8 );
+                }
+                pulses_ptr[ k ] = abs_q;
+            }
+            sum_pulses[ i ] |= nLS << 5;
+        }
+    }
+
+    ref_decode_signs( psRangeDec, pulses, frame_length, signalType, quantOffsetType, sum_pulses );
+}
+
+/*************************************************/
+/* Test                                          */
+/*************************************************/
+
+/* Pulses like the noise shaping quantizer's: mostly small, Laplacian-like, with a block scale that */
+/* is silent now and then and large enough to need the LSB coding once in a while                  */
+static void random_pulses( opus_int8 pulses[], opus_int frame_length )
+{
+    static const double scales[ 8 ] = { 0, .15, .3, .5, .8, 1.2, 2.5, 12 };
+    opus_int i, k;
+    for( i = 0; i < frame_length; i += SHELL_CODEC_FRAME_LENGTH ) {
+        double scale = scales[ rand() % 8 ];
+        if( scale > 10 && rand() % 4 ) {
+            scale = .5;
+        }
+        for( k = i; k < i + SHELL_CODEC_FRAME_LENGTH && k < frame_length; k++ ) {
+            double u = ( rand() + 1. ) / ( RAND_MAX + 2. );
+            opus_int a = scale > 0 ? (opus_int)floor( -scale * log( u ) ) : 0;
+            a = silk_min( a, 127 );
+            pulses[ k ] = (opus_int8)( rand() & 1 ? a : -a );
+        }
+    }
+}
+
+typedef struct {
+    opus_int8  pulses[ MAX_FRAME_LENGTH + SHELL_CODEC_FRAME_LENGTH ];
+    opus_int   frame_length;
+    opus_int   signalType;
+    opus_int   quantOffsetType;
+} test_frame;
+
+static opus_int32 encode_frames( unsigned char *buf, opus_int32 *ends, const test_frame *frames, opus_int nb_frames,
+    int optimized )
+{
+    opus_int8 pulses[ MAX_FRAME_LENGTH + SHELL_CODEC_FRAME_LENGTH ];
+    opus_int32 bytes = 0;
+    opus_int  k;
+    for( k = 0; k < nb_frames; k++ ) {
+        ec_enc enc;
+        memcpy( pulses, frames[ k ].pulses, sizeof( pulses ) );
+        ec_enc_init( &enc, &buf[ bytes ], MAX_BYTES );
+        if( optimized ) {
+            silk_encode_pulses( &enc, frames[ k ].signalType, frames[ k ].quantOffsetType, pulses, frames[ k ].frame_length );
+        } else {
+            ref_encode_pulses( &enc, frames[ k ].signalType, frames[ k ].quantOffsetType, pulses, frames[ k ].frame_length );
+        }
+        ec_enc_done( &enc );
+        if( enc.error ) {
+            return -1;
+        }
+        bytes += ec_range_bytes( &enc );
+        ends[ k ] = bytes;
+    }
+    return bytes;
+}
+
+static void decode_frames( opus_int16 *decoded, const unsigned char *buf, const opus_int32 *ends,
+    const test_frame *frames, opus_int nb_frames, int optimized )
+{
+    opus_int k;
+    for( k = 0; k < nb_frames; k++ ) {
+        ec_dec     dec;
+        opus_int32 start = k > 0 ? ends[ k - 1 ] : 0;
+        ec_dec_init( &dec, (unsigned char *)&buf[ start ], ends[ k ] - start );
+        if( optimized ) {
+            silk_decode_pulses( &dec, &decoded[ k * MAX_FRAME_LENGTH ], frames[ k ].signalType,
+                frames[ k ].quantOffsetType, frames[ k ].frame_length );
+        } else {
+            ref_decode_pulses( &dec, &decoded[ k * MAX_FRAME_LENGTH ], frames[ k ].signalType,
+                frames[ k ].quantOffsetType, frames[ k ].frame_length );
+        }
+    }
+}
+
+static int test_pulses( void )
+{
+    static const opus_int frame_lengths[ 5 ] = { 80, 120, 160, 240, 320 };
+    test_frame    *frames;
+    opus_int32    *ends;
+    unsigned char *buf_ref, *buf_opt;
+    opus_int16    *decoded_ref, *decoded_opt;
+    clock_t       enc_ref = 0, enc_opt = 0, dec_ref = 0, dec_opt = 0;
+    opus_int32    bytes_ref, bytes_opt;
+    int           count, k, ret = 0;
+
+    frames = (test_frame *)malloc( LOOPS * sizeof( *frames ) );
+    ends = (opus_int32 *)malloc( LOOPS * sizeof( *ends ) );
+    buf_ref = (unsigned char *)malloc( LOOPS * MAX_BYTES );
+    buf_opt = (unsigned char *)malloc( LOOPS * MAX_BYTES );
+    decoded_ref = (opus_int16 *)malloc( LOOPS * MAX_FRAME_LENGTH * sizeof( opus_int16 ) );
+    decoded_opt = (opus_int16 *)malloc( LOOPS * MAX_FRAME_LENGTH * sizeof( opus_int16 ) );
+
+    for( count = 0; count < LOOPS; count++ ) {
+        frames[ count ].frame_length = frame_lengths[ count % 5 ];
+        frames[ count ].signalType = rand() % 3;
+        frames[ count ].quantOffsetType = rand() & 1;
+        memset( frames[ count ].pulses, 0, sizeof( frames[ count ].pulses ) );
+        random_pulses( frames[ count ].pulses, frames[ count ].frame_length );
+    }
+
+    TIMED( enc_ref, bytes_ref = encode_frames( buf_ref, ends, frames, LOOPS, 0 ) );
+    TIMED( enc_opt, bytes_opt = encode_frames( buf_opt, ends, frames, LOOPS, 1 ) );
+    if( bytes_ref < 0 || bytes_ref != bytes_opt || memcmp( buf_ref, buf_opt, bytes_ref ) ) {
+        fprintf( stderr, "**silk_encode_pulses() mismatch**\n" );
+        ret = 1;
+        goto done;
+    }
+
+    TIMED( dec_ref, decode_frames( decoded_ref, buf_ref, ends, frames, LOOPS, 0 ) );
+    TIMED( dec_opt, decode_frames( decoded_opt, buf_ref, ends, frames, LOOPS, 1 ) );
+    for( count = 0; count < LOOPS; count++ ) {
+        for( k = 0; k < frames[ count ].frame_length; k++ ) {
+            if( decoded_ref[ count * MAX_FRAME_LENGTH + k ] != frames[ count ].pulses[ k ] ||
+                decoded_opt[ count * MAX_FRAME_LENGTH + k ] != frames[ count ].pulses[ k ] ) {
+                fprintf( stderr, "**silk_decode_pulses() mismatch, frame %d, sample %d**\n", count, k );
+                ret = 1;
+                goto done;
+            }
+        }
+    }
+
+    printf( "  %d frames, %.1f bytes per frame\n", LOOPS, (double)bytes_ref / LOOPS );
+    printf( "  encode: original %6.3f s, optimized %6.3f s\n",
+        (double)enc_ref / CLOCKS_PER_SEC, (double)enc_opt / CLOCKS_PER_SEC );
+    printf( "  decode: original %6.3f s, optimized %6.3f s\n",
+        (double)dec_ref / CLOCKS_PER_SEC, (double)dec_opt / CLOCKS_PER_SEC );
+
+done:
+    free( frames );
+    free( ends );
+    free( buf_ref );
+    free( buf_opt );
+    free( decoded_ref );
+    free( decoded_opt );
+    return ret;
+}
+
+int main(void) {
+    srand(0);
+    printf("Testing SILK pulse coding ...\n");
+    if( test_pulses() ) {
+        return 1;
+    }
+    printf("SILK pulse coding passed\n");
+    return 0;
+}
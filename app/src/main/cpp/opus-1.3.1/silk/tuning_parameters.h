@@ -142,6 +142,15 @@ extern "C"
 #define LAMBDA_CODING_QUALITY                           -0.2f
 #define LAMBDA_QUANT_OFFSET                             0.8f
 
+/* CBR rate control: bits per sample per doubling of the gains assumed until measured (high-rate rule), in Q8 */
+#define GAIN_PRED_SLOPE_DEFAULT_Q8                      256
+
+/* CBR rate control: predicted gain steps aim this many bits below the budget, mid-way into the accepted range */
+#define GAIN_PRED_TARGET_MARGIN_BITS                    3
+
+/* CBR rate control: smallest predicted gain step in Q7 log2 units, a bit over half a gain quantization step */
+#define GAIN_PRED_MIN_STEP_Q7                           16
+
 /* Compensation in bitrate calculations for 10 ms modes */
 #define REDUCE_BITRATE_10_MS_BPS                        2200
 
@@ -0,0 +1,106 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#include <smmintrin.h>
+
+#include "main.h"
+
+/* Weighted error of one codebook vector, see silk_NLSF_VQ_c(). The differences */
+/* are formed in 16 bits, which is what silk_SMULBB() keeps of them anyway, and */
+/* the absolute predictive errors are summed in any order since none overflow.  */
+static OPUS_INLINE opus_int32 silk_NLSF_VQ_err_sse4_1(
+    const opus_int16            in_Q15[],                       /* I    Input vector [LPC_order]                    */
+    const opus_uint8            cb_Q8[],                        /* I    Codebook vector [LPC_order]                 */
+    const opus_int16            w_Q9[],                         /* I    Codebook weights [LPC_order]                */
+    const opus_int              LPC_order                       /* I    Number of LPCs, 10 or 16                    */
+)
+{
+    __m128i diffw_Q24[ MAX_LPC_ORDER / 4 + 1 ];
+    __m128i diff_Q15, w, lo, hi, pred_Q24, sum_error_Q24;
+    opus_int m, k, nvec;
+
+    for( m = 0; m < ( LPC_order & ~7 ); m += 8 ) {
+        diff_Q15 = _mm_sub_epi16( _mm_loadu_si128( (const __m128i *)&in_Q15[ m ] ),
+                                  _mm_slli_epi16( _mm_cvtepu8_epi16( _mm_loadl_epi64( (const __m128i *)&cb_Q8[ m ] ) ), 7 ) );
+        w  = _mm_loadu_si128( (const __m128i *)&w_Q9[ m ] );
+        lo = _mm_mullo_epi16( diff_Q15, w );
+        hi = _mm_mulhi_epi16( diff_Q15, w );
+        diffw_Q24[ m >> 2 ]       = _mm_unpacklo_epi16( lo, hi );
+        diffw_Q24[ ( m >> 2 ) + 1 ] = _mm_unpackhi_epi16( lo, hi );
+    }
+    if( LPC_order & 7 ) {
+        /* The last two coefficients of a 10th order vector */
+        diffw_Q24[ m >> 2 ] = _mm_setr_epi32(
+            silk_SMULBB( silk_SUB_LSHIFT32( in_Q15[ m ], (opus_int32)cb_Q8[ m ], 7 ), w_Q9[ m ] ),
+            silk_SMULBB( silk_SUB_LSHIFT32( in_Q15[ m + 1 ], (opus_int32)cb_Q8[ m + 1 ], 7 ), w_Q9[ m + 1 ] ), 0, 0 );
+    }
+    nvec = ( LPC_order + 3 ) >> 2;
+    diffw_Q24[ nvec ] = _mm_setzero_si128();
+
+    /* Each error is predicted from the weighted difference of the next coefficient */
+    sum_error_Q24 = _mm_setzero_si128();
+    for( k = 0; k < nvec; k++ ) {
+        pred_Q24 = _mm_alignr_epi8( diffw_Q24[ k + 1 ], diffw_Q24[ k ], 4 );
+        sum_error_Q24 = _mm_add_epi32( sum_error_Q24,
+            _mm_abs_epi32( _mm_sub_epi32( diffw_Q24[ k ], _mm_srai_epi32( pred_Q24, 1 ) ) ) );
+    }
+    sum_error_Q24 = _mm_add_epi32( sum_error_Q24, _mm_shuffle_epi32( sum_error_Q24, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    sum_error_Q24 = _mm_add_epi32( sum_error_Q24, _mm_shuffle_epi32( sum_error_Q24, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    return _mm_cvtsi128_si32( sum_error_Q24 );
+}
+
+/* Compute quantization errors for an LPC_order element input vector for a VQ codebook */
+void silk_NLSF_VQ_sse4_1(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
+    const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
+    const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
+    const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
+    const opus_int              K,                              /* I    Number of codebook vectors                  */
+    const opus_int              LPC_order                       /* I    Number of LPCs                              */
+)
+{
+    opus_int i;
+
+    /* The codebooks are 10th order for NB/MB and 16th order for WB */
+    if( LPC_order == 16 ) {
+        for( i = 0; i < K; i++ ) {
+            err_Q24[ i ] = silk_NLSF_VQ_err_sse4_1( in_Q15, &pCB_Q8[ i * 16 ], &pWght_Q9[ i * 16 ], 16 );
+        }
+    } else if( LPC_order == 10 ) {
+        for( i = 0; i < K; i++ ) {
+            err_Q24[ i ] = silk_NLSF_VQ_err_sse4_1( in_Q15, &pCB_Q8[ i * 10 ], &pWght_Q9[ i * 10 ], 10 );
+        }
+    } else {
+        silk_NLSF_VQ_c( err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order );
+    }
+}
@@ -89,6 +89,77 @@ extern opus_int64 (*const SILK_INNER_PROD16_ALIGNED_64_IMPL[OPUS_ARCHMASK + 1])(
 #  define silk_inner_prod16_aligned_64(inVec1, inVec2, len, arch) \
     ((*SILK_INNER_PROD16_ALIGNED_64_IMPL[(arch) & OPUS_ARCHMASK])(inVec1, inVec2, len))
 
+#endif
+
+void silk_LPC_analysis_filter_sse4_1(
+    opus_int16                  *out,               /* O    Output signal                                               */
+    const opus_int16            *in,                /* I    Input signal                                                */
+    const opus_int16            *B,                 /* I    MA prediction coefficients, Q12 [order]                     */
+    const opus_int32            len,                /* I    Signal length                                               */
+    const opus_int32            d,                  /* I    Filter order                                                */
+    int                         arch                /* I    Run-time architecture                                       */
+);
+
+#if defined(OPUS_X86_PRESUME_SSE4_1)
+
+#define OVERRIDE_silk_LPC_analysis_filter
+#define silk_LPC_analysis_filter(out, in, B, len, d, arch) \
+    ((void)(arch), silk_LPC_analysis_filter_sse4_1(out, in, B, len, d, arch))
+
+#else
+
+extern void (*const SILK_LPC_ANALYSIS_FILTER_IMPL[OPUS_ARCHMASK + 1])(
+                    opus_int16       *out,
+                    const opus_int16 *in,
+                    const opus_int16 *B,
+                    const opus_int32 len,
+                    const opus_int32 d,
+                    int              arch);
+
+#define OVERRIDE_silk_LPC_analysis_filter
+#define silk_LPC_analysis_filter(out, in, B, len, d, arch) \
+    ((*SILK_LPC_ANALYSIS_FILTER_IMPL[(arch) & OPUS_ARCHMASK])(out, in, B, len, d, arch))
+
+#endif
+
+void silk_sum_sqr_shift_sse4_1(
+    opus_int32                  *energy,            /* O   Energy of x, after shifting to the right                     */
+    opus_int                    *shift,             /* O   Number of bits right shift applied to energy                 */
+    const opus_int16            *x,                 /* I   Input vector                                                 */
+    opus_int                    len                 /* I   Length of input vector                                       */
+);
+
+opus_int32 silk_inner_prod_aligned_scale_sse4_1(
+    const opus_int16 *const     inVec1,             /*    I input vector 1                                              */
+    const opus_int16 *const     inVec2,             /*    I input vector 2                                              */
+    const opus_int              scale,              /*    I number of bits to shift                                     */
+    const opus_int              len                 /*    I vector lengths                                              */
+);
+
+#if defined(FIXED_POINT)
+void silk_scale_copy_vector16_sse4_1(
+    opus_int16                  *data_out,
+    const opus_int16            *data_in,
+    opus_int32                  gain_Q16,           /* I    Gain in Q16                                                 */
+    const opus_int              dataSize            /* I    Length                                                      */
+);
+#endif
+
+/* These have no arch argument and are called from places that don't have one, */
+/* so they can only switch to SSE4.1 when the build presumes it.               */
+#if defined(OPUS_X86_PRESUME_SSE4_1)
+
+#define OVERRIDE_silk_sum_sqr_shift
+#define silk_sum_sqr_shift(energy, shift, x, len) silk_sum_sqr_shift_sse4_1(energy, shift, x, len)
+
+#define OVERRIDE_silk_inner_prod_aligned_scale
+#define silk_inner_prod_aligned_scale(inVec1, inVec2, scale, len) silk_inner_prod_aligned_scale_sse4_1(inVec1, inVec2, scale, len)
+
+#if defined(FIXED_POINT)
+#define OVERRIDE_silk_scale_copy_vector16
+#define silk_scale_copy_vector16(data_out, data_in, gain_Q16, dataSize) silk_scale_copy_vector16_sse4_1(data_out, data_in, gain_Q16, dataSize)
+#endif
+
 #endif
 #endif
 #endif
@@ -0,0 +1,187 @@
+/***********************************************************************
+Copyright (c) 2026 The Dicio contributors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include "SigProc_FIX.h"
+#include "celt/x86/x86cpu.h"
+
+/* Sum of ( x[ i ]^2 + x[ i + 1 ]^2 ) >> shft over the pairs of x, wrapping like the */
+/* unsigned sum in silk_sum_sqr_shift_c(). PMADDWD gives the pair sums, which       */
+/* only overflow for two -32768 samples and then still have the right bit pattern. */
+static OPUS_INLINE opus_uint32 silk_sum_sqr_shift_pass_sse4_1(
+    opus_uint32                 nrg,
+    const opus_int16            *x,
+    opus_int                    len,
+    opus_int                    shft
+)
+{
+    opus_int   i;
+    opus_uint32 nrg_tmp;
+    __m128i    acc, xmm_x, xmm_shift;
+
+    acc = _mm_setzero_si128();
+    xmm_shift = _mm_cvtsi32_si128( shft );
+    for( i = 0; i < len - 7; i += 8 ) {
+        xmm_x = _mm_loadu_si128( (const __m128i *)&x[ i ] );
+        acc = _mm_add_epi32( acc, _mm_srl_epi32( _mm_madd_epi16( xmm_x, xmm_x ), xmm_shift ) );
+    }
+    acc = _mm_add_epi32( acc, _mm_shuffle_epi32( acc, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    acc = _mm_add_epi32( acc, _mm_shuffle_epi32( acc, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    nrg += (opus_uint32)_mm_cvtsi128_si32( acc );
+
+    for( ; i < len - 1; i += 2 ) {
+        nrg_tmp = silk_SMULBB( x[ i ], x[ i ] );
+        nrg_tmp = silk_SMLABB_ovflw( nrg_tmp, x[ i + 1 ], x[ i + 1 ] );
+        nrg = silk_ADD_RSHIFT_uint( nrg, nrg_tmp, shft );
+    }
+    if( i < len ) {
+        nrg_tmp = silk_SMULBB( x[ i ], x[ i ] );
+        nrg = silk_ADD_RSHIFT_uint( nrg, nrg_tmp, shft );
+    }
+    return nrg;
+}
+
+void silk_sum_sqr_shift_sse4_1(
+    opus_int32                  *energy,            /* O   Energy of x, after shifting to the right                     */
+    opus_int                    *shift,             /* O   Number of bits right shift applied to energy                 */
+    const opus_int16            *x,                 /* I   Input vector                                                 */
+    opus_int                    len                 /* I   Length of input vector                                       */
+)
+{
+    opus_int   shft;
+    opus_int32 nrg;
+
+    /* Same two passes as silk_sum_sqr_shift_c() */
+    shft = 31 - silk_CLZ32( len );
+    nrg = (opus_int32)silk_sum_sqr_shift_pass_sse4_1( len, x, len, shft );
+    silk_assert( nrg >= 0 );
+    shft = silk_max_32( 0, shft + 3 - silk_CLZ32( nrg ) );
+    nrg = (opus_int32)silk_sum_sqr_shift_pass_sse4_1( 0, x, len, shft );
+    silk_assert( nrg >= 0 );
+
+    *shift  = shft;
+    *energy = nrg;
+}
+
+opus_int32 silk_inner_prod_aligned_scale_sse4_1(
+    const opus_int16 *const     inVec1,             /*    I input vector 1                                              */
+    const opus_int16 *const     inVec2,             /*    I input vector 2                                              */
+    const opus_int              scale,              /*    I number of bits to shift                                     */
+    const opus_int              len                 /*    I vector lengths                                              */
+)
+{
+    opus_int   i;
+    opus_int32 sum;
+    __m128i    acc, xmm_a, xmm_b, prod_lo, prod_hi, xmm_scale;
+
+    acc = _mm_setzero_si128();
+    xmm_scale = _mm_cvtsi32_si128( scale );
+    for( i = 0; i < len - 7; i += 8 ) {
+        xmm_a = _mm_loadu_si128( (const __m128i *)&inVec1[ i ] );
+        xmm_b = _mm_loadu_si128( (const __m128i *)&inVec2[ i ] );
+        /* Each product is shifted on its own, so PMADDWD can't be used */
+        prod_lo = _mm_mullo_epi16( xmm_a, xmm_b );
+        prod_hi = _mm_mulhi_epi16( xmm_a, xmm_b );
+        acc = _mm_add_epi32( acc, _mm_sra_epi32( _mm_unpacklo_epi16( prod_lo, prod_hi ), xmm_scale ) );
+        acc = _mm_add_epi32( acc, _mm_sra_epi32( _mm_unpackhi_epi16( prod_lo, prod_hi ), xmm_scale ) );
+    }
+    acc = _mm_add_epi32( acc, _mm_shuffle_epi32( acc, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    acc = _mm_add_epi32( acc, _mm_shuffle_epi32( acc, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    sum = _mm_cvtsi128_si32( acc );
+
+    for( ; i < len; i++ ) {
+        sum = silk_ADD_RSHIFT32( sum, silk_SMULBB( inVec1[ i ], inVec2[ i ] ), scale );
+    }
+    return sum;
+}
+
+/* Eight outputs at a time. The taps are taken in pairs, with the two delayed inputs */
+/* interleaved for PMADDWD. The prediction wraps like the _ovflw macros of the C     */
+/* version, and PACKSSDW saturates like silk_SAT16().                                 */
+void silk_LPC_analysis_filter_sse4_1(
+    opus_int16                  *out,               /* O    Output signal                                               */
+    const opus_int16            *in,                /* I    Input signal                                                */
+    const opus_int16            *B,                 /* I    MA prediction coefficients, Q12 [order]                     */
+    const opus_int32            len,                /* I    Signal length                                               */
+    const opus_int32            d,                  /* I    Filter order                                                */
+    int                         arch                /* I    Run-time architecture                                       */
+)
+{
+    opus_int   ix, j;
+    opus_int32 out32_Q12, out32;
+    const opus_int16 *in_ptr;
+    __m128i    coef[ SILK_MAX_ORDER_LPC / 2 ];
+    __m128i    acc_lo, acc_hi, xmm_x0, xmm_x1, xmm_in;
+
+    (void)arch;
+    celt_assert( d >= 6 );
+    celt_assert( (d & 1) == 0 );
+    celt_assert( d <= len );
+    celt_assert( d <= SILK_MAX_ORDER_LPC );
+
+    for( j = 0; j < d; j += 2 ) {
+        coef[ j >> 1 ] = _mm_set1_epi32( (opus_int32)( (opus_uint32)(opus_uint16)B[ j ] | ( (opus_uint32)(opus_uint16)B[ j + 1 ] << 16 ) ) );
+    }
+
+    for( ix = d; ix < len - 7; ix += 8 ) {
+        acc_lo = _mm_setzero_si128();
+        acc_hi = _mm_setzero_si128();
+        for( j = 0; j < d; j += 2 ) {
+            xmm_x0 = _mm_loadu_si128( (const __m128i *)&in[ ix - 1 - j ] );
+            xmm_x1 = _mm_loadu_si128( (const __m128i *)&in[ ix - 2 - j ] );
+            acc_lo = _mm_add_epi32( acc_lo, _mm_madd_epi16( _mm_unpacklo_epi16( xmm_x0, xmm_x1 ), coef[ j >> 1 ] ) );
+            acc_hi = _mm_add_epi32( acc_hi, _mm_madd_epi16( _mm_unpackhi_epi16( xmm_x0, xmm_x1 ), coef[ j >> 1 ] ) );
+        }
+        xmm_in = _mm_loadu_si128( (const __m128i *)&in[ ix ] );
+        acc_lo = _mm_sub_epi32( _mm_slli_epi32( _mm_cvtepi16_epi32( xmm_in ), 12 ), acc_lo );
+        acc_hi = _mm_sub_epi32( _mm_slli_epi32( _mm_cvtepi16_epi32( _mm_unpackhi_epi64( xmm_in, xmm_in ) ), 12 ), acc_hi );
+        /* silk_RSHIFT_ROUND( x, 12 ) */
+        acc_lo = _mm_srai_epi32( _mm_add_epi32( _mm_srai_epi32( acc_lo, 11 ), _mm_set1_epi32( 1 ) ), 1 );
+        acc_hi = _mm_srai_epi32( _mm_add_epi32( _mm_srai_epi32( acc_hi, 11 ), _mm_set1_epi32( 1 ) ), 1 );
+        _mm_storeu_si128( (__m128i *)&out[ ix ], _mm_packs_epi32( acc_lo, acc_hi ) );
+    }
+
+    for( ; ix < len; ix++ ) {
+        in_ptr = &in[ ix - 1 ];
+        out32_Q12 = silk_SMULBB( in_ptr[ 0 ], B[ 0 ] );
+        for( j = 1; j < d; j++ ) {
+            out32_Q12 = silk_SMLABB_ovflw( out32_Q12, in_ptr[ -j ], B[ j ] );
+        }
+        out32_Q12 = silk_SUB32_ovflw( silk_LSHIFT( (opus_int32)in_ptr[ 1 ], 12 ), out32_Q12 );
+        out32 = silk_RSHIFT_ROUND( out32_Q12, 12 );
+        out[ ix ] = (opus_int16)silk_SAT16( out32 );
+    }
+
+    /* Set first d output samples to zero */
+    silk_memset( out, 0, d * sizeof( opus_int16 ) );
+}
@@ -223,6 +223,36 @@ void silk_VAD_GetNoiseLevels(
     silk_VAD_state              *psSilk_VAD         /* I/O  Pointer to Silk VAD state                   */
 );
 
+#  define OVERRIDE_silk_NLSF_VQ
+
+void silk_NLSF_VQ_sse4_1(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
+    const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
+    const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
+    const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
+    const opus_int              K,                              /* I    Number of codebook vectors                  */
+    const opus_int              LPC_order                       /* I    Number of LPCs                              */
+);
+
+#if defined(OPUS_X86_PRESUME_SSE4_1)
+#define silk_NLSF_VQ(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order, arch) \
+    ((void)(arch),silk_NLSF_VQ_sse4_1(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order))
+
+#else
+
+extern void (*const SILK_NLSF_VQ_IMPL[OPUS_ARCHMASK + 1])(
+    opus_int32                  err_Q24[],
+    const opus_int16            in_Q15[],
+    const opus_uint8            pCB_Q8[],
+    const opus_int16            pWght_Q9[],
+    const opus_int              K,
+    const opus_int              LPC_order);
+
+#  define silk_NLSF_VQ(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order, arch) \
+    ((*SILK_NLSF_VQ_IMPL[(arch) & OPUS_ARCHMASK])(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order))
+
+#endif
+
 #  define OVERRIDE_silk_VAD_GetSA_Q8
 
 opus_int silk_VAD_GetSA_Q8_sse4_1(
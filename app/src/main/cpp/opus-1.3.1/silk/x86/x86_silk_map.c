@@ -50,11 +50,44 @@ opus_int64 (*const SILK_INNER_PROD16_ALIGNED_64_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_inner_prod16_aligned_64_c,
   silk_inner_prod16_aligned_64_c,
   MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 )  /* avx */
+  MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 ), /* avx */
+  MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 )  /* avx2 */
 };
 
 #endif
 
+void (*const SILK_NLSF_VQ_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int32                  err_Q24[],          /* O    Quantization errors [K]                                     */
+    const opus_int16            in_Q15[],           /* I    Input vectors to be quantized [LPC_order]                   */
+    const opus_uint8            pCB_Q8[],           /* I    Codebook vectors [K*LPC_order]                              */
+    const opus_int16            pWght_Q9[],         /* I    Codebook weights [K*LPC_order]                              */
+    const opus_int              K,                  /* I    Number of codebook vectors                                  */
+    const opus_int              LPC_order           /* I    Number of LPCs                                              */
+) = {
+  silk_NLSF_VQ_c,                  /* non-sse */
+  silk_NLSF_VQ_c,
+  silk_NLSF_VQ_c,
+  MAY_HAVE_SSE4_1( silk_NLSF_VQ ), /* sse4.1 */
+  MAY_HAVE_SSE4_1( silk_NLSF_VQ ), /* avx */
+  MAY_HAVE_SSE4_1( silk_NLSF_VQ )  /* avx2 */
+};
+
+void (*const SILK_LPC_ANALYSIS_FILTER_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int16                  *out,               /* O    Output signal                                               */
+    const opus_int16            *in,                /* I    Input signal                                                */
+    const opus_int16            *B,                 /* I    MA prediction coefficients, Q12 [order]                     */
+    const opus_int32            len,                /* I    Signal length                                               */
+    const opus_int32            d,                  /* I    Filter order                                                */
+    int                         arch                /* I    Run-time architecture                                       */
+) = {
+  silk_LPC_analysis_filter_c,                  /* non-sse */
+  silk_LPC_analysis_filter_c,
+  silk_LPC_analysis_filter_c,
+  MAY_HAVE_SSE4_1( silk_LPC_analysis_filter ), /* sse4.1 */
+  MAY_HAVE_SSE4_1( silk_LPC_analysis_filter ), /* avx */
+  MAY_HAVE_SSE4_1( silk_LPC_analysis_filter )  /* avx2 */
+};
+
 opus_int (*const SILK_VAD_GETSA_Q8_IMPL[ OPUS_ARCHMASK + 1 ] )(
     silk_encoder_state *psEncC,
     const opus_int16   pIn[]
@@ -63,7 +96,8 @@ opus_int (*const SILK_VAD_GETSA_Q8_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_VAD_GetSA_Q8_c,
   silk_VAD_GetSA_Q8_c,
   MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 )  /* avx */
+  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 ), /* avx */
+  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 )  /* avx2 */
 };
 
 #if 0 /* FIXME: SSE disabled until the NSQ code gets updated. */
@@ -88,7 +122,8 @@ void (*const SILK_NSQ_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_NSQ_c,
   silk_NSQ_c,
   MAY_HAVE_SSE4_1( silk_NSQ ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_NSQ )  /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ ), /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ )  /* avx2 */
 };
 #endif
 
@@ -110,7 +145,8 @@ void (*const SILK_VQ_WMAT_EC_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_VQ_WMat_EC_c,
   silk_VQ_WMat_EC_c,
   MAY_HAVE_SSE4_1( silk_VQ_WMat_EC ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC )  /* avx */
+  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC ), /* avx */
+  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC )  /* avx2 */
 };
 #endif
 
@@ -136,7 +172,8 @@ void (*const SILK_NSQ_DEL_DEC_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_NSQ_del_dec_c,
   silk_NSQ_del_dec_c,
   MAY_HAVE_SSE4_1( silk_NSQ_del_dec ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_NSQ_del_dec )  /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ_del_dec ), /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ_del_dec )  /* avx2 */
 };
 #endif
 
@@ -157,8 +194,120 @@ void (*const SILK_BURG_MODIFIED_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_burg_modified_c,
   silk_burg_modified_c,
   MAY_HAVE_SSE4_1( silk_burg_modified ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_burg_modified )  /* avx */
+  MAY_HAVE_SSE4_1( silk_burg_modified ), /* avx */
+  MAY_HAVE_SSE4_1( silk_burg_modified )  /* avx2 */
 };
 
 #endif
 #endif
+
+#if defined(FIXED_POINT) && defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)
+
+#include "fixed/main_FIX.h"
+#include "fixed/pitch_analysis_core_FIX.h"
+
+void (*const SILK_P_ANA_CALC_CORR_ST2_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int16                  *C,                 /* O    normalized correlations                                     */
+    const opus_int16            *target_ptr,        /* I    subframe, lags index back from here                         */
+    const opus_int16            *d_comp,            /* I    lags to evaluate                                            */
+    opus_int                    length_d_comp,      /* I    number of lags                                              */
+    opus_int                    C_offset,           /* I    lag stored at C[ 0 ]                                        */
+    opus_int                    sf_length,          /* I    length of a 5 ms subframe                                   */
+    int                         arch                /* I    Run-time architecture                                       */
+) = {
+  silk_P_Ana_calc_corr_st2_c,                 /* non-sse */
+  silk_P_Ana_calc_corr_st2_c,
+  silk_P_Ana_calc_corr_st2_c,
+  silk_P_Ana_calc_corr_st2_c,                 /* sse4.1 */
+  silk_P_Ana_calc_corr_st2_c,                 /* avx */
+  MAY_HAVE_AVX2( silk_P_Ana_calc_corr_st2 )   /* avx2 */
+};
+
+void (*const SILK_P_ANA_CALC_CORR_ST3_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    silk_pe_stage3_vals         *cross_corr_st3,    /* O    3 DIM correlation array                                     */
+    const opus_int16            *frame,             /* I    vector to correlate                                         */
+    opus_int                    start_lag,          /* I    lag offset to search around                                 */
+    opus_int                    sf_length,          /* I    length of a 5 ms subframe                                   */
+    opus_int                    nb_subfr,           /* I    number of subframes                                         */
+    opus_int                    complexity,         /* I    Complexity setting                                          */
+    int                         arch                /* I    Run-time architecture                                       */
+) = {
+  silk_P_Ana_calc_corr_st3_c,                 /* non-sse */
+  silk_P_Ana_calc_corr_st3_c,
+  silk_P_Ana_calc_corr_st3_c,
+  silk_P_Ana_calc_corr_st3_c,                 /* sse4.1 */
+  silk_P_Ana_calc_corr_st3_c,                 /* avx */
+  MAY_HAVE_AVX2( silk_P_Ana_calc_corr_st3 )   /* avx2 */
+};
+
+void (*const SILK_P_ANA_CALC_ENERGY_ST3_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    silk_pe_stage3_vals         *energies_st3,      /* O    3 DIM energy array                                          */
+    const opus_int16            *frame,             /* I    vector to calc energy in                                    */
+    opus_int                    start_lag,          /* I    lag offset to search around                                 */
+    opus_int                    sf_length,          /* I    length of one 5 ms subframe                                 */
+    opus_int                    nb_subfr,           /* I    number of subframes                                         */
+    opus_int                    complexity,         /* I    Complexity setting                                          */
+    int                         arch                /* I    Run-time architecture                                       */
+) = {
+  silk_P_Ana_calc_energy_st3_c,               /* non-sse */
+  silk_P_Ana_calc_energy_st3_c,
+  silk_P_Ana_calc_energy_st3_c,
+  silk_P_Ana_calc_energy_st3_c,               /* sse4.1 */
+  silk_P_Ana_calc_energy_st3_c,               /* avx */
+  MAY_HAVE_AVX2( silk_P_Ana_calc_energy_st3 ) /* avx2 */
+};
+
+void (*const SILK_CORRVECTOR_FIX_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int16                *t,                                     /* I    Target vector [L]                                                           */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *Xt,                                    /* O    Pointer to X'*t correlation vector [order]                                  */
+    const opus_int                  rshifts,                                /* I    Right shifts of correlations                                                */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+) = {
+  silk_corrVector_FIX_c,               /* non-sse */
+  silk_corrVector_FIX_c,
+  silk_corrVector_FIX_c,
+  silk_corrVector_FIX_c,               /* sse4.1 */
+  silk_corrVector_FIX_c,               /* avx */
+  MAY_HAVE_AVX2( silk_corrVector_FIX ) /* avx2 */
+};
+
+void (*const SILK_CORRMATRIX_FIX_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    const opus_int16                *x,                                     /* I    x vector [L + order - 1] used to form data matrix X                         */
+    const opus_int                  L,                                      /* I    Length of vectors                                                           */
+    const opus_int                  order,                                  /* I    Max lag for correlation                                                     */
+    opus_int32                      *XX,                                    /* O    Pointer to X'*X correlation matrix [ order x order ]                        */
+    opus_int32                      *nrg,                                   /* O    Energy of x vector                                                          */
+    opus_int                        *rshifts,                               /* O    Right shifts of correlations and energy                                     */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+) = {
+  silk_corrMatrix_FIX_c,               /* non-sse */
+  silk_corrMatrix_FIX_c,
+  silk_corrMatrix_FIX_c,
+  silk_corrMatrix_FIX_c,               /* sse4.1 */
+  silk_corrMatrix_FIX_c,               /* avx */
+  MAY_HAVE_AVX2( silk_corrMatrix_FIX ) /* avx2 */
+};
+
+void (*const SILK_LTP_ANALYSIS_FILTER_FIX_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int16                      *LTP_res,                               /* O    LTP residual signal of length MAX_NB_SUBFR * ( pre_length + subfr_length )  */
+    const opus_int16                *x,                                     /* I    Pointer to input signal with at least max( pitchL ) preceding samples       */
+    const opus_int16                LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],/* I    LTP_ORDER LTP coefficients for each MAX_NB_SUBFR subframe                   */
+    const opus_int                  pitchL[ MAX_NB_SUBFR ],                 /* I    Pitch lag, one for each subframe                                            */
+    const opus_int32                invGains_Q16[ MAX_NB_SUBFR ],           /* I    Inverse quantization gains, one for each subframe                           */
+    const opus_int                  subfr_length,                           /* I    Length of each subframe                                                     */
+    const opus_int                  nb_subfr,                               /* I    Number of subframes                                                         */
+    const opus_int                  pre_length,                             /* I    Length of the preceding samples starting at &x[0] for each subframe         */
+    int                             arch                                    /* I    Run-time architecture                                                       */
+) = {
+  silk_LTP_analysis_filter_FIX_c,               /* non-sse */
+  silk_LTP_analysis_filter_FIX_c,
+  silk_LTP_analysis_filter_FIX_c,
+  silk_LTP_analysis_filter_FIX_c,               /* sse4.1 */
+  silk_LTP_analysis_filter_FIX_c,               /* avx */
+  MAY_HAVE_AVX2( silk_LTP_analysis_filter_FIX ) /* avx2 */
+};
+
+#endif
@@ -24,6 +24,9 @@ silk/SigProc_FIX.h \
 silk/x86/SigProc_FIX_sse.h \
 silk/arm/biquad_alt_arm.h \
 silk/arm/LPC_inv_pred_gain_arm.h \
+silk/arm/NLSF_VQ_arm.h \
+silk/arm/VQ_WMat_EC_arm.h \
+silk/arm/SigProc_FIX_arm.h \
 silk/arm/macros_armv4.h \
 silk/arm/macros_armv5e.h \
 silk/arm/macros_arm64.h \
@@ -33,7 +36,12 @@ silk/arm/NSQ_del_dec_arm.h \
 silk/arm/NSQ_neon.h \
 silk/fixed/main_FIX.h \
 silk/fixed/structs_FIX.h \
+silk/fixed/pitch_analysis_core_FIX.h \
+silk/fixed/arm/LTP_analysis_FIX_arm.h \
+silk/fixed/arm/pitch_analysis_core_FIX_arm.h \
 silk/fixed/arm/warped_autocorrelation_FIX_arm.h \
+silk/fixed/x86/LTP_analysis_FIX_x86.h \
+silk/fixed/x86/pitch_analysis_core_FIX_x86.h \
 silk/fixed/mips/noise_shape_analysis_FIX_mipsr1.h \
 silk/fixed/mips/warped_autocorrelation_FIX_mipsr1.h \
 silk/float/main_FLP.h \
@@ -82,14 +82,19 @@ silk/x86/NSQ_sse4_1.c \
 silk/x86/NSQ_del_dec_sse4_1.c \
 silk/x86/x86_silk_map.c \
 silk/x86/VAD_sse4_1.c \
-silk/x86/VQ_WMat_EC_sse4_1.c
+silk/x86/VQ_WMat_EC_sse4_1.c \
+silk/x86/NLSF_VQ_sse4_1.c \
+silk/x86/SigProc_FIX_sse4_1.c
 
 SILK_SOURCES_ARM_NEON_INTR = \
 silk/arm/arm_silk_map.c \
 silk/arm/biquad_alt_neon_intr.c \
 silk/arm/LPC_inv_pred_gain_neon_intr.c \
+silk/arm/NLSF_VQ_neon_intr.c \
 silk/arm/NSQ_del_dec_neon_intr.c \
-silk/arm/NSQ_neon.c
+silk/arm/NSQ_neon.c \
+silk/arm/VQ_WMat_EC_neon_intr.c \
+silk/arm/SigProc_FIX_neon_intr.c
 
 SILK_SOURCES_FIXED = \
 silk/fixed/LTP_analysis_filter_FIX.c \
@@ -120,8 +125,15 @@ SILK_SOURCES_FIXED_SSE4_1 = \
 silk/fixed/x86/vector_ops_FIX_sse4_1.c \
 silk/fixed/x86/burg_modified_FIX_sse4_1.c
 
+SILK_SOURCES_FIXED_AVX2 = \
+silk/fixed/x86/pitch_analysis_core_FIX_avx2.c \
+silk/fixed/x86/LTP_analysis_FIX_avx2.c
+
 SILK_SOURCES_FIXED_ARM_NEON_INTR = \
-silk/fixed/arm/warped_autocorrelation_FIX_neon_intr.c
+silk/fixed/arm/pitch_analysis_core_FIX_neon_intr.c \
+silk/fixed/arm/LTP_analysis_FIX_neon_intr.c \
+silk/fixed/arm/warped_autocorrelation_FIX_neon_intr.c \
+silk/fixed/arm/vector_ops_FIX_neon_intr.c
 
 SILK_SOURCES_FLOAT = \
 silk/float/apply_sine_window_FLP.c \
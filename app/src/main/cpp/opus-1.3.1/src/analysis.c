@@ -44,6 +44,12 @@
 #include "stack_alloc.h"
 #include "float_cast.h"
 
+#if defined(OVERRIDE_ANALYSIS_BINS) && defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(OVERRIDE_ANALYSIS_BINS) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #ifndef M_PI
 #define M_PI 3.141592653
 #endif
@@ -110,6 +116,8 @@ static const int tbands[NB_TBANDS+1] = {
 
 #define NB_TONAL_SKIP_BANDS 9
 
+#define TONALITY_SCALE (40.f*16.f*(float)(M_PI*M_PI*M_PI*M_PI))
+
 static opus_val32 silk_resampler_down2_hp(
     opus_val32                  *S,                 /* I/O  State vector [ 2 ]                                          */
     opus_val32                  *out,               /* O    Output signal [ floor(len/2) ]                              */
@@ -441,6 +449,268 @@ static int is_digital_silence32(const opus_val32* pcm, int frame_size, int chann
 #define is_digital_silence32(pcm, frame_size, channels, lsb_depth) is_digital_silence(pcm, frame_size, channels, lsb_depth)
 #endif
 
+/* Tonality from the phase of one bin of the two packed real FFTs: the second
+   derivative of the phase over time is close to an integer for a stationary
+   sinusoid. */
+static OPUS_INLINE void analysis_bin(const kiss_fft_cpx *out, int i, float *A, float *dA,
+      float *d2A, float *tonality, float *tonality2, float *noisiness)
+{
+   float X1r, X2r, X1i, X2i;
+   float angle, d_angle, d2_angle;
+   float angle2, d_angle2, d2_angle2;
+   float mod1, mod2, avg_mod;
+   X1r = (float)out[i].r+out[ANALYSIS_FFT_SIZE-i].r;
+   X1i = (float)out[i].i-out[ANALYSIS_FFT_SIZE-i].i;
+   X2r = (float)out[i].i+out[ANALYSIS_FFT_SIZE-i].i;
+   X2i = (float)out[ANALYSIS_FFT_SIZE-i].r-out[i].r;
+
+   angle = (float)(.5f/M_PI)*fast_atan2f(X1i, X1r);
+   d_angle = angle - A[i];
+   d2_angle = d_angle - dA[i];
+
+   angle2 = (float)(.5f/M_PI)*fast_atan2f(X2i, X2r);
+   d_angle2 = angle2 - angle;
+   d2_angle2 = d_angle2 - d_angle;
+
+   mod1 = d2_angle - (float)float2int(d2_angle);
+   noisiness[i] = ABS16(mod1);
+   mod1 *= mod1;
+   mod1 *= mod1;
+
+   mod2 = d2_angle2 - (float)float2int(d2_angle2);
+   noisiness[i] += ABS16(mod2);
+   mod2 *= mod2;
+   mod2 *= mod2;
+
+   avg_mod = .25f*(d2A[i]+mod1+2*mod2);
+   /* This introduces an extra delay of 2 frames in the detection. */
+   tonality[i] = 1.f/(1.f+TONALITY_SCALE*avg_mod)-.015f;
+   /* No delay on this detection, but it's less reliable. */
+   tonality2[i] = 1.f/(1.f+TONALITY_SCALE*mod2)-.015f;
+
+   A[i] = angle2;
+   dA[i] = d_angle2;
+   d2A[i] = mod2;
+}
+
+void analysis_bins_c(const kiss_fft_cpx *out, float *A, float *dA, float *d2A,
+      float *tonality, float *tonality2, float *noisiness)
+{
+   int i;
+   for (i=1;i<ANALYSIS_FFT_SIZE/2;i++)
+      analysis_bin(out, i, A, dA, d2A, tonality, tonality2, noisiness);
+}
+
+#if defined(OVERRIDE_ANALYSIS_BINS) && defined(__SSE2__)
+
+/* Same operations as fast_atan2f(), in the same order, with both branches
+   computed and the right one selected per lane. */
+static OPUS_INLINE __m128 fast_atan2f_sse2(__m128 y, __m128 x)
+{
+   const __m128 sign = _mm_set1_ps(-0.f);
+   const __m128 cA = _mm_set1_ps(0.43157974f);
+   const __m128 cB = _mm_set1_ps(0.67848403f);
+   const __m128 cC = _mm_set1_ps(0.08595542f);
+   const __m128 cE = _mm_set1_ps((float)PI/2);
+   __m128 x2, y2, xy, use_y, num, den, s1, s2, tiny, ret;
+   x2 = _mm_mul_ps(x, x);
+   y2 = _mm_mul_ps(y, y);
+   xy = _mm_mul_ps(x, y);
+   use_y = _mm_cmplt_ps(x2, y2);
+   num = _mm_or_ps(_mm_and_ps(use_y,
+         _mm_xor_ps(sign, _mm_mul_ps(xy, _mm_add_ps(y2, _mm_mul_ps(cA, x2))))),
+         _mm_andnot_ps(use_y, _mm_mul_ps(xy, _mm_add_ps(x2, _mm_mul_ps(cA, y2)))));
+   den = _mm_or_ps(_mm_and_ps(use_y,
+         _mm_mul_ps(_mm_add_ps(y2, _mm_mul_ps(cB, x2)), _mm_add_ps(y2, _mm_mul_ps(cC, x2)))),
+         _mm_andnot_ps(use_y,
+         _mm_mul_ps(_mm_add_ps(x2, _mm_mul_ps(cB, y2)), _mm_add_ps(x2, _mm_mul_ps(cC, y2)))));
+   s1 = _mm_xor_ps(cE, _mm_and_ps(sign, _mm_cmplt_ps(y, _mm_setzero_ps())));
+   s2 = _mm_xor_ps(cE, _mm_and_ps(sign, _mm_cmplt_ps(xy, _mm_setzero_ps())));
+   ret = _mm_sub_ps(_mm_add_ps(_mm_div_ps(num, den), s1), _mm_andnot_ps(use_y, s2));
+   tiny = _mm_cmplt_ps(_mm_add_ps(x2, y2), _mm_set1_ps(1e-18f));
+   return _mm_andnot_ps(tiny, ret);
+}
+
+/* Loads bins i..i+3 as real and imaginary vectors. */
+static OPUS_INLINE void load_bins_sse2(const kiss_fft_cpx *out, __m128 *re, __m128 *im)
+{
+#ifdef FIXED_POINT
+   __m128 a = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(const void *)&out[0]));
+   __m128 b = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(const void *)&out[2]));
+   *re = _mm_cvtepi32_ps(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))));
+   *im = _mm_cvtepi32_ps(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+#else
+   __m128 a = _mm_loadu_ps(&out[0].r);
+   __m128 b = _mm_loadu_ps(&out[2].r);
+   *re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+   *im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+#endif
+}
+
+void analysis_bins_sse2(const kiss_fft_cpx *out, float *A, float *dA, float *d2A,
+      float *tonality, float *tonality2, float *noisiness)
+{
+   int i;
+   const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+   const __m128 angle_scale = _mm_set1_ps((float)(.5f/M_PI));
+   const __m128 tonality_scale = _mm_set1_ps(TONALITY_SCALE);
+   const __m128 one = _mm_set1_ps(1.f);
+   const __m128 bias = _mm_set1_ps(.015f);
+   for (i=1;i<ANALYSIS_FFT_SIZE/2-3;i+=4)
+   {
+      __m128 r, im, rr, rim;
+      __m128 X1r, X1i, X2r, X2i;
+      __m128 angle, d_angle, d2_angle, angle2, d_angle2, d2_angle2;
+      __m128 mod1, mod2, avg_mod;
+      load_bins_sse2(&out[i], &r, &im);
+      /* Bins N-i..N-i-3, reversed so that they line up with i..i+3. */
+      load_bins_sse2(&out[ANALYSIS_FFT_SIZE-i-3], &rr, &rim);
+      rr = _mm_shuffle_ps(rr, rr, _MM_SHUFFLE(0, 1, 2, 3));
+      rim = _mm_shuffle_ps(rim, rim, _MM_SHUFFLE(0, 1, 2, 3));
+      X1r = _mm_add_ps(r, rr);
+      X1i = _mm_sub_ps(im, rim);
+      X2r = _mm_add_ps(im, rim);
+      X2i = _mm_sub_ps(rr, r);
+
+      angle = _mm_mul_ps(angle_scale, fast_atan2f_sse2(X1i, X1r));
+      d_angle = _mm_sub_ps(angle, _mm_loadu_ps(&A[i]));
+      d2_angle = _mm_sub_ps(d_angle, _mm_loadu_ps(&dA[i]));
+
+      angle2 = _mm_mul_ps(angle_scale, fast_atan2f_sse2(X2i, X2r));
+      d_angle2 = _mm_sub_ps(angle2, angle);
+      d2_angle2 = _mm_sub_ps(d_angle2, d_angle);
+
+      /* CVTPS2DQ rounds like float2int(). */
+      mod1 = _mm_sub_ps(d2_angle, _mm_cvtepi32_ps(_mm_cvtps_epi32(d2_angle)));
+      mod2 = _mm_sub_ps(d2_angle2, _mm_cvtepi32_ps(_mm_cvtps_epi32(d2_angle2)));
+      _mm_storeu_ps(&noisiness[i], _mm_add_ps(_mm_and_ps(abs_mask, mod1), _mm_and_ps(abs_mask, mod2)));
+      mod1 = _mm_mul_ps(mod1, mod1);
+      mod1 = _mm_mul_ps(mod1, mod1);
+      mod2 = _mm_mul_ps(mod2, mod2);
+      mod2 = _mm_mul_ps(mod2, mod2);
+
+      avg_mod = _mm_mul_ps(_mm_set1_ps(.25f),
+            _mm_add_ps(_mm_add_ps(_mm_loadu_ps(&d2A[i]), mod1), _mm_add_ps(mod2, mod2)));
+      _mm_storeu_ps(&tonality[i], _mm_sub_ps(_mm_div_ps(one,
+            _mm_add_ps(one, _mm_mul_ps(tonality_scale, avg_mod))), bias));
+      _mm_storeu_ps(&tonality2[i], _mm_sub_ps(_mm_div_ps(one,
+            _mm_add_ps(one, _mm_mul_ps(tonality_scale, mod2))), bias));
+
+      _mm_storeu_ps(&A[i], angle2);
+      _mm_storeu_ps(&dA[i], d_angle2);
+      _mm_storeu_ps(&d2A[i], mod2);
+   }
+   for (;i<ANALYSIS_FFT_SIZE/2;i++)
+      analysis_bin(out, i, A, dA, d2A, tonality, tonality2, noisiness);
+}
+
+#elif defined(OVERRIDE_ANALYSIS_BINS) && defined(__ARM_NEON)
+
+/* Same operations as fast_atan2f(), with both branches computed and the
+   right one selected per lane. The compiler may fuse some of the
+   multiply-adds, so this is not always bit-exact with the C version. */
+static OPUS_INLINE float32x4_t fast_atan2f_neon(float32x4_t y, float32x4_t x)
+{
+   const float32x4_t cA = vdupq_n_f32(0.43157974f);
+   const float32x4_t cB = vdupq_n_f32(0.67848403f);
+   const float32x4_t cC = vdupq_n_f32(0.08595542f);
+   const float32x4_t cE = vdupq_n_f32((float)PI/2);
+   const float32x4_t zero = vdupq_n_f32(0);
+   float32x4_t x2, y2, xy, num, den, s1, s2, ret;
+   uint32x4_t use_y, tiny;
+   x2 = vmulq_f32(x, x);
+   y2 = vmulq_f32(y, y);
+   xy = vmulq_f32(x, y);
+   use_y = vcltq_f32(x2, y2);
+   num = vbslq_f32(use_y, vnegq_f32(vmulq_f32(xy, vaddq_f32(y2, vmulq_f32(cA, x2)))),
+         vmulq_f32(xy, vaddq_f32(x2, vmulq_f32(cA, y2))));
+   den = vbslq_f32(use_y,
+         vmulq_f32(vaddq_f32(y2, vmulq_f32(cB, x2)), vaddq_f32(y2, vmulq_f32(cC, x2))),
+         vmulq_f32(vaddq_f32(x2, vmulq_f32(cB, y2)), vaddq_f32(x2, vmulq_f32(cC, y2))));
+   s1 = vbslq_f32(vcltq_f32(y, zero), vnegq_f32(cE), cE);
+   s2 = vbslq_f32(use_y, zero, vbslq_f32(vcltq_f32(xy, zero), vnegq_f32(cE), cE));
+   ret = vsubq_f32(vaddq_f32(vdivq_f32(num, den), s1), s2);
+   tiny = vcltq_f32(vaddq_f32(x2, y2), vdupq_n_f32(1e-18f));
+   return vbslq_f32(tiny, zero, ret);
+}
+
+/* Loads bins i..i+3 as real and imaginary vectors. */
+static OPUS_INLINE void load_bins_neon(const kiss_fft_cpx *out, float32x4_t *re, float32x4_t *im)
+{
+#ifdef FIXED_POINT
+   int32x4x2_t v = vld2q_s32(&out[0].r);
+   *re = vcvtq_f32_s32(v.val[0]);
+   *im = vcvtq_f32_s32(v.val[1]);
+#else
+   float32x4x2_t v = vld2q_f32(&out[0].r);
+   *re = v.val[0];
+   *im = v.val[1];
+#endif
+}
+
+static OPUS_INLINE float32x4_t reverse_neon(float32x4_t x)
+{
+   x = vrev64q_f32(x);
+   return vcombine_f32(vget_high_f32(x), vget_low_f32(x));
+}
+
+void analysis_bins_neon(const kiss_fft_cpx *out, float *A, float *dA, float *d2A,
+      float *tonality, float *tonality2, float *noisiness)
+{
+   int i;
+   const float32x4_t angle_scale = vdupq_n_f32((float)(.5f/M_PI));
+   const float32x4_t tonality_scale = vdupq_n_f32(TONALITY_SCALE);
+   const float32x4_t one = vdupq_n_f32(1.f);
+   const float32x4_t bias = vdupq_n_f32(.015f);
+   for (i=1;i<ANALYSIS_FFT_SIZE/2-3;i+=4)
+   {
+      float32x4_t r, im, rr, rim;
+      float32x4_t X1r, X1i, X2r, X2i;
+      float32x4_t angle, d_angle, d2_angle, angle2, d_angle2, d2_angle2;
+      float32x4_t mod1, mod2, avg_mod;
+      load_bins_neon(&out[i], &r, &im);
+      /* Bins N-i..N-i-3, reversed so that they line up with i..i+3. */
+      load_bins_neon(&out[ANALYSIS_FFT_SIZE-i-3], &rr, &rim);
+      rr = reverse_neon(rr);
+      rim = reverse_neon(rim);
+      X1r = vaddq_f32(r, rr);
+      X1i = vsubq_f32(im, rim);
+      X2r = vaddq_f32(im, rim);
+      X2i = vsubq_f32(rr, r);
+
+      angle = vmulq_f32(angle_scale, fast_atan2f_neon(X1i, X1r));
+      d_angle = vsubq_f32(angle, vld1q_f32(&A[i]));
+      d2_angle = vsubq_f32(d_angle, vld1q_f32(&dA[i]));
+
+      angle2 = vmulq_f32(angle_scale, fast_atan2f_neon(X2i, X2r));
+      d_angle2 = vsubq_f32(angle2, angle);
+      d2_angle2 = vsubq_f32(d_angle2, d_angle);
+
+      /* FCVTNS rounds to nearest even, like float2int(). */
+      mod1 = vsubq_f32(d2_angle, vcvtq_f32_s32(vcvtnq_s32_f32(d2_angle)));
+      mod2 = vsubq_f32(d2_angle2, vcvtq_f32_s32(vcvtnq_s32_f32(d2_angle2)));
+      vst1q_f32(&noisiness[i], vaddq_f32(vabsq_f32(mod1), vabsq_f32(mod2)));
+      mod1 = vmulq_f32(mod1, mod1);
+      mod1 = vmulq_f32(mod1, mod1);
+      mod2 = vmulq_f32(mod2, mod2);
+      mod2 = vmulq_f32(mod2, mod2);
+
+      avg_mod = vmulq_n_f32(vaddq_f32(vaddq_f32(vld1q_f32(&d2A[i]), mod1), vaddq_f32(mod2, mod2)), .25f);
+      vst1q_f32(&tonality[i], vsubq_f32(vdivq_f32(one,
+            vaddq_f32(one, vmulq_f32(tonality_scale, avg_mod))), bias));
+      vst1q_f32(&tonality2[i], vsubq_f32(vdivq_f32(one,
+            vaddq_f32(one, vmulq_f32(tonality_scale, mod2))), bias));
+
+      vst1q_f32(&A[i], angle2);
+      vst1q_f32(&dA[i], d_angle2);
+      vst1q_f32(&d2A[i], mod2);
+   }
+   for (;i<ANALYSIS_FFT_SIZE/2;i++)
+      analysis_bin(out, i, A, dA, d2A, tonality, tonality2, noisiness);
+}
+
+#endif
+
 static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt_mode, const void *x, int len, int offset, int c1, int c2, int C, int lsb_depth, downmix_func downmix)
 {
     int i, b;
@@ -461,7 +731,6 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
     float max_frame_tonality;
     /*float tw_sum=0;*/
     float frame_noisiness;
-    const float pi4 = (float)(M_PI*M_PI*M_PI*M_PI);
     float slope=0;
     float frame_stationarity;
     float relativeE;
@@ -566,45 +835,7 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
     }
 #endif
 
-    for (i=1;i<N2;i++)
-    {
-       float X1r, X2r, X1i, X2i;
-       float angle, d_angle, d2_angle;
-       float angle2, d_angle2, d2_angle2;
-       float mod1, mod2, avg_mod;
-       X1r = (float)out[i].r+out[N-i].r;
-       X1i = (float)out[i].i-out[N-i].i;
-       X2r = (float)out[i].i+out[N-i].i;
-       X2i = (float)out[N-i].r-out[i].r;
-
-       angle = (float)(.5f/M_PI)*fast_atan2f(X1i, X1r);
-       d_angle = angle - A[i];
-       d2_angle = d_angle - dA[i];
-
-       angle2 = (float)(.5f/M_PI)*fast_atan2f(X2i, X2r);
-       d_angle2 = angle2 - angle;
-       d2_angle2 = d_angle2 - d_angle;
-
-       mod1 = d2_angle - (float)float2int(d2_angle);
-       noisiness[i] = ABS16(mod1);
-       mod1 *= mod1;
-       mod1 *= mod1;
-
-       mod2 = d2_angle2 - (float)float2int(d2_angle2);
-       noisiness[i] += ABS16(mod2);
-       mod2 *= mod2;
-       mod2 *= mod2;
-
-       avg_mod = .25f*(d2A[i]+mod1+2*mod2);
-       /* This introduces an extra delay of 2 frames in the detection. */
-       tonality[i] = 1.f/(1.f+40.f*16.f*pi4*avg_mod)-.015f;
-       /* No delay on this detection, but it's less reliable. */
-       tonality2[i] = 1.f/(1.f+40.f*16.f*pi4*mod2)-.015f;
-
-       A[i] = angle2;
-       dA[i] = d_angle2;
-       d2A[i] = mod2;
-    }
+    analysis_bins(out, A, dA, d2A, tonality, tonality2, noisiness);
     for (i=2;i<N2-1;i++)
     {
        float tt = MIN32(tonality2[i], MAX32(tonality2[i-1], tonality2[i+1]));
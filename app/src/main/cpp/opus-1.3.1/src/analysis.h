@@ -31,6 +31,7 @@
 #include "celt.h"
 #include "opus_private.h"
 #include "mlp.h"
+#include "kiss_fft.h"
 
 #define NB_FRAMES 8
 #define NB_TBANDS 18
@@ -41,6 +42,9 @@
 
 #define DETECT_SIZE 100
 
+/* Two overlapping 240-sample real frames packed into one complex FFT */
+#define ANALYSIS_FFT_SIZE 480
+
 /* Uncomment this to print the MLP features on stdout. */
 /*#define MLP_TRAINING*/
 
@@ -96,6 +100,30 @@ void tonality_analysis_reset(TonalityAnalysisState *analysis);
 
 void tonality_get_info(TonalityAnalysisState *tonal, AnalysisInfo *info_out, int len);
 
+/** Updates the phase history and computes the per-bin tonality and noisiness
+ * for bins 1 to ANALYSIS_FFT_SIZE/2-1 of the packed analysis FFT.
+ */
+void analysis_bins_c(const kiss_fft_cpx *out, float *A, float *dA, float *d2A,
+      float *tonality, float *tonality2, float *noisiness);
+
+#if defined(__SSE2__)
+#define OVERRIDE_ANALYSIS_BINS
+void analysis_bins_sse2(const kiss_fft_cpx *out, float *A, float *dA, float *d2A,
+      float *tonality, float *tonality2, float *noisiness);
+#define analysis_bins(out, A, dA, d2A, tonality, tonality2, noisiness) \
+    analysis_bins_sse2(out, A, dA, d2A, tonality, tonality2, noisiness)
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+/* Needs the AArch64 vector divide and round-to-nearest conversion */
+#define OVERRIDE_ANALYSIS_BINS
+void analysis_bins_neon(const kiss_fft_cpx *out, float *A, float *dA, float *d2A,
+      float *tonality, float *tonality2, float *noisiness);
+#define analysis_bins(out, A, dA, d2A, tonality, tonality2, noisiness) \
+    analysis_bins_neon(out, A, dA, d2A, tonality, tonality2, noisiness)
+#else
+#define analysis_bins(out, A, dA, d2A, tonality, tonality2, noisiness) \
+    analysis_bins_c(out, A, dA, d2A, tonality, tonality2, noisiness)
+#endif
+
 void run_analysis(TonalityAnalysisState *analysis, const CELTMode *celt_mode, const void *analysis_pcm,
                  int analysis_frame_size, int frame_size, int c1, int c2, int C, opus_int32 Fs,
                  int lsb_depth, downmix_func downmix, AnalysisInfo *analysis_info);
@@ -950,6 +950,26 @@ int opus_decoder_ctl(OpusDecoder *st, int request, ...)
        ret = celt_decoder_ctl(celt_dec, OPUS_GET_PHASE_INVERSION_DISABLED(value));
    }
    break;
+   case CELT_GET_ALLOC_CACHE_HITS_REQUEST:
+   {
+      opus_uint32 *value = va_arg(ap, opus_uint32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      ret = celt_decoder_ctl(celt_dec, CELT_GET_ALLOC_CACHE_HITS(value));
+   }
+   break;
+   case CELT_GET_ALLOC_CACHE_MISSES_REQUEST:
+   {
+      opus_uint32 *value = va_arg(ap, opus_uint32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      ret = celt_decoder_ctl(celt_dec, CELT_GET_ALLOC_CACHE_MISSES(value));
+   }
+   break;
    default:
       /*fprintf(stderr, "unknown opus_decoder_ctl() request: %d", request);*/
       ret = OPUS_UNIMPLEMENTED;
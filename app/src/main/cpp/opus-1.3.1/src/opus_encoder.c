@@ -226,6 +226,7 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
     st->silk_mode.useDTX                    = 0;
     st->silk_mode.useCBR                    = 0;
     st->silk_mode.reducedDependency         = 0;
+    st->silk_mode.useGainPrediction         = 1;
 
     /* Create CELT encoder */
     /* Initialize CELT encoder */
@@ -270,7 +271,7 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
     return OPUS_OK;
 }
 
-static unsigned char gen_toc(int mode, int framerate, int bandwidth, int channels)
+unsigned char gen_toc(int mode, int framerate, int bandwidth, int channels)
 {
    int period;
    unsigned char toc;
@@ -342,7 +343,7 @@ static void silk_biquad_float(
 }
 #endif
 
-static void hp_cutoff(const opus_val16 *in, opus_int32 cutoff_Hz, opus_val16 *out, opus_val32 *hp_mem, int len, int channels, opus_int32 Fs, int arch)
+void hp_cutoff(const opus_val16 *in, opus_int32 cutoff_Hz, opus_val16 *out, opus_val32 *hp_mem, int len, int channels, opus_int32 Fs, int arch)
 {
    opus_int32 B_Q28[ 3 ], A_Q28[ 2 ];
    opus_int32 Fc_Q19, r_Q28, r_Q22;
@@ -2713,6 +2714,55 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             st->user_forced_mode = value;
         }
         break;
+        case OPUS_SET_VAD_STATE_REQUEST:
+        {
+            const OpusSilkVad *value = va_arg(ap, const OpusSilkVad*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            opus_silk_vad_copy_state(value, (char*)st+st->silk_enc_offset);
+        }
+        break;
+        case OPUS_SET_SILK_GAIN_PREDICTION_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if(value<0 || value>1)
+            {
+               goto bad_arg;
+            }
+            st->silk_mode.useGainPrediction = value;
+        }
+        break;
+        case OPUS_GET_SILK_GAIN_PREDICTION_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->silk_mode.useGainPrediction;
+        }
+        break;
+        case OPUS_GET_SILK_RATE_FRAMES_REQUEST:
+        case OPUS_GET_SILK_RATE_ITERATIONS_REQUEST:
+        case OPUS_GET_SILK_RATE_UNUSED_BITS_REQUEST:
+        {
+            silk_RateControlStats stats;
+            opus_uint32 *value = va_arg(ap, opus_uint32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            silk_GetRateControlStats((char*)st+st->silk_enc_offset, &stats);
+            if (request == OPUS_GET_SILK_RATE_FRAMES_REQUEST)
+               *value = stats.frames;
+            else if (request == OPUS_GET_SILK_RATE_ITERATIONS_REQUEST)
+               *value = stats.iterations;
+            else
+               *value = stats.unusedBits;
+        }
+        break;
         case OPUS_SET_LFE_REQUEST:
         {
             opus_int32 value = va_arg(ap, opus_int32);
@@ -2765,6 +2815,32 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
            ret = celt_encoder_ctl(celt_enc, CELT_GET_MODE(value));
         }
         break;
+        case CELT_GET_ALLOC_CACHE_HITS_REQUEST:
+        {
+           opus_uint32 *value = va_arg(ap, opus_uint32*);
+           if (!value)
+           {
+              goto bad_arg;
+           }
+           ret = celt_encoder_ctl(celt_enc, CELT_GET_ALLOC_CACHE_HITS(value));
+        }
+        break;
+        case CELT_GET_ALLOC_CACHE_MISSES_REQUEST:
+        {
+           opus_uint32 *value = va_arg(ap, opus_uint32*);
+           if (!value)
+           {
+              goto bad_arg;
+           }
+           ret = celt_encoder_ctl(celt_enc, CELT_GET_ALLOC_CACHE_MISSES(value));
+        }
+        break;
+        case CELT_SET_SINGLE_PASS_ENERGY_REQUEST:
+        {
+           opus_int32 value = va_arg(ap, opus_int32);
+           ret = celt_encoder_ctl(celt_enc, CELT_SET_SINGLE_PASS_ENERGY(value));
+        }
+        break;
         default:
             /* fprintf(stderr, "unknown opus_encoder_ctl() request: %d", request);*/
             ret = OPUS_UNIMPLEMENTED;
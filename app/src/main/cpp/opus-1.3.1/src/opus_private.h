@@ -31,6 +31,7 @@
 
 #include "arch.h"
 #include "opus.h"
+#include "opus_silk.h"
 #include "celt.h"
 
 #include <stdarg.h> /* va_list */
@@ -139,6 +140,14 @@ int is_digital_silence(const opus_val16* pcm, int frame_size, int channels, int
 
 int encode_size(int size, unsigned char *data);
 
+unsigned char gen_toc(int mode, int framerate, int bandwidth, int channels);
+
+/* Implements OPUS_SET_VAD_STATE for the SILK encoder state silk_enc */
+void opus_silk_vad_copy_state(const OpusSilkVad *vad, void *silk_enc);
+
+void hp_cutoff(const opus_val16 *in, opus_int32 cutoff_Hz, opus_val16 *out, opus_val32 *hp_mem,
+      int len, int channels, opus_int32 Fs, int arch);
+
 opus_int32 frame_size_select(opus_int32 frame_size, int variable_duration, opus_int32 Fs);
 
 opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_size,
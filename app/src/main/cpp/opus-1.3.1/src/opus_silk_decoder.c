@@ -0,0 +1,383 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+#include "opus_silk.h"
+#include "opus_private.h"
+#include "entdec.h"
+#include "API.h"
+#include "os_support.h"
+#include "cpu_support.h"
+
+struct OpusSilkDecoder {
+   int          silk_dec_offset;
+   int          channels;
+   opus_int32   Fs;
+   silk_DecControlStruct DecControl;
+   int          arch;
+
+   /* Everything beyond this point gets cleared on a reset */
+#define OPUS_SILK_DECODER_RESET_START stream_channels
+   int          stream_channels;
+   int          bandwidth;
+   int          prev_mode;
+   int          frame_size;
+   int          last_packet_duration;
+   opus_uint32  rangeFinal;
+};
+
+int opus_silk_decoder_get_size(int channels)
+{
+   int silkDecSizeBytes;
+   if (channels<1 || channels > 2)
+      return 0;
+   if (silk_Get_Decoder_Size(&silkDecSizeBytes))
+      return 0;
+   return align(sizeof(OpusSilkDecoder))+align(silkDecSizeBytes);
+}
+
+int opus_silk_decoder_init(OpusSilkDecoder *st, opus_int32 Fs, int channels)
+{
+   if ((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
+    || (channels!=1&&channels!=2))
+      return OPUS_BAD_ARG;
+
+   OPUS_CLEAR((char*)st, opus_silk_decoder_get_size(channels));
+   st->silk_dec_offset = align(sizeof(OpusSilkDecoder));
+   st->stream_channels = st->channels = channels;
+   st->Fs = Fs;
+   st->DecControl.API_sampleRate = Fs;
+   st->DecControl.nChannelsAPI = channels;
+
+   if (silk_InitDecoder((char*)st+st->silk_dec_offset))
+      return OPUS_INTERNAL_ERROR;
+
+   st->frame_size = Fs/400;
+   st->arch = opus_select_arch();
+   return OPUS_OK;
+}
+
+OpusSilkDecoder *opus_silk_decoder_create(opus_int32 Fs, int channels, int *error)
+{
+   int ret;
+   OpusSilkDecoder *st;
+   if ((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
+    || (channels!=1&&channels!=2))
+   {
+      if (error)
+         *error = OPUS_BAD_ARG;
+      return NULL;
+   }
+   st = (OpusSilkDecoder *)opus_alloc(opus_silk_decoder_get_size(channels));
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_silk_decoder_init(st, Fs, channels);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+/* The SILK-only part of opus_decode_frame(). The SILK output goes straight
+   to pcm, so the result is the same as opus_decode() for SILK-only streams. */
+static int opus_silk_decode_frame(OpusSilkDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_int16 *pcm, int frame_size, int decode_fec)
+{
+   void *silk_dec;
+   ec_dec dec;
+   opus_int32 silk_frame_size;
+   int i, audiosize, lost_flag, decoded_samples;
+   int F10, F20;
+
+   silk_dec = (char*)st+st->silk_dec_offset;
+   F20 = st->Fs/50;
+   F10 = F20>>1;
+   frame_size = IMIN(frame_size, st->Fs/25*3);
+   /* Payloads of 1 (2 including ToC) or 0 trigger the PLC/DTX */
+   if (len<=1)
+   {
+      data = NULL;
+      /* In that case, don't conceal more than what the ToC says */
+      frame_size = IMIN(frame_size, st->frame_size);
+   }
+   if (data != NULL)
+   {
+      audiosize = st->frame_size;
+      ec_dec_init(&dec,(unsigned char*)data,len);
+   } else {
+      audiosize = frame_size;
+      if (st->prev_mode == 0)
+      {
+         /* If we haven't got any packet yet, all we can do is return zeros */
+         for (i=0;i<audiosize*st->channels;i++)
+            pcm[i] = 0;
+         return audiosize;
+      }
+      if (audiosize > F20)
+      {
+         do {
+            int ret = opus_silk_decode_frame(st, NULL, 0, pcm, IMIN(audiosize, F20), 0);
+            if (ret<0)
+               return ret;
+            pcm += ret*st->channels;
+            audiosize -= ret;
+         } while (audiosize > 0);
+         return frame_size;
+      } else if (audiosize < F20 && audiosize > F10)
+         audiosize = F10;
+   }
+   if (audiosize > frame_size)
+      return OPUS_BAD_ARG;
+   /* The SILK PLC cannot produce frames of less than 10 ms */
+   if (audiosize < F10)
+      return OPUS_BUFFER_TOO_SMALL;
+
+   st->DecControl.payloadSize_ms = IMAX(10, 1000 * audiosize / st->Fs);
+   if (data != NULL)
+   {
+      st->DecControl.nChannelsInternal = st->stream_channels;
+      if (st->bandwidth == OPUS_BANDWIDTH_NARROWBAND)
+         st->DecControl.internalSampleRate = 8000;
+      else if (st->bandwidth == OPUS_BANDWIDTH_MEDIUMBAND)
+         st->DecControl.internalSampleRate = 12000;
+      else
+         st->DecControl.internalSampleRate = 16000;
+   }
+
+   lost_flag = data == NULL ? 1 : 2 * decode_fec;
+   decoded_samples = 0;
+   do {
+      /* Call SILK decoder */
+      int first_frame = decoded_samples == 0;
+      if (silk_Decode( silk_dec, &st->DecControl, lost_flag, first_frame, &dec,
+            pcm, &silk_frame_size, st->arch ))
+      {
+         if (lost_flag) {
+            /* PLC failure should not be fatal */
+            silk_frame_size = audiosize;
+            for (i=0;i<audiosize*st->channels;i++)
+               pcm[i] = 0;
+         } else {
+            return OPUS_INTERNAL_ERROR;
+         }
+      }
+      pcm += silk_frame_size * st->channels;
+      decoded_samples += silk_frame_size;
+   } while (decoded_samples < audiosize);
+
+   /* Any CELT redundancy frame left in the packet is ignored, so the final
+      range only covers the SILK part. */
+   if (len <= 1)
+      st->rangeFinal = 0;
+   else
+      st->rangeFinal = dec.rng;
+   st->prev_mode = MODE_SILK_ONLY;
+   return audiosize;
+}
+
+int opus_silk_decode(OpusSilkDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_int16 *pcm, int frame_size, int decode_fec)
+{
+   int i, nb_samples;
+   int count, offset;
+   unsigned char toc;
+   int packet_frame_size, packet_bandwidth, packet_stream_channels;
+   /* 48 x 2.5 ms = 120 ms */
+   opus_int16 size[48];
+   if (frame_size<=0 || decode_fec<0 || decode_fec>1)
+      return OPUS_BAD_ARG;
+   /* For FEC/PLC, frame_size has to be a multiple of 10 ms */
+   if ((decode_fec || len==0 || data==NULL) && frame_size%(st->Fs/100)!=0)
+      return OPUS_BAD_ARG;
+   if (len==0 || data==NULL)
+   {
+      int pcm_count=0;
+      do {
+         int ret;
+         ret = opus_silk_decode_frame(st, NULL, 0, pcm+pcm_count*st->channels, frame_size-pcm_count, 0);
+         if (ret<0)
+            return ret;
+         pcm_count += ret;
+      } while (pcm_count < frame_size);
+      st->last_packet_duration = pcm_count;
+      return pcm_count;
+   } else if (len<0)
+      return OPUS_BAD_ARG;
+
+   /* Hybrid and CELT-only packets need the full decoder */
+   if (data[0]&0x80 || (data[0]&0x60) == 0x60)
+      return OPUS_UNIMPLEMENTED;
+   packet_bandwidth = opus_packet_get_bandwidth(data);
+   packet_frame_size = opus_packet_get_samples_per_frame(data, st->Fs);
+   packet_stream_channels = opus_packet_get_nb_channels(data);
+
+   count = opus_packet_parse_impl(data, len, 0, &toc, NULL, size, &offset, NULL);
+   if (count<0)
+      return count;
+
+   data += offset;
+
+   if (decode_fec)
+   {
+      int duration_copy;
+      int ret;
+      /* If no FEC can be present, run the PLC (recursive call) */
+      if (frame_size < packet_frame_size)
+         return opus_silk_decode(st, NULL, 0, pcm, frame_size, 0);
+      /* Otherwise, run the PLC on everything except the size for which we might have FEC */
+      duration_copy = st->last_packet_duration;
+      if (frame_size-packet_frame_size!=0)
+      {
+         ret = opus_silk_decode(st, NULL, 0, pcm, frame_size-packet_frame_size, 0);
+         if (ret<0)
+         {
+            st->last_packet_duration = duration_copy;
+            return ret;
+         }
+      }
+      /* Complete with FEC */
+      st->bandwidth = packet_bandwidth;
+      st->frame_size = packet_frame_size;
+      st->stream_channels = packet_stream_channels;
+      ret = opus_silk_decode_frame(st, data, size[0], pcm+st->channels*(frame_size-packet_frame_size),
+            packet_frame_size, 1);
+      if (ret<0)
+         return ret;
+      st->last_packet_duration = frame_size;
+      return frame_size;
+   }
+
+   if (count*packet_frame_size > frame_size)
+      return OPUS_BUFFER_TOO_SMALL;
+
+   /* Update the state as the last step to avoid updating it on an invalid packet */
+   st->bandwidth = packet_bandwidth;
+   st->frame_size = packet_frame_size;
+   st->stream_channels = packet_stream_channels;
+
+   nb_samples=0;
+   for (i=0;i<count;i++)
+   {
+      int ret;
+      ret = opus_silk_decode_frame(st, data, size[i], pcm+nb_samples*st->channels, frame_size-nb_samples, 0);
+      if (ret<0)
+         return ret;
+      data += size[i];
+      nb_samples += ret;
+   }
+   st->last_packet_duration = nb_samples;
+   return nb_samples;
+}
+
+int opus_silk_decoder_ctl(OpusSilkDecoder *st, int request, ...)
+{
+   int ret = OPUS_OK;
+   va_list ap;
+
+   va_start(ap, request);
+
+   switch (request)
+   {
+   case OPUS_GET_BANDWIDTH_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      *value = st->bandwidth;
+   }
+   break;
+   case OPUS_GET_FINAL_RANGE_REQUEST:
+   {
+      opus_uint32 *value = va_arg(ap, opus_uint32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      *value = st->rangeFinal;
+   }
+   break;
+   case OPUS_RESET_STATE:
+   {
+      OPUS_CLEAR((char*)&st->OPUS_SILK_DECODER_RESET_START,
+            sizeof(OpusSilkDecoder)-
+            ((char*)&st->OPUS_SILK_DECODER_RESET_START - (char*)st));
+
+      silk_InitDecoder((char*)st+st->silk_dec_offset);
+      st->stream_channels = st->channels;
+      st->frame_size = st->Fs/400;
+   }
+   break;
+   case OPUS_GET_SAMPLE_RATE_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      *value = st->Fs;
+   }
+   break;
+   case OPUS_GET_LAST_PACKET_DURATION_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      *value = st->last_packet_duration;
+   }
+   break;
+   default:
+      /*fprintf(stderr, "unknown opus_silk_decoder_ctl() request: %d", request);*/
+      ret = OPUS_UNIMPLEMENTED;
+      break;
+   }
+
+   va_end(ap);
+   return ret;
+bad_arg:
+   va_end(ap);
+   return OPUS_BAD_ARG;
+}
+
+void opus_silk_decoder_destroy(OpusSilkDecoder *st)
+{
+   opus_free(st);
+}
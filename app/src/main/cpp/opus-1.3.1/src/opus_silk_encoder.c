@@ -0,0 +1,619 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+#include "opus_silk.h"
+#include "opus_private.h"
+#include "entenc.h"
+#include "API.h"
+#include "stack_alloc.h"
+#include "float_cast.h"
+#include "os_support.h"
+#include "cpu_support.h"
+#include "tuning_parameters.h"
+#ifdef FIXED_POINT
+#include "fixed/structs_FIX.h"
+#else
+#include "float/structs_FLP.h"
+#endif
+
+/* Below this many bits per second (with the same hysteresis as the regular
+   encoder's voice thresholds) the encoder drops to narrowband. */
+#define SILK_WB_THRESHOLD   9000
+#define SILK_WB_HYSTERESIS   700
+
+struct OpusSilkEncoder {
+    int          silk_enc_offset;
+    silk_EncControlStruct silk_mode;
+    int          channels;
+    opus_int32   Fs;
+    int          arch;
+    int          use_vbr;
+    int          use_dtx;
+    opus_int32   user_bitrate_bps;
+    int          max_bandwidth;
+
+#define OPUS_SILK_ENCODER_RESET_START variable_HP_smth2_Q15
+    opus_int32   variable_HP_smth2_Q15;
+    opus_val32   hp_mem[4];
+    int          bandwidth;
+    int          first;
+    int          prev_framesize;
+    opus_uint32  rangeFinal;
+};
+
+int opus_silk_encoder_get_size(int channels)
+{
+    int silkEncSizeBytes;
+    if (channels<1 || channels>2)
+        return 0;
+    if (silk_Get_Encoder_Size(&silkEncSizeBytes))
+        return 0;
+    return align(sizeof(OpusSilkEncoder))+align(silkEncSizeBytes);
+}
+
+static void opus_silk_encoder_reset(OpusSilkEncoder *st)
+{
+    char *start = (char*)&st->OPUS_SILK_ENCODER_RESET_START;
+    OPUS_CLEAR(start, sizeof(OpusSilkEncoder) - (start - (char*)st));
+    st->variable_HP_smth2_Q15 = silk_LSHIFT( silk_lin2log( VARIABLE_HP_MIN_CUTOFF_HZ ), 8 );
+    st->bandwidth = OPUS_BANDWIDTH_WIDEBAND;
+    st->first = 1;
+}
+
+int opus_silk_encoder_init(OpusSilkEncoder *st, opus_int32 Fs, int channels)
+{
+    void *silk_enc;
+
+    if ((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)||(channels!=1&&channels!=2))
+        return OPUS_BAD_ARG;
+
+    /* Unlike opus_encoder_init(), only the fixed part of the state is cleared:
+       silk_InitEncoder() clears the SILK state itself. */
+    OPUS_CLEAR(st, 1);
+    st->silk_enc_offset = align(sizeof(OpusSilkEncoder));
+    silk_enc = (char*)st+st->silk_enc_offset;
+
+    st->channels = channels;
+    st->Fs = Fs;
+    st->arch = opus_select_arch();
+
+    if (silk_InitEncoder( silk_enc, st->arch, &st->silk_mode ))
+        return OPUS_INTERNAL_ERROR;
+
+    /* Same SILK defaults as opus_encoder_init() */
+    st->silk_mode.nChannelsAPI              = channels;
+    st->silk_mode.nChannelsInternal         = channels;
+    st->silk_mode.API_sampleRate            = Fs;
+    st->silk_mode.maxInternalSampleRate     = 16000;
+    st->silk_mode.minInternalSampleRate     = 8000;
+    st->silk_mode.desiredInternalSampleRate = 16000;
+    st->silk_mode.payloadSize_ms            = 20;
+    st->silk_mode.bitRate                   = 25000;
+    st->silk_mode.packetLossPercentage      = 0;
+    st->silk_mode.complexity                = 9;
+    st->silk_mode.useInBandFEC              = 0;
+    st->silk_mode.useDTX                    = 0;
+    st->silk_mode.useCBR                    = 0;
+    st->silk_mode.reducedDependency         = 0;
+    st->silk_mode.useGainPrediction         = 1;
+
+    st->use_vbr = 1;
+    st->user_bitrate_bps = OPUS_AUTO;
+    st->max_bandwidth = OPUS_BANDWIDTH_WIDEBAND;
+    opus_silk_encoder_reset(st);
+    return OPUS_OK;
+}
+
+OpusSilkEncoder *opus_silk_encoder_create(opus_int32 Fs, int channels, int *error)
+{
+    int ret;
+    OpusSilkEncoder *st;
+    if ((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)||(channels!=1&&channels!=2))
+    {
+        if (error)
+            *error = OPUS_BAD_ARG;
+        return NULL;
+    }
+    st = (OpusSilkEncoder *)opus_alloc(opus_silk_encoder_get_size(channels));
+    if (st == NULL)
+    {
+        if (error)
+            *error = OPUS_ALLOC_FAIL;
+        return NULL;
+    }
+    ret = opus_silk_encoder_init(st, Fs, channels);
+    if (error)
+        *error = ret;
+    if (ret != OPUS_OK)
+    {
+        opus_free(st);
+        st = NULL;
+    }
+    return st;
+}
+
+static opus_int32 user_bitrate_to_bitrate(OpusSilkEncoder *st, int frame_size, int max_data_bytes)
+{
+    if (!frame_size)
+        frame_size = st->Fs/50;
+    if (st->user_bitrate_bps==OPUS_AUTO)
+        return 60*st->Fs/frame_size + st->Fs*st->channels;
+    else if (st->user_bitrate_bps==OPUS_BITRATE_MAX)
+        return max_data_bytes*8*st->Fs/frame_size;
+    else
+        return st->user_bitrate_bps;
+}
+
+opus_int32 opus_silk_encode(OpusSilkEncoder *st, const opus_int16 *pcm, int frame_size,
+      unsigned char *data, opus_int32 max_data_bytes)
+{
+    void *silk_enc;
+    ec_enc enc;
+    opus_int32 bitrate_bps, max_rate, effective_max_rate, nBytes;
+    int frame_rate, bytes_target, curr_bandwidth;
+    int cutoff_Hz, hp_freq_smth1;
+    int ret;
+    VARDECL(opus_val16, pcm_buf);
+#ifndef FIXED_POINT
+    int i;
+    VARDECL(opus_val16, pcm_in);
+    VARDECL(opus_int16, pcm_silk);
+#endif
+    ALLOC_STACK;
+
+    st->rangeFinal = 0;
+    if (max_data_bytes <= 0 || (400*frame_size != 4*st->Fs && 400*frame_size != 8*st->Fs
+          && 400*frame_size != 16*st->Fs && 400*frame_size != 24*st->Fs))
+    {
+        RESTORE_STACK;
+        return OPUS_BAD_ARG;
+    }
+    max_data_bytes = IMIN(1276, max_data_bytes);
+    silk_enc = (char*)st+st->silk_enc_offset;
+
+    frame_rate = st->Fs/frame_size;
+    bitrate_bps = user_bitrate_to_bitrate(st, frame_size, max_data_bytes);
+    if (!st->use_vbr)
+    {
+        int cbrBytes;
+        /* Multiply by 12 to make sure the division is exact. */
+        int frame_rate12 = 12*st->Fs/frame_size;
+        cbrBytes = IMIN( (12*bitrate_bps/8 + frame_rate12/2)/frame_rate12, max_data_bytes);
+        bitrate_bps = cbrBytes*(opus_int32)frame_rate12*8/12;
+        max_data_bytes = IMAX(1, cbrBytes);
+    }
+    st->prev_framesize = frame_size;
+
+    if (max_data_bytes<3 || bitrate_bps < 3*frame_rate*8
+          || (frame_rate<50 && (max_data_bytes*frame_rate<300 || bitrate_bps < 2400)))
+    {
+        /* If the space is too low to do something useful, emit a 'PLC' frame. */
+        data[0] = gen_toc(MODE_SILK_ONLY, frame_rate, st->bandwidth, st->channels);
+        ret = 1;
+        if (!st->use_vbr)
+        {
+            if (opus_packet_pad(data, ret, max_data_bytes) != OPUS_OK)
+            {
+                RESTORE_STACK;
+                return OPUS_INTERNAL_ERROR;
+            }
+            ret = max_data_bytes;
+        }
+        RESTORE_STACK;
+        return ret;
+    }
+    max_rate = frame_rate*max_data_bytes*8;
+
+    /* Rate-dependent bandwidth, only when SILK is ready to switch */
+    if (st->first || st->silk_mode.allowBandwidthSwitch)
+    {
+        opus_int32 threshold = SILK_WB_THRESHOLD;
+        if (!st->first)
+            threshold += st->bandwidth == OPUS_BANDWIDTH_NARROWBAND ? SILK_WB_HYSTERESIS : -SILK_WB_HYSTERESIS;
+        st->bandwidth = bitrate_bps >= threshold ? OPUS_BANDWIDTH_WIDEBAND : OPUS_BANDWIDTH_NARROWBAND;
+    }
+    curr_bandwidth = IMIN(st->bandwidth, st->max_bandwidth);
+    if (st->Fs <= 12000 && curr_bandwidth > OPUS_BANDWIDTH_MEDIUMBAND)
+        curr_bandwidth = OPUS_BANDWIDTH_MEDIUMBAND;
+    if (st->Fs <= 8000)
+        curr_bandwidth = OPUS_BANDWIDTH_NARROWBAND;
+
+    bytes_target = IMIN(max_data_bytes, bitrate_bps * frame_size / (st->Fs * 8)) - 1;
+
+    ec_enc_init(&enc, data+1, max_data_bytes-1);
+
+    /* Variable high-pass, as in opus_encode_native() for OPUS_APPLICATION_VOIP */
+    hp_freq_smth1 = ((silk_encoder*)silk_enc)->state_Fxx[0].sCmn.variable_HP_smth1_Q15;
+    st->variable_HP_smth2_Q15 = silk_SMLAWB( st->variable_HP_smth2_Q15,
+          hp_freq_smth1 - st->variable_HP_smth2_Q15, SILK_FIX_CONST( VARIABLE_HP_SMTH_COEF2, 16 ) );
+    cutoff_Hz = silk_log2lin( silk_RSHIFT( st->variable_HP_smth2_Q15, 8 ) );
+
+    ALLOC(pcm_buf, frame_size*st->channels, opus_val16);
+#ifdef FIXED_POINT
+    hp_cutoff(pcm, cutoff_Hz, pcm_buf, st->hp_mem, frame_size, st->channels, st->Fs, st->arch);
+#else
+    ALLOC(pcm_in, frame_size*st->channels, opus_val16);
+    ALLOC(pcm_silk, frame_size*st->channels, opus_int16);
+    for (i=0;i<frame_size*st->channels;i++)
+        pcm_in[i] = (1.0f/32768)*pcm[i];
+    hp_cutoff(pcm_in, cutoff_Hz, pcm_buf, st->hp_mem, frame_size, st->channels, st->Fs, st->arch);
+    for (i=0;i<frame_size*st->channels;i++)
+        pcm_silk[i] = FLOAT2INT16(pcm_buf[i]);
+#endif
+
+    st->silk_mode.bitRate = 8 * bytes_target * frame_rate;
+    st->silk_mode.payloadSize_ms = 1000 * frame_size / st->Fs;
+    st->silk_mode.nChannelsAPI = st->channels;
+    st->silk_mode.nChannelsInternal = st->channels;
+    if (curr_bandwidth == OPUS_BANDWIDTH_NARROWBAND)
+        st->silk_mode.desiredInternalSampleRate = 8000;
+    else if (curr_bandwidth == OPUS_BANDWIDTH_MEDIUMBAND)
+        st->silk_mode.desiredInternalSampleRate = 12000;
+    else
+        st->silk_mode.desiredInternalSampleRate = 16000;
+    st->silk_mode.minInternalSampleRate = 8000;
+    st->silk_mode.maxInternalSampleRate = 16000;
+    effective_max_rate = max_rate;
+    if (frame_rate > 50)
+        effective_max_rate = effective_max_rate*2/3;
+    if (effective_max_rate < 8000)
+    {
+        st->silk_mode.maxInternalSampleRate = 12000;
+        st->silk_mode.desiredInternalSampleRate = IMIN(12000, st->silk_mode.desiredInternalSampleRate);
+    }
+    if (effective_max_rate < 7000)
+    {
+        st->silk_mode.maxInternalSampleRate = 8000;
+        st->silk_mode.desiredInternalSampleRate = IMIN(8000, st->silk_mode.desiredInternalSampleRate);
+    }
+    st->silk_mode.useCBR = !st->use_vbr;
+    st->silk_mode.useDTX = st->use_dtx;
+    st->silk_mode.maxBits = (max_data_bytes-1)*8;
+
+#ifdef FIXED_POINT
+    ret = silk_Encode( silk_enc, &st->silk_mode, pcm_buf, frame_size, &enc, &nBytes, 0, VAD_NO_DECISION );
+#else
+    ret = silk_Encode( silk_enc, &st->silk_mode, pcm_silk, frame_size, &enc, &nBytes, 0, VAD_NO_DECISION );
+#endif
+    if (ret)
+    {
+        RESTORE_STACK;
+        return OPUS_INTERNAL_ERROR;
+    }
+    st->first = 0;
+
+    /* Signal the bandwidth SILK actually coded */
+    if (st->silk_mode.internalSampleRate == 8000)
+        curr_bandwidth = OPUS_BANDWIDTH_NARROWBAND;
+    else if (st->silk_mode.internalSampleRate == 12000)
+        curr_bandwidth = OPUS_BANDWIDTH_MEDIUMBAND;
+    else
+        curr_bandwidth = OPUS_BANDWIDTH_WIDEBAND;
+    /* There is no CELT redundancy frame to cover a bandwidth switch, so SILK
+       switches as soon as its low-pass transition is done. */
+    st->silk_mode.opusCanSwitch = st->silk_mode.switchReady;
+
+    data[0] = gen_toc(MODE_SILK_ONLY, frame_rate, curr_bandwidth, st->channels);
+    if (nBytes==0)
+    {
+        /* DTX */
+        RESTORE_STACK;
+        return 1;
+    }
+
+    ret = (ec_tell(&enc)+7)>>3;
+    ec_enc_done(&enc);
+    st->rangeFinal = enc.rng;
+
+    if (ec_tell(&enc) > (max_data_bytes-1)*8)
+    {
+        /* SILK busted its target, tell the decoder to call the PLC */
+        data[1] = 0;
+        ret = 1;
+        st->rangeFinal = 0;
+    } else {
+        /* The range decoder fills in trailing zero bytes */
+        while (ret>2 && data[ret]==0)
+            ret--;
+    }
+    /* Count the ToC */
+    ret += 1;
+    if (!st->use_vbr)
+    {
+        if (opus_packet_pad(data, ret, max_data_bytes) != OPUS_OK)
+        {
+            RESTORE_STACK;
+            return OPUS_INTERNAL_ERROR;
+        }
+        ret = max_data_bytes;
+    }
+    RESTORE_STACK;
+    return ret;
+}
+
+int opus_silk_encoder_ctl(OpusSilkEncoder *st, int request, ...)
+{
+    int ret;
+    va_list ap;
+
+    ret = OPUS_OK;
+    va_start(ap, request);
+    switch (request)
+    {
+        case OPUS_SET_BITRATE_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if (value != OPUS_AUTO && value != OPUS_BITRATE_MAX)
+            {
+                if (value <= 0)
+                    goto bad_arg;
+                else if (value <= 500)
+                    value = 500;
+                else if (value > (opus_int32)300000*st->channels)
+                    value = (opus_int32)300000*st->channels;
+            }
+            st->user_bitrate_bps = value;
+        }
+        break;
+        case OPUS_GET_BITRATE_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = user_bitrate_to_bitrate(st, st->prev_framesize, 1276);
+        }
+        break;
+        case OPUS_SET_MAX_BANDWIDTH_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if (value < OPUS_BANDWIDTH_NARROWBAND || value > OPUS_BANDWIDTH_FULLBAND)
+            {
+               goto bad_arg;
+            }
+            /* SILK codes at most wideband */
+            st->max_bandwidth = IMIN(value, OPUS_BANDWIDTH_WIDEBAND);
+        }
+        break;
+        case OPUS_GET_MAX_BANDWIDTH_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->max_bandwidth;
+        }
+        break;
+        case OPUS_GET_BANDWIDTH_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = IMIN(st->bandwidth, st->max_bandwidth);
+        }
+        break;
+        case OPUS_SET_DTX_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if(value<0 || value>1)
+            {
+               goto bad_arg;
+            }
+            st->use_dtx = value;
+        }
+        break;
+        case OPUS_GET_DTX_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->use_dtx;
+        }
+        break;
+        case OPUS_SET_COMPLEXITY_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if(value<0 || value>10)
+            {
+               goto bad_arg;
+            }
+            st->silk_mode.complexity = value;
+        }
+        break;
+        case OPUS_GET_COMPLEXITY_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->silk_mode.complexity;
+        }
+        break;
+        case OPUS_SET_INBAND_FEC_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if(value<0 || value>1)
+            {
+               goto bad_arg;
+            }
+            st->silk_mode.useInBandFEC = value;
+        }
+        break;
+        case OPUS_GET_INBAND_FEC_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->silk_mode.useInBandFEC;
+        }
+        break;
+        case OPUS_SET_PACKET_LOSS_PERC_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if (value < 0 || value > 100)
+            {
+               goto bad_arg;
+            }
+            st->silk_mode.packetLossPercentage = value;
+        }
+        break;
+        case OPUS_GET_PACKET_LOSS_PERC_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->silk_mode.packetLossPercentage;
+        }
+        break;
+        case OPUS_SET_VBR_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if(value<0 || value>1)
+            {
+               goto bad_arg;
+            }
+            st->use_vbr = value;
+            st->silk_mode.useCBR = 1-value;
+        }
+        break;
+        case OPUS_GET_VBR_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->use_vbr;
+        }
+        break;
+        case OPUS_GET_SAMPLE_RATE_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->Fs;
+        }
+        break;
+        case OPUS_SET_VAD_STATE_REQUEST:
+        {
+            const OpusSilkVad *value = va_arg(ap, const OpusSilkVad*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            opus_silk_vad_copy_state(value, (char*)st+st->silk_enc_offset);
+        }
+        break;
+        case OPUS_SET_SILK_GAIN_PREDICTION_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if(value<0 || value>1)
+            {
+               goto bad_arg;
+            }
+            st->silk_mode.useGainPrediction = value;
+        }
+        break;
+        case OPUS_GET_SILK_GAIN_PREDICTION_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->silk_mode.useGainPrediction;
+        }
+        break;
+        case OPUS_GET_SILK_RATE_FRAMES_REQUEST:
+        case OPUS_GET_SILK_RATE_ITERATIONS_REQUEST:
+        case OPUS_GET_SILK_RATE_UNUSED_BITS_REQUEST:
+        {
+            silk_RateControlStats stats;
+            opus_uint32 *value = va_arg(ap, opus_uint32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            silk_GetRateControlStats((char*)st+st->silk_enc_offset, &stats);
+            if (request == OPUS_GET_SILK_RATE_FRAMES_REQUEST)
+               *value = stats.frames;
+            else if (request == OPUS_GET_SILK_RATE_ITERATIONS_REQUEST)
+               *value = stats.iterations;
+            else
+               *value = stats.unusedBits;
+        }
+        break;
+        case OPUS_GET_FINAL_RANGE_REQUEST:
+        {
+            opus_uint32 *value = va_arg(ap, opus_uint32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->rangeFinal;
+        }
+        break;
+        case OPUS_RESET_STATE:
+        {
+           silk_EncControlStruct dummy;
+           silk_InitEncoder( (char*)st+st->silk_enc_offset, st->arch, &dummy );
+           opus_silk_encoder_reset(st);
+        }
+        break;
+        default:
+            /* fprintf(stderr, "unknown opus_silk_encoder_ctl() request: %d", request);*/
+            ret = OPUS_UNIMPLEMENTED;
+            break;
+    }
+    va_end(ap);
+    return ret;
+bad_arg:
+    va_end(ap);
+    return OPUS_BAD_ARG;
+}
+
+void opus_silk_encoder_destroy(OpusSilkEncoder *st)
+{
+    opus_free(st);
+}
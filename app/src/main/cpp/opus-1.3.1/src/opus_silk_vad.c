@@ -0,0 +1,124 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus_silk.h"
+#include "opus_private.h"
+#include "main.h"
+#include "os_support.h"
+#include "cpu_support.h"
+#ifdef FIXED_POINT
+#include "fixed/structs_FIX.h"
+#else
+#include "float/structs_FLP.h"
+#endif
+
+struct OpusSilkVad {
+    /* silk_VAD_GetSA_Q8() works on the common encoder state, of which it only
+       uses the VAD state and the frame parameters */
+    silk_encoder_state        sCmn;
+    silk_resampler_state_struct resampler;
+    opus_int32                Fs;
+};
+
+int opus_silk_vad_get_size(void)
+{
+    return sizeof(OpusSilkVad);
+}
+
+int opus_silk_vad_init(OpusSilkVad *st, opus_int32 Fs)
+{
+    if (Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
+        return OPUS_BAD_ARG;
+    OPUS_CLEAR(st, 1);
+    st->Fs = Fs;
+    st->sCmn.arch = opus_select_arch();
+    st->sCmn.fs_kHz = silk_min_int( Fs/1000, 16 );
+    if (silk_VAD_Init( &st->sCmn.sVAD ))
+        return OPUS_INTERNAL_ERROR;
+    if (Fs > 16000 && silk_resampler_init( &st->resampler, Fs, 16000, 1 ))
+        return OPUS_INTERNAL_ERROR;
+    return OPUS_OK;
+}
+
+OpusSilkVad *opus_silk_vad_create(opus_int32 Fs, int *error)
+{
+    int ret;
+    OpusSilkVad *st;
+    if (Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
+    {
+        if (error)
+            *error = OPUS_BAD_ARG;
+        return NULL;
+    }
+    st = (OpusSilkVad *)opus_alloc(opus_silk_vad_get_size());
+    if (st == NULL)
+    {
+        if (error)
+            *error = OPUS_ALLOC_FAIL;
+        return NULL;
+    }
+    ret = opus_silk_vad_init(st, Fs);
+    if (error)
+        *error = ret;
+    if (ret != OPUS_OK)
+    {
+        opus_free(st);
+        st = NULL;
+    }
+    return st;
+}
+
+int opus_silk_vad_process(OpusSilkVad *st, const opus_int16 *pcm, int frame_size)
+{
+    opus_int16 buf[ MAX_FRAME_LENGTH ];
+    if (frame_size != st->Fs/100 && frame_size != st->Fs/50)
+        return OPUS_BAD_ARG;
+    st->sCmn.frame_length = frame_size*st->sCmn.fs_kHz/(st->Fs/1000);
+    if (st->Fs > 16000)
+    {
+        silk_resampler( &st->resampler, buf, pcm, frame_size );
+        pcm = buf;
+    }
+    silk_VAD_GetSA_Q8( &st->sCmn, pcm, st->sCmn.arch );
+    return st->sCmn.speech_activity_Q8;
+}
+
+void opus_silk_vad_copy_state(const OpusSilkVad *vad, void *silk_enc)
+{
+    int n;
+    silk_encoder *psEnc = (silk_encoder *)silk_enc;
+    for (n = 0; n < ENCODER_NUM_CHANNELS; n++)
+        psEnc->state_Fxx[ n ].sCmn.sVAD = vad->sCmn.sVAD;
+}
+
+void opus_silk_vad_destroy(OpusSilkVad *st)
+{
+    opus_free(st);
+}
@@ -0,0 +1,252 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include "opus_wake_gate.h"
+#include "opus_private.h"
+#include "modes.h"
+#include "kiss_fft.h"
+#include "mathops.h"
+#include "os_support.h"
+#include "cpu_support.h"
+#include "wake_gate.h"
+
+#ifdef FIXED_POINT
+/* The FFT input is +/-2^15 shifted up by SIG_SHIFT, as in analysis.c. */
+#define WAKE_GATE_IN_SCALE ((float)(1<<SIG_SHIFT))
+#define WAKE_GATE_ENER_SCALE (1.f/((float)((opus_int32)1<<(15+SIG_SHIFT))*(float)((opus_int32)1<<(15+SIG_SHIFT))))
+#else
+#define WAKE_GATE_IN_SCALE (1.f/32768)
+#define WAKE_GATE_ENER_SCALE 1.f
+#endif
+
+/* Per 10 ms hop, in units of 6 dB: the floor follows drops quickly and rises
+   by 1.5 dB/s, so that it stays under speech but catches up with a noise
+   that gets louder within a few seconds. */
+#define FLOOR_DECAY .2f
+#define FLOOR_RISE .0025f
+
+/* Band edges in FFT bins (66.7 Hz each), roughly on a mel scale. */
+static const int wake_gate_bands[WAKE_GATE_BANDS+1] = {
+      1, 3, 5, 7, 9, 11, 14, 17, 21, 25, 30, 36, 44, 54, 66, 82, 120
+};
+
+/* Orthonormal DCT-II of the band log energies, coefficients 1 to 8. */
+static const float wake_gate_dct[WAKE_GATE_CEPSTRA*WAKE_GATE_BANDS] = {
+     0.351851f, 0.338330f, 0.311806f, 0.273300f, 0.224292f, 0.166664f, 0.102631f, 0.034654f,
+    -0.034654f,-0.102631f,-0.166664f,-0.224292f,-0.273300f,-0.311806f,-0.338330f,-0.351851f,
+     0.346760f, 0.293969f, 0.196424f, 0.068975f,-0.068975f,-0.196424f,-0.293969f,-0.346760f,
+    -0.346760f,-0.293969f,-0.196424f,-0.068975f, 0.068975f, 0.196424f, 0.293969f, 0.346760f,
+     0.338330f, 0.224292f, 0.034654f,-0.166664f,-0.311806f,-0.351851f,-0.273300f,-0.102631f,
+     0.102631f, 0.273300f, 0.351851f, 0.311806f, 0.166664f,-0.034654f,-0.224292f,-0.338330f,
+     0.326641f, 0.135299f,-0.135299f,-0.326641f,-0.326641f,-0.135299f, 0.135299f, 0.326641f,
+     0.326641f, 0.135299f,-0.135299f,-0.326641f,-0.326641f,-0.135299f, 0.135299f, 0.326641f,
+     0.311806f, 0.034654f,-0.273300f,-0.338330f,-0.102631f, 0.224292f, 0.351851f, 0.166664f,
+    -0.166664f,-0.351851f,-0.224292f, 0.102631f, 0.338330f, 0.273300f,-0.034654f,-0.311806f,
+     0.293969f,-0.068975f,-0.346760f,-0.196424f, 0.196424f, 0.346760f, 0.068975f,-0.293969f,
+    -0.293969f, 0.068975f, 0.346760f, 0.196424f,-0.196424f,-0.346760f,-0.068975f, 0.293969f,
+     0.273300f,-0.166664f,-0.338330f, 0.034654f, 0.351851f, 0.102631f,-0.311806f,-0.224292f,
+     0.224292f, 0.311806f,-0.102631f,-0.351851f,-0.034654f, 0.338330f, 0.166664f,-0.273300f,
+     0.250000f,-0.250000f,-0.250000f, 0.250000f, 0.250000f,-0.250000f,-0.250000f, 0.250000f,
+     0.250000f,-0.250000f,-0.250000f, 0.250000f, 0.250000f,-0.250000f,-0.250000f, 0.250000f,
+};
+
+/* First half of a 240-point Hann window. */
+static const float wake_gate_window[WAKE_GATE_WINDOW/2] = {
+      0.000043f, 0.000385f, 0.001071f, 0.002098f, 0.003466f, 0.005174f, 0.007222f, 0.009607f,
+      0.012329f, 0.015385f, 0.018772f, 0.022490f, 0.026535f, 0.030904f, 0.035595f, 0.040604f,
+      0.045928f, 0.051564f, 0.057506f, 0.063752f, 0.070297f, 0.077136f, 0.084265f, 0.091679f,
+      0.099373f, 0.107342f, 0.115579f, 0.124080f, 0.132839f, 0.141849f, 0.151105f, 0.160600f,
+      0.170327f, 0.180280f, 0.190453f, 0.200838f, 0.211427f, 0.222215f, 0.233193f, 0.244353f,
+      0.255689f, 0.267193f, 0.278856f, 0.290670f, 0.302628f, 0.314721f, 0.326941f, 0.339280f,
+      0.351729f, 0.364280f, 0.376923f, 0.389651f, 0.402455f, 0.415325f, 0.428254f, 0.441231f,
+      0.454249f, 0.467298f, 0.480370f, 0.493455f, 0.506545f, 0.519630f, 0.532702f, 0.545751f,
+      0.558769f, 0.571746f, 0.584675f, 0.597545f, 0.610349f, 0.623077f, 0.635720f, 0.648271f,
+      0.660720f, 0.673059f, 0.685279f, 0.697372f, 0.709330f, 0.721144f, 0.732807f, 0.744311f,
+      0.755647f, 0.766807f, 0.777785f, 0.788573f, 0.799162f, 0.809547f, 0.819720f, 0.829673f,
+      0.839400f, 0.848895f, 0.858151f, 0.867161f, 0.875920f, 0.884421f, 0.892658f, 0.900627f,
+      0.908321f, 0.915735f, 0.922864f, 0.929703f, 0.936248f, 0.942494f, 0.948436f, 0.954072f,
+      0.959396f, 0.964405f, 0.969096f, 0.973465f, 0.977510f, 0.981228f, 0.984615f, 0.987671f,
+      0.990393f, 0.992778f, 0.994826f, 0.996534f, 0.997902f, 0.998929f, 0.999615f, 0.999957f,
+};
+
+int opus_wake_gate_get_size(void)
+{
+   return sizeof(OpusWakeGate);
+}
+
+int opus_wake_gate_init(OpusWakeGate *st, opus_int32 Fs)
+{
+   if (Fs!=WAKE_GATE_FS)
+      return OPUS_BAD_ARG;
+   OPUS_CLEAR(st, 1);
+   st->arch = opus_select_arch();
+   return OPUS_OK;
+}
+
+OpusWakeGate *opus_wake_gate_create(opus_int32 Fs, int *error)
+{
+   int ret;
+   OpusWakeGate *st;
+   if (Fs!=WAKE_GATE_FS)
+   {
+      if (error)
+         *error = OPUS_BAD_ARG;
+      return NULL;
+   }
+   st = (OpusWakeGate *)opus_alloc(opus_wake_gate_get_size());
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_wake_gate_init(st, Fs);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+void wake_gate_compute_features(OpusWakeGate *st, const opus_int16 *hop, float *features)
+{
+   int i, b;
+   const CELTMode *mode;
+   const kiss_fft_state *kfft;
+   kiss_fft_cpx in[WAKE_GATE_WINDOW];
+   kiss_fft_cpx out[WAKE_GATE_WINDOW];
+   float bandL[WAKE_GATE_BANDS];
+   float totalE;
+   float totalL;
+   float flux;
+   const int N = WAKE_GATE_WINDOW;
+   const int keep = WAKE_GATE_WINDOW-WAKE_GATE_HOP;
+
+   /* The static mode always exists, and its second FFT is 240 points. */
+   mode = opus_custom_mode_create(48000, 960, NULL);
+   kfft = mode->mdct.kfft[1];
+   celt_assert(kfft->nfft == WAKE_GATE_WINDOW);
+
+   for (i=0;i<N;i++)
+   {
+      float x = i < keep ? st->inmem[i] : hop[i-keep];
+      float w = wake_gate_window[i < N/2 ? i : N-1-i];
+      in[i].r = (kiss_fft_scalar)(w*WAKE_GATE_IN_SCALE*x);
+      in[i].i = 0;
+   }
+   OPUS_COPY(st->inmem, &hop[WAKE_GATE_HOP-keep], keep);
+   opus_fft(kfft, in, out, st->arch);
+
+   totalE = 0;
+   for (b=0;b<WAKE_GATE_BANDS;b++)
+   {
+      float E = 0;
+      for (i=wake_gate_bands[b];i<wake_gate_bands[b+1];i++)
+         E += out[i].r*(float)out[i].r + out[i].i*(float)out[i].i;
+      E *= WAKE_GATE_ENER_SCALE;
+      totalE += E;
+      bandL[b] = .5f*1.442695f*(float)log(E+1e-10f);
+   }
+   totalL = .5f*1.442695f*(float)log(totalE+1e-10f);
+
+   flux = 0;
+   for (b=0;b<WAKE_GATE_BANDS+1;b++)
+   {
+      float L = b < WAKE_GATE_BANDS ? bandL[b] : totalL;
+      if (!st->started)
+         st->floor[b] = L;
+      else if (L < st->floor[b])
+         st->floor[b] += FLOOR_DECAY*(L - st->floor[b]);
+      else
+         st->floor[b] += FLOOR_RISE;
+      features[b] = .5f*(L - st->floor[b]);
+      if (b < WAKE_GATE_BANDS)
+      {
+         if (st->started)
+            flux += (float)fabs(L - st->prev_bandL[b]);
+         st->prev_bandL[b] = L;
+      }
+   }
+   features[WAKE_GATE_BANDS+1] = flux*(1.f/WAKE_GATE_BANDS);
+   /* The spectral envelope, independent of the level. */
+   for (i=0;i<WAKE_GATE_CEPSTRA;i++)
+   {
+      float c = 0;
+      for (b=0;b<WAKE_GATE_BANDS;b++)
+         c += wake_gate_dct[i*WAKE_GATE_BANDS + b]*bandL[b];
+      features[WAKE_GATE_BANDS+2+i] = .25f*c;
+   }
+   st->started = 1;
+}
+
+float wake_gate_compute_prob(OpusWakeGate *st, const float *features)
+{
+   float dense_out[MAX_NEURONS];
+   float prob;
+   compute_dense(&wake_gate_dense, dense_out, features);
+   compute_gru(&wake_gate_gru, st->rnn_state, dense_out);
+   compute_dense(&wake_gate_output, &prob, st->rnn_state);
+   return prob;
+}
+
+int opus_wake_gate_process(OpusWakeGate *st, const opus_int16 *pcm, int len)
+{
+   int max_prob_Q8 = -1;
+   if (len < 0)
+      return OPUS_BAD_ARG;
+   while (len > 0)
+   {
+      int n = IMIN(len, WAKE_GATE_HOP-st->hop_fill);
+      OPUS_COPY(&st->hop[st->hop_fill], pcm, n);
+      st->hop_fill += n;
+      pcm += n;
+      len -= n;
+      if (st->hop_fill == WAKE_GATE_HOP)
+      {
+         float features[WAKE_GATE_FEATURES];
+         float prob;
+         wake_gate_compute_features(st, st->hop, features);
+         prob = wake_gate_compute_prob(st, features);
+         st->last_prob_Q8 = IMIN(255, (int)floor(.5f+256*prob));
+         max_prob_Q8 = IMAX(max_prob_Q8, st->last_prob_Q8);
+         st->hop_fill = 0;
+      }
+   }
+   return max_prob_Q8 < 0 ? st->last_prob_Q8 : max_prob_Q8;
+}
+
+void opus_wake_gate_destroy(OpusWakeGate *st)
+{
+   opus_free(st);
+}
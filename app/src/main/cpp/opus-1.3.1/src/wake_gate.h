@@ -0,0 +1,69 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef WAKE_GATE_H
+#define WAKE_GATE_H
+
+#include "opus_types.h"
+#include "opus_wake_gate.h"
+#include "mlp.h"
+
+#define WAKE_GATE_FS 16000
+/* 10 ms hops over 15 ms windows, so that the FFT size is one of those of the
+   static 48 kHz CELT mode. */
+#define WAKE_GATE_HOP 160
+#define WAKE_GATE_WINDOW 240
+#define WAKE_GATE_BANDS 16
+#define WAKE_GATE_CEPSTRA 8
+#define WAKE_GATE_FEATURES (WAKE_GATE_BANDS+2+WAKE_GATE_CEPSTRA)
+#define WAKE_GATE_DENSE_SIZE 16
+#define WAKE_GATE_GRU_SIZE 16
+
+extern const DenseLayer wake_gate_dense;
+extern const GRULayer wake_gate_gru;
+extern const DenseLayer wake_gate_output;
+
+struct OpusWakeGate {
+   int arch;
+   int started;
+   int hop_fill;
+   int last_prob_Q8;
+   opus_int16 hop[WAKE_GATE_HOP];
+   opus_int16 inmem[WAKE_GATE_WINDOW-WAKE_GATE_HOP];
+   float floor[WAKE_GATE_BANDS+1];
+   float prev_bandL[WAKE_GATE_BANDS];
+   float rnn_state[WAKE_GATE_GRU_SIZE];
+};
+
+/* Computes the features of the next 10 ms hop and updates the noise floor.
+   Shared with the training tool, so that it sees exactly what the network
+   will see. */
+void wake_gate_compute_features(OpusWakeGate *st, const opus_int16 *hop, float *features);
+
+/* Runs the network over one frame of features; returns the probability. */
+float wake_gate_compute_prob(OpusWakeGate *st, const float *features);
+
+#endif /* WAKE_GATE_H */
@@ -0,0 +1,303 @@
+/*This file is automatically generated by benchmark/wake_gate_train.cpp*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "mlp.h"
+#include "wake_gate.h"
+
+static const opus_int8 wake_gate_dense_weights[416] = {
+   -44, -55, 1, 29, 13, -31, 8, 7,
+   21, 41, -23, 15, 60, -53, 61, -11,
+   -25, 36, -42, 54, 10, 27, 3, 7,
+   -9, 14, 23, -22, -46, 41, 19, -26,
+   -14, -1, -12, 15, -48, 37, -11, -1,
+   58, 20, 5, 10, 4, -37, 98, 32,
+   -14, 25, -24, 8, 32, 7, -1, -21,
+   6, 14, -17, 33, -12, 41, 90, -19,
+   -4, -17, -20, 18, 53, -52, -36, -13,
+   41, 20, -7, -22, -9, 40, 90, 4,
+   4, 18, -19, 7, 53, -6, -11, 34,
+   49, -27, -25, 18, -36, -2, 95, -26,
+   -35, 24, 10, 17, -21, -5, 19, -19,
+   33, 8, -37, 21, 21, 7, 17, 28,
+   -26, -6, -12, 13, 43, -37, -3, -33,
+   -6, -32, 7, 36, 35, -21, 23, 45,
+   29, -23, 11, 36, -18, 3, 19, -6,
+   14, -11, 4, 6, -22, -16, 60, -13,
+   -34, 39, 22, -15, 57, -18, -46, 2,
+   -1, 17, 0, -5, 17, -21, 27, -42,
+   -11, -2, 23, -64, -6, 32, -56, -3,
+   -38, -9, 7, -52, -21, -42, 40, -31,
+   -39, 5, 28, -32, 30, 25, -70, -98,
+   -5, -31, -3, -52, -15, 21, -12, -14,
+   -9, 0, 50, 21, -4, 23, 31, -112,
+   -39, -11, 48, 24, -2, 10, -4, -14,
+   -13, 9, 51, 53, 22, 0, -2, 10,
+   -50, -3, 74, 9, -16, -19, 30, 8,
+   40, -34, 8, 21, 35, 23, 62, 16,
+   30, -49, 36, -16, 19, -14, 14, -27,
+   75, 0, 45, 25, 40, -38, -13, 69,
+   4, 8, 62, -2, 18, 27, -51, -40,
+   27, -13, -48, -36, -43, -51, -13, -24,
+   -14, -1, 68, -26, -9, 29, 66, 57,
+   -4, -86, 50, 31, 87, -9, -39, -127,
+   -21, -18, -22, -31, 21, 3, 36, 46,
+   -18, -44, -18, 3, -13, -45, 20, 48,
+   -19, 5, -36, 81, -60, 80, 35, -79,
+   54, -123, -30, 49, 0, 46, 24, 29,
+   -24, 20, 72, 64, 33, 3, 28, -55,
+   8, 71, -104, -9, -72, 56, -25, -46,
+   -63, 92, 70, -59, 83, -11, -24, -16,
+   127, 46, -40, -10, 7, 49, 105, 110,
+   -2, 93, 33, 14, 16, -56, 34, -50,
+   13, -125, -31, 89, 32, -97, 94, -35,
+   -62, 49, -3, -11, 82, -48, 52, -50,
+   82, -108, -19, 21, 36, -105, 44, -16,
+   -56, -40, 41, 18, 115, -39, 77, -34,
+   21, -125, -49, 72, -27, -126, 84, -65,
+   -23, -75, -14, 108, 100, -67, -9, 39,
+   67, 23, 77, -87, 43, -85, 20, -47,
+   24, 35, -35, -126, 115, -56, 29, -24
+};
+
+static const opus_int8 wake_gate_dense_bias[16] = {
+   8, 11, 41, -53, 62, 44, 21, -21,
+   -26, -4, -45, -28, 9, -13, 55, 5
+};
+
+static const opus_int8 wake_gate_gru_weights[768] = {
+   30, -2, 89, 4, 38, -53, -101, 52,
+   -46, -59, 127, 74, 64, 6, 5, -35,
+   13, 17, -53, -14, 13, 18, -30, -13,
+   28, 70, -38, 9, 45, -44, -8, 12,
+   -20, 25, 39, 44, 17, 4, 38, -10,
+   1, -6, 2, 1, -54, -33, 45, -67,
+   9, -29, -2, 31, -20, 68, 65, -11,
+   17, -36, -92, -36, 94, -78, 40, -23,
+   62, 20, 23, -34, 39, -34, 33, -45,
+   -12, -39, 82, -29, -4, -47, -7, -20,
+   -29, -69, 55, 11, 34, 62, -20, 26,
+   -22, -40, -19, -3, -30, 64, -12, 40,
+   1, 27, 26, 87, 88, 79, -39, -9,
+   -54, 62, 49, 27, 76, 36, 69, 15,
+   63, 8, -51, 86, 23, 31, -33, 31,
+   28, 32, -44, 35, 88, 31, 113, 24,
+   -19, -27, 28, 43, -14, 11, 67, -34,
+   59, -48, 1, 51, -22, 42, 41, -14,
+   -8, 7, -87, -37, 40, 1, -11, 111,
+   6, -40, -15, -5, -6, 70, -8, 34,
+   -6, -44, 40, -51, -71, -9, -10, 20,
+   -55, 15, 32, -28, 23, 69, -29, -1,
+   57, 17, -5, -17, 12, -40, -7, 51,
+   53, -60, 54, 61, -25, 13, 6, 11,
+   -9, 17, 14, 37, 83, -50, -16, 82,
+   -26, 19, 21, 70, -7, 66, 12, 52,
+   6, 5, 40, -3, -48, -15, 17, 21,
+   -24, -7, 6, 39, 3, -2, 21, 6,
+   2, -16, 44, 32, -33, 47, -35, -39,
+   10, 33, -23, 53, -27, -43, -39, 35,
+   -19, -82, -22, -10, -16, 56, 68, 12,
+   -73, 88, -8, 20, 88, -77, 51, -17,
+   -16, 126, 59, 81, 64, -97, -44, -20,
+   3, -29, 73, 32, -33, 24, 29, -1,
+   -28, 2, -63, 39, -51, -2, 66, 6,
+   33, 21, 52, -22, -53, 20, -2, 28,
+   18, 5, -11, 127, 25, -19, 2, -43,
+   -60, 43, -70, 0, -25, -88, 13, 68,
+   -19, 102, -18, 10, 72, 16, -9, -55,
+   -9, -24, -57, -55, 14, -82, -63, 12,
+   -7, -36, 42, -9, 7, 12, 8, 19,
+   19, 65, 39, -58, 3, 10, -45, -46,
+   -58, -84, 60, 52, -49, 53, -85, -86,
+   -25, 51, 5, -12, 80, -26, 53, -13,
+   -36, 106, -3, -71, -19, -17, 40, 9,
+   -52, -1, 40, 49, -54, -24, -64, 48,
+   -89, -26, 34, 41, -33, 73, -5, 7,
+   -15, 14, 33, -7, 53, 40, -33, 23,
+   -3, 6, -52, -11, 28, -114, -30, 0,
+   43, -39, 90, 2, -9, 70, -55, 39,
+   -49, 30, 22, -11, -94, 14, -22, -35,
+   -24, -26, -25, 26, -11, -32, -26, -93,
+   -28, -38, 44, 43, -30, -48, -24, 18,
+   23, -76, -50, -32, 80, -49, -54, 51,
+   25, -21, -23, -68, -28, -86, -17, -21,
+   0, -40, 29, 56, -111, 5, -86, 52,
+   -69, -48, 96, 7, 53, 0, 49, 9,
+   -26, 2, 13, 24, -93, 30, -39, -32,
+   33, 43, 19, -32, -6, 39, -34, -56,
+   -5, 33, 50, -1, -5, -29, -56, 48,
+   41, -47, -39, -45, -5, 36, -128, 58,
+   -110, 58, 63, -41, 44, -53, -35, -84,
+   2, -111, 38, -18, -39, -13, 73, 56,
+   35, 23, 101, 10, -54, -32, -17, -48,
+   -27, 53, -20, -12, -15, -14, -45, 75,
+   7, -60, 91, 78, -82, 55, 31, 59,
+   -63, -76, -103, -33, -53, -128, 14, -53,
+   15, -104, 64, -32, -15, 57, -81, -7,
+   -106, -4, -20, -40, -34, 102, 52, -25,
+   -66, -8, -41, -39, 20, -6, -50, 39,
+   -38, -2, -5, -69, 7, -46, -40, -52,
+   -15, 28, -55, 15, 55, -42, -32, 27,
+   -51, 94, 37, 15, 82, 52, -56, -11,
+   -54, 32, -31, 125, -9, 4, 8, -39,
+   43, -85, -54, -26, 38, 1, 48, 62,
+   19, 4, 64, 55, 24, 23, 31, -40,
+   -19, 57, 39, 23, 35, 30, 26, 11,
+   -9, 68, -28, -48, -65, 54, 41, -7,
+   15, -88, -9, -44, -60, -58, 32, -8,
+   21, -53, 56, -36, 3, 85, -6, -39,
+   -58, -4, 42, 42, -83, 83, 25, 1,
+   -19, -43, -1, -42, -57, -2, -50, 0,
+   -3, -31, -11, -16, -57, -32, -22, -51,
+   -28, -74, -38, -42, 45, -74, -83, -13,
+   -55, -36, -17, 74, 10, -40, 89, 17,
+   18, 1, -25, 60, -52, 8, 53, 2,
+   3, 10, 11, -1, -1, 21, 52, -22,
+   52, -27, 13, 55, -19, 46, 22, -41,
+   -40, -19, 51, 9, -1, -2, -16, 6,
+   11, -5, -27, 21, -31, 25, 62, -5,
+   -1, 5, -28, -30, -49, 34, 36, -57,
+   23, -75, 33, 57, 18, 20, 42, 40,
+   6, 10, 43, 20, 3, -33, -5, -38,
+   23, -72, -55, 7, 19, -34, 8, 78,
+   -10, -29, 36, 28, 59, -54, 11, -13,
+   -10, 6, 7, -29, 23, -44, 36, 32
+};
+
+static const opus_int8 wake_gate_gru_recur_weights[768] = {
+   60, 11, -77, -65, 23, -76, -28, 126,
+   -54, -92, 125, 8, -35, 21, -84, -28,
+   11, 31, -60, -30, 26, 40, -2, -3,
+   -42, 1, -38, -39, 38, 61, 9, 35,
+   64, -56, -34, -10, -19, -63, -48, 3,
+   -47, 32, -20, 18, -14, -29, 25, 53,
+   90, -27, 50, 107, -50, 9, 7, -1,
+   -29, -4, -19, -25, 43, -96, 15, -7,
+   -24, -66, -48, -41, 49, 19, 9, 42,
+   -22, 19, 23, -64, 28, 45, 31, 50,
+   77, 49, -51, -68, -32, -64, 0, 27,
+   78, -37, 17, 100, 27, 0, -11, 115,
+   -78, 28, -36, 95, 83, -79, 25, 123,
+   27, 40, 63, 71, 14, -37, -63, 24,
+   21, 12, 37, -34, -25, -4, 60, -7,
+   60, 17, -77, 109, -21, 50, 48, -48,
+   -85, -91, 4, 82, 87, -15, 13, -60,
+   -58, 13, -36, -115, -43, -73, 51, -87,
+   -37, 25, -113, -58, -61, -39, -25, 99,
+   -6, -10, 46, 62, 1, 4, -51, -124,
+   67, -1, 29, -15, -47, 21, -12, 10,
+   41, -37, 22, 86, -46, -78, -38, -19,
+   24, -40, 45, 50, -25, 28, 26, 40,
+   -93, 33, 51, -4, -39, -23, -38, -39,
+   9, -128, -128, 1, -52, -47, 118, 122,
+   -12, -120, -105, 13, -85, -61, -71, 57,
+   36, 14, -8, -4, -25, -89, 27, 44,
+   70, 7, -65, 62, 59, 3, -4, 41,
+   -16, 38, 0, 1, 31, 26, 10, -25,
+   -99, -36, 31, -19, 60, -120, 14, 2,
+   -39, 71, 106, 127, 30, 7, 20, 83,
+   19, 127, -16, -14, 6, -56, 60, 36,
+   30, -4, 17, -43, -38, -7, 79, 105,
+   96, 23, 114, 10, -33, 4, -70, -44,
+   -21, -77, 74, 82, 11, 3, 86, 20,
+   53, 125, -62, -51, -53, 75, 26, -111,
+   -39, 17, -44, -102, -26, 22, -28, -40,
+   3, -24, 50, 71, -18, 9, -65, -66,
+   -19, 12, 11, 8, -19, -3, -31, 33,
+   54, 4, 18, 40, -87, -23, 13, 34,
+   37, -9, -31, -24, 41, -88, -21, 93,
+   43, -48, 126, -13, 47, 29, 38, 7,
+   112, -28, -15, -118, -35, 27, -23, -109,
+   8, -83, -54, -5, -31, 58, -37, 18,
+   -5, -10, -22, -42, 34, -64, 26, 21,
+   -24, -5, -57, 41, -6, -79, -3, 65,
+   14, -11, -4, 17, -5, -71, -29, 20,
+   -31, -33, 24, -25, 59, -38, -4, -29,
+   -57, 79, 63, 7, 15, -13, -22, 8,
+   -12, 92, 39, -71, -28, 45, 49, -34,
+   -19, 35, -21, 18, 2, -41, -43, 6,
+   6, -37, -34, 14, 23, 21, 33, 29,
+   36, 54, 27, 59, -37, 15, -21, -47,
+   90, -18, 2, 63, 47, 64, 68, 90,
+   -8, 1, -52, -20, 13, -43, 54, 48,
+   -81, 0, -44, -30, -92, 41, -36, -27,
+   38, -25, 27, 29, -29, -11, 76, -3,
+   72, 10, -39, 17, 48, 40, 11, -88,
+   -25, -77, -20, 64, 74, 39, 34, -35,
+   -48, 50, -1, -75, 3, -16, 29, -28,
+   60, -113, -48, -35, -80, 29, 31, -15,
+   32, -21, -72, -6, 42, -79, 29, -62,
+   -13, -3, -57, -4, -64, -76, 60, -7,
+   -9, -32, 0, 16, -94, 27, -27, -28,
+   75, -32, 17, -39, 6, -82, 7, 18,
+   -62, -13, 57, -16, 53, -13, 22, 15,
+   10, -30, -8, 69, -6, 44, 35, -38,
+   37, 115, 35, -12, 34, 15, 6, -56,
+   -10, 13, -13, 85, -7, -8, -24, 29,
+   7, 16, 28, -59, 45, -21, -21, 17,
+   -48, -58, -25, -3, -26, -11, -126, -2,
+   -55, 59, 17, 42, 38, -85, -67, -11,
+   -46, 24, -14, -114, -33, 96, -111, -107,
+   5, -29, -18, -60, -2, 75, -107, -63,
+   26, 32, 21, -34, -63, 31, -44, -100,
+   -85, 35, -29, 20, 21, -37, -45, 62,
+   17, 18, -77, 18, -84, -33, -62, -67,
+   63, -37, -35, 55, 82, -10, -84, 41,
+   -112, 52, -5, 26, -39, -85, -61, 8,
+   22, -4, 6, -108, -36, 86, 23, -47,
+   -46, 17, -32, -23, -95, -35, -41, -5,
+   15, -36, -21, -32, -51, 27, 2, -55,
+   127, -18, -68, 56, -50, -26, 16, 56,
+   69, -18, 41, 94, 17, 61, 20, -14,
+   -30, 21, -47, 33, -28, -27, 51, 61,
+   -40, -51, -44, -5, -79, -43, -15, -15,
+   5, 28, -13, -16, -23, -24, 19, -18,
+   48, 25, -56, 62, 48, 34, -29, 38,
+   -22, -20, 77, 73, 53, 38, 12, 25,
+   9, 16, 60, -6, 8, -6, 65, -17,
+   36, 20, 127, 67, -47, 17, -71, -36,
+   27, 126, 17, 57, 95, -46, 92, 22,
+   -9, -21, 32, -35, 14, -33, 60, 29,
+   -59, -47, 127, -18, -13, 18, -3, -28,
+   6, -17, -25, -45, -75, 11, -9, -61,
+   54, -45, -76, -29, 12, 45, 44, 90
+};
+
+static const opus_int8 wake_gate_gru_bias[48] = {
+   -51, 11, 32, 59, 50, -11, 44, 92,
+   -38, 46, 6, 36, 15, 19, 24, 49,
+   9, 14, 37, 22, 9, 33, 2, 11,
+   15, 33, 5, 12, 35, 48, 19, -9,
+   -3, -16, 10, 17, -1, 19, 1, -11,
+   -27, 5, -10, -1, -15, -12, 14, -9
+};
+
+static const opus_int8 wake_gate_output_weights[16] = {
+   126, 127, -128, -128, -34, -128, -11, 59,
+   127, -128, 28, 105, 75, 115, -118, 78
+};
+
+static const opus_int8 wake_gate_output_bias[1] = {
+   15
+};
+
+const DenseLayer wake_gate_dense = {
+   wake_gate_dense_bias,
+   wake_gate_dense_weights,
+   26, 16, 0
+};
+
+const GRULayer wake_gate_gru = {
+   wake_gate_gru_bias,
+   wake_gate_gru_weights,
+   wake_gate_gru_recur_weights,
+   16, 16
+};
+
+const DenseLayer wake_gate_output = {
+   wake_gate_output_bias,
+   wake_gate_output_weights,
+   16, 1, 1
+};
@@ -0,0 +1,590 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Checks the SILK-only encoder and decoder against the regular ones, and
+   reports how much smaller and faster to set up they are. Also compares the
+   CBR rate control with and without the gain prediction. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "opus.h"
+#include "opus_silk.h"
+#include "test_opus_common.h"
+#include "../src/opus_private.h"
+
+#ifndef M_PI
+#define M_PI 3.141592653
+#endif
+
+#define MAX_PACKET 1500
+#define MAX_FRAME (48000*60/1000)
+#define NB_FRAMES 300
+#define INIT_LOOPS 2000
+
+typedef struct {
+  opus_int32 Fs;
+  int channels;
+  int frame_ms;
+  opus_int32 bitrate;
+  int vbr;
+  int fec;
+  int dtx;
+} SilkConfig;
+
+static double phase;
+
+/* A gliding harmonic tone with a syllable envelope and some noise, with a
+   silent stretch every few seconds for the DTX */
+static void gen_voice(opus_int16 *pcm, int frame, int frame_size, opus_int32 Fs, int channels)
+{
+  int i, j;
+  double f0 = 120+40*sin(2*M_PI*frame/97.);
+  double env = frame%150 >= 100 ? 0 : .2+.8*fabs(sin(2*M_PI*frame/23.));
+  for (i=0;i<frame_size;i++)
+  {
+    double v = 0;
+    phase += 2*M_PI*f0/Fs;
+    for (j=1;j<=8;j++)
+      v += sin(j*phase)/j;
+    v = env*.2*v;
+    for (j=0;j<channels;j++)
+      pcm[i*channels+j] = (opus_int16)floor(.5+32767*(v
+            + (env > 0 ? .01*(((int)(fast_rand()%2001))-1000)/1000. : 0)));
+  }
+}
+
+static int is_silk_only(const unsigned char *packet)
+{
+  return !(packet[0]&0x80) && (packet[0]&0x60) != 0x60;
+}
+
+static double usec_per_call(clock_t t, int n)
+{
+  return 1e6*t/CLOCKS_PER_SEC/n;
+}
+
+static void report_sizes(void)
+{
+  int c;
+  for (c=1;c<=2;c++)
+  {
+    int full_enc, lean_enc, full_dec, lean_dec;
+    full_enc = opus_encoder_get_size(c);
+    lean_enc = opus_silk_encoder_get_size(c);
+    full_dec = opus_decoder_get_size(c);
+    lean_dec = opus_silk_decoder_get_size(c);
+    fprintf(stderr, "  %d ch: encoder %d -> %d bytes, decoder %d -> %d bytes,"
+          " session %d -> %d bytes\n", c, full_enc, lean_enc, full_dec, lean_dec,
+          full_enc+full_dec, lean_enc+lean_dec);
+    if (lean_enc <= 0 || lean_dec <= 0 || lean_enc >= full_enc || lean_dec >= full_dec)
+      test_failed();
+  }
+  if (opus_silk_encoder_get_size(0) != 0 || opus_silk_decoder_get_size(3) != 0)
+    test_failed();
+}
+
+static void report_init_times(void)
+{
+  void *full_enc, *lean_enc, *full_dec, *lean_dec;
+  clock_t t[4];
+  int i;
+  full_enc = malloc(opus_encoder_get_size(1));
+  lean_enc = malloc(opus_silk_encoder_get_size(1));
+  full_dec = malloc(opus_decoder_get_size(1));
+  lean_dec = malloc(opus_silk_decoder_get_size(1));
+  if (!full_enc || !lean_enc || !full_dec || !lean_dec)
+    test_failed();
+  t[0] = clock();
+  for (i=0;i<INIT_LOOPS;i++)
+    if (opus_encoder_init((OpusEncoder*)full_enc, 16000, 1, OPUS_APPLICATION_VOIP) != OPUS_OK)
+      test_failed();
+  t[0] = clock()-t[0];
+  t[1] = clock();
+  for (i=0;i<INIT_LOOPS;i++)
+    if (opus_silk_encoder_init((OpusSilkEncoder*)lean_enc, 16000, 1) != OPUS_OK)
+      test_failed();
+  t[1] = clock()-t[1];
+  t[2] = clock();
+  for (i=0;i<INIT_LOOPS;i++)
+    if (opus_decoder_init((OpusDecoder*)full_dec, 16000, 1) != OPUS_OK)
+      test_failed();
+  t[2] = clock()-t[2];
+  t[3] = clock();
+  for (i=0;i<INIT_LOOPS;i++)
+    if (opus_silk_decoder_init((OpusSilkDecoder*)lean_dec, 16000, 1) != OPUS_OK)
+      test_failed();
+  t[3] = clock()-t[3];
+  fprintf(stderr, "  16 kHz mono init: encoder %.2f -> %.2f us, decoder %.2f -> %.2f us\n",
+        usec_per_call(t[0], INIT_LOOPS), usec_per_call(t[1], INIT_LOOPS),
+        usec_per_call(t[2], INIT_LOOPS), usec_per_call(t[3], INIT_LOOPS));
+  free(full_enc);
+  free(lean_enc);
+  free(full_dec);
+  free(lean_dec);
+}
+
+/* Decodes a packet (or a loss, or FEC) with both decoders and checks that
+   they agree to the sample. */
+static void decode_both(OpusDecoder *full, OpusSilkDecoder *lean, const unsigned char *packet,
+      int len, int frame_size, int channels, int fec)
+{
+  opus_int16 out_full[MAX_FRAME*2], out_lean[MAX_FRAME*2];
+  opus_uint32 rng_full, rng_lean;
+  int ret_full, ret_lean;
+  ret_full = opus_decode(full, packet, len, out_full, frame_size, fec);
+  ret_lean = opus_silk_decode(lean, packet, len, out_lean, frame_size, fec);
+  if (ret_full != frame_size || ret_lean != ret_full)
+    test_failed();
+  if (memcmp(out_full, out_lean, ret_full*channels*sizeof(*out_full)))
+    test_failed();
+  if (opus_decoder_ctl(full, OPUS_GET_FINAL_RANGE(&rng_full)) != OPUS_OK
+        || opus_silk_decoder_ctl(lean, OPUS_GET_FINAL_RANGE(&rng_lean)) != OPUS_OK
+        || rng_full != rng_lean)
+    test_failed();
+}
+
+static void test_config(const SilkConfig *cfg)
+{
+  OpusSilkEncoder *enc;
+  OpusDecoder *full_dec;
+  OpusSilkDecoder *lean_dec;
+  opus_int16 pcm[MAX_FRAME*2];
+  unsigned char packets[2][MAX_PACKET];
+  int lens[2];
+  opus_uint32 rngs[2];
+  int frame, err, frame_size, cbr_len, dtx_frames, lost_frames, low_bw_frames;
+  opus_int32 total_bytes;
+  frame_size = cfg->Fs*cfg->frame_ms/1000;
+  enc = opus_silk_encoder_create(cfg->Fs, cfg->channels, &err);
+  if (err != OPUS_OK || !enc) test_failed();
+  full_dec = opus_decoder_create(cfg->Fs, cfg->channels, &err);
+  if (err != OPUS_OK || !full_dec) test_failed();
+  lean_dec = opus_silk_decoder_create(cfg->Fs, cfg->channels, &err);
+  if (err != OPUS_OK || !lean_dec) test_failed();
+  if (opus_silk_encoder_ctl(enc, OPUS_SET_BITRATE(cfg->bitrate)) != OPUS_OK
+        || opus_silk_encoder_ctl(enc, OPUS_SET_VBR(cfg->vbr)) != OPUS_OK
+        || opus_silk_encoder_ctl(enc, OPUS_SET_INBAND_FEC(cfg->fec)) != OPUS_OK
+        || opus_silk_encoder_ctl(enc, OPUS_SET_PACKET_LOSS_PERC(cfg->fec ? 20 : 0)) != OPUS_OK
+        || opus_silk_encoder_ctl(enc, OPUS_SET_DTX(cfg->dtx)) != OPUS_OK)
+    test_failed();
+  if (opus_silk_encoder_ctl(enc, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY)) != OPUS_UNIMPLEMENTED)
+    test_failed();
+
+  cbr_len = -1;
+  dtx_frames = lost_frames = low_bw_frames = 0;
+  total_bytes = 0;
+  phase = 0;
+  for (frame=0;frame<=NB_FRAMES;frame++)
+  {
+    int cur = frame&1;
+    /* The last round only flushes the previous packet */
+    if (frame < NB_FRAMES)
+    {
+      /* Halve the rate half way. At 16 kb/s, this takes SILK below wideband
+         in the next silent stretch. */
+      if (frame == NB_FRAMES/2
+            && opus_silk_encoder_ctl(enc, OPUS_SET_BITRATE(cfg->bitrate/2)) != OPUS_OK)
+        test_failed();
+      gen_voice(pcm, frame, frame_size, cfg->Fs, cfg->channels);
+      lens[cur] = opus_silk_encode(enc, pcm, frame_size, packets[cur], MAX_PACKET);
+      if (lens[cur] <= 0 || !is_silk_only(packets[cur])
+            || opus_packet_get_samples_per_frame(packets[cur], cfg->Fs) != frame_size
+            || opus_packet_get_nb_channels(packets[cur]) != cfg->channels)
+        test_failed();
+      if (opus_silk_encoder_ctl(enc, OPUS_GET_FINAL_RANGE(&rngs[cur])) != OPUS_OK)
+        test_failed();
+      total_bytes += lens[cur];
+      if (opus_packet_get_bandwidth(packets[cur]) < OPUS_BANDWIDTH_WIDEBAND)
+        low_bw_frames++;
+      if (lens[cur] == 1)
+        dtx_frames++;
+      else if (!cfg->vbr)
+      {
+        if (cbr_len < 0)
+          cbr_len = lens[cur];
+        else if (lens[cur] != cbr_len && frame != NB_FRAMES/2)
+          test_failed();
+        cbr_len = lens[cur];
+      }
+    }
+    if (frame == 0)
+      continue;
+    /* Decode the previous packet, so that its loss can be covered by the FEC
+       in the current one */
+    if (frame%9 == 4)
+    {
+      lost_frames++;
+      if (cfg->fec && frame < NB_FRAMES)
+        decode_both(full_dec, lean_dec, packets[cur], lens[cur], frame_size, cfg->channels, 1);
+      else
+        decode_both(full_dec, lean_dec, NULL, 0, frame_size, cfg->channels, 0);
+    } else {
+      opus_uint32 dec_rng;
+      decode_both(full_dec, lean_dec, packets[!cur], lens[!cur], frame_size, cfg->channels, 0);
+      if (opus_silk_decoder_ctl(lean_dec, OPUS_GET_FINAL_RANGE(&dec_rng)) != OPUS_OK
+            || dec_rng != rngs[!cur])
+        test_failed();
+    }
+  }
+  fprintf(stderr, "  %5d Hz %d ch %2d ms %5d b/s %s%s%s: %d bytes/frame, %d below WB, %d DTX, %d lost\n",
+        (int)cfg->Fs, cfg->channels, cfg->frame_ms, (int)cfg->bitrate, cfg->vbr ? "VBR" : "CBR",
+        cfg->fec ? " FEC" : "", cfg->dtx ? " DTX" : "", (int)(total_bytes/NB_FRAMES),
+        low_bw_frames, dtx_frames, lost_frames);
+  if (cfg->dtx && dtx_frames == 0)
+    test_failed();
+  if (!cfg->dtx && dtx_frames != 0)
+    test_failed();
+  opus_silk_encoder_destroy(enc);
+  opus_decoder_destroy(full_dec);
+  opus_silk_decoder_destroy(lean_dec);
+}
+
+/* SILK-only packets from the regular encoder decode the same way, and the
+   other modes are turned down. The bandwidth is fixed because the regular
+   encoder adds a CELT redundancy frame on a switch, which the SILK-only
+   decoder skips. */
+static void test_full_encoder(void)
+{
+  OpusEncoder *enc;
+  OpusDecoder *full_dec;
+  OpusSilkDecoder *lean_dec;
+  opus_int16 pcm[960*2], out[960*2];
+  unsigned char packet[MAX_PACKET];
+  int frame, err, len;
+  enc = opus_encoder_create(16000, 2, OPUS_APPLICATION_VOIP, &err);
+  if (err != OPUS_OK || !enc) test_failed();
+  full_dec = opus_decoder_create(16000, 2, &err);
+  if (err != OPUS_OK || !full_dec) test_failed();
+  lean_dec = opus_silk_decoder_create(16000, 2, &err);
+  if (err != OPUS_OK || !lean_dec) test_failed();
+  if (opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(MODE_SILK_ONLY)) != OPUS_OK
+        || opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_WIDEBAND)) != OPUS_OK
+        || opus_encoder_ctl(enc, OPUS_SET_BITRATE(32000)) != OPUS_OK
+        || opus_encoder_ctl(enc, OPUS_SET_INBAND_FEC(1)) != OPUS_OK
+        || opus_encoder_ctl(enc, OPUS_SET_PACKET_LOSS_PERC(10)) != OPUS_OK)
+    test_failed();
+  phase = 0;
+  for (frame=0;frame<NB_FRAMES;frame++)
+  {
+    gen_voice(pcm, frame, 320, 16000, 2);
+    len = opus_encode(enc, pcm, 320, packet, MAX_PACKET);
+    if (len <= 0 || !is_silk_only(packet))
+      test_failed();
+    if (frame%11 == 5)
+      decode_both(full_dec, lean_dec, packet, len, 320, 2, 1);
+    decode_both(full_dec, lean_dec, packet, len, 320, 2, 0);
+  }
+  /* A CELT-only packet, after the SILK frame that carries the transition */
+  if (opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY)) != OPUS_OK)
+    test_failed();
+  for (frame=0;frame<2;frame++)
+    len = opus_encode(enc, pcm, 320, packet, MAX_PACKET);
+  if (len <= 0 || is_silk_only(packet))
+    test_failed();
+  if (opus_silk_decode(lean_dec, packet, len, out, 320, 0) != OPUS_UNIMPLEMENTED)
+    test_failed();
+  opus_encoder_destroy(enc);
+  opus_decoder_destroy(full_dec);
+  opus_silk_decoder_destroy(lean_dec);
+  fprintf(stderr, "  regular encoder SILK-only packets: OK\n");
+}
+
+static void test_api(void)
+{
+  OpusSilkEncoder *enc;
+  OpusSilkDecoder *dec;
+  opus_int16 pcm[320];
+  unsigned char packet[MAX_PACKET];
+  opus_int32 value;
+  int err, len;
+  if (opus_silk_encoder_create(44100, 1, &err) != NULL || err != OPUS_BAD_ARG)
+    test_failed();
+  if (opus_silk_decoder_create(16000, 3, &err) != NULL || err != OPUS_BAD_ARG)
+    test_failed();
+  enc = opus_silk_encoder_create(16000, 1, &err);
+  if (err != OPUS_OK || !enc) test_failed();
+  dec = opus_silk_decoder_create(16000, 1, &err);
+  if (err != OPUS_OK || !dec) test_failed();
+  memset(pcm, 0, sizeof(pcm));
+  /* 5 ms and 30 ms are not SILK frame sizes */
+  if (opus_silk_encode(enc, pcm, 80, packet, MAX_PACKET) != OPUS_BAD_ARG
+        || opus_silk_encode(enc, pcm, 480, packet, MAX_PACKET) != OPUS_BAD_ARG
+        || opus_silk_encode(enc, pcm, 320, packet, 0) != OPUS_BAD_ARG)
+    test_failed();
+  if (opus_silk_encoder_ctl(enc, OPUS_SET_COMPLEXITY(11)) != OPUS_BAD_ARG
+        || opus_silk_encoder_ctl(enc, OPUS_SET_MAX_BANDWIDTH(OPUS_BANDWIDTH_FULLBAND)) != OPUS_OK
+        || opus_silk_encoder_ctl(enc, OPUS_GET_MAX_BANDWIDTH(&value)) != OPUS_OK
+        || value != OPUS_BANDWIDTH_WIDEBAND)
+    test_failed();
+  if (opus_silk_encoder_ctl(enc, OPUS_GET_SAMPLE_RATE(&value)) != OPUS_OK || value != 16000
+        || opus_silk_decoder_ctl(dec, OPUS_GET_SAMPLE_RATE(&value)) != OPUS_OK || value != 16000)
+    test_failed();
+  if (opus_silk_decoder_ctl(dec, OPUS_SET_GAIN(0)) != OPUS_UNIMPLEMENTED)
+    test_failed();
+  /* Nothing decoded yet: the PLC returns silence, in 10 ms steps only */
+  pcm[0] = 1;
+  if (opus_silk_decode(dec, NULL, 0, pcm, 160, 0) != 160 || pcm[0] != 0)
+    test_failed();
+  if (opus_silk_decode(dec, NULL, 0, pcm, 80, 0) != OPUS_BAD_ARG)
+    test_failed();
+  /* Low rates and small buffers switch to narrowband, then to PLC frames */
+  if (opus_silk_encoder_ctl(enc, OPUS_SET_BITRATE(6000)) != OPUS_OK)
+    test_failed();
+  len = opus_silk_encode(enc, pcm, 320, packet, MAX_PACKET);
+  if (len <= 0 || opus_packet_get_bandwidth(packet) != OPUS_BANDWIDTH_NARROWBAND)
+    test_failed();
+  if (opus_silk_encode(enc, pcm, 320, packet, 2) != 1)
+    test_failed();
+  if (opus_silk_encoder_ctl(enc, OPUS_RESET_STATE) != OPUS_OK
+        || opus_silk_decoder_ctl(dec, OPUS_RESET_STATE) != OPUS_OK
+        || opus_silk_decoder_ctl(dec, OPUS_GET_LAST_PACKET_DURATION(&value)) != OPUS_OK
+        || value != 0)
+    test_failed();
+  opus_silk_encoder_destroy(enc);
+  opus_silk_decoder_destroy(dec);
+  fprintf(stderr, "  API checks: OK\n");
+}
+
+/* The detector must follow the syllables and the silent stretches of
+   gen_voice(), at every input rate and with both frame sizes */
+static void test_vad(opus_int32 Fs, int frame_ms)
+{
+  OpusSilkVad *vad;
+  opus_int16 pcm[960];
+  int frame_size = Fs/1000*frame_ms;
+  int frame, err, sa;
+  int voiced_sum=0, voiced_count=0, silent_max=0;
+  if (opus_silk_vad_create(44100, &err) != NULL || err != OPUS_BAD_ARG)
+    test_failed();
+  vad = opus_silk_vad_create(Fs, &err);
+  if (err != OPUS_OK || !vad) test_failed();
+  if (opus_silk_vad_process(vad, pcm, Fs/200) != OPUS_BAD_ARG)
+    test_failed();
+  phase = 0;
+  for (frame=0;frame<600;frame++)
+  {
+    /* gen_voice() works in 20 ms steps */
+    int step = frame*frame_ms/20;
+    gen_voice(pcm, step, frame_size, Fs, 1);
+    sa = opus_silk_vad_process(vad, pcm, frame_size);
+    if (sa < 0 || sa > 255) test_failed();
+    /* Skip the start-up and the first frames after each edge */
+    if (step < 50 || step%150 < 5 || (step%150 >= 100 && step%150 < 110))
+      continue;
+    if (step%150 < 100)
+    {
+      voiced_sum += sa;
+      voiced_count++;
+    } else if (sa > silent_max)
+      silent_max = sa;
+  }
+  fprintf(stderr, "  VAD %5d Hz, %d ms: mean activity %3d in speech, at most %3d in silence\n",
+        (int)Fs, frame_ms, voiced_sum/voiced_count, silent_max);
+  if (voiced_sum/voiced_count < 200 || silent_max > 20)
+    test_failed();
+  /* Both encoders take over the detector state */
+  {
+    OpusEncoder *full = opus_encoder_create(Fs, 2, OPUS_APPLICATION_VOIP, &err);
+    OpusSilkEncoder *lean = opus_silk_encoder_create(Fs, 1, &err);
+    if (!full || !lean) test_failed();
+    if (opus_encoder_ctl(full, OPUS_SET_VAD_STATE(vad)) != OPUS_OK
+          || opus_silk_encoder_ctl(lean, OPUS_SET_VAD_STATE(vad)) != OPUS_OK
+          || opus_encoder_ctl(full, OPUS_SET_VAD_STATE((const OpusSilkVad *)NULL)) != OPUS_BAD_ARG)
+      test_failed();
+    opus_encoder_destroy(full);
+    opus_silk_encoder_destroy(lean);
+  }
+  opus_silk_vad_destroy(vad);
+}
+
+typedef struct {
+  opus_uint32 frames;
+  opus_uint32 iterations;
+  opus_uint32 unused_bits;
+  clock_t time;
+} RateStats;
+
+static void encode_cbr(OpusEncoder *full, OpusSilkEncoder *lean, int frame_size, int channels,
+      opus_int32 bitrate, RateStats *stats)
+{
+  opus_int16 pcm[MAX_FRAME*2];
+  unsigned char packet[MAX_PACKET];
+  int frame, len;
+  int bytes = bitrate/8*frame_size/16000;
+  clock_t t = 0;
+  phase = 0;
+  for (frame=0;frame<NB_FRAMES;frame++)
+  {
+    clock_t start;
+    gen_voice(pcm, frame, frame_size, 16000, channels);
+    start = clock();
+    if (full)
+      len = opus_encode(full, pcm, frame_size, packet, MAX_PACKET);
+    else
+      len = opus_silk_encode(lean, pcm, frame_size, packet, MAX_PACKET);
+    t += clock()-start;
+    /* Constant bitrate: the packets are padded to the same size */
+    if (len != bytes) test_failed();
+  }
+  if (full)
+  {
+    if (opus_encoder_ctl(full, OPUS_GET_SILK_RATE_FRAMES(&stats->frames)) != OPUS_OK
+          || opus_encoder_ctl(full, OPUS_GET_SILK_RATE_ITERATIONS(&stats->iterations)) != OPUS_OK
+          || opus_encoder_ctl(full, OPUS_GET_SILK_RATE_UNUSED_BITS(&stats->unused_bits)) != OPUS_OK)
+      test_failed();
+  } else {
+    if (opus_silk_encoder_ctl(lean, OPUS_GET_SILK_RATE_FRAMES(&stats->frames)) != OPUS_OK
+          || opus_silk_encoder_ctl(lean, OPUS_GET_SILK_RATE_ITERATIONS(&stats->iterations)) != OPUS_OK
+          || opus_silk_encoder_ctl(lean, OPUS_GET_SILK_RATE_UNUSED_BITS(&stats->unused_bits)) != OPUS_OK)
+      test_failed();
+  }
+  stats->time = t;
+}
+
+/* Runs the CBR rate control loop with and without the gain prediction: the
+   prediction must take fewer quantizer runs per frame without missing the
+   budgets by more */
+static void test_rate_control(int use_full, int channels, int frame_ms, opus_int32 bitrate)
+{
+  OpusEncoder *full = NULL;
+  OpusSilkEncoder *lean = NULL;
+  RateStats stats[2];
+  opus_int32 value;
+  opus_uint32 count;
+  int frame_size = 16*frame_ms;
+  int err, pred;
+  for (pred=0;pred<=1;pred++)
+  {
+    if (use_full)
+    {
+      full = opus_encoder_create(16000, channels, OPUS_APPLICATION_VOIP, &err);
+      if (err != OPUS_OK || !full) test_failed();
+      /* The settings of the app's streaming encoder */
+      if (opus_encoder_ctl(full, OPUS_SET_VBR(0)) != OPUS_OK
+            || opus_encoder_ctl(full, OPUS_SET_BITRATE(bitrate)) != OPUS_OK
+            || opus_encoder_ctl(full, OPUS_SET_COMPLEXITY(8)) != OPUS_OK
+            || opus_encoder_ctl(full, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE)) != OPUS_OK
+            || opus_encoder_ctl(full, OPUS_GET_SILK_GAIN_PREDICTION(&value)) != OPUS_OK
+            || value != 1
+            || opus_encoder_ctl(full, OPUS_SET_SILK_GAIN_PREDICTION(2)) != OPUS_BAD_ARG
+            || opus_encoder_ctl(full, OPUS_GET_SILK_RATE_FRAMES((opus_uint32 *)NULL)) != OPUS_BAD_ARG
+            || opus_encoder_ctl(full, OPUS_SET_SILK_GAIN_PREDICTION(pred)) != OPUS_OK)
+        test_failed();
+    } else {
+      lean = opus_silk_encoder_create(16000, channels, &err);
+      if (err != OPUS_OK || !lean) test_failed();
+      if (opus_silk_encoder_ctl(lean, OPUS_SET_VBR(0)) != OPUS_OK
+            || opus_silk_encoder_ctl(lean, OPUS_SET_BITRATE(bitrate)) != OPUS_OK
+            || opus_silk_encoder_ctl(lean, OPUS_GET_SILK_GAIN_PREDICTION(&value)) != OPUS_OK
+            || value != 1
+            || opus_silk_encoder_ctl(lean, OPUS_SET_SILK_GAIN_PREDICTION(pred)) != OPUS_OK)
+        test_failed();
+    }
+    encode_cbr(full, lean, frame_size, channels, bitrate, &stats[pred]);
+    if (stats[pred].frames == 0 || stats[pred].iterations < stats[pred].frames
+          || stats[pred].iterations > 7*stats[pred].frames)
+      test_failed();
+    /* The counters start over on reset */
+    if (full)
+    {
+      if (opus_encoder_ctl(full, OPUS_RESET_STATE) != OPUS_OK
+            || opus_encoder_ctl(full, OPUS_GET_SILK_RATE_ITERATIONS(&count)) != OPUS_OK
+            || count != 0)
+        test_failed();
+      opus_encoder_destroy(full);
+    } else {
+      if (opus_silk_encoder_ctl(lean, OPUS_RESET_STATE) != OPUS_OK
+            || opus_silk_encoder_ctl(lean, OPUS_GET_SILK_RATE_ITERATIONS(&count)) != OPUS_OK
+            || count != 0)
+        test_failed();
+      opus_silk_encoder_destroy(lean);
+    }
+  }
+  fprintf(stderr, "  CBR %s %d ch %2d ms %5d b/s: %.2f -> %.2f quantizer runs/frame, "
+        "%.1f -> %.1f unused bits/frame, %.1f -> %.1f us/frame\n",
+        use_full ? "regular" : "SILK-only", channels, frame_ms, (int)bitrate,
+        (double)stats[0].iterations/stats[0].frames, (double)stats[1].iterations/stats[1].frames,
+        (double)stats[0].unused_bits/stats[0].frames, (double)stats[1].unused_bits/stats[1].frames,
+        usec_per_call(stats[0].time, NB_FRAMES), usec_per_call(stats[1].time, NB_FRAMES));
+  if (stats[1].iterations*10 > stats[0].iterations*9)
+    test_failed();
+  /* Fewer tries may leave a few more bits unused, but not many */
+  if (stats[1].unused_bits > stats[0].unused_bits*5/4 + 4*stats[0].frames)
+    test_failed();
+}
+
+int main(int _argc, char **_argv)
+{
+  static const SilkConfig configs[] = {
+    {16000, 1, 20, 16000, 1, 0, 0},
+    {16000, 1, 20, 24000, 0, 1, 0},
+    {16000, 1, 20, 12000, 1, 1, 1},
+    {16000, 2, 60, 32000, 0, 0, 0},
+    {16000, 1, 40,  8000, 1, 0, 1},
+    {48000, 1, 10, 20000, 1, 1, 0},
+    { 8000, 2, 20, 14000, 0, 1, 1},
+    {12000, 1, 60, 10000, 1, 0, 0}
+  };
+  const char *oversion;
+  unsigned i;
+  if (_argc>2)
+  {
+    fprintf(stderr,"Usage: %s [<seed>]\n",_argv[0]);
+    return 1;
+  }
+  if (_argc>1)
+    iseed=atoi(_argv[1]);
+  else
+    iseed=0;
+  Rw=Rz=iseed;
+  oversion = opus_get_version_string();
+  if (!oversion) test_failed();
+  fprintf(stderr, "Testing %s SILK-only encoder and decoder (Random seed: %u).\n", oversion, iseed);
+
+  report_sizes();
+  report_init_times();
+  test_api();
+  for (i=0;i<sizeof(configs)/sizeof(configs[0]);i++)
+    test_config(&configs[i]);
+  test_full_encoder();
+  test_rate_control(1, 1, 20, 32000);
+  test_rate_control(1, 2, 40, 40000);
+  test_rate_control(0, 1, 20, 16000);
+  test_vad(16000, 20);
+  test_vad(8000, 10);
+  test_vad(48000, 20);
+  test_vad(24000, 10);
+
+  fprintf(stderr, "All SILK-only tests passed.\n");
+  return 0;
+}
@@ -0,0 +1,206 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Checks that the wake word pre-filter stays closed on steady background
+   noise, opens on voiced syllables, and does not depend on how the input is
+   split into calls. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "opus.h"
+#include "opus_wake_gate.h"
+#include "test_opus_common.h"
+
+#ifndef M_PI
+#define M_PI 3.141592653
+#endif
+
+#define FS 16000
+#define NOISE_SECONDS 6
+#define SPEECH_SECONDS 3
+#define TOTAL (FS*(NOISE_SECONDS+SPEECH_SECONDS))
+
+static double uniform(void)
+{
+  return (fast_rand()&0xFFFF)/65536.-.5;
+}
+
+/* Six seconds of low-passed noise with a 50 Hz hum, then the same background
+   with 150 ms syllables on a gliding harmonic voice and pauses between them */
+static void gen_signal(opus_int16 *pcm)
+{
+  int i, j;
+  double lp=0, phase=0;
+  for (i=0;i<TOTAL;i++)
+  {
+    double v;
+    lp = .7*lp + .3*uniform();
+    v = .02*lp + .005*sin(2*M_PI*50*i/FS);
+    if (i >= FS*NOISE_SECONDS)
+    {
+      int t = i-FS*NOISE_SECONDS;
+      int syl = t%(FS/4);
+      double f0 = 110+30*sin(2*M_PI*t/(1.3*FS));
+      double env = syl < FS*3/20 ? sin(M_PI*syl/(FS*3/20.)) : 0;
+      double voice = 0;
+      phase += 2*M_PI*f0/FS;
+      for (j=1;j<=20;j++)
+      {
+        /* A formant around 700 Hz and a weaker one around 1200 Hz */
+        double f = j*f0;
+        double g = 1/(1+pow((f-700)/150, 2)) + .5/(1+pow((f-1200)/200, 2));
+        voice += g*sin(j*phase);
+      }
+      v += .15*env*voice;
+    }
+    pcm[i] = (opus_int16)floor(.5+32767*(v > 1 ? 1 : v < -1 ? -1 : v));
+  }
+}
+
+static void test_detection(const opus_int16 *pcm)
+{
+  OpusWakeGate *gate;
+  int err, i, prob;
+  int noise_max=0, speech_max=0, onset=-1;
+  gate = opus_wake_gate_create(FS, &err);
+  if (err != OPUS_OK || !gate) test_failed();
+  for (i=0;i<TOTAL;i+=160)
+  {
+    prob = opus_wake_gate_process(gate, pcm+i, 160);
+    if (prob < 0 || prob > 255) test_failed();
+    /* Skip the first second, while the noise floor settles */
+    if (i < FS*NOISE_SECONDS)
+    {
+      if (i >= FS && prob > noise_max)
+        noise_max = prob;
+    } else {
+      if (prob > speech_max)
+        speech_max = prob;
+      if (onset < 0 && prob >= 128)
+        onset = (i-FS*NOISE_SECONDS)*1000/FS;
+    }
+  }
+  fprintf(stderr, "  background: at most %3d, syllables: up to %3d, open after %d ms\n",
+        noise_max, speech_max, onset);
+  if (noise_max >= 128 || speech_max < 128 || onset > 500)
+    test_failed();
+  opus_wake_gate_destroy(gate);
+}
+
+/* The output of a call is the highest probability of the 10 ms frames it
+   completes, whatever the call sizes are */
+static void test_chunking(const opus_int16 *pcm)
+{
+  OpusWakeGate *a, *b;
+  int err, i, j, pos, prob_a, prob_b;
+  a = opus_wake_gate_create(FS, &err);
+  if (err != OPUS_OK || !a) test_failed();
+  b = opus_wake_gate_create(FS, &err);
+  if (err != OPUS_OK || !b) test_failed();
+  pos = 0;
+  /* 1280 samples is an 80 ms frame, as the wake word models use */
+  for (i=0;i+1280<=TOTAL;i+=1280)
+  {
+    prob_a = opus_wake_gate_process(a, pcm+i, 1280);
+    prob_b = -1;
+    while (pos < i+1280)
+    {
+      int n = 1+fast_rand()%700;
+      int p;
+      if (n > i+1280-pos)
+        n = i+1280-pos;
+      p = opus_wake_gate_process(b, pcm+pos, n);
+      if (pos/160 != (pos+n)/160 && p > prob_b)
+        prob_b = p;
+      pos += n;
+    }
+    if (prob_a != prob_b)
+      test_failed();
+  }
+  /* A call that completes no frame repeats the last value */
+  j = opus_wake_gate_process(a, pcm, 10);
+  if (j != opus_wake_gate_process(a, pcm, 0))
+    test_failed();
+  opus_wake_gate_destroy(a);
+  opus_wake_gate_destroy(b);
+  fprintf(stderr, "  chunking: OK\n");
+}
+
+static void test_api(const opus_int16 *pcm)
+{
+  OpusWakeGate *gate;
+  int err, i, first, again;
+  if (opus_wake_gate_create(48000, &err) != NULL || err != OPUS_BAD_ARG)
+    test_failed();
+  if (opus_wake_gate_get_size() <= 0 || opus_wake_gate_get_size() > 1024)
+    test_failed();
+  gate = (OpusWakeGate *)malloc(opus_wake_gate_get_size());
+  if (!gate) test_failed();
+  if (opus_wake_gate_init(gate, 8000) != OPUS_BAD_ARG)
+    test_failed();
+  if (opus_wake_gate_init(gate, FS) != OPUS_OK)
+    test_failed();
+  if (opus_wake_gate_process(gate, pcm, -1) != OPUS_BAD_ARG)
+    test_failed();
+  if (opus_wake_gate_process(gate, pcm, 0) != 0)
+    test_failed();
+  /* Init resets the state completely */
+  for (i=0;i<FS;i+=160)
+    first = opus_wake_gate_process(gate, pcm+FS*NOISE_SECONDS+i, 160);
+  if (opus_wake_gate_init(gate, FS) != OPUS_OK)
+    test_failed();
+  for (i=0;i<FS;i+=160)
+    again = opus_wake_gate_process(gate, pcm+FS*NOISE_SECONDS+i, 160);
+  if (first != again)
+    test_failed();
+  free(gate);
+  fprintf(stderr, "  API checks: OK\n");
+}
+
+int main(int _argc, char **_argv)
+{
+  opus_int16 *pcm;
+  (void)_argc;
+  (void)_argv;
+  iseed = 1;
+  Rw = Rz = iseed;
+  fprintf(stderr, "Testing %s wake word pre-filter.\n", opus_get_version_string());
+  pcm = (opus_int16 *)malloc(TOTAL*sizeof(*pcm));
+  if (!pcm) test_failed();
+  gen_signal(pcm);
+  test_api(pcm);
+  test_detection(pcm);
+  test_chunking(pcm);
+  free(pcm);
+  fprintf(stderr, "Tests completed successfully.\n");
+  return 0;
+}
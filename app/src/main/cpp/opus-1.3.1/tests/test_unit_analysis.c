@@ -0,0 +1,225 @@
+/* Copyright (c) 2026 The Dicio contributors
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "celt.h"
+#include "modes.h"
+#include "kiss_fft.h"
+#include "mathops.h"
+#include "stack_alloc.h"
+#include "../src/analysis.h"
+
+#ifndef M_PI
+#define M_PI 3.141592653
+#endif
+
+#ifdef DISABLE_FLOAT_API
+
+int main(void)
+{
+   printf("Tonality analysis bins test skipped (no float API)\n");
+   return 0;
+}
+
+#else
+
+#define N ANALYSIS_FFT_SIZE
+#define N2 (ANALYSIS_FFT_SIZE/2)
+#define FRAMES 2000
+
+typedef struct {
+   float A[N2], dA[N2], d2A[N2];
+   float tonality[N2], tonality2[N2], noisiness[N2];
+} BinState;
+
+/* The x86 version does the same float operations in the same order, the
+   others may fuse multiply-adds */
+#if defined(OVERRIDE_ANALYSIS_BINS) && !defined(__SSE2__)
+#define BIN_TOLERANCE 1e-2f
+#else
+#define BIN_TOLERANCE 0
+#endif
+
+static int compare(const float *a, const float *b, const char *name, int frame)
+{
+   int i;
+   for (i=1;i<N2;i++)
+   {
+      if (!(fabs(a[i]-b[i]) <= BIN_TOLERANCE))
+      {
+         fprintf(stderr, "**%s differs in frame %d bin %d: %.9g vs %.9g**\n",
+               name, frame, i, a[i], b[i]);
+         return 1;
+      }
+   }
+   return 0;
+}
+
+static int check_frame(const kiss_fft_cpx *out, BinState *ref, BinState *opt, int frame)
+{
+   analysis_bins_c(out, ref->A, ref->dA, ref->d2A, ref->tonality, ref->tonality2, ref->noisiness);
+   analysis_bins(out, opt->A, opt->dA, opt->d2A, opt->tonality, opt->tonality2, opt->noisiness);
+   return compare(ref->A, opt->A, "angle", frame)
+         || compare(ref->dA, opt->dA, "angle delta", frame)
+         || compare(ref->d2A, opt->d2A, "angle second delta", frame)
+         || compare(ref->tonality, opt->tonality, "tonality", frame)
+         || compare(ref->tonality2, opt->tonality2, "tonality2", frame)
+         || compare(ref->noisiness, opt->noisiness, "noisiness", frame);
+}
+
+/* Arbitrary spectra, including empty bins, exact zeros and lone large
+   values that take the small-argument and both quadrant paths of atan2 */
+static int test_random_spectra(void)
+{
+   BinState ref, opt;
+   kiss_fft_cpx out[N];
+   int i, frame;
+   memset(&ref, 0, sizeof(ref));
+   memset(&opt, 0, sizeof(opt));
+   for (frame=0;frame<FRAMES;frame++)
+   {
+      int shift = rand()%24;
+      for (i=0;i<N;i++)
+      {
+         int r = rand()%16;
+         if (r == 0)
+            out[i].r = out[i].i = 0;
+         else if (r == 1)
+         {
+            out[i].r = (kiss_fft_scalar)((rand()%3)-1);
+            out[i].i = 0;
+         } else {
+            out[i].r = (kiss_fft_scalar)((rand()%65536)-32768);
+            out[i].i = (kiss_fft_scalar)((rand()%65536)-32768);
+#ifdef FIXED_POINT
+            out[i].r = SHL32(out[i].r, shift%8);
+            out[i].i = SHL32(out[i].i, shift%8);
+#else
+            out[i].r = ldexpf(out[i].r, shift-30);
+            out[i].i = ldexpf(out[i].i, shift-30);
+#endif
+         }
+      }
+      if (check_frame(out, &ref, &opt, frame))
+         return 1;
+   }
+   return 0;
+}
+
+/* Spectra of windowed tones and noise, packed two frames per FFT like
+   tonality_analysis() does, and how long each version takes on them */
+static int test_tone_spectra(void)
+{
+   const CELTMode *m;
+   const kiss_fft_state *kfft;
+   BinState ref, opt;
+   kiss_fft_cpx in[N], out[N];
+   float x[FRAMES*N2+N2];
+   float tone_tonality=0, noise_tonality=0;
+   clock_t ref_time=0, opt_time=0;
+   double phase[3] = {0, 0, 0};
+   int i, frame;
+   m = opus_custom_mode_create(48000, 960, NULL);
+   kfft = m->mdct.kfft[0];
+   memset(&ref, 0, sizeof(ref));
+   memset(&opt, 0, sizeof(opt));
+   for (i=0;i<FRAMES*N2+N2;i++)
+   {
+      phase[0] += 2*M_PI*1000/24000;
+      phase[1] += 2*M_PI*(2500+300*sin(2*M_PI*i/24000.))/24000;
+      phase[2] += 2*M_PI*6100/24000;
+      x[i] = (float)(.3*sin(phase[0]) + .1*sin(phase[1]) + .05*sin(phase[2])
+            + .02*((rand()%2001)-1000)/1000.);
+   }
+   for (frame=0;frame<FRAMES-2;frame++)
+   {
+      const float *x0 = x + frame*N2;
+      clock_t t;
+      int k;
+      for (i=0;i<N2;i++)
+      {
+         float w = .5f-.5f*(float)cos(2*M_PI*(i+.5)/N);
+#ifdef FIXED_POINT
+         in[i].r = (kiss_fft_scalar)floor(.5+w*x0[i]*(1<<28));
+         in[i].i = (kiss_fft_scalar)floor(.5+w*x0[N2+i]*(1<<28));
+         in[N-i-1].r = (kiss_fft_scalar)floor(.5+w*x0[N-i-1]*(1<<28));
+         in[N-i-1].i = (kiss_fft_scalar)floor(.5+w*x0[N+N2-i-1]*(1<<28));
+#else
+         in[i].r = w*x0[i]*32768;
+         in[i].i = w*x0[N2+i]*32768;
+         in[N-i-1].r = w*x0[N-i-1]*32768;
+         in[N-i-1].i = w*x0[N+N2-i-1]*32768;
+#endif
+      }
+      opus_fft(kfft, in, out, opus_select_arch());
+      if (check_frame(out, &ref, &opt, frame))
+         return 1;
+      if (frame >= 10)
+      {
+         /* 1 kHz is bin 20 */
+         tone_tonality += ref.tonality[20];
+         noise_tonality += ref.tonality[150];
+      }
+      t = clock();
+      for (k=0;k<20;k++)
+         analysis_bins_c(out, ref.A, ref.dA, ref.d2A, ref.tonality, ref.tonality2, ref.noisiness);
+      ref_time += clock()-t;
+      t = clock();
+      for (k=0;k<20;k++)
+         analysis_bins(out, opt.A, opt.dA, opt.d2A, opt.tonality, opt.tonality2, opt.noisiness);
+      opt_time += clock()-t;
+   }
+   printf("  C: %.0f ns per frame, selected version: %.0f ns per frame\n",
+         1e9*ref_time/CLOCKS_PER_SEC/(20.*(FRAMES-2)),
+         1e9*opt_time/CLOCKS_PER_SEC/(20.*(FRAMES-2)));
+   if (!(tone_tonality > 5*noise_tonality))
+   {
+      fprintf(stderr, "**tone is not tonal: %f vs %f**\n", tone_tonality, noise_tonality);
+      return 1;
+   }
+   return 0;
+}
+
+int main(void)
+{
+   ALLOC_STACK;
+   srand(0);
+   printf("Testing tonality analysis bins ...\n");
+   if (test_random_spectra() || test_tone_spectra())
+      return 1;
+   printf("Tonality analysis bins passed\n");
+   return 0;
+}
+
+#endif
@@ -1,12 +1,52 @@
 #include <jni.h>
 #include <android/log.h>
 #include <opus.h>
+#include <opus_silk.h>
+#include <opus_wake_gate.h>
 #include <string>
+#include <vector>
+
+#include "audio/audio_thread.h"
+#include "audio/capture_session.h"
+#include "audio/offline_opus_encoder.h"
+#include "audio/opus_frame_assembler.h"
+#include "audio/opus_stream_decoder.h"
+#include "audio/trace_ring.h"
 
 #define LOG_TAG "OpusJNI"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
 #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
 
+namespace {
+
+jint assembleInto(JNIEnv *env, audio::OpusFrameAssembler *pAsm, const jshort *pSamples,
+                  jint length, jbyteArray packets, jintArray packetSizes) {
+    jsize nByteSize = env->GetArrayLength(packets);
+    jsize nMaxPackets = env->GetArrayLength(packetSizes);
+    jbyte *pBytes = env->GetByteArrayElements(packets, 0);
+    jint *pSizes = env->GetIntArrayElements(packetSizes, 0);
+    int nRet = pAsm->push(pSamples, (size_t) length, (uint8_t *) pBytes, (size_t) nByteSize,
+                          pSizes, (size_t) nMaxPackets);
+    if (nRet < 0) {
+        LOGE("❌ opus_encode失败: %d", nRet);
+    }
+    env->ReleaseByteArrayElements(packets, pBytes, 0);
+    env->ReleaseIntArrayElements(packetSizes, pSizes, 0);
+    return nRet;
+}
+
+std::string jstringToString(JNIEnv *env, jstring value) {
+    if (value == nullptr) {
+        return std::string();
+    }
+    const char *chars = env->GetStringUTFChars(value, nullptr);
+    std::string result = chars != nullptr ? chars : "";
+    env->ReleaseStringUTFChars(value, chars);
+    return result;
+}
+
+} // namespace
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL
@@ -27,6 +67,8 @@ Java_org_stypox_dicio_io_audio_OpusNative_createEncoder(JNIEnv *env, jobject thi
         opus_encoder_ctl(pOpusEnc, OPUS_SET_DTX(0));
         opus_encoder_ctl(pOpusEnc, OPUS_SET_INBAND_FEC(0));
         opus_encoder_ctl(pOpusEnc, OPUS_SET_PACKET_LOSS_PERC(0));
+        // 不开CELT_SET_SINGLE_PASS_ENERGY：OpusAudioCodec的配置（16kHz、32kb/s、VOIP语音）下编码器只用SILK，
+        // CELT的粗能量量化根本不执行；这个ctl也只在libopus内部的celt.h里定义
         
         LOGI("✅ Opus编码器创建成功: %dHz, %dch, 复杂度%d, 比特率%d", 
              sampleRateInHz, channelConfig, complexity, bitrate);
@@ -153,4 +195,631 @@ Java_org_stypox_dicio_io_audio_OpusNative_getDecoderSize(JNIEnv *env, jobject th
     return opus_decoder_get_size(channels);
 }
 
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_createSilkEncoder(JNIEnv *env, jobject thiz,
+                                                             jint sampleRateInHz, jint channelConfig,
+                                                             jint complexity, jint bitrate) {
+    int error;
+    OpusSilkEncoder *pSilkEnc = opus_silk_encoder_create(sampleRateInHz, channelConfig, &error);
+    if (pSilkEnc && error == OPUS_OK) {
+        // 与createEncoder相同的CBR配置，但没有分析器和CELT状态
+        opus_silk_encoder_ctl(pSilkEnc, OPUS_SET_VBR(0));
+        opus_silk_encoder_ctl(pSilkEnc, OPUS_SET_BITRATE(bitrate));
+        opus_silk_encoder_ctl(pSilkEnc, OPUS_SET_COMPLEXITY(complexity));
+        opus_silk_encoder_ctl(pSilkEnc, OPUS_SET_DTX(0));
+        opus_silk_encoder_ctl(pSilkEnc, OPUS_SET_INBAND_FEC(0));
+
+        LOGI("✅ SILK编码器创建成功: %dHz, %dch, 复杂度%d, 比特率%d, 状态%d字节",
+             sampleRateInHz, channelConfig, complexity, bitrate,
+             opus_silk_encoder_get_size(channelConfig));
+    } else {
+        LOGE("❌ SILK编码器创建失败: error=%d", error);
+    }
+    return (jlong) pSilkEnc;
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_createSilkDecoder(JNIEnv *env, jobject thiz,
+                                                             jint sampleRateInHz, jint channelConfig) {
+    int error;
+    OpusSilkDecoder *pSilkDec = opus_silk_decoder_create(sampleRateInHz, channelConfig, &error);
+    if (pSilkDec && error == OPUS_OK) {
+        LOGI("✅ SILK解码器创建成功: %dHz, %dch, 状态%d字节", sampleRateInHz, channelConfig,
+             opus_silk_decoder_get_size(channelConfig));
+    } else {
+        LOGE("❌ SILK解码器创建失败: error=%d", error);
+    }
+    return (jlong) pSilkDec;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_encodeSilk(JNIEnv *env, jobject thiz, jlong pSilkEnc,
+                                                      jshortArray samples, jint frameSize,
+                                                      jbyteArray bytes) {
+    OpusSilkEncoder *pEnc = (OpusSilkEncoder *) pSilkEnc;
+    if (!pEnc || !samples || !bytes) {
+        LOGE("❌ encodeSilk: 无效参数");
+        return -1;
+    }
+
+    jshort *pSamples = env->GetShortArrayElements(samples, 0);
+    jsize nSampleSize = env->GetArrayLength(samples);
+    jbyte *pBytes = env->GetByteArrayElements(bytes, 0);
+    jsize nByteSize = env->GetArrayLength(bytes);
+
+    if (nSampleSize < frameSize || nByteSize <= 0) {
+        LOGE("❌ encodeSilk: 数据大小不匹配 samples=%d, frameSize=%d, bytes=%d",
+             nSampleSize, frameSize, nByteSize);
+        env->ReleaseShortArrayElements(samples, pSamples, 0);
+        env->ReleaseByteArrayElements(bytes, pBytes, 0);
+        return -1;
+    }
+
+    int nRet = opus_silk_encode(pEnc, pSamples, frameSize, (unsigned char *) pBytes, nByteSize);
+
+    if (nRet < 0) {
+        LOGE("❌ opus_silk_encode失败: %d", nRet);
+    }
+
+    env->ReleaseShortArrayElements(samples, pSamples, 0);
+    env->ReleaseByteArrayElements(bytes, pBytes, 0);
+    return nRet;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_decodeSilk(JNIEnv *env, jobject thiz, jlong pSilkDec,
+                                                      jbyteArray bytes, jint bytesLength,
+                                                      jshortArray samples, jint frameSize) {
+    OpusSilkDecoder *pDec = (OpusSilkDecoder *) pSilkDec;
+    if (!pDec || !samples || !bytes) {
+        LOGE("❌ decodeSilk: 无效参数");
+        return -1;
+    }
+
+    jshort *pSamples = env->GetShortArrayElements(samples, 0);
+    jbyte *pBytes = env->GetByteArrayElements(bytes, 0);
+    jsize nShortSize = env->GetArrayLength(samples);
+
+    if (bytesLength < 0 || nShortSize < frameSize) {
+        LOGE("❌ decodeSilk: 数据大小不匹配 bytesLength=%d, samples=%d, frameSize=%d",
+             bytesLength, nShortSize, frameSize);
+        env->ReleaseShortArrayElements(samples, pSamples, 0);
+        env->ReleaseByteArrayElements(bytes, pBytes, 0);
+        return -1;
+    }
+
+    // bytesLength为0时做丢包补偿，frameSize须为10ms的整数倍
+    int nRet = opus_silk_decode(pDec, bytesLength > 0 ? (unsigned char *) pBytes : NULL,
+                                bytesLength, pSamples, frameSize, 0);
+
+    if (nRet < 0) {
+        LOGE("❌ opus_silk_decode失败: %d", nRet);
+    }
+
+    env->ReleaseShortArrayElements(samples, pSamples, 0);
+    env->ReleaseByteArrayElements(bytes, pBytes, 0);
+    return nRet;
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_destroySilkEncoder(JNIEnv *env, jobject thiz,
+                                                              jlong pSilkEnc) {
+    OpusSilkEncoder *pEnc = (OpusSilkEncoder *) pSilkEnc;
+    if (pEnc) {
+        opus_silk_encoder_destroy(pEnc);
+        LOGI("🧹 SILK编码器已销毁");
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_destroySilkDecoder(JNIEnv *env, jobject thiz,
+                                                              jlong pSilkDec) {
+    OpusSilkDecoder *pDec = (OpusSilkDecoder *) pSilkDec;
+    if (pDec) {
+        opus_silk_decoder_destroy(pDec);
+        LOGI("🧹 SILK解码器已销毁");
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_getSilkEncoderSize(JNIEnv *env, jobject thiz,
+                                                              jint channels) {
+    return opus_silk_encoder_get_size(channels);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_getSilkDecoderSize(JNIEnv *env, jobject thiz,
+                                                              jint channels) {
+    return opus_silk_decoder_get_size(channels);
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_encodeOggOpus(JNIEnv *env, jobject thiz,
+                                                         jshortArray samples, jint sampleRateInHz,
+                                                         jint channelConfig, jint complexity,
+                                                         jint bitrate, jint threads) {
+    if (!samples || channelConfig < 1) {
+        LOGE("❌ encodeOggOpus: 无效参数");
+        return nullptr;
+    }
+
+    audio::OfflineEncodeOptions options;
+    options.sampleRate = sampleRateInHz;
+    options.channels = channelConfig;
+    options.complexity = complexity;
+    options.bitrate = bitrate;
+    options.threads = threads > 0 ? (size_t) threads : 0;
+
+    jshort *pSamples = env->GetShortArrayElements(samples, 0);
+    jsize nSampleSize = env->GetArrayLength(samples);
+    std::vector<uint8_t> ogg;
+    audio::OfflineEncodeStats stats;
+    int nRet = audio::encodeOggOpus(pSamples, (size_t) (nSampleSize / channelConfig), options,
+                                    ogg, &stats);
+    env->ReleaseShortArrayElements(samples, pSamples, JNI_ABORT);
+
+    if (nRet != OPUS_OK) {
+        LOGE("❌ encodeOggOpus失败: %d", nRet);
+        return nullptr;
+    }
+    LOGI("✅ 离线编码完成: %zu段(%zu段强制切分), %zu包, %zu字节, VAD %.1fms, 编码 %.1fms",
+         stats.segments, stats.forcedSplits, stats.packets, ogg.size(),
+         stats.vadSeconds * 1000, stats.encodeSeconds * 1000);
+
+    jbyteArray result = env->NewByteArray((jsize) ogg.size());
+    if (result) {
+        env->SetByteArrayRegion(result, 0, (jsize) ogg.size(),
+                                reinterpret_cast<const jbyte *>(ogg.data()));
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_createWakeGate(JNIEnv *env, jobject thiz,
+                                                          jint sampleRateInHz) {
+    int error;
+    OpusWakeGate *pGate = opus_wake_gate_create(sampleRateInHz, &error);
+    if (error != OPUS_OK) {
+        LOGE("❌ 唤醒前置过滤器创建失败: %d", error);
+        return 0;
+    }
+    LOGI("✅ 唤醒前置过滤器创建成功: %dHz, 状态%d字节", sampleRateInHz,
+         opus_wake_gate_get_size());
+    return reinterpret_cast<jlong>(pGate);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_processWakeGate(JNIEnv *env, jobject thiz,
+                                                           jlong pGate, jshortArray samples,
+                                                           jint length) {
+    OpusWakeGate *pGateState = reinterpret_cast<OpusWakeGate *>(pGate);
+    if (!pGateState || !samples) {
+        return OPUS_BAD_ARG;
+    }
+    jsize nSampleSize = env->GetArrayLength(samples);
+    if (length < 0 || length > nSampleSize) {
+        return OPUS_BAD_ARG;
+    }
+    jshort *pSamples = env->GetShortArrayElements(samples, 0);
+    int nRet = opus_wake_gate_process(pGateState, pSamples, length);
+    env->ReleaseShortArrayElements(samples, pSamples, JNI_ABORT);
+    return nRet;
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_resetWakeGate(JNIEnv *env, jobject thiz,
+                                                         jlong pGate) {
+    OpusWakeGate *pGateState = reinterpret_cast<OpusWakeGate *>(pGate);
+    if (pGateState) {
+        opus_wake_gate_init(pGateState, 16000);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_destroyWakeGate(JNIEnv *env, jobject thiz,
+                                                           jlong pGate) {
+    OpusWakeGate *pGateState = reinterpret_cast<OpusWakeGate *>(pGate);
+    if (pGateState) {
+        opus_wake_gate_destroy(pGateState);
+        LOGI("🧹 唤醒前置过滤器已销毁");
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_createFrameAssembler(JNIEnv *env, jobject thiz,
+                                                                jlong pOpusEnc, jint channels,
+                                                                jint frameSize) {
+    OpusEncoder *pEnc = (OpusEncoder *) pOpusEnc;
+    if (!pEnc || channels < 1 || channels > 2 || frameSize <= 0) {
+        LOGE("❌ createFrameAssembler: 无效参数");
+        return 0;
+    }
+    audio::OpusFrameAssembler *pAsm = new audio::OpusFrameAssembler(pEnc, channels, frameSize);
+    LOGI("✅ Opus整帧拼接器创建成功: %dch, 每帧%d样本", channels, frameSize);
+    return reinterpret_cast<jlong>(pAsm);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_assembleFrames(JNIEnv *env, jobject thiz, jlong pAsm,
+                                                          jshortArray samples, jint offset,
+                                                          jint length, jbyteArray packets,
+                                                          jintArray packetSizes) {
+    audio::OpusFrameAssembler *pAssembler = reinterpret_cast<audio::OpusFrameAssembler *>(pAsm);
+    if (!pAssembler || !samples || !packets || !packetSizes) {
+        LOGE("❌ assembleFrames: 无效参数");
+        return OPUS_BAD_ARG;
+    }
+    jsize nSampleSize = env->GetArrayLength(samples);
+    if (offset < 0 || length < 0 || length > nSampleSize - offset) {
+        LOGE("❌ assembleFrames: 范围越界 offset=%d, length=%d, size=%d", offset, length,
+             nSampleSize);
+        return OPUS_BAD_ARG;
+    }
+    jshort *pSamples = env->GetShortArrayElements(samples, 0);
+    jint nRet = assembleInto(env, pAssembler, pSamples + offset, length, packets, packetSizes);
+    env->ReleaseShortArrayElements(samples, pSamples, JNI_ABORT);
+    return nRet;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_assembleFramesDirect(JNIEnv *env, jobject thiz,
+                                                                jlong pAsm, jobject buffer,
+                                                                jint byteOffset, jint byteLength,
+                                                                jbyteArray packets,
+                                                                jintArray packetSizes) {
+    audio::OpusFrameAssembler *pAssembler = reinterpret_cast<audio::OpusFrameAssembler *>(pAsm);
+    if (!pAssembler || !buffer || !packets || !packetSizes) {
+        LOGE("❌ assembleFramesDirect: 无效参数");
+        return OPUS_BAD_ARG;
+    }
+    // AudioRecord.read(ByteBuffer)写入的是本机字节序的16位PCM，直接在原地读取
+    char *pBuffer = static_cast<char *>(env->GetDirectBufferAddress(buffer));
+    jlong nCapacity = env->GetDirectBufferCapacity(buffer);
+    if (!pBuffer || byteOffset < 0 || byteLength < 0 || (byteOffset | byteLength) & 1
+        || byteLength > nCapacity - byteOffset) {
+        LOGE("❌ assembleFramesDirect: 不是直接缓冲区或范围越界 offset=%d, length=%d",
+             byteOffset, byteLength);
+        return OPUS_BAD_ARG;
+    }
+    return assembleInto(env, pAssembler, reinterpret_cast<const jshort *>(pBuffer + byteOffset),
+                        byteLength / 2, packets, packetSizes);
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_resetFrameAssembler(JNIEnv *env, jobject thiz,
+                                                               jlong pAsm) {
+    audio::OpusFrameAssembler *pAssembler = reinterpret_cast<audio::OpusFrameAssembler *>(pAsm);
+    if (pAssembler) {
+        pAssembler->reset();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_destroyFrameAssembler(JNIEnv *env, jobject thiz,
+                                                                 jlong pAsm) {
+    audio::OpusFrameAssembler *pAssembler = reinterpret_cast<audio::OpusFrameAssembler *>(pAsm);
+    if (pAssembler) {
+        delete pAssembler;
+        LOGI("🧹 Opus整帧拼接器已销毁");
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_createStreamDecoder(JNIEnv *env, jobject thiz,
+                                                               jint sampleRateInHz,
+                                                               jint channelConfig, jint ringMs) {
+    audio::OpusStreamDecoder *pDec = new audio::OpusStreamDecoder(sampleRateInHz, channelConfig,
+                                                                  ringMs);
+    int error = pDec->init();
+    if (error != OPUS_OK) {
+        LOGE("❌ Opus流式解码器创建失败: %d", error);
+        delete pDec;
+        return 0;
+    }
+    LOGI("✅ Opus流式解码器创建成功: %dHz, %dch, 播放环%dms", sampleRateInHz, channelConfig,
+         ringMs);
+    return reinterpret_cast<jlong>(pDec);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_feedStreamDecoder(JNIEnv *env, jobject thiz,
+                                                             jlong pStreamDec, jbyteArray bytes,
+                                                             jint length) {
+    audio::OpusStreamDecoder *pDec = reinterpret_cast<audio::OpusStreamDecoder *>(pStreamDec);
+    if (!pDec || !bytes || length < 0 || length > env->GetArrayLength(bytes)) {
+        LOGE("❌ feedStreamDecoder: 无效参数");
+        return OPUS_BAD_ARG;
+    }
+    // 播放环满时feed会阻塞，先复制出来，不在等待期间占着Java数组
+    std::vector<uint8_t> chunk((size_t) length);
+    env->GetByteArrayRegion(bytes, 0, length, reinterpret_cast<jbyte *>(chunk.data()));
+    int nRet = pDec->feed(chunk.data(), chunk.size());
+    if (nRet != OPUS_OK) {
+        LOGE("❌ Opus流解码失败: %d", nRet);
+    }
+    return nRet;
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_finishStreamDecoder(JNIEnv *env, jobject thiz,
+                                                               jlong pStreamDec) {
+    audio::OpusStreamDecoder *pDec = reinterpret_cast<audio::OpusStreamDecoder *>(pStreamDec);
+    if (pDec) {
+        pDec->finish();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_cancelStreamDecoder(JNIEnv *env, jobject thiz,
+                                                               jlong pStreamDec) {
+    audio::OpusStreamDecoder *pDec = reinterpret_cast<audio::OpusStreamDecoder *>(pStreamDec);
+    if (pDec) {
+        pDec->cancel();
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_readStreamDecoder(JNIEnv *env, jobject thiz,
+                                                             jlong pStreamDec, jshortArray samples,
+                                                             jint timeoutMs) {
+    audio::OpusStreamDecoder *pDec = reinterpret_cast<audio::OpusStreamDecoder *>(pStreamDec);
+    if (!pDec || !samples) {
+        LOGE("❌ readStreamDecoder: 无效参数");
+        return -1;
+    }
+    jsize nSampleSize = env->GetArrayLength(samples);
+    std::vector<int16_t> pcm((size_t) nSampleSize);
+    int nRet = pDec->read(pcm.data(), pcm.size(), timeoutMs);
+    if (nRet > 0) {
+        env->SetShortArrayRegion(samples, 0, nRet, pcm.data());
+    }
+    return nRet;
+}
+
+JNIEXPORT jfloat JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_getStreamFirstSampleMs(JNIEnv *env, jobject thiz,
+                                                                  jlong pStreamDec) {
+    audio::OpusStreamDecoder *pDec = reinterpret_cast<audio::OpusStreamDecoder *>(pStreamDec);
+    if (!pDec) {
+        return -1;
+    }
+    double seconds = pDec->stats().firstSampleSeconds;
+    return seconds < 0 ? -1 : (jfloat) (seconds * 1000);
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_destroyStreamDecoder(JNIEnv *env, jobject thiz,
+                                                                jlong pStreamDec) {
+    audio::OpusStreamDecoder *pDec = reinterpret_cast<audio::OpusStreamDecoder *>(pStreamDec);
+    if (pDec) {
+        audio::OpusStreamStats stats = pDec->stats();
+        LOGI("🧹 Opus流式解码器已销毁: %llu字节, %zu个包, 首字节%.1fms, 首样本%.1fms, "
+             "播放环满等待%zu次, 播放欠载%zu次%s",
+             (unsigned long long) stats.bytesIn, stats.packets, stats.firstByteSeconds * 1000,
+             stats.firstSampleSeconds * 1000, stats.producerWaits, stats.underruns,
+             stats.truncated ? ", 响应体不完整" : "");
+        delete pDec;
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_createCaptureSession(JNIEnv *env, jobject thiz,
+                                                                jint sampleRateInHz, jint ringMs) {
+    audio::CaptureSession *pSession = new audio::CaptureSession(sampleRateInHz, ringMs);
+    if (!pSession->valid()) {
+        LOGE("❌ 录音会话创建失败: 无法创建eventfd");
+        delete pSession;
+        return 0;
+    }
+    LOGI("✅ 录音会话创建成功: %dHz, 环%dms", sampleRateInHz, ringMs);
+    return reinterpret_cast<jlong>(pSession);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_writeCaptureSessionDirect(JNIEnv *env, jobject thiz,
+                                                                     jlong pCapture,
+                                                                     jobject buffer,
+                                                                     jint byteLength) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    if (!pSession || !buffer) {
+        LOGE("❌ writeCaptureSessionDirect: 无效参数");
+        return OPUS_BAD_ARG;
+    }
+    // AudioRecord.read(ByteBuffer)写入的是本机字节序的16位PCM
+    char *pBuffer = static_cast<char *>(env->GetDirectBufferAddress(buffer));
+    if (!pBuffer || byteLength < 0 || (byteLength & 1)
+        || byteLength > env->GetDirectBufferCapacity(buffer)) {
+        LOGE("❌ writeCaptureSessionDirect: 不是直接缓冲区或范围越界 length=%d", byteLength);
+        return OPUS_BAD_ARG;
+    }
+    pSession->write(reinterpret_cast<const int16_t *>(pBuffer), (size_t) byteLength / 2);
+    return OPUS_OK;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_readCaptureSession(JNIEnv *env, jobject thiz,
+                                                              jlong pCapture, jint consumer,
+                                                              jshortArray samples, jint offset,
+                                                              jint length, jint timeoutMs) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    if (!pSession || !samples || consumer < 0 || consumer >= audio::CAPTURE_CONSUMERS
+        || offset < 0 || length < 0 || length > env->GetArrayLength(samples) - offset) {
+        LOGE("❌ readCaptureSession: 无效参数");
+        return -1;
+    }
+    // read可能阻塞，读到临时缓冲区里，不在等待期间占着Java数组
+    std::vector<int16_t> pcm((size_t) length);
+    int nRet = pSession->read(static_cast<audio::CaptureConsumer>(consumer), pcm.data(),
+                              pcm.size(), timeoutMs);
+    if (nRet > 0) {
+        env->SetShortArrayRegion(samples, offset, nRet, pcm.data());
+    }
+    return nRet;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_readCaptureSessionDirect(JNIEnv *env, jobject thiz,
+                                                                    jlong pCapture, jint consumer,
+                                                                    jobject buffer,
+                                                                    jint maxBytes,
+                                                                    jint timeoutMs) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    if (!pSession || !buffer || consumer < 0 || consumer >= audio::CAPTURE_CONSUMERS) {
+        LOGE("❌ readCaptureSessionDirect: 无效参数");
+        return -1;
+    }
+    char *pBuffer = static_cast<char *>(env->GetDirectBufferAddress(buffer));
+    if (!pBuffer || maxBytes < 0 || maxBytes > env->GetDirectBufferCapacity(buffer)) {
+        LOGE("❌ readCaptureSessionDirect: 不是直接缓冲区或范围越界 length=%d", maxBytes);
+        return -1;
+    }
+    int nRet = pSession->read(static_cast<audio::CaptureConsumer>(consumer),
+                              reinterpret_cast<int16_t *>(pBuffer), (size_t) maxBytes / 2,
+                              timeoutMs);
+    return nRet > 0 ? nRet * 2 : nRet;
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_handoffCaptureSession(JNIEnv *env, jobject thiz,
+                                                                 jlong pCapture, jint consumer) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    if (!pSession || consumer < 0 || consumer >= audio::CAPTURE_CONSUMERS) {
+        LOGE("❌ handoffCaptureSession: 无效参数");
+        return -1;
+    }
+    return pSession->handoff(static_cast<audio::CaptureConsumer>(consumer));
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_getCaptureSessionOwner(JNIEnv *env, jobject thiz,
+                                                                  jlong pCapture) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    return pSession ? pSession->owner() : -1;
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_cancelCaptureSession(JNIEnv *env, jobject thiz,
+                                                                jlong pCapture) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    if (pSession) {
+        pSession->cancel();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_destroyCaptureSession(JNIEnv *env, jobject thiz,
+                                                                 jlong pCapture) {
+    audio::CaptureSession *pSession = reinterpret_cast<audio::CaptureSession *>(pCapture);
+    if (pSession) {
+        audio::CaptureSessionStats stats = pSession->stats();
+        LOGI("🧹 录音会话已销毁: 录音%llu个样本, 唤醒检测%llu个, 语音识别%llu个, 切换%zu次, "
+             "被覆盖%llu个",
+             (unsigned long long) stats.samplesIn,
+             (unsigned long long) stats.samplesOut[audio::CAPTURE_WAKE],
+             (unsigned long long) stats.samplesOut[audio::CAPTURE_ASR], stats.handoffs,
+             (unsigned long long) stats.dropped);
+        delete pSession;
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_enterAudioThread(JNIEnv *env, jobject thiz, jint role,
+                                                            jlong targetWorkNanos) {
+    if (role < audio::AUDIO_THREAD_CAPTURE || role > audio::AUDIO_THREAD_PLAYBACK) {
+        LOGE("❌ enterAudioThread: 无效参数 role=%d", role);
+        return 0;
+    }
+    audio::AudioThreadScope *pScope = new audio::AudioThreadScope(
+            audio::audioThreadConfig(static_cast<audio::AudioThreadRole>(role), targetWorkNanos));
+    LOGI("🎚️ 音频线程(角色%d): %s%s%s", role,
+         pScope->priority() == audio::AUDIO_PRIORITY_FIFO ? "SCHED_FIFO"
+         : pScope->priority() == audio::AUDIO_PRIORITY_NICE ? "nice" : "默认优先级",
+         pScope->pinned() ? ", 大核" : "", pScope->hinted() ? ", APerformanceHint" : "");
+    return reinterpret_cast<jlong>(pScope);
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_reportAudioThreadWork(JNIEnv *env, jobject thiz,
+                                                                 jlong pThread,
+                                                                 jlong actualWorkNanos) {
+    audio::AudioThreadScope *pScope = reinterpret_cast<audio::AudioThreadScope *>(pThread);
+    if (pScope) {
+        pScope->reportWork(actualWorkNanos);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_leaveAudioThread(JNIEnv *env, jobject thiz,
+                                                            jlong pThread) {
+    audio::AudioThreadScope *pScope = reinterpret_cast<audio::AudioThreadScope *>(pThread);
+    if (pScope) {
+        if (pScope->reports() > 0) {
+            LOGI("🎚️ 音频线程结束: %zu帧, 超过目标时长%zu帧", pScope->reports(),
+                 pScope->overruns());
+        }
+        delete pScope;
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_traceEvent(JNIEnv *env, jobject thiz, jint id, jint a0,
+                                                      jint a1, jint a2, jint a3) {
+    audio::trace(id, a0, a1, a2, a3);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_registerTraceEvent(JNIEnv *env, jobject thiz, jint id,
+                                                              jstring tag, jstring name,
+                                                              jstring argNames, jstring format) {
+    if (id < audio::TRACE_FIRST_APP_EVENT) {
+        LOGE("❌ registerTraceEvent: 编号%d留给原生代码", id);
+        return JNI_FALSE;
+    }
+    if (!audio::registerTraceEvent(id, jstringToString(env, tag), jstringToString(env, name),
+                                   jstringToString(env, argNames),
+                                   jstringToString(env, format))) {
+        LOGE("❌ registerTraceEvent: 无效参数 id=%d", id);
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
+JNIEXPORT jstring JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_drainTrace(JNIEnv *env, jobject thiz, jint maxEvents) {
+    static std::vector<audio::TraceEvent> events; // 只在一个线程上drain
+    static uint64_t reportedLost = 0;
+    events.clear();
+    audio::TraceRing &ring = audio::traceRing();
+    ring.drain(events, maxEvents > 0 ? (size_t) maxEvents : 0);
+    std::string text;
+    uint64_t lost = ring.lost();
+    if (lost != reportedLost) {
+        text += "AudioTrace\t⚠️ 事件环满，丢失了" + std::to_string(lost - reportedLost) + "个事件\n";
+        reportedLost = lost;
+    }
+    std::string line;
+    for (const audio::TraceEvent &event : events) {
+        if (audio::formatTraceEvent(event, line)) {
+            text += line;
+            text += '\n';
+        }
+    }
+    if (text.empty()) {
+        return nullptr;
+    }
+    return env->NewStringUTF(text.c_str());
+}
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_io_audio_OpusNative_exportTrace(JNIEnv *env, jobject thiz, jstring path) {
+    std::vector<audio::TraceEvent> events = audio::traceRing().snapshot();
+    std::string file = jstringToString(env, path);
+    if (!audio::exportTraceJson(events, file)) {
+        LOGE("❌ exportTrace: 无法写入%s", file.c_str());
+        return -1;
+    }
+    LOGI("✅ 导出了%zu个事件: %s", events.size(), file.c_str());
+    return (jint) events.size();
+}
+
 } // extern "C"
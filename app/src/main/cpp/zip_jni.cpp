@@ -0,0 +1,77 @@
+#include <jni.h>
+#include <android/log.h>
+#include <string>
+
+#include "archive/zip_extractor.h"
+
+#define LOG_TAG "ZipExtractorJNI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+using archive::ZipExtractOptions;
+using archive::ZipExtractStats;
+using archive::ZipProgress;
+
+namespace {
+
+std::string toString(JNIEnv *env, jstring string) {
+    const char *chars = string ? env->GetStringUTFChars(string, nullptr) : nullptr;
+    std::string result(chars ? chars : "");
+    if (chars) {
+        env->ReleaseStringUTFChars(string, chars);
+    }
+    return result;
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jint JNICALL
+Java_org_stypox_dicio_util_NativeZipExtractor_extractZip(JNIEnv *env, jobject thiz,
+                                                         jstring zipPath, jstring destinationPath,
+                                                         jint threads, jobject listener) {
+    if (!zipPath || !destinationPath || !listener) {
+        LOGE("❌ extractZip: 无效参数");
+        return archive::ZIP_IO_ERROR;
+    }
+    jclass listenerClass = env->GetObjectClass(listener);
+    jmethodID onProgress = env->GetMethodID(listenerClass, "onProgress", "(IIJJ)Z");
+    env->DeleteLocalRef(listenerClass);
+    if (!onProgress) {
+        return archive::ZIP_IO_ERROR;
+    }
+
+    ZipExtractOptions options;
+    options.threads = threads > 0 ? (size_t) threads : 0;
+    std::string zip = toString(env, zipPath);
+    ZipExtractStats stats;
+    // 回调总在当前线程上，不需要AttachCurrentThread
+    int result = archive::extractZip(zip, toString(env, destinationPath), options,
+                                     [&](const ZipProgress &progress) {
+        jboolean keepGoing = env->CallBooleanMethod(
+                listener, onProgress, (jint) progress.doneFiles, (jint) progress.totalFiles,
+                (jlong) progress.doneBytes, (jlong) progress.totalBytes);
+        // 回调抛出的异常（比如协程取消）留给Kotlin在返回后重新抛出
+        return !env->ExceptionCheck() && keepGoing;
+    }, &stats);
+
+    if (result == archive::ZIP_OK) {
+        LOGI("✅ 解压完成: %zu个文件, %.1fMB, %zu线程, 目录 %.1fms, 解压 %.1fms, "
+             "%zu/%zu个stored条目用copy_file_range复制",
+             stats.files, stats.bytes / 1048576., stats.threads, stats.directorySeconds * 1000,
+             stats.extractSeconds * 1000, stats.kernelCopies, stats.storedFiles);
+    } else if (result != archive::ZIP_CANCELLED) {
+        LOGE("❌ 解压%s失败: %s (条目 %s, errno %d)", zip.c_str(),
+             archive::zipResultString(result), stats.failedEntry.c_str(), stats.systemError);
+    }
+    return result;
+}
+
+JNIEXPORT jstring JNICALL
+Java_org_stypox_dicio_util_NativeZipExtractor_resultString(JNIEnv *env, jobject thiz,
+                                                           jint result) {
+    return env->NewStringUTF(archive::zipResultString(result));
+}
+
+} // extern "C"
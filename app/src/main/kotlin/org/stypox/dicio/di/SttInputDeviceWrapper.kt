@@ -53,6 +53,9 @@ interface SttInputDeviceWrapper {
     fun onClick(eventListener: (InputEvent) -> Unit)
 
     fun reinitializeToReleaseResources()
+
+    val usesSharedCapture: Boolean
+        get() = false
 }
 
 class SttInputDeviceWrapperImpl(
@@ -228,6 +231,9 @@ class SttInputDeviceWrapperImpl(
     override fun reinitializeToReleaseResources() {
         scope.launch { changeInputDeviceTo(inputDeviceSetting) }
     }
+
+    override val usesSharedCapture: Boolean
+        get() = sttInputDevice?.usesSharedCapture == true
 }
 
 @Module
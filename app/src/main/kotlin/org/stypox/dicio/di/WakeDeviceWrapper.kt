@@ -19,6 +19,7 @@ import kotlinx.coroutines.launch
 import okhttp3.OkHttpClient
 import org.stypox.dicio.io.wake.WakeDevice
 import org.stypox.dicio.io.wake.WakeState
+import org.stypox.dicio.io.wake.gate.GatedWakeDevice
 import org.stypox.dicio.io.wake.oww.OpenWakeWordDevice
 import org.stypox.dicio.io.wake.oww.HiNudgeOpenWakeWordDevice
 import org.stypox.dicio.io.wake.sherpa.SherpaOnnxWakeDevice
@@ -111,7 +112,7 @@ class WakeDeviceWrapperImpl(
             WAKE_DEVICE_SHERPA_ONNX -> SherpaOnnxWakeDevice(appContext)
             WAKE_DEVICE_HI_NUDGE -> HiNudgeOpenWakeWordDevice(appContext)
             WAKE_DEVICE_NOTHING -> null
-        }
+        }?.let(::GatedWakeDevice) // 前置过滤器打开时才运行重型模型
     }
 
     override fun download() {
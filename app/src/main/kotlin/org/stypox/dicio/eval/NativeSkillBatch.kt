@@ -0,0 +1,178 @@
+package org.stypox.dicio.eval
+
+import android.util.Log
+import org.dicio.skill.skill.Skill
+import org.dicio.skill.standard.StandardRecognizerSkill
+import org.dicio.skill.standard.StandardScore
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
+
+/**
+ * 原生评分结果，只包含分数，捕获组需要通过[NativeSkillBatch.materialize]重新计算
+ */
+class NativeSkillScore(
+    val sentenceIndex: Int,
+    val score: StandardScore,
+) {
+    /**
+     * 得分上界低于其他技能的实际得分，不可能胜出，[score]也不是真实得分
+     */
+    val pruned: Boolean get() = sentenceIndex < 0
+}
+
+/**
+ * 一次用户输入在原生层的分词结果，同一次getBest的三轮评估共享同一个实例
+ */
+class NativeMatchInput private constructor(
+    private var inputPtr: Long,
+) : AutoCloseable {
+    internal val ptr: Long get() = inputPtr
+
+    override fun close() {
+        if (inputPtr != 0L) {
+            NativeSkillMatcher.destroyInput(inputPtr)
+            inputPtr = 0L
+        }
+    }
+
+    companion object {
+        fun create(input: String): NativeMatchInput? {
+            val ptr = NativeSkillMatcher.createInput(input)
+            return if (ptr == 0L) null else NativeMatchInput(ptr)
+        }
+    }
+}
+
+/**
+ * 一个特异性等级中所有可以原生评分的StandardRecognizerSkill编译后的语法
+ */
+class NativeSkillBatch private constructor(
+    private var grammarPtr: Long,
+    private var cachePtr: Long,
+    // 等级技能列表下标 -> 原生技能下标，不能原生评分的技能为-1
+    private val nativeIndices: IntArray,
+    private val nativeSkillCount: Int,
+) {
+    /**
+     * 并行为所有原生技能打分
+     * @return 按等级技能列表下标索引，不能原生评分的技能为null；失败时返回null
+     */
+    fun score(input: NativeMatchInput): Array<NativeSkillScore?>? {
+        if (grammarPtr == 0L || cachePtr == 0L || input.ptr == 0L) {
+            return null
+        }
+
+        val sentences = IntArray(nativeSkillCount)
+        val scores = FloatArray(nativeSkillCount * 4)
+        val count = NativeSkillMatcher.scoreCached(
+            grammarPtr, cachePtr, input.ptr, sentences, scores)
+        if (count != nativeSkillCount) {
+            Log.e(TAG, "❌ 原生评分失败: $count")
+            return null
+        }
+
+        return Array(nativeIndices.size) { i ->
+            val nativeIndex = nativeIndices[i]
+            if (nativeIndex < 0) {
+                null
+            } else {
+                NativeSkillScore(
+                    sentenceIndex = sentences[nativeIndex],
+                    score = StandardScore(
+                        userMatched = scores[nativeIndex * 4],
+                        userWeight = scores[nativeIndex * 4 + 1],
+                        refMatched = scores[nativeIndex * 4 + 2],
+                        refWeight = scores[nativeIndex * 4 + 3],
+                        capturingGroups = null,
+                    ),
+                )
+            }
+        }
+    }
+
+    /**
+     * 结果缓存的统计: 缓存命中次数, 没有命中的次数
+     */
+    fun cacheStats(): LongArray {
+        val stats = LongArray(2)
+        if (cachePtr != 0L) {
+            NativeSkillMatcher.resultCacheStats(cachePtr, stats)
+        }
+        return stats
+    }
+
+    fun release() {
+        if (cachePtr != 0L) {
+            NativeSkillMatcher.destroyResultCache(cachePtr)
+            cachePtr = 0L
+        }
+        if (grammarPtr != 0L) {
+            NativeSkillMatcher.destroyGrammar(grammarPtr)
+            grammarPtr = 0L
+        }
+    }
+
+    companion object {
+        private val TAG = NativeSkillBatch::class.simpleName
+
+        /**
+         * @return 列表中没有可以原生评分的技能或者原生库不可用时返回null
+         */
+        fun create(skills: List<Skill<*>>): NativeSkillBatch? {
+            val nativeIndices = IntArray(skills.size) { -1 }
+            val builder = CompiledGrammarBuilder()
+            var nativeSkillCount = 0
+            for ((i, skill) in skills.withIndex()) {
+                val data = (skill as? StandardRecognizerSkill<*>)?.recognizerData ?: continue
+                data.compile(builder)
+                nativeIndices[i] = nativeSkillCount
+                nativeSkillCount += 1
+            }
+
+            if (nativeSkillCount == 0 || !NativeSkillMatcher.isAvailable) {
+                return null
+            }
+
+            val grammar = builder.build()
+            val ptr = NativeSkillMatcher.compileGrammar(
+                grammar.nodes,
+                grammar.weights,
+                grammar.strings,
+                grammar.sentenceRoots,
+                grammar.skillSentenceCounts,
+            )
+            if (ptr == 0L) {
+                Log.e(TAG, "❌ 原生语法编译失败，使用Kotlin评分")
+                return null
+            }
+            // 等级中所有技能都由原生评分时，技能之间只按StandardScore.score()比较，可以跳过不可能胜出的技能
+            val cachePtr = NativeSkillMatcher.createResultCache(
+                ptr, nativeSkillCount == skills.size)
+            if (cachePtr == 0L) {
+                Log.e(TAG, "❌ 结果缓存创建失败，使用Kotlin评分")
+                NativeSkillMatcher.destroyGrammar(ptr)
+                return null
+            }
+            Log.d(TAG, "✅ 原生语法编译完成: $nativeSkillCount/${skills.size} 个技能")
+            return NativeSkillBatch(ptr, cachePtr, nativeIndices, nativeSkillCount)
+        }
+
+        /**
+         * 为原生评分选出的最佳技能重新计算捕获组和转换后的输入数据（只计算一个句子）
+         */
+        fun materialize(skill: Skill<*>, input: String, sentenceIndex: Int): SkillWithResult<*> {
+            return (skill as StandardRecognizerSkill<*>).scoreSentence(input, sentenceIndex)
+        }
+
+        private fun <T> StandardRecognizerSkill<T>.scoreSentence(
+            input: String,
+            sentenceIndex: Int,
+        ): SkillWithResult<T> {
+            val (score, inputData) = recognizerData!!.scoreSentence(input, sentenceIndex)
+            return SkillWithResult(
+                skill = this,
+                score = score,
+                inputData = inputData,
+            )
+        }
+    }
+}
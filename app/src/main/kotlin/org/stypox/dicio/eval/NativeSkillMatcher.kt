@@ -0,0 +1,100 @@
+package org.stypox.dicio.eval
+
+import android.util.Log
+
+/**
+ * 原生技能匹配器JNI绑定类
+ * 与Kotlin端Construct.matchToEnd数值一致的C++实现，在常驻的工作窃取线程池上并行为句子打分
+ */
+object NativeSkillMatcher {
+    private const val TAG = "NativeSkillMatcher"
+
+    /**
+     * 原生库是否加载成功，失败时SkillRanker退回到逐个技能的Kotlin实现
+     */
+    val isAvailable: Boolean = try {
+        System.loadLibrary("skill_matcher")
+        Log.d(TAG, "✅ 技能匹配JNI库加载成功")
+        true
+    } catch (e: UnsatisfiedLinkError) {
+        Log.e(TAG, "❌ 技能匹配JNI库加载失败: ${e.message}", e)
+        false
+    }
+
+    /**
+     * 编译一组技能的句子，参数来自CompiledGrammar
+     * @return 语法指针，失败返回0
+     */
+    external fun compileGrammar(
+        nodes: IntArray,
+        weights: FloatArray,
+        strings: Array<String>,
+        sentenceRoots: IntArray,
+        skillSentenceCounts: IntArray
+    ): Long
+
+    /**
+     * 销毁语法
+     */
+    external fun destroyGrammar(grammarPtr: Long)
+
+    /**
+     * 在原生层对输入分词，结果与MatchHelper的splitWords、cumulativeWeight和cumulativeWhitespace一致
+     * @return 输入指针，失败返回0
+     */
+    external fun createInput(text: String): Long
+
+    /**
+     * 销毁输入
+     */
+    external fun destroyInput(inputPtr: Long)
+
+    /**
+     * 并行为语法中所有技能打分
+     * @param outSentences 每个技能得分最高的句子下标，被剪枝的技能为-1
+     * @param outScores 每个技能4个float: userMatched, userWeight, refMatched, refWeight
+     * @return 技能数量，失败返回负数
+     */
+    external fun scoreGrammar(
+        grammarPtr: Long,
+        inputPtr: Long,
+        outSentences: IntArray,
+        outScores: FloatArray
+    ): Int
+
+    /**
+     * 为语法创建结果缓存，按词序列缓存最近几次输入的结果，
+     * 部分识别结果提前打分后，词序列相同的最终结果可以直接命中缓存；没有命中时整体重新打分
+     * @param pruneSkills 等级中所有技能都由原生评分时为true，可以跳过不可能胜出的技能
+     * @return 结果缓存指针，失败返回0
+     */
+    external fun createResultCache(grammarPtr: Long, pruneSkills: Boolean): Long
+
+    /**
+     * 销毁结果缓存，必须在对应的语法之前销毁
+     */
+    external fun destroyResultCache(cachePtr: Long)
+
+    /**
+     * 与[scoreGrammar]相同，但先查找结果缓存
+     * @return 技能数量，失败返回负数
+     */
+    external fun scoreCached(
+        grammarPtr: Long,
+        cachePtr: Long,
+        inputPtr: Long,
+        outSentences: IntArray,
+        outScores: FloatArray
+    ): Int
+
+    /**
+     * @param outStats 2个long: 缓存命中次数, 没有命中的次数
+     */
+    external fun resultCacheStats(cachePtr: Long, outStats: LongArray)
+
+    /**
+     * 上界剪枝的统计，用于调整剪枝策略
+     * @param outStats 3个long: 打分的句子数, 跳过的句子数, 跳过的技能数
+     */
+    external fun pruningStats(outStats: LongArray)
+}
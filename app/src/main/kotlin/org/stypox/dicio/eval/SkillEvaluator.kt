@@ -12,6 +12,7 @@ import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.flow.MutableSharedFlow
 import kotlinx.coroutines.flow.SharedFlow
 import kotlinx.coroutines.flow.asSharedFlow
+import kotlinx.coroutines.channels.Channel
 import kotlinx.coroutines.launch
 import kotlinx.coroutines.withContext
 import org.dicio.skill.skill.InteractionPlan
@@ -59,6 +60,22 @@ class SkillEvaluatorImpl(
     private val _inputEvents = MutableSharedFlow<InputEvent>(replay = 0)
     override val inputEvents: SharedFlow<InputEvent> = _inputEvents.asSharedFlow()
 
+    // 最新的部分识别结果，用于跳过已经过时的预热
+    @Volatile
+    private var latestPartial: String? = null
+
+    // 部分识别结果的预热由一个协程依次处理，只保留最新的一个：打分比部分结果来得慢时，
+    // 中间的结果直接丢弃，不会同时有多个预热在跑
+    private val partialWarmups = Channel<String>(Channel.CONFLATED)
+
+    init {
+        scope.launch {
+            for (utterance in partialWarmups) {
+                prepareMatchingSkill(utterance)
+            }
+        }
+    }
+
     // must be kept up to date even when the activity is recreated, for this reason it is `var`
     override var permissionRequester: suspend (List<Permission>) -> Boolean = { false }
 
@@ -79,6 +96,7 @@ class SkillEvaluatorImpl(
                 addErrorInteractionFromPending(event.throwable)
             }
             is InputEvent.Final -> {
+                latestPartial = null
                 val utterances = event.utterances.map { it.first }
                 Log.d(TAG, "📥 收到Final事件: $utterances")
                 _state.value = _state.value.copy(
@@ -104,10 +122,24 @@ class SkillEvaluatorImpl(
                         skillBeingEvaluated = null,
                     )
                 )
+                latestPartial = event.utterance
+                partialWarmups.trySend(event.utterance)
             }
         }
     }
 
+    private fun prepareMatchingSkill(utterance: String) {
+        if (utterance.isBlank() || latestPartial != utterance) {
+            return
+        }
+        try {
+            // 部分识别结果来得比打分快时，只预热最新的那一个
+            skillRanker.prepare(utterance) { latestPartial == utterance }
+        } catch (throwable: Throwable) {
+            Log.w(TAG, "⚠️ 部分识别结果预热失败", throwable)
+        }
+    }
+
     private suspend fun evaluateMatchingSkill(utterances: List<String>) {
         Log.d(TAG, "🎯 开始技能匹配评估，输入语句: $utterances")
         
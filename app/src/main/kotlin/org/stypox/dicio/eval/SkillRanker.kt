@@ -1,11 +1,14 @@
 package org.stypox.dicio.eval
 
 import android.util.Log
+import org.dicio.skill.skill.Score
 import org.dicio.skill.skill.Skill
 import org.dicio.skill.context.SkillContext
 import org.dicio.skill.skill.Specificity
 import org.dicio.skill.util.CleanableUp
 import java.util.Stack
+import java.util.concurrent.locks.ReentrantLock
+import kotlin.concurrent.withLock
 
 class SkillRanker(
     defaultSkillBatch: List<Skill<*>>,
@@ -28,12 +31,91 @@ class SkillRanker(
             }
         }
 
-        fun getBest(ctx: SkillContext, input: String): SkillWithResult<*>? {
+        // 每个特异性等级的原生批量评分器，第一次评估时才编译；原生库不可用时为null。
+        // 预热不持有SkillRanker的锁，原生评分器的所有访问由nativeLock保护
+        private val nativeLock = ReentrantLock()
+        private var released = false
+        private var nativeCompiled = false
+        private var nativeHigh: NativeSkillBatch? = null
+        private var nativeMedium: NativeSkillBatch? = null
+        private var nativeLow: NativeSkillBatch? = null
+
+        private fun ensureNativeCompiled() {
+            if (!nativeCompiled) {
+                nativeCompiled = true
+                nativeHigh = NativeSkillBatch.create(highSkills)
+                nativeMedium = NativeSkillBatch.create(mediumSkills)
+                nativeLow = NativeSkillBatch.create(lowSkills)
+            }
+        }
+
+        fun release() {
+            nativeLock.withLock {
+                released = true
+                nativeHigh?.release()
+                nativeMedium?.release()
+                nativeLow?.release()
+                nativeHigh = null
+                nativeMedium = null
+                nativeLow = null
+            }
+        }
+
+        /**
+         * 用ASR的部分识别结果提前为所有原生等级打分，结果缓存在各等级的结果缓存中，
+         * 最终结果的词序列与某个部分结果相同时getBest直接命中缓存。
+         * getBest正在使用这个批次时直接跳过；每个等级打分前检查isCurrent，
+         * 最终评估最多等待一个等级的预热
+         */
+        fun prepare(input: String, isCurrent: () -> Boolean) {
+            if (!nativeLock.tryLock()) {
+                return
+            }
+            try {
+                if (released) {
+                    return
+                }
+                ensureNativeCompiled()
+                if (nativeHigh == null && nativeMedium == null && nativeLow == null) {
+                    return
+                }
+                NativeMatchInput.create(input)?.use { nativeInput ->
+                    for (nativeBatch in listOf(nativeHigh, nativeMedium, nativeLow)) {
+                        if (!isCurrent()) {
+                            return
+                        }
+                        nativeBatch?.score(nativeInput)
+                    }
+                }
+            } finally {
+                nativeLock.unlock()
+            }
+        }
+
+        fun getBest(ctx: SkillContext, input: String): SkillWithResult<*>? = nativeLock.withLock {
+            if (!released) {
+                ensureNativeCompiled()
+            }
+            // 分词结果在三轮评估之间共享
+            val nativeInput = if (nativeHigh != null || nativeMedium != null || nativeLow != null)
+                NativeMatchInput.create(input) else null
+            try {
+                return getBest(ctx, input, nativeInput)
+            } finally {
+                nativeInput?.close()
+            }
+        }
+
+        private fun getBest(
+            ctx: SkillContext,
+            input: String,
+            nativeInput: NativeMatchInput?,
+        ): SkillWithResult<*>? {
             Log.d(TAG, "🎯 SkillBatch.getBest() 开始评估输入: '$input'")
             Log.d(TAG, "📊 技能数量 - High: ${highSkills.size}, Medium: ${mediumSkills.size}, Low: ${lowSkills.size}")
             
             // first round: considering only high-priority skills
-            val bestHigh = getBestForSpecificity(ctx, highSkills, input)
+            val bestHigh = getBestForSpecificity(ctx, highSkills, nativeHigh, nativeInput, input)
             Log.d(TAG, "🔴 第一轮(High): ${bestHigh?.let { "${it.skill.correspondingSkillInfo.id} (${it.score.scoreIn01Range()})" } ?: "无匹配"}")
             if (bestHigh != null && bestHigh.score.scoreIn01Range() > HIGH_THRESHOLD_1) {
                 Log.d(TAG, "✅ 第一轮通过，阈值: $HIGH_THRESHOLD_1")
@@ -41,7 +123,7 @@ class SkillRanker(
             }
 
             // second round: considering both medium- and high-priority skills
-            val bestMedium = getBestForSpecificity(ctx, mediumSkills, input)
+            val bestMedium = getBestForSpecificity(ctx, mediumSkills, nativeMedium, nativeInput, input)
             Log.d(TAG, "🟡 第二轮(Medium): ${bestMedium?.let { "${it.skill.correspondingSkillInfo.id} (${it.score.scoreIn01Range()})" } ?: "无匹配"}")
             if (bestMedium != null && bestMedium.score.scoreIn01Range() > MEDIUM_THRESHOLD_2) {
                 Log.d(TAG, "✅ 第二轮Medium通过，阈值: $MEDIUM_THRESHOLD_2")
@@ -52,7 +134,7 @@ class SkillRanker(
             }
 
             // third round: all skills are considered
-            val bestLow = getBestForSpecificity(ctx, lowSkills, input)
+            val bestLow = getBestForSpecificity(ctx, lowSkills, nativeLow, nativeInput, input)
             Log.d(TAG, "🟢 第三轮(Low): ${bestLow?.let { "${it.skill.correspondingSkillInfo.id} (${it.score.scoreIn01Range()})" } ?: "无匹配"}")
             if (bestLow != null && bestLow.score.scoreIn01Range() > LOW_THRESHOLD_3) {
                 Log.d(TAG, "✅ 第三轮Low通过，阈值: $LOW_THRESHOLD_3")
@@ -74,6 +156,8 @@ class SkillRanker(
             private fun getBestForSpecificity(
                 ctx: SkillContext,
                 skills: List<Skill<*>>,
+                nativeBatch: NativeSkillBatch?,
+                nativeInput: NativeMatchInput?,
                 input: String,
             ): SkillWithResult<*>? {
                 if (skills.isEmpty()) {
@@ -82,16 +166,45 @@ class SkillRanker(
                 }
                 
                 Log.d(TAG, "  🔍 评估 ${skills.size} 个技能:")
+                // StandardRecognizerSkill在原生线程池上并行评分，其余技能仍然逐个调用score()
+                val nativeScores = nativeInput?.let { nativeBatch?.score(it) }
+                nativeBatch?.cacheStats()?.let {
+                    Log.d(TAG, "  ⚡ 结果缓存: 命中${it[0]}, 未命中${it[1]}")
+                }
+                if (nativeScores != null) {
+                    val pruning = LongArray(3)
+                    NativeSkillMatcher.pruningStats(pruning)
+                    Log.d(TAG, "  ✂️ 剪枝: 打分${pruning[0]}句, 跳过${pruning[1]}句, 跳过${pruning[2]}个技能")
+                }
+
                 // this ensures that if `skills` is empty and null skill is returned,
                 // nothing bad happens since its score cannot be higher than any other float value.
                 var bestSkillSoFar: SkillWithResult<*>? = null
-                for (skill in skills) {
-                    val res = skill.scoreAndWrapResult(ctx, input)
-                    Log.d(TAG, "    📝 ${skill.correspondingSkillInfo.id}: ${res.score.scoreIn01Range()}")
-                    if (bestSkillSoFar == null || res.score.isBetterThan(bestSkillSoFar.score)) {
+                var bestScoreSoFar: Score? = null
+                var bestNativeSoFar: NativeSkillScore? = null
+                var bestIndexSoFar = -1
+                for ((i, skill) in skills.withIndex()) {
+                    val nativeScore = nativeScores?.get(i)
+                    if (nativeScore?.pruned == true) {
+                        Log.d(TAG, "    ✂️ ${skill.correspondingSkillInfo.id}: 已剪枝")
+                        continue
+                    }
+                    val res = if (nativeScore == null) skill.scoreAndWrapResult(ctx, input) else null
+                    val score = nativeScore?.score ?: res!!.score
+                    Log.d(TAG, "    📝 ${skill.correspondingSkillInfo.id}: ${score.scoreIn01Range()}")
+                    if (bestScoreSoFar == null || score.isBetterThan(bestScoreSoFar)) {
                         bestSkillSoFar = res
+                        bestScoreSoFar = score
+                        bestNativeSoFar = nativeScore
+                        bestIndexSoFar = i
                     }
                 }
+
+                // 只为最终胜出的原生技能计算捕获组和输入数据
+                if (bestSkillSoFar == null && bestNativeSoFar != null) {
+                    bestSkillSoFar = NativeSkillBatch.materialize(
+                        skills[bestIndexSoFar], input, bestNativeSoFar.sentenceIndex)
+                }
                 Log.d(TAG, "  🏆 最佳技能: ${bestSkillSoFar?.skill?.correspondingSkillInfo?.id} (${bestSkillSoFar?.score?.scoreIn01Range()})")
                 return bestSkillSoFar
             }
@@ -101,24 +214,46 @@ class SkillRanker(
     private var defaultBatch: SkillBatch = SkillBatch(defaultSkillBatch)
     private val batches: Stack<SkillBatch> = Stack()
 
+    // 部分识别结果的预热和最终结果的评估运行在不同的协程中，批次栈的所有访问都需要同步；
+    // 预热只在复制批次栈时持有这个锁，不会让getBest等待
+    @Synchronized
     fun addBatchToTop(skillBatch: List<Skill<*>>) {
         batches.push(SkillBatch(skillBatch))
     }
 
+    @Synchronized
     fun hasAnyBatches(): Boolean {
         return batches.isNotEmpty()
     }
 
+    @Synchronized
     fun removeTopBatch() {
         if (!batches.isEmpty()) {
-            batches.pop()
+            batches.pop().release()
         }
     }
 
+    @Synchronized
     fun removeAllBatches() {
+        batches.forEach { it.release() }
         batches.removeAllElements()
     }
 
+    /**
+     * 在ASR部分识别结果到来时调用，提前为当前可能被使用的所有批次打分
+     * @param isCurrent 返回false时说明已经有更新的部分识别结果，剩下的批次不再预热
+     */
+    fun prepare(input: String, isCurrent: () -> Boolean) {
+        val toPrepare = synchronized(this) { batches.reversed() + defaultBatch }
+        for (batch in toPrepare) {
+            if (!isCurrent()) {
+                return
+            }
+            batch.prepare(input, isCurrent)
+        }
+    }
+
+    @Synchronized
     fun getBest(
         ctx: SkillContext,
         input: String,
@@ -149,8 +284,10 @@ class SkillRanker(
         return fallbackSkill.scoreAndWrapResult(ctx, input)
     }
 
+    @Synchronized
     override fun cleanup() {
-        batches.clear()
+        removeAllBatches()
+        defaultBatch.release()
     }
 
     companion object {
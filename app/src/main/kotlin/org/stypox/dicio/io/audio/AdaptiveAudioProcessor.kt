@@ -75,6 +75,9 @@ class AdaptiveAudioProcessor(
     private val encodingTimeStats = mutableListOf<Long>()
     private val decodingTimeStats = mutableListOf<Long>()
 
+    // PCM模式下encodeAudioChunk复用的输出缓冲区
+    private var pcmChunkBytes = ByteArray(0)
+
     /**
      * 初始化自适应音频处理器
      */
@@ -151,6 +154,50 @@ class AdaptiveAudioProcessor(
         }
     }
 
+    /**
+     * 编码任意长度的一块录音（AudioRecord.read(ByteBuffer)的结果），不需要凑成整帧
+     *
+     * Opus模式下样本在native中拼成整帧，每编码出一个包调用一次[onPacket]，一次调用可能
+     * 产生零个、一个或多个包；PCM模式下整块作为一个包。[onPacket]收到的数组只在回调
+     * 期间有效。只能在录音线程上调用，每次开始录音前先调用[resetChunkEncoder]。
+     * @param buffer 直接缓冲区，本机字节序的16位PCM
+     * @param byteLength 有效字节数，从缓冲区开头算起
+     * @return 是否成功，失败时已经降级到PCM，下一块会按PCM发送
+     */
+    suspend fun encodeAudioChunk(
+        buffer: java.nio.ByteBuffer,
+        byteLength: Int,
+        onPacket: (ByteArray, Int, Int) -> Unit
+    ): Boolean {
+        val startTime = System.currentTimeMillis()
+        val codec = opusCodec
+        if (currentCodec == AudioCodecType.OPUS && codec != null) {
+            if (codec.encodeChunk(buffer, byteLength, onPacket) < 0) {
+                handleEncodingFailure()
+                return false
+            }
+        } else {
+            if (pcmChunkBytes.size < byteLength) {
+                pcmChunkBytes = ByteArray(byteLength)
+            }
+            // 不改变调用方缓冲区的position
+            buffer.duplicate().apply { position(0) }.get(pcmChunkBytes, 0, byteLength)
+            onPacket(pcmChunkBytes, 0, byteLength)
+        }
+
+        val encodingTime = System.currentTimeMillis() - startTime
+        recordEncodingTime(encodingTime)
+        checkPerformanceAndAdapt(encodingTime, isEncoding = true)
+        return true
+    }
+
+    /**
+     * 丢弃上一次录音留在整帧拼接器中的不足一帧的样本
+     */
+    fun resetChunkEncoder() {
+        opusCodec?.resetChunkEncoder()
+    }
+
     /**
      * 解码音频数据
      * @param audioData 编码的音频数据
@@ -0,0 +1,33 @@
+package org.stypox.dicio.io.audio
+
+import java.io.Closeable
+
+/**
+ * 在当前线程上运行音频循环期间的调度设置（见[OpusNative.enterAudioThread]），close时恢复。
+ *
+ * 可以用在协程调度器的线程上，但从创建到close之间不能挂起，否则循环可能换到别的线程上，
+ * 而设置还留在原来的线程上。原生库不可用时什么也不做。
+ */
+class AudioThreadScope(role: Int, private val targetWorkNanos: Long = 0) : Closeable {
+    private var handle = try {
+        OpusNative.enterAudioThread(role, targetWorkNanos)
+    } catch (e: UnsatisfiedLinkError) {
+        0L
+    }
+
+    /**
+     * 报告一帧实际的工作时长，交给APerformanceHint调整CPU频率
+     */
+    fun reportWork(actualWorkNanos: Long) {
+        if (handle != 0L && targetWorkNanos > 0) {
+            OpusNative.reportAudioThreadWork(handle, actualWorkNanos)
+        }
+    }
+
+    override fun close() {
+        if (handle != 0L) {
+            OpusNative.leaveAudioThread(handle)
+            handle = 0L
+        }
+    }
+}
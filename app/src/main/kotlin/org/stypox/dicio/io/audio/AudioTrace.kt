@@ -0,0 +1,152 @@
+package org.stypox.dicio.io.audio
+
+import org.stypox.dicio.util.DebugLogger
+import java.io.File
+import kotlin.concurrent.thread
+
+/**
+ * 音频热循环里的调试记录：每个事件只有编号和最多4个整数，一次JNI调用写入原生的二进制事件环
+ * （见[OpusNative.traceEvent]），热循环里不拼字符串。后台线程每秒取出一次，按下面登记的格式
+ * 写入DebugLogger；[export]把环中最近的事件导出成Perfetto UI能直接打开的JSON，
+ * 格式为空的事件（每帧一个）只出现在导出的文件里。原生库不可用时[enabled]为false，
+ * 调用方传入的fallback照旧直接写DebugLogger。
+ *
+ * 参数都是整数，0到1之间的分数按千分之一记录。
+ */
+object AudioTrace {
+    // 64以下的编号留给原生代码（audio/trace_ring.h）
+    const val WAKE_FRAME = 64
+    const val WAKE_PROGRESS = 65
+    const val WAKE_READ = 66
+    const val WAKE_READ_EMPTY = 67
+    const val WAKE_BUFFER_RESIZED = 68
+    const val WAKE_DETECTED = 69
+    const val WAKE_BACKOFF = 70
+    const val CAPTURE_CHUNK = 71
+    const val SHERPA_AUDIO_STATS = 72
+    const val SHERPA_DETECTION = 73
+    const val HINUDGE_FRAME = 74
+    const val HINUDGE_STATS = 75
+    const val HINUDGE_DETECTED = 76
+    const val HINUDGE_SCORE = 77
+
+    private const val DRAIN_INTERVAL_MS = 1000L
+    private const val DRAIN_MAX_EVENTS = 1024
+
+    private class Event(
+        val id: Int,
+        val tag: String,
+        val name: String,
+        val argNames: String,
+        val format: String,
+    )
+
+    private val EVENTS = listOf(
+        Event(WAKE_FRAME, "WakeService", "wake_frame", "frame,work_us", ""),
+        Event(WAKE_PROGRESS, "WakeService", "wake_progress", "frames",
+            "📊 Processed %d frames, still listening..."),
+        Event(WAKE_READ, "WakeService", "wake_read", "frame,bytes",
+            "🔄 Frame #%d, bytesRead=%d"),
+        Event(WAKE_READ_EMPTY, "WakeService", "wake_read_empty", "frame",
+            "⚠️ AudioRecord read 0 bytes (frame #%d)"),
+        Event(WAKE_BUFFER_RESIZED, "WakeService", "wake_buffer_resized", "old,new",
+            "🔄 Audio buffer resized: %d -> %d"),
+        Event(WAKE_DETECTED, "WakeService", "wake_detected", "frame",
+            "🎯 WAKE WORD DETECTED! Frame #%d"),
+        Event(WAKE_BACKOFF, "WakeService", "wake_backoff", "remaining_ms,frame",
+            "⏳ Wake word detected but in backoff period (%dms remaining)"),
+        Event(CAPTURE_CHUNK, "WakeService", "capture_chunk", "bytes", ""),
+        Event(SHERPA_AUDIO_STATS, "SherpaOnnxWakeDevice", "sherpa_audio_stats",
+            "samples,amplitude,threshold_permille", "Frame: %d, Amplitude: %d, Threshold: %d‰"),
+        Event(SHERPA_DETECTION, "SherpaOnnxWakeDevice", "sherpa_detection",
+            "detected,confidence_permille,threshold_permille",
+            "Detected: %d - Confidence: %d‰, Threshold: %d‰"),
+        Event(HINUDGE_FRAME, "HiNudgeOpenWakeWordDevice", "hinudge_frame", "frame,samples",
+            "🔄 HiNudge processing frame #%d, size: %d"),
+        Event(HINUDGE_STATS, "HiNudgeOpenWakeWordDevice", "hinudge_stats",
+            "frames,frame_ms,score_permille",
+            "📊 HiNudge processed %d frames, frame time %dms, latest score: %d‰"),
+        Event(HINUDGE_DETECTED, "HiNudgeOpenWakeWordDevice", "hinudge_detected",
+            "score_permille,threshold_permille",
+            "🎯 Wake word detected! Score: %d‰ (threshold: %d‰)"),
+        Event(HINUDGE_SCORE, "HiNudgeOpenWakeWordDevice", "hinudge_score",
+            "score_permille,threshold_permille",
+            "🔍 Wake word score: %d‰ (below threshold: %d‰)"),
+    )
+
+    /**
+     * 所有事件都登记成功时为true
+     */
+    val enabled: Boolean = try {
+        EVENTS.all { event ->
+            OpusNative.registerTraceEvent(
+                event.id, event.tag, event.name, event.argNames, event.format)
+        }
+    } catch (e: UnsatisfiedLinkError) {
+        false
+    }
+
+    init {
+        if (enabled && DebugLogger.isAudioTraceLogEnabled()) {
+            thread(isDaemon = true, name = "AudioTrace") {
+                while (true) {
+                    Thread.sleep(DRAIN_INTERVAL_MS)
+                    drain()
+                }
+            }
+        }
+    }
+
+    /**
+     * 记录一个只出现在导出的trace里的事件，可以在任何线程上调用
+     */
+    fun event(id: Int, a0: Int = 0, a1: Int = 0, a2: Int = 0, a3: Int = 0) {
+        if (enabled) {
+            OpusNative.traceEvent(id, a0, a1, a2, a3)
+        }
+    }
+
+    /**
+     * 记录一个事件，不能记录时调用[fallback]（原来的DebugLogger调用）。
+     * 内联，能记录时不创建lambda、不拼字符串
+     */
+    inline fun event(
+        id: Int,
+        a0: Int = 0,
+        a1: Int = 0,
+        a2: Int = 0,
+        a3: Int = 0,
+        fallback: () -> Unit,
+    ) {
+        if (enabled) {
+            OpusNative.traceEvent(id, a0, a1, a2, a3)
+        } else {
+            fallback()
+        }
+    }
+
+    /**
+     * 0到1之间的分数换算成千分之一
+     */
+    fun permille(value: Float): Int = (value * 1000).toInt()
+
+    /**
+     * 把事件环中最近的事件（最多8192个）导出成JSON
+     * @return 导出的事件数，失败或者原生库不可用时返回-1
+     */
+    fun export(file: File): Int {
+        return if (enabled) OpusNative.exportTrace(file.absolutePath) else -1
+    }
+
+    private fun drain() {
+        while (true) {
+            val text = OpusNative.drainTrace(DRAIN_MAX_EVENTS) ?: return
+            for (line in text.lineSequence()) {
+                val tab = line.indexOf('\t')
+                if (tab > 0) {
+                    DebugLogger.logTrace(line.substring(0, tab), line.substring(tab + 1))
+                }
+            }
+        }
+    }
+}
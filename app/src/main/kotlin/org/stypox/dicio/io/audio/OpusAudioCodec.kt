@@ -31,10 +31,21 @@ class OpusAudioCodec(
             24000 to arrayOf(240, 480, 960, 1440),   // 10, 20, 40, 60ms
             48000 to arrayOf(480, 960, 1920, 2880)   // 10, 20, 40, 60ms
         )
+
+        // Opus单个包的最大字节数
+        private const val MAX_PACKET_BYTES = 4000
+
+        // 每次调用整帧拼接器最多输出的包数，超出的整帧留在native内部，紧接着再取
+        private const val MAX_PACKETS_PER_CALL = 8
     }
 
     private var encoderPtr: Long = 0L
     private var decoderPtr: Long = 0L
+    private var assemblerPtr: Long = 0L
+
+    // 整帧拼接器的输出缓冲区，录音线程上复用
+    private val packetBuffer = ByteArray(MAX_PACKETS_PER_CALL * MAX_PACKET_BYTES)
+    private val packetSizes = IntArray(MAX_PACKETS_PER_CALL)
     private var isInitialized = false
 
     /**
@@ -64,6 +75,12 @@ class OpusAudioCodec(
                 return@withContext false
             }
 
+            // 创建整帧拼接器，失败时只是不能用encodeChunk
+            assemblerPtr = OpusNative.createFrameAssembler(encoderPtr, channels, frameSize)
+            if (assemblerPtr == 0L) {
+                Log.w(TAG, "⚠️ Opus整帧拼接器创建失败，只能按整帧编码")
+            }
+
             isInitialized = true
             Log.d(TAG, "✅ Opus编解码器初始化成功: ${sampleRate}Hz, ${channels}ch, ${frameSize}samples, ${bitRate}bps")
             Log.d(TAG, "🔖 Opus版本: ${OpusNative.getVersion()}")
@@ -110,6 +127,82 @@ class OpusAudioCodec(
         }
     }
 
+    /**
+     * 编码任意长度的PCM块（比如AudioRecord.read返回的样本数），不需要凑成整帧
+     *
+     * 样本在native中拼成整帧后编码，不足一帧的余下部分留到下次调用，每个编码出的包
+     * 调用一次[onPacket]（参数为共享缓冲区、偏移和长度，只在回调期间有效）。
+     * 只能在一个线程上调用，新的录音开始时先调用[resetChunkEncoder]。
+     * @param buffer 直接缓冲区，本机字节序的16位PCM
+     * @param byteLength 有效字节数，从缓冲区开头算起
+     * @return 编码出的包数，失败返回负数
+     */
+    fun encodeChunk(
+        buffer: ByteBuffer,
+        byteLength: Int,
+        onPacket: (ByteArray, Int, Int) -> Unit
+    ): Int = drainAssembler(onPacket) { first ->
+        OpusNative.assembleFramesDirect(
+            assemblerPtr, buffer, 0, if (first) byteLength else 0, packetBuffer, packetSizes
+        )
+    }
+
+    /**
+     * 与[encodeChunk]相同，输入为数组中的一段
+     */
+    fun encodeChunk(
+        samples: ShortArray,
+        offset: Int,
+        length: Int,
+        onPacket: (ByteArray, Int, Int) -> Unit
+    ): Int = drainAssembler(onPacket) { first ->
+        OpusNative.assembleFrames(
+            assemblerPtr, samples, offset, if (first) length else 0, packetBuffer, packetSizes
+        )
+    }
+
+    /**
+     * 调用整帧拼接器并把输出的包交给onPacket；输出缓冲区被填满时，用空输入继续取出
+     * 留在native内部的整帧
+     */
+    private inline fun drainAssembler(
+        onPacket: (ByteArray, Int, Int) -> Unit,
+        assemble: (first: Boolean) -> Int
+    ): Int {
+        if (!isInitialized || assemblerPtr == 0L) {
+            Log.e(TAG, "❌ 整帧拼接器未初始化")
+            return -1
+        }
+        var total = 0
+        var first = true
+        while (true) {
+            val count = assemble(first)
+            first = false
+            if (count < 0) {
+                Log.e(TAG, "❌ Opus整帧编码失败: $count")
+                return if (total > 0) total else count
+            }
+            var offset = 0
+            for (i in 0 until count) {
+                onPacket(packetBuffer, offset, packetSizes[i])
+                offset += packetSizes[i]
+            }
+            total += count
+            if (count < MAX_PACKETS_PER_CALL) {
+                return total
+            }
+        }
+    }
+
+    /**
+     * 丢弃整帧拼接器中上一次录音余下的样本
+     */
+    fun resetChunkEncoder() {
+        if (assemblerPtr != 0L) {
+            OpusNative.resetFrameAssembler(assemblerPtr)
+        }
+    }
+
     /**
      * 解码Opus数据为PCM格式
      * @param opusData Opus编码的字节数组
@@ -282,6 +375,11 @@ class OpusAudioCodec(
      */
     fun cleanup() {
         try {
+            // 拼接器引用编码器，必须先销毁
+            if (assemblerPtr != 0L) {
+                OpusNative.destroyFrameAssembler(assemblerPtr)
+                assemblerPtr = 0L
+            }
             if (encoderPtr != 0L) {
                 OpusNative.destroyEncoder(encoderPtr)
                 encoderPtr = 0L
@@ -98,4 +98,360 @@ object OpusNative {
      * 获取解码器大小
      */
     external fun getDecoderSize(channels: Int): Int
+
+    /**
+     * 创建仅SILK的精简编码器（无CELT、无分析器、无额外延迟，最高宽带16kHz）
+     * 生成的数据包可被普通Opus解码器解码
+     * @param sampleRateInHz 采样率 (8000, 12000, 16000, 24000, 48000)
+     * @param channelConfig 通道数 (1=单声道, 2=立体声)
+     * @param complexity 复杂度 (0-10)
+     * @param bitrate 比特率
+     * @return 编码器指针，失败返回0
+     */
+    external fun createSilkEncoder(
+        sampleRateInHz: Int,
+        channelConfig: Int,
+        complexity: Int,
+        bitrate: Int
+    ): Long
+
+    /**
+     * 创建仅SILK的精简解码器，CELT和混合模式的数据包会返回错误
+     * @param sampleRateInHz 采样率
+     * @param channelConfig 通道数
+     * @return 解码器指针，失败返回0
+     */
+    external fun createSilkDecoder(sampleRateInHz: Int, channelConfig: Int): Long
+
+    /**
+     * 用SILK编码器编码PCM数据
+     * @param pSilkEnc 编码器指针
+     * @param samples PCM样本数据
+     * @param frameSize 帧大小（样本数，10/20/40/60ms）
+     * @param bytes 输出缓冲区
+     * @return 编码后的字节数，失败返回负数
+     */
+    external fun encodeSilk(
+        pSilkEnc: Long,
+        samples: ShortArray,
+        frameSize: Int,
+        bytes: ByteArray
+    ): Int
+
+    /**
+     * 用SILK解码器解码数据
+     * @param pSilkDec 解码器指针
+     * @param bytes Opus数据
+     * @param bytesLength 数据长度，为0时做丢包补偿
+     * @param samples 输出PCM缓冲区
+     * @param frameSize 期望的帧大小（丢包补偿时须为10ms的整数倍）
+     * @return 解码后的样本数，失败返回负数
+     */
+    external fun decodeSilk(
+        pSilkDec: Long,
+        bytes: ByteArray,
+        bytesLength: Int,
+        samples: ShortArray,
+        frameSize: Int
+    ): Int
+
+    /**
+     * 销毁SILK编码器
+     */
+    external fun destroySilkEncoder(pSilkEnc: Long)
+
+    /**
+     * 销毁SILK解码器
+     */
+    external fun destroySilkDecoder(pSilkDec: Long)
+
+    /**
+     * 获取SILK编码器大小
+     */
+    external fun getSilkEncoderSize(channels: Int): Int
+
+    /**
+     * 获取SILK解码器大小
+     */
+    external fun getSilkDecoderSize(channels: Int): Int
+
+    /**
+     * 把一整段录音离线编码成Ogg Opus文件（调试录音、缓存的TTS、数据集导出）
+     * 在静音处切分，各段用独立的编码器在多个线程上并行编码，再拼接成一个流，
+     * 结果与线程数无关
+     * @param samples PCM样本数据（立体声为交错存储）
+     * @param sampleRateInHz 采样率 (8000, 12000, 16000, 24000, 48000)
+     * @param channelConfig 通道数 (1=单声道, 2=立体声)
+     * @param complexity 复杂度 (0-10)
+     * @param bitrate 比特率
+     * @param threads 线程数，0表示每个核心一个线程
+     * @return Ogg Opus文件内容，失败返回null
+     */
+    external fun encodeOggOpus(
+        samples: ShortArray,
+        sampleRateInHz: Int,
+        channelConfig: Int,
+        complexity: Int,
+        bitrate: Int,
+        threads: Int
+    ): ByteArray?
+
+    /**
+     * 创建唤醒词前置过滤器（opus_wake_gate），用一个很小的网络判断音频里是否可能有语音，
+     * 只有它打开时才需要运行重型唤醒模型
+     * @param sampleRateInHz 采样率，只支持16000
+     * @return 过滤器指针，失败返回0
+     */
+    external fun createWakeGate(sampleRateInHz: Int): Long
+
+    /**
+     * 送入一段音频（任意长度，内部按10ms分帧）
+     * @param pGate 过滤器指针
+     * @param samples PCM样本数据
+     * @param length 样本数
+     * @return 本次完成的各10ms帧中最大的语音概率（0-255），失败返回负数
+     */
+    external fun processWakeGate(pGate: Long, samples: ShortArray, length: Int): Int
+
+    /**
+     * 重置过滤器状态（背景噪声估计和网络状态）
+     */
+    external fun resetWakeGate(pGate: Long)
+
+    /**
+     * 销毁唤醒词前置过滤器
+     */
+    external fun destroyWakeGate(pGate: Long)
+
+    /**
+     * 创建整帧拼接器，把任意长度的PCM块拼成整帧后用给定的编码器编码，
+     * 不足一帧的余下样本留在native内部，下次调用时接上
+     * @param pOpusEnc 编码器指针，拼接器不负责销毁它，必须先于编码器销毁
+     * @param channelConfig 通道数
+     * @param frameSize 每帧每声道的样本数
+     * @return 拼接器指针，失败返回0
+     */
+    external fun createFrameAssembler(pOpusEnc: Long, channelConfig: Int, frameSize: Int): Long
+
+    /**
+     * 送入数组中的一段PCM，编码出零个、一个或多个数据包
+     * @param pAsm 拼接器指针
+     * @param samples PCM样本数据（立体声为交错存储）
+     * @param offset 起始样本下标
+     * @param length 样本数
+     * @param packets 输出缓冲区，各个包依次紧挨着写入
+     * @param packetSizes 输出各个包的字节数，长度即每次调用最多的包数
+     * @return 写出的包数，失败返回负数。输出空间不够时整帧留在内部，下次调用时输出
+     */
+    external fun assembleFrames(
+        pAsm: Long,
+        samples: ShortArray,
+        offset: Int,
+        length: Int,
+        packets: ByteArray,
+        packetSizes: IntArray
+    ): Int
+
+    /**
+     * 与[assembleFrames]相同，但直接读取AudioRecord.read(ByteBuffer)写入的直接缓冲区，
+     * PCM不经过Java堆
+     * @param buffer 直接缓冲区，本机字节序的16位PCM
+     * @param byteOffset 起始字节
+     * @param byteLength 字节数（偶数）
+     */
+    external fun assembleFramesDirect(
+        pAsm: Long,
+        buffer: java.nio.ByteBuffer,
+        byteOffset: Int,
+        byteLength: Int,
+        packets: ByteArray,
+        packetSizes: IntArray
+    ): Int
+
+    /**
+     * 丢弃拼接器内部缓存的样本（新的一次录音开始时调用）
+     */
+    external fun resetFrameAssembler(pAsm: Long)
+
+    /**
+     * 销毁整帧拼接器
+     */
+    external fun destroyFrameAssembler(pAsm: Long)
+
+    /**
+     * 创建流式解码器，边下载边解码云端TTS的响应体（Ogg Opus或带2字节大端长度前缀的裸Opus，
+     * 根据开头自动判断），解码结果写入固定大小的播放环
+     * @param sampleRateInHz 输出采样率
+     * @param channelConfig 输出通道数
+     * @param ringMs 播放环长度，环满时feedStreamDecoder阻塞
+     * @return 解码器指针，失败返回0；首字节和首样本的时间从这里开始计算
+     */
+    external fun createStreamDecoder(sampleRateInHz: Int, channelConfig: Int, ringMs: Int): Long
+
+    /**
+     * 送入响应体的下一块数据，不需要按页或包对齐；播放环满时阻塞
+     * @return 0成功，负数为流格式错误或解码失败
+     */
+    external fun feedStreamDecoder(pStreamDec: Long, bytes: ByteArray, length: Int): Int
+
+    /**
+     * 响应体已经结束
+     */
+    external fun finishStreamDecoder(pStreamDec: Long)
+
+    /**
+     * 停止：唤醒阻塞中的feedStreamDecoder和readStreamDecoder，可以在任何线程上调用
+     */
+    external fun cancelStreamDecoder(pStreamDec: Long)
+
+    /**
+     * 从播放环取出PCM，环为空时最多等待timeoutMs毫秒
+     * @return 样本数，超时返回0，流已结束或已取消返回-1
+     */
+    external fun readStreamDecoder(pStreamDec: Long, samples: ShortArray, timeoutMs: Int): Int
+
+    /**
+     * 从创建解码器到第一个样本进入播放环的毫秒数，还没有样本时返回-1
+     */
+    external fun getStreamFirstSampleMs(pStreamDec: Long): Float
+
+    /**
+     * 销毁流式解码器，调用前feed和read都必须已经返回
+     */
+    external fun destroyStreamDecoder(pStreamDec: Long)
+
+    /** 录音会话的消费者：唤醒词检测 */
+    const val CAPTURE_WAKE = 0
+
+    /** 录音会话的消费者：唤醒之后的语音识别 */
+    const val CAPTURE_ASR = 1
+
+    /**
+     * 创建录音会话：一路持续录音，按样本精确地在唤醒词检测和语音识别之间切换所有权，
+     * 不是所有者的读取阻塞在eventfd上，切换时不丢样本、不用重新启动AudioRecord
+     * @param sampleRateInHz 采样率（单声道）
+     * @param ringMs 环的长度，要能放下语音识别建立连接期间的录音
+     * @return 会话指针，失败返回0；一开始的所有者是CAPTURE_WAKE
+     */
+    external fun createCaptureSession(sampleRateInHz: Int, ringMs: Int): Long
+
+    /**
+     * 写入AudioRecord.read(ByteBuffer)读到的16位PCM，从不阻塞，环满时覆盖最旧的样本
+     * @return 0成功，负数为参数错误
+     */
+    external fun writeCaptureSessionDirect(
+        pCapture: Long,
+        buffer: java.nio.ByteBuffer,
+        byteLength: Int
+    ): Int
+
+    /**
+     * 以consumer的身份读出最多length个样本，不是所有者或者没有新样本时最多等待timeoutMs毫秒
+     * @return 样本数，超时返回0，会话已取消返回-1
+     */
+    external fun readCaptureSession(
+        pCapture: Long,
+        consumer: Int,
+        samples: ShortArray,
+        offset: Int,
+        length: Int,
+        timeoutMs: Int
+    ): Int
+
+    /**
+     * 与readCaptureSession相同，但直接读到ByteBuffer.allocateDirect的缓冲区里
+     * @return 字节数，超时返回0，会话已取消返回-1
+     */
+    external fun readCaptureSessionDirect(
+        pCapture: Long,
+        consumer: Int,
+        buffer: java.nio.ByteBuffer,
+        maxBytes: Int,
+        timeoutMs: Int
+    ): Int
+
+    /**
+     * 把还没有读走的样本（包括以后录到的）交给consumer，唤醒阻塞中的consumer
+     * @return 切换点（从开始录音算起的样本数）
+     */
+    external fun handoffCaptureSession(pCapture: Long, consumer: Int): Long
+
+    /**
+     * 当前的所有者（CAPTURE_WAKE或CAPTURE_ASR）
+     */
+    external fun getCaptureSessionOwner(pCapture: Long): Int
+
+    /**
+     * 停止：唤醒所有阻塞中的读取，之后的读取返回-1，可以在任何线程上调用
+     */
+    external fun cancelCaptureSession(pCapture: Long)
+
+    /**
+     * 销毁录音会话，调用前所有的读写都必须已经返回
+     */
+    external fun destroyCaptureSession(pCapture: Long)
+
+    /** 音频线程的角色：WakeService的录音线程 */
+    const val AUDIO_THREAD_CAPTURE = 0
+
+    /** 音频线程的角色：唤醒词检测 */
+    const val AUDIO_THREAD_WAKE = 1
+
+    /** 音频线程的角色：语音识别上行的编码和发送 */
+    const val AUDIO_THREAD_ENCODE = 2
+
+    /** 音频线程的角色：云端TTS播放 */
+    const val AUDIO_THREAD_PLAYBACK = 3
+
+    /**
+     * 把调用线程设置为音频线程：按角色尝试SCHED_FIFO或者更低的nice值、绑定到大核
+     * （/sys/devices/system/cpu/cpuN/cpu_capacity）、创建APerformanceHint会话（API 33+）
+     * @param targetWorkNanos 每帧的目标工作时长，0表示不创建APerformanceHint会话
+     * @return 句柄，失败返回0；leaveAudioThread时恢复原来的设置
+     */
+    external fun enterAudioThread(role: Int, targetWorkNanos: Long): Long
+
+    /**
+     * 报告一帧实际的工作时长（不包括等待数据的时间）
+     */
+    external fun reportAudioThreadWork(pThread: Long, actualWorkNanos: Long)
+
+    /**
+     * 恢复线程原来的调度策略、nice值和亲和性，关闭APerformanceHint会话
+     */
+    external fun leaveAudioThread(pThread: Long)
+
+    /**
+     * 写入原生的二进制事件环：编号（AudioTrace里登记的，64以下留给原生代码）、
+     * 调用时的CLOCK_MONOTONIC时间和最多4个整数参数。不分配内存、不格式化、不阻塞
+     */
+    external fun traceEvent(id: Int, a0: Int, a1: Int, a2: Int, a3: Int)
+
+    /**
+     * 登记事件的名字和日志格式
+     * @param argNames 逗号分隔的参数名，导出JSON时使用
+     * @param format 写入日志的printf格式，只能有最多4个%d、%i、%u、%x；为空时只导出、不写日志
+     * @return 编号或者格式不合法时返回false
+     */
+    external fun registerTraceEvent(
+        id: Int,
+        tag: String,
+        name: String,
+        argNames: String,
+        format: String
+    ): Boolean
+
+    /**
+     * 取出上一次之后写入的最多maxEvents个事件，按登记的格式写成"tag\t[秒.毫秒] 消息"，
+     * 每行一个；只能在一个线程上调用
+     * @return 没有要写日志的事件时返回null
+     */
+    external fun drainTrace(maxEvents: Int): String?
+
+    /**
+     * 把事件环中现有的事件导出成Chrome的JSON trace格式（Perfetto UI可以直接打开），
+     * 不影响drainTrace
+     * @return 导出的事件数，失败返回-1
+     */
+    external fun exportTrace(path: String): Int
 }
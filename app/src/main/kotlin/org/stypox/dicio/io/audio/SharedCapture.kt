@@ -0,0 +1,80 @@
+package org.stypox.dicio.io.audio
+
+/**
+ * WakeService持续录音的会话（见[OpusNative.createCaptureSession]），唤醒之后交给语音识别。
+ *
+ * WakeService的检测循环开始时[publish]，检测到唤醒词时把会话交给CAPTURE_ASR；
+ * WebSocketInputDevice开始录音时用[acquireForAsr]取得会话，从切换点开始读取，不用再开一个
+ * AudioRecord，结束时[release]把没有读走的样本交回唤醒词检测。会话由引用计数管理，
+ * 最后一个release的销毁会话，检测循环重启时不会销毁还在被读取的会话。
+ */
+object SharedCapture {
+
+    class Session internal constructor(val ptr: Long) {
+        internal var refs = 1 // 由SharedCapture的锁保护
+    }
+
+    private var current: Session? = null
+
+    /**
+     * 发布新建的会话，调用方持有返回值的一个引用
+     */
+    @Synchronized
+    fun publish(ptr: Long): Session {
+        return Session(ptr).also { current = it }
+    }
+
+    /**
+     * 撤回会话：唤醒所有阻塞中的读取（之后返回-1），并释放publish得到的引用
+     */
+    @Synchronized
+    fun withdraw(session: Session) {
+        if (current === session) {
+            current = null
+        }
+        OpusNative.cancelCaptureSession(session.ptr)
+        release(session, handBack = false)
+    }
+
+    /**
+     * 会话已经交给语音识别时返回它并增加引用，否则返回null（调用方自己录音）
+     */
+    @Synchronized
+    fun acquireForAsr(): Session? {
+        val session = current ?: return null
+        if (OpusNative.getCaptureSessionOwner(session.ptr) != OpusNative.CAPTURE_ASR) {
+            return null
+        }
+        session.refs++
+        return session
+    }
+
+    /**
+     * 把还没有读走的样本交给consumer；会话已经销毁时什么也不做
+     * @return 切换点，会话已经销毁时返回-1
+     */
+    @Synchronized
+    fun handoff(session: Session, consumer: Int): Long {
+        if (session.refs == 0) {
+            return -1
+        }
+        return OpusNative.handoffCaptureSession(session.ptr, consumer)
+    }
+
+    /**
+     * 释放一个引用，调用前这个引用的持有者对会话的读写都必须已经返回
+     * @param handBack 是否把录音交回唤醒词检测（语音识别结束时）
+     */
+    @Synchronized
+    fun release(session: Session, handBack: Boolean = true) {
+        if (session.refs == 0) {
+            return
+        }
+        if (handBack) {
+            OpusNative.handoffCaptureSession(session.ptr, OpusNative.CAPTURE_WAKE)
+        }
+        if (--session.refs == 0) {
+            OpusNative.destroyCaptureSession(session.ptr)
+        }
+    }
+}
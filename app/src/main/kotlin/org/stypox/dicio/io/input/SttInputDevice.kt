@@ -12,4 +12,11 @@ interface SttInputDevice {
     fun onClick(eventListener: (InputEvent) -> Unit)
 
     suspend fun destroy()
+
+    /**
+     * Whether this device reads the audio that WakeService hands over after the wake word (see
+     * [org.stypox.dicio.io.audio.SharedCapture]) instead of opening its own AudioRecord.
+     */
+    val usesSharedCapture: Boolean
+        get() = false
 }
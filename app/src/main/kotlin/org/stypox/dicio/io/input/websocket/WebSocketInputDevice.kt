@@ -11,6 +11,9 @@ import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.flow.asStateFlow
 import org.json.JSONObject
+import org.stypox.dicio.io.audio.AudioThreadScope
+import org.stypox.dicio.io.audio.OpusNative
+import org.stypox.dicio.io.audio.SharedCapture
 import org.stypox.dicio.io.input.InputEvent
 import org.stypox.dicio.io.input.SttInputDevice
 import org.stypox.dicio.io.input.SttState
@@ -37,8 +40,12 @@ class WebSocketInputDevice(
         private const val CHANNEL_CONFIG = AudioFormat.CHANNEL_IN_MONO
         private const val AUDIO_FORMAT = AudioFormat.ENCODING_PCM_16BIT
         private const val FRAME_SIZE = 640 // 20ms @ 16kHz
+        private const val FRAME_NANOS = 20_000_000L
+        private const val CAPTURE_READ_TIMEOUT_MS = 100 // 停止录音后最多这么久读取循环退出
     }
 
+    override val usesSharedCapture = true
+
     private val scope = CoroutineScope(Dispatchers.IO + SupervisorJob())
     
     // 状态
@@ -144,79 +151,105 @@ class WebSocketInputDevice(
         }
 
         try {
-            val bufferSize = AudioRecord.getMinBufferSize(
-                SAMPLE_RATE,
-                CHANNEL_CONFIG,
-                AUDIO_FORMAT
-            ).coerceAtLeast(FRAME_SIZE * 2)
+            // 唤醒之后WakeService把持续录音交给了语音识别：从唤醒词之后的第一个样本开始读，
+            // 连接服务器期间说的话也在里面，不用再开一个AudioRecord
+            val capture = SharedCapture.acquireForAsr()
+            if (capture == null) {
+                val bufferSize = AudioRecord.getMinBufferSize(
+                    SAMPLE_RATE,
+                    CHANNEL_CONFIG,
+                    AUDIO_FORMAT
+                ).coerceAtLeast(FRAME_SIZE * 2)
 
-            audioRecord = AudioRecord(
-                MediaRecorder.AudioSource.VOICE_RECOGNITION,
-                SAMPLE_RATE,
-                CHANNEL_CONFIG,
-                AUDIO_FORMAT,
-                bufferSize
-            )
+                audioRecord = AudioRecord(
+                    MediaRecorder.AudioSource.VOICE_RECOGNITION,
+                    SAMPLE_RATE,
+                    CHANNEL_CONFIG,
+                    AUDIO_FORMAT,
+                    bufferSize
+                )
 
-            if (audioRecord?.state != AudioRecord.STATE_INITIALIZED) {
-                Log.e(TAG, "❌ AudioRecord 初始化失败")
-                _uiState.emit(SttState.ErrorLoading(Exception("AudioRecord 初始化失败")))
-                return@withContext
-            }
+                if (audioRecord?.state != AudioRecord.STATE_INITIALIZED) {
+                    Log.e(TAG, "❌ AudioRecord 初始化失败")
+                    _uiState.emit(SttState.ErrorLoading(Exception("AudioRecord 初始化失败")))
+                    return@withContext
+                }
 
-            audioRecord?.startRecording()
+                audioRecord?.startRecording()
+            }
             isRecording.set(true)
             
-            Log.d(TAG, "✅ 音频录制已开始")
+            Log.d(TAG, if (capture != null) "✅ 音频录制已开始（唤醒词的录音会话）" else "✅ 音频录制已开始")
             
             // 通知服务器开始监听
             sendStartListening()
 
             // 启动音频数据发送任务
             recordingJob = scope.launch {
-                val buffer = ShortArray(FRAME_SIZE)
-                
-                var frameCount = 0
-                while (isRecording.get() && isActive) {
-                    val readSize = audioRecord?.read(buffer, 0, buffer.size) ?: 0
-                    
-                    if (readSize > 0) {
-                        // 使用音频处理器编码音频数据
-                        val audioProcessor = protocol?.getAudioProcessor()
-                        val encodedAudio = if (audioProcessor != null) {
-                            // 使用自适应音频处理器编码
-                            audioProcessor.encodeAudio(buffer.copyOf(readSize))
+                // AudioRecord直接写入native可读的缓冲区，PCM不经过Java堆；
+                // 每次读到多少都直接交给整帧拼接器，不要求恰好一帧
+                val buffer = java.nio.ByteBuffer.allocateDirect(FRAME_SIZE * 2)
+                    .order(java.nio.ByteOrder.nativeOrder())
+                val audioProcessor = protocol?.getAudioProcessor()
+                audioProcessor?.resetChunkEncoder()
+
+                var chunkCount = 0
+                var packetCount = 0
+                var packetBytes = 0L
+                val sendPacket = { bytes: ByteArray, offset: Int, length: Int ->
+                    packetCount++
+                    packetBytes += length
+                    protocol?.sendEncodedAudio(bytes, offset, length)
+                    Unit
+                }
+                // 循环里没有挂起点，一直在这个线程上，可以临时提高它的优先级
+                val threadScope = AudioThreadScope(OpusNative.AUDIO_THREAD_ENCODE, FRAME_NANOS)
+                try {
+                    while (isRecording.get() && isActive) {
+                        val readBytes = if (capture != null) {
+                            OpusNative.readCaptureSessionDirect(capture.ptr, OpusNative.CAPTURE_ASR,
+                                buffer, buffer.capacity(), CAPTURE_READ_TIMEOUT_MS)
                         } else {
-                            // 降级到PCM字节数组
-                            val byteBuffer = java.nio.ByteBuffer.allocate(readSize * 2)
-                            byteBuffer.order(java.nio.ByteOrder.LITTLE_ENDIAN)
-                            for (i in 0 until readSize) {
-                                byteBuffer.putShort(buffer[i])
-                            }
-                            byteBuffer.array()
+                            audioRecord?.read(buffer, buffer.capacity()) ?: 0
                         }
-                        
-                        if (encodedAudio != null) {
-                            // 每100帧打印一次详细信息用于调试
-                            if (frameCount % 100 == 0) {
-                                val codecInfo = audioProcessor?.getCodecInfo() ?: "PCM fallback"
-                                val compressionInfo = audioProcessor?.getCompressionInfo() ?: "无压缩"
-                                Log.d(TAG, "🎵 Frame $frameCount: ${readSize * 2} -> ${encodedAudio.size} bytes ($codecInfo, $compressionInfo)")
-                            }
-                            frameCount++
-                            
-                            // 发送编码后的音频数据到服务器
-                            val currentProtocol = protocol
-                            if (currentProtocol is WebSocketProtocol) {
-                                currentProtocol.sendEncodedAudio(encodedAudio)
-                            } else {
-                                currentProtocol?.sendAudio(encodedAudio)
+                        if (readBytes < 0 && capture != null) {
+                            // WakeService停止了检测循环，会话已经撤回
+                            Log.w(TAG, "⚠️ 唤醒词的录音会话已结束")
+                            isRecording.set(false)
+                            break
+                        }
+                        if (readBytes <= 0) {
+                            continue
+                        }
+
+                        if (audioProcessor != null) {
+                            // 使用自适应音频处理器编码，一块录音可能产生零个、一个或多个包
+                            val workStart = System.nanoTime()
+                            if (!audioProcessor.encodeAudioChunk(buffer, readBytes, sendPacket)) {
+                                Log.w(TAG, "⚠️ 音频编码失败，跳过当前块")
                             }
+                            threadScope.reportWork(System.nanoTime() - workStart)
                         } else {
-                            Log.w(TAG, "⚠️ 音频编码失败，跳过当前帧")
+                            // 降级到PCM字节数组（本机字节序即小端）
+                            val bytes = ByteArray(readBytes)
+                            buffer.duplicate().apply { position(0) }.get(bytes)
+                            sendPacket(bytes, 0, readBytes)
+                        }
+
+                        // 每100块打印一次详细信息用于调试
+                        if (chunkCount % 100 == 0) {
+                            val codecInfo = audioProcessor?.getCodecInfo() ?: "PCM fallback"
+                            val compressionInfo = audioProcessor?.getCompressionInfo() ?: "无压缩"
+                            Log.d(TAG, "🎵 Chunk $chunkCount: 已发送${packetCount}个包, $packetBytes bytes ($codecInfo, $compressionInfo)")
                         }
+                        chunkCount++
                     }
+                } finally {
+                    threadScope.close()
                 }
+            }.also { job ->
+                // 任务结束（包括还没有开始就被取消）之后才归还录音会话，没有读走的样本交回唤醒词检测
+                capture?.let { job.invokeOnCompletion { _ -> SharedCapture.release(it) } }
             }
 
         } catch (e: Exception) {
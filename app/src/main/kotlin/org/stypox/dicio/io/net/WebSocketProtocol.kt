@@ -209,6 +209,17 @@ class WebSocketProtocol(
         }
     }
 
+    /**
+     * 发送数组中的一段已编码音频（整帧拼接器的共享输出缓冲区），数据在返回前被复制
+     */
+    fun sendEncodedAudio(encodedAudio: ByteArray, offset: Int, length: Int) {
+        webSocket?.send(ByteString.of(encodedAudio, offset, length))?.also {
+            Log.v(TAG, "📤 发送已编码音频数据: $length 字节")
+        } ?: run {
+            Log.w(TAG, "WebSocket 未连接，无法发送音频数据")
+        }
+    }
+
     override fun onTextMessage(callback: (String) -> Unit) {
         onTextMessageCallback = callback
     }
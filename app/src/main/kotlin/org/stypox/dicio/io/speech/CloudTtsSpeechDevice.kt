@@ -12,6 +12,8 @@ import okhttp3.MediaType.Companion.toMediaType
 import okhttp3.RequestBody.Companion.toRequestBody
 import org.dicio.skill.context.SpeechOutputDevice
 import org.json.JSONObject
+import org.stypox.dicio.io.audio.AudioThreadScope
+import org.stypox.dicio.io.audio.OpusNative
 import org.stypox.dicio.util.WebSocketConfig
 import java.io.IOException
 import java.util.concurrent.TimeUnit
@@ -32,6 +34,8 @@ class CloudTtsSpeechDevice(
         private const val CHANNEL_CONFIG = AudioFormat.CHANNEL_OUT_MONO
         private const val AUDIO_FORMAT = AudioFormat.ENCODING_PCM_16BIT
         private const val REQUEST_TIMEOUT = 30L // 请求超时时间（秒）
+        private const val STREAM_RING_MS = 500 // 流式解码的播放环长度
+        private const val STREAM_PREBUFFER_MS = 60 // 攒够这么多再开始播放，吸收网络抖动
     }
 
     private val scope = CoroutineScope(Dispatchers.Main + SupervisorJob())
@@ -57,6 +61,11 @@ class CloudTtsSpeechDevice(
     // 播放完成回调列表
     private val finishCallbacks = mutableListOf<Runnable>()
 
+    // 正在进行的流式合成，stopSpeaking时取消
+    private val streamLock = Any()
+    private var streamDecoderPtr = 0L
+    private var streamCall: Call? = null
+
     init {
         Log.d(TAG, "🚀 初始化 CloudTtsSpeechDevice")
     }
@@ -75,7 +84,16 @@ class CloudTtsSpeechDevice(
         scope.launch(Dispatchers.IO) {
             try {
                 isSpeakingFlag.set(true)
-                
+
+                // 优先请求Opus，边下载边播放；服务器不支持时退回到整段PCM
+                if (streamTtsSynthesis(speechOutput)) {
+                    return@launch
+                }
+                if (!isSpeakingFlag.get()) {
+                    handlePlaybackFinished()
+                    return@launch
+                }
+
                 // 构建 TTS 请求
                 val audioData = requestTtsSynthesis(speechOutput)
                 
@@ -94,6 +112,144 @@ class CloudTtsSpeechDevice(
         }
     }
 
+    /**
+     * 流式 TTS：请求 Opus 格式，响应体每到一块就交给原生流式解码器，
+     * 播放环里攒够 [STREAM_PREBUFFER_MS] 就开始播放，不用等整句下载完
+     * @return 是否已经处理（包括播放完成和中途停止），false 表示需要退回到 PCM 请求
+     */
+    private suspend fun streamTtsSynthesis(text: String): Boolean = withContext(Dispatchers.IO) {
+        val decoderPtr = try {
+            OpusNative.createStreamDecoder(SAMPLE_RATE, 1, STREAM_RING_MS)
+        } catch (e: UnsatisfiedLinkError) {
+            0L
+        }
+        if (decoderPtr == 0L) {
+            return@withContext false
+        }
+
+        var playback: Job? = null
+        try {
+            val requestJson = JSONObject().apply {
+                put("text", text)
+                put("voice", "default")
+                put("speed", 1.0)
+                put("pitch", 1.0)
+                put("volume", 1.0)
+                put("format", "opus") // Ogg Opus 或带长度前缀的裸 Opus
+                put("sample_rate", SAMPLE_RATE)
+                put("channels", 1)
+            }
+            val request = Request.Builder()
+                .url("${WebSocketConfig.getHttpUrl(context)}/api/v1/tts/synthesize")
+                .post(requestJson.toString().toRequestBody("application/json".toMediaType()))
+                .addHeader("Authorization", "Bearer ${WebSocketConfig.getAccessToken(context)}")
+                .addHeader("Accept", "audio/ogg, audio/opus")
+                .build()
+
+            val call = httpClient.newCall(request)
+            synchronized(streamLock) {
+                streamDecoderPtr = decoderPtr
+                streamCall = call
+            }
+            call.execute().use { response ->
+                val contentType = response.body?.contentType()?.subtype ?: ""
+                if (!response.isSuccessful || (contentType != "ogg" && contentType != "opus")) {
+                    Log.w(TAG, "⚠️ 服务器不支持流式 Opus (${response.code}, $contentType)，退回到 PCM")
+                    return@withContext false
+                }
+
+                playback = launch { playStream(decoderPtr) }
+
+                // 网络线程：收到多少送多少，播放环满时 feed 阻塞，TCP 流量控制让下载跟上播放即可
+                val input = response.body!!.byteStream()
+                val chunk = ByteArray(8192)
+                while (isSpeakingFlag.get()) {
+                    val read = input.read(chunk)
+                    if (read < 0) {
+                        break
+                    }
+                    if (OpusNative.feedStreamDecoder(decoderPtr, chunk, read) < 0) {
+                        Log.e(TAG, "❌ TTS 音频流无法解码，停止播放")
+                        OpusNative.cancelStreamDecoder(decoderPtr)
+                        break
+                    }
+                }
+                OpusNative.finishStreamDecoder(decoderPtr)
+                playback?.join()
+            }
+            true
+        } catch (e: IOException) {
+            // stopSpeaking 取消请求时也会到这里
+            if (isSpeakingFlag.get()) {
+                Log.e(TAG, "❌ 流式 TTS 网络请求失败: ${e.message}", e)
+            }
+            when {
+                playback != null -> true // 播放线程收尾
+                isSpeakingFlag.get() -> false // 还没开始播放，可以退回到 PCM
+                else -> {
+                    handlePlaybackFinished()
+                    true
+                }
+            }
+        } finally {
+            synchronized(streamLock) {
+                streamDecoderPtr = 0L
+                streamCall = null
+            }
+            // 播放线程可能还阻塞在 readStreamDecoder 里，先唤醒并等它退出再销毁
+            OpusNative.cancelStreamDecoder(decoderPtr)
+            withContext(NonCancellable) { playback?.join() }
+            OpusNative.destroyStreamDecoder(decoderPtr)
+        }
+    }
+
+    /**
+     * 播放线程：从播放环取出 PCM 写入 AudioTrack，直到流结束或被取消
+     */
+    private suspend fun playStream(decoderPtr: Long) = withContext(Dispatchers.IO) {
+        val track = createAudioTrack(
+            AudioTrack.getMinBufferSize(SAMPLE_RATE, CHANNEL_CONFIG, AUDIO_FORMAT)
+        )
+        if (track == null) {
+            OpusNative.cancelStreamDecoder(decoderPtr)
+            handlePlaybackFinished()
+            return@withContext
+        }
+        audioTrack = track
+
+        val prebufferSamples = SAMPLE_RATE * STREAM_PREBUFFER_MS / 1000
+        val buffer = ShortArray(SAMPLE_RATE / 50) // 20ms
+        var written = 0
+        var playing = false
+        // 写入循环里没有挂起点，一直在这个线程上，可以临时提高它的优先级
+        AudioThreadScope(OpusNative.AUDIO_THREAD_PLAYBACK).use {
+            while (isSpeakingFlag.get()) {
+                val samples = OpusNative.readStreamDecoder(decoderPtr, buffer, 50)
+                if (samples < 0) {
+                    break
+                }
+                if (samples > 0 && track.write(buffer, 0, samples) > 0) {
+                    written += samples
+                }
+                if (!playing && written >= prebufferSamples) {
+                    track.play()
+                    playing = true
+                    Log.d(TAG, "🎵 流式 TTS 开始播放，首样本 ${OpusNative.getStreamFirstSampleMs(decoderPtr)}ms")
+                }
+            }
+        }
+        if (!playing && written > 0 && isSpeakingFlag.get()) {
+            track.play() // 整句比预缓冲还短
+        }
+
+        // 等待 AudioTrack 把写入的样本播完
+        while (isSpeakingFlag.get() && track.playbackHeadPosition < written) {
+            delay(20)
+        }
+        Log.d(TAG, "✅ 流式音频播放完成: $written 样本")
+        handlePlaybackFinished()
+    }
+
     /**
      * 请求 TTS 合成
      */
@@ -165,27 +321,8 @@ class CloudTtsSpeechDevice(
                 AUDIO_FORMAT
             ).coerceAtLeast(audioData.size)
             
-            // 创建 AudioTrack
-            audioTrack = AudioTrack.Builder()
-                .setAudioAttributes(
-                    AudioAttributes.Builder()
-                        .setUsage(AudioAttributes.USAGE_MEDIA)
-                        .setContentType(AudioAttributes.CONTENT_TYPE_SPEECH)
-                        .build()
-                )
-                .setAudioFormat(
-                    AudioFormat.Builder()
-                        .setEncoding(AUDIO_FORMAT)
-                        .setSampleRate(SAMPLE_RATE)
-                        .setChannelMask(CHANNEL_CONFIG)
-                        .build()
-                )
-                .setBufferSizeInBytes(bufferSize)
-                .setTransferMode(AudioTrack.MODE_STREAM)
-                .build()
-            
-            if (audioTrack?.state != AudioTrack.STATE_INITIALIZED) {
-                Log.e(TAG, "❌ AudioTrack 初始化失败")
+            audioTrack = createAudioTrack(bufferSize)
+            if (audioTrack == null) {
                 handlePlaybackFinished()
                 return@withContext
             }
@@ -236,6 +373,36 @@ class CloudTtsSpeechDevice(
         }
     }
 
+    /**
+     * 创建 MODE_STREAM 的 AudioTrack，失败返回 null
+     */
+    private fun createAudioTrack(bufferSize: Int): AudioTrack? {
+        val track = AudioTrack.Builder()
+            .setAudioAttributes(
+                AudioAttributes.Builder()
+                    .setUsage(AudioAttributes.USAGE_MEDIA)
+                    .setContentType(AudioAttributes.CONTENT_TYPE_SPEECH)
+                    .build()
+            )
+            .setAudioFormat(
+                AudioFormat.Builder()
+                    .setEncoding(AUDIO_FORMAT)
+                    .setSampleRate(SAMPLE_RATE)
+                    .setChannelMask(CHANNEL_CONFIG)
+                    .build()
+            )
+            .setBufferSizeInBytes(bufferSize)
+            .setTransferMode(AudioTrack.MODE_STREAM)
+            .build()
+
+        if (track.state != AudioTrack.STATE_INITIALIZED) {
+            Log.e(TAG, "❌ AudioTrack 初始化失败")
+            track.release()
+            return null
+        }
+        return track
+    }
+
     /**
      * 处理播放完成
      */
@@ -268,6 +435,15 @@ class CloudTtsSpeechDevice(
         // 取消播放任务
         playbackJob?.cancel()
         playbackJob = null
+
+        // 唤醒阻塞在流式解码器上的网络线程和播放线程
+        isSpeakingFlag.set(false)
+        synchronized(streamLock) {
+            if (streamDecoderPtr != 0L) {
+                OpusNative.cancelStreamDecoder(streamDecoderPtr)
+            }
+            streamCall?.cancel()
+        }
         
         // 停止音频播放
         scope.launch(Dispatchers.IO) {
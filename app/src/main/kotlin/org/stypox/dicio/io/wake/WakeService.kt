@@ -36,13 +36,21 @@ import org.stypox.dicio.R
 import org.stypox.dicio.di.SttInputDeviceWrapper
 import org.stypox.dicio.di.WakeDeviceWrapper
 import org.stypox.dicio.eval.SkillEvaluator
+import org.stypox.dicio.io.audio.AudioThreadScope
+import org.stypox.dicio.io.audio.AudioTrace
+import org.stypox.dicio.io.audio.OpusNative
+import org.stypox.dicio.io.audio.SharedCapture
 import org.stypox.dicio.util.DebugLogger
 import org.stypox.dicio.util.AudioDebugSaver
 import org.stypox.dicio.io.wake.WakeWordCallbackManager
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
 import java.time.Instant
 import java.util.concurrent.atomic.AtomicBoolean
 import java.util.concurrent.atomic.AtomicReference
+import java.util.concurrent.locks.ReentrantLock
 import javax.inject.Inject
+import kotlin.concurrent.withLock
 
 @AndroidEntryPoint
 class WakeService : Service() {
@@ -54,6 +62,15 @@ class WakeService : Service() {
     private val audioRecordPaused = AtomicBoolean(false) // 用于暂停AudioRecord以避免与ASR冲突
     private var currentAudioRecord: AudioRecord? = null // 当前的AudioRecord实例
 
+    // 持续录音的会话（原生库可用时）：AudioRecord从头到尾不停，唤醒之后在唤醒词那一帧的末尾
+    // 把录音交给语音识别，识别结束后交回，不丢样本，也不用轮询和重启AudioRecord
+    @Volatile
+    private var captureSession: SharedCapture.Session? = null
+    private val captureLock = ReentrantLock()
+    private val captureResumed = captureLock.newCondition()
+    // 语音识别自己开AudioRecord时，录音线程停下录音把麦克风让出来；由captureLock保护
+    private var captureStopped = false
+
     @Inject
     lateinit var skillEvaluator: SkillEvaluator
     @Inject
@@ -389,6 +406,17 @@ class WakeService : Service() {
         currentAudioRecord = ar
         DebugLogger.logAudioProcessing(TAG, "🎵 AudioRecord created successfully")
 
+        val sessionPtr = try {
+            OpusNative.createCaptureSession(16000, CAPTURE_RING_MS)
+        } catch (e: UnsatisfiedLinkError) {
+            0L
+        }
+        if (sessionPtr != 0L) {
+            listenWithCaptureSession(ar, sessionPtr)
+            return
+        }
+        DebugLogger.logWakeWord(TAG, "⚠️ 原生录音会话不可用，唤醒之后暂停AudioRecord")
+
         var audio = ShortArray(0)
         var nextWakeWordAllowed = Instant.MIN
         var frameCount = 0
@@ -426,7 +454,9 @@ class WakeService : Service() {
                 if (audio.size != wakeDevice.frameSize()) {
                     val oldSize = audio.size
                     audio = ShortArray(wakeDevice.frameSize())
-                    DebugLogger.logAudioProcessing(TAG, "🔄 Audio buffer resized: $oldSize -> ${audio.size}")
+                    AudioTrace.event(AudioTrace.WAKE_BUFFER_RESIZED, oldSize, audio.size) {
+                        DebugLogger.logAudioProcessing(TAG, "🔄 Audio buffer resized: $oldSize -> ${audio.size}")
+                    }
                 }
 
                 // 只有在AudioRecord正在录制时才读取数据
@@ -436,7 +466,9 @@ class WakeService : Service() {
                     
                     // 每100帧记录一次调试信息
                     if (frameCount % 100 == 0) {
-                        DebugLogger.logAudioProcessing(TAG, "🔄 Frame #$frameCount, bytesRead=$bytesRead")
+                        AudioTrace.event(AudioTrace.WAKE_READ, frameCount, bytesRead) {
+                            DebugLogger.logAudioProcessing(TAG, "🔄 Frame #$frameCount, bytesRead=$bytesRead")
+                        }
                     }
                     
                     if (bytesRead > 0) {
@@ -445,12 +477,16 @@ class WakeService : Service() {
                         
                         if (wakeWordDetected) {
                             if (now > nextWakeWordAllowed) {
-                                DebugLogger.logWakeWord(TAG, "🎯 WAKE WORD DETECTED! Frame #$frameCount")
+                                AudioTrace.event(AudioTrace.WAKE_DETECTED, frameCount) {
+                                    DebugLogger.logWakeWord(TAG, "🎯 WAKE WORD DETECTED! Frame #$frameCount")
+                                }
                                 nextWakeWordAllowed = now.plusMillis(WAKE_WORD_BACKOFF_MILLIS)
                                 onWakeWordDetected()
                             } else {
                                 val remainingMs = nextWakeWordAllowed.toEpochMilli() - now.toEpochMilli()
-                                DebugLogger.logWakeWord(TAG, "⏳ Wake word detected but in backoff period (${remainingMs}ms remaining)")
+                                AudioTrace.event(AudioTrace.WAKE_BACKOFF, remainingMs.toInt(), frameCount) {
+                                    DebugLogger.logWakeWord(TAG, "⏳ Wake word detected but in backoff period (${remainingMs}ms remaining)")
+                                }
                             }
                         }
 
@@ -458,12 +494,16 @@ class WakeService : Service() {
                         
                         // 每1000帧记录一次状态
                         if (frameCount % 1000 == 0) {
-                            DebugLogger.logAudioProcessing(TAG, "📊 Processed $frameCount frames, still listening...")
+                            AudioTrace.event(AudioTrace.WAKE_PROGRESS, frameCount) {
+                                DebugLogger.logAudioProcessing(TAG, "📊 Processed $frameCount frames, still listening...")
+                            }
                         }
                     } else if (bytesRead == 0) {
                         // 0字节可能是正常的，特别是在暂停/恢复期间
                         if (frameCount % 1000 == 0) {
-                            DebugLogger.logWakeWord(TAG, "⚠️ AudioRecord read 0 bytes (frame #$frameCount)")
+                            AudioTrace.event(AudioTrace.WAKE_READ_EMPTY, frameCount) {
+                                DebugLogger.logWakeWord(TAG, "⚠️ AudioRecord read 0 bytes (frame #$frameCount)")
+                            }
                         }
                     } else {
                         DebugLogger.logWakeWordError(TAG, "❌ AudioRecord read failed: $bytesRead bytes")
@@ -488,14 +528,202 @@ class WakeService : Service() {
         }
     }
 
+    /**
+     * 录音线程持有AudioRecord，把读到的PCM写入录音会话；检测循环从会话里按帧读取，
+     * 不是所有者时阻塞在eventfd上，直到语音识别把录音交回
+     */
+    private fun listenWithCaptureSession(ar: AudioRecord, sessionPtr: Long) {
+        val session = SharedCapture.publish(sessionPtr)
+        captureLock.withLock {
+            captureStopped = false
+        }
+        captureSession = session
+        val capturing = AtomicBoolean(true)
+        val captureThread = Thread({ runCapture(ar, sessionPtr, capturing) }, "WakeCapture")
+
+        var audio = ShortArray(0)
+        var filled = 0
+        var nextWakeWordAllowed = Instant.MIN
+        var frameCount = 0
+        // 检测循环不挂起，一直在这个线程上，可以临时提高它的优先级；目标时长是一帧
+        val threadScope = AudioThreadScope(OpusNative.AUDIO_THREAD_WAKE,
+            wakeDevice.frameSize() * 1_000_000_000L / 16000)
+
+        try {
+            captureThread.start()
+            DebugLogger.logWakeWord(TAG, "🔄 Starting audio processing loop (capture session)...")
+
+            while (listening.get()) {
+                if (audio.size != wakeDevice.frameSize()) {
+                    val oldSize = audio.size
+                    audio = ShortArray(wakeDevice.frameSize())
+                    filled = 0
+                    AudioTrace.event(AudioTrace.WAKE_BUFFER_RESIZED, oldSize, audio.size) {
+                        DebugLogger.logAudioProcessing(TAG, "🔄 Audio buffer resized: $oldSize -> ${audio.size}")
+                    }
+                }
+
+                // 语音识别正在使用录音时阻塞在这里，超时只是为了检查listening
+                val read = OpusNative.readCaptureSession(sessionPtr, OpusNative.CAPTURE_WAKE,
+                    audio, filled, audio.size - filled, CAPTURE_READ_TIMEOUT_MS)
+                if (read < 0) {
+                    DebugLogger.logWakeWordError(TAG, "❌ Capture session ended")
+                    break
+                }
+                filled += read
+                if (filled < audio.size) {
+                    continue
+                }
+                filled = 0
+                frameCount++
+
+                val workStart = System.nanoTime()
+                val wakeWordDetected = wakeDevice.processFrame(audio)
+                val workNanos = System.nanoTime() - workStart
+                threadScope.reportWork(workNanos)
+                AudioTrace.event(AudioTrace.WAKE_FRAME, frameCount, (workNanos / 1000).toInt())
+                val now = Instant.now()
+                if (wakeWordDetected) {
+                    if (now > nextWakeWordAllowed) {
+                        AudioTrace.event(AudioTrace.WAKE_DETECTED, frameCount) {
+                            DebugLogger.logWakeWord(TAG, "🎯 WAKE WORD DETECTED! Frame #$frameCount")
+                        }
+                        nextWakeWordAllowed = now.plusMillis(WAKE_WORD_BACKOFF_MILLIS)
+                        onWakeWordDetected()
+                    } else {
+                        val remainingMs = nextWakeWordAllowed.toEpochMilli() - now.toEpochMilli()
+                        AudioTrace.event(AudioTrace.WAKE_BACKOFF, remainingMs.toInt(), frameCount) {
+                            DebugLogger.logWakeWord(TAG, "⏳ Wake word detected but in backoff period (${remainingMs}ms remaining)")
+                        }
+                    }
+                }
+
+                lastHeard.set(now)
+
+                if (frameCount % 1000 == 0) {
+                    AudioTrace.event(AudioTrace.WAKE_PROGRESS, frameCount) {
+                        DebugLogger.logAudioProcessing(TAG, "📊 Processed $frameCount frames, still listening...")
+                    }
+                }
+            }
+        } finally {
+            DebugLogger.logWakeWord(TAG, "🛑 Stopping capture session (processed $frameCount frames)")
+            threadScope.close()
+            capturing.set(false)
+            captureLock.withLock {
+                captureResumed.signalAll()
+            }
+            try {
+                captureThread.join()
+            } catch (e: InterruptedException) {
+                Thread.currentThread().interrupt()
+            }
+            captureSession = null
+            // 语音识别还在读的话，它归还之后会话才会被销毁
+            SharedCapture.withdraw(session)
+            try {
+                ar.release()
+            } catch (e: Exception) {
+                DebugLogger.logWakeWordError(TAG, "❌ Error releasing AudioRecord", e)
+            }
+            currentAudioRecord = null
+        }
+    }
+
+    /**
+     * 录音线程：唯一读取AudioRecord的地方，也只有这里启动和停止AudioRecord
+     */
+    private fun runCapture(ar: AudioRecord, sessionPtr: Long, capturing: AtomicBoolean) {
+        val buffer = ByteBuffer.allocateDirect(CAPTURE_CHUNK_BYTES).order(ByteOrder.nativeOrder())
+        val threadScope = AudioThreadScope(OpusNative.AUDIO_THREAD_CAPTURE)
+        try {
+            while (capturing.get()) {
+                captureLock.withLock {
+                    if (captureStopped && ar.recordingState == AudioRecord.RECORDSTATE_RECORDING) {
+                        ar.stop()
+                        DebugLogger.logWakeWord(TAG, "🛑 AudioRecord stopped, the STT device records on its own")
+                    }
+                    while (captureStopped && capturing.get()) {
+                        captureResumed.await()
+                    }
+                }
+                if (!capturing.get()) {
+                    break
+                }
+                if (ar.recordingState != AudioRecord.RECORDSTATE_RECORDING) {
+                    ar.startRecording()
+                    DebugLogger.logWakeWord(TAG, "✅ AudioRecord started")
+                }
+
+                val bytesRead = ar.read(buffer, buffer.capacity())
+                if (bytesRead > 0) {
+                    OpusNative.writeCaptureSessionDirect(sessionPtr, buffer, bytesRead)
+                    AudioTrace.event(AudioTrace.CAPTURE_CHUNK, bytesRead)
+                } else if (bytesRead < 0) {
+                    DebugLogger.logWakeWordError(TAG, "❌ AudioRecord read failed: $bytesRead")
+                    break
+                }
+            }
+        } catch (e: Exception) {
+            DebugLogger.logWakeWordError(TAG, "❌ Error in capture thread", e)
+        } finally {
+            try {
+                if (ar.recordingState == AudioRecord.RECORDSTATE_RECORDING) {
+                    ar.stop()
+                }
+            } catch (e: Exception) {
+                DebugLogger.logWakeWordError(TAG, "❌ Error stopping AudioRecord", e)
+            }
+            threadScope.close()
+            // 录音出错时让检测循环的读取返回-1，由外层循环重新开始
+            OpusNative.cancelCaptureSession(sessionPtr)
+        }
+    }
+
+    /**
+     * 在唤醒词那一帧的末尾把录音交给语音识别
+     */
+    private fun handOffCaptureToASR(session: SharedCapture.Session) {
+        val boundary = SharedCapture.handoff(session, OpusNative.CAPTURE_ASR)
+        if (!sttInputDevice.usesSharedCapture) {
+            captureLock.withLock {
+                captureStopped = true
+            }
+        }
+        DebugLogger.logWakeWord(TAG, "🔀 Capture handed to ASR at sample $boundary" +
+            if (sttInputDevice.usesSharedCapture) "" else ", AudioRecord released for the STT device")
+    }
+
+    /**
+     * 超时之后把录音交回唤醒词检测（语音识别正常结束时自己会交回）
+     */
+    private fun handCaptureBackToWake(session: SharedCapture.Session) {
+        captureLock.withLock {
+            captureStopped = false
+            captureResumed.signalAll()
+        }
+        val boundary = SharedCapture.handoff(session, OpusNative.CAPTURE_WAKE)
+        DebugLogger.logWakeWord(TAG, "🔀 Capture handed back to wake word detection at sample $boundary")
+    }
+
     private fun onWakeWordDetected() {
         DebugLogger.logWakeWord(TAG, "🎉 Wake word detected - processing...")
         
         // 通知所有注册的回调
         WakeWordCallbackManager.notifyWakeWordDetected()
         
-        // 暂停WakeService的AudioRecord以让ASR使用
-        pauseAudioRecordForASR()
+        // 把录音交给ASR；没有录音会话时暂停WakeService的AudioRecord以让ASR使用
+        val session = captureSession
+        if (session != null) {
+            handOffCaptureToASR(session)
+        } else {
+            pauseAudioRecordForASR()
+        }
+        if (DebugLogger.isAudioSaveEnabled()) {
+            scope.launch(Dispatchers.IO) {
+                AudioDebugSaver.saveWakeTrace(this@WakeService)
+            }
+        }
 
         val intent = Intent(this, MainActivity::class.java)
         intent.setAction(ACTION_WAKE_WORD)
@@ -591,6 +819,10 @@ class WakeService : Service() {
      * 恢复WakeService的AudioRecord在ASR完成后
      */
     private fun resumeAudioRecordAfterASR() {
+        captureSession?.let {
+            handCaptureBackToWake(it)
+            return
+        }
         DebugLogger.logWakeWord(TAG, "▶️ Resuming WakeService AudioRecord after ASR")
         audioRecordPaused.set(false)
         
@@ -689,6 +921,9 @@ class WakeService : Service() {
         private val lastHeard = AtomicReference<Instant>()
 
         private val TAG = WakeService::class.simpleName ?: "WakeService"
+        private const val CAPTURE_RING_MS = 5000 // 要能放下语音识别建立连接期间的录音
+        private const val CAPTURE_READ_TIMEOUT_MS = 1000
+        private const val CAPTURE_CHUNK_BYTES = 640 // 20ms @ 16kHz
         private const val FOREGROUND_NOTIFICATION_CHANNEL_ID =
             "org.stypox.dicio.io.wake.WakeService.FOREGROUND"
         private const val START_NOTIFICATION_CHANNEL_ID =
@@ -0,0 +1,146 @@
+package org.stypox.dicio.io.wake.gate
+
+import kotlinx.coroutines.flow.StateFlow
+import org.stypox.dicio.io.audio.OpusNative
+import org.stypox.dicio.io.wake.WakeDevice
+import org.stypox.dicio.io.wake.WakeState
+import org.stypox.dicio.util.DebugLogger
+
+/**
+ * 级联唤醒：常驻运行opus_wake_gate（每10ms几十微秒的小网络），只有它认为可能有语音时才把
+ * 音频交给重型唤醒模型（SherpaOnnx KWS / OpenWakeWord），安静或只有背景噪声时重型模型不运行。
+ *
+ * - 过滤器关闭时只把帧存进最近 [PRE_ROLL_MS] 的环形缓冲；
+ * - 某帧的概率超过 [THRESHOLD_Q8] 就打开，先把缓冲的帧按顺序补给重型模型，唤醒词的开头
+ *   不会丢；之后每帧都直接交给重型模型；
+ * - 连续 [HOLD_MS] 没有超过阈值就关闭并清空缓冲。
+ *
+ * 这些参数与 benchmark/wake_gate_benchmark.cpp 的模拟一致，调整时两边一起改。
+ * native过滤器创建失败时退化为不过滤，每帧都交给重型模型。
+ */
+class GatedWakeDevice(
+    private val heavy: WakeDevice,
+) : WakeDevice {
+
+    companion object {
+        private const val TAG = "GatedWakeDevice"
+        private const val SAMPLE_RATE = 16000
+        const val PRE_ROLL_MS = 1500
+        const val HOLD_MS = 1000
+        const val THRESHOLD_Q8 = 128
+    }
+
+    override val state: StateFlow<WakeState> = heavy.state
+
+    private val frameMs = 1000 * heavy.frameSize() / SAMPLE_RATE
+    private val preRoll = Array(maxOf(1, (PRE_ROLL_MS + frameMs / 2) / frameMs)) {
+        ShortArray(heavy.frameSize())
+    }
+    private val holdFrames = maxOf(1, (HOLD_MS + frameMs / 2) / frameMs)
+
+    private var gatePtr: Long = createGate()
+    private var preRollStart = 0
+    private var preRollCount = 0
+    private var open = false
+    private var hold = 0
+
+    // 调试计数器
+    private var framesSeen = 0L
+    private var framesPassed = 0L
+
+    private fun createGate(): Long {
+        return try {
+            OpusNative.createWakeGate(SAMPLE_RATE).also {
+                if (it == 0L) {
+                    DebugLogger.logWakeWordError(TAG, "❌ 唤醒前置过滤器创建失败，不做过滤")
+                }
+            }
+        } catch (e: UnsatisfiedLinkError) {
+            DebugLogger.logWakeWordError(TAG, "❌ Opus JNI不可用，不做过滤: ${e.message}", e)
+            0L
+        }
+    }
+
+    override fun download() {
+        heavy.download()
+    }
+
+    override fun processFrame(audio16bitPcm: ShortArray): Boolean {
+        val ptr = gatePtr
+        if (ptr == 0L) {
+            return heavy.processFrame(audio16bitPcm)
+        }
+
+        ++framesSeen
+        val fired = OpusNative.processWakeGate(ptr, audio16bitPcm, audio16bitPcm.size) >=
+                THRESHOLD_Q8
+
+        if (!open) {
+            if (!fired) {
+                pushPreRoll(audio16bitPcm)
+                return false
+            }
+            open = true
+            hold = holdFrames
+            DebugLogger.logWakeWord(TAG, "🔓 过滤器打开，补送${preRollCount}帧缓冲")
+            if (replayPreRoll()) {
+                return true
+            }
+        } else if (fired) {
+            hold = holdFrames
+        } else if (--hold == 0) {
+            // 本帧仍然交给重型模型，之后关闭
+            open = false
+            preRollCount = 0
+            DebugLogger.logWakeWord(TAG, "🔒 过滤器关闭，重型模型处理了" +
+                    "${framesPassed}/${framesSeen}帧")
+        }
+
+        ++framesPassed
+        return detected(heavy.processFrame(audio16bitPcm))
+    }
+
+    private fun pushPreRoll(frame: ShortArray) {
+        val slot = (preRollStart + preRollCount) % preRoll.size
+        frame.copyInto(preRoll[slot])
+        if (preRollCount < preRoll.size) {
+            ++preRollCount
+        } else {
+            preRollStart = (preRollStart + 1) % preRoll.size
+        }
+    }
+
+    private fun replayPreRoll(): Boolean {
+        val count = preRollCount
+        preRollCount = 0
+        for (i in 0 until count) {
+            ++framesPassed
+            if (heavy.processFrame(preRoll[(preRollStart + i) % preRoll.size])) {
+                return detected(true)
+            }
+        }
+        return false
+    }
+
+    private fun detected(result: Boolean): Boolean {
+        if (result) {
+            // 唤醒后开始新的一轮：缓冲里的音频已经用过了
+            open = false
+            preRollCount = 0
+            OpusNative.resetWakeGate(gatePtr)
+        }
+        return result
+    }
+
+    override fun frameSize(): Int = heavy.frameSize()
+
+    override fun destroy() {
+        if (gatePtr != 0L) {
+            OpusNative.destroyWakeGate(gatePtr)
+            gatePtr = 0L
+        }
+        heavy.destroy()
+    }
+
+    override fun isHeyDicio(): Boolean = heavy.isHeyDicio()
+}
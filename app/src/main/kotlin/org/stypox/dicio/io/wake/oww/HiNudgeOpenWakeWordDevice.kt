@@ -9,6 +9,7 @@ import kotlinx.coroutines.cancel
 import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.launch
+import org.stypox.dicio.io.audio.AudioTrace
 import org.stypox.dicio.io.wake.WakeDevice
 import org.stypox.dicio.io.wake.WakeState
 import org.stypox.dicio.util.DebugLogger
@@ -210,7 +211,9 @@ class HiNudgeOpenWakeWordDevice(
         // 添加调试日志确认方法被调用
         frameCount++
         if (frameCount % 100 == 0) {
-            DebugLogger.logWakeWord(TAG, "🔄 HiNudge processing frame #$frameCount, size: ${audio16bitPcm.size}")
+            AudioTrace.event(AudioTrace.HINUDGE_FRAME, frameCount, audio16bitPcm.size) {
+                DebugLogger.logWakeWord(TAG, "🔄 HiNudge processing frame #$frameCount, size: ${audio16bitPcm.size}")
+            }
         }
         
         if (audio16bitPcm.size != N_PREPARED_SAMPLES) {
@@ -237,14 +240,13 @@ class HiNudgeOpenWakeWordDevice(
             
             val processingTime = System.currentTimeMillis() - startTime
             
-            // 每1000帧记录一次性能统计
-            if (frameCount % 1000 == 0) {
-                DebugLogger.logWakeWord(TAG, "⚡ Frame processing time: ${processingTime}ms")
-            }
-            
-            // 每1000帧记录一次处理状态
+            // 每1000帧记录一次处理状态和性能统计
             if (frameCount % 1000 == 0) {
-                DebugLogger.logWakeWord(TAG, "📊 HiNudge processed $frameCount frames, latest score: $score")
+                AudioTrace.event(AudioTrace.HINUDGE_STATS, frameCount, processingTime.toInt(),
+                    AudioTrace.permille(score)) {
+                    DebugLogger.logWakeWord(TAG, "⚡ Frame processing time: ${processingTime}ms")
+                    DebugLogger.logWakeWord(TAG, "📊 HiNudge processed $frameCount frames, latest score: $score")
+                }
             }
             
             // 检查是否检测到唤醒词（阈值按照demo设置）
@@ -252,9 +254,15 @@ class HiNudgeOpenWakeWordDevice(
             val detected = score > threshold
             
             if (detected) {
-                DebugLogger.logWakeWord(TAG, "🎯 Wake word detected! Score: $score (threshold: $threshold)")
+                AudioTrace.event(AudioTrace.HINUDGE_DETECTED, AudioTrace.permille(score),
+                    AudioTrace.permille(threshold)) {
+                    DebugLogger.logWakeWord(TAG, "🎯 Wake word detected! Score: $score (threshold: $threshold)")
+                }
             } else if (score > 0.01f) { // 记录接近阈值的分数
-                DebugLogger.logWakeWord(TAG, "🔍 Wake word score: $score (below threshold: $threshold)")
+                AudioTrace.event(AudioTrace.HINUDGE_SCORE, AudioTrace.permille(score),
+                    AudioTrace.permille(threshold)) {
+                    DebugLogger.logWakeWord(TAG, "🔍 Wake word score: $score (below threshold: $threshold)")
+                }
             }
             
             return detected
@@ -7,6 +7,7 @@ import kotlinx.coroutines.cancel
 import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.launch
+import org.stypox.dicio.io.audio.AudioTrace
 import org.stypox.dicio.io.wake.WakeDevice
 import org.stypox.dicio.io.wake.WakeState
 import org.stypox.dicio.ui.util.Progress
@@ -384,11 +385,17 @@ class SherpaOnnxWakeDevice(
                 AudioDebugSaver.saveWakeAudio(appContext, audio16bitPcm, amplitude, confidence)
             }
 
-            // 记录检测结果
-            if (confidence > 0.0f) { // 只记录有效检测结果
-                DebugLogger.logWakeWordDetection(TAG, confidence, 0.25f, detected)
+            // 记录检测结果（只记录有效检测结果），由AudioTrace的后台线程格式化
+            if (confidence > 0.0f) {
+                AudioTrace.event(AudioTrace.SHERPA_DETECTION, if (detected) 1 else 0,
+                    AudioTrace.permille(confidence), AudioTrace.permille(0.25f)) {
+                    DebugLogger.logWakeWordDetection(TAG, confidence, 0.25f, detected)
+                }
+            }
+            AudioTrace.event(AudioTrace.SHERPA_AUDIO_STATS, audio16bitPcm.size, amplitude.toInt(),
+                AudioTrace.permille(0.25f)) {
+                DebugLogger.logAudioStats(TAG, audio16bitPcm.size, amplitude, 0.25f)
             }
-            DebugLogger.logAudioStats(TAG, audio16bitPcm.size, amplitude, 0.25f)
 
             detected
         } catch (t: Throwable) {
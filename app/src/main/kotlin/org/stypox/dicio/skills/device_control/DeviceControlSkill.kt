@@ -50,6 +50,12 @@ class DeviceControlSkill private constructor(
         private const val EXTRA_COMMAND = "command"
     }
     
+    /**
+     * 多语言模式下score会尝试所有语言，不能直接交给原生批量评分器
+     */
+    override val recognizerData: StandardRecognizerData<DeviceControl>?
+        get() = if (isMultiLanguage && allLanguageData != null) null else super.recognizerData
+
     /**
      * 覆盖父类的 score 方法以支持多语言匹配
      */
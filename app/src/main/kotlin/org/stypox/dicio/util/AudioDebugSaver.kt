@@ -2,6 +2,7 @@ package org.stypox.dicio.util
 
 import android.content.Context
 import android.util.Log
+import org.stypox.dicio.io.audio.AudioTrace
 import java.io.File
 import java.io.FileOutputStream
 import java.io.IOException
@@ -19,6 +20,7 @@ object AudioDebugSaver {
     private const val AUDIO_DEBUG_DIR = "audio_debug"
     private const val WAKE_AUDIO_DIR = "wake_audio"
     private const val ASR_AUDIO_DIR = "asr_audio"
+    private const val TRACE_DIR = "trace"
     
     // 文件名时间格式
     private val dateFormat = SimpleDateFormat("yyyyMMdd_HHmmss_SSS", Locale.getDefault())
@@ -80,6 +82,27 @@ object AudioDebugSaver {
         }
     }
     
+    /**
+     * 把AudioTrace事件环中最近的事件导出成JSON（用Perfetto UI打开），在唤醒时调用，
+     * 记录的是唤醒之前的几分钟
+     * @param context 应用上下文
+     */
+    fun saveWakeTrace(context: Context) {
+        if (!DebugLogger.isAudioSaveEnabled()) return
+        
+        try {
+            val timestamp = dateFormat.format(Date())
+            val fileName = "wake_${timestamp}.json"
+            
+            val traceFile = getAudioFile(context, TRACE_DIR, fileName)
+            val events = AudioTrace.export(traceFile)
+            
+            DebugLogger.logDebug(TAG, "💾 Saved wake trace: $fileName ($events events)")
+        } catch (e: Exception) {
+            Log.e(TAG, "Failed to save wake trace", e)
+        }
+    }
+    
     /**
      * 保存音频数据到PCM文件
      */
@@ -126,6 +149,9 @@ object AudioDebugSaver {
             // 清理ASR音频
             cleanupDirectory(File(audioDebugDir, ASR_AUDIO_DIR), maxFiles)
             
+            // 清理事件记录
+            cleanupDirectory(File(audioDebugDir, TRACE_DIR), maxFiles)
+            
             DebugLogger.logDebug(TAG, "🧹 Cleaned up old audio files, keeping $maxFiles files per directory")
         } catch (e: Exception) {
             Log.e(TAG, "Failed to cleanup audio files", e)
@@ -24,6 +24,9 @@ object DebugLogger {
     // ASR文本显示专用调试开关 - 临时增强调试
     private const val DEBUG_ASR_TEXT_FLOW = DEBUG_ENABLED && true
     
+    // 音频热循环的事件记录（AudioTrace）由后台线程写入日志
+    private const val DEBUG_AUDIO_TRACE = DEBUG_ENABLED && true
+    
     // 唤醒词相关日志
     fun logWakeWord(tag: String?, message: String) {
         if (DEBUG_WAKE_WORD && tag != null) {
@@ -72,6 +75,13 @@ object DebugLogger {
         }
     }
     
+    // 音频热循环的事件记录，由AudioTrace的后台线程调用
+    fun logTrace(tag: String?, message: String) {
+        if (DEBUG_AUDIO_TRACE && tag != null) {
+            Log.d("🧵[$tag]", message)
+        }
+    }
+    
     // 识别结果日志
     fun logRecognition(tag: String?, message: String) {
         if (DEBUG_VOICE_RECOGNITION && tag != null) {
@@ -143,6 +153,11 @@ object DebugLogger {
      * 检查音频保存功能是否启用
      */
     fun isAudioSaveEnabled(): Boolean = DEBUG_SAVE_AUDIO
+
+    /**
+     * 检查是否启动AudioTrace的日志线程（关闭时事件仍然记录，可以导出）
+     */
+    fun isAudioTraceLogEnabled(): Boolean = DEBUG_AUDIO_TRACE
 }
 
 /**
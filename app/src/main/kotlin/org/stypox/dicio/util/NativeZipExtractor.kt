@@ -0,0 +1,54 @@
+package org.stypox.dicio.util
+
+import android.util.Log
+
+/**
+ * 原生zip解压JNI绑定类
+ * 读取中央目录后在多个线程上并行解压各个条目（zlib + pwrite，stored条目用copy_file_range），
+ * 用于首次启动时解压几百MB的模型包
+ */
+object NativeZipExtractor {
+    private const val TAG = "NativeZipExtractor"
+
+    // 与archive/zip_extractor.h的ZipResult一致
+    const val ZIP_OK = 0
+    const val ZIP_UNSUPPORTED = -3
+    const val ZIP_CANCELLED = -6
+
+    /**
+     * 原生库是否加载成功，失败时extractZip退回到java.util.zip
+     */
+    val isAvailable: Boolean = try {
+        System.loadLibrary("zip_extractor")
+        Log.d(TAG, "✅ zip解压JNI库加载成功")
+        true
+    } catch (e: UnsatisfiedLinkError) {
+        Log.e(TAG, "❌ zip解压JNI库加载失败: ${e.message}", e)
+        false
+    }
+
+    fun interface ProgressListener {
+        /**
+         * 在调用[extractZip]的线程上定时调用
+         * @return false取消解压
+         */
+        fun onProgress(doneFiles: Int, totalFiles: Int, doneBytes: Long, totalBytes: Long): Boolean
+    }
+
+    /**
+     * 把zip解压到目标目录，与[getDestinationFile]一样去掉条目路径的第一段
+     * @param threads 线程数，0表示每个核心一个线程
+     * @return [ZIP_OK]或负的错误码，[ZIP_UNSUPPORTED]表示可以退回到java.util.zip
+     */
+    external fun extractZip(
+        zipPath: String,
+        destinationPath: String,
+        threads: Int,
+        listener: ProgressListener
+    ): Int
+
+    /**
+     * 错误码的英文描述
+     */
+    external fun resultString(result: Int): String
+}
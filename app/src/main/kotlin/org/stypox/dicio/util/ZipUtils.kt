@@ -19,7 +19,9 @@
 
 package org.stypox.dicio.util
 
+import android.util.Log
 import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.ensureActive
 import kotlinx.coroutines.withContext
 import kotlinx.coroutines.yield
 import org.stypox.dicio.ui.util.Progress
@@ -30,6 +32,7 @@ import java.io.FileOutputStream
 import java.io.IOException
 import java.util.zip.ZipFile
 
+private const val TAG = "ZipUtils"
 private const val CHUNK_SIZE = 1024 * 256 // 0.25 MB
 
 suspend fun extractZip(
@@ -37,6 +40,11 @@ suspend fun extractZip(
     destinationDirectory: File,
     progressCallback: (Progress) -> Unit,
 ) {
+    if (NativeZipExtractor.isAvailable && extractZipNative(
+            sourceZip, destinationDirectory, progressCallback)) {
+        return
+    }
+
     withContext(Dispatchers.IO) { ZipFile(sourceZip) }.use { zipFile ->
         // counting just files
         var currentCount = 0
@@ -87,6 +95,41 @@ suspend fun extractZip(
     }
 }
 
+/**
+ * Extracts [sourceZip] with [NativeZipExtractor], which inflates the entries on all cores.
+ * Progress is reported for the whole archive rather than per file, since several files are being
+ * written at the same time.
+ *
+ * @return `false` if the archive uses a feature the native extractor does not support (e.g.
+ * encryption or a compression method other than deflate), in which case no file has been written
+ * yet and the caller should fall back to [ZipFile]
+ */
+private suspend fun extractZipNative(
+    sourceZip: File,
+    destinationDirectory: File,
+    progressCallback: (Progress) -> Unit,
+): Boolean = withContext(Dispatchers.IO) {
+    val result = NativeZipExtractor.extractZip(
+        sourceZip.absolutePath, destinationDirectory.absolutePath, 0
+    ) { doneFiles, totalFiles, doneBytes, totalBytes ->
+        // a CancellationException thrown here is rethrown once the native call returns
+        ensureActive()
+        progressCallback(Progress(doneFiles, totalFiles, doneBytes, totalBytes))
+        true
+    }
+    when (result) {
+        NativeZipExtractor.ZIP_OK -> true
+        NativeZipExtractor.ZIP_UNSUPPORTED -> {
+            Log.w(TAG, "Native extractor does not support $sourceZip, using java.util.zip")
+            false
+        }
+        else -> {
+            // cancellation without an exception cannot happen, since the listener returns true
+            throw IOException("Can't extract $sourceZip: ${NativeZipExtractor.resultString(result)}")
+        }
+    }
+}
+
 /**
  * Returns the path inside [destinationDirectory] where to save the zip entry with name [entryName],
  * while protecting from Zip Slip vulnerabilities by checking whether the actual generated path is
@@ -2,6 +2,7 @@ package org.dicio.skill.standard
 
 import org.dicio.skill.skill.Specificity
 import org.dicio.skill.standard.construct.Construct
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
 import org.dicio.skill.standard.util.MatchHelper
 import org.dicio.skill.standard.util.initialMemToEnd
 
@@ -12,15 +13,12 @@ open class StandardRecognizerData<out T>(
 ) {
     fun score(input: String): Pair<StandardScore, T> {
         val helper = MatchHelper(input)
-        val cumulativeWeight = helper.cumulativeWeight
 
         var bestRes: Pair<String, StandardScore>? = null
         for ((sentenceId, construct) in sentencesWithId) {
-            val memToEnd = initialMemToEnd(cumulativeWeight)
-            construct.matchToEnd(memToEnd, helper)
-
-            if (bestRes == null || memToEnd[0].score() > bestRes.second.score()) {
-                bestRes = Pair(sentenceId, memToEnd[0])
+            val score = matchSentence(construct, helper)
+            if (bestRes == null || score.score() > bestRes.second.score()) {
+                bestRes = Pair(sentenceId, score)
             }
         }
 
@@ -35,4 +33,33 @@ open class StandardRecognizerData<out T>(
             )
         )
     }
+
+    /**
+     * Like [score], but only evaluates the sentence at [sentenceIndex]. Used when the best sentence
+     * has already been chosen by a native matcher, in order to build the capturing groups and the
+     * converted result only for that sentence.
+     */
+    fun scoreSentence(input: String, sentenceIndex: Int): Pair<StandardScore, T> {
+        val (sentenceId, construct) = sentencesWithId[sentenceIndex]
+        val score = matchSentence(construct, MatchHelper(input))
+        return Pair(score, converter(input, sentenceId, score))
+    }
+
+    /**
+     * Appends all sentences of this data as a single skill to [builder], in the same order used by
+     * [scoreSentence].
+     */
+    fun compile(builder: CompiledGrammarBuilder) {
+        builder.beginSkill()
+        for ((_, construct) in sentencesWithId) {
+            builder.beginSentence()
+            construct.compile(builder)
+        }
+    }
+
+    private fun matchSentence(construct: Construct, helper: MatchHelper): StandardScore {
+        val memToEnd = initialMemToEnd(helper.cumulativeWeight)
+        construct.matchToEnd(memToEnd, helper)
+        return memToEnd[0]
+    }
 }
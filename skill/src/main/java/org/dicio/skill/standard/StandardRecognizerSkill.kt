@@ -10,6 +10,13 @@ abstract class StandardRecognizerSkill<T>(
     private val data: StandardRecognizerData<T>,
 ) : Skill<T>(correspondingSkillInfo, data.specificity) {
 
+    /**
+     * The data used by [score], exposed so that rankers can evaluate many skills at once (e.g.
+     * natively). Subclasses that override [score] with different semantics must return `null`.
+     */
+    open val recognizerData: StandardRecognizerData<T>?
+        get() = data
+
     override fun score(
         ctx: SkillContext,
         input: String
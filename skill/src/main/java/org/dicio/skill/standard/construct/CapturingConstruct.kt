@@ -2,6 +2,7 @@ package org.dicio.skill.standard.construct
 
 import org.dicio.skill.standard.StandardScore
 import org.dicio.skill.standard.capture.StringRangeCapture
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
 import org.dicio.skill.standard.util.MatchHelper
 import org.dicio.skill.standard.util.normalizeMemToEnd
 
@@ -57,6 +58,10 @@ data class CapturingConstruct(
         normalizeMemToEnd(memToEnd, helper.cumulativeWeight)
     }
 
+    override fun compile(builder: CompiledGrammarBuilder) {
+        builder.capture(name, weight)
+    }
+
     override fun toString(): String {
         return ".$name."
     }
@@ -1,6 +1,7 @@
 package org.dicio.skill.standard.construct
 
 import org.dicio.skill.standard.StandardScore
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
 import org.dicio.skill.standard.util.MatchHelper
 import org.dicio.skill.standard.util.normalizeMemToEnd
 
@@ -15,6 +16,13 @@ data class CompositeConstruct(
         normalizeMemToEnd(memToEnd, helper.cumulativeWeight)
     }
 
+    override fun compile(builder: CompiledGrammarBuilder) {
+        builder.composite(constructs.size)
+        for (construct in constructs) {
+            construct.compile(builder)
+        }
+    }
+
     override fun toString(): String {
         return "(" + constructs.joinToString(" ") { it.toString() } + ")"
     }
@@ -1,8 +1,15 @@
 package org.dicio.skill.standard.construct
 
 import org.dicio.skill.standard.StandardScore
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
 import org.dicio.skill.standard.util.MatchHelper
 
 interface Construct {
     fun matchToEnd(memToEnd: Array<StandardScore>, helper: MatchHelper)
+
+    /**
+     * Appends this construct (and its children, in order) to the flat encoding used by native
+     * matchers. See [CompiledGrammarBuilder].
+     */
+    fun compile(builder: CompiledGrammarBuilder)
 }
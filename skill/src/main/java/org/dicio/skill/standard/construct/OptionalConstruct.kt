@@ -1,12 +1,17 @@
 package org.dicio.skill.standard.construct
 
 import org.dicio.skill.standard.StandardScore
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
 import org.dicio.skill.standard.util.MatchHelper
 
 class OptionalConstruct : Construct {
     override fun matchToEnd(memToEnd: Array<StandardScore>, helper: MatchHelper) {
     }
 
+    override fun compile(builder: CompiledGrammarBuilder) {
+        builder.optional()
+    }
+
     override fun toString(): String {
         return "(?)"
     }
@@ -1,6 +1,7 @@
 package org.dicio.skill.standard.construct
 
 import org.dicio.skill.standard.StandardScore
+import org.dicio.skill.standard.util.CompiledGrammarBuilder
 import org.dicio.skill.standard.util.MatchHelper
 import org.dicio.skill.standard.util.normalizeMemToEnd
 
@@ -46,6 +47,10 @@ data class WordConstruct(
         normalizeMemToEnd(memToEnd, cumulativeWeight)
     }
 
+    override fun compile(builder: CompiledGrammarBuilder) {
+        builder.word(text, isRegex, isDiacriticsSensitive, weight)
+    }
+
     override fun toString(): String {
         return text
     }
@@ -0,0 +1,120 @@
+package org.dicio.skill.standard.util
+
+/**
+ * A flat, prefix-ordered encoding of the [org.dicio.skill.standard.construct.Construct] trees of
+ * one or more skills, meant to be handed over to native matchers in a single call. The layout of
+ * [nodes] must be kept in sync with `app/src/main/cpp/matcher/grammar.h`.
+ *
+ * @param nodes the encoded nodes, see [CompiledGrammarBuilder] for the layout of each node
+ * @param weights the weights referenced by index from [nodes]
+ * @param strings the words, regexes and capturing group names referenced by index from [nodes]
+ * @param sentenceRoots for each sentence, the offset in [nodes] of its root construct
+ * @param skillSentenceCounts for each skill, how many consecutive sentences in [sentenceRoots]
+ * belong to it
+ */
+class CompiledGrammar(
+    val nodes: IntArray,
+    val weights: FloatArray,
+    val strings: Array<String>,
+    val sentenceRoots: IntArray,
+    val skillSentenceCounts: IntArray,
+)
+
+class CompiledGrammarBuilder {
+    private val nodes = ArrayList<Int>()
+    private val weights = ArrayList<Float>()
+    private val strings = ArrayList<String>()
+    private val stringIndices = HashMap<String, Int>()
+    private val sentenceRoots = ArrayList<Int>()
+    private val skillSentenceCounts = ArrayList<Int>()
+
+    fun beginSkill() {
+        skillSentenceCounts.add(0)
+    }
+
+    fun beginSentence() {
+        check(skillSentenceCounts.isNotEmpty()) { "beginSkill() must be called before sentences" }
+        sentenceRoots.add(nodes.size)
+        skillSentenceCounts[skillSentenceCounts.size - 1] += 1
+    }
+
+    /**
+     * `[WORD, flags, stringIndex, weightIndex]`
+     */
+    fun word(text: String, isRegex: Boolean, isDiacriticsSensitive: Boolean, weight: Float) {
+        nodes.add(NODE_WORD)
+        nodes.add((if (isRegex) WORD_FLAG_REGEX else 0) or
+                (if (isDiacriticsSensitive) WORD_FLAG_DIACRITICS_SENSITIVE else 0))
+        nodes.add(stringIndex(text))
+        nodes.add(weightIndex(weight))
+    }
+
+    /**
+     * `[OR, childCount, child...]`, the children must be added right after calling this
+     */
+    fun orList(childCount: Int) {
+        nodes.add(NODE_OR)
+        nodes.add(childCount)
+    }
+
+    /**
+     * `[COMPOSITE, childCount, child...]`, the children must be added right after calling this
+     */
+    fun composite(childCount: Int) {
+        nodes.add(NODE_COMPOSITE)
+        nodes.add(childCount)
+    }
+
+    /**
+     * `[OPTIONAL]`
+     */
+    fun optional() {
+        nodes.add(NODE_OPTIONAL)
+    }
+
+    /**
+     * `[CAPTURE, nameIndex, weightIndex]`
+     */
+    fun capture(name: String, weight: Float) {
+        nodes.add(NODE_CAPTURE)
+        nodes.add(stringIndex(name))
+        nodes.add(weightIndex(weight))
+    }
+
+    fun build(): CompiledGrammar {
+        return CompiledGrammar(
+            nodes = nodes.toIntArray(),
+            weights = weights.toFloatArray(),
+            strings = strings.toTypedArray(),
+            sentenceRoots = sentenceRoots.toIntArray(),
+            skillSentenceCounts = skillSentenceCounts.toIntArray(),
+        )
+    }
+
+    private fun stringIndex(string: String): Int {
+        return stringIndices.getOrPut(string) {
+            strings.add(string)
+            strings.size - 1
+        }
+    }
+
+    private fun weightIndex(weight: Float): Int {
+        val index = weights.indexOf(weight)
+        if (index >= 0) {
+            return index
+        }
+        weights.add(weight)
+        return weights.size - 1
+    }
+
+    companion object {
+        const val NODE_WORD = 0
+        const val NODE_OR = 1
+        const val NODE_COMPOSITE = 2
+        const val NODE_OPTIONAL = 3
+        const val NODE_CAPTURE = 4
+
+        const val WORD_FLAG_REGEX = 1
+        const val WORD_FLAG_DIACRITICS_SENSITIVE = 2
+    }
+}
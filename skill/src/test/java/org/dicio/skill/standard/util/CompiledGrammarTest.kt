@@ -0,0 +1,69 @@
+package org.dicio.skill.standard.util
+
+import io.kotest.core.spec.style.DescribeSpec
+import io.kotest.matchers.shouldBe
+import org.dicio.skill.skill.Specificity
+import org.dicio.skill.standard.StandardRecognizerData
+import org.dicio.skill.standard.construct.CapturingConstruct
+import org.dicio.skill.standard.construct.CompositeConstruct
+import org.dicio.skill.standard.construct.OptionalConstruct
+import org.dicio.skill.standard.construct.OrConstruct
+import org.dicio.skill.standard.construct.WordConstruct
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.NODE_CAPTURE
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.NODE_COMPOSITE
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.NODE_OPTIONAL
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.NODE_OR
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.NODE_WORD
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.WORD_FLAG_DIACRITICS_SENSITIVE
+import org.dicio.skill.standard.util.CompiledGrammarBuilder.Companion.WORD_FLAG_REGEX
+
+class CompiledGrammarTest : DescribeSpec({
+    describe("CompiledGrammarBuilder") {
+        it("encodes constructs in prefix order") {
+            val builder = CompiledGrammarBuilder()
+            builder.beginSkill()
+            builder.beginSentence()
+            CompositeConstruct(listOf(
+                WordConstruct("hello", false, false, 1.0f),
+                OrConstruct(listOf(
+                    WordConstruct("wor(?:ld|d)", true, true, 1.0f),
+                    OptionalConstruct(),
+                )),
+                CapturingConstruct("what", 0.5f),
+            )).compile(builder)
+            val grammar = builder.build()
+
+            grammar.nodes shouldBe intArrayOf(
+                NODE_COMPOSITE, 3,
+                NODE_WORD, 0, 0, 0,
+                NODE_OR, 2,
+                NODE_WORD, WORD_FLAG_REGEX or WORD_FLAG_DIACRITICS_SENSITIVE, 1, 0,
+                NODE_OPTIONAL,
+                NODE_CAPTURE, 2, 1,
+            )
+            grammar.weights shouldBe floatArrayOf(1.0f, 0.5f)
+            grammar.strings shouldBe arrayOf("hello", "wor(?:ld|d)", "what")
+            grammar.sentenceRoots shouldBe intArrayOf(0)
+            grammar.skillSentenceCounts shouldBe intArrayOf(1)
+        }
+
+        it("keeps sentences of different skills apart and deduplicates strings") {
+            val first = StandardRecognizerData(Specificity.HIGH, { _, _, _ -> }, listOf(
+                Pair("a", WordConstruct("time", false, false, 1.0f)),
+                Pair("b", OptionalConstruct()),
+            ))
+            val second = StandardRecognizerData(Specificity.HIGH, { _, _, _ -> }, listOf(
+                Pair("c", WordConstruct("time", false, false, 1.0f)),
+            ))
+
+            val builder = CompiledGrammarBuilder()
+            first.compile(builder)
+            second.compile(builder)
+            val grammar = builder.build()
+
+            grammar.sentenceRoots shouldBe intArrayOf(0, 4, 5)
+            grammar.skillSentenceCounts shouldBe intArrayOf(2, 1)
+            grammar.strings shouldBe arrayOf("time")
+        }
+    }
+})